@@ -69,6 +69,151 @@ abstract class Luminous
         }
     }
 
+    /**
+     * @brief Highlights several pieces of source code at once
+     *
+     * This is for pages with many snippets. It gives the same output as
+     * calling highlight() for each job, but identical snippets are only
+     * highlighted once, and the cache is read and written in one batch
+     * rather than once per snippet.
+     *
+     * @param $jobs An array of jobs, each an array of ($scanner, $source)
+     *    where $scanner is a language code
+     * @param $settings An array of settings which apply to every job, as
+     *    highlight()
+     * @return An array of the highlighted source code of each job, with the
+     *    same keys as $jobs
+     *
+     * @code
+     * list($a, $b) = luminous::highlightMany(array(
+     *     array('php', $phpSnippet),
+     *     array('css', $cssSnippet),
+     * ));
+     * @endcode
+     */
+    public static function highlightMany($jobs, $settings = null)
+    {
+        global $luminous_;
+        try {
+            $h = $luminous_->highlightMany($jobs, $settings);
+            if ($luminous_->settings->verbose) {
+                $errs = self::cacheErrors();
+                if (!empty($errs)) {
+                    trigger_error("Luminous cache errors were encountered. \nSee luminous::cacheErrors() for details.");
+                }
+            }
+            return $h;
+        } catch (InvalidArgumentException $e) {
+            throw $e;
+        } catch (Exception $e) {
+            // as highlight(), don't kill the whole page in production code
+            if (LUMINOUS_DEBUG) {
+                throw $e;
+            }
+            $return = array();
+            $t = self::setting('failure-tag');
+            foreach ($jobs as $key => $job) {
+                $source = end($job);
+                $return[$key] = $t ? "<$t>$source</$t>" : $source;
+            }
+            return $return;
+        }
+    }
+
+    /**
+     * @brief Highlights a string which is going to be edited and re-highlighted
+     *
+     * This is intended for live previews. Each call to the returned object's
+     * edit() method only rescans the region around the edit, rather than the
+     * whole source. The cache is not used.
+     *
+     * @param $scanner The scanner to use, as a language code
+     * @param $source The source string
+     * @param $settings An array of settings, as highlight()
+     * @return A Luminous\IncrementalHighlighter. Call its output() method to get
+     *    the highlighted source code, and edit($offset, $deleteLength, $insert)
+     *    to apply an edit and get the new highlighted code.
+     *
+     * @code
+     * $h = luminous::highlightIncremental('php', $source);
+     * echo $h->output();
+     * // the user typed 'x' at byte 120
+     * echo $h->edit(120, 0, 'x');
+     * @endcode
+     */
+    public static function highlightIncremental($scanner, $source, $settings = null)
+    {
+        global $luminous_;
+        return $luminous_->highlightIncremental($scanner, $source, $settings);
+    }
+
+    /**
+     * @brief Highlights a stream, outputting it a piece at a time
+     *
+     * This is intended for very large inputs. The input is read and
+     * highlighted in chunks, and the output is passed to the sink as it is
+     * produced, so memory use stays bounded however large the input is. The
+     * cache is not used.
+     *
+     * This relies on the scanner taking checkpoints of its state. Some
+     * scanners can't (e.g. bash, python and diff), in which case the whole
+     * input is read and scanned in one go before anything is output. As for
+     * highlightTo(), HTML with line numbers is only output at the end,
+     * although the code is held in a temporary file rather than in memory.
+     *
+     * The output is the same as highlight()'s, except for scanners which
+     * record definitions (e.g. PHP and Go functions and types). A definition
+     * normally highlights every use of its name, but uses which were output
+     * before the definition was read keep their plain highlighting.
+     *
+     * @param $scanner The scanner to use, as a language code
+     * @param $input A readable stream resource, or the name of a file
+     * @param $sink Where to write the output: a callable which is passed
+     *    each string of output, a writable stream resource, or the name of a
+     *    stream to open. If this is @c NULL, the output is printed. The output
+     *    is flushed every 'flush-lines' lines.
+     * @param $settings An array of settings, as highlight()
+     *
+     * @code
+     * $out = fopen('dump.html', 'wb');
+     * luminous::highlightStream('sql', 'dump.sql', function ($html) use ($out) {
+     *     fwrite($out, $html);
+     * });
+     * @endcode
+     */
+    public static function highlightStream($scanner, $input, $sink = null, $settings = null)
+    {
+        global $luminous_;
+        $luminous_->highlightStream($scanner, $input, $sink, $settings);
+    }
+
+    /**
+     * @brief Highlights a string, writing the output as it is formatted
+     *
+     * This is like highlight(), but the output is written to a sink (by
+     * default, printed) and flushed every 'flush-lines' lines, rather than
+     * returned all at once. A browser then gets the start of a large file
+     * while the rest is still being formatted. The cache is not used.
+     *
+     * Only the formatting is done a piece at a time: the whole source is
+     * scanned before anything is output (highlightStream() scans a piece at
+     * a time too). Also, the HTML formatter's numbered layout (the default)
+     * puts the line numbers in a column before the code, and they aren't
+     * known until the end, so it holds the code back and outputs everything
+     * at the end. Turn 'line-numbers' off for HTML which is flushed as it is
+     * formatted.
+     *
+     * @param $scanner The scanner to use, as a language code
+     * @param $source The source string
+     * @param $sink Where to write the output, as highlightStream()
+     * @param $settings An array of settings, as highlight()
+     */
+    public static function highlightTo($scanner, $source, $sink = null, $settings = null)
+    {
+        global $luminous_;
+        $luminous_->highlightTo($scanner, $source, $sink, $settings);
+    }
+
     /**
      * @brief Highlights a file according to the current setings.
      *
@@ -296,14 +441,16 @@ abstract class Luminous
      *  Therefore it is recommended to keep this between 0.01 and 0.10.
      * @param $default The default name to return in the event that no scanner
      * thinks this source belongs to them (at the desired confidence).
+     * @param $filename The source's file name, if it is known. If its
+     *  extension is a language code, that language is chosen.
      *
      * @return A valid code for the best scanner, or $default.
      *
      * This is a wrapper around luminous::guess_language_full
      */
-    public static function guessLanguage($src, $confidence = 0.05, $default = 'plain')
+    public static function guessLanguage($src, $confidence = 0.05, $default = 'plain', $filename = null)
     {
-        $guess = self::guessLanguageFull($src);
+        $guess = self::guessLanguageFull($src, $filename);
         if ($guess[0]['p'] >= $confidence) {
             return $guess[0]['codes'][0];
         } else {
@@ -314,6 +461,8 @@ abstract class Luminous
     /**
      * @brief Attempts to guess the language of a piece of source code
      * @param $src The source code whose language is to be guessed
+     * @param $filename The source's file name, if it is known. If its
+     *    extension is a language code, that language is given p = 1.0.
      * @return An array - the array is ordered by probability, with the most
      *    probable language coming first in the array.
      *    Each array element is an array which represents a language (scanner),
@@ -330,6 +479,10 @@ abstract class Luminous
      * going to be severely hampered in the case that one language is used to
      * generate code in another language.
      *
+     * Only a sample from the start and end of a large source is looked at, a
+     * shebang naming a known interpreter decides the language outright, and
+     * results are memoized, so guessing is cheap next to highlighting.
+     *
      * Usage for this function will be something like this:
      * @code
      * $guesses = luminous::guess_language($src);
@@ -338,48 +491,10 @@ abstract class Luminous
      *
      * @see luminous::guess_language
      */
-    public static function guessLanguageFull($src)
+    public static function guessLanguageFull($src, $filename = null)
     {
         global $luminous_;
-        // first we're going to make an 'info' array for the source, which
-        // precomputes some frequently useful things, like how many lines it
-        // has, etc. It prevents scanners from redundantly figuring these things
-        // out themselves
-        $lines = preg_split("/\r\n|[\r\n]/", $src);
-        $shebang = '';
-        if (preg_match('/^#!.*/', $src, $m)) {
-            $shebang = $m[0];
-        }
-
-        $info = array(
-            'lines' => $lines,
-            'num_lines' => count($lines),
-            'trimmed' => trim($src),
-            'shebang' => $shebang
-        );
-
-        $return = array();
-        foreach (self::scanners() as $lang => $codes) {
-            $scannerName = $luminous_->scanners->GetScanner($codes[0], false, false);
-            assert($scannerName !== null);
-            $return[] = array(
-                'language' => $lang,
-                'codes' => $codes,
-                'p' => call_user_func(array($scannerName, 'guessLanguage'), $src, $info)
-            );
-        }
-        uasort($return, function ($a, $b) {
-            $c = $a['p'] - $b['p'];
-            if ($c === 0) {
-                return 0;
-            }
-            if ($c < 0) {
-                return -1;
-            }
-            return 1;
-        });
-        $return = array_reverse($return);
-        return $return;
+        return $luminous_->guessLanguage($src, $filename);
     }
 
     /**
@@ -0,0 +1,94 @@
+<?php
+/** @cond ALL */
+
+namespace Luminous\Caches;
+
+/**
+ * APCu cache driver
+ * @brief Keeps entries in shared memory with the APCu extension
+ *
+ * This is a tier in front of another cache (see Cache::addTier()), which is
+ * shared by every process on the server. Entries expire after the purge time,
+ * and APCu evicts them itself when its memory (apc.shm_size) is full. Entries
+ * larger than MAX_ENTRY_BYTES aren't stored, so a few huge sources can't push
+ * everything else out.
+ */
+class ApcuCache extends Cache
+{
+    /**
+     * The prefix of the keys in APCu
+     */
+    const PREFIX = 'luminous:';
+
+    /**
+     * The largest entry to store, in bytes
+     */
+    const MAX_ENTRY_BYTES = 1048576;
+
+    public function __construct($id)
+    {
+        parent::__construct($id);
+        $this->gz = false;
+    }
+
+    /**
+     * @brief Whether APCu is installed and enabled
+     */
+    public static function available()
+    {
+        if (!function_exists('apcu_fetch') || !ini_get('apc.enabled')) {
+            return false;
+        }
+        return PHP_SAPI !== 'cli' || ini_get('apc.enable_cli');
+    }
+
+    protected function createInternal()
+    {
+        return self::available();
+    }
+
+    protected function readInternal()
+    {
+        $data = apcu_fetch(self::PREFIX . $this->id, $success);
+        return $success ? $data : false;
+    }
+
+    protected function writeInternal($data)
+    {
+        if (strlen($data) > self::MAX_ENTRY_BYTES) {
+            return;
+        }
+        if (!apcu_store(self::PREFIX . $this->id, $data, max(0, $this->timeout))) {
+            $this->logError('Failed to store ' . $this->id . ' in APCu');
+        }
+    }
+
+    /**
+     * Fetches all the entries in one call
+     */
+    protected function readManyInternal($ids)
+    {
+        $keys = array();
+        foreach ($ids as $id) {
+            $keys[self::PREFIX . $id] = $id;
+        }
+        $found = array();
+        $fetched = apcu_fetch(array_keys($keys));
+        if (is_array($fetched)) {
+            foreach ($fetched as $key => $data) {
+                $found[$keys[$key]] = $data;
+            }
+        }
+        return $found;
+    }
+
+    protected function update()
+    {
+    }
+
+    protected function purgeInternal()
+    {
+    }
+}
+
+/** @endcond */
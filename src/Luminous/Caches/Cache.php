@@ -6,6 +6,10 @@ namespace Luminous\Caches;
 /**
  * Cache superclass provides a skeleton for implementations using the filesystem
  * or SQL, or anything else.
+ *
+ * Faster caches can be layered in front of a cache with addTier(). Reads try
+ * the tiers in order before the cache itself, and an entry found in a slower
+ * tier (or the cache) is copied into the faster ones. Writes go to every tier.
  */
 abstract class Cache
 {
@@ -18,6 +22,11 @@ abstract class Cache
 
     private $errors = array();
 
+    /**
+     * Caches in front of this one, fastest first
+     */
+    private $tiers = array();
+
     public function __construct($id)
     {
         $this->id = $id;
@@ -50,12 +59,36 @@ abstract class Cache
 
     public function errors()
     {
-        return $this->errors;
+        $errors = $this->errors;
+        foreach ($this->tiers as $tier) {
+            $errors = array_merge($errors, $tier->errors());
+        }
+        return $errors;
+    }
+
+    /**
+     * @brief Adds a cache in front of this one
+     *
+     * Tiers are tried in the order they are added, so add the fastest first.
+     * The tier should have the same ID as this cache.
+     */
+    public function addTier(Cache $tier)
+    {
+        $this->tiers[] = $tier;
     }
 
     abstract protected function createInternal();
     abstract protected function readInternal();
     abstract protected function writeInternal($data);
+
+    /**
+     * Writes an entry which may already exist, replacing it. Drivers whose
+     * writeInternal() leaves an existing entry alone must override this.
+     */
+    protected function replaceInternal($data)
+    {
+        $this->writeInternal($data);
+    }
     abstract protected function update();
 
     abstract protected function purgeInternal();
@@ -87,6 +120,17 @@ abstract class Cache
      */
     public function read()
     {
+        foreach ($this->tiers as $i => $tier) {
+            $contents = $tier->read();
+            if ($contents !== null) {
+                $this->cacheHit = true;
+                for ($j = 0; $j < $i; $j++) {
+                    $this->tiers[$j]->write($contents);
+                }
+                return $contents;
+            }
+        }
+
         $this->create();
         if (!$this->useCache) {
             return null;
@@ -97,6 +141,9 @@ abstract class Cache
             $this->cacheHit = true;
             $contents = $this->decompress($contents);
             $this->update();
+            foreach ($this->tiers as $tier) {
+                $tier->write($contents);
+            }
             return $contents;
         }
         return null;
@@ -108,12 +155,158 @@ abstract class Cache
      */
     public function write($data)
     {
+        if ($this->cacheHit) {
+            return;
+        }
+        foreach ($this->tiers as $tier) {
+            $tier->write($data);
+        }
         $this->create();
         $this->purge();
         if (!$this->cacheHit && $this->useCache) {
             $this->writeInternal($this->compress($data));
         }
     }
+
+    /**
+     * @brief Writes into the cache, replacing the entry if there is one
+     *
+     * write() does nothing once the entry has been read, since an entry
+     * normally only ever holds the same data. This is for entries which are
+     * built up over several requests.
+     * @param $data the data to write
+     */
+    public function overwrite($data)
+    {
+        foreach ($this->tiers as $tier) {
+            $tier->overwrite($data);
+        }
+        $this->create();
+        $this->purge();
+        if ($this->useCache) {
+            $this->replaceInternal($this->compress($data));
+        }
+    }
+
+    /**
+     * @brief Reads several entries from the cache at once
+     *
+     * This is for batches: the cache is set up and purged once for the whole
+     * batch, and drivers may fetch all the entries in one go. The entries
+     * need not include this cache object's own ID.
+     *
+     * @param $ids the IDs to read
+     * @returns a map of ID => cached string, of the IDs which were found
+     */
+    public function readMany($ids)
+    {
+        $found = array();
+        foreach ($this->tiers as $i => $tier) {
+            $ids = array_diff($ids, array_keys($found));
+            if (empty($ids)) {
+                return $found;
+            }
+            $hits = $tier->readMany($ids);
+            for ($j = 0; $j < $i && !empty($hits); $j++) {
+                $this->tiers[$j]->writeMany($hits);
+            }
+            $found += $hits;
+        }
+        $ids = array_diff($ids, array_keys($found));
+
+        $this->create();
+        if (!$this->useCache || empty($ids)) {
+            return $found;
+        }
+        $hits = array();
+        foreach ($this->readManyInternal($ids) as $id => $contents) {
+            $hits[$id] = $this->decompress($contents);
+        }
+        if (!empty($hits)) {
+            $this->updateMany(array_keys($hits));
+            foreach ($this->tiers as $tier) {
+                $tier->writeMany($hits);
+            }
+        }
+        return $found + $hits;
+    }
+
+    /**
+     * @brief Writes several entries into the cache at once
+     * @param $entries a map of ID => data to write
+     */
+    public function writeMany($entries)
+    {
+        foreach ($this->tiers as $tier) {
+            $tier->writeMany($entries);
+        }
+        $this->create();
+        if (!$this->useCache || empty($entries)) {
+            return;
+        }
+        $data = array();
+        foreach ($entries as $id => $d) {
+            $data[$id] = $this->compress($d);
+        }
+        $this->writeManyInternal($data);
+    }
+
+    /**
+     * @brief Changes the ID which the single entry methods work on
+     *
+     * Drivers which derive anything from the ID should override this.
+     */
+    protected function setId($id)
+    {
+        $this->id = $id;
+    }
+
+    /**
+     * @brief Reads several entries, returning a map of ID => raw contents
+     *
+     * By default this reads one entry at a time. Drivers which can do better
+     * should override it.
+     */
+    protected function readManyInternal($ids)
+    {
+        $found = array();
+        $current = $this->id;
+        foreach ($ids as $id) {
+            $this->setId($id);
+            $contents = $this->readInternal();
+            if ($contents !== false) {
+                $found[$id] = $contents;
+            }
+        }
+        $this->setId($current);
+        return $found;
+    }
+
+    /**
+     * @brief Records hits on several entries
+     */
+    protected function updateMany($ids)
+    {
+        $current = $this->id;
+        foreach ($ids as $id) {
+            $this->setId($id);
+            $this->update();
+        }
+        $this->setId($current);
+    }
+
+    /**
+     * @brief Writes several entries, given as a map of ID => raw contents
+     */
+    protected function writeManyInternal($entries)
+    {
+        $current = $this->id;
+        foreach ($entries as $id => $data) {
+            $this->setId($id);
+            $this->writeInternal($data);
+        }
+        $this->setId($current);
+    }
 }
 
 /** @endcond */
@@ -22,6 +22,13 @@ use Luminous as LuminousUi;
  *
  * This driver implements necessary functions for reading/writing the cache
  * and performing maintenance.
+ *
+ * A hit should cost as little I/O as possible, as the cache may well be on a
+ * network file system. Entries are written to a temporary file which is then
+ * renamed into place, so a reader never sees a partial entry and no locks are
+ * needed. A file's mtime is only used to purge it, so a hit only refreshes it
+ * once it is a tenth of the purge time old. Directories known to exist are
+ * remembered for the life of the process.
  */
 class FileSystemCache extends Cache
 {
@@ -47,16 +54,36 @@ class FileSystemCache extends Cache
      */
     private $filename = null;
 
+    /**
+     * Directories known to exist, as path => true
+     */
+    private static $dirs = array();
+
+    /**
+     * How often a process checks whether a purge is due, in seconds
+     */
+    const PURGE_CHECK_INTERVAL = 3600;
+
+    /**
+     * When this process last checked whether a purge is due
+     */
+    private static $purgeChecked = 0;
+
     public function __construct($id)
     {
         $this->dir = LuminousUi::root() . '/cache/';
-        $this->subdir = substr($id, 0, 2);
-        $this->filename = substr($id, 2);
+        parent::__construct($id);
+        $this->setId($id);
+    }
+
+    protected function setId($id)
+    {
+        parent::setId($id);
+        $this->subdir = (string)substr($id, 0, 2);
+        $this->filename = (string)substr($id, 2);
 
         $this->path = rtrim($this->dir, '/') . '/' .
         $this->subdir . '/' . $this->filename;
-
-        parent::__construct($id);
     }
 
     protected function logError($msg, $file = null)
@@ -77,18 +104,61 @@ class FileSystemCache extends Cache
         }
     }
 
-    protected function createInternal()
+    /**
+     * Creates a directory if it isn't known to exist
+     * @return whether the directory exists
+     */
+    private function ensureDir($dir)
     {
-        $target = $this->dir . '/' . $this->subdir;
-        if (!@mkdir($target, 0777, true) && !is_dir($target)) {
-            $this->logError("%s does not exist, and cannot create.", $target);
+        if (isset(self::$dirs[$dir])) {
+            return true;
+        }
+        if (!@mkdir($dir, 0777, true) && !is_dir($dir)) {
+            $this->logError("%s does not exist, and cannot create.", $dir);
             return false;
         }
+        self::$dirs[$dir] = true;
         return true;
     }
 
+    /**
+     * Writes a file atomically, by writing a temporary file beside it and
+     * renaming that over it
+     */
+    private function writeFile($path, $data)
+    {
+        $tmp = $path . '.' . uniqid('', true) . '.tmp';
+        if (@file_put_contents($tmp, $data) === false) {
+            // maybe the directory has been removed since
+            unset(self::$dirs[dirname($path)]);
+            $this->logError("Error writing to %s", $tmp);
+            return;
+        }
+        if (!@rename($tmp, $path)) {
+            @unlink($tmp);
+            $this->logError("Error renaming a temporary file to %s", $path);
+        }
+    }
+
+    protected function createInternal()
+    {
+        return $this->ensureDir(rtrim($this->dir, '/') . '/' . $this->subdir);
+    }
+
+    /**
+     * Only touches the file if it might otherwise be purged within 90% of the
+     * purge time, or not at all if purging is disabled. A stat is much
+     * cheaper than a write to the file's metadata, especially over NFS.
+     */
     protected function update()
     {
+        if ($this->timeout <= 0) {
+            return;
+        }
+        $mtime = @filemtime($this->path);
+        if ($mtime !== false && time() - $mtime < $this->timeout / 10) {
+            return;
+        }
         if (!(@touch($this->path))) {
             $this->logError("Failed to update (touch) %s", $this->path);
         }
@@ -96,20 +166,54 @@ class FileSystemCache extends Cache
 
     protected function readInternal()
     {
-        $contents = false;
-        if (file_exists($this->path)) {
-            $contents = @file_get_contents($this->path);
-            if ($contents === false) {
-                $this->logError('Failed to read %s"', $this->path);
-            }
+        $contents = @file_get_contents($this->path);
+        if ($contents === false && file_exists($this->path)) {
+            $this->logError('Failed to read %s"', $this->path);
         }
         return $contents;
     }
 
     protected function writeInternal($data)
     {
-        if (@file_put_contents($this->path, $data, LOCK_EX) === false) {
-            $this->logError("Error writing to %s", $this->path);
+        $this->writeFile($this->path, $data);
+    }
+
+    /**
+     * Reads each subdirectory's listing once, and only opens the files which
+     * exist
+     */
+    protected function readManyInternal($ids)
+    {
+        $bySubdir = array();
+        foreach ($ids as $id) {
+            $bySubdir[(string)substr($id, 0, 2)][(string)substr($id, 2)] = $id;
+        }
+        $found = array();
+        foreach ($bySubdir as $subdir => $files) {
+            $dir = rtrim($this->dir, '/') . '/' . $subdir;
+            $present = @scandir($dir);
+            if ($present === false) {
+                continue;
+            }
+            foreach (array_intersect_key($files, array_flip($present)) as $file => $id) {
+                $contents = @file_get_contents($dir . '/' . $file);
+                if ($contents === false) {
+                    $this->logError('Failed to read %s', $dir . '/' . $file);
+                } else {
+                    $found[$id] = $contents;
+                }
+            }
+        }
+        return $found;
+    }
+
+    protected function writeManyInternal($entries)
+    {
+        foreach ($entries as $id => $data) {
+            $dir = rtrim($this->dir, '/') . '/' . substr($id, 0, 2);
+            if ($this->ensureDir($dir)) {
+                $this->writeFile($dir . '/' . substr($id, 2), $data);
+            }
         }
     }
 
@@ -143,14 +247,25 @@ class FileSystemCache extends Cache
         }
     }
 
+    /**
+     * Purges at most once a day, and checks whether one is due at most once
+     * every PURGE_CHECK_INTERVAL seconds per process, so long-running
+     * processes still purge. Each purge rewrites the purge data file, so its
+     * mtime says whether it's worth opening and locking.
+     */
     protected function purgeInternal()
     {
-        if ($this->timeout <= 0) {
+        $now = time();
+        if ($this->timeout <= 0 || $now - self::$purgeChecked < self::PURGE_CHECK_INTERVAL) {
             return;
         }
+        self::$purgeChecked = $now;
         $purgeFile = $this->dir . '/.purgedata';
-        if (!file_exists($purgeFile)) {
+        $mtime = @filemtime($purgeFile);
+        if ($mtime === false) {
             @touch($purgeFile);
+        } elseif (time() - $mtime <= 60 * 60 * 24) {
+            return;
         }
         $last = 0;
         $fh = @fopen($purgeFile, 'r+');
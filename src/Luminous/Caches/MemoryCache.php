@@ -0,0 +1,99 @@
+<?php
+/** @cond ALL */
+
+namespace Luminous\Caches;
+
+/**
+ * In-process cache driver
+ * @brief Keeps recently used entries in memory for the life of the process
+ *
+ * The entries are shared by every instance, and evicted least recently used
+ * first once they add up to more than the size limit. This is a tier in front
+ * of another cache (see Cache::addTier()), so the same popular entries don't
+ * have to be read from disk or the database again and again.
+ */
+class MemoryCache extends Cache
+{
+    /**
+     * Entries as ID => data, least recently used first
+     */
+    private static $entries = array();
+
+    /**
+     * The total size of the entries, in bytes
+     */
+    private static $bytes = 0;
+
+    /**
+     * The size limit, in bytes
+     */
+    private $maxBytes;
+
+    /**
+     * @param $id the cache ID
+     * @param $maxBytes the size limit, in bytes. A single entry may take up to
+     *    a quarter of this.
+     */
+    public function __construct($id, $maxBytes)
+    {
+        parent::__construct($id);
+        $this->gz = false;
+        $this->maxBytes = $maxBytes;
+    }
+
+    /**
+     * @brief Empties the cache
+     */
+    public static function clear()
+    {
+        self::$entries = array();
+        self::$bytes = 0;
+    }
+
+    protected function createInternal()
+    {
+        return true;
+    }
+
+    protected function readInternal()
+    {
+        if (!isset(self::$entries[$this->id])) {
+            return false;
+        }
+        // move it to the most recently used end
+        $data = self::$entries[$this->id];
+        unset(self::$entries[$this->id]);
+        self::$entries[$this->id] = $data;
+        return $data;
+    }
+
+    protected function writeInternal($data)
+    {
+        $size = strlen($data);
+        if ($size > $this->maxBytes / 4) {
+            return;
+        }
+        if (isset(self::$entries[$this->id])) {
+            self::$bytes -= strlen(self::$entries[$this->id]);
+            unset(self::$entries[$this->id]);
+        }
+        self::$entries[$this->id] = $data;
+        self::$bytes += $size;
+        while (self::$bytes > $this->maxBytes) {
+            reset(self::$entries);
+            $oldest = key(self::$entries);
+            self::$bytes -= strlen(self::$entries[$oldest]);
+            unset(self::$entries[$oldest]);
+        }
+    }
+
+    protected function update()
+    {
+    }
+
+    protected function purgeInternal()
+    {
+    }
+}
+
+/** @endcond */
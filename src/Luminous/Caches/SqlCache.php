@@ -19,13 +19,17 @@ class SqlCache extends Cache
 {
     public static $tableName = 'luminous_cache';
     public static $queries = array(
-        // FIXME: INSERT IGNORE is MySQL specific.
+        // FIXME: INSERT IGNORE and REPLACE are MySQL specific.
         // we do need an ignore on duplicate because there's a race condition
         // between reading from the cache and then writing into it if the
         // read failed
         'insert' => 'INSERT IGNORE INTO `%s` (cache_id, output, insert_date, hit_date) VALUES("%s", "%s", %d, %d);',
+        'replace' => 'REPLACE INTO `%s` (cache_id, output, insert_date, hit_date) VALUES("%s", "%s", %d, %d);',
         'update' => 'UPDATE `%s` SET hit_date=%d WHERE cache_id="%s";',
         'select' => 'SELECT output FROM `%s` WHERE cache_id="%s";',
+        'select_many' => 'SELECT cache_id, output FROM `%s` WHERE cache_id IN (%s);',
+        'update_many' => 'UPDATE `%s` SET hit_date=%d WHERE cache_id IN (%s);',
+        'insert_many' => 'INSERT IGNORE INTO `%s` (cache_id, output, insert_date, hit_date) VALUES %s;',
         'purge' => 'DELETE FROM `%s` WHERE hit_date <= %d AND cache_id != "last_purge";',
         'get_purge_time' => 'SELECT hit_date FROM `%s` WHERE cache_id="last_purge" LIMIT 1;',
         'set_purge_time' => 'UPDATE `%s` SET hit_date = %d WHERE cache_id="last_purge";',
@@ -100,12 +104,25 @@ class SqlCache extends Cache
     }
 
     protected function writeInternal($data)
+    {
+        $this->insert('insert', $data);
+    }
+
+    protected function replaceInternal($data)
+    {
+        $this->insert('replace', $data);
+    }
+
+    /**
+     * Writes the entry with the 'insert' or 'replace' query
+     */
+    private function insert($query, $data)
     {
         $data = base64_encode($data);
         $time = time();
         // try {
             $this->query(sprintf(
-                self::$queries['insert'],
+                self::$queries[$query],
                 self::safetyCheck(self::$tableName),
                 self::safetyCheck($this->id),
                 self::safetyCheck($data),
@@ -116,6 +133,69 @@ class SqlCache extends Cache
         // }
     }
 
+    /**
+     * Quotes a list of IDs for an IN (...) clause
+     */
+    private static function idList($ids)
+    {
+        $quoted = array();
+        foreach ($ids as $id) {
+            $quoted[] = '"' . self::safetyCheck($id) . '"';
+        }
+        return implode(', ', $quoted);
+    }
+
+    protected function readManyInternal($ids)
+    {
+        $found = array();
+        try {
+            $ret = $this->query(sprintf(
+                self::$queries['select_many'],
+                self::safetyCheck(self::$tableName),
+                self::idList($ids)
+            ));
+            if (!empty($ret) && is_array($ret)) {
+                foreach ($ret as $row) {
+                    if (isset($row['cache_id']) && isset($row['output'])) {
+                        $found[$row['cache_id']] = base64_decode($row['output']);
+                    }
+                }
+            }
+        } catch (SqlSafetyException $e) {
+        }
+        return $found;
+    }
+
+    protected function updateMany($ids)
+    {
+        $this->query(sprintf(
+            self::$queries['update_many'],
+            self::safetyCheck(self::$tableName),
+            time(),
+            self::idList($ids)
+        ));
+    }
+
+    protected function writeManyInternal($entries)
+    {
+        $time = time();
+        $rows = array();
+        foreach ($entries as $id => $data) {
+            $rows[] = sprintf(
+                '("%s", "%s", %d, %d)',
+                self::safetyCheck($id),
+                self::safetyCheck(base64_encode($data)),
+                self::safetyCheck($time),
+                self::safetyCheck($time)
+            );
+        }
+        $this->query(sprintf(
+            self::$queries['insert_many'],
+            self::safetyCheck(self::$tableName),
+            implode(', ', $rows)
+        ));
+    }
+
     protected function purgeInternal()
     {
         if ($this->timeout <= 0) {
@@ -0,0 +1,110 @@
+<?php
+
+/** @cond ALL */
+
+namespace Luminous\Classifier;
+
+/**
+ * @brief Guesses the language of a source string from its tokens
+ *
+ * This is a naive Bayes classifier over token unigrams and bigrams. The
+ * source is split into tokens (identifiers and punctuation characters) with
+ * one regular expression, and each token and each pair of adjacent tokens is
+ * a feature. The model, NgramModel, holds the weight of each of a few
+ * thousand selected features for the languages it was seen in, so a source
+ * is scored against every language at once, in a single pass over its
+ * features. The cost doesn't depend on how many languages there are.
+ *
+ * The model is trained from the regression test sources by train.php.
+ */
+class NgramClassifier
+{
+    /**
+     * A token: an ASCII identifier or a single ASCII punctuation character
+     */
+    const PATTERN = '/[A-Za-z_][A-Za-z0-9_]*|[!-\/:-@\[-^`{-~]/';
+
+    /**
+     * The most times a feature is counted in one source, so that a large
+     * source's repetition doesn't swamp everything else
+     */
+    const CAP = 8;
+
+    /**
+     * The weights are stored as natural logarithms multiplied by this
+     */
+    const SCALE = 100;
+
+    /**
+     * @brief Counts the features of a source string
+     *
+     * @return a map of feature => count, where counts are at most CAP
+     */
+    public static function features($src)
+    {
+        preg_match_all(self::PATTERN, $src, $m);
+        $counts = array();
+        $prev = null;
+        foreach ($m[0] as $token) {
+            if (!isset($counts[$token])) {
+                $counts[$token] = 1;
+            } elseif ($counts[$token] < self::CAP) {
+                $counts[$token]++;
+            }
+            if ($prev !== null) {
+                $bigram = $prev . ' ' . $token;
+                if (!isset($counts[$bigram])) {
+                    $counts[$bigram] = 1;
+                } elseif ($counts[$bigram] < self::CAP) {
+                    $counts[$bigram]++;
+                }
+            }
+            $prev = $token;
+        }
+        return $counts;
+    }
+
+    /**
+     * @brief Classifies a source string
+     *
+     * @return a map of language code => probability, most probable first, for
+     *    every language in the model. If the source has none of the model's
+     *    features, the map is empty.
+     */
+    public static function classify($src)
+    {
+        $weights = NgramModel::$WEIGHTS;
+        $scores = array_fill(0, count(NgramModel::$LANGUAGES), 0);
+        $n = 0;
+        foreach (self::features($src) as $feature => $count) {
+            if (!isset($weights[$feature])) {
+                continue;
+            }
+            $n += $count;
+            foreach ($weights[$feature] as $lang => $weight) {
+                $scores[$lang] += $count * $weight;
+            }
+        }
+        if ($n === 0) {
+            return array();
+        }
+        // every feature has at least the language's default weight
+        foreach (NgramModel::$DEFAULTS as $lang => $default) {
+            $scores[$lang] += $n * $default;
+        }
+        $max = max($scores);
+        $total = 0.0;
+        foreach ($scores as $lang => $score) {
+            $scores[$lang] = exp(($score - $max) / self::SCALE);
+            $total += $scores[$lang];
+        }
+        $return = array();
+        foreach ($scores as $lang => $score) {
+            $return[NgramModel::$LANGUAGES[$lang]] = $score / $total;
+        }
+        arsort($return);
+        return $return;
+    }
+}
+
+/** @endcond */
@@ -0,0 +1,1516 @@
+<?php
+
+namespace Luminous\Classifier;
+
+/*
+ * Generated from tests/regression by train.php, do not edit.
+ */
+class NgramModel
+{
+    public static $LANGUAGES = array('actionscript', 'ada', 'bash', 'bnf', 'cpp', 'csharp', 'css', 'diff', 'django', 'erlang', 'go', 'groovy', 'haskell', 'html', 'java', 'javascript', 'json', 'latex', 'lolcode', 'matlab', 'perl', 'php', 'python', 'ruby', 'scala', 'scss', 'sql', 'vb', 'xml');
+
+    public static $DEFAULTS = array(-917, -764, -890, -797, -892, -881, -823, -887, -789, -850, -851, -789, -850, -858, -853, -939, -804, -757, -751, -739, -952, -929, -865, -932, -815, -789, -788, -736, -859);
+
+    public static $WEIGHTS = array(
+        '!' => array(0 => 289, 2 => 314, 3 => 256, 4 => 330, 5 => 337, 6 => 283, 7 => 330, 8 => 208, 10 => 271, 11 => 195, 12 => 271, 13 => 248, 14 => 220, 15 => 318, 16 => 220, 20 => 356, 21 => 366, 22 => 283, 23 => 350, 24 => 240, 25 => 208, 26 => 220, 28 => 240),
+        '! !' => array(3 => 110, 12 => 139, 15 => 283, 16 => 220, 26 => 139),
+        '! $' => array(20 => 322, 21 => 277, 23 => 69),
+        '! (' => array(0 => 161, 4 => 179, 5 => 110, 10 => 69, 12 => 179, 14 => 110, 15 => 277, 20 => 139, 21 => 179, 23 => 289),
+        '! -' => array(2 => 220, 3 => 220, 8 => 110, 13 => 220, 16 => 139, 20 => 195, 21 => 110, 23 => 139, 28 => 240),
+        '! =' => array(0 => 271, 2 => 230, 3 => 139, 4 => 294, 5 => 322, 10 => 271, 11 => 139, 13 => 69, 14 => 220, 15 => 314, 16 => 110, 20 => 139, 21 => 277, 22 => 220, 23 => 161, 24 => 179, 28 => 69),
+        '! important' => array(6 => 283, 13 => 139, 25 => 208, 28 => 139),
+        '"' => array(0 => 350, 1 => 220, 2 => 371, 3 => 350, 4 => 369, 5 => 343, 6 => 220, 7 => 389, 8 => 283, 9 => 322, 10 => 322, 11 => 337, 12 => 350, 13 => 283, 14 => 220, 15 => 309, 16 => 322, 18 => 283, 20 => 395, 21 => 404, 22 => 401, 23 => 439, 24 => 322, 25 => 220, 26 => 161, 27 => 220, 28 => 300),
+        '" !' => array(2 => 230, 15 => 195, 16 => 220, 20 => 69),
+        '" "' => array(0 => 256, 1 => 220, 2 => 294, 3 => 256, 4 => 110, 5 => 208, 7 => 240, 8 => 139, 9 => 256, 10 => 283, 12 => 195, 13 => 240, 14 => 220, 15 => 248, 16 => 195, 20 => 304, 21 => 318, 22 => 326, 23 => 340, 24 => 283, 25 => 69, 27 => 110, 28 => 240),
+        '" #' => array(2 => 289, 4 => 343, 10 => 69, 15 => 139, 16 => 139, 20 => 248, 22 => 69, 23 => 333),
+        '" $' => array(2 => 364, 4 => 69, 9 => 220, 11 => 139, 12 => 139, 14 => 69, 15 => 179, 20 => 371, 21 => 271, 23 => 220),
+        '" %' => array(2 => 110, 4 => 69, 7 => 110, 8 => 230, 10 => 240, 12 => 110, 16 => 220, 20 => 230, 21 => 161, 22 => 69, 23 => 139),
+        '" &' => array(1 => 161, 2 => 256, 10 => 110, 14 => 69, 15 => 220, 16 => 220, 20 => 69, 21 => 179, 23 => 110, 24 => 69),
+        '" \'' => array(0 => 69, 2 => 248, 3 => 230, 8 => 69, 9 => 195, 14 => 195, 15 => 240, 20 => 271, 21 => 69, 22 => 139, 23 => 220, 24 => 69),
+        '" )' => array(0 => 289, 1 => 220, 2 => 304, 4 => 337, 5 => 304, 7 => 271, 8 => 69, 9 => 283, 10 => 264, 11 => 179, 12 => 248, 13 => 220, 14 => 220, 15 => 256, 16 => 69, 18 => 69, 20 => 356, 21 => 343, 22 => 220, 23 => 326, 24 => 230, 28 => 220),
+        '" +' => array(0 => 318, 4 => 110, 5 => 161, 7 => 110, 9 => 283, 10 => 208, 11 => 69, 12 => 248, 13 => 161, 14 => 220, 15 => 230, 20 => 220, 22 => 69, 23 => 240, 24 => 240, 28 => 161),
+        '" ,' => array(0 => 230, 2 => 139, 3 => 139, 4 => 322, 5 => 289, 6 => 220, 7 => 256, 9 => 283, 10 => 283, 11 => 161, 12 => 322, 13 => 161, 14 => 220, 15 => 230, 16 => 322, 20 => 371, 21 => 350, 22 => 240, 23 => 333, 24 => 220, 25 => 110, 28 => 161),
+        '" -' => array(0 => 161, 2 => 353, 3 => 69, 9 => 220, 10 => 161, 11 => 69, 12 => 208, 14 => 220, 15 => 179, 16 => 248, 18 => 139, 20 => 271, 21 => 69, 22 => 69, 23 => 161),
+        '" .' => array(0 => 240, 2 => 208, 3 => 69, 4 => 161, 7 => 283, 9 => 139, 10 => 110, 11 => 69, 12 => 110, 13 => 179, 14 => 220, 15 => 230, 16 => 220, 20 => 358, 21 => 314, 22 => 220, 23 => 110, 24 => 69, 28 => 179),
+        '" /' => array(0 => 139, 1 => 139, 2 => 230, 4 => 139, 5 => 220, 8 => 110, 10 => 208, 11 => 139, 12 => 69, 13 => 240, 14 => 161, 15 => 179, 16 => 139, 20 => 179, 21 => 326, 23 => 300, 24 => 208, 28 => 240),
+        '" :' => array(0 => 220, 2 => 110, 3 => 110, 4 => 69, 5 => 110, 7 => 220, 10 => 220, 11 => 69, 12 => 179, 13 => 69, 14 => 220, 15 => 220, 16 => 322, 18 => 69, 20 => 294, 21 => 179, 22 => 110, 23 => 220, 24 => 69, 28 => 69),
+        '" ;' => array(0 => 230, 1 => 179, 2 => 300, 3 => 139, 4 => 220, 5 => 195, 7 => 161, 8 => 69, 9 => 195, 10 => 264, 12 => 69, 13 => 220, 14 => 139, 15 => 230, 20 => 364, 21 => 366, 23 => 195, 24 => 161, 25 => 110, 26 => 110, 28 => 220),
+        '" <' => array(0 => 220, 3 => 240, 4 => 110, 5 => 110, 9 => 110, 12 => 139, 14 => 161, 15 => 240, 16 => 220, 20 => 208, 21 => 366, 23 => 347, 28 => 69),
+        '" =' => array(2 => 314, 3 => 179, 9 => 110, 10 => 69, 12 => 208, 14 => 208, 15 => 220, 16 => 69, 20 => 283, 21 => 69, 23 => 195),
+        '" >' => array(0 => 220, 2 => 256, 3 => 110, 5 => 208, 8 => 220, 9 => 110, 10 => 139, 12 => 220, 13 => 283, 14 => 195, 15 => 248, 16 => 220, 20 => 179, 21 => 283, 23 => 366, 28 => 283),
+        '" Wikimedia' => array(13 => 220, 28 => 220),
+        '" \\' => array(0 => 240, 2 => 240, 4 => 220, 5 => 69, 9 => 220, 12 => 195, 14 => 220, 15 => 248, 16 => 240, 20 => 304, 21 => 304, 22 => 69, 23 => 283, 24 => 208),
+        '" ]' => array(0 => 220, 2 => 326, 3 => 110, 5 => 277, 7 => 256, 8 => 69, 9 => 179, 12 => 264, 14 => 195, 15 => 240, 16 => 110, 20 => 179, 21 => 110, 23 => 256),
+        '" alt' => array(13 => 220, 23 => 179, 28 => 220),
+        '" an' => array(13 => 69, 16 => 240, 28 => 69),
+        '" content' => array(13 => 220, 15 => 69, 16 => 179, 21 => 69, 23 => 208, 28 => 220),
+        '" core' => array(4 => 289),
+        '" dir' => array(2 => 69, 13 => 220, 28 => 220),
+        '" divOtherProjectsItem' => array(13 => 220, 28 => 220),
+        '" divTop10item' => array(13 => 220, 28 => 220),
+        '" else' => array(2 => 309, 12 => 161, 23 => 230),
+        '" end' => array(14 => 110, 23 => 322),
+        '" fi' => array(2 => 326, 13 => 161, 28 => 161),
+        '" height' => array(8 => 69, 10 => 69, 13 => 220, 15 => 179, 28 => 220),
+        '" href' => array(13 => 220, 15 => 161, 21 => 179, 23 => 240, 28 => 220),
+        '" http' => array(0 => 208, 2 => 208, 5 => 161, 10 => 179, 13 => 220, 16 => 220, 21 => 139, 23 => 248, 24 => 110, 28 => 220),
+        '" if' => array(2 => 277, 4 => 69, 7 => 110, 12 => 110, 14 => 69, 15 => 69, 20 => 322, 22 => 110, 23 => 264),
+        '" lang' => array(13 => 220, 23 => 110, 28 => 220),
+        '" margin' => array(13 => 240, 15 => 139, 21 => 69, 28 => 240),
+        '" name' => array(5 => 208, 10 => 69, 12 => 69, 13 => 256, 15 => 69, 20 => 69, 23 => 110, 28 => 256),
+        '" rtl' => array(13 => 220, 28 => 220),
+        '" style' => array(13 => 220, 15 => 110, 21 => 69, 23 => 195, 28 => 220),
+        '" text' => array(10 => 69, 13 => 277, 15 => 220, 21 => 220, 23 => 240, 24 => 69, 28 => 277),
+        '" title' => array(13 => 220, 21 => 69, 23 => 179, 28 => 220),
+        '" top' => array(13 => 220, 15 => 69, 23 => 69, 28 => 220),
+        '" var' => array(0 => 139, 10 => 208, 12 => 110, 16 => 220, 23 => 69),
+        '" width' => array(8 => 69, 10 => 69, 13 => 220, 15 => 208, 23 => 69, 28 => 220),
+        '" {' => array(5 => 139, 8 => 240, 10 => 139, 12 => 69, 14 => 208, 16 => 69, 21 => 110),
+        '" |' => array(2 => 300, 3 => 248, 5 => 69, 8 => 69, 10 => 139, 12 => 208, 15 => 220, 20 => 161, 21 => 110, 23 => 69),
+        '" }' => array(2 => 256, 8 => 139, 9 => 230, 10 => 69, 11 => 179, 13 => 69, 14 => 110, 15 => 220, 16 => 248, 20 => 277, 23 => 195, 24 => 208, 28 => 69),
+        '#' => array(0 => 240, 2 => 353, 4 => 387, 5 => 220, 6 => 289, 7 => 304, 8 => 161, 9 => 304, 10 => 110, 11 => 69, 12 => 110, 13 => 220, 14 => 161, 15 => 326, 16 => 230, 20 => 387, 21 => 277, 22 => 374, 23 => 413, 25 => 271, 26 => 161, 27 => 195, 28 => 220),
+        '# #' => array(2 => 264, 9 => 69, 20 => 350, 22 => 283, 23 => 340),
+        '# $' => array(20 => 309, 23 => 248),
+        '# -' => array(2 => 264, 12 => 69, 20 => 220, 22 => 230, 23 => 139),
+        '# .' => array(2 => 230, 7 => 110, 13 => 220, 14 => 161, 15 => 161, 23 => 139, 28 => 220),
+        '# This' => array(2 => 208, 20 => 277, 22 => 110, 23 => 277),
+        '# endif' => array(4 => 337, 5 => 220),
+        '# ifdef' => array(4 => 304),
+        '# include' => array(2 => 179, 4 => 371, 7 => 271),
+        '# {' => array(16 => 220, 20 => 139, 21 => 110, 23 => 369, 25 => 220),
+        '$' => array(0 => 69, 2 => 371, 4 => 195, 5 => 220, 7 => 110, 9 => 322, 10 => 69, 11 => 304, 12 => 322, 13 => 195, 14 => 110, 15 => 350, 17 => 271, 20 => 404, 21 => 414, 22 => 69, 23 => 340, 25 => 283, 28 => 195),
+        '$ "' => array(2 => 322, 4 => 69, 9 => 230, 12 => 69, 14 => 69, 15 => 161, 20 => 110, 21 => 110),
+        '$ &' => array(15 => 110, 17 => 220, 20 => 220, 23 => 179),
+        '$ (' => array(2 => 277, 9 => 69, 12 => 139, 13 => 195, 15 => 309, 21 => 220, 23 => 240, 28 => 195),
+        '$ /' => array(2 => 248, 11 => 69, 15 => 304, 20 => 300, 21 => 179, 23 => 326),
+        '$ _' => array(9 => 220, 15 => 69, 20 => 356),
+        '$ c' => array(9 => 69, 17 => 220, 21 => 240),
+        '$ i' => array(2 => 110, 20 => 264, 21 => 309),
+        '$ l' => array(21 => 294, 23 => 69),
+        '$ line' => array(20 => 283, 21 => 264),
+        '$ lines' => array(20 => 139, 21 => 283),
+        '$ matches' => array(20 => 161, 21 => 322),
+        '$ src' => array(21 => 309),
+        '$ str' => array(2 => 139, 20 => 195, 21 => 283),
+        '$ t' => array(17 => 110, 21 => 300),
+        '$ this' => array(15 => 139, 21 => 322),
+        '$ x' => array(2 => 179, 12 => 69, 20 => 139, 21 => 289),
+        '$ {' => array(2 => 322, 11 => 240, 15 => 69, 20 => 240),
+        '%' => array(0 => 294, 2 => 283, 3 => 179, 4 => 294, 5 => 69, 6 => 264, 7 => 220, 8 => 283, 9 => 322, 10 => 283, 12 => 161, 13 => 220, 14 => 220, 15 => 220, 16 => 230, 17 => 139, 19 => 248, 20 => 374, 21 => 318, 22 => 220, 23 => 385, 24 => 208, 25 => 110, 28 => 220),
+        '% %' => array(0 => 208, 3 => 69, 8 => 69, 9 => 322, 13 => 220, 20 => 69, 28 => 220),
+        '% ;' => array(6 => 230, 13 => 220, 21 => 139, 25 => 69, 28 => 220),
+        '% =' => array(0 => 69, 3 => 69, 9 => 110, 15 => 110, 21 => 110, 23 => 350),
+        '% >' => array(20 => 110, 23 => 350),
+        '% @' => array(9 => 283, 23 => 69),
+        '% D0' => array(13 => 220, 28 => 220),
+        '% if' => array(8 => 220, 23 => 195),
+        '% s' => array(0 => 179, 4 => 220, 7 => 110, 10 => 277, 20 => 300, 22 => 220, 24 => 195),
+        '% }' => array(8 => 277, 13 => 110, 19 => 139, 20 => 69, 28 => 110),
+        '&' => array(0 => 343, 1 => 220, 2 => 326, 3 => 179, 4 => 350, 5 => 264, 6 => 69, 7 => 337, 9 => 69, 10 => 289, 11 => 195, 12 => 220, 13 => 220, 14 => 220, 15 => 314, 16 => 220, 17 => 220, 20 => 369, 21 => 350, 22 => 69, 23 => 309, 24 => 110, 25 => 220, 26 => 220, 27 => 110, 28 => 220),
+        '& $' => array(2 => 110, 17 => 220, 20 => 283, 21 => 248),
+        '& &' => array(0 => 304, 2 => 322, 3 => 69, 4 => 283, 5 => 240, 7 => 240, 10 => 179, 11 => 139, 12 => 179, 14 => 220, 15 => 300, 17 => 139, 20 => 326, 21 => 283, 23 => 195),
+        '& nbsp' => array(13 => 220, 21 => 139, 28 => 220),
+        '\'' => array(0 => 304, 1 => 220, 2 => 350, 3 => 343, 4 => 371, 5 => 240, 6 => 220, 7 => 304, 8 => 283, 9 => 314, 10 => 240, 11 => 322, 12 => 309, 13 => 208, 14 => 220, 15 => 371, 16 => 240, 18 => 69, 19 => 220, 20 => 395, 21 => 404, 22 => 393, 23 => 429, 24 => 256, 25 => 220, 26 => 322, 27 => 195, 28 => 208),
+        '\' "' => array(0 => 69, 2 => 256, 3 => 264, 4 => 69, 7 => 110, 8 => 69, 9 => 230, 15 => 283, 16 => 161, 20 => 283, 21 => 195, 22 => 110, 23 => 318, 24 => 139),
+        '\' #' => array(0 => 110, 2 => 220, 10 => 69, 11 => 69, 15 => 256, 20 => 220, 21 => 110, 22 => 220, 23 => 256),
+        '\' $' => array(0 => 69, 2 => 248, 9 => 139, 14 => 69, 15 => 240, 20 => 289, 21 => 283, 22 => 69, 23 => 69),
+        '\' %' => array(0 => 230, 2 => 179, 3 => 110, 4 => 69, 8 => 195, 9 => 69, 14 => 220, 19 => 69, 20 => 161, 21 => 179, 22 => 220, 23 => 289),
+        '\' \'' => array(0 => 283, 2 => 230, 3 => 220, 4 => 208, 5 => 69, 8 => 256, 12 => 69, 14 => 220, 15 => 277, 16 => 208, 19 => 220, 20 => 358, 21 => 318, 22 => 340, 23 => 356, 25 => 161, 26 => 289),
+        '\' (' => array(0 => 161, 3 => 220, 9 => 110, 11 => 69, 14 => 69, 15 => 220, 20 => 230, 21 => 69, 23 => 220, 26 => 110),
+        '\' )' => array(0 => 271, 2 => 179, 3 => 220, 4 => 110, 6 => 220, 8 => 69, 9 => 220, 10 => 110, 11 => 240, 12 => 110, 14 => 220, 15 => 322, 16 => 208, 20 => 337, 21 => 358, 22 => 248, 23 => 364, 26 => 220),
+        '\' *' => array(0 => 256, 2 => 195, 3 => 208, 14 => 139, 15 => 220, 20 => 264, 21 => 161, 22 => 69, 23 => 220),
+        '\' +' => array(0 => 230, 3 => 179, 11 => 161, 14 => 139, 15 => 230, 19 => 69, 20 => 110, 22 => 248, 23 => 277, 24 => 69),
+        '\' ,' => array(0 => 283, 2 => 110, 3 => 248, 4 => 69, 7 => 240, 9 => 220, 11 => 271, 12 => 161, 13 => 110, 14 => 220, 15 => 318, 16 => 110, 20 => 361, 21 => 364, 22 => 333, 23 => 283, 25 => 139, 26 => 283, 28 => 110),
+        '\' -' => array(0 => 69, 2 => 277, 3 => 220, 11 => 69, 12 => 220, 14 => 161, 15 => 220, 16 => 69, 20 => 271, 22 => 277, 23 => 271, 28 => 69),
+        '\' .' => array(0 => 139, 2 => 139, 3 => 179, 4 => 110, 6 => 220, 9 => 69, 11 => 195, 12 => 220, 14 => 69, 15 => 208, 16 => 69, 20 => 326, 21 => 322, 22 => 264, 23 => 248, 25 => 69, 26 => 220),
+        '\' /' => array(0 => 230, 2 => 110, 3 => 110, 4 => 110, 11 => 161, 14 => 139, 15 => 230, 16 => 139, 20 => 264, 21 => 294, 23 => 230),
+        '\' :' => array(0 => 230, 2 => 69, 3 => 195, 7 => 195, 12 => 110, 14 => 220, 15 => 256, 20 => 139, 21 => 240, 22 => 366, 23 => 208, 24 => 69),
+        '\' ;' => array(0 => 230, 2 => 69, 3 => 240, 8 => 110, 9 => 110, 14 => 220, 15 => 230, 20 => 340, 21 => 353, 23 => 69, 24 => 69, 26 => 110),
+        '\' <' => array(0 => 230, 2 => 110, 3 => 264, 14 => 220, 15 => 220, 16 => 161, 20 => 220, 21 => 309, 22 => 110, 23 => 264),
+        '\' =' => array(0 => 69, 2 => 220, 3 => 161, 7 => 161, 10 => 69, 11 => 110, 14 => 220, 15 => 220, 16 => 139, 20 => 300, 21 => 300, 23 => 283),
+        '\' >' => array(0 => 240, 2 => 220, 3 => 161, 8 => 139, 14 => 220, 15 => 283, 16 => 220, 20 => 220, 21 => 350, 22 => 69, 23 => 240, 28 => 69),
+        '\' \\' => array(0 => 264, 2 => 220, 4 => 179, 11 => 69, 14 => 220, 15 => 220, 16 => 69, 20 => 248, 21 => 69, 22 => 230, 23 => 220, 24 => 139),
+        '\' ]' => array(0 => 256, 3 => 208, 8 => 69, 11 => 110, 14 => 139, 15 => 248, 20 => 220, 21 => 337, 22 => 277, 23 => 309),
+        '\' as' => array(8 => 161, 16 => 220, 20 => 69, 21 => 110),
+        '\' b' => array(0 => 110, 7 => 110, 11 => 161, 14 => 110, 15 => 139, 16 => 220, 19 => 69, 23 => 139),
+        '\' c' => array(0 => 110, 2 => 179, 8 => 110, 11 => 69, 14 => 220, 16 => 208, 19 => 69, 20 => 69, 21 => 161, 23 => 69, 24 => 110),
+        '\' id' => array(3 => 195, 9 => 161, 15 => 179, 16 => 208, 20 => 139, 21 => 139, 22 => 110, 23 => 208),
+        '\' s' => array(0 => 248, 2 => 289, 4 => 294, 5 => 195, 7 => 304, 8 => 69, 10 => 69, 12 => 69, 14 => 220, 15 => 230, 16 => 69, 20 => 318, 21 => 264, 22 => 248, 23 => 195, 24 => 69, 26 => 220),
+        '\' t' => array(0 => 240, 2 => 248, 4 => 294, 5 => 110, 9 => 110, 10 => 139, 12 => 161, 13 => 139, 14 => 220, 15 => 248, 16 => 69, 20 => 337, 21 => 283, 22 => 179, 23 => 289, 25 => 139, 26 => 230, 28 => 69),
+        '\' {' => array(0 => 110, 2 => 110, 3 => 230, 14 => 220, 15 => 69, 20 => 110, 21 => 110, 23 => 69),
+        '\' |' => array(0 => 161, 2 => 220, 3 => 289, 14 => 110, 15 => 220, 20 => 264, 21 => 110, 23 => 161),
+        '\' }' => array(0 => 69, 2 => 69, 3 => 230, 8 => 220, 11 => 139, 14 => 220, 15 => 220, 16 => 220, 20 => 337, 22 => 69, 23 => 277),
+        '(' => array(0 => 350, 1 => 220, 2 => 361, 3 => 240, 4 => 376, 5 => 350, 6 => 248, 7 => 389, 8 => 161, 9 => 283, 10 => 322, 11 => 322, 12 => 350, 13 => 220, 14 => 220, 15 => 350, 16 => 220, 17 => 220, 18 => 139, 20 => 387, 21 => 395, 22 => 403, 23 => 403, 24 => 289, 25 => 264, 26 => 283, 28 => 220),
+        '( !' => array(0 => 240, 4 => 283, 5 => 256, 7 => 283, 13 => 110, 14 => 220, 15 => 289, 20 => 322, 21 => 283, 23 => 69, 24 => 110, 28 => 110),
+        '( "' => array(0 => 304, 1 => 179, 2 => 110, 4 => 350, 5 => 318, 7 => 256, 8 => 69, 9 => 283, 10 => 289, 11 => 179, 12 => 208, 13 => 220, 14 => 220, 15 => 240, 18 => 110, 20 => 350, 21 => 361, 22 => 110, 23 => 304, 24 => 240, 28 => 220),
+        '( #' => array(9 => 179, 15 => 195, 20 => 161, 22 => 110, 23 => 294),
+        '( $' => array(2 => 195, 13 => 139, 15 => 179, 20 => 371, 21 => 383, 23 => 283, 25 => 161, 28 => 139),
+        '( \'' => array(0 => 271, 3 => 220, 4 => 69, 6 => 220, 8 => 69, 9 => 220, 10 => 110, 11 => 220, 14 => 220, 15 => 326, 16 => 110, 20 => 356, 21 => 364, 22 => 300, 23 => 347),
+        '( (' => array(0 => 304, 2 => 220, 4 => 264, 5 => 318, 7 => 195, 12 => 220, 14 => 220, 15 => 289, 20 => 322, 21 => 248, 22 => 69, 23 => 220, 24 => 139),
+        '( )' => array(0 => 350, 2 => 322, 4 => 376, 5 => 322, 7 => 381, 9 => 271, 10 => 322, 11 => 240, 12 => 161, 13 => 220, 14 => 220, 15 => 333, 16 => 110, 20 => 361, 21 => 358, 22 => 364, 23 => 309, 24 => 277, 26 => 283, 28 => 220),
+        '( ,' => array(0 => 240, 4 => 110, 5 => 110, 6 => 139, 7 => 161, 9 => 161, 10 => 208, 12 => 139, 14 => 179, 15 => 283, 20 => 248, 21 => 139, 22 => 220, 24 => 69, 26 => 240),
+        '( -' => array(0 => 277, 2 => 179, 4 => 230, 5 => 139, 7 => 240, 14 => 220, 15 => 248, 20 => 220, 23 => 69, 26 => 139),
+        '( .' => array(0 => 264, 2 => 179, 7 => 220, 11 => 69, 12 => 220, 14 => 139, 15 => 230, 20 => 220, 21 => 230, 23 => 230),
+        '( /' => array(0 => 248, 5 => 69, 6 => 69, 11 => 69, 13 => 110, 15 => 304, 20 => 289, 23 => 289, 28 => 110),
+        '( ?' => array(9 => 161, 13 => 69, 15 => 283, 20 => 256, 21 => 304, 23 => 220, 28 => 69),
+        '( @' => array(5 => 69, 15 => 220, 20 => 353, 23 => 195),
+        '( Context' => array(9 => 283, 10 => 69),
+        '( File' => array(1 => 220, 9 => 220),
+        '( Name' => array(9 => 277),
+        '( [' => array(0 => 264, 2 => 208, 7 => 110, 9 => 283, 10 => 208, 12 => 220, 13 => 69, 15 => 283, 20 => 230, 21 => 220, 22 => 264, 23 => 304, 28 => 69),
+        '( \\' => array(9 => 69, 12 => 256, 14 => 220, 15 => 283, 17 => 220, 20 => 289, 21 => 195, 23 => 230),
+        '( a' => array(4 => 179, 5 => 179, 7 => 220, 13 => 208, 14 => 220, 15 => 283, 16 => 161, 17 => 110, 20 => 110, 21 => 139, 22 => 161, 28 => 208),
+        '( b' => array(0 => 69, 2 => 69, 4 => 69, 10 => 220, 13 => 195, 14 => 220, 15 => 208, 22 => 110, 23 => 69, 24 => 110, 28 => 195),
+        '( c' => array(0 => 220, 2 => 69, 4 => 220, 5 => 139, 7 => 110, 9 => 69, 10 => 304, 12 => 69, 13 => 179, 14 => 220, 15 => 179, 22 => 139, 23 => 69, 24 => 69, 28 => 179),
+        '( data' => array(0 => 110, 4 => 161, 10 => 195, 15 => 283, 22 => 220, 24 => 110),
+        '( e' => array(2 => 208, 5 => 248, 7 => 161, 10 => 139, 14 => 110, 15 => 318, 23 => 110),
+        '( i' => array(0 => 294, 2 => 220, 4 => 230, 10 => 256, 12 => 110, 14 => 220, 15 => 289, 20 => 110, 22 => 248, 23 => 110, 24 => 220),
+        '( int' => array(0 => 230, 2 => 69, 4 => 230, 5 => 248, 10 => 69, 14 => 220, 21 => 139, 22 => 179),
+        '( item' => array(0 => 69, 5 => 277, 15 => 256, 22 => 69, 23 => 69),
+        '( n' => array(0 => 220, 2 => 110, 4 => 69, 5 => 248, 10 => 248, 12 => 110, 15 => 161, 22 => 69, 25 => 69),
+        '( new' => array(0 => 271, 4 => 230, 5 => 161, 11 => 69, 14 => 220, 15 => 195, 24 => 139, 26 => 69),
+        '( object' => array(0 => 69, 5 => 271, 15 => 264, 22 => 220),
+        '( req' => array(10 => 264),
+        '( s' => array(0 => 161, 4 => 161, 5 => 220, 10 => 283, 14 => 139, 15 => 230, 20 => 161, 22 => 240, 23 => 110),
+        '( self' => array(15 => 220, 22 => 283),
+        '( this' => array(0 => 110, 2 => 139, 4 => 69, 5 => 271, 13 => 69, 14 => 208, 15 => 314, 21 => 110, 23 => 139, 24 => 220, 28 => 69),
+        '( val' => array(5 => 69, 10 => 195, 15 => 283, 22 => 220, 23 => 69, 24 => 110),
+        '( var' => array(0 => 343, 5 => 220, 12 => 110, 15 => 283, 22 => 139),
+        '( void' => array(2 => 110, 4 => 289),
+        '( {' => array(0 => 69, 5 => 69, 8 => 69, 9 => 283, 15 => 283, 20 => 240, 23 => 139),
+        ')' => array(0 => 350, 1 => 220, 2 => 361, 3 => 240, 4 => 376, 5 => 350, 6 => 248, 7 => 389, 8 => 161, 9 => 283, 10 => 322, 11 => 322, 12 => 350, 13 => 220, 14 => 220, 15 => 353, 16 => 220, 17 => 220, 18 => 179, 20 => 387, 21 => 395, 22 => 403, 23 => 403, 24 => 289, 25 => 264, 26 => 283, 28 => 220),
+        ') !' => array(0 => 230, 4 => 69, 5 => 69, 6 => 230, 10 => 179, 13 => 69, 15 => 289, 20 => 69, 21 => 230, 23 => 110, 24 => 69, 25 => 69, 28 => 69),
+        ') "' => array(0 => 110, 2 => 240, 4 => 69, 5 => 161, 7 => 240, 9 => 220, 10 => 161, 12 => 110, 13 => 69, 14 => 220, 15 => 240, 16 => 220, 18 => 110, 20 => 271, 21 => 69, 22 => 110, 23 => 304, 24 => 110, 28 => 69),
+        ') #' => array(2 => 294, 4 => 110, 15 => 161, 20 => 248, 21 => 69, 22 => 300, 23 => 326),
+        ') $' => array(2 => 139, 12 => 195, 13 => 69, 15 => 271, 17 => 110, 20 => 208, 21 => 353, 23 => 289, 28 => 69),
+        ') &' => array(0 => 230, 2 => 220, 4 => 256, 5 => 69, 10 => 69, 12 => 110, 14 => 220, 15 => 289, 20 => 179, 21 => 271, 23 => 110),
+        ') \'' => array(0 => 208, 3 => 220, 4 => 69, 14 => 208, 15 => 230, 20 => 256, 21 => 69, 22 => 110, 23 => 220, 26 => 220),
+        ') (' => array(0 => 110, 2 => 110, 5 => 208, 10 => 240, 11 => 69, 12 => 314, 14 => 220, 15 => 294, 20 => 69, 21 => 220, 23 => 220, 24 => 208, 26 => 195),
+        ') )' => array(0 => 314, 1 => 195, 2 => 230, 4 => 366, 5 => 322, 7 => 330, 9 => 283, 10 => 283, 11 => 69, 12 => 289, 14 => 220, 15 => 314, 20 => 366, 21 => 356, 22 => 304, 23 => 304, 24 => 271, 26 => 208),
+        ') *' => array(0 => 304, 2 => 139, 4 => 208, 5 => 139, 7 => 110, 10 => 161, 11 => 69, 14 => 195, 15 => 277, 20 => 179, 21 => 277, 22 => 208, 23 => 110),
+        ') +' => array(0 => 309, 1 => 69, 2 => 161, 4 => 179, 5 => 139, 7 => 322, 9 => 230, 10 => 110, 11 => 69, 12 => 161, 13 => 110, 14 => 220, 15 => 283, 20 => 139, 21 => 161, 22 => 248, 23 => 256, 28 => 110),
+        ') ,' => array(0 => 264, 1 => 161, 2 => 110, 4 => 343, 5 => 271, 7 => 337, 9 => 283, 10 => 304, 11 => 69, 12 => 240, 13 => 110, 14 => 220, 15 => 294, 20 => 330, 21 => 314, 22 => 264, 23 => 294, 24 => 161, 26 => 283, 28 => 110),
+        ') -' => array(0 => 277, 1 => 139, 2 => 256, 4 => 220, 5 => 69, 7 => 294, 9 => 283, 10 => 230, 11 => 69, 12 => 248, 13 => 179, 14 => 110, 15 => 264, 20 => 314, 21 => 240, 22 => 179, 23 => 240, 26 => 69, 28 => 179),
+        ') .' => array(0 => 271, 2 => 230, 4 => 220, 5 => 294, 7 => 356, 8 => 110, 9 => 283, 10 => 256, 11 => 179, 12 => 195, 13 => 139, 14 => 220, 15 => 343, 20 => 330, 21 => 340, 22 => 220, 23 => 347, 24 => 230, 26 => 69, 28 => 139),
+        ') /' => array(0 => 304, 1 => 69, 2 => 110, 4 => 240, 5 => 195, 7 => 110, 10 => 208, 11 => 208, 14 => 220, 15 => 289, 20 => 294, 21 => 271, 22 => 139, 23 => 283, 24 => 195),
+        ') :' => array(0 => 347, 1 => 69, 2 => 69, 4 => 195, 5 => 220, 7 => 195, 10 => 69, 12 => 110, 13 => 69, 15 => 289, 18 => 69, 20 => 195, 21 => 139, 22 => 369, 23 => 110, 24 => 264, 25 => 69, 26 => 220, 28 => 69),
+        ') ;' => array(0 => 350, 1 => 220, 2 => 289, 3 => 69, 4 => 371, 5 => 350, 6 => 230, 7 => 350, 8 => 110, 9 => 283, 10 => 314, 11 => 179, 13 => 220, 14 => 220, 15 => 350, 16 => 110, 20 => 376, 21 => 376, 23 => 256, 24 => 139, 25 => 208, 26 => 277, 28 => 220),
+        ') <' => array(0 => 179, 2 => 139, 4 => 309, 5 => 139, 10 => 69, 12 => 256, 13 => 179, 14 => 139, 15 => 208, 20 => 110, 21 => 110, 22 => 161, 23 => 69, 28 => 179),
+        ') =' => array(0 => 256, 2 => 110, 4 => 264, 5 => 220, 10 => 264, 12 => 294, 13 => 69, 14 => 220, 15 => 283, 20 => 356, 21 => 195, 22 => 248, 23 => 161, 24 => 283, 28 => 69),
+        ') >' => array(0 => 309, 1 => 69, 2 => 179, 4 => 230, 5 => 69, 10 => 230, 11 => 69, 12 => 110, 13 => 110, 14 => 179, 15 => 271, 20 => 264, 21 => 220, 22 => 208, 23 => 179, 28 => 110),
+        ') ?' => array(0 => 230, 4 => 220, 5 => 208, 13 => 69, 14 => 220, 15 => 294, 20 => 277, 21 => 304, 23 => 283, 28 => 69),
+        ') @' => array(7 => 220, 15 => 110, 23 => 309),
+        ') \\' => array(10 => 69, 11 => 110, 15 => 283, 20 => 314, 21 => 230, 23 => 248, 24 => 69),
+        ') ]' => array(0 => 240, 2 => 69, 4 => 139, 5 => 179, 9 => 283, 12 => 240, 15 => 283, 20 => 139, 22 => 240, 23 => 220, 24 => 69),
+        ') def' => array(11 => 139, 22 => 271, 23 => 139, 24 => 220),
+        ') end' => array(0 => 69, 9 => 283, 23 => 343),
+        ') for' => array(0 => 139, 2 => 139, 4 => 110, 10 => 240, 15 => 220, 20 => 161, 22 => 277, 23 => 69),
+        ') if' => array(2 => 195, 4 => 110, 5 => 161, 10 => 294, 11 => 110, 14 => 195, 15 => 283, 20 => 343, 22 => 314, 23 => 240, 24 => 110),
+        ') is' => array(0 => 69, 1 => 179, 7 => 283, 15 => 69, 20 => 69, 22 => 69),
+        ') of' => array(9 => 283, 12 => 110, 21 => 69),
+        ') return' => array(0 => 208, 1 => 179, 2 => 110, 4 => 289, 5 => 240, 7 => 161, 10 => 230, 12 => 69, 13 => 161, 14 => 220, 15 => 220, 21 => 283, 22 => 264, 23 => 139, 28 => 161),
+        ') s' => array(0 => 220, 5 => 195, 10 => 240, 22 => 69),
+        ') val' => array(5 => 220, 10 => 69, 22 => 69, 24 => 220),
+        ') where' => array(5 => 110, 12 => 326, 23 => 69),
+        ') {' => array(0 => 350, 2 => 283, 4 => 376, 5 => 350, 7 => 271, 10 => 318, 11 => 256, 12 => 208, 13 => 220, 14 => 220, 15 => 343, 20 => 371, 21 => 378, 22 => 69, 23 => 220, 24 => 283, 25 => 139, 28 => 220),
+        ') |' => array(2 => 179, 4 => 230, 5 => 110, 7 => 110, 9 => 256, 11 => 110, 12 => 139, 14 => 179, 15 => 283, 20 => 277, 21 => 230, 23 => 230),
+        ') }' => array(2 => 69, 4 => 69, 9 => 277, 10 => 322, 11 => 195, 12 => 179, 13 => 179, 15 => 289, 17 => 220, 20 => 248, 23 => 289, 24 => 283, 28 => 179),
+        '*' => array(0 => 350, 2 => 371, 3 => 264, 4 => 385, 5 => 322, 6 => 314, 7 => 294, 8 => 161, 9 => 110, 10 => 322, 11 => 294, 12 => 240, 13 => 161, 14 => 220, 15 => 356, 16 => 161, 17 => 69, 20 => 358, 21 => 366, 22 => 300, 23 => 330, 24 => 322, 25 => 220, 26 => 240, 28 => 161),
+        '* $' => array(2 => 110, 11 => 195, 15 => 277, 20 => 248, 21 => 161, 23 => 264),
+        '* \'' => array(0 => 230, 2 => 161, 3 => 208, 12 => 220, 14 => 139, 15 => 248, 20 => 264, 21 => 179, 22 => 69, 23 => 139),
+        '* (' => array(0 => 271, 2 => 110, 4 => 161, 5 => 139, 6 => 69, 10 => 69, 14 => 69, 15 => 283, 20 => 240, 21 => 220, 23 => 195),
+        '* )' => array(0 => 139, 2 => 289, 3 => 110, 4 => 220, 7 => 161, 9 => 69, 11 => 69, 15 => 283, 20 => 264, 21 => 179, 23 => 230, 24 => 69),
+        '* *' => array(0 => 350, 2 => 161, 4 => 294, 5 => 179, 6 => 277, 10 => 139, 11 => 139, 14 => 220, 15 => 322, 20 => 240, 21 => 326, 22 => 240, 23 => 110, 24 => 208),
+        '* /' => array(0 => 350, 2 => 179, 4 => 304, 5 => 248, 6 => 271, 8 => 110, 10 => 69, 11 => 161, 12 => 69, 13 => 110, 14 => 220, 15 => 309, 16 => 110, 20 => 240, 21 => 318, 23 => 110, 24 => 256, 25 => 161, 26 => 179, 28 => 110),
+        '* <' => array(0 => 304, 13 => 69, 15 => 289, 16 => 69, 20 => 69, 21 => 220, 23 => 69, 28 => 69),
+        '* @' => array(0 => 330, 4 => 110, 11 => 69, 14 => 220, 21 => 110),
+        '* The' => array(0 => 248, 4 => 277, 6 => 69, 15 => 139, 21 => 195),
+        '* \\' => array(2 => 248, 11 => 69, 15 => 256, 20 => 220, 21 => 330, 23 => 230),
+        '+' => array(0 => 350, 1 => 69, 2 => 322, 3 => 256, 4 => 314, 5 => 340, 7 => 389, 8 => 110, 9 => 289, 10 => 309, 11 => 248, 12 => 294, 13 => 220, 14 => 220, 15 => 304, 16 => 195, 17 => 139, 19 => 69, 20 => 353, 21 => 358, 22 => 366, 23 => 350, 24 => 283, 26 => 69, 27 => 69, 28 => 220),
+        '+ "' => array(0 => 277, 2 => 110, 4 => 161, 5 => 69, 7 => 161, 9 => 271, 10 => 161, 11 => 69, 12 => 240, 13 => 195, 14 => 220, 15 => 220, 20 => 240, 22 => 139, 23 => 230, 24 => 230, 28 => 195),
+        '+ $' => array(2 => 139, 11 => 69, 15 => 240, 17 => 69, 20 => 300, 21 => 256, 23 => 110),
+        '+ &' => array(13 => 220, 28 => 220),
+        '+ \'' => array(0 => 230, 3 => 161, 11 => 179, 14 => 69, 15 => 248, 20 => 208, 21 => 69, 22 => 240, 23 => 277, 24 => 69),
+        '+ (' => array(0 => 304, 2 => 139, 4 => 208, 5 => 220, 7 => 161, 10 => 110, 12 => 179, 14 => 220, 15 => 283, 20 => 195, 21 => 110, 22 => 69, 23 => 208, 24 => 69),
+        '+ )' => array(0 => 350, 1 => 69, 2 => 230, 4 => 283, 5 => 289, 7 => 110, 9 => 69, 10 => 69, 12 => 139, 13 => 110, 14 => 220, 15 => 283, 20 => 256, 21 => 289, 23 => 248, 28 => 110),
+        '+ +' => array(0 => 343, 2 => 322, 3 => 110, 4 => 283, 5 => 300, 7 => 376, 9 => 283, 10 => 240, 11 => 69, 12 => 277, 14 => 220, 15 => 283, 20 => 330, 21 => 283, 24 => 139),
+        '+ ,' => array(0 => 69, 2 => 69, 4 => 220, 5 => 110, 7 => 330, 10 => 69, 14 => 139, 15 => 139, 16 => 161, 20 => 69, 21 => 139, 23 => 110),
+        '+ /' => array(0 => 195, 7 => 271, 13 => 110, 14 => 110, 15 => 220, 20 => 220, 21 => 179, 23 => 240, 28 => 110),
+        '+ ;' => array(0 => 300, 2 => 69, 4 => 208, 5 => 277, 7 => 161, 14 => 220, 15 => 240, 20 => 289, 21 => 240, 23 => 69),
+        '+ =' => array(0 => 300, 2 => 220, 3 => 69, 4 => 256, 5 => 294, 8 => 69, 10 => 195, 15 => 294, 20 => 195, 21 => 230, 22 => 330, 23 => 271, 24 => 277),
+        '+ [' => array(3 => 110, 7 => 283, 9 => 220, 20 => 110, 21 => 69, 23 => 110),
+        '+ ]' => array(0 => 110, 2 => 220, 4 => 264, 5 => 220, 14 => 220, 15 => 283, 20 => 110, 21 => 69, 22 => 195),
+        ',' => array(0 => 350, 1 => 220, 2 => 343, 3 => 300, 4 => 371, 5 => 350, 6 => 309, 7 => 389, 8 => 220, 9 => 283, 10 => 322, 11 => 309, 12 => 350, 13 => 220, 14 => 220, 15 => 371, 16 => 322, 17 => 230, 18 => 208, 19 => 69, 20 => 389, 21 => 378, 22 => 391, 23 => 408, 24 => 289, 25 => 256, 26 => 283, 28 => 230),
+        ', "' => array(0 => 240, 3 => 139, 4 => 256, 5 => 230, 6 => 208, 7 => 161, 9 => 283, 10 => 283, 11 => 139, 12 => 304, 13 => 139, 14 => 220, 15 => 230, 16 => 322, 20 => 366, 21 => 309, 22 => 240, 23 => 300, 24 => 220, 25 => 69, 28 => 139),
+        ', #' => array(2 => 248, 9 => 240, 13 => 69, 15 => 69, 20 => 300, 22 => 230, 23 => 294, 28 => 69),
+        ', $' => array(2 => 110, 9 => 161, 11 => 161, 15 => 208, 20 => 376, 21 => 350, 23 => 256, 25 => 139),
+        ', %' => array(4 => 69, 9 => 240, 10 => 220, 19 => 69, 20 => 161, 21 => 69, 23 => 110, 25 => 69),
+        ', \'' => array(0 => 289, 2 => 139, 3 => 248, 4 => 110, 7 => 240, 9 => 161, 11 => 240, 13 => 69, 14 => 220, 15 => 304, 16 => 69, 20 => 347, 21 => 358, 22 => 347, 23 => 322, 26 => 248, 28 => 69),
+        ', (' => array(0 => 230, 3 => 69, 4 => 240, 5 => 240, 12 => 139, 14 => 69, 15 => 208, 20 => 195, 21 => 110, 22 => 139, 23 => 69, 24 => 69, 26 => 220),
+        ', )' => array(0 => 220, 4 => 256, 5 => 220, 6 => 69, 7 => 220, 9 => 110, 10 => 230, 12 => 139, 14 => 220, 15 => 289, 20 => 361, 21 => 230, 22 => 283, 23 => 220, 24 => 69, 26 => 248),
+        ', *' => array(0 => 139, 4 => 264, 6 => 69, 15 => 248, 20 => 110, 21 => 220, 22 => 161),
+        ', +' => array(0 => 161, 7 => 337, 13 => 179, 15 => 69, 28 => 179),
+        ', ,' => array(0 => 322, 2 => 69, 4 => 277, 5 => 220, 6 => 179, 7 => 294, 9 => 220, 10 => 220, 13 => 110, 14 => 220, 15 => 195, 20 => 294, 21 => 179, 22 => 220, 23 => 264, 24 => 139, 26 => 220, 28 => 110),
+        ', -' => array(0 => 240, 1 => 69, 2 => 179, 4 => 110, 12 => 195, 14 => 139, 15 => 139, 20 => 230, 21 => 139, 22 => 161, 23 => 220, 25 => 220, 26 => 179),
+        ', .' => array(0 => 318, 4 => 69, 6 => 240, 7 => 283, 9 => 110, 10 => 110, 14 => 69, 20 => 230, 22 => 220, 23 => 69),
+        ', /' => array(0 => 139, 4 => 264, 5 => 256, 10 => 69, 14 => 220, 15 => 309, 20 => 110, 21 => 161, 23 => 69),
+        ', :' => array(0 => 69, 7 => 110, 15 => 110, 20 => 69, 23 => 340),
+        ', @' => array(7 => 314, 15 => 220, 20 => 294, 23 => 220),
+        ', Acc' => array(9 => 283),
+        ', Context' => array(9 => 283),
+        ', NULL' => array(4 => 240, 26 => 283),
+        ', [' => array(0 => 110, 7 => 283, 9 => 283, 10 => 69, 12 => 220, 14 => 220, 15 => 283, 20 => 264, 23 => 283),
+        ', \\' => array(9 => 69, 15 => 139, 16 => 69, 17 => 220, 20 => 256, 23 => 110, 24 => 69),
+        ', ]' => array(0 => 256, 4 => 69, 7 => 256, 14 => 69, 15 => 195, 22 => 139, 23 => 283),
+        ', _' => array(9 => 264, 10 => 264),
+        ', a' => array(0 => 110, 4 => 110, 5 => 110, 7 => 283, 12 => 161, 13 => 195, 14 => 161, 15 => 195, 20 => 139, 23 => 139, 28 => 195),
+        ', and' => array(0 => 161, 2 => 248, 4 => 230, 5 => 208, 7 => 283, 8 => 69, 9 => 110, 10 => 69, 12 => 110, 14 => 220, 15 => 289, 18 => 69, 20 => 277, 21 => 161, 23 => 69, 24 => 69),
+        ', b' => array(0 => 161, 4 => 69, 10 => 179, 13 => 139, 14 => 110, 15 => 277, 17 => 208, 22 => 139, 23 => 110, 28 => 139),
+        ', case' => array(9 => 271, 15 => 69),
+        ', e' => array(2 => 110, 5 => 179, 7 => 220, 10 => 240, 15 => 208, 20 => 69, 22 => 69),
+        ', err' => array(4 => 69, 10 => 264),
+        ', i' => array(0 => 240, 3 => 69, 4 => 69, 5 => 220, 7 => 256, 10 => 69, 14 => 139, 15 => 294, 21 => 69, 22 => 220, 23 => 179),
+        ', int' => array(0 => 161, 4 => 110, 5 => 240, 7 => 110, 14 => 220, 22 => 220),
+        ', null' => array(0 => 230, 5 => 277, 15 => 264, 16 => 69, 21 => 139),
+        ', or' => array(0 => 139, 1 => 69, 2 => 110, 4 => 179, 5 => 139, 6 => 110, 7 => 283, 12 => 139, 14 => 139, 15 => 208, 20 => 277, 21 => 195, 22 => 69, 23 => 69, 25 => 69),
+        ', this' => array(2 => 69, 4 => 195, 5 => 195, 7 => 271, 10 => 69, 15 => 300, 20 => 220, 21 => 161, 23 => 161, 25 => 69),
+        ', true' => array(0 => 69, 4 => 139, 5 => 139, 9 => 208, 10 => 220, 14 => 69, 15 => 289, 21 => 139, 23 => 161),
+        ', views' => array(13 => 220, 28 => 220),
+        ', {' => array(3 => 161, 4 => 220, 8 => 110, 9 => 283, 15 => 271, 16 => 69, 20 => 271, 23 => 110),
+        ', }' => array(4 => 69, 5 => 220, 9 => 69, 10 => 179, 14 => 69, 15 => 195, 16 => 139, 20 => 294, 21 => 69, 23 => 195),
+        '-' => array(0 => 350, 1 => 220, 2 => 371, 3 => 353, 4 => 371, 5 => 340, 6 => 322, 7 => 389, 8 => 248, 9 => 289, 10 => 322, 11 => 326, 12 => 350, 13 => 230, 14 => 220, 15 => 322, 16 => 277, 17 => 195, 18 => 248, 20 => 371, 21 => 401, 22 => 353, 23 => 417, 24 => 283, 25 => 283, 26 => 309, 27 => 69, 28 => 289),
+        '- #' => array(2 => 220, 9 => 69, 12 => 69, 13 => 220, 15 => 69, 16 => 110, 20 => 220, 21 => 69, 22 => 139, 23 => 240, 25 => 139, 28 => 220),
+        '- $' => array(2 => 304, 15 => 69, 20 => 220, 21 => 264),
+        '- %' => array(9 => 179, 10 => 110, 13 => 161, 20 => 110, 22 => 110, 23 => 283, 28 => 161),
+        '- \'' => array(0 => 110, 2 => 69, 3 => 195, 12 => 179, 14 => 220, 15 => 208, 16 => 110, 20 => 230, 22 => 161, 23 => 264),
+        '- )' => array(0 => 294, 1 => 69, 2 => 195, 4 => 264, 5 => 139, 7 => 195, 10 => 139, 12 => 69, 13 => 69, 14 => 220, 15 => 289, 20 => 179, 21 => 161, 22 => 69, 23 => 139, 24 => 139, 26 => 69, 28 => 69),
+        '- ,' => array(0 => 195, 2 => 69, 4 => 110, 5 => 69, 7 => 330, 13 => 220, 14 => 139, 15 => 195, 16 => 139, 20 => 69, 21 => 161, 22 => 69, 23 => 69, 25 => 195, 26 => 139, 28 => 220),
+        '- -' => array(0 => 322, 1 => 220, 2 => 347, 3 => 277, 4 => 220, 5 => 326, 7 => 350, 8 => 179, 9 => 230, 10 => 220, 11 => 264, 12 => 304, 13 => 220, 14 => 220, 15 => 283, 16 => 220, 18 => 195, 20 => 304, 21 => 264, 22 => 294, 23 => 304, 26 => 294, 28 => 256),
+        '- .' => array(0 => 256, 1 => 69, 2 => 248, 3 => 69, 5 => 69, 6 => 139, 7 => 283, 9 => 69, 11 => 220, 13 => 139, 14 => 110, 15 => 110, 21 => 69, 23 => 110, 27 => 69, 28 => 139),
+        '- ;' => array(0 => 330, 4 => 256, 5 => 230, 10 => 139, 14 => 220, 15 => 283, 20 => 110, 21 => 289, 24 => 69),
+        '- >' => array(3 => 161, 4 => 364, 5 => 69, 7 => 322, 8 => 139, 9 => 283, 11 => 240, 12 => 350, 13 => 220, 14 => 110, 15 => 110, 16 => 139, 20 => 371, 21 => 387, 22 => 139, 23 => 161, 25 => 220, 28 => 240),
+        '- Arab' => array(13 => 220, 28 => 220),
+        '- Latn' => array(13 => 220, 28 => 220),
+        '- The' => array(7 => 283, 12 => 220, 20 => 179, 26 => 208),
+        '- ]' => array(0 => 220, 2 => 220, 4 => 139, 5 => 139, 7 => 110, 10 => 110, 14 => 220, 15 => 283, 17 => 69, 20 => 161, 21 => 283, 22 => 139, 23 => 220),
+        '- align' => array(2 => 69, 6 => 220, 13 => 220, 21 => 139, 23 => 110, 25 => 161, 28 => 220),
+        '- color' => array(6 => 300, 8 => 69, 13 => 110, 15 => 139, 21 => 69, 25 => 139, 28 => 110),
+        '- d' => array(2 => 300, 4 => 179, 13 => 69, 20 => 139, 23 => 161, 28 => 69),
+        '- f' => array(2 => 294, 15 => 139, 20 => 69, 22 => 110, 23 => 230),
+        '- family' => array(6 => 240, 7 => 161, 13 => 69, 25 => 110, 28 => 69),
+        '- image' => array(6 => 230, 8 => 110, 13 => 69, 21 => 110, 22 => 69, 23 => 195, 28 => 69),
+        '- left' => array(6 => 271, 15 => 139, 21 => 195, 23 => 69, 25 => 230),
+        '- logo' => array(13 => 220, 23 => 69, 28 => 220),
+        '- n' => array(2 => 304, 15 => 69, 22 => 110),
+        '- right' => array(6 => 240, 21 => 139, 23 => 69, 25 => 69),
+        '- size' => array(4 => 139, 6 => 230, 13 => 179, 15 => 69, 25 => 139, 28 => 179),
+        '- space' => array(0 => 69, 6 => 179, 13 => 208, 23 => 69, 28 => 208),
+        '- style' => array(6 => 248, 7 => 283, 13 => 110, 14 => 110, 15 => 240, 16 => 220, 20 => 161, 23 => 139, 25 => 69, 28 => 110),
+        '- top' => array(6 => 161, 13 => 220, 15 => 110, 21 => 161, 25 => 139, 28 => 220),
+        '- weight' => array(6 => 300, 8 => 110, 13 => 110, 21 => 139, 25 => 139, 28 => 110),
+        '- width' => array(2 => 69, 6 => 240, 13 => 139, 15 => 139, 21 => 69, 23 => 69, 25 => 230, 28 => 139),
+        '- x' => array(2 => 256, 4 => 69, 6 => 69, 13 => 195, 15 => 69, 28 => 195),
+        '- x201_6' => array(13 => 220, 28 => 220),
+        '.' => array(0 => 350, 1 => 220, 2 => 371, 3 => 309, 4 => 383, 5 => 371, 6 => 322, 7 => 389, 8 => 277, 9 => 304, 10 => 322, 11 => 333, 12 => 350, 13 => 283, 14 => 220, 15 => 358, 16 => 264, 17 => 139, 18 => 208, 19 => 139, 20 => 391, 21 => 403, 22 => 389, 23 => 432, 24 => 309, 25 => 283, 26 => 304, 27 => 110, 28 => 283),
+        '. "' => array(0 => 220, 1 => 69, 2 => 294, 3 => 139, 7 => 283, 10 => 110, 12 => 110, 13 => 139, 14 => 220, 15 => 220, 16 => 110, 20 => 356, 21 => 314, 22 => 179, 23 => 179, 24 => 110, 28 => 139),
+        '. #' => array(2 => 283, 4 => 69, 15 => 69, 20 => 300, 21 => 69, 22 => 230, 23 => 333),
+        '. $' => array(2 => 220, 15 => 264, 20 => 322, 21 => 314),
+        '. %' => array(9 => 283, 10 => 69, 19 => 69),
+        '. \'' => array(0 => 179, 2 => 230, 3 => 179, 11 => 248, 12 => 69, 14 => 110, 15 => 208, 16 => 69, 20 => 294, 21 => 248, 22 => 230, 23 => 220, 25 => 69, 26 => 220),
+        '. (' => array(0 => 110, 2 => 220, 4 => 69, 7 => 220, 9 => 110, 10 => 256, 12 => 110, 14 => 69, 15 => 240, 20 => 220, 21 => 208, 23 => 110, 26 => 110),
+        '. )' => array(0 => 283, 1 => 69, 2 => 230, 4 => 69, 6 => 110, 7 => 283, 10 => 110, 12 => 220, 14 => 220, 15 => 248, 20 => 240, 21 => 179, 22 => 179, 23 => 195, 26 => 179),
+        '. *' => array(0 => 350, 2 => 318, 4 => 294, 5 => 139, 6 => 230, 11 => 248, 14 => 220, 15 => 333, 20 => 240, 21 => 330, 23 => 256, 24 => 110, 25 => 69),
+        '. ,' => array(0 => 283, 2 => 139, 4 => 110, 5 => 69, 7 => 283, 14 => 220, 15 => 139, 16 => 139, 20 => 230, 22 => 208, 23 => 220),
+        '. -' => array(0 => 161, 1 => 139, 2 => 264, 7 => 283, 9 => 248, 11 => 220, 12 => 240, 13 => 110, 14 => 110, 15 => 69, 16 => 69, 20 => 208, 22 => 110, 23 => 240, 26 => 179, 28 => 110),
+        '. .' => array(0 => 271, 1 => 161, 2 => 294, 3 => 110, 4 => 289, 5 => 208, 6 => 220, 7 => 283, 8 => 240, 9 => 179, 11 => 139, 12 => 220, 13 => 220, 14 => 220, 15 => 294, 17 => 69, 20 => 358, 21 => 283, 22 => 271, 23 => 256, 26 => 220, 27 => 69, 28 => 220),
+        '. /' => array(0 => 208, 2 => 240, 4 => 271, 5 => 322, 6 => 220, 7 => 220, 8 => 69, 10 => 110, 13 => 230, 14 => 161, 15 => 256, 16 => 161, 20 => 264, 21 => 220, 22 => 139, 23 => 264, 24 => 69, 25 => 110, 26 => 69, 28 => 230),
+        '. <' => array(0 => 110, 5 => 110, 8 => 220, 13 => 139, 14 => 69, 20 => 139, 21 => 110, 23 => 179, 28 => 139),
+        '. =' => array(10 => 69, 20 => 309, 21 => 343, 23 => 69),
+        '. Add' => array(0 => 69, 5 => 300, 21 => 69),
+        '. If' => array(0 => 69, 1 => 69, 4 => 179, 6 => 110, 12 => 161, 15 => 69, 20 => 283, 21 => 240, 22 => 69, 23 => 161, 25 => 69),
+        '. Max' => array(1 => 220, 5 => 220),
+        '. Printf' => array(10 => 277),
+        '. Text' => array(0 => 69, 5 => 289),
+        '. The' => array(0 => 220, 2 => 69, 4 => 161, 5 => 264, 7 => 283, 9 => 110, 12 => 220, 14 => 220, 20 => 283, 21 => 208, 23 => 139, 26 => 161),
+        '. This' => array(0 => 161, 2 => 110, 4 => 208, 7 => 283, 9 => 110, 14 => 161, 15 => 110, 20 => 208, 21 => 240, 22 => 110, 23 => 195),
+        '. Web' => array(5 => 283, 7 => 161),
+        '. [' => array(2 => 283, 7 => 283, 14 => 139, 15 => 161, 20 => 220, 21 => 69, 23 => 230),
+        '. append' => array(14 => 220, 15 => 277, 22 => 230, 24 => 179),
+        '. collect' => array(11 => 69, 23 => 300),
+        '. com' => array(0 => 139, 1 => 69, 2 => 230, 3 => 110, 4 => 139, 5 => 208, 6 => 69, 7 => 283, 8 => 110, 9 => 179, 10 => 139, 14 => 139, 15 => 277, 20 => 300, 21 => 69, 22 => 69, 23 => 240, 24 => 139, 25 => 69, 26 => 69),
+        '. css' => array(2 => 110, 13 => 139, 15 => 220, 20 => 69, 21 => 283, 23 => 110, 25 => 69, 28 => 139),
+        '. data' => array(0 => 248, 4 => 220, 7 => 161, 12 => 195, 15 => 300, 22 => 220),
+        '. divTop10item' => array(13 => 220, 28 => 220),
+        '. each' => array(11 => 195, 15 => 289, 21 => 69, 23 => 277),
+        '. em' => array(6 => 220, 13 => 220, 21 => 161, 25 => 139, 28 => 220),
+        '. f' => array(0 => 240, 2 => 139, 4 => 277, 20 => 69, 24 => 69),
+        '. h' => array(0 => 220, 2 => 179, 4 => 361, 7 => 304, 13 => 110, 14 => 69, 20 => 220, 28 => 110),
+        '. join' => array(0 => 110, 15 => 283, 20 => 69, 21 => 69, 22 => 195, 23 => 294),
+        '. length' => array(0 => 289, 14 => 220, 15 => 300, 23 => 230, 24 => 195),
+        '. luminous' => array(6 => 289, 25 => 69),
+        '. name' => array(0 => 220, 4 => 69, 8 => 139, 9 => 220, 15 => 264, 22 => 220, 23 => 220, 24 => 139),
+        '. new' => array(7 => 110, 23 => 318),
+        '. org' => array(0 => 208, 1 => 69, 2 => 220, 4 => 110, 5 => 69, 6 => 110, 7 => 283, 9 => 69, 11 => 110, 12 => 69, 13 => 220, 14 => 69, 15 => 248, 16 => 220, 20 => 264, 21 => 110, 22 => 110, 23 => 220, 25 => 69, 28 => 220),
+        '. php' => array(0 => 179, 2 => 161, 13 => 69, 15 => 139, 20 => 230, 21 => 289, 28 => 69),
+        '. png' => array(6 => 230, 7 => 195, 8 => 110, 10 => 69, 13 => 240, 21 => 110, 23 => 179, 28 => 240),
+        '. size' => array(4 => 195, 7 => 161, 11 => 110, 14 => 220, 23 => 256, 24 => 110),
+        '. split' => array(0 => 195, 15 => 248, 22 => 220, 23 => 264),
+        '. svg' => array(13 => 220, 28 => 220),
+        '. url' => array(11 => 195, 15 => 248, 22 => 220),
+        '. wikimedia' => array(13 => 220, 20 => 220, 28 => 220),
+        '. wikipedia' => array(2 => 69, 13 => 220, 20 => 220, 28 => 220),
+        '. {' => array(8 => 220, 9 => 69, 14 => 69, 21 => 110, 23 => 69, 24 => 139),
+        '/' => array(0 => 350, 1 => 220, 2 => 356, 3 => 220, 4 => 393, 5 => 371, 6 => 322, 7 => 389, 8 => 283, 9 => 283, 10 => 322, 11 => 322, 12 => 240, 13 => 283, 14 => 220, 15 => 369, 16 => 230, 17 => 161, 20 => 395, 21 => 404, 22 => 343, 23 => 425, 24 => 322, 25 => 240, 26 => 294, 27 => 161, 28 => 283),
+        '/ "' => array(0 => 139, 1 => 110, 2 => 240, 4 => 69, 5 => 139, 8 => 110, 10 => 195, 12 => 110, 13 => 220, 14 => 179, 15 => 179, 16 => 110, 20 => 161, 21 => 271, 23 => 195, 24 => 208, 28 => 220),
+        '/ #' => array(0 => 220, 2 => 179, 4 => 220, 5 => 69, 15 => 139, 20 => 179, 23 => 304, 26 => 69, 27 => 110),
+        '/ $' => array(2 => 271, 5 => 220, 11 => 139, 15 => 139, 17 => 69, 20 => 350, 21 => 277, 23 => 69),
+        '/ \'' => array(0 => 230, 2 => 264, 3 => 69, 11 => 139, 14 => 161, 15 => 230, 16 => 110, 20 => 240, 21 => 289, 23 => 179, 26 => 69),
+        '/ (' => array(0 => 220, 2 => 69, 4 => 161, 5 => 110, 10 => 110, 11 => 139, 15 => 294, 20 => 283, 21 => 277, 23 => 220),
+        '/ )' => array(0 => 240, 2 => 69, 4 => 179, 5 => 69, 10 => 139, 11 => 69, 13 => 110, 15 => 277, 20 => 314, 21 => 161, 23 => 283, 28 => 110),
+        '/ *' => array(0 => 350, 2 => 264, 4 => 304, 5 => 248, 6 => 271, 8 => 110, 10 => 69, 11 => 139, 12 => 69, 13 => 110, 14 => 220, 15 => 309, 16 => 110, 20 => 220, 21 => 314, 23 => 69, 24 => 264, 25 => 161, 26 => 179, 28 => 110),
+        '/ ,' => array(0 => 69, 9 => 248, 10 => 69, 14 => 220, 15 => 304, 20 => 304, 21 => 69, 23 => 283),
+        '/ .' => array(0 => 139, 2 => 294, 4 => 230, 6 => 110, 7 => 161, 8 => 69, 11 => 69, 13 => 161, 15 => 283, 20 => 179, 21 => 161, 22 => 110, 23 => 110, 24 => 110, 25 => 69, 26 => 69, 28 => 161),
+        '/ /' => array(0 => 350, 1 => 69, 2 => 304, 3 => 69, 4 => 347, 5 => 366, 6 => 208, 7 => 356, 8 => 161, 9 => 110, 10 => 322, 11 => 277, 12 => 69, 13 => 220, 14 => 220, 15 => 330, 16 => 220, 20 => 364, 21 => 381, 22 => 161, 23 => 322, 24 => 289, 25 => 220, 26 => 110, 27 => 110, 28 => 220),
+        '/ ;' => array(0 => 309, 4 => 69, 5 => 69, 14 => 139, 15 => 230, 16 => 69, 20 => 300, 23 => 161, 25 => 110, 26 => 161),
+        '/ <' => array(5 => 283, 13 => 220, 15 => 271, 16 => 69, 21 => 161, 23 => 220, 28 => 220),
+        '/ >' => array(0 => 161, 1 => 69, 2 => 69, 4 => 110, 5 => 220, 6 => 110, 8 => 110, 9 => 69, 12 => 69, 13 => 248, 15 => 271, 16 => 139, 20 => 110, 21 => 139, 22 => 69, 23 => 337, 24 => 69, 25 => 69, 28 => 248),
+        '/ Bookshelf' => array(13 => 220, 28 => 220),
+        '/ \\' => array(0 => 110, 2 => 277, 11 => 220, 15 => 294, 16 => 139, 20 => 309, 21 => 277, 23 => 283),
+        '/ ^' => array(2 => 179, 10 => 69, 11 => 69, 13 => 110, 15 => 304, 17 => 69, 20 => 314, 21 => 240, 23 => 304, 28 => 110),
+        '/ a' => array(2 => 220, 5 => 208, 8 => 161, 13 => 220, 14 => 69, 15 => 264, 20 => 110, 21 => 230, 23 => 304, 28 => 220),
+        '/ b' => array(0 => 179, 2 => 195, 13 => 220, 15 => 69, 17 => 110, 20 => 69, 23 => 139, 28 => 220),
+        '/ bd' => array(13 => 220, 28 => 220),
+        '/ bool' => array(13 => 220, 28 => 220),
+        '/ commons' => array(13 => 220, 28 => 220),
+        '/ div' => array(0 => 220, 6 => 139, 8 => 195, 13 => 220, 15 => 248, 16 => 220, 21 => 314, 23 => 264, 28 => 220),
+        '/ em' => array(13 => 220, 21 => 69, 28 => 220),
+        '/ enum' => array(13 => 220, 28 => 220),
+        '/ g' => array(2 => 264, 15 => 309, 20 => 283),
+        '/ hr' => array(13 => 220, 28 => 220),
+        '/ i' => array(0 => 69, 2 => 220, 15 => 289, 20 => 271, 21 => 161, 23 => 271, 25 => 69),
+        '/ if' => array(0 => 195, 4 => 289, 5 => 110, 10 => 220, 14 => 220, 15 => 264, 20 => 110, 21 => 230),
+        '/ li' => array(8 => 208, 13 => 69, 16 => 195, 21 => 139, 23 => 256, 28 => 69),
+        '/ meta' => array(5 => 69, 13 => 220, 20 => 220, 28 => 220),
+        '/ option' => array(13 => 220, 15 => 69, 28 => 220),
+        '/ private' => array(0 => 304, 5 => 69, 14 => 220, 15 => 69, 21 => 220),
+        '/ property' => array(13 => 220, 28 => 220),
+        '/ public' => array(0 => 283, 14 => 220, 21 => 220),
+        '/ px' => array(13 => 220, 28 => 220),
+        '/ small' => array(10 => 69, 13 => 220, 23 => 110, 28 => 220),
+        '/ span' => array(13 => 220, 15 => 139, 21 => 161, 23 => 110, 28 => 220),
+        '/ string' => array(13 => 220, 28 => 220),
+        '/ strong' => array(8 => 69, 13 => 220, 21 => 69, 23 => 161, 28 => 220),
+        '/ style' => array(8 => 69, 13 => 195, 16 => 69, 21 => 283, 23 => 69, 28 => 195),
+        '/ summary' => array(5 => 283),
+        '/ thumb' => array(13 => 220, 28 => 220),
+        '/ upload' => array(13 => 220, 28 => 220),
+        '/ widget' => array(13 => 220, 28 => 220),
+        '/ wiki' => array(2 => 220, 13 => 220, 20 => 110, 28 => 220),
+        '/ wikipedia' => array(13 => 220, 20 => 110, 28 => 220),
+        '/ www' => array(0 => 240, 1 => 69, 2 => 220, 3 => 69, 4 => 110, 5 => 110, 6 => 110, 7 => 110, 9 => 69, 12 => 69, 13 => 220, 14 => 110, 15 => 179, 16 => 220, 20 => 208, 21 => 110, 22 => 110, 23 => 208, 25 => 69, 26 => 69, 28 => 220),
+        ':' => array(0 => 350, 1 => 220, 2 => 343, 3 => 353, 4 => 374, 5 => 366, 6 => 322, 7 => 389, 8 => 264, 9 => 283, 10 => 322, 11 => 283, 12 => 350, 13 => 283, 14 => 220, 15 => 347, 16 => 322, 18 => 230, 20 => 376, 21 => 389, 22 => 404, 23 => 419, 24 => 283, 25 => 283, 26 => 240, 28 => 300),
+        ': "' => array(0 => 256, 1 => 161, 2 => 248, 4 => 161, 5 => 139, 6 => 69, 7 => 240, 8 => 179, 9 => 195, 10 => 220, 11 => 110, 12 => 264, 14 => 220, 15 => 240, 16 => 304, 18 => 161, 20 => 294, 21 => 264, 22 => 208, 23 => 220, 24 => 220, 25 => 110),
+        ': #' => array(2 => 179, 6 => 289, 13 => 110, 15 => 161, 16 => 69, 20 => 240, 22 => 264, 23 => 300, 25 => 110, 28 => 110),
+        ': $' => array(2 => 264, 4 => 69, 11 => 195, 15 => 230, 20 => 343, 21 => 248, 23 => 161, 25 => 256),
+        ': %' => array(4 => 230, 6 => 264, 9 => 69, 10 => 220, 13 => 220, 14 => 69, 20 => 110, 21 => 139, 22 => 220, 24 => 110, 25 => 69, 28 => 220),
+        ': \'' => array(0 => 230, 2 => 220, 3 => 220, 9 => 110, 11 => 139, 12 => 110, 13 => 69, 14 => 69, 15 => 220, 20 => 195, 21 => 161, 22 => 230, 23 => 248, 28 => 69),
+        ': (' => array(0 => 195, 5 => 69, 12 => 283, 14 => 110, 15 => 283, 18 => 69, 20 => 139, 21 => 110, 22 => 69, 23 => 195, 24 => 195),
+        ': ,' => array(0 => 220, 7 => 161, 10 => 220, 15 => 283, 16 => 179, 22 => 110),
+        ': -' => array(2 => 289, 7 => 161, 12 => 69, 13 => 195, 15 => 230, 16 => 69, 20 => 110, 21 => 110, 22 => 179, 23 => 69, 28 => 195),
+        ': .' => array(4 => 69, 5 => 110, 6 => 161, 7 => 240, 13 => 220, 15 => 220, 16 => 179, 20 => 110, 21 => 161, 22 => 69, 25 => 161, 26 => 110, 28 => 220),
+        ': /' => array(0 => 248, 1 => 69, 2 => 230, 3 => 69, 4 => 161, 5 => 240, 6 => 139, 7 => 271, 8 => 69, 9 => 110, 10 => 139, 11 => 110, 12 => 110, 13 => 240, 14 => 179, 15 => 300, 16 => 220, 20 => 330, 21 => 256, 22 => 110, 23 => 294, 24 => 139, 25 => 110, 26 => 110, 28 => 240),
+        ': :' => array(2 => 139, 3 => 314, 4 => 322, 5 => 283, 7 => 381, 10 => 110, 11 => 69, 12 => 326, 13 => 220, 15 => 69, 20 => 371, 21 => 240, 22 => 110, 23 => 343, 25 => 69, 28 => 220),
+        ': ;' => array(0 => 110, 4 => 220, 6 => 110, 13 => 220, 15 => 230, 20 => 161, 23 => 139, 25 => 220, 28 => 220),
+        ': =' => array(1 => 220, 2 => 220, 3 => 318, 10 => 322, 15 => 69, 20 => 179, 24 => 139),
+        ': Array' => array(0 => 350, 15 => 179, 24 => 195),
+        ': Int' => array(12 => 220, 24 => 220),
+        ': String' => array(0 => 230, 12 => 240, 14 => 69, 15 => 110, 24 => 283),
+        ': [' => array(2 => 139, 9 => 69, 10 => 69, 12 => 230, 14 => 69, 15 => 283, 16 => 179, 20 => 139, 21 => 110, 22 => 110, 23 => 179),
+        ': ]' => array(7 => 256, 10 => 230, 15 => 161, 22 => 248, 23 => 69),
+        ': auto' => array(6 => 248, 13 => 110, 15 => 69, 21 => 110, 25 => 110, 28 => 110),
+        ': bold' => array(6 => 277, 8 => 110, 13 => 110, 21 => 139, 25 => 161, 28 => 110),
+        ': center' => array(6 => 179, 13 => 220, 21 => 69, 25 => 110, 28 => 220),
+        ': em' => array(6 => 264, 13 => 220, 21 => 161, 25 => 230, 28 => 220),
+        ': get_value' => array(9 => 271),
+        ': hidden' => array(6 => 139, 13 => 220, 15 => 139, 23 => 69, 28 => 220),
+        ': if' => array(0 => 220, 5 => 139, 14 => 220, 15 => 139, 22 => 300),
+        ': int' => array(0 => 350),
+        ': none' => array(6 => 230, 13 => 161, 15 => 161, 23 => 110, 25 => 179, 28 => 161),
+        ': normal' => array(6 => 248, 13 => 110, 25 => 69, 28 => 110),
+        ': px' => array(6 => 289, 13 => 220, 15 => 220, 21 => 139, 23 => 179, 25 => 220, 28 => 220),
+        ': true' => array(0 => 69, 10 => 69, 15 => 283, 16 => 230),
+        ': url' => array(6 => 230, 8 => 110, 15 => 161, 21 => 110),
+        ': {' => array(4 => 208, 5 => 69, 8 => 139, 15 => 283, 16 => 248, 18 => 69, 21 => 139, 22 => 139, 25 => 69),
+        ';' => array(0 => 350, 1 => 220, 2 => 366, 3 => 283, 4 => 393, 5 => 371, 6 => 322, 7 => 389, 8 => 230, 9 => 304, 10 => 322, 11 => 195, 12 => 139, 13 => 220, 14 => 220, 15 => 371, 16 => 240, 20 => 404, 21 => 409, 22 => 195, 23 => 381, 24 => 283, 25 => 283, 26 => 304, 28 => 220),
+        '; "' => array(0 => 69, 2 => 69, 3 => 69, 4 => 110, 7 => 271, 9 => 195, 10 => 110, 13 => 220, 14 => 220, 15 => 110, 16 => 161, 20 => 264, 21 => 161, 23 => 277, 24 => 139, 28 => 220),
+        '; #' => array(2 => 208, 4 => 322, 5 => 220, 20 => 381, 21 => 69, 23 => 161, 25 => 139),
+        '; $' => array(2 => 110, 15 => 248, 20 => 383, 21 => 366, 25 => 110),
+        '; &' => array(13 => 220, 16 => 220, 20 => 69, 21 => 110, 25 => 179, 28 => 220),
+        '; \'' => array(0 => 69, 2 => 69, 3 => 220, 9 => 69, 15 => 208, 20 => 208, 21 => 208, 23 => 220),
+        '; *' => array(0 => 283, 2 => 277, 4 => 179, 6 => 230, 14 => 220, 15 => 139, 25 => 69),
+        '; +' => array(0 => 230, 7 => 343, 13 => 220, 14 => 220, 20 => 240, 21 => 110, 28 => 220),
+        '; -' => array(1 => 69, 2 => 240, 6 => 139, 7 => 240, 9 => 69, 14 => 139, 15 => 110, 23 => 69, 25 => 110, 26 => 248),
+        '; /' => array(0 => 343, 4 => 356, 5 => 353, 6 => 208, 7 => 110, 8 => 110, 10 => 220, 14 => 220, 15 => 304, 20 => 220, 21 => 330, 23 => 69, 24 => 139, 25 => 139, 26 => 179),
+        '; <' => array(1 => 69, 9 => 69, 13 => 220, 15 => 69, 21 => 69, 23 => 139, 28 => 220),
+        '; background' => array(6 => 256, 8 => 110, 13 => 110, 21 => 110, 25 => 110, 28 => 110),
+        '; border' => array(6 => 283, 13 => 69, 15 => 110, 21 => 139, 23 => 69, 25 => 195, 28 => 69),
+        '; break' => array(0 => 294, 4 => 220, 5 => 139, 10 => 69, 14 => 220, 15 => 283, 21 => 161),
+        '; case' => array(0 => 322, 5 => 139, 10 => 110, 14 => 220, 15 => 240, 21 => 69),
+        '; else' => array(0 => 240, 1 => 139, 4 => 161, 5 => 179, 13 => 139, 14 => 208, 15 => 230, 21 => 240, 23 => 69, 28 => 139),
+        '; end' => array(1 => 220, 14 => 220, 15 => 69, 23 => 110),
+        '; font' => array(6 => 322, 13 => 161, 25 => 179, 28 => 161),
+        '; for' => array(0 => 340, 1 => 69, 4 => 283, 5 => 179, 10 => 69, 14 => 220, 15 => 283, 20 => 161, 21 => 230),
+        '; foreach' => array(5 => 248, 20 => 304, 21 => 304),
+        '; function' => array(1 => 195, 13 => 161, 15 => 277, 21 => 110, 28 => 161),
+        '; i' => array(0 => 350, 2 => 220, 4 => 283, 5 => 240, 10 => 309, 14 => 220, 15 => 283, 24 => 110),
+        '; if' => array(0 => 343, 1 => 69, 2 => 69, 4 => 343, 5 => 330, 7 => 161, 10 => 110, 13 => 220, 14 => 220, 15 => 318, 20 => 366, 21 => 356, 22 => 69, 23 => 69, 24 => 69, 28 => 220),
+        '; int' => array(0 => 220, 2 => 69, 4 => 230, 5 => 256, 14 => 220),
+        '; j' => array(0 => 277, 2 => 139, 4 => 220, 14 => 220, 15 => 256),
+        '; left' => array(6 => 69, 13 => 220, 15 => 220, 25 => 69, 28 => 220),
+        '; margin' => array(0 => 69, 6 => 256, 13 => 220, 15 => 110, 21 => 139, 23 => 69, 25 => 208, 28 => 220),
+        '; my' => array(20 => 374),
+        '; overflow' => array(5 => 69, 6 => 139, 13 => 220, 25 => 69, 28 => 220),
+        '; padding' => array(6 => 283, 13 => 208, 15 => 110, 21 => 110, 23 => 69, 25 => 161, 28 => 208),
+        '; print' => array(20 => 337),
+        '; private' => array(0 => 294, 5 => 294, 14 => 220, 21 => 248),
+        '; return' => array(0 => 271, 1 => 161, 2 => 69, 4 => 300, 5 => 271, 7 => 110, 10 => 69, 12 => 69, 13 => 69, 14 => 220, 15 => 300, 20 => 353, 21 => 333, 23 => 69, 28 => 69),
+        '; text' => array(6 => 161, 13 => 220, 25 => 110, 28 => 220),
+        '; then' => array(2 => 333, 23 => 69),
+        '; use' => array(20 => 347),
+        '; using' => array(4 => 179, 5 => 322),
+        '; var' => array(0 => 350, 5 => 220, 8 => 69, 10 => 69, 13 => 179, 15 => 347, 21 => 139, 24 => 195, 28 => 179),
+        '; while' => array(0 => 240, 5 => 161, 14 => 220, 15 => 283, 20 => 271, 21 => 220, 24 => 179),
+        '; width' => array(6 => 139, 13 => 208, 15 => 110, 21 => 69, 25 => 110, 28 => 208),
+        '; }' => array(0 => 350, 2 => 161, 4 => 374, 5 => 353, 6 => 322, 7 => 240, 8 => 139, 10 => 230, 11 => 69, 14 => 220, 15 => 337, 20 => 371, 21 => 389, 25 => 283),
+        '<' => array(0 => 350, 1 => 161, 2 => 322, 3 => 343, 4 => 358, 5 => 340, 6 => 139, 7 => 283, 8 => 283, 9 => 283, 10 => 264, 11 => 208, 12 => 283, 13 => 300, 14 => 220, 15 => 353, 16 => 220, 20 => 383, 21 => 406, 22 => 283, 23 => 417, 24 => 283, 25 => 69, 28 => 314),
+        '< !' => array(3 => 110, 8 => 161, 13 => 248, 16 => 220, 20 => 195, 21 => 240, 23 => 179, 28 => 240),
+        '< $' => array(2 => 230, 9 => 139, 15 => 110, 20 => 240, 21 => 271, 23 => 139),
+        '< %' => array(20 => 110, 22 => 69, 23 => 350),
+        '< )' => array(0 => 322, 2 => 139, 4 => 220, 5 => 208, 13 => 69, 14 => 139, 15 => 195, 20 => 161, 21 => 69, 23 => 69, 28 => 69),
+        '< -' => array(4 => 110, 9 => 283, 12 => 283, 20 => 220, 23 => 208, 24 => 69),
+        '< /' => array(0 => 248, 2 => 161, 5 => 289, 8 => 283, 9 => 69, 10 => 195, 13 => 283, 14 => 110, 15 => 337, 16 => 220, 20 => 139, 21 => 383, 22 => 69, 23 => 369, 24 => 220, 28 => 283),
+        '< <' => array(0 => 300, 1 => 69, 2 => 309, 3 => 110, 4 => 314, 5 => 139, 9 => 179, 11 => 139, 14 => 220, 20 => 230, 21 => 220, 23 => 289),
+        '< =' => array(0 => 300, 2 => 69, 3 => 110, 4 => 230, 5 => 195, 14 => 220, 15 => 139, 20 => 195, 21 => 230, 22 => 69, 23 => 195),
+        '< ?' => array(0 => 110, 4 => 179, 5 => 110, 13 => 69, 15 => 110, 16 => 69, 20 => 110, 21 => 289, 22 => 69, 23 => 139, 28 => 69),
+        '< a' => array(5 => 161, 8 => 139, 13 => 220, 14 => 110, 15 => 264, 21 => 208, 23 => 304, 28 => 220),
+        '< bool' => array(13 => 220, 28 => 220),
+        '< br' => array(0 => 208, 13 => 220, 21 => 240, 23 => 230, 28 => 220),
+        '< div' => array(0 => 220, 8 => 195, 13 => 220, 15 => 256, 16 => 220, 21 => 314, 23 => 271, 28 => 220),
+        '< em' => array(13 => 220, 21 => 69, 28 => 220),
+        '< enum' => array(13 => 220, 28 => 220),
+        '< img' => array(8 => 69, 9 => 69, 13 => 220, 21 => 139, 23 => 179, 28 => 220),
+        '< li' => array(8 => 208, 16 => 195, 21 => 69, 23 => 248),
+        '< link' => array(13 => 195, 15 => 110, 21 => 208, 23 => 208, 28 => 195),
+        '< meta' => array(13 => 220, 16 => 139, 21 => 69, 23 => 208, 28 => 220),
+        '< opt' => array(3 => 240),
+        '< option' => array(13 => 220, 15 => 69, 28 => 220),
+        '< p' => array(0 => 139, 8 => 69, 15 => 69, 16 => 220, 21 => 110, 23 => 220),
+        '< property' => array(13 => 220, 28 => 220),
+        '< small' => array(13 => 220, 23 => 110, 28 => 220),
+        '< span' => array(13 => 220, 15 => 139, 21 => 179, 23 => 110, 28 => 220),
+        '< string' => array(2 => 110, 13 => 220, 28 => 220),
+        '< strong' => array(8 => 69, 13 => 220, 21 => 69, 23 => 161, 28 => 220),
+        '< summary' => array(5 => 283),
+        '< widget' => array(13 => 220, 28 => 220),
+        '=' => array(0 => 350, 1 => 220, 2 => 371, 3 => 366, 4 => 387, 5 => 350, 6 => 139, 7 => 389, 8 => 283, 9 => 283, 10 => 322, 11 => 350, 12 => 350, 13 => 283, 14 => 220, 15 => 371, 16 => 230, 17 => 220, 19 => 240, 20 => 399, 21 => 401, 22 => 393, 23 => 426, 24 => 322, 26 => 220, 27 => 110, 28 => 294),
+        '= "' => array(0 => 326, 1 => 179, 2 => 350, 3 => 195, 4 => 208, 5 => 304, 7 => 195, 8 => 256, 9 => 240, 10 => 283, 11 => 110, 12 => 289, 13 => 283, 14 => 220, 15 => 283, 20 => 361, 21 => 378, 22 => 264, 23 => 399, 24 => 230, 26 => 69, 28 => 294),
+        '= $' => array(2 => 347, 9 => 220, 15 => 208, 20 => 374, 21 => 364, 23 => 283),
+        '= %' => array(4 => 220, 7 => 161, 8 => 69, 9 => 69, 10 => 240, 20 => 195, 23 => 195, 24 => 110),
+        '= \'' => array(0 => 230, 2 => 294, 3 => 300, 7 => 195, 8 => 195, 9 => 110, 10 => 110, 11 => 139, 12 => 139, 14 => 220, 15 => 304, 16 => 220, 19 => 195, 20 => 356, 21 => 385, 22 => 350, 23 => 371, 24 => 161),
+        '= (' => array(0 => 330, 2 => 230, 4 => 256, 5 => 333, 11 => 69, 12 => 283, 13 => 110, 14 => 220, 15 => 294, 20 => 347, 21 => 256, 22 => 69, 23 => 220, 24 => 220, 28 => 110),
+        '= )' => array(0 => 347, 2 => 161, 4 => 256, 5 => 289, 7 => 110, 11 => 69, 12 => 110, 13 => 139, 14 => 220, 15 => 283, 20 => 309, 21 => 195, 22 => 139, 23 => 69, 24 => 195, 28 => 139),
+        '= -' => array(0 => 300, 2 => 179, 4 => 220, 5 => 110, 7 => 240, 14 => 220, 15 => 256, 16 => 69, 17 => 69, 20 => 139, 21 => 277, 23 => 161, 24 => 69),
+        '= /' => array(0 => 179, 2 => 256, 4 => 69, 9 => 69, 10 => 110, 11 => 161, 14 => 69, 15 => 289, 20 => 161, 23 => 220),
+        '= ;' => array(0 => 350, 2 => 240, 4 => 289, 5 => 322, 10 => 230, 14 => 220, 15 => 289, 20 => 353, 21 => 294, 24 => 195),
+        '= <' => array(0 => 110, 3 => 300, 4 => 139, 8 => 69, 9 => 139, 14 => 69, 15 => 179, 20 => 208, 21 => 240, 23 => 161, 24 => 179),
+        '= =' => array(0 => 340, 2 => 69, 3 => 230, 4 => 304, 5 => 309, 7 => 385, 8 => 69, 9 => 264, 10 => 314, 11 => 179, 12 => 289, 13 => 179, 14 => 220, 15 => 309, 20 => 314, 21 => 353, 22 => 340, 23 => 350, 28 => 179),
+        '= >' => array(0 => 110, 1 => 220, 5 => 220, 12 => 289, 16 => 220, 20 => 371, 21 => 330, 22 => 69, 23 => 333, 24 => 248),
+        '= @' => array(20 => 337, 23 => 343, 26 => 139),
+        '= [' => array(0 => 208, 3 => 69, 7 => 220, 9 => 256, 10 => 110, 11 => 161, 12 => 304, 15 => 283, 20 => 240, 22 => 294, 23 => 304),
+        '= \\' => array(2 => 161, 5 => 69, 10 => 69, 14 => 179, 15 => 161, 16 => 69, 17 => 161, 20 => 230, 21 => 230, 23 => 248),
+        '= `' => array(2 => 337, 10 => 195, 20 => 69),
+        '= a' => array(13 => 161, 14 => 220, 15 => 179, 17 => 220, 28 => 161),
+        '= array' => array(0 => 69, 15 => 179, 21 => 314, 24 => 69),
+        '= case' => array(2 => 69, 9 => 283, 12 => 220, 23 => 69),
+        '= do' => array(12 => 283, 20 => 69),
+        '= false' => array(0 => 300, 4 => 208, 5 => 220, 9 => 139, 10 => 69, 14 => 220, 15 => 289, 21 => 309, 23 => 179),
+        '= lists' => array(9 => 283),
+        '= new' => array(0 => 343, 1 => 69, 2 => 69, 4 => 195, 5 => 330, 10 => 110, 11 => 230, 13 => 69, 14 => 220, 15 => 271, 21 => 220, 24 => 283, 28 => 69),
+        '= nil' => array(10 => 294, 23 => 220),
+        '= null' => array(0 => 230, 5 => 318, 11 => 161, 12 => 69, 14 => 220, 15 => 283, 21 => 309),
+        '= s' => array(0 => 220, 4 => 69, 5 => 220, 10 => 179, 12 => 69, 15 => 220, 20 => 283, 22 => 69),
+        '= shift' => array(20 => 330),
+        '= true' => array(0 => 277, 2 => 69, 4 => 179, 5 => 220, 7 => 110, 9 => 110, 10 => 139, 14 => 220, 15 => 300, 16 => 110, 21 => 289, 23 => 220),
+        '= {' => array(3 => 220, 4 => 139, 5 => 139, 8 => 69, 9 => 69, 10 => 248, 11 => 179, 14 => 220, 15 => 289, 20 => 277, 22 => 179, 23 => 195, 24 => 289),
+        '= ~' => array(2 => 179, 4 => 220, 14 => 69, 20 => 376, 23 => 318),
+        '>' => array(0 => 350, 1 => 220, 2 => 326, 3 => 350, 4 => 376, 5 => 337, 6 => 110, 7 => 322, 8 => 283, 9 => 283, 10 => 277, 11 => 256, 12 => 350, 13 => 304, 14 => 220, 15 => 353, 16 => 220, 18 => 69, 20 => 376, 21 => 401, 22 => 277, 23 => 422, 24 => 309, 25 => 220, 28 => 318),
+        '> "' => array(0 => 220, 1 => 110, 2 => 271, 3 => 240, 5 => 110, 8 => 69, 9 => 195, 11 => 110, 12 => 179, 14 => 195, 15 => 240, 16 => 220, 20 => 322, 21 => 350, 23 => 369),
+        '> #' => array(2 => 139, 4 => 277, 5 => 179, 7 => 161, 9 => 139, 16 => 69, 20 => 161, 23 => 230),
+        '> $' => array(2 => 195, 15 => 69, 20 => 333, 21 => 347, 23 => 220),
+        '> &' => array(0 => 208, 2 => 240, 4 => 220, 5 => 69, 13 => 220, 15 => 139, 21 => 161, 23 => 69, 28 => 220),
+        '> \'' => array(0 => 240, 3 => 256, 8 => 69, 14 => 139, 15 => 230, 16 => 220, 20 => 358, 21 => 314, 22 => 139, 23 => 318, 28 => 69),
+        '> (' => array(1 => 161, 4 => 277, 5 => 220, 7 => 256, 12 => 256, 13 => 69, 15 => 161, 20 => 208, 21 => 110, 28 => 69),
+        '> )' => array(0 => 347, 2 => 110, 4 => 264, 5 => 179, 9 => 69, 12 => 69, 13 => 69, 14 => 220, 15 => 283, 20 => 304, 21 => 220, 23 => 208, 24 => 69, 28 => 69),
+        '> ,' => array(5 => 220, 9 => 110, 15 => 161, 20 => 300, 21 => 69, 23 => 230),
+        '> .' => array(1 => 110, 4 => 110, 5 => 220, 6 => 110, 8 => 208, 12 => 69, 14 => 161, 15 => 69, 20 => 256, 21 => 179, 22 => 110, 23 => 139, 25 => 69),
+        '> /' => array(0 => 139, 2 => 230, 4 => 69, 5 => 283, 8 => 69, 13 => 220, 15 => 256, 20 => 110, 21 => 240, 23 => 283, 28 => 220),
+        '> :' => array(3 => 314, 4 => 69, 5 => 208, 13 => 110, 18 => 69, 20 => 69, 22 => 179, 23 => 69, 28 => 110),
+        '> <' => array(0 => 195, 3 => 322, 8 => 283, 10 => 220, 11 => 69, 13 => 283, 15 => 322, 16 => 220, 20 => 220, 21 => 356, 23 => 374, 24 => 220, 28 => 300),
+        '> =' => array(0 => 289, 2 => 110, 3 => 110, 4 => 230, 5 => 179, 8 => 69, 9 => 139, 10 => 69, 11 => 69, 12 => 110, 13 => 110, 14 => 220, 15 => 271, 20 => 230, 21 => 220, 23 => 69, 24 => 110, 28 => 110),
+        '> >' => array(0 => 322, 1 => 69, 2 => 294, 3 => 110, 4 => 230, 5 => 220, 9 => 179, 12 => 283, 14 => 220, 20 => 110, 23 => 161),
+        '> IO' => array(12 => 277),
+        '> [' => array(5 => 69, 9 => 271, 12 => 264, 15 => 69, 20 => 264, 22 => 139, 23 => 277),
+        '> \\' => array(0 => 110, 15 => 69, 16 => 220, 20 => 289, 21 => 161, 22 => 69, 23 => 220),
+        '> case' => array(9 => 283),
+        '> return' => array(1 => 161, 12 => 240),
+        '> true' => array(9 => 161, 13 => 208, 28 => 208),
+        '> {' => array(5 => 220, 8 => 248, 9 => 283, 10 => 240, 20 => 304, 21 => 161, 23 => 220),
+        '> |' => array(0 => 69, 3 => 289, 15 => 139, 20 => 161, 23 => 161),
+        '?' => array(0 => 256, 2 => 314, 3 => 220, 4 => 283, 5 => 283, 6 => 69, 7 => 283, 9 => 256, 10 => 161, 11 => 69, 13 => 179, 14 => 220, 15 => 294, 16 => 110, 17 => 161, 18 => 230, 20 => 350, 21 => 389, 22 => 161, 23 => 376, 24 => 110, 26 => 230, 28 => 179),
+        '? (' => array(0 => 161, 2 => 69, 4 => 139, 15 => 283, 20 => 69, 21 => 69, 23 => 300),
+        '? )' => array(2 => 208, 5 => 220, 14 => 69, 15 => 248, 20 => 139, 21 => 248, 23 => 240),
+        '? :' => array(4 => 208, 7 => 110, 13 => 69, 14 => 110, 15 => 283, 20 => 256, 21 => 248, 23 => 230, 28 => 69),
+        '? >' => array(5 => 220, 13 => 69, 15 => 69, 16 => 69, 20 => 110, 21 => 264, 22 => 69, 23 => 161, 28 => 69),
+        '@' => array(0 => 337, 1 => 69, 2 => 322, 4 => 161, 5 => 161, 6 => 220, 7 => 389, 9 => 283, 10 => 69, 11 => 230, 12 => 69, 13 => 139, 14 => 220, 15 => 230, 16 => 110, 20 => 374, 21 => 179, 22 => 240, 23 => 401, 24 => 69, 25 => 271, 26 => 220, 28 => 139),
+        '@ -' => array(7 => 322, 22 => 110, 23 => 110),
+        '@ @' => array(7 => 371, 15 => 139, 26 => 139),
+        '@ _' => array(20 => 337),
+        '@ doc' => array(9 => 277),
+        '@ include' => array(25 => 230),
+        'A' => array(0 => 248, 1 => 69, 2 => 230, 3 => 139, 4 => 208, 5 => 179, 6 => 110, 7 => 283, 9 => 179, 11 => 161, 12 => 179, 13 => 179, 14 => 220, 15 => 271, 18 => 289, 19 => 139, 20 => 309, 21 => 264, 22 => 110, 23 => 271, 25 => 69, 26 => 220, 28 => 179),
+        'AN' => array(9 => 69, 18 => 283, 24 => 69),
+        'Acc' => array(9 => 283),
+        'Acc ]' => array(9 => 277),
+        'Ada' => array(1 => 220, 20 => 220),
+        'Add' => array(0 => 240, 2 => 110, 3 => 208, 5 => 300, 13 => 69, 14 => 110, 15 => 230, 21 => 69, 22 => 220, 28 => 69),
+        'Add (' => array(0 => 69, 5 => 300),
+        'Arab' => array(13 => 220, 28 => 220),
+        'Array' => array(0 => 350, 5 => 69, 14 => 69, 15 => 283, 20 => 220, 23 => 69, 24 => 220),
+        'Array (' => array(0 => 322, 15 => 110),
+        'Array =' => array(0 => 343),
+        'B' => array(0 => 300, 2 => 208, 3 => 69, 7 => 161, 9 => 161, 11 => 110, 13 => 69, 14 => 69, 19 => 139, 20 => 256, 23 => 69, 26 => 139, 28 => 69),
+        'Bookshelf' => array(13 => 220, 28 => 220),
+        'Bookshelf -' => array(13 => 220, 28 => 220),
+        'C' => array(0 => 271, 2 => 314, 3 => 69, 4 => 110, 5 => 69, 7 => 283, 9 => 283, 10 => 220, 11 => 110, 13 => 110, 14 => 220, 20 => 300, 21 => 161, 22 => 110, 23 => 240, 26 => 69, 28 => 110),
+        'C +' => array(2 => 271, 7 => 283, 20 => 220, 21 => 69),
+        'COUNTER' => array(18 => 248),
+        'Close' => array(1 => 179, 5 => 69, 10 => 230, 26 => 69),
+        'Close (' => array(1 => 179, 10 => 230),
+        'Commons' => array(7 => 110, 13 => 220, 20 => 69, 28 => 220),
+        'Context' => array(9 => 283, 10 => 220, 12 => 69),
+        'Context )' => array(9 => 283, 10 => 220),
+        'D0' => array(2 => 110, 13 => 220, 28 => 220),
+        'D0 %' => array(13 => 220, 28 => 220),
+        'Data' => array(0 => 139, 2 => 69, 5 => 69, 7 => 110, 9 => 161, 12 => 277, 20 => 220),
+        'Data .' => array(12 => 277),
+        'E' => array(0 => 110, 2 => 69, 3 => 69, 9 => 264, 11 => 110, 13 => 69, 16 => 139, 20 => 240, 23 => 195, 28 => 69),
+        'Error' => array(0 => 248, 2 => 69, 4 => 220, 5 => 195, 9 => 179, 10 => 179, 12 => 139, 14 => 220, 15 => 139, 20 => 256, 22 => 69, 23 => 139, 24 => 69),
+        'F' => array(0 => 256, 2 => 220, 3 => 69, 8 => 110, 9 => 220, 11 => 110, 13 => 161, 14 => 220, 15 => 161, 20 => 69, 23 => 69, 26 => 110, 28 => 161),
+        'False' => array(7 => 195, 12 => 220, 22 => 294, 26 => 69),
+        'File' => array(0 => 69, 1 => 220, 7 => 283, 9 => 220, 11 => 69, 20 => 230, 23 => 248, 24 => 110),
+        'File ,' => array(1 => 195, 9 => 220, 24 => 110),
+        'For' => array(2 => 195, 4 => 139, 5 => 69, 7 => 256, 10 => 69, 12 => 139, 14 => 69, 15 => 161, 20 => 277, 21 => 69, 24 => 69, 26 => 230),
+        'Free' => array(1 => 139, 4 => 195, 6 => 110, 7 => 110, 12 => 69, 13 => 195, 20 => 110, 21 => 110, 22 => 139, 23 => 139, 25 => 69, 26 => 208, 28 => 195),
+        'From' => array(1 => 195, 7 => 220, 14 => 69, 15 => 139, 26 => 220),
+        'GNU' => array(1 => 161, 2 => 161, 4 => 256, 6 => 195, 12 => 139, 13 => 69, 15 => 69, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139, 28 => 69),
+        'GNU General' => array(1 => 139, 4 => 248, 6 => 195, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139),
+        'General' => array(1 => 139, 4 => 264, 6 => 195, 7 => 195, 12 => 139, 15 => 69, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139),
+        'General Public' => array(1 => 139, 4 => 256, 6 => 195, 12 => 139, 15 => 69, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139),
+        'HAS' => array(3 => 161, 18 => 283),
+        'HAS A' => array(3 => 110, 18 => 283),
+        'HTML' => array(0 => 110, 2 => 161, 8 => 69, 15 => 271, 16 => 220, 20 => 230, 21 => 230, 23 => 230),
+        'I' => array(0 => 240, 1 => 139, 2 => 277, 3 => 139, 4 => 195, 11 => 110, 13 => 69, 14 => 110, 15 => 69, 16 => 69, 18 => 300, 20 => 289, 21 => 230, 22 => 161, 23 => 240, 26 => 220, 27 => 69, 28 => 69),
+        'I HAS' => array(3 => 110, 18 => 283),
+        'IO' => array(0 => 69, 5 => 69, 12 => 277),
+        'ITZ' => array(3 => 69, 18 => 277),
+        'If' => array(0 => 240, 1 => 69, 2 => 220, 4 => 271, 6 => 110, 12 => 220, 15 => 220, 20 => 300, 21 => 264, 22 => 69, 23 => 240, 25 => 110, 26 => 110),
+        'Int' => array(12 => 220, 24 => 230),
+        'It' => array(0 => 110, 2 => 195, 5 => 69, 7 => 283, 8 => 69, 12 => 110, 14 => 69, 15 => 69, 19 => 69, 20 => 220, 21 => 139, 26 => 220),
+        'Item' => array(1 => 139, 10 => 179, 24 => 220),
+        'Item (' => array(10 => 179, 24 => 220),
+        'Java' => array(7 => 283, 14 => 220, 20 => 220, 21 => 69),
+        'L' => array(0 => 161, 2 => 240, 3 => 69, 5 => 69, 9 => 264, 11 => 69, 13 => 179, 14 => 220, 20 => 179, 24 => 69, 26 => 220, 28 => 179),
+        'Latn' => array(13 => 220, 28 => 220),
+        'Latn "' => array(13 => 220, 28 => 220),
+        'License' => array(0 => 283, 1 => 179, 4 => 283, 5 => 110, 6 => 220, 7 => 161, 9 => 220, 12 => 161, 13 => 69, 15 => 179, 20 => 161, 21 => 220, 22 => 220, 23 => 195, 25 => 161, 28 => 69),
+        'Luminous' => array(2 => 69, 6 => 220, 21 => 283, 25 => 161),
+        'M' => array(0 => 195, 3 => 69, 7 => 161, 8 => 69, 9 => 240, 11 => 69, 13 => 139, 23 => 69, 26 => 220, 28 => 139),
+        'Map' => array(12 => 283, 14 => 69, 15 => 110),
+        'Map .' => array(12 => 264),
+        'Max' => array(1 => 220, 4 => 69, 5 => 240, 14 => 69),
+        'NOT' => array(3 => 69, 5 => 208, 7 => 161, 9 => 139, 14 => 69, 15 => 110, 20 => 195, 21 => 110, 23 => 110, 26 => 271),
+        'NULL' => array(4 => 309, 9 => 110, 20 => 161, 21 => 69, 26 => 283),
+        'NULL )' => array(4 => 277, 26 => 220),
+        'NULL ,' => array(4 => 220, 21 => 69, 26 => 283),
+        'Name' => array(0 => 179, 1 => 179, 2 => 69, 3 => 69, 5 => 110, 7 => 161, 9 => 283, 10 => 110, 12 => 161, 14 => 69, 20 => 208, 24 => 69, 26 => 179),
+        'Node' => array(10 => 220, 12 => 220, 15 => 69, 24 => 69),
+        'None' => array(6 => 69, 15 => 110, 20 => 220, 22 => 333, 24 => 139, 26 => 69),
+        'None :' => array(22 => 294),
+        'Nothing' => array(3 => 139, 12 => 248, 15 => 69, 21 => 110, 26 => 179),
+        'OF' => array(0 => 110, 5 => 283, 9 => 179, 15 => 220, 18 => 256, 20 => 161, 21 => 220, 23 => 220, 24 => 179),
+        'OR' => array(0 => 110, 3 => 69, 4 => 139, 5 => 283, 9 => 220, 14 => 195, 15 => 220, 20 => 208, 21 => 220, 23 => 208, 24 => 195),
+        'P' => array(0 => 220, 3 => 69, 9 => 220, 11 => 69, 12 => 220, 13 => 69, 20 => 69, 22 => 208, 23 => 139, 28 => 69),
+        'PRODUKT' => array(18 => 230),
+        'PRODUKT OF' => array(18 => 230),
+        'Path' => array(1 => 220, 2 => 69, 10 => 139, 26 => 69),
+        'Printf' => array(10 => 277),
+        'Printf (' => array(10 => 277),
+        'Public' => array(1 => 139, 4 => 256, 6 => 195, 12 => 139, 15 => 69, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139),
+        'Public License' => array(1 => 139, 4 => 256, 6 => 195, 12 => 139, 15 => 69, 20 => 139, 21 => 195, 22 => 195, 23 => 139, 25 => 139),
+        'R' => array(0 => 294, 2 => 110, 3 => 110, 9 => 220, 11 => 69, 18 => 256, 20 => 69, 23 => 195, 26 => 69),
+        'RLY' => array(18 => 240),
+        'Result' => array(1 => 195, 2 => 69, 9 => 220, 10 => 110, 12 => 110),
+        'Ruby' => array(7 => 283, 16 => 220, 21 => 110, 23 => 208, 26 => 69),
+        'S' => array(0 => 230, 2 => 139, 3 => 69, 9 => 179, 11 => 69, 13 => 208, 15 => 179, 20 => 220, 21 => 139, 23 => 264, 26 => 139, 28 => 208),
+        'Show' => array(5 => 139, 12 => 294, 13 => 69, 23 => 69, 26 => 110, 28 => 69),
+        'Software' => array(1 => 139, 2 => 220, 4 => 195, 6 => 110, 7 => 283, 9 => 179, 12 => 69, 20 => 161, 21 => 110, 22 => 139, 23 => 139, 25 => 69),
+        'String' => array(0 => 256, 1 => 208, 2 => 110, 3 => 110, 5 => 256, 9 => 230, 10 => 179, 11 => 69, 12 => 333, 14 => 220, 15 => 271, 23 => 179, 24 => 283, 26 => 69),
+        'String (' => array(0 => 220, 1 => 69, 10 => 179, 12 => 208, 14 => 220, 15 => 230, 24 => 110),
+        'String )' => array(0 => 220, 1 => 139, 5 => 110, 9 => 195, 12 => 161, 14 => 220, 23 => 69, 24 => 256),
+        'String ,' => array(0 => 220, 9 => 220, 12 => 300, 15 => 179, 24 => 277),
+        'System' => array(0 => 179, 2 => 195, 4 => 110, 5 => 356, 7 => 110, 12 => 69, 14 => 220, 23 => 69, 24 => 139),
+        'System .' => array(0 => 179, 5 => 353, 12 => 69, 14 => 220, 24 => 139),
+        'T' => array(0 => 110, 2 => 161, 3 => 69, 5 => 220, 7 => 110, 9 => 240, 10 => 161, 11 => 69, 12 => 69, 13 => 161, 20 => 69, 22 => 69, 23 => 110, 24 => 220, 26 => 139, 28 => 161),
+        'TABLE' => array(9 => 139, 20 => 69, 23 => 69, 26 => 277),
+        'TERM' => array(18 => 240),
+        'THE' => array(5 => 264, 9 => 195, 15 => 161, 20 => 110, 21 => 139, 23 => 161, 24 => 161),
+        'Text' => array(0 => 271, 2 => 69, 5 => 289, 9 => 139, 12 => 283, 13 => 69, 20 => 220, 22 => 110, 23 => 110, 26 => 69, 28 => 69),
+        'The' => array(0 => 300, 1 => 69, 2 => 230, 4 => 277, 5 => 283, 6 => 69, 7 => 283, 9 => 179, 12 => 230, 13 => 110, 14 => 220, 15 => 294, 20 => 309, 21 => 294, 22 => 139, 23 => 220, 26 => 220, 28 => 110),
+        'This' => array(0 => 271, 1 => 220, 2 => 264, 3 => 69, 4 => 314, 5 => 179, 6 => 110, 7 => 283, 8 => 110, 9 => 110, 10 => 69, 12 => 139, 13 => 69, 14 => 208, 15 => 248, 16 => 69, 19 => 110, 20 => 322, 21 => 277, 22 => 179, 23 => 333, 25 => 139, 26 => 248),
+        'This is' => array(1 => 69, 2 => 161, 4 => 161, 7 => 256, 9 => 69, 12 => 69, 15 => 139, 19 => 110, 20 => 220, 21 => 161, 22 => 69, 23 => 314, 25 => 69, 26 => 110),
+        'Time' => array(4 => 69, 10 => 208, 12 => 139, 23 => 240, 24 => 69, 26 => 220),
+        'True' => array(7 => 240, 12 => 208, 22 => 300, 26 => 139),
+        'Typeable' => array(12 => 283),
+        'Unit' => array(0 => 220, 12 => 110, 22 => 69, 24 => 283),
+        'V' => array(0 => 139, 2 => 110, 3 => 69, 5 => 139, 9 => 283, 13 => 110, 20 => 110, 26 => 161, 28 => 110),
+        'VISIBLE' => array(3 => 110, 18 => 271),
+        'Value' => array(0 => 69, 3 => 139, 5 => 248, 9 => 256, 10 => 161, 14 => 69, 23 => 195),
+        'Variable' => array(3 => 195, 9 => 230),
+        'Web' => array(5 => 283, 7 => 283, 26 => 69),
+        'Wikimedia' => array(7 => 110, 13 => 220, 28 => 220),
+        'Wikipedia' => array(3 => 69, 7 => 195, 13 => 220, 20 => 110, 22 => 69, 28 => 220),
+        'WriteString' => array(10 => 256),
+        'WriteString (' => array(10 => 256),
+        'Xmlable' => array(12 => 283),
+        'YR' => array(3 => 69, 18 => 248),
+        '[' => array(0 => 350, 2 => 371, 3 => 248, 4 => 294, 5 => 350, 7 => 356, 8 => 139, 9 => 283, 10 => 283, 11 => 220, 12 => 340, 13 => 271, 14 => 220, 15 => 322, 16 => 256, 17 => 161, 20 => 361, 21 => 383, 22 => 385, 23 => 376, 24 => 283, 26 => 195, 28 => 220),
+        '[ "' => array(0 => 208, 2 => 294, 3 => 110, 5 => 277, 7 => 256, 9 => 271, 12 => 283, 14 => 139, 15 => 230, 16 => 110, 20 => 220, 21 => 110, 23 => 240),
+        '[ $' => array(2 => 289, 9 => 240, 20 => 294, 21 => 294, 23 => 69),
+        '[ \'' => array(0 => 264, 3 => 208, 11 => 110, 14 => 110, 15 => 271, 20 => 139, 21 => 333, 22 => 283, 23 => 304),
+        '[ (' => array(0 => 230, 4 => 230, 12 => 240, 15 => 139, 20 => 220, 21 => 110, 22 => 139, 23 => 220, 24 => 69),
+        '[ ,' => array(0 => 256, 4 => 69, 7 => 256, 9 => 110, 14 => 69, 15 => 264, 20 => 220, 22 => 161, 23 => 283),
+        '[ -' => array(2 => 309, 5 => 161, 14 => 110, 15 => 195, 20 => 248, 21 => 179, 23 => 139),
+        '[ :' => array(7 => 271, 10 => 248, 15 => 69, 22 => 264, 23 => 289),
+        '[ ]' => array(0 => 304, 2 => 294, 4 => 277, 5 => 289, 7 => 314, 9 => 283, 10 => 283, 11 => 179, 12 => 264, 13 => 139, 14 => 220, 15 => 294, 20 => 347, 21 => 347, 22 => 318, 23 => 322, 28 => 139),
+        '[ ^' => array(0 => 110, 2 => 208, 13 => 69, 15 => 283, 20 => 248, 21 => 195, 23 => 277, 28 => 69),
+        '[ i' => array(0 => 330, 2 => 220, 4 => 283, 5 => 110, 10 => 195, 14 => 220, 15 => 294, 22 => 283, 23 => 240),
+        '[ {' => array(9 => 271, 15 => 69, 16 => 69, 20 => 230, 23 => 195),
+        '\\' => array(0 => 289, 2 => 347, 4 => 314, 5 => 179, 7 => 110, 9 => 309, 10 => 271, 11 => 294, 12 => 271, 13 => 139, 14 => 220, 15 => 330, 16 => 277, 17 => 283, 20 => 383, 21 => 358, 22 => 300, 23 => 343, 24 => 271, 26 => 69, 28 => 139),
+        '\\ "' => array(0 => 110, 2 => 220, 5 => 161, 9 => 256, 10 => 110, 14 => 220, 15 => 230, 16 => 240, 20 => 220, 21 => 220, 22 => 139, 23 => 271, 24 => 220),
+        '\\ $' => array(2 => 179, 9 => 69, 15 => 195, 17 => 220, 20 => 283, 21 => 69, 23 => 195),
+        '\\ &' => array(17 => 220, 20 => 240, 23 => 208),
+        '\\ (' => array(0 => 110, 2 => 240, 11 => 139, 15 => 283, 20 => 230, 21 => 69, 23 => 240),
+        '\\ .' => array(2 => 195, 11 => 69, 15 => 277, 20 => 240, 21 => 256, 23 => 283),
+        '\\ /' => array(2 => 264, 11 => 240, 15 => 277, 20 => 220, 21 => 161, 23 => 240),
+        '\\ \\' => array(0 => 230, 2 => 240, 4 => 69, 9 => 110, 11 => 220, 14 => 220, 15 => 283, 16 => 208, 17 => 220, 20 => 220, 21 => 161, 22 => 110, 23 => 322, 24 => 195),
+        '\\ n' => array(0 => 220, 2 => 69, 4 => 289, 9 => 69, 10 => 271, 11 => 110, 12 => 220, 14 => 220, 15 => 264, 16 => 240, 20 => 371, 21 => 333, 22 => 230, 23 => 264, 24 => 220),
+        '\\ param' => array(21 => 283),
+        '\\ s' => array(2 => 110, 15 => 294, 20 => 304, 21 => 230, 23 => 326),
+        ']' => array(0 => 350, 2 => 371, 3 => 248, 4 => 294, 5 => 350, 7 => 356, 8 => 179, 9 => 283, 10 => 283, 11 => 220, 12 => 340, 13 => 283, 14 => 220, 15 => 330, 16 => 264, 17 => 161, 20 => 361, 21 => 387, 22 => 385, 23 => 376, 24 => 283, 26 => 179, 28 => 220),
+        '] \'' => array(0 => 230, 2 => 161, 3 => 208, 14 => 139, 15 => 208, 20 => 220, 22 => 110, 23 => 230, 26 => 179),
+        '] (' => array(5 => 69, 14 => 69, 15 => 283, 20 => 69, 22 => 179, 23 => 161, 24 => 208),
+        '] )' => array(0 => 326, 2 => 110, 4 => 240, 5 => 230, 7 => 161, 9 => 283, 10 => 240, 12 => 220, 14 => 220, 15 => 300, 20 => 326, 21 => 326, 22 => 340, 23 => 283, 24 => 240),
+        '] *' => array(0 => 110, 2 => 277, 5 => 110, 14 => 161, 15 => 283, 20 => 256, 21 => 208, 22 => 69, 23 => 277),
+        '] +' => array(0 => 322, 2 => 110, 5 => 195, 7 => 283, 9 => 110, 10 => 69, 11 => 69, 13 => 69, 14 => 69, 15 => 283, 20 => 264, 21 => 283, 22 => 208, 23 => 248, 28 => 69),
+        '] ,' => array(0 => 208, 3 => 69, 4 => 139, 5 => 69, 7 => 271, 9 => 283, 10 => 161, 12 => 309, 14 => 220, 15 => 283, 16 => 139, 20 => 179, 21 => 248, 22 => 256, 23 => 322, 24 => 139),
+        '] -' => array(0 => 110, 2 => 240, 5 => 139, 7 => 283, 9 => 283, 12 => 271, 13 => 139, 15 => 230, 16 => 69, 20 => 220, 21 => 179, 22 => 139, 28 => 139),
+        '] .' => array(0 => 220, 2 => 220, 4 => 271, 5 => 161, 7 => 271, 9 => 110, 10 => 179, 13 => 69, 14 => 220, 15 => 283, 20 => 161, 21 => 179, 22 => 139, 23 => 271, 28 => 69),
+        '] ;' => array(0 => 337, 2 => 294, 4 => 289, 5 => 289, 7 => 161, 9 => 230, 13 => 69, 14 => 220, 15 => 294, 20 => 271, 21 => 340, 28 => 69),
+        '] =' => array(0 => 337, 2 => 220, 4 => 271, 5 => 309, 7 => 271, 10 => 139, 12 => 289, 13 => 69, 14 => 220, 15 => 289, 20 => 220, 21 => 322, 22 => 314, 23 => 300, 24 => 161, 28 => 69),
+        '] >' => array(0 => 264, 4 => 220, 8 => 110, 13 => 208, 14 => 161, 16 => 139, 20 => 69, 21 => 139, 28 => 161),
+        '] [' => array(0 => 69, 2 => 248, 4 => 240, 5 => 110, 7 => 110, 12 => 271, 14 => 220, 15 => 271, 20 => 220, 21 => 248, 22 => 139, 23 => 271),
+        '] ]' => array(2 => 248, 7 => 110, 8 => 110, 9 => 161, 10 => 69, 12 => 220, 13 => 179, 14 => 220, 15 => 256, 16 => 110, 20 => 220, 21 => 161, 22 => 110, 23 => 230, 28 => 69),
+        '] fromContent' => array(12 => 271),
+        '] if' => array(10 => 110, 14 => 69, 22 => 271, 23 => 195),
+        '] }' => array(2 => 230, 9 => 248, 10 => 110, 12 => 179, 15 => 179, 16 => 110, 20 => 264, 21 => 248, 23 => 230),
+        '^' => array(0 => 139, 2 => 271, 3 => 110, 4 => 69, 7 => 283, 10 => 69, 11 => 110, 13 => 161, 14 => 220, 15 => 304, 17 => 220, 18 => 69, 20 => 337, 21 => 289, 23 => 326, 28 => 161),
+        '^ \\' => array(0 => 110, 2 => 161, 11 => 69, 13 => 110, 15 => 294, 17 => 69, 20 => 283, 21 => 161, 23 => 318, 28 => 110),
+        '_' => array(0 => 230, 2 => 220, 3 => 110, 4 => 69, 9 => 289, 10 => 277, 11 => 110, 12 => 300, 13 => 69, 15 => 195, 20 => 364, 21 => 220, 22 => 139, 23 => 283, 24 => 195, 28 => 69),
+        '_ -' => array(9 => 271, 12 => 110, 20 => 264, 22 => 69),
+        '_ ;' => array(20 => 337),
+        '_ }' => array(9 => 248, 20 => 289),
+        '`' => array(2 => 350, 5 => 110, 10 => 220, 12 => 240, 15 => 139, 20 => 314, 21 => 161, 23 => 271, 26 => 240),
+        'a' => array(0 => 333, 1 => 69, 2 => 353, 3 => 69, 4 => 358, 5 => 289, 6 => 264, 7 => 314, 8 => 277, 9 => 283, 10 => 248, 11 => 195, 12 => 322, 13 => 220, 14 => 220, 15 => 333, 16 => 230, 17 => 230, 18 => 69, 19 => 208, 20 => 376, 21 => 387, 22 => 364, 23 => 397, 24 => 230, 25 => 179, 26 => 248, 27 => 179, 28 => 230),
+        'a \'' => array(0 => 69, 8 => 110, 11 => 161, 12 => 220, 14 => 220, 15 => 161, 16 => 161, 19 => 69, 20 => 139, 21 => 161, 22 => 69, 23 => 240, 24 => 69),
+        'a )' => array(0 => 69, 5 => 69, 12 => 283, 13 => 208, 14 => 220, 15 => 220, 17 => 161, 21 => 69, 22 => 69, 28 => 208),
+        'a ,' => array(0 => 69, 4 => 139, 5 => 161, 6 => 69, 12 => 161, 13 => 110, 14 => 195, 15 => 283, 17 => 220, 20 => 69, 21 => 69, 22 => 139, 23 => 110, 28 => 110),
+        'a -' => array(0 => 139, 2 => 179, 4 => 110, 7 => 110, 12 => 248, 15 => 220, 17 => 110, 20 => 230, 21 => 161, 23 => 208),
+        'a .' => array(4 => 208, 6 => 208, 13 => 195, 14 => 220, 15 => 277, 20 => 69, 23 => 161, 28 => 195),
+        'a =' => array(0 => 110, 2 => 139, 4 => 179, 7 => 110, 12 => 220, 13 => 139, 14 => 69, 15 => 264, 16 => 220, 17 => 69, 19 => 69, 21 => 110, 22 => 220, 28 => 139),
+        'a >' => array(5 => 161, 8 => 139, 13 => 220, 15 => 256, 21 => 208, 23 => 304, 28 => 220),
+        'a href' => array(5 => 161, 8 => 139, 13 => 220, 15 => 110, 21 => 195, 23 => 230, 28 => 220),
+        'action' => array(4 => 69, 5 => 69, 12 => 139, 13 => 230, 14 => 220, 15 => 110, 20 => 220, 23 => 240, 28 => 230),
+        'add' => array(0 => 220, 2 => 277, 7 => 110, 9 => 69, 12 => 69, 14 => 220, 15 => 220, 20 => 277, 22 => 139, 23 => 220),
+        'after' => array(0 => 139, 2 => 110, 4 => 230, 7 => 283, 9 => 230, 12 => 69, 14 => 179, 15 => 220, 17 => 69, 20 => 240, 21 => 139, 23 => 161, 25 => 69),
+        'align' => array(0 => 220, 2 => 69, 6 => 220, 13 => 220, 21 => 139, 23 => 110, 25 => 161, 28 => 220),
+        'align :' => array(0 => 139, 6 => 220, 13 => 220, 21 => 139, 23 => 110, 25 => 161, 28 => 220),
+        'all' => array(0 => 256, 1 => 179, 2 => 248, 3 => 139, 4 => 256, 5 => 220, 7 => 304, 8 => 69, 9 => 230, 12 => 195, 14 => 220, 15 => 283, 16 => 69, 19 => 69, 20 => 309, 21 => 139, 22 => 195, 23 => 195, 24 => 110, 25 => 69, 26 => 69),
+        'alt' => array(13 => 220, 15 => 69, 21 => 110, 23 => 195, 28 => 220),
+        'alt =' => array(13 => 220, 21 => 110, 23 => 179, 28 => 220),
+        'an' => array(0 => 289, 2 => 220, 4 => 220, 5 => 220, 7 => 283, 9 => 179, 10 => 69, 11 => 69, 12 => 248, 13 => 110, 14 => 220, 15 => 304, 16 => 240, 20 => 294, 21 => 283, 22 => 110, 23 => 248, 26 => 161, 28 => 139),
+        'and' => array(0 => 337, 1 => 69, 2 => 300, 4 => 322, 5 => 289, 6 => 161, 7 => 283, 8 => 195, 9 => 271, 10 => 179, 11 => 139, 12 => 277, 13 => 161, 14 => 220, 15 => 330, 16 => 230, 17 => 69, 18 => 69, 20 => 358, 21 => 326, 22 => 330, 23 => 322, 24 => 110, 25 => 110, 26 => 230, 28 => 161),
+        'append' => array(9 => 139, 14 => 220, 15 => 283, 20 => 110, 22 => 230, 24 => 179),
+        'append (' => array(9 => 69, 14 => 220, 15 => 277, 22 => 230, 24 => 179),
+        'application' => array(0 => 69, 4 => 69, 7 => 283, 9 => 220, 10 => 195, 12 => 110, 15 => 230, 21 => 69, 23 => 195, 24 => 110),
+        'are' => array(0 => 271, 2 => 230, 3 => 69, 4 => 256, 5 => 289, 7 => 283, 8 => 195, 9 => 220, 12 => 240, 14 => 220, 15 => 264, 19 => 69, 20 => 309, 21 => 289, 22 => 179, 23 => 256, 25 => 110, 26 => 110, 28 => 69),
+        'args' => array(2 => 220, 5 => 220, 10 => 220, 11 => 69, 14 => 69, 15 => 283, 21 => 161, 22 => 139, 23 => 220),
+        'argv' => array(2 => 69, 4 => 161, 22 => 283),
+        'array' => array(0 => 240, 2 => 139, 5 => 208, 14 => 220, 15 => 283, 16 => 110, 20 => 289, 21 => 330, 22 => 110, 24 => 139),
+        'array (' => array(20 => 69, 21 => 330, 24 => 69),
+        'articles' => array(2 => 69, 13 => 220, 22 => 110, 28 => 220),
+        'as' => array(0 => 294, 1 => 110, 2 => 220, 4 => 256, 5 => 264, 6 => 110, 7 => 304, 8 => 208, 9 => 69, 10 => 110, 12 => 289, 13 => 161, 14 => 220, 15 => 271, 16 => 220, 20 => 322, 21 => 337, 22 => 208, 23 => 264, 25 => 69, 26 => 110, 28 => 179),
+        'as $' => array(2 => 110, 20 => 139, 21 => 314),
+        'at' => array(0 => 256, 1 => 69, 2 => 208, 4 => 277, 5 => 195, 6 => 110, 7 => 283, 8 => 69, 9 => 161, 10 => 69, 12 => 230, 13 => 69, 14 => 220, 15 => 179, 18 => 69, 20 => 300, 21 => 248, 22 => 139, 23 => 195, 25 => 69, 26 => 139, 28 => 110),
+        'attribute' => array(5 => 69, 9 => 208, 12 => 110, 15 => 283, 16 => 220, 20 => 179, 22 => 220, 23 => 139),
+        'attributes' => array(0 => 110, 12 => 69, 15 => 283, 16 => 220, 20 => 139, 22 => 179, 23 => 220),
+        'auto' => array(0 => 179, 2 => 179, 3 => 69, 4 => 69, 5 => 110, 6 => 248, 7 => 110, 13 => 161, 15 => 220, 20 => 139, 21 => 139, 25 => 161, 28 => 161),
+        'auto ;' => array(0 => 69, 2 => 110, 6 => 240, 13 => 110, 21 => 110, 25 => 110, 28 => 110),
+        'available' => array(0 => 304, 2 => 179, 7 => 240, 8 => 69, 15 => 161, 20 => 240, 21 => 69, 23 => 110),
+        'b' => array(0 => 230, 2 => 271, 4 => 220, 7 => 220, 10 => 248, 11 => 161, 12 => 240, 13 => 220, 14 => 220, 15 => 289, 16 => 220, 17 => 220, 19 => 69, 20 => 264, 21 => 161, 22 => 283, 23 => 271, 24 => 110, 28 => 220),
+        'b \'' => array(0 => 110, 7 => 110, 11 => 161, 14 => 179, 15 => 179, 16 => 220, 21 => 69, 23 => 139),
+        'b )' => array(0 => 69, 10 => 139, 12 => 208, 13 => 195, 14 => 220, 15 => 283, 17 => 220, 20 => 69, 22 => 69, 28 => 195),
+        'b ,' => array(0 => 179, 2 => 69, 4 => 69, 10 => 139, 12 => 110, 14 => 110, 15 => 195, 17 => 220),
+        'b /' => array(0 => 161, 2 => 195, 13 => 220, 15 => 69, 20 => 139, 21 => 69, 28 => 220),
+        'b =' => array(0 => 195, 2 => 110, 4 => 208, 10 => 139, 12 => 69, 13 => 220, 14 => 110, 15 => 161, 17 => 208, 19 => 69, 22 => 220, 28 => 220),
+        'b >' => array(0 => 220, 13 => 220, 15 => 69, 23 => 161, 28 => 220),
+        'background' => array(4 => 220, 6 => 322, 8 => 139, 13 => 179, 15 => 139, 21 => 179, 23 => 110, 25 => 139, 28 => 179),
+        'background -' => array(6 => 322, 8 => 139, 13 => 110, 15 => 139, 21 => 139, 25 => 69, 28 => 110),
+        'bd' => array(13 => 220, 15 => 220, 28 => 220),
+        'bd /' => array(13 => 220, 28 => 220),
+        'be' => array(0 => 309, 1 => 69, 2 => 248, 3 => 110, 4 => 309, 5 => 220, 6 => 110, 7 => 294, 8 => 69, 9 => 139, 10 => 195, 12 => 240, 13 => 139, 14 => 220, 15 => 300, 19 => 69, 20 => 350, 21 => 314, 22 => 230, 23 => 318, 24 => 69, 25 => 69, 26 => 110, 28 => 139),
+        'before' => array(0 => 139, 2 => 110, 4 => 240, 7 => 240, 9 => 69, 10 => 110, 12 => 69, 15 => 240, 20 => 256, 21 => 110, 23 => 179, 25 => 220),
+        'begin' => array(1 => 220, 7 => 110, 14 => 220, 17 => 161, 20 => 208, 23 => 220, 24 => 161),
+        'between' => array(0 => 248, 4 => 110, 7 => 283, 12 => 110, 14 => 179, 20 => 248, 21 => 110, 22 => 69, 23 => 110),
+        'bits' => array(0 => 230, 4 => 220, 5 => 220, 13 => 139, 14 => 220, 22 => 110, 28 => 139),
+        'blah' => array(7 => 161, 8 => 220, 21 => 220),
+        'block' => array(2 => 179, 3 => 69, 4 => 69, 5 => 139, 6 => 139, 7 => 283, 9 => 208, 10 => 69, 13 => 69, 14 => 161, 15 => 220, 20 => 264, 21 => 69, 23 => 161, 24 => 139, 25 => 139, 28 => 69),
+        'body' => array(6 => 69, 7 => 110, 8 => 110, 10 => 161, 12 => 220, 13 => 161, 15 => 283, 20 => 195, 21 => 139, 22 => 161, 23 => 289, 28 => 161),
+        'bold' => array(0 => 161, 6 => 277, 8 => 110, 13 => 110, 21 => 139, 23 => 161, 25 => 161, 28 => 110),
+        'bold ;' => array(6 => 220, 8 => 110, 13 => 110, 21 => 110, 25 => 161, 28 => 110),
+        'bool' => array(4 => 208, 5 => 304, 7 => 161, 9 => 69, 10 => 230, 13 => 220, 15 => 139, 20 => 110, 21 => 69, 22 => 179, 28 => 220),
+        'bool >' => array(5 => 220, 13 => 220, 28 => 220),
+        'border' => array(0 => 220, 4 => 139, 6 => 289, 13 => 110, 15 => 277, 21 => 220, 23 => 208, 25 => 256, 28 => 110),
+        'border -' => array(6 => 289, 15 => 161, 21 => 208, 23 => 110, 25 => 220),
+        'border :' => array(0 => 110, 6 => 264, 13 => 110, 15 => 179, 21 => 69, 23 => 69, 25 => 139, 28 => 110),
+        'br' => array(0 => 208, 13 => 220, 15 => 69, 21 => 240, 23 => 256, 28 => 220),
+        'br /' => array(0 => 161, 13 => 220, 23 => 230, 28 => 220),
+        'break' => array(0 => 322, 2 => 195, 3 => 69, 4 => 256, 5 => 220, 7 => 110, 9 => 69, 10 => 110, 12 => 110, 14 => 220, 15 => 283, 20 => 220, 21 => 230, 22 => 195, 23 => 161),
+        'break ;' => array(0 => 322, 2 => 69, 4 => 248, 5 => 208, 10 => 69, 14 => 220, 15 => 283, 21 => 230),
+        'buf' => array(4 => 179, 10 => 220, 14 => 161, 17 => 161, 24 => 208),
+        'but' => array(0 => 161, 1 => 69, 2 => 230, 4 => 240, 5 => 110, 6 => 110, 7 => 294, 12 => 110, 14 => 208, 15 => 240, 20 => 326, 21 => 240, 22 => 110, 23 => 195, 24 => 69, 25 => 110, 26 => 69, 28 => 69),
+        'by' => array(0 => 230, 1 => 110, 2 => 264, 4 => 264, 5 => 256, 6 => 110, 7 => 283, 8 => 110, 9 => 208, 10 => 139, 12 => 208, 13 => 161, 14 => 220, 15 => 283, 16 => 110, 18 => 69, 20 => 318, 21 => 256, 22 => 161, 23 => 314, 25 => 69, 26 => 179, 28 => 161),
+        'byte' => array(0 => 139, 4 => 139, 5 => 220, 7 => 195, 10 => 230, 11 => 110, 14 => 220, 20 => 161),
+        'c' => array(0 => 230, 2 => 271, 4 => 230, 5 => 139, 7 => 161, 8 => 179, 9 => 110, 10 => 322, 11 => 69, 12 => 195, 13 => 220, 14 => 220, 15 => 283, 16 => 220, 17 => 220, 19 => 69, 20 => 256, 21 => 289, 22 => 256, 23 => 248, 24 => 179, 27 => 69, 28 => 220),
+        'c )' => array(0 => 69, 4 => 69, 5 => 139, 9 => 69, 10 => 208, 12 => 69, 13 => 69, 14 => 220, 15 => 179, 17 => 220, 21 => 110, 22 => 69, 23 => 69, 24 => 69, 28 => 69),
+        'c *' => array(10 => 256),
+        'c ,' => array(0 => 69, 4 => 69, 10 => 230, 17 => 195, 20 => 69, 21 => 69, 22 => 139),
+        'c .' => array(10 => 271, 13 => 195, 14 => 220, 20 => 69, 22 => 195, 28 => 195),
+        'c =' => array(0 => 220, 2 => 69, 4 => 220, 7 => 161, 10 => 69, 12 => 110, 13 => 139, 14 => 179, 15 => 110, 16 => 195, 17 => 220, 19 => 69, 20 => 69, 21 => 139, 22 => 69, 24 => 161, 28 => 139),
+        'call' => array(0 => 179, 2 => 69, 9 => 110, 10 => 69, 12 => 69, 15 => 289, 20 => 300, 21 => 208, 23 => 208),
+        'called' => array(0 => 69, 7 => 283, 12 => 220, 14 => 110, 15 => 220, 20 => 179, 21 => 110, 23 => 139),
+        'can' => array(0 => 264, 1 => 69, 2 => 220, 4 => 230, 5 => 110, 6 => 110, 7 => 283, 9 => 139, 10 => 161, 12 => 220, 13 => 69, 14 => 179, 15 => 230, 20 => 318, 21 => 230, 22 => 139, 23 => 289, 24 => 69, 25 => 69, 28 => 69),
+        'can be' => array(0 => 248, 2 => 69, 7 => 283, 10 => 110, 12 => 110, 14 => 110, 15 => 195, 20 => 248, 21 => 139, 23 => 179, 24 => 69),
+        'case' => array(0 => 322, 1 => 110, 2 => 283, 3 => 69, 4 => 248, 5 => 208, 7 => 195, 9 => 283, 10 => 271, 12 => 289, 13 => 69, 14 => 220, 15 => 283, 20 => 277, 21 => 230, 22 => 230, 23 => 179, 24 => 220, 25 => 69, 28 => 69),
+        'center' => array(0 => 161, 2 => 69, 6 => 179, 10 => 69, 13 => 220, 21 => 69, 23 => 69, 25 => 110, 28 => 220),
+        'center ;' => array(6 => 139, 13 => 220, 25 => 110, 28 => 220),
+        'char' => array(0 => 69, 2 => 179, 3 => 69, 4 => 318, 7 => 161, 14 => 220, 15 => 110, 20 => 179, 22 => 240, 26 => 220, 27 => 69),
+        'char *' => array(2 => 69, 4 => 309, 7 => 161),
+        'checked' => array(5 => 220, 7 => 161, 12 => 69, 15 => 283, 16 => 179, 20 => 69),
+        'children' => array(0 => 220, 10 => 220, 11 => 195, 15 => 283, 22 => 69, 23 => 69, 26 => 69),
+        'class' => array(0 => 271, 2 => 69, 4 => 110, 5 => 283, 7 => 283, 8 => 220, 10 => 110, 11 => 161, 12 => 161, 13 => 283, 14 => 220, 15 => 289, 16 => 220, 20 => 240, 21 => 371, 22 => 240, 23 => 374, 24 => 139, 28 => 283),
+        'class =' => array(0 => 220, 8 => 220, 13 => 283, 15 => 230, 16 => 220, 20 => 69, 21 => 322, 23 => 330, 28 => 283),
+        'classes' => array(7 => 283, 14 => 220, 15 => 240, 16 => 139, 23 => 161),
+        'code' => array(0 => 220, 2 => 220, 3 => 110, 4 => 161, 5 => 294, 6 => 179, 7 => 283, 9 => 139, 14 => 220, 15 => 264, 16 => 139, 20 => 347, 21 => 322, 22 => 283, 23 => 230, 24 => 69),
+        'collect' => array(11 => 69, 15 => 69, 23 => 300),
+        'color' => array(0 => 220, 2 => 139, 4 => 220, 5 => 69, 6 => 300, 8 => 69, 13 => 179, 15 => 240, 21 => 69, 22 => 220, 23 => 139, 25 => 161, 28 => 179),
+        'color :' => array(0 => 220, 6 => 300, 8 => 69, 13 => 179, 15 => 110, 21 => 69, 22 => 69, 23 => 139, 25 => 139, 28 => 179),
+        'columns' => array(0 => 283, 4 => 139, 9 => 220, 14 => 110, 20 => 139, 23 => 220),
+        'com' => array(0 => 264, 1 => 69, 2 => 230, 3 => 110, 4 => 139, 5 => 208, 6 => 69, 7 => 283, 8 => 110, 9 => 179, 10 => 139, 12 => 110, 14 => 139, 15 => 277, 20 => 300, 21 => 69, 22 => 69, 23 => 240, 24 => 161, 25 => 69, 26 => 69),
+        'comment' => array(4 => 69, 6 => 69, 8 => 220, 9 => 139, 14 => 161, 15 => 220, 16 => 220, 17 => 110, 19 => 139, 20 => 283, 21 => 179, 22 => 220, 23 => 110, 24 => 161, 27 => 69),
+        'commons' => array(13 => 220, 20 => 139, 28 => 220),
+        'commons /' => array(13 => 220, 28 => 220),
+        'config' => array(2 => 220, 4 => 161, 16 => 220, 20 => 240, 23 => 240),
+        'conn' => array(10 => 220, 24 => 220),
+        'conn .' => array(10 => 208, 24 => 220),
+        'const' => array(0 => 294, 3 => 139, 4 => 358, 5 => 230, 7 => 256, 10 => 220, 12 => 69, 20 => 195, 21 => 69, 22 => 110),
+        'const char' => array(4 => 304, 7 => 161),
+        'content' => array(0 => 220, 8 => 69, 10 => 220, 13 => 220, 15 => 179, 16 => 220, 20 => 208, 21 => 220, 23 => 326, 25 => 139, 28 => 220),
+        'content =' => array(0 => 69, 13 => 220, 21 => 69, 23 => 314, 28 => 220),
+        'context' => array(7 => 161, 9 => 220, 10 => 139, 15 => 289, 20 => 230, 23 => 208, 26 => 110),
+        'continue' => array(0 => 220, 3 => 69, 4 => 248, 5 => 179, 10 => 139, 14 => 220, 15 => 283, 20 => 240, 21 => 240, 22 => 110, 23 => 110),
+        'continue ;' => array(0 => 208, 4 => 248, 5 => 179, 14 => 220, 15 => 283, 21 => 240),
+        'core' => array(0 => 110, 1 => 69, 2 => 161, 4 => 289, 7 => 330, 15 => 139, 20 => 69, 21 => 69),
+        'count' => array(0 => 220, 4 => 69, 5 => 248, 8 => 69, 9 => 69, 11 => 139, 14 => 69, 15 => 179, 20 => 300, 21 => 289, 22 => 230, 23 => 248),
+        'cs' => array(0 => 161, 3 => 69, 5 => 230, 12 => 283, 13 => 195, 14 => 179, 15 => 139, 20 => 139, 21 => 69, 28 => 195),
+        'css' => array(2 => 110, 8 => 69, 13 => 208, 15 => 264, 16 => 139, 20 => 69, 21 => 318, 23 => 139, 25 => 69, 28 => 208),
+        'css "' => array(13 => 179, 20 => 69, 21 => 264, 23 => 110, 28 => 179),
+        'ctx' => array(10 => 220, 12 => 220),
+        'd' => array(0 => 248, 2 => 309, 4 => 220, 5 => 69, 7 => 161, 8 => 69, 10 => 271, 13 => 110, 14 => 220, 15 => 294, 16 => 220, 17 => 220, 19 => 69, 20 => 277, 21 => 179, 22 => 110, 23 => 322, 24 => 69, 26 => 179, 27 => 139, 28 => 110),
+        'd \'' => array(0 => 139, 2 => 264, 14 => 69, 16 => 220, 20 => 208, 23 => 195, 26 => 110),
+        'd )' => array(0 => 69, 10 => 220, 14 => 161, 17 => 195, 20 => 110),
+        'data' => array(0 => 289, 2 => 161, 4 => 294, 5 => 69, 7 => 304, 8 => 69, 10 => 264, 12 => 283, 13 => 161, 14 => 110, 15 => 322, 20 => 333, 21 => 195, 22 => 256, 23 => 69, 24 => 110, 25 => 69, 26 => 139, 28 => 161),
+        'data )' => array(0 => 220, 4 => 264, 10 => 139, 15 => 277, 20 => 230, 22 => 220),
+        'date' => array(2 => 110, 4 => 69, 7 => 161, 8 => 220, 9 => 110, 15 => 179, 20 => 179, 22 => 161, 23 => 139, 24 => 220, 27 => 110),
+        'de' => array(7 => 110, 13 => 220, 20 => 69, 23 => 69, 26 => 110, 28 => 220),
+        'def' => array(7 => 195, 11 => 256, 14 => 220, 20 => 69, 22 => 347, 23 => 353, 24 => 283),
+        'default' => array(0 => 248, 2 => 240, 3 => 69, 4 => 139, 5 => 220, 6 => 110, 8 => 69, 9 => 208, 10 => 110, 12 => 69, 14 => 195, 15 => 277, 16 => 110, 20 => 314, 21 => 220, 22 => 220, 23 => 283, 26 => 220),
+        'deriving' => array(12 => 277),
+        'deriving (' => array(12 => 277),
+        'dir' => array(2 => 256, 4 => 220, 10 => 161, 13 => 220, 15 => 220, 20 => 277, 23 => 220, 28 => 220),
+        'dir =' => array(2 => 161, 4 => 69, 13 => 220, 20 => 69, 23 => 220, 28 => 220),
+        'directory' => array(2 => 264, 4 => 230, 10 => 69, 13 => 139, 20 => 256, 21 => 139, 22 => 69, 28 => 139),
+        'div' => array(0 => 220, 6 => 230, 8 => 240, 13 => 220, 15 => 322, 16 => 220, 21 => 343, 23 => 314, 25 => 110, 28 => 220),
+        'div .' => array(6 => 230, 13 => 220, 15 => 220, 28 => 220),
+        'div >' => array(0 => 220, 8 => 208, 13 => 220, 15 => 283, 16 => 220, 21 => 322, 23 => 264, 28 => 220),
+        'div class' => array(0 => 220, 13 => 220, 15 => 110, 16 => 220, 21 => 264, 23 => 230, 28 => 220),
+        'div id' => array(8 => 161, 13 => 179, 15 => 110, 16 => 69, 21 => 179, 23 => 208, 28 => 179),
+        'div style' => array(8 => 69, 13 => 220, 15 => 110, 21 => 110, 23 => 69, 28 => 220),
+        'divOtherProjectsItem' => array(13 => 220, 28 => 220),
+        'divOtherProjectsItem "' => array(13 => 220, 28 => 220),
+        'divTop10item' => array(13 => 220, 28 => 220),
+        'divTop10item "' => array(13 => 220, 28 => 220),
+        'do' => array(0 => 208, 2 => 333, 3 => 69, 4 => 230, 5 => 230, 7 => 283, 9 => 139, 10 => 69, 11 => 69, 12 => 283, 13 => 69, 14 => 139, 15 => 256, 20 => 309, 21 => 139, 23 => 371, 28 => 69),
+        'do |' => array(23 => 318),
+        'doc' => array(2 => 110, 9 => 277, 15 => 283, 20 => 69, 22 => 161, 23 => 195, 26 => 69),
+        'document' => array(0 => 220, 7 => 220, 8 => 69, 10 => 110, 13 => 139, 15 => 294, 17 => 161, 21 => 139, 23 => 139, 28 => 139),
+        'don' => array(0 => 139, 2 => 240, 4 => 179, 5 => 69, 9 => 69, 10 => 69, 12 => 110, 15 => 240, 20 => 283, 21 => 240, 23 => 161),
+        'don \'' => array(0 => 139, 2 => 240, 4 => 179, 5 => 69, 9 => 69, 10 => 69, 12 => 110, 15 => 240, 20 => 283, 21 => 240, 23 => 161),
+        'done' => array(0 => 208, 2 => 333, 4 => 69, 5 => 69, 7 => 110, 14 => 110, 15 => 220, 20 => 264, 21 => 69, 24 => 69),
+        'double' => array(2 => 69, 3 => 69, 4 => 271, 5 => 240, 7 => 195, 14 => 139, 20 => 220, 21 => 69, 23 => 161),
+        'e' => array(0 => 139, 2 => 264, 3 => 69, 5 => 309, 7 => 283, 9 => 110, 10 => 256, 12 => 289, 13 => 139, 14 => 220, 15 => 340, 16 => 139, 19 => 110, 20 => 179, 21 => 220, 22 => 230, 23 => 248, 24 => 161, 25 => 69, 27 => 110, 28 => 139),
+        'e )' => array(5 => 271, 10 => 161, 12 => 220, 14 => 110, 15 => 322, 21 => 139, 23 => 69),
+        'e .' => array(0 => 110, 2 => 240, 3 => 69, 5 => 230, 7 => 283, 14 => 220, 15 => 277, 20 => 139, 21 => 179, 22 => 179, 23 => 139, 24 => 69, 25 => 69),
+        'each' => array(0 => 264, 2 => 69, 4 => 220, 5 => 264, 7 => 240, 10 => 69, 11 => 195, 12 => 110, 14 => 139, 15 => 289, 20 => 271, 21 => 139, 23 => 277, 25 => 139, 26 => 69),
+        'echo' => array(2 => 358, 20 => 110, 21 => 330, 23 => 139),
+        'echo "' => array(2 => 347, 21 => 248),
+        'element' => array(0 => 161, 5 => 230, 7 => 220, 9 => 69, 13 => 69, 15 => 340, 20 => 139, 21 => 110, 22 => 195, 23 => 139, 28 => 69),
+        'elements' => array(0 => 208, 5 => 277, 7 => 110, 9 => 69, 14 => 195, 15 => 304, 20 => 220, 21 => 69, 22 => 69, 24 => 179),
+        'elif' => array(2 => 264, 7 => 110, 20 => 110, 22 => 318),
+        'else' => array(0 => 350, 1 => 139, 2 => 326, 3 => 69, 4 => 314, 5 => 289, 7 => 240, 8 => 179, 10 => 256, 12 => 248, 13 => 139, 14 => 220, 15 => 289, 20 => 337, 21 => 240, 22 => 289, 23 => 330, 24 => 139, 28 => 139),
+        'else if' => array(0 => 304, 2 => 69, 4 => 161, 5 => 69, 7 => 161, 10 => 110, 13 => 110, 14 => 220, 15 => 283, 21 => 69, 24 => 69, 28 => 110),
+        'else {' => array(0 => 337, 4 => 256, 5 => 161, 10 => 240, 14 => 220, 15 => 283, 20 => 337, 21 => 220, 24 => 69),
+        'elsif' => array(1 => 161, 20 => 347, 23 => 256),
+        'elsif (' => array(20 => 347),
+        'em' => array(6 => 264, 13 => 220, 15 => 69, 21 => 248, 23 => 208, 25 => 248, 28 => 220),
+        'em .' => array(6 => 139, 13 => 208, 28 => 208),
+        'em ;' => array(6 => 240, 13 => 220, 21 => 220, 23 => 110, 25 => 248, 28 => 220),
+        'em >' => array(13 => 220, 21 => 110, 28 => 220),
+        'em em' => array(6 => 139, 13 => 220, 28 => 220),
+        'empty' => array(2 => 161, 3 => 69, 5 => 220, 8 => 69, 12 => 139, 14 => 220, 15 => 283, 20 => 69, 21 => 69, 23 => 283, 25 => 69),
+        'en' => array(2 => 230, 5 => 139, 6 => 69, 8 => 139, 9 => 69, 13 => 220, 20 => 220, 21 => 110, 23 => 161, 26 => 69, 28 => 220),
+        'end' => array(0 => 240, 1 => 220, 2 => 69, 3 => 161, 4 => 69, 5 => 195, 7 => 256, 9 => 283, 10 => 69, 12 => 110, 14 => 220, 15 => 277, 17 => 161, 20 => 264, 21 => 240, 23 => 397, 24 => 179, 27 => 69),
+        'end ,' => array(9 => 283, 15 => 69, 21 => 69),
+        'end .' => array(2 => 69, 7 => 110, 9 => 283, 14 => 208, 23 => 208),
+        'end def' => array(23 => 333),
+        'end end' => array(9 => 277, 23 => 350),
+        'endif' => array(4 => 337, 5 => 220, 8 => 220, 13 => 139, 16 => 69, 20 => 139, 21 => 69, 23 => 195, 28 => 139),
+        'enum' => array(3 => 139, 13 => 220, 20 => 139, 28 => 220),
+        'enum >' => array(13 => 220, 28 => 220),
+        'eo' => array(13 => 220, 15 => 110, 28 => 220),
+        'eq' => array(2 => 230, 15 => 195, 20 => 340),
+        'err' => array(2 => 139, 4 => 220, 5 => 208, 10 => 283, 12 => 161, 23 => 220),
+        'error' => array(0 => 179, 2 => 208, 4 => 110, 5 => 69, 7 => 110, 9 => 256, 10 => 110, 12 => 230, 14 => 220, 15 => 248, 16 => 69, 20 => 294, 21 => 230, 24 => 139, 25 => 139, 28 => 69),
+        'es' => array(2 => 69, 13 => 220, 28 => 220),
+        'exit' => array(0 => 110, 2 => 314, 4 => 69, 15 => 69, 20 => 256, 22 => 110, 23 => 240),
+        'expression' => array(3 => 139, 7 => 271, 14 => 220, 15 => 256, 20 => 230),
+        'extends' => array(8 => 69, 9 => 139, 13 => 161, 20 => 110, 21 => 69, 24 => 220, 28 => 161),
+        'f' => array(0 => 248, 2 => 318, 4 => 289, 5 => 161, 9 => 69, 10 => 69, 12 => 161, 13 => 161, 14 => 220, 15 => 240, 20 => 110, 21 => 220, 22 => 139, 23 => 248, 24 => 69, 28 => 161),
+        'false' => array(0 => 300, 2 => 69, 4 => 256, 5 => 271, 7 => 161, 9 => 283, 10 => 230, 11 => 69, 12 => 161, 13 => 110, 14 => 220, 15 => 300, 16 => 139, 20 => 283, 21 => 322, 22 => 69, 23 => 208, 24 => 110, 28 => 110),
+        'false )' => array(0 => 195, 4 => 161, 5 => 161, 7 => 110, 9 => 69, 10 => 69, 11 => 69, 13 => 69, 14 => 161, 15 => 271, 21 => 283, 23 => 110, 28 => 69),
+        'false -' => array(9 => 277),
+        'false ;' => array(0 => 300, 4 => 208, 5 => 248, 9 => 69, 10 => 69, 14 => 220, 15 => 294, 21 => 271, 23 => 69),
+        'family' => array(0 => 110, 6 => 240, 7 => 161, 13 => 69, 15 => 220, 20 => 110, 25 => 139, 28 => 69),
+        'family :' => array(0 => 69, 6 => 240, 13 => 69, 25 => 139, 28 => 69),
+        'fi' => array(2 => 347, 13 => 195, 20 => 230, 23 => 69, 28 => 195),
+        'field' => array(4 => 69, 5 => 271, 7 => 161, 14 => 110, 23 => 220),
+        'file' => array(0 => 240, 1 => 69, 2 => 283, 4 => 271, 5 => 220, 6 => 110, 7 => 322, 9 => 208, 10 => 161, 12 => 69, 14 => 220, 15 => 208, 20 => 318, 21 => 240, 22 => 161, 23 => 326, 24 => 69, 25 => 110),
+        'filter' => array(0 => 220, 2 => 110, 8 => 139, 9 => 220, 11 => 110, 12 => 230, 13 => 110, 15 => 283, 16 => 179, 20 => 240, 23 => 110, 28 => 110),
+        'find' => array(0 => 161, 2 => 179, 4 => 110, 6 => 69, 9 => 208, 10 => 139, 11 => 69, 12 => 69, 15 => 283, 20 => 283, 21 => 110, 23 => 230),
+        'first' => array(0 => 277, 2 => 179, 3 => 69, 4 => 195, 5 => 264, 7 => 220, 9 => 110, 10 => 139, 12 => 110, 14 => 220, 15 => 309, 20 => 304, 21 => 69, 22 => 69, 23 => 256),
+        'float' => array(0 => 195, 3 => 69, 4 => 256, 5 => 220, 7 => 110, 12 => 139, 13 => 110, 15 => 220, 20 => 195, 21 => 240, 22 => 240, 23 => 139, 24 => 69, 25 => 69, 28 => 110),
+        'fmt' => array(10 => 248),
+        'font' => array(0 => 220, 2 => 220, 5 => 110, 6 => 322, 8 => 110, 10 => 139, 13 => 220, 21 => 139, 25 => 230, 28 => 220),
+        'font -' => array(6 => 322, 8 => 110, 13 => 220, 21 => 139, 25 => 220, 28 => 220),
+        'for' => array(0 => 350, 1 => 139, 2 => 337, 3 => 220, 4 => 337, 5 => 294, 6 => 139, 7 => 294, 8 => 220, 9 => 256, 10 => 314, 11 => 161, 12 => 248, 13 => 161, 14 => 220, 15 => 304, 20 => 361, 21 => 289, 22 => 326, 23 => 322, 24 => 110, 25 => 139, 26 => 230, 28 => 161),
+        'for (' => array(0 => 343, 2 => 220, 4 => 283, 5 => 256, 11 => 139, 14 => 220, 15 => 283, 20 => 220, 21 => 230, 24 => 69),
+        'for i' => array(2 => 110, 10 => 256, 22 => 256),
+        'for the' => array(0 => 264, 2 => 195, 4 => 240, 5 => 110, 7 => 283, 9 => 179, 10 => 220, 12 => 69, 13 => 69, 14 => 110, 15 => 240, 20 => 230, 21 => 110, 23 => 161, 25 => 69, 26 => 220, 28 => 69),
+        'foreach' => array(5 => 271, 20 => 322, 21 => 314, 24 => 110),
+        'foreach (' => array(5 => 271, 20 => 277, 21 => 314),
+        'form' => array(4 => 110, 5 => 208, 7 => 195, 10 => 110, 12 => 69, 13 => 208, 14 => 161, 15 => 264, 20 => 161, 21 => 69, 22 => 69, 23 => 161, 28 => 208),
+        'format' => array(0 => 161, 2 => 69, 4 => 69, 5 => 110, 7 => 110, 9 => 220, 14 => 69, 15 => 208, 16 => 220, 20 => 220, 21 => 161, 22 => 195, 23 => 230, 24 => 139, 26 => 220),
+        'fr' => array(0 => 139, 13 => 220, 28 => 220),
+        'from' => array(0 => 256, 2 => 240, 3 => 110, 4 => 248, 5 => 309, 6 => 69, 7 => 283, 8 => 139, 9 => 230, 10 => 110, 11 => 110, 12 => 69, 13 => 110, 14 => 220, 15 => 289, 20 => 318, 21 => 230, 22 => 195, 23 => 256, 26 => 208, 28 => 110),
+        'fromContent' => array(12 => 283),
+        'func' => array(4 => 69, 5 => 220, 10 => 322, 21 => 208, 22 => 208, 24 => 220),
+        'func (' => array(5 => 69, 10 => 283, 22 => 110, 24 => 110),
+        'function' => array(0 => 350, 1 => 195, 2 => 264, 4 => 110, 5 => 220, 6 => 69, 7 => 283, 9 => 240, 10 => 179, 12 => 220, 13 => 220, 14 => 220, 15 => 340, 18 => 69, 20 => 208, 21 => 361, 22 => 110, 24 => 230, 25 => 69, 28 => 220),
+        'function (' => array(9 => 208, 13 => 69, 15 => 340, 21 => 220, 24 => 195, 28 => 69),
+        'g' => array(0 => 230, 2 => 318, 5 => 208, 7 => 256, 12 => 195, 13 => 110, 14 => 110, 15 => 318, 20 => 300, 21 => 240, 22 => 139, 23 => 139, 24 => 69, 28 => 110),
+        'get' => array(0 => 161, 2 => 220, 4 => 208, 5 => 271, 9 => 161, 12 => 69, 14 => 220, 15 => 294, 20 => 300, 21 => 110, 22 => 161, 23 => 220, 24 => 110, 25 => 69, 26 => 69),
+        'get_value' => array(9 => 271),
+        'get_value (' => array(9 => 271),
+        'grammar' => array(7 => 161, 14 => 69, 21 => 283),
+        'h' => array(0 => 230, 2 => 248, 4 => 361, 5 => 195, 7 => 304, 9 => 69, 10 => 110, 13 => 139, 14 => 220, 15 => 110, 20 => 240, 21 => 289, 22 => 110, 23 => 220, 28 => 139),
+        'h "' => array(2 => 69, 4 => 350, 20 => 110),
+        'h >' => array(0 => 110, 2 => 179, 4 => 256, 7 => 271, 14 => 69, 21 => 69),
+        'has' => array(0 => 179, 2 => 161, 4 => 195, 5 => 69, 7 => 283, 9 => 110, 10 => 139, 12 => 195, 13 => 69, 14 => 220, 15 => 256, 20 => 264, 21 => 139, 23 => 69, 26 => 69, 28 => 69),
+        'have' => array(0 => 220, 1 => 69, 2 => 256, 4 => 256, 5 => 161, 6 => 110, 7 => 283, 8 => 69, 9 => 195, 12 => 195, 14 => 161, 15 => 230, 20 => 318, 21 => 195, 22 => 110, 23 => 110, 25 => 139, 26 => 69),
+        'head' => array(2 => 69, 8 => 69, 10 => 110, 12 => 230, 13 => 110, 15 => 264, 21 => 161, 23 => 277, 28 => 110),
+        'height' => array(0 => 294, 2 => 69, 4 => 69, 6 => 240, 8 => 69, 10 => 69, 13 => 283, 15 => 283, 21 => 230, 22 => 220, 23 => 69, 25 => 110, 28 => 283),
+        'height :' => array(0 => 248, 6 => 240, 13 => 179, 15 => 230, 21 => 139, 25 => 110, 28 => 179),
+        'height =' => array(0 => 220, 8 => 69, 10 => 69, 13 => 220, 15 => 110, 21 => 110, 22 => 220, 23 => 69, 28 => 220),
+        'height >' => array(0 => 139, 13 => 220, 28 => 220),
+        'hello' => array(8 => 139, 15 => 69, 16 => 240, 17 => 69, 18 => 110, 19 => 161, 21 => 179, 22 => 139, 24 => 110, 28 => 69),
+        'hello \\' => array(16 => 230, 17 => 69, 22 => 110),
+        'hidden' => array(6 => 139, 13 => 220, 15 => 271, 20 => 69, 23 => 161, 25 => 110, 28 => 220),
+        'hidden ;' => array(6 => 69, 13 => 220, 15 => 69, 23 => 69, 28 => 220),
+        'hr' => array(13 => 220, 15 => 69, 21 => 69, 23 => 69, 28 => 220),
+        'hr -' => array(13 => 220, 28 => 220),
+        'href' => array(5 => 161, 8 => 139, 11 => 179, 13 => 220, 15 => 283, 20 => 110, 21 => 264, 23 => 330, 28 => 220),
+        'href =' => array(5 => 161, 8 => 139, 13 => 220, 15 => 161, 20 => 110, 21 => 264, 23 => 330, 28 => 220),
+        'html' => array(0 => 139, 2 => 208, 7 => 161, 8 => 208, 9 => 69, 10 => 179, 11 => 179, 13 => 179, 15 => 283, 16 => 220, 20 => 161, 21 => 264, 23 => 283, 26 => 69, 28 => 179),
+        'html "' => array(2 => 69, 8 => 161, 10 => 69, 11 => 161, 13 => 110, 15 => 110, 16 => 220, 20 => 69, 21 => 110, 28 => 110),
+        'http' => array(0 => 240, 1 => 69, 2 => 230, 3 => 69, 4 => 110, 5 => 195, 6 => 110, 7 => 256, 9 => 110, 10 => 283, 11 => 110, 12 => 69, 13 => 220, 14 => 110, 15 => 283, 16 => 220, 20 => 326, 21 => 220, 22 => 110, 23 => 318, 24 => 110, 25 => 110, 26 => 110, 28 => 220),
+        'http .' => array(10 => 277),
+        'http :' => array(0 => 240, 1 => 69, 2 => 230, 3 => 69, 4 => 110, 5 => 195, 6 => 110, 7 => 256, 9 => 110, 10 => 139, 11 => 110, 12 => 69, 13 => 220, 14 => 110, 15 => 283, 16 => 220, 20 => 326, 21 => 208, 22 => 110, 23 => 294, 24 => 110, 25 => 110, 26 => 110, 28 => 220),
+        'i' => array(0 => 350, 2 => 294, 3 => 69, 4 => 289, 5 => 283, 7 => 256, 8 => 69, 10 => 322, 12 => 179, 13 => 161, 14 => 220, 15 => 333, 18 => 110, 20 => 322, 21 => 326, 22 => 322, 23 => 333, 24 => 220, 25 => 69, 26 => 110, 27 => 110, 28 => 161),
+        'i )' => array(0 => 314, 2 => 161, 4 => 69, 5 => 230, 10 => 240, 14 => 220, 15 => 294, 18 => 69, 20 => 230, 22 => 220, 23 => 110, 24 => 195),
+        'i +' => array(0 => 330, 2 => 220, 4 => 277, 5 => 240, 10 => 248, 12 => 110, 14 => 220, 15 => 283, 20 => 110, 21 => 220, 22 => 248, 23 => 69, 24 => 208),
+        'i ,' => array(0 => 139, 4 => 179, 10 => 69, 12 => 69, 14 => 139, 15 => 289, 20 => 161, 22 => 179, 23 => 264, 24 => 110),
+        'i :' => array(0 => 318, 2 => 139, 10 => 256, 15 => 69),
+        'i <' => array(0 => 330, 2 => 220, 4 => 277, 5 => 208, 10 => 230, 13 => 110, 14 => 220, 15 => 283, 20 => 110, 21 => 220, 22 => 110, 24 => 195, 28 => 110),
+        'i =' => array(0 => 322, 2 => 220, 4 => 277, 5 => 240, 14 => 220, 15 => 283, 20 => 161, 21 => 264, 22 => 69, 24 => 195),
+        'i ]' => array(0 => 322, 2 => 220, 4 => 283, 5 => 110, 10 => 195, 14 => 220, 15 => 294, 20 => 69, 21 => 240, 22 => 220, 23 => 240),
+        'id' => array(0 => 220, 2 => 220, 3 => 220, 8 => 195, 9 => 248, 10 => 69, 12 => 220, 13 => 220, 15 => 294, 16 => 220, 20 => 283, 21 => 322, 22 => 220, 23 => 343, 26 => 220, 28 => 220),
+        'id =' => array(2 => 220, 8 => 161, 9 => 179, 10 => 69, 13 => 220, 15 => 294, 16 => 220, 20 => 179, 21 => 283, 22 => 220, 23 => 309, 28 => 220),
+        'identifier' => array(3 => 161, 9 => 220, 12 => 230, 20 => 69, 21 => 110, 23 => 69),
+        'if' => array(0 => 350, 1 => 220, 2 => 353, 3 => 110, 4 => 371, 5 => 340, 7 => 366, 8 => 220, 9 => 240, 10 => 322, 11 => 139, 12 => 289, 13 => 220, 14 => 220, 15 => 333, 16 => 110, 17 => 69, 20 => 374, 21 => 361, 22 => 369, 23 => 361, 24 => 220, 28 => 220),
+        'if $' => array(17 => 69, 20 => 309, 23 => 256),
+        'if (' => array(0 => 350, 4 => 361, 5 => 337, 7 => 322, 10 => 69, 11 => 110, 12 => 179, 13 => 220, 14 => 220, 15 => 326, 20 => 371, 21 => 356, 23 => 139, 24 => 220, 28 => 220),
+        'if [' => array(2 => 314),
+        'if len' => array(10 => 248, 22 => 208),
+        'ifdef' => array(4 => 304, 20 => 110),
+        'image' => array(0 => 277, 4 => 220, 5 => 69, 6 => 230, 7 => 240, 8 => 139, 9 => 195, 13 => 69, 15 => 161, 20 => 220, 21 => 161, 22 => 139, 23 => 256, 26 => 161, 28 => 69),
+        'image :' => array(0 => 161, 6 => 230, 8 => 110, 15 => 69, 21 => 110),
+        'img' => array(0 => 220, 2 => 110, 6 => 240, 8 => 69, 9 => 69, 13 => 220, 15 => 69, 21 => 220, 23 => 264, 28 => 220),
+        'img src' => array(8 => 69, 13 => 220, 21 => 139, 23 => 161, 28 => 220),
+        'implementation' => array(2 => 161, 4 => 69, 5 => 220, 7 => 283, 10 => 110, 14 => 110, 15 => 69),
+        'import' => array(0 => 322, 7 => 110, 10 => 139, 11 => 110, 12 => 337, 13 => 139, 14 => 220, 20 => 195, 22 => 240, 24 => 220, 25 => 69, 28 => 139),
+        'import Data' => array(12 => 271),
+        'important' => array(0 => 69, 2 => 110, 4 => 110, 6 => 283, 7 => 283, 13 => 139, 15 => 69, 21 => 69, 25 => 208, 28 => 139),
+        'important ;' => array(6 => 283, 13 => 110, 25 => 208, 28 => 110),
+        'in' => array(0 => 337, 1 => 220, 2 => 309, 3 => 69, 4 => 318, 5 => 318, 6 => 161, 7 => 294, 8 => 220, 9 => 277, 10 => 195, 11 => 139, 12 => 289, 13 => 139, 14 => 220, 15 => 333, 16 => 179, 17 => 69, 19 => 69, 20 => 358, 21 => 326, 22 => 340, 23 => 366, 24 => 240, 25 => 179, 26 => 230, 28 => 139),
+        'in a' => array(0 => 179, 2 => 139, 4 => 110, 5 => 220, 6 => 69, 7 => 283, 9 => 139, 12 => 179, 14 => 161, 15 => 248, 16 => 161, 20 => 195, 21 => 139, 24 => 69, 26 => 179),
+        'in the' => array(0 => 314, 1 => 69, 2 => 179, 4 => 240, 5 => 256, 6 => 110, 7 => 294, 9 => 240, 10 => 110, 12 => 240, 14 => 220, 15 => 264, 20 => 322, 21 => 256, 22 => 139, 23 => 195, 25 => 69, 26 => 220),
+        'include' => array(2 => 230, 4 => 371, 7 => 343, 8 => 161, 9 => 139, 13 => 69, 14 => 69, 15 => 179, 20 => 248, 21 => 195, 23 => 304, 25 => 230, 28 => 69),
+        'include "' => array(2 => 69, 4 => 350, 7 => 161, 8 => 139, 9 => 69),
+        'include <' => array(2 => 179, 4 => 289, 7 => 271),
+        'index' => array(0 => 240, 2 => 69, 4 => 240, 5 => 248, 6 => 139, 7 => 256, 10 => 161, 12 => 69, 13 => 69, 14 => 220, 15 => 283, 20 => 110, 21 => 271, 23 => 264, 28 => 69),
+        'input' => array(4 => 69, 5 => 220, 12 => 161, 13 => 179, 14 => 220, 15 => 271, 16 => 161, 20 => 220, 21 => 264, 22 => 195, 23 => 283, 24 => 139, 28 => 179),
+        'instance' => array(4 => 139, 5 => 161, 7 => 283, 10 => 69, 12 => 322, 15 => 220, 21 => 69, 22 => 110),
+        'instance Xmlable' => array(12 => 277),
+        'int' => array(0 => 350, 2 => 195, 3 => 69, 4 => 333, 5 => 322, 7 => 161, 10 => 304, 11 => 69, 14 => 220, 20 => 161, 21 => 139, 22 => 277, 26 => 220),
+        'int (' => array(0 => 230, 10 => 110, 22 => 277, 26 => 220),
+        'int )' => array(0 => 289, 4 => 220, 5 => 195, 10 => 195, 14 => 220, 21 => 69, 22 => 161),
+        'int ,' => array(0 => 294, 4 => 69, 5 => 220, 10 => 230, 21 => 110, 22 => 69),
+        'int =' => array(0 => 350, 10 => 69),
+        'internal' => array(0 => 161, 4 => 195, 5 => 283, 7 => 110, 10 => 69, 14 => 161, 15 => 240, 16 => 69, 20 => 179, 21 => 230),
+        'into' => array(0 => 300, 2 => 240, 4 => 230, 5 => 208, 7 => 283, 9 => 161, 11 => 69, 12 => 139, 14 => 220, 15 => 220, 20 => 230, 21 => 161, 23 => 195, 24 => 69),
+        'io' => array(10 => 230, 13 => 110, 14 => 220, 24 => 230, 28 => 110),
+        'io .' => array(10 => 195, 13 => 69, 14 => 220, 24 => 230, 28 => 69),
+        'is' => array(0 => 330, 1 => 220, 2 => 304, 3 => 69, 4 => 343, 5 => 289, 6 => 195, 7 => 304, 8 => 220, 9 => 248, 10 => 240, 11 => 139, 12 => 271, 13 => 179, 14 => 220, 15 => 326, 16 => 195, 19 => 161, 20 => 361, 21 => 340, 22 => 361, 23 => 364, 24 => 208, 25 => 179, 26 => 208, 27 => 139, 28 => 161),
+        'is a' => array(0 => 179, 2 => 161, 4 => 195, 7 => 283, 8 => 110, 9 => 69, 10 => 139, 11 => 69, 12 => 69, 14 => 110, 15 => 240, 19 => 139, 20 => 289, 21 => 195, 22 => 220, 23 => 283, 24 => 139, 27 => 110),
+        'is not' => array(0 => 69, 2 => 110, 4 => 69, 5 => 139, 7 => 240, 8 => 69, 10 => 69, 12 => 161, 13 => 69, 14 => 69, 15 => 161, 19 => 69, 20 => 230, 21 => 69, 22 => 277, 26 => 69),
+        'is the' => array(0 => 69, 4 => 110, 5 => 110, 7 => 271, 10 => 69, 12 => 69, 15 => 110, 20 => 289, 21 => 139, 22 => 110, 23 => 248, 25 => 69, 26 => 110),
+        'it' => array(0 => 271, 1 => 139, 2 => 256, 4 => 353, 5 => 110, 6 => 208, 7 => 304, 8 => 69, 9 => 110, 10 => 161, 11 => 195, 12 => 240, 13 => 230, 14 => 220, 15 => 277, 20 => 333, 21 => 294, 22 => 248, 23 => 289, 24 => 110, 25 => 179, 26 => 139, 28 => 220),
+        'item' => array(0 => 195, 5 => 294, 7 => 256, 8 => 139, 13 => 220, 15 => 283, 20 => 283, 22 => 110, 23 => 110, 28 => 220),
+        'item >' => array(13 => 220, 28 => 220),
+        'items' => array(0 => 69, 5 => 220, 8 => 69, 15 => 230, 22 => 220, 24 => 195),
+        'its' => array(0 => 69, 2 => 139, 4 => 208, 5 => 220, 7 => 283, 14 => 161, 15 => 220, 20 => 208, 21 => 240, 22 => 69, 23 => 69),
+        'j' => array(0 => 304, 2 => 220, 4 => 220, 7 => 161, 8 => 69, 13 => 139, 14 => 220, 15 => 283, 22 => 220, 23 => 220, 26 => 110, 28 => 139),
+        'ja' => array(13 => 220, 28 => 220),
+        'java' => array(14 => 220, 15 => 69, 20 => 110, 21 => 139, 24 => 256),
+        'java .' => array(14 => 220, 21 => 69, 24 => 256),
+        'javascript' => array(2 => 110, 8 => 69, 10 => 69, 15 => 283, 16 => 139, 21 => 264, 23 => 195),
+        'join' => array(0 => 110, 9 => 208, 15 => 283, 20 => 294, 21 => 69, 22 => 195, 23 => 294, 24 => 69),
+        'join (' => array(0 => 110, 9 => 208, 15 => 283, 20 => 220, 21 => 69, 22 => 195, 23 => 283, 24 => 69),
+        'k' => array(0 => 309, 2 => 139, 5 => 110, 10 => 110, 12 => 220, 13 => 195, 14 => 220, 15 => 264, 21 => 240, 24 => 110, 28 => 195),
+        'key' => array(2 => 69, 4 => 69, 5 => 256, 6 => 69, 7 => 161, 8 => 110, 9 => 110, 10 => 110, 12 => 208, 15 => 289, 20 => 230, 21 => 110, 24 => 110),
+        'keys' => array(4 => 69, 5 => 220, 7 => 195, 14 => 208, 15 => 220, 20 => 318, 21 => 69, 22 => 110),
+        'l' => array(0 => 230, 2 => 139, 4 => 69, 10 => 230, 13 => 208, 14 => 220, 15 => 283, 20 => 69, 21 => 300, 22 => 179, 23 => 318, 24 => 220, 26 => 69, 28 => 208),
+        'lang' => array(13 => 220, 14 => 220, 20 => 240, 21 => 69, 23 => 230, 24 => 69, 25 => 69, 28 => 220),
+        'lang =' => array(13 => 220, 20 => 230, 23 => 179, 28 => 220),
+        'language' => array(0 => 110, 2 => 69, 4 => 220, 7 => 283, 9 => 139, 12 => 69, 13 => 220, 20 => 220, 21 => 289, 26 => 69, 28 => 220),
+        'languages' => array(7 => 283, 13 => 110, 20 => 208, 21 => 220, 22 => 69, 28 => 110),
+        'last' => array(0 => 248, 3 => 69, 4 => 139, 5 => 220, 7 => 161, 9 => 110, 14 => 139, 15 => 283, 20 => 277, 23 => 289),
+        'left' => array(0 => 256, 4 => 230, 5 => 69, 6 => 283, 7 => 240, 10 => 69, 12 => 110, 13 => 220, 15 => 289, 21 => 230, 23 => 179, 25 => 264, 28 => 220),
+        'left :' => array(0 => 69, 6 => 277, 7 => 161, 13 => 220, 15 => 256, 21 => 139, 23 => 69, 25 => 230, 28 => 220),
+        'len' => array(0 => 69, 2 => 161, 4 => 240, 5 => 220, 10 => 283, 15 => 139, 17 => 110, 22 => 309, 24 => 161),
+        'len (' => array(10 => 283, 22 => 309),
+        'length' => array(0 => 314, 4 => 110, 5 => 220, 8 => 110, 9 => 208, 12 => 139, 14 => 220, 15 => 300, 20 => 195, 21 => 220, 22 => 248, 23 => 248, 24 => 195, 26 => 220),
+        'length ;' => array(0 => 283, 14 => 220, 15 => 283),
+        'li' => array(8 => 220, 13 => 110, 16 => 220, 21 => 161, 23 => 304, 25 => 179, 28 => 110),
+        'li >' => array(8 => 220, 16 => 220, 21 => 161, 23 => 289),
+        'library' => array(0 => 110, 2 => 139, 4 => 179, 7 => 337, 15 => 69, 20 => 69, 23 => 69),
+        'like' => array(0 => 110, 2 => 195, 4 => 110, 6 => 69, 7 => 283, 14 => 69, 15 => 256, 20 => 264, 21 => 220, 23 => 110),
+        'line' => array(0 => 264, 2 => 139, 3 => 161, 6 => 220, 7 => 240, 10 => 110, 11 => 139, 13 => 69, 14 => 220, 19 => 110, 20 => 304, 21 => 318, 22 => 179, 23 => 300, 25 => 220, 27 => 69, 28 => 69),
+        'line -' => array(3 => 161, 6 => 139, 13 => 69, 14 => 110, 20 => 110, 21 => 69, 22 => 69, 25 => 220, 28 => 69),
+        'lines' => array(0 => 220, 6 => 69, 7 => 110, 11 => 139, 14 => 110, 15 => 69, 20 => 283, 21 => 289, 22 => 208, 23 => 230, 25 => 110),
+        'link' => array(0 => 220, 2 => 69, 4 => 220, 6 => 208, 7 => 110, 13 => 208, 15 => 271, 20 => 179, 21 => 277, 23 => 277, 25 => 69, 28 => 208),
+        'link rel' => array(13 => 195, 21 => 208, 23 => 179, 28 => 195),
+        'list' => array(2 => 161, 3 => 161, 4 => 230, 5 => 256, 7 => 283, 8 => 139, 9 => 271, 10 => 110, 12 => 139, 14 => 69, 15 => 283, 20 => 289, 21 => 283, 22 => 256, 23 => 179, 25 => 110),
+        'lists' => array(4 => 208, 5 => 110, 7 => 195, 9 => 283, 12 => 110, 21 => 69, 23 => 161),
+        'lists :' => array(9 => 283),
+        'local' => array(2 => 283, 4 => 69, 7 => 195, 15 => 256, 20 => 264, 22 => 208),
+        'logo' => array(13 => 220, 23 => 69, 28 => 220),
+        'logo .' => array(13 => 220, 23 => 69, 28 => 220),
+        'lt' => array(2 => 69, 13 => 220, 15 => 110, 16 => 139, 20 => 220, 21 => 139, 23 => 179, 28 => 220),
+        'luminous' => array(2 => 220, 6 => 289, 21 => 256, 25 => 110),
+        'luminous .' => array(2 => 179, 6 => 283, 21 => 230, 25 => 69),
+        'm' => array(0 => 264, 2 => 256, 4 => 220, 5 => 220, 9 => 139, 10 => 161, 13 => 139, 14 => 179, 15 => 283, 20 => 326, 21 => 230, 22 => 248, 23 => 240, 26 => 220, 28 => 139),
+        'makeToContent' => array(12 => 277),
+        'map' => array(2 => 110, 4 => 179, 5 => 69, 7 => 283, 9 => 208, 10 => 110, 12 => 277, 13 => 110, 14 => 220, 15 => 283, 20 => 240, 23 => 195, 24 => 179, 28 => 110),
+        'map (' => array(9 => 208, 12 => 230, 14 => 110, 15 => 283, 23 => 139, 24 => 110),
+        'margin' => array(0 => 220, 6 => 271, 13 => 240, 15 => 271, 21 => 208, 23 => 69, 25 => 256, 28 => 240),
+        'margin -' => array(6 => 220, 13 => 220, 15 => 110, 21 => 208, 23 => 69, 25 => 139, 28 => 220),
+        'margin :' => array(0 => 195, 6 => 220, 13 => 220, 15 => 195, 25 => 208, 28 => 220),
+        'match' => array(0 => 220, 8 => 139, 9 => 110, 10 => 161, 13 => 139, 15 => 294, 20 => 248, 21 => 220, 23 => 283, 28 => 139),
+        'matches' => array(0 => 69, 8 => 69, 14 => 69, 15 => 220, 20 => 220, 21 => 322, 23 => 110),
+        'matches [' => array(15 => 139, 20 => 161, 21 => 322),
+        'max' => array(0 => 161, 5 => 220, 6 => 195, 13 => 110, 15 => 271, 20 => 283, 21 => 139, 22 => 110, 25 => 69, 28 => 110),
+        'may' => array(0 => 161, 2 => 179, 4 => 69, 5 => 179, 7 => 195, 9 => 110, 12 => 220, 14 => 161, 15 => 208, 20 => 271, 21 => 256, 22 => 69, 23 => 110),
+        'meta' => array(5 => 110, 13 => 220, 15 => 110, 16 => 195, 20 => 277, 21 => 69, 23 => 208, 28 => 220),
+        'meta .' => array(13 => 220, 20 => 161, 28 => 220),
+        'meta name' => array(13 => 220, 23 => 139, 28 => 220),
+        'method' => array(0 => 230, 2 => 110, 5 => 195, 7 => 283, 10 => 220, 11 => 69, 12 => 110, 14 => 69, 15 => 283, 20 => 208, 21 => 139, 22 => 69, 23 => 264),
+        'min' => array(0 => 69, 2 => 161, 5 => 220, 6 => 208, 13 => 110, 15 => 220, 20 => 110, 21 => 220, 25 => 69, 28 => 110),
+        'mod' => array(17 => 220, 23 => 161),
+        'mode' => array(0 => 283, 2 => 240, 4 => 220, 15 => 179, 21 => 69, 23 => 248),
+        'more' => array(0 => 139, 1 => 69, 2 => 161, 3 => 139, 4 => 161, 5 => 195, 6 => 110, 7 => 283, 9 => 69, 10 => 69, 12 => 110, 14 => 220, 15 => 110, 20 => 300, 21 => 230, 22 => 110, 23 => 139, 25 => 69),
+        'multiple' => array(0 => 139, 7 => 195, 9 => 139, 14 => 69, 15 => 230, 16 => 220, 20 => 240),
+        'my' => array(4 => 220, 13 => 139, 14 => 110, 20 => 378, 26 => 69, 28 => 139),
+        'my $' => array(20 => 378),
+        'my (' => array(20 => 361),
+        'my @' => array(20 => 337),
+        'n' => array(0 => 309, 2 => 330, 4 => 289, 5 => 283, 9 => 110, 10 => 322, 11 => 110, 12 => 283, 13 => 220, 14 => 220, 15 => 283, 16 => 240, 20 => 371, 21 => 333, 22 => 277, 23 => 277, 24 => 230, 25 => 69, 26 => 139, 28 => 220),
+        'n "' => array(0 => 220, 2 => 300, 4 => 283, 9 => 69, 10 => 271, 12 => 220, 13 => 110, 14 => 161, 15 => 69, 20 => 371, 21 => 309, 22 => 69, 23 => 264, 24 => 208, 28 => 110),
+        'n *' => array(2 => 220, 5 => 220, 10 => 220, 20 => 69, 21 => 195, 23 => 69),
+        'n <' => array(0 => 110, 5 => 110, 13 => 161, 14 => 110, 15 => 69, 16 => 220, 21 => 139, 23 => 69, 28 => 161),
+        'name' => array(0 => 220, 2 => 179, 3 => 230, 4 => 271, 5 => 309, 7 => 220, 8 => 179, 9 => 240, 10 => 230, 11 => 179, 12 => 271, 13 => 283, 14 => 220, 15 => 289, 19 => 69, 20 => 333, 21 => 318, 22 => 220, 23 => 337, 24 => 220, 26 => 161, 28 => 283),
+        'name )' => array(0 => 161, 4 => 230, 5 => 110, 9 => 220, 10 => 69, 14 => 179, 15 => 283, 20 => 110, 21 => 110, 22 => 195, 23 => 179, 24 => 139),
+        'name ,' => array(2 => 110, 4 => 220, 5 => 195, 10 => 110, 12 => 139, 14 => 69, 15 => 283, 19 => 69, 20 => 161, 21 => 161, 22 => 220, 23 => 139, 24 => 195),
+        'name =' => array(0 => 220, 4 => 139, 5 => 195, 8 => 69, 9 => 161, 11 => 69, 12 => 69, 13 => 283, 14 => 139, 15 => 283, 20 => 179, 21 => 161, 22 => 220, 23 => 283, 28 => 283),
+        'nbsp' => array(13 => 220, 21 => 139, 28 => 220),
+        'nbsp ;' => array(13 => 220, 21 => 139, 28 => 220),
+        'new' => array(0 => 347, 1 => 110, 2 => 139, 4 => 277, 5 => 333, 7 => 283, 9 => 195, 10 => 110, 11 => 230, 12 => 139, 13 => 139, 14 => 220, 15 => 283, 20 => 314, 21 => 271, 22 => 110, 23 => 333, 24 => 283, 26 => 110, 28 => 139),
+        'new (' => array(9 => 110, 10 => 69, 20 => 271, 23 => 277),
+        'new Array' => array(0 => 322, 15 => 110, 24 => 110),
+        'next' => array(0 => 322, 4 => 110, 5 => 161, 14 => 220, 15 => 283, 20 => 322, 21 => 220, 23 => 208, 24 => 110, 27 => 69),
+        'nil' => array(2 => 110, 10 => 318, 15 => 139, 20 => 139, 23 => 294),
+        'nil {' => array(10 => 283),
+        'nl' => array(0 => 220, 2 => 69, 3 => 220, 4 => 69, 9 => 161, 10 => 139, 13 => 220, 14 => 69, 28 => 220),
+        'no' => array(0 => 220, 2 => 271, 3 => 69, 4 => 139, 5 => 195, 6 => 69, 7 => 256, 8 => 179, 10 => 110, 11 => 69, 12 => 195, 13 => 195, 14 => 220, 15 => 264, 16 => 69, 20 => 314, 21 => 256, 22 => 161, 23 => 240, 25 => 220, 28 => 195),
+        'node' => array(4 => 220, 5 => 220, 10 => 110, 12 => 220, 14 => 69, 15 => 283, 22 => 271),
+        'nodeType' => array(12 => 220, 15 => 283, 22 => 220),
+        'nodes' => array(4 => 179, 5 => 139, 12 => 220, 14 => 69, 15 => 283, 22 => 230),
+        'none' => array(0 => 69, 2 => 179, 6 => 230, 9 => 271, 13 => 161, 14 => 110, 15 => 230, 20 => 110, 21 => 161, 23 => 139, 25 => 208, 28 => 161),
+        'normal' => array(2 => 69, 4 => 161, 6 => 248, 7 => 161, 9 => 69, 13 => 110, 15 => 139, 20 => 69, 23 => 69, 25 => 69, 28 => 110),
+        'normal ;' => array(6 => 230, 25 => 69),
+        'not' => array(0 => 240, 1 => 69, 2 => 283, 3 => 69, 4 => 289, 5 => 240, 6 => 110, 7 => 294, 8 => 195, 9 => 220, 10 => 195, 12 => 256, 13 => 110, 14 => 220, 15 => 289, 16 => 69, 17 => 69, 19 => 69, 20 => 337, 21 => 294, 22 => 337, 23 => 230, 24 => 69, 25 => 69, 26 => 110, 27 => 69, 28 => 110),
+        'now' => array(0 => 110, 2 => 195, 4 => 240, 5 => 139, 7 => 220, 8 => 69, 9 => 161, 10 => 69, 12 => 110, 14 => 220, 15 => 289, 20 => 161, 21 => 110, 22 => 69, 23 => 240, 24 => 139),
+        'nss' => array(12 => 271),
+        'null' => array(0 => 277, 2 => 230, 5 => 330, 9 => 69, 10 => 69, 11 => 179, 12 => 208, 14 => 220, 15 => 283, 16 => 161, 20 => 139, 21 => 314, 24 => 69),
+        'null )' => array(0 => 230, 5 => 309, 11 => 69, 12 => 110, 14 => 110, 15 => 283, 21 => 277),
+        'null ,' => array(0 => 220, 5 => 256, 10 => 69, 15 => 283, 16 => 110, 21 => 139),
+        'null ;' => array(0 => 208, 2 => 69, 5 => 283, 14 => 220, 15 => 283, 21 => 271),
+        'num' => array(0 => 139, 3 => 110, 5 => 220, 15 => 220, 21 => 248, 22 => 161, 23 => 179),
+        'number' => array(0 => 271, 2 => 110, 3 => 110, 4 => 139, 5 => 220, 7 => 283, 10 => 69, 13 => 220, 14 => 195, 15 => 283, 16 => 110, 20 => 314, 21 => 110, 22 => 179, 25 => 69, 28 => 220),
+        'number >' => array(0 => 69, 13 => 220, 28 => 220),
+        'number of' => array(0 => 271, 4 => 69, 5 => 195, 7 => 283, 10 => 69, 14 => 69, 15 => 161, 20 => 277, 21 => 69, 22 => 110),
+        'o' => array(0 => 230, 2 => 283, 5 => 208, 8 => 179, 14 => 220, 15 => 240, 20 => 110, 21 => 240, 22 => 69, 23 => 264, 25 => 110),
+        'object' => array(0 => 220, 2 => 69, 4 => 69, 5 => 277, 7 => 283, 14 => 139, 15 => 283, 20 => 110, 21 => 139, 22 => 220, 23 => 69, 24 => 220),
+        'of' => array(0 => 326, 1 => 179, 2 => 304, 3 => 69, 4 => 343, 5 => 289, 6 => 248, 7 => 283, 8 => 139, 9 => 283, 10 => 220, 11 => 69, 12 => 314, 13 => 220, 14 => 220, 15 => 333, 20 => 353, 21 => 322, 22 => 330, 23 => 353, 24 => 69, 25 => 220, 26 => 230, 28 => 220),
+        'of [' => array(9 => 271, 12 => 179),
+        'of a' => array(0 => 179, 4 => 139, 5 => 230, 7 => 283, 9 => 110, 12 => 139, 14 => 161, 15 => 110, 20 => 256, 21 => 220, 23 => 139, 26 => 110),
+        'of the' => array(0 => 283, 1 => 110, 2 => 161, 3 => 69, 4 => 289, 5 => 283, 6 => 195, 7 => 283, 9 => 220, 10 => 110, 12 => 230, 14 => 220, 15 => 248, 20 => 309, 21 => 277, 22 => 264, 23 => 240, 25 => 161, 26 => 220),
+        'of true' => array(9 => 271, 15 => 69),
+        'offset' => array(0 => 110, 2 => 110, 14 => 69, 15 => 304, 21 => 220, 22 => 220),
+        'ok' => array(2 => 161, 4 => 69, 9 => 283, 10 => 256, 14 => 69, 20 => 139),
+        'ok ,' => array(2 => 69, 9 => 283, 10 => 110, 14 => 69),
+        'on' => array(0 => 256, 2 => 271, 3 => 69, 4 => 240, 5 => 256, 6 => 110, 7 => 283, 8 => 69, 9 => 240, 11 => 110, 12 => 220, 14 => 220, 15 => 289, 20 => 314, 21 => 248, 22 => 139, 23 => 309, 26 => 230),
+        'one' => array(0 => 240, 2 => 230, 4 => 161, 5 => 277, 7 => 283, 12 => 110, 13 => 110, 14 => 208, 15 => 271, 16 => 139, 20 => 283, 21 => 195, 22 => 69, 23 => 195, 28 => 110),
+        'only' => array(0 => 195, 2 => 220, 4 => 208, 5 => 179, 6 => 69, 7 => 283, 8 => 69, 9 => 195, 11 => 69, 12 => 161, 14 => 195, 15 => 248, 20 => 314, 21 => 179, 23 => 139, 24 => 69),
+        'opt' => array(3 => 248, 15 => 240, 23 => 179),
+        'opt -' => array(3 => 240),
+        'option' => array(1 => 69, 2 => 139, 4 => 161, 6 => 110, 12 => 69, 13 => 220, 15 => 283, 20 => 256, 21 => 110, 22 => 110, 23 => 240, 25 => 69, 28 => 220),
+        'option >' => array(13 => 220, 15 => 69, 28 => 220),
+        'option value' => array(13 => 220, 15 => 69, 28 => 220),
+        'optional' => array(2 => 110, 7 => 240, 8 => 69, 14 => 110, 16 => 220, 20 => 195, 23 => 230),
+        'options' => array(2 => 179, 4 => 220, 14 => 110, 15 => 283, 20 => 304, 21 => 69, 22 => 69, 23 => 220),
+        'or' => array(0 => 283, 1 => 161, 2 => 256, 3 => 139, 4 => 300, 5 => 277, 6 => 208, 7 => 283, 8 => 179, 9 => 179, 10 => 69, 12 => 208, 13 => 110, 14 => 220, 15 => 289, 20 => 347, 21 => 304, 22 => 318, 23 => 294, 24 => 110, 25 => 139, 28 => 110),
+        'org' => array(0 => 271, 1 => 69, 2 => 220, 4 => 110, 5 => 69, 6 => 110, 7 => 283, 9 => 69, 11 => 139, 12 => 69, 13 => 220, 14 => 69, 15 => 248, 16 => 220, 20 => 264, 21 => 110, 22 => 110, 23 => 220, 25 => 69, 28 => 220),
+        'org -' => array(13 => 220, 28 => 220),
+        'org .' => array(0 => 256, 7 => 283, 11 => 69),
+        'org /' => array(0 => 161, 1 => 69, 2 => 220, 4 => 110, 6 => 110, 7 => 256, 9 => 69, 11 => 110, 12 => 69, 13 => 220, 14 => 69, 15 => 230, 16 => 220, 20 => 256, 21 => 110, 22 => 110, 23 => 220, 25 => 69, 28 => 220),
+        'os' => array(10 => 248, 13 => 110, 28 => 110),
+        'otherwise' => array(0 => 69, 2 => 69, 12 => 271, 14 => 161, 15 => 179, 20 => 208, 21 => 69, 23 => 69, 25 => 69),
+        'out' => array(0 => 195, 1 => 161, 2 => 139, 4 => 195, 5 => 161, 6 => 110, 7 => 161, 14 => 220, 15 => 240, 20 => 283, 21 => 230, 22 => 110, 23 => 240, 24 => 208, 25 => 69),
+        'output' => array(0 => 208, 2 => 69, 4 => 69, 7 => 220, 12 => 110, 14 => 220, 20 => 264, 21 => 264, 23 => 230),
+        'overflow' => array(5 => 220, 6 => 195, 13 => 220, 15 => 230, 25 => 161, 28 => 220),
+        'overflow :' => array(6 => 195, 13 => 220, 25 => 110, 28 => 220),
+        'override' => array(2 => 240, 5 => 139, 6 => 69, 15 => 220, 20 => 139, 24 => 230),
+        'p' => array(0 => 277, 2 => 248, 7 => 161, 8 => 139, 9 => 220, 10 => 240, 13 => 161, 14 => 220, 15 => 283, 16 => 230, 20 => 179, 21 => 240, 22 => 69, 23 => 318, 26 => 69, 28 => 161),
+        'p "' => array(2 => 230, 9 => 208, 10 => 69, 16 => 195, 20 => 110, 23 => 69),
+        'p .' => array(0 => 220, 7 => 161, 10 => 220, 14 => 220, 16 => 208),
+        'p >' => array(0 => 195, 8 => 110, 15 => 110, 16 => 220, 21 => 110, 23 => 256),
+        'package' => array(0 => 161, 1 => 69, 2 => 230, 7 => 161, 10 => 195, 11 => 161, 14 => 179, 20 => 230, 21 => 69, 24 => 139),
+        'padding' => array(6 => 283, 13 => 220, 15 => 240, 21 => 161, 23 => 179, 25 => 240, 28 => 220),
+        'padding -' => array(6 => 283, 15 => 69, 21 => 139, 23 => 110, 25 => 208),
+        'padding :' => array(6 => 208, 13 => 220, 15 => 179, 21 => 69, 23 => 139, 25 => 220, 28 => 220),
+        'param' => array(0 => 300, 5 => 161, 14 => 220, 15 => 248, 20 => 230, 21 => 283, 22 => 220, 23 => 69),
+        'parent' => array(0 => 220, 2 => 69, 4 => 240, 5 => 161, 10 => 69, 15 => 304, 21 => 69, 22 => 248, 23 => 139),
+        'parse' => array(2 => 69, 9 => 220, 10 => 179, 11 => 139, 14 => 69, 15 => 264, 21 => 208, 22 => 110, 23 => 69),
+        'parser' => array(0 => 69, 11 => 179, 12 => 69, 14 => 220, 15 => 230, 21 => 230, 23 => 69),
+        'part' => array(0 => 179, 2 => 161, 3 => 220, 4 => 110, 6 => 110, 7 => 283, 12 => 110, 14 => 110, 15 => 283, 20 => 248, 21 => 110, 23 => 69, 25 => 69),
+        'path' => array(0 => 69, 2 => 220, 4 => 195, 8 => 69, 10 => 283, 15 => 208, 20 => 294, 21 => 220, 22 => 161, 23 => 139),
+        'php' => array(0 => 179, 2 => 161, 13 => 69, 15 => 139, 20 => 230, 21 => 347, 28 => 69),
+        'php \'' => array(21 => 283),
+        'pl' => array(2 => 69, 10 => 208, 13 => 220, 20 => 240, 21 => 69, 23 => 110, 28 => 220),
+        'png' => array(6 => 230, 7 => 195, 8 => 110, 10 => 69, 13 => 240, 21 => 161, 23 => 179, 28 => 240),
+        'png "' => array(7 => 195, 8 => 69, 10 => 69, 13 => 220, 21 => 110, 28 => 220),
+        'position' => array(0 => 230, 4 => 161, 5 => 139, 6 => 220, 9 => 69, 13 => 220, 15 => 289, 20 => 179, 21 => 179, 25 => 110, 28 => 220),
+        'position :' => array(0 => 139, 6 => 220, 13 => 220, 15 => 195, 21 => 179, 25 => 110, 28 => 220),
+        'pre' => array(0 => 220, 6 => 208, 7 => 161, 9 => 110, 15 => 69, 16 => 220, 21 => 271, 23 => 230, 25 => 139),
+        'prefix' => array(2 => 220, 4 => 110, 7 => 195, 15 => 230, 20 => 283, 23 => 230, 24 => 139, 25 => 220),
+        'print' => array(0 => 179, 2 => 161, 6 => 110, 7 => 110, 8 => 179, 9 => 69, 11 => 69, 13 => 69, 14 => 220, 20 => 356, 21 => 139, 22 => 283, 23 => 340, 28 => 69),
+        'print "' => array(8 => 69, 11 => 69, 13 => 69, 20 => 314, 22 => 240, 23 => 248, 28 => 69),
+        'println' => array(0 => 161, 11 => 248, 14 => 220, 24 => 220),
+        'println (' => array(0 => 161, 11 => 139, 14 => 220, 24 => 220),
+        'private' => array(0 => 337, 5 => 318, 14 => 220, 15 => 69, 20 => 230, 21 => 264, 23 => 208, 24 => 220),
+        'private static' => array(0 => 322, 5 => 248, 14 => 220),
+        'program' => array(0 => 110, 1 => 69, 2 => 179, 3 => 110, 4 => 195, 5 => 69, 7 => 283, 20 => 248, 22 => 195, 23 => 208),
+        'project' => array(2 => 110, 7 => 271, 13 => 139, 20 => 139, 23 => 240, 28 => 139),
+        'property' => array(4 => 69, 5 => 69, 9 => 139, 13 => 220, 15 => 283, 22 => 110, 25 => 139, 28 => 220),
+        'property >' => array(13 => 220, 28 => 220),
+        'property name' => array(13 => 220, 28 => 220),
+        'proplists' => array(9 => 283),
+        'proplists :' => array(9 => 283),
+        'protected' => array(0 => 220, 5 => 314, 15 => 161, 20 => 240, 21 => 69),
+        'pt' => array(6 => 69, 10 => 139, 13 => 220, 17 => 110, 28 => 220),
+        'public' => array(0 => 326, 2 => 161, 3 => 110, 5 => 294, 7 => 110, 11 => 69, 14 => 220, 20 => 208, 21 => 271, 23 => 69, 24 => 110),
+        'push' => array(0 => 220, 14 => 139, 15 => 283, 20 => 314, 23 => 69),
+        'px' => array(0 => 139, 6 => 289, 13 => 220, 15 => 283, 21 => 230, 23 => 240, 25 => 248, 28 => 220),
+        'px -' => array(0 => 69, 13 => 220, 28 => 220),
+        'px ;' => array(6 => 283, 13 => 220, 15 => 179, 21 => 110, 23 => 161, 25 => 179, 28 => 220),
+        'px solid' => array(6 => 248, 13 => 69, 15 => 110, 21 => 69, 23 => 69, 25 => 69, 28 => 69),
+        'q' => array(0 => 195, 2 => 240, 9 => 248, 10 => 161, 15 => 208, 20 => 69, 23 => 230),
+        'r' => array(0 => 240, 2 => 220, 4 => 271, 5 => 110, 7 => 195, 9 => 139, 10 => 271, 13 => 161, 14 => 220, 15 => 256, 20 => 195, 21 => 277, 22 => 139, 23 => 271, 26 => 139, 28 => 161),
+        'radius' => array(0 => 220, 6 => 139, 21 => 195, 22 => 220, 25 => 230),
+        'rel' => array(13 => 195, 21 => 208, 23 => 195, 28 => 195),
+        'rel =' => array(13 => 195, 21 => 208, 23 => 195, 28 => 195),
+        'relative' => array(4 => 139, 6 => 139, 13 => 195, 15 => 277, 20 => 69, 21 => 161, 22 => 161, 25 => 69, 28 => 195),
+        'req' => array(4 => 220, 10 => 283),
+        'req .' => array(10 => 248),
+        'result' => array(0 => 248, 2 => 69, 4 => 110, 5 => 283, 7 => 195, 9 => 69, 12 => 220, 14 => 195, 15 => 283, 20 => 289, 22 => 220, 23 => 69),
+        'ret' => array(4 => 110, 5 => 139, 7 => 283, 10 => 139, 15 => 220, 23 => 179, 24 => 195),
+        'return' => array(0 => 343, 1 => 220, 2 => 256, 3 => 110, 4 => 356, 5 => 314, 7 => 337, 10 => 322, 11 => 69, 12 => 283, 13 => 195, 14 => 220, 15 => 304, 20 => 361, 21 => 361, 22 => 304, 23 => 161, 28 => 195),
+        'return "' => array(0 => 69, 1 => 161, 2 => 69, 10 => 195, 12 => 69, 14 => 139, 15 => 220, 20 => 110, 21 => 248),
+        'return $' => array(4 => 69, 12 => 283, 20 => 326, 21 => 330),
+        'return (' => array(0 => 110, 4 => 110, 5 => 248, 10 => 69, 12 => 139, 14 => 220, 15 => 283, 20 => 208, 22 => 69),
+        'return ;' => array(0 => 240, 1 => 110, 2 => 161, 4 => 289, 5 => 139, 10 => 110, 13 => 161, 14 => 220, 15 => 289, 20 => 248, 21 => 161, 28 => 161),
+        'return false' => array(5 => 139, 10 => 220, 14 => 220, 15 => 289, 23 => 69),
+        'revision' => array(2 => 208, 7 => 304, 20 => 220, 22 => 208, 26 => 195),
+        'right' => array(0 => 220, 2 => 230, 4 => 240, 5 => 69, 6 => 256, 7 => 240, 10 => 69, 13 => 179, 15 => 230, 20 => 161, 21 => 179, 23 => 230, 25 => 110, 26 => 69, 28 => 179),
+        'right :' => array(0 => 69, 6 => 248, 7 => 110, 13 => 179, 15 => 110, 21 => 110, 23 => 69, 25 => 69, 28 => 179),
+        'ro' => array(2 => 110, 13 => 220, 28 => 220),
+        'row' => array(0 => 318, 4 => 220, 9 => 208, 14 => 161, 15 => 69, 20 => 110, 21 => 139, 23 => 220),
+        'rtl' => array(13 => 220, 28 => 220),
+        'rtl "' => array(13 => 220, 28 => 220),
+        'ru' => array(13 => 220, 28 => 220),
+        'rule' => array(0 => 179, 3 => 179, 7 => 161, 14 => 220, 15 => 195, 20 => 139, 21 => 220, 23 => 264),
+        's' => array(0 => 256, 2 => 333, 4 => 343, 5 => 283, 7 => 304, 8 => 69, 9 => 69, 10 => 283, 11 => 69, 12 => 230, 13 => 220, 14 => 220, 15 => 294, 16 => 69, 20 => 389, 21 => 337, 22 => 309, 23 => 337, 24 => 208, 25 => 69, 26 => 220, 28 => 220),
+        's )' => array(0 => 179, 4 => 69, 5 => 179, 10 => 230, 12 => 161, 14 => 110, 15 => 220, 20 => 179, 21 => 248, 22 => 195, 23 => 161),
+        's *' => array(2 => 110, 4 => 110, 10 => 220, 14 => 69, 15 => 294, 20 => 271, 21 => 110, 23 => 271),
+        's +' => array(0 => 220, 4 => 69, 10 => 161, 15 => 256, 20 => 248, 21 => 110, 23 => 264),
+        's .' => array(0 => 220, 2 => 161, 4 => 248, 5 => 220, 10 => 220, 14 => 161, 15 => 220, 21 => 69, 22 => 69, 23 => 69),
+        's /' => array(2 => 314, 4 => 69, 5 => 69, 10 => 110, 15 => 110, 20 => 343, 23 => 179, 24 => 69),
+        's =' => array(0 => 179, 4 => 69, 10 => 139, 11 => 69, 12 => 179, 14 => 139, 15 => 110, 21 => 230, 22 => 256),
+        'script' => array(0 => 139, 2 => 248, 8 => 161, 10 => 110, 12 => 69, 13 => 110, 15 => 300, 16 => 110, 20 => 256, 21 => 277, 23 => 277, 26 => 69, 28 => 110),
+        'search' => array(0 => 208, 4 => 69, 5 => 69, 10 => 161, 13 => 220, 14 => 69, 15 => 230, 20 => 240, 21 => 110, 23 => 110, 28 => 220),
+        'sed' => array(2 => 314, 23 => 208),
+        'see' => array(0 => 69, 1 => 110, 2 => 220, 4 => 161, 5 => 230, 6 => 110, 7 => 195, 10 => 69, 12 => 110, 14 => 139, 15 => 220, 20 => 271, 21 => 256, 22 => 69, 23 => 69, 25 => 69, 26 => 69),
+        'select' => array(0 => 69, 2 => 139, 4 => 69, 5 => 110, 9 => 220, 11 => 69, 13 => 139, 15 => 283, 20 => 110, 23 => 240, 25 => 69, 28 => 139),
+        'self' => array(2 => 69, 4 => 69, 7 => 283, 10 => 161, 15 => 283, 16 => 179, 20 => 283, 21 => 69, 22 => 283, 23 => 179),
+        'self ,' => array(15 => 195, 20 => 220, 22 => 277),
+        'self .' => array(15 => 283, 22 => 283, 23 => 179),
+        'set' => array(0 => 220, 2 => 230, 4 => 195, 5 => 294, 7 => 110, 9 => 195, 10 => 110, 12 => 69, 14 => 220, 15 => 289, 16 => 110, 20 => 330, 21 => 208, 22 => 179, 23 => 289, 24 => 220),
+        'set (' => array(9 => 110, 14 => 220, 15 => 230, 24 => 220),
+        'shift' => array(0 => 248, 2 => 264, 4 => 139, 7 => 161, 15 => 264, 20 => 337, 23 => 139),
+        'should' => array(0 => 195, 1 => 69, 2 => 230, 3 => 69, 4 => 264, 5 => 110, 6 => 110, 7 => 195, 9 => 110, 10 => 69, 12 => 195, 14 => 208, 15 => 240, 20 => 309, 21 => 304, 22 => 139, 23 => 264, 25 => 69, 26 => 139),
+        'show' => array(0 => 69, 2 => 208, 4 => 69, 7 => 161, 9 => 69, 12 => 300, 14 => 69, 15 => 230, 23 => 230),
+        'size' => array(0 => 283, 4 => 271, 5 => 179, 6 => 230, 7 => 195, 11 => 161, 13 => 271, 14 => 220, 15 => 283, 20 => 256, 23 => 283, 24 => 240, 25 => 161, 26 => 195, 28 => 271),
+        'size :' => array(0 => 179, 6 => 230, 13 => 179, 15 => 110, 24 => 161, 25 => 161, 28 => 179),
+        'size >' => array(0 => 69, 13 => 220, 14 => 110, 23 => 69, 28 => 220),
+        'sk' => array(2 => 69, 13 => 220, 28 => 220),
+        'small' => array(2 => 69, 7 => 161, 10 => 69, 13 => 220, 15 => 110, 16 => 69, 23 => 208, 28 => 220),
+        'small >' => array(13 => 220, 23 => 161, 28 => 220),
+        'so' => array(0 => 179, 2 => 220, 4 => 294, 5 => 161, 7 => 220, 8 => 69, 9 => 139, 10 => 110, 12 => 161, 13 => 110, 14 => 195, 15 => 220, 20 => 309, 21 => 220, 23 => 161, 25 => 69, 27 => 69, 28 => 110),
+        'solid' => array(6 => 256, 13 => 69, 15 => 110, 21 => 69, 23 => 110, 25 => 69, 28 => 69),
+        'some' => array(0 => 240, 2 => 240, 4 => 139, 6 => 69, 7 => 271, 8 => 161, 10 => 69, 14 => 110, 15 => 289, 18 => 69, 20 => 264, 21 => 248, 23 => 110),
+        'source' => array(0 => 220, 2 => 208, 4 => 69, 5 => 256, 7 => 240, 9 => 161, 14 => 220, 15 => 271, 20 => 294, 21 => 271, 22 => 220, 23 => 240, 25 => 69),
+        'space' => array(0 => 248, 3 => 195, 4 => 110, 6 => 179, 13 => 208, 14 => 220, 15 => 161, 20 => 69, 23 => 179, 28 => 208),
+        'space :' => array(6 => 179, 13 => 208, 28 => 208),
+        'span' => array(6 => 161, 13 => 220, 15 => 195, 21 => 240, 23 => 230, 25 => 220, 28 => 220),
+        'span >' => array(13 => 220, 15 => 195, 21 => 161, 23 => 110, 28 => 220),
+        'span lang' => array(13 => 220, 28 => 220),
+        'specified' => array(0 => 230, 2 => 69, 5 => 220, 7 => 110, 12 => 69, 14 => 220, 15 => 230, 20 => 300, 21 => 195, 22 => 69, 23 => 110),
+        'split' => array(0 => 195, 4 => 69, 12 => 139, 14 => 220, 15 => 256, 20 => 277, 21 => 220, 22 => 220, 23 => 271),
+        'split (' => array(0 => 195, 15 => 248, 20 => 271, 22 => 220, 23 => 264),
+        'sr' => array(13 => 220, 28 => 220),
+        'src' => array(2 => 69, 6 => 220, 7 => 322, 8 => 110, 10 => 69, 13 => 220, 14 => 161, 15 => 230, 20 => 220, 21 => 340, 23 => 304, 24 => 220, 28 => 220),
+        'src /' => array(7 => 322, 20 => 69),
+        'src :' => array(6 => 220, 15 => 110, 24 => 161),
+        'src =' => array(8 => 110, 10 => 69, 13 => 220, 15 => 110, 21 => 264, 23 => 271, 28 => 220),
+        'start' => array(0 => 220, 2 => 179, 4 => 139, 5 => 208, 7 => 195, 9 => 69, 12 => 161, 14 => 220, 15 => 283, 20 => 161, 21 => 240, 23 => 195, 24 => 69),
+        'state' => array(0 => 283, 3 => 69, 4 => 110, 7 => 195, 12 => 139, 14 => 220, 15 => 248, 16 => 69, 20 => 256, 21 => 220, 23 => 69),
+        'static' => array(0 => 330, 2 => 230, 3 => 69, 4 => 220, 5 => 294, 7 => 220, 10 => 139, 11 => 69, 14 => 220, 15 => 179, 20 => 195, 21 => 69),
+        'status' => array(2 => 230, 4 => 161, 10 => 220, 14 => 69, 15 => 283, 20 => 230, 23 => 248),
+        'str' => array(0 => 161, 2 => 161, 7 => 110, 8 => 110, 9 => 69, 12 => 161, 14 => 161, 20 => 240, 21 => 304, 22 => 220, 23 => 300),
+        'str )' => array(0 => 69, 14 => 69, 21 => 283, 23 => 179),
+        'strconv' => array(10 => 256),
+        'strconv .' => array(10 => 248),
+        'string' => array(0 => 195, 2 => 256, 3 => 179, 4 => 240, 5 => 248, 6 => 69, 7 => 283, 8 => 139, 9 => 271, 10 => 300, 11 => 139, 12 => 139, 13 => 220, 14 => 220, 15 => 294, 16 => 110, 19 => 69, 20 => 283, 21 => 314, 22 => 322, 23 => 195, 24 => 195, 27 => 110, 28 => 230),
+        'string )' => array(3 => 69, 4 => 69, 5 => 161, 7 => 161, 10 => 283, 15 => 195, 21 => 139, 22 => 161, 23 => 69),
+        'string ,' => array(3 => 69, 4 => 179, 10 => 283, 15 => 139, 21 => 139, 22 => 69, 23 => 69),
+        'string >' => array(13 => 220, 28 => 220),
+        'strings' => array(0 => 69, 2 => 69, 5 => 69, 7 => 195, 9 => 69, 10 => 256, 14 => 139, 15 => 179, 19 => 69, 22 => 110, 23 => 69, 26 => 69),
+        'strlen' => array(21 => 309),
+        'strlen (' => array(21 => 309),
+        'strong' => array(7 => 110, 8 => 110, 13 => 220, 21 => 110, 23 => 256, 28 => 220),
+        'strong >' => array(8 => 110, 13 => 220, 21 => 110, 23 => 220, 28 => 220),
+        'struct' => array(3 => 69, 4 => 256, 5 => 110, 10 => 240, 20 => 110),
+        'style' => array(0 => 220, 2 => 110, 6 => 248, 7 => 283, 8 => 139, 13 => 220, 14 => 110, 15 => 283, 16 => 220, 19 => 69, 20 => 161, 21 => 318, 23 => 294, 25 => 69, 28 => 220),
+        'style :' => array(0 => 220, 6 => 248, 13 => 110, 15 => 110, 23 => 69, 25 => 69, 28 => 110),
+        'style =' => array(8 => 69, 13 => 220, 15 => 230, 21 => 248, 23 => 248, 28 => 220),
+        'style >' => array(8 => 69, 13 => 208, 16 => 69, 21 => 139, 28 => 208),
+        'sub' => array(0 => 69, 5 => 69, 15 => 69, 20 => 371, 21 => 110, 23 => 264),
+        'summary' => array(2 => 69, 5 => 283, 7 => 110, 20 => 230),
+        'summary >' => array(5 => 283),
+        'support' => array(0 => 110, 2 => 283, 7 => 283, 14 => 179, 15 => 220, 20 => 139, 23 => 69),
+        'svg' => array(13 => 220, 28 => 220),
+        'symbol' => array(0 => 230, 12 => 240, 20 => 139, 22 => 271, 23 => 110),
+        'syntax' => array(3 => 110, 7 => 283, 9 => 69, 16 => 110, 20 => 195, 21 => 110, 22 => 220, 23 => 161),
+        'sys' => array(1 => 139, 4 => 110, 22 => 289),
+        't' => array(0 => 289, 2 => 304, 4 => 326, 5 => 110, 8 => 161, 9 => 161, 10 => 264, 11 => 110, 12 => 322, 13 => 195, 14 => 220, 15 => 283, 16 => 110, 17 => 161, 20 => 347, 21 => 361, 22 => 220, 23 => 318, 24 => 69, 25 => 139, 26 => 230, 28 => 161),
+        't )' => array(4 => 110, 10 => 69, 12 => 256, 15 => 69, 21 => 208),
+        'table' => array(0 => 220, 4 => 110, 5 => 69, 6 => 220, 9 => 230, 14 => 220, 15 => 283, 20 => 240, 21 => 271, 23 => 309, 25 => 139, 26 => 220),
+        'tabstop' => array(13 => 220, 28 => 220),
+        'tabstop >' => array(13 => 220, 28 => 220),
+        'tag' => array(0 => 139, 2 => 195, 7 => 256, 8 => 139, 9 => 220, 15 => 277, 16 => 220, 20 => 139, 21 => 248, 23 => 283, 24 => 69, 28 => 161),
+        'tags' => array(0 => 220, 4 => 69, 5 => 69, 9 => 69, 15 => 139, 16 => 220, 21 => 220, 23 => 220),
+        'target' => array(2 => 139, 9 => 69, 15 => 283, 20 => 248, 21 => 208, 22 => 220, 23 => 110),
+        'td' => array(6 => 161, 8 => 220, 15 => 240, 21 => 271, 23 => 277, 25 => 110),
+        'td >' => array(8 => 161, 15 => 208, 21 => 248, 23 => 240),
+        'test' => array(2 => 289, 4 => 110, 7 => 195, 8 => 69, 11 => 69, 14 => 69, 15 => 283, 20 => 208, 22 => 69, 23 => 139),
+        'text' => array(0 => 240, 2 => 195, 3 => 110, 5 => 69, 6 => 271, 8 => 110, 9 => 69, 10 => 69, 13 => 283, 15 => 283, 16 => 195, 20 => 294, 21 => 343, 22 => 220, 23 => 314, 24 => 208, 25 => 208, 26 => 69, 28 => 283),
+        'text "' => array(2 => 110, 13 => 220, 15 => 110, 16 => 110, 20 => 139, 28 => 220),
+        'text -' => array(6 => 271, 13 => 220, 21 => 139, 23 => 110, 25 => 195, 28 => 220),
+        'text /' => array(0 => 69, 8 => 69, 10 => 69, 13 => 110, 15 => 271, 16 => 110, 21 => 264, 23 => 264, 24 => 69, 28 => 110),
+        'that' => array(0 => 264, 1 => 69, 2 => 256, 4 => 294, 5 => 264, 6 => 110, 7 => 283, 9 => 139, 10 => 69, 12 => 264, 13 => 69, 14 => 220, 15 => 256, 20 => 333, 21 => 271, 22 => 179, 23 => 264, 24 => 110, 25 => 139, 26 => 69, 28 => 69),
+        'the' => array(0 => 350, 1 => 208, 2 => 343, 3 => 139, 4 => 374, 5 => 304, 6 => 283, 7 => 330, 8 => 110, 9 => 289, 10 => 264, 11 => 69, 12 => 283, 13 => 220, 14 => 220, 15 => 350, 16 => 139, 18 => 110, 19 => 69, 20 => 376, 21 => 347, 22 => 337, 23 => 383, 24 => 139, 25 => 220, 26 => 264, 27 => 69, 28 => 240),
+        'the GNU' => array(1 => 69, 4 => 248, 6 => 179, 12 => 139, 20 => 110, 21 => 179, 22 => 179, 23 => 110, 25 => 139),
+        'then' => array(0 => 220, 1 => 220, 2 => 358, 4 => 110, 5 => 161, 7 => 240, 9 => 69, 11 => 69, 12 => 271, 14 => 161, 15 => 195, 20 => 230, 21 => 161, 22 => 69, 23 => 277),
+        'this' => array(0 => 289, 1 => 69, 2 => 289, 4 => 343, 5 => 326, 6 => 110, 7 => 283, 8 => 220, 9 => 195, 10 => 179, 12 => 220, 13 => 220, 14 => 220, 15 => 361, 18 => 69, 19 => 110, 20 => 343, 21 => 366, 22 => 271, 23 => 337, 24 => 283, 25 => 110, 26 => 69, 27 => 110, 28 => 195),
+        'this ,' => array(5 => 110, 14 => 195, 15 => 283, 21 => 264, 24 => 220),
+        'this -' => array(20 => 69, 21 => 322),
+        'this is' => array(0 => 69, 2 => 230, 4 => 161, 7 => 195, 8 => 179, 12 => 69, 13 => 110, 14 => 110, 15 => 195, 19 => 110, 20 => 139, 21 => 230, 22 => 220, 23 => 69, 24 => 179, 27 => 69, 28 => 69),
+        'throw' => array(0 => 283, 5 => 240, 9 => 220, 14 => 139, 15 => 195, 20 => 220, 21 => 248, 24 => 69),
+        'throw new' => array(0 => 283, 5 => 240, 14 => 139, 15 => 139, 21 => 179),
+        'thumb' => array(13 => 220, 28 => 220),
+        'thumb /' => array(13 => 220, 28 => 220),
+        'time' => array(0 => 161, 2 => 161, 4 => 304, 5 => 110, 7 => 283, 10 => 283, 15 => 283, 20 => 289, 21 => 139, 22 => 195, 23 => 110),
+        'time .' => array(4 => 220, 10 => 283, 20 => 69),
+        'title' => array(0 => 220, 2 => 220, 5 => 208, 6 => 110, 7 => 161, 8 => 139, 10 => 208, 11 => 220, 13 => 220, 15 => 139, 17 => 69, 20 => 220, 21 => 300, 22 => 208, 23 => 300, 26 => 220, 28 => 220),
+        'title =' => array(2 => 139, 5 => 110, 10 => 110, 13 => 220, 20 => 220, 21 => 220, 22 => 110, 23 => 220, 28 => 220),
+        'to' => array(0 => 347, 2 => 314, 3 => 110, 4 => 340, 5 => 337, 6 => 69, 7 => 304, 8 => 110, 9 => 277, 10 => 277, 12 => 264, 13 => 179, 14 => 220, 15 => 333, 16 => 110, 17 => 110, 18 => 139, 19 => 110, 20 => 376, 21 => 333, 22 => 326, 23 => 364, 24 => 110, 25 => 179, 26 => 248, 28 => 179),
+        'to a' => array(0 => 179, 2 => 69, 4 => 139, 5 => 230, 7 => 283, 12 => 69, 14 => 110, 15 => 179, 19 => 69, 20 => 220, 21 => 69, 22 => 208, 23 => 69),
+        'to be' => array(0 => 230, 2 => 69, 3 => 110, 4 => 69, 7 => 283, 10 => 110, 12 => 69, 14 => 220, 15 => 248, 19 => 69, 20 => 271, 21 => 240, 23 => 139),
+        'to the' => array(0 => 264, 2 => 220, 4 => 264, 5 => 139, 6 => 69, 7 => 294, 9 => 139, 10 => 69, 12 => 139, 13 => 69, 14 => 208, 15 => 240, 20 => 294, 21 => 240, 22 => 110, 23 => 179, 24 => 69, 26 => 195, 28 => 69),
+        'toContent' => array(12 => 283),
+        'toString' => array(0 => 139, 4 => 69, 7 => 110, 11 => 110, 14 => 220, 15 => 283, 24 => 248),
+        'toString (' => array(0 => 139, 4 => 69, 7 => 110, 11 => 110, 14 => 220, 15 => 179, 24 => 220),
+        'token' => array(3 => 69, 5 => 110, 7 => 110, 12 => 220, 14 => 220, 15 => 69, 20 => 283),
+        'top' => array(0 => 220, 4 => 220, 6 => 230, 9 => 69, 13 => 220, 14 => 110, 15 => 289, 20 => 195, 21 => 161, 23 => 139, 25 => 195, 28 => 220),
+        'top :' => array(0 => 69, 6 => 208, 13 => 220, 15 => 264, 21 => 139, 28 => 220),
+        'tr' => array(2 => 179, 4 => 220, 6 => 69, 7 => 110, 8 => 220, 13 => 195, 14 => 208, 15 => 264, 20 => 69, 21 => 220, 23 => 271, 28 => 195),
+        'tr >' => array(8 => 220, 15 => 240, 21 => 208, 23 => 240),
+        'trim' => array(0 => 69, 9 => 69, 15 => 240, 20 => 110, 21 => 283),
+        'true' => array(0 => 283, 2 => 208, 4 => 240, 5 => 300, 7 => 195, 9 => 283, 10 => 240, 12 => 195, 13 => 230, 14 => 220, 15 => 304, 16 => 248, 20 => 264, 21 => 294, 23 => 271, 24 => 161, 28 => 230),
+        'true )' => array(0 => 139, 4 => 179, 5 => 230, 9 => 179, 10 => 208, 14 => 220, 15 => 300, 16 => 110, 21 => 264, 23 => 179, 24 => 110),
+        'true ,' => array(0 => 161, 5 => 110, 9 => 220, 10 => 69, 12 => 69, 15 => 264, 16 => 240, 20 => 69, 21 => 110),
+        'true -' => array(9 => 283),
+        'true ;' => array(0 => 277, 4 => 179, 5 => 230, 7 => 110, 9 => 110, 10 => 69, 14 => 220, 15 => 289, 20 => 69, 21 => 271),
+        'true }' => array(9 => 161, 10 => 208, 15 => 208, 16 => 220, 24 => 69),
+        'try' => array(0 => 69, 2 => 220, 4 => 161, 5 => 220, 7 => 220, 9 => 230, 10 => 110, 12 => 220, 14 => 161, 15 => 289, 20 => 230, 22 => 110, 24 => 69),
+        'tt' => array(2 => 110, 13 => 161, 17 => 220, 20 => 69, 23 => 69, 28 => 161),
+        'type' => array(0 => 220, 1 => 161, 2 => 161, 4 => 69, 5 => 179, 6 => 69, 7 => 283, 8 => 110, 9 => 195, 10 => 277, 11 => 220, 12 => 179, 13 => 179, 14 => 179, 15 => 283, 16 => 161, 20 => 283, 21 => 314, 22 => 220, 23 => 271, 28 => 179),
+        'type =' => array(0 => 220, 8 => 110, 9 => 179, 10 => 69, 13 => 179, 14 => 69, 15 => 283, 16 => 110, 20 => 139, 21 => 289, 22 => 220, 23 => 230, 28 => 179),
+        'types' => array(4 => 69, 5 => 69, 7 => 283, 10 => 69, 12 => 161, 15 => 283, 20 => 139, 21 => 69, 23 => 69),
+        'ul' => array(8 => 220, 21 => 139, 23 => 208),
+        'ul >' => array(8 => 220, 21 => 139, 23 => 195),
+        'undef' => array(20 => 358),
+        'undefined' => array(4 => 69, 9 => 283, 13 => 69, 15 => 277, 20 => 110, 28 => 69),
+        'unless' => array(2 => 69, 15 => 69, 20 => 343, 23 => 304, 26 => 110),
+        'up' => array(0 => 208, 2 => 110, 4 => 230, 5 => 69, 6 => 69, 7 => 240, 14 => 220, 15 => 230, 20 => 277, 21 => 179, 22 => 110, 23 => 69, 26 => 69),
+        'upload' => array(13 => 220, 28 => 220),
+        'upload .' => array(13 => 220, 28 => 220),
+        'url' => array(0 => 179, 2 => 139, 6 => 230, 8 => 179, 9 => 179, 10 => 139, 11 => 220, 15 => 283, 20 => 289, 21 => 110, 22 => 220, 23 => 220, 24 => 208),
+        'url (' => array(6 => 230, 8 => 110, 21 => 110, 23 => 69),
+        'url )' => array(9 => 69, 10 => 69, 11 => 195, 15 => 248, 22 => 220, 23 => 139, 24 => 139),
+        'use' => array(0 => 264, 2 => 264, 3 => 69, 4 => 139, 5 => 179, 7 => 283, 9 => 161, 12 => 139, 14 => 220, 15 => 248, 20 => 364, 21 => 264, 22 => 110, 23 => 256, 24 => 69),
+        'used' => array(0 => 256, 2 => 179, 4 => 139, 5 => 264, 7 => 294, 10 => 110, 12 => 69, 14 => 139, 15 => 256, 20 => 300, 21 => 240, 22 => 69, 23 => 179, 26 => 69),
+        'using' => array(0 => 110, 2 => 256, 4 => 195, 5 => 330, 7 => 283, 9 => 110, 14 => 220, 15 => 240, 20 => 283, 21 => 110, 23 => 139, 25 => 69),
+        'using System' => array(5 => 326),
+        'util' => array(4 => 69, 14 => 220, 23 => 195, 24 => 208),
+        'v' => array(0 => 220, 2 => 161, 10 => 264, 14 => 220, 15 => 230, 20 => 240, 21 => 208, 22 => 110, 23 => 195, 24 => 110, 26 => 139),
+        'val' => array(0 => 69, 5 => 220, 10 => 220, 15 => 283, 20 => 110, 22 => 220, 23 => 110, 24 => 283),
+        'val )' => array(5 => 161, 10 => 195, 15 => 277, 22 => 220, 23 => 69),
+        'value' => array(0 => 309, 2 => 69, 4 => 139, 5 => 271, 6 => 69, 7 => 283, 8 => 161, 9 => 110, 10 => 179, 12 => 248, 13 => 220, 14 => 195, 15 => 283, 16 => 220, 20 => 340, 22 => 161, 23 => 248, 25 => 110, 26 => 110, 28 => 220),
+        'value =' => array(5 => 69, 13 => 220, 14 => 69, 15 => 283, 20 => 208, 22 => 69, 23 => 248, 28 => 220),
+        'var' => array(0 => 350, 1 => 161, 5 => 220, 8 => 139, 9 => 69, 10 => 283, 12 => 220, 13 => 220, 15 => 369, 16 => 220, 20 => 110, 21 => 208, 22 => 220, 23 => 161, 24 => 300, 28 => 220),
+        'var i' => array(0 => 318, 5 => 220, 15 => 283, 24 => 195),
+        'variable' => array(2 => 69, 6 => 69, 7 => 271, 8 => 69, 9 => 220, 12 => 110, 14 => 69, 16 => 161, 19 => 69, 20 => 220, 21 => 139),
+        'version' => array(0 => 220, 1 => 110, 2 => 318, 4 => 220, 6 => 161, 7 => 283, 12 => 139, 13 => 110, 14 => 110, 15 => 277, 16 => 69, 20 => 304, 21 => 208, 22 => 240, 23 => 139, 25 => 110, 26 => 161, 28 => 110),
+        'vi' => array(13 => 220, 28 => 220),
+        'views' => array(13 => 220, 21 => 69, 23 => 69, 28 => 220),
+        'views /' => array(13 => 220, 28 => 220),
+        'void' => array(0 => 314, 2 => 110, 3 => 69, 4 => 356, 5 => 304, 7 => 110, 9 => 69, 11 => 69, 14 => 220, 20 => 161),
+        'void )' => array(2 => 110, 4 => 289),
+        'w' => array(0 => 230, 2 => 161, 4 => 264, 10 => 110, 13 => 139, 14 => 208, 15 => 283, 20 => 289, 21 => 69, 22 => 69, 23 => 271, 28 => 139),
+        'was' => array(0 => 110, 2 => 195, 4 => 110, 5 => 139, 7 => 283, 10 => 69, 12 => 110, 14 => 161, 15 => 220, 20 => 289, 21 => 110),
+        'we' => array(0 => 283, 2 => 256, 4 => 300, 5 => 161, 9 => 195, 10 => 69, 12 => 220, 14 => 208, 15 => 256, 18 => 69, 20 => 340, 21 => 277, 23 => 110, 25 => 69, 26 => 110),
+        'weight' => array(6 => 300, 7 => 110, 8 => 110, 13 => 110, 21 => 139, 25 => 161, 28 => 110),
+        'weight :' => array(6 => 300, 8 => 110, 13 => 110, 21 => 139, 25 => 161, 28 => 110),
+        'when' => array(0 => 220, 1 => 179, 2 => 240, 4 => 179, 5 => 110, 6 => 69, 7 => 195, 9 => 283, 12 => 220, 14 => 195, 15 => 230, 16 => 161, 20 => 294, 21 => 110, 23 => 271, 25 => 69),
+        'where' => array(0 => 110, 2 => 161, 4 => 110, 5 => 139, 7 => 220, 9 => 240, 11 => 69, 12 => 350, 14 => 69, 15 => 283, 20 => 230, 21 => 139, 22 => 69, 23 => 179),
+        'where toContent' => array(12 => 283),
+        'which' => array(0 => 230, 2 => 248, 4 => 230, 5 => 179, 6 => 69, 7 => 283, 12 => 230, 14 => 220, 15 => 248, 20 => 289, 21 => 300, 22 => 69, 23 => 161, 24 => 69, 26 => 69),
+        'while' => array(0 => 289, 2 => 220, 3 => 110, 4 => 161, 5 => 256, 7 => 220, 10 => 69, 12 => 110, 14 => 220, 15 => 283, 20 => 314, 21 => 240, 22 => 240, 23 => 139, 24 => 230),
+        'while (' => array(0 => 289, 4 => 161, 5 => 256, 14 => 220, 15 => 283, 20 => 300, 21 => 240, 24 => 230),
+        'white' => array(0 => 230, 3 => 195, 6 => 208, 13 => 208, 14 => 220, 21 => 69, 28 => 208),
+        'white -' => array(6 => 179, 13 => 208, 28 => 208),
+        'whitespace' => array(0 => 69, 3 => 220, 7 => 195, 12 => 69, 14 => 69, 15 => 220, 16 => 139, 21 => 179),
+        'widget' => array(6 => 110, 13 => 220, 21 => 69, 28 => 220),
+        'widget >' => array(13 => 220, 28 => 220),
+        'widget class' => array(13 => 220, 28 => 220),
+        'width' => array(0 => 314, 2 => 69, 4 => 110, 6 => 277, 8 => 69, 10 => 69, 13 => 283, 15 => 283, 21 => 195, 22 => 161, 23 => 139, 25 => 230, 28 => 283),
+        'width -' => array(0 => 256, 4 => 110, 25 => 220),
+        'width :' => array(0 => 256, 6 => 277, 13 => 220, 15 => 240, 21 => 110, 23 => 69, 25 => 230, 28 => 220),
+        'width =' => array(0 => 230, 8 => 69, 10 => 69, 13 => 220, 15 => 139, 22 => 110, 23 => 110, 28 => 220),
+        'width >' => array(13 => 220, 28 => 220),
+        'wiki' => array(2 => 220, 13 => 220, 20 => 220, 28 => 220),
+        'wiki /' => array(2 => 139, 13 => 220, 20 => 110, 28 => 220),
+        'wikimedia' => array(13 => 220, 20 => 220, 28 => 220),
+        'wikimedia .' => array(13 => 220, 20 => 220, 28 => 220),
+        'wikipedia' => array(2 => 69, 13 => 220, 20 => 220, 28 => 220),
+        'wikipedia .' => array(2 => 69, 13 => 220, 20 => 220, 28 => 220),
+        'wikipedia /' => array(13 => 220, 20 => 179, 28 => 220),
+        'will' => array(0 => 271, 1 => 69, 2 => 220, 4 => 289, 5 => 69, 6 => 110, 7 => 256, 8 => 110, 9 => 139, 12 => 220, 14 => 69, 15 => 264, 20 => 322, 21 => 256, 22 => 208, 23 => 289, 25 => 69, 28 => 69),
+        'will be' => array(0 => 230, 1 => 69, 2 => 161, 4 => 208, 5 => 69, 6 => 110, 7 => 161, 8 => 69, 9 => 69, 12 => 139, 15 => 139, 20 => 304, 21 => 240, 22 => 161, 23 => 220, 25 => 69),
+        'with' => array(0 => 277, 1 => 161, 2 => 326, 4 => 289, 5 => 240, 6 => 110, 7 => 283, 8 => 139, 9 => 277, 10 => 110, 12 => 264, 13 => 69, 14 => 220, 15 => 309, 16 => 220, 20 => 309, 21 => 283, 22 => 220, 23 => 289, 24 => 69, 25 => 110, 26 => 179, 28 => 69),
+        'with a' => array(0 => 220, 2 => 69, 7 => 283, 9 => 69, 12 => 110, 14 => 139, 15 => 195, 16 => 220, 20 => 256, 21 => 69),
+        'with the' => array(0 => 195, 2 => 69, 4 => 179, 5 => 139, 7 => 283, 9 => 220, 12 => 139, 14 => 220, 15 => 208, 20 => 208, 21 => 161, 23 => 161, 25 => 69),
+        'www' => array(0 => 240, 1 => 69, 2 => 220, 3 => 110, 4 => 110, 5 => 110, 6 => 110, 7 => 161, 9 => 69, 12 => 69, 13 => 220, 14 => 110, 15 => 208, 16 => 220, 20 => 208, 21 => 220, 22 => 110, 23 => 220, 25 => 69, 26 => 69, 28 => 220),
+        'www .' => array(0 => 240, 1 => 69, 2 => 220, 3 => 110, 4 => 110, 5 => 110, 6 => 110, 7 => 161, 9 => 69, 12 => 69, 13 => 220, 14 => 110, 15 => 179, 16 => 220, 20 => 208, 21 => 139, 22 => 110, 23 => 208, 25 => 69, 26 => 69, 28 => 220),
+        'x' => array(0 => 271, 2 => 326, 4 => 256, 5 => 220, 6 => 69, 7 => 240, 8 => 195, 10 => 208, 12 => 283, 13 => 230, 14 => 220, 15 => 309, 17 => 69, 20 => 289, 21 => 333, 22 => 322, 23 => 271, 24 => 161, 28 => 240),
+        'x =' => array(0 => 220, 2 => 230, 4 => 161, 5 => 220, 8 => 110, 10 => 69, 12 => 264, 15 => 240, 20 => 208, 21 => 220, 22 => 220, 23 => 139, 28 => 69),
+        'x ]' => array(2 => 220, 12 => 248, 21 => 69),
+        'x201_6' => array(13 => 220, 28 => 220),
+        'x201_6 .' => array(13 => 220, 28 => 220),
+        'xml' => array(4 => 69, 8 => 69, 10 => 110, 11 => 220, 13 => 139, 15 => 309, 16 => 69, 20 => 256, 21 => 195, 22 => 139, 23 => 139, 24 => 240, 28 => 139),
+        'y' => array(0 => 264, 2 => 110, 4 => 248, 5 => 220, 7 => 195, 8 => 161, 10 => 220, 12 => 110, 13 => 161, 14 => 220, 15 => 256, 20 => 110, 21 => 248, 22 => 161, 28 => 161),
+        'you' => array(0 => 240, 2 => 248, 4 => 161, 6 => 110, 9 => 69, 12 => 69, 14 => 110, 15 => 230, 20 => 309, 21 => 271, 22 => 179, 23 => 283, 25 => 139, 26 => 110),
+        'zh' => array(13 => 220, 20 => 69, 28 => 220),
+        '{' => array(0 => 350, 2 => 343, 3 => 304, 4 => 376, 5 => 356, 6 => 322, 7 => 314, 8 => 283, 9 => 283, 10 => 322, 11 => 294, 12 => 337, 13 => 220, 14 => 220, 15 => 353, 16 => 289, 17 => 283, 18 => 69, 19 => 139, 20 => 378, 21 => 397, 22 => 230, 23 => 383, 24 => 289, 25 => 283, 28 => 220),
+        '{ "' => array(10 => 69, 11 => 69, 14 => 220, 15 => 179, 16 => 283, 20 => 230, 23 => 69, 24 => 69),
+        '{ #' => array(2 => 283, 4 => 139, 5 => 208, 8 => 110, 9 => 69, 20 => 340, 23 => 110, 25 => 110),
+        '{ $' => array(13 => 69, 15 => 264, 20 => 364, 21 => 374, 23 => 271, 25 => 230, 28 => 69),
+        '{ %' => array(8 => 277, 20 => 179, 23 => 69),
+        '{ \'' => array(0 => 110, 3 => 220, 7 => 161, 8 => 220, 9 => 220, 14 => 220, 15 => 230, 20 => 337, 22 => 161, 23 => 264),
+        '{ /' => array(0 => 343, 4 => 318, 5 => 271, 6 => 161, 8 => 69, 10 => 256, 14 => 220, 15 => 283, 17 => 69, 20 => 69, 21 => 230, 24 => 69, 25 => 110),
+        '{ :' => array(2 => 220, 16 => 220, 23 => 220),
+        '{ @' => array(7 => 110, 20 => 139, 23 => 277, 25 => 230),
+        '{ background' => array(6 => 289, 13 => 139, 21 => 69, 28 => 139),
+        '{ border' => array(0 => 69, 6 => 240, 13 => 69, 21 => 69, 25 => 139, 28 => 69),
+        '{ color' => array(6 => 230, 13 => 139, 23 => 69, 28 => 139),
+        '{ font' => array(6 => 271, 8 => 110, 13 => 195, 21 => 110, 25 => 161, 28 => 195),
+        '{ if' => array(0 => 326, 2 => 240, 4 => 322, 5 => 294, 10 => 283, 13 => 110, 14 => 220, 15 => 289, 20 => 309, 21 => 304, 24 => 110, 28 => 110),
+        '{ my' => array(20 => 371),
+        '{ ok' => array(9 => 283, 10 => 69),
+        '{ padding' => array(6 => 208, 21 => 69, 25 => 240),
+        '{ return' => array(0 => 294, 2 => 110, 4 => 208, 5 => 271, 7 => 110, 10 => 322, 11 => 69, 13 => 69, 14 => 220, 15 => 283, 20 => 277, 21 => 240, 28 => 69),
+        '{ text' => array(6 => 240, 13 => 69, 15 => 110, 21 => 69, 23 => 139, 25 => 161, 28 => 69),
+        '{ val' => array(15 => 230, 24 => 283),
+        '{ var' => array(0 => 347, 5 => 220, 10 => 230, 13 => 179, 15 => 304, 16 => 220, 21 => 69, 24 => 139, 28 => 179),
+        '{ {' => array(5 => 69, 8 => 283, 9 => 220, 11 => 110, 20 => 69, 21 => 110),
+        '{ |' => array(20 => 69, 23 => 314),
+        '{ }' => array(0 => 110, 5 => 256, 6 => 139, 8 => 110, 9 => 220, 10 => 220, 14 => 69, 15 => 283, 16 => 69, 17 => 139, 20 => 309, 21 => 139, 22 => 179, 23 => 195),
+        '|' => array(0 => 300, 2 => 364, 3 => 364, 4 => 283, 5 => 289, 7 => 337, 8 => 220, 9 => 283, 10 => 220, 11 => 220, 12 => 322, 13 => 179, 14 => 220, 15 => 294, 17 => 110, 20 => 376, 21 => 340, 22 => 139, 23 => 404, 28 => 179),
+        '| "' => array(3 => 271, 10 => 110, 12 => 110, 14 => 139, 15 => 220, 20 => 240, 21 => 69, 23 => 139),
+        '| $' => array(15 => 248, 17 => 69, 20 => 264, 21 => 264, 23 => 220),
+        '| \'' => array(0 => 69, 2 => 69, 3 => 283, 12 => 110, 14 => 220, 15 => 220, 20 => 300, 21 => 69, 23 => 264),
+        '| (' => array(0 => 69, 2 => 139, 4 => 220, 5 => 195, 7 => 161, 11 => 110, 14 => 179, 15 => 283, 20 => 220, 21 => 220, 23 => 230),
+        '| <' => array(3 => 277, 21 => 69, 23 => 139),
+        '| Acc' => array(9 => 277),
+        '| sed' => array(2 => 304, 23 => 110),
+        '| {' => array(3 => 110, 9 => 248, 15 => 283, 20 => 139, 23 => 69),
+        '| |' => array(0 => 256, 2 => 277, 3 => 69, 4 => 240, 5 => 264, 7 => 220, 9 => 283, 10 => 110, 11 => 195, 13 => 110, 14 => 220, 15 => 283, 20 => 347, 21 => 256, 23 => 337, 28 => 110),
+        '}' => array(0 => 350, 2 => 343, 3 => 304, 4 => 376, 5 => 356, 6 => 322, 7 => 330, 8 => 283, 9 => 283, 10 => 322, 11 => 294, 12 => 337, 13 => 220, 14 => 220, 15 => 353, 16 => 300, 17 => 283, 18 => 69, 19 => 139, 20 => 378, 21 => 397, 22 => 230, 23 => 385, 24 => 289, 25 => 283, 28 => 220),
+        '} "' => array(2 => 264, 5 => 277, 8 => 240, 11 => 220, 14 => 220, 16 => 230, 18 => 69, 20 => 248, 21 => 139, 23 => 318),
+        '} #' => array(2 => 304, 4 => 283, 13 => 69, 20 => 326, 21 => 110, 22 => 110, 23 => 300, 25 => 195, 28 => 69),
+        '} $' => array(2 => 230, 15 => 69, 17 => 139, 20 => 343, 21 => 300, 23 => 220),
+        '} &' => array(17 => 220, 20 => 179, 25 => 220),
+        '} \'' => array(0 => 110, 2 => 139, 3 => 220, 8 => 69, 14 => 220, 15 => 69, 20 => 220, 21 => 161, 22 => 69, 23 => 256),
+        '} )' => array(0 => 69, 5 => 110, 8 => 69, 9 => 283, 10 => 220, 12 => 139, 13 => 69, 14 => 110, 15 => 322, 20 => 326, 21 => 110, 23 => 300, 28 => 69),
+        '} ,' => array(3 => 110, 4 => 220, 5 => 69, 8 => 110, 9 => 271, 10 => 110, 15 => 294, 16 => 264, 20 => 304, 21 => 69, 22 => 69, 23 => 240),
+        '} -' => array(3 => 139, 5 => 69, 7 => 110, 8 => 69, 9 => 277, 12 => 208, 20 => 300, 23 => 230, 25 => 110),
+        '} .' => array(2 => 69, 6 => 322, 8 => 139, 9 => 256, 15 => 220, 20 => 208, 21 => 220, 23 => 277, 25 => 195),
+        '} /' => array(0 => 347, 2 => 161, 4 => 314, 5 => 283, 6 => 179, 8 => 139, 10 => 283, 11 => 139, 13 => 69, 14 => 220, 15 => 283, 20 => 220, 21 => 304, 23 => 248, 24 => 139, 25 => 139, 28 => 69),
+        '} ;' => array(2 => 220, 3 => 110, 4 => 179, 5 => 230, 7 => 110, 9 => 248, 13 => 69, 14 => 220, 15 => 309, 20 => 337, 21 => 110, 23 => 179, 24 => 69, 28 => 69),
+        '} <' => array(8 => 283, 9 => 240, 10 => 69, 13 => 139, 16 => 69, 21 => 220, 23 => 220, 28 => 139),
+        '} =' => array(3 => 161, 9 => 283, 20 => 326, 23 => 110),
+        '} >' => array(8 => 139, 20 => 264, 21 => 69, 23 => 264),
+        '} \\' => array(2 => 139, 5 => 69, 11 => 69, 15 => 139, 16 => 110, 17 => 271, 20 => 248, 21 => 161, 23 => 220),
+        '} def' => array(11 => 161, 22 => 69, 23 => 69, 24 => 283),
+        '} div' => array(6 => 208, 13 => 220, 15 => 110, 25 => 69, 28 => 220),
+        '} else' => array(0 => 343, 4 => 304, 5 => 195, 10 => 256, 14 => 220, 15 => 283, 20 => 337, 21 => 220, 24 => 139),
+        '} elsif' => array(20 => 347),
+        '} end' => array(0 => 69, 9 => 240, 23 => 248),
+        '} func' => array(10 => 322),
+        '} if' => array(0 => 300, 2 => 139, 4 => 283, 5 => 248, 10 => 208, 14 => 220, 15 => 289, 20 => 340, 21 => 256, 23 => 110),
+        '} my' => array(20 => 330),
+        '} private' => array(0 => 248, 5 => 283, 14 => 208, 21 => 220, 24 => 139),
+        '} public' => array(0 => 240, 5 => 283, 14 => 110, 21 => 69),
+        '} return' => array(0 => 264, 4 => 110, 5 => 195, 10 => 300, 14 => 220, 15 => 283, 20 => 256, 21 => 289),
+        '} sub' => array(20 => 337),
+        '} var' => array(0 => 300, 10 => 195, 15 => 283),
+        '} void' => array(4 => 294, 5 => 110, 7 => 110),
+        '} {' => array(3 => 161, 8 => 240, 16 => 69, 17 => 69, 20 => 220),
+        '} |' => array(3 => 110, 9 => 264, 15 => 69, 20 => 322, 23 => 161),
+        '} }' => array(0 => 350, 4 => 330, 5 => 330, 7 => 110, 8 => 283, 9 => 240, 10 => 309, 11 => 271, 12 => 69, 13 => 110, 14 => 220, 15 => 283, 16 => 220, 20 => 364, 21 => 289, 23 => 256, 24 => 256, 25 => 248, 28 => 110),
+        '~' => array(0 => 69, 2 => 248, 3 => 110, 4 => 283, 7 => 110, 9 => 240, 11 => 69, 14 => 110, 15 => 271, 16 => 110, 18 => 69, 20 => 378, 21 => 161, 23 => 322),
+        '~ /' => array(4 => 220, 11 => 69, 20 => 277, 21 => 69, 23 => 277),
+        '~ s' => array(9 => 69, 20 => 350)
+    );
+}
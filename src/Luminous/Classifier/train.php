@@ -0,0 +1,120 @@
+<?php
+/*
+ * Trains NgramModel from the regression test sources in tests/regression,
+ * where each directory is named after a language code.
+ *
+ * A feature is counted at most NgramClassifier::CAP times per file. Features
+ * found in fewer than two files are dropped, and of the rest, the ones whose
+ * frequency differs most between languages are kept. A feature's weight for a
+ * language is then log(count + 1), with add-one smoothing folded into each
+ * language's default weight, so the model only needs to list the languages a
+ * feature was seen in.
+ *
+ * Run this after changing the regression sources:
+ *
+ *     php src/Luminous/Classifier/train.php
+ */
+
+use Luminous\Classifier\NgramClassifier;
+
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+
+$luminousRoot = dirname(dirname(dirname(__DIR__)));
+if (file_exists($luminousRoot . '/vendor/autoload.php')) {
+    require_once($luminousRoot . '/vendor/autoload.php');
+} else {
+    die('Please install the Composer autoloader by running `composer install` from within ' . $luminousRoot . PHP_EOL);
+}
+
+// how many features the model keeps
+$size = 1500;
+
+$languages = array();
+$counts = array();
+$files = array();
+foreach (glob($luminousRoot . '/tests/regression/*', GLOB_ONLYDIR) as $dir) {
+    $lang = basename($dir);
+    $languages[] = $lang;
+    $counts[$lang] = array();
+    foreach (glob($dir . '/*') as $file) {
+        if (preg_match('/\.luminous$/', $file) || !is_file($file)) {
+            continue;
+        }
+        foreach (NgramClassifier::features(file_get_contents($file)) as $feature => $count) {
+            $feature = (string)$feature;
+            $counts[$lang][$feature] = isset($counts[$lang][$feature]) ? $counts[$lang][$feature] + $count : $count;
+            $files[$feature] = isset($files[$feature]) ? $files[$feature] + 1 : 1;
+        }
+    }
+}
+
+$candidates = array();
+foreach ($files as $feature => $n) {
+    if ($n >= 2) {
+        $candidates[] = (string)$feature;
+    }
+}
+$totals = array();
+foreach ($languages as $lang) {
+    $totals[$lang] = array_sum($counts[$lang]);
+}
+
+// rank the candidates by how far their smoothed frequencies in each language
+// are from their mean (a frequency-weighted KL divergence)
+$scores = array();
+$v = count($candidates);
+foreach ($candidates as $feature) {
+    $q = array();
+    foreach ($languages as $lang) {
+        $c = isset($counts[$lang][$feature]) ? $counts[$lang][$feature] : 0;
+        $q[] = ($c + 1) / ($totals[$lang] + $v);
+    }
+    $mean = array_sum($q) / count($q);
+    $score = 0.0;
+    foreach ($q as $x) {
+        $score += $x * log($x / $mean);
+    }
+    $scores[$feature] = $score;
+}
+uksort($scores, function ($a, $b) use ($scores) {
+    if ($scores[$a] !== $scores[$b]) {
+        return ($scores[$a] > $scores[$b]) ? -1 : 1;
+    }
+    return strcmp($a, $b);
+});
+$selected = array_map('strval', array_slice(array_keys($scores), 0, $size));
+usort($selected, 'strcmp');
+
+$scale = NgramClassifier::SCALE;
+$v = count($selected);
+$defaults = array();
+foreach ($languages as $lang) {
+    $n = 0;
+    foreach ($selected as $feature) {
+        if (isset($counts[$lang][$feature])) {
+            $n += $counts[$lang][$feature];
+        }
+    }
+    $defaults[] = (int)floor(-log($n + $v) * $scale + 0.5);
+}
+$entries = array();
+foreach ($selected as $feature) {
+    $weights = array();
+    foreach ($languages as $i => $lang) {
+        if (isset($counts[$lang][$feature])) {
+            $weights[] = $i . ' => ' . (int)floor(log($counts[$lang][$feature] + 1) * $scale + 0.5);
+        }
+    }
+    $entries[] = '        ' . var_export($feature, true) . ' => array(' . implode(', ', $weights) . ')';
+}
+
+$code = "<?php\n\nnamespace Luminous\\Classifier;\n\n"
+    . "/*\n * Generated from tests/regression by train.php, do not edit.\n */\n"
+    . "class NgramModel\n{\n"
+    . "    public static \$LANGUAGES = array('" . implode("', '", $languages) . "');\n\n"
+    . "    public static \$DEFAULTS = array(" . implode(', ', $defaults) . ");\n\n"
+    . "    public static \$WEIGHTS = array(\n" . implode(",\n", $entries) . "\n    );\n}\n";
+file_put_contents(__DIR__ . '/NgramModel.php', $code);
+echo count($languages) . ' languages, ' . count($selected) . " features\n";
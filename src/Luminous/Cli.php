@@ -17,6 +17,7 @@ class Cli
         'theme' => 'geonyx',
         'code' => null,
         'line-numbers' => true,
+        'processes' => 1,
     );
     private $cmdOptionMap = array(
         '-i' => 'input-file',
@@ -25,6 +26,7 @@ class Cli
         '-f' => 'format',
         '-h' => 'height',
         '-t' => 'theme',
+        '-p' => 'processes',
     );
 
     public static function printHelp()
@@ -53,6 +55,9 @@ Options:
                         guessed.
   -o <filename>         Output file to write. If this is omitted, stdout is
                         used.
+  -p <processes>        Number of processes to highlight large inputs with.
+                        Needs the pcntl extension.
+                        Default: 1
   -t <theme>            Theme to use. See --list-themes for valid themes
   --no-numbers          Disables line numbering
 
@@ -186,7 +191,12 @@ see --help for help
         // set the language
         if ($this->options['lang'] === null) {
             // guessing
-            $this->options['lang'] = LuminousUi::guessLanguage($this->options['code']);
+            $this->options['lang'] = LuminousUi::guessLanguage(
+                $this->options['code'],
+                0.05,
+                'plain',
+                $this->options['input-file']
+            );
         }
 
         // user provided language
@@ -205,6 +215,10 @@ see --help for help
         // other options
         LuminousUi::set('max-height', $this->options['height']);
         LuminousUi::set('line-numbers', $this->options['line-numbers']);
+        if (!ctype_digit((string)$this->options['processes']) || (int)$this->options['processes'] < 1) {
+            $this->error('Invalid number of processes: ' . $this->options['processes']);
+        }
+        LuminousUi::set('processes', (int)$this->options['processes']);
 
         $h = LuminousUi::highlight($this->options['lang'], $this->options['code']);
         if ($this->options['output-file'] !== null) {
@@ -312,6 +312,9 @@ class Filters
      */
     public static function ooStreamFilter($tokens)
     {
+        if ($tokens instanceof TokenBuffer) {
+            return self::ooBufferFilter($tokens);
+        }
         $c = count($tokens);
         for ($i = 0; $i < $c; $i++) {
             if ($tokens[$i][0] !== 'IDENT') {
@@ -335,6 +338,38 @@ class Filters
         }
         return $tokens;
     }
+
+    /**
+     * @brief ooStreamFilter() for a TokenBuffer
+     * @internal
+     */
+    private static function ooBufferFilter($tokens)
+    {
+        $ident = TokenTypes::id('IDENT');
+        $c = count($tokens);
+        for ($i = 0; $i < $c; $i++) {
+            if ($tokens->typeId($i) !== $ident) {
+                continue;
+            }
+            // an operator of more than two bytes can't be one we're looking for
+            if ($i > 0 && $tokens->length($i - 1) <= 2) {
+                $s = $tokens->text($i - 1);
+                if ($s === '.' || $s === '->' || $s === '::') {
+                    $tokens->setType($i, 'OO');
+                    $i++;
+                    continue;
+                }
+            }
+            if ($i < $c - 1 && $tokens->length($i + 1) <= 2) {
+                $s = $tokens->text($i + 1);
+                if ($s === '.' || $s === '->' || $s === '::') {
+                    $tokens->setType($i, 'OBJ');
+                    $i++;
+                }
+            }
+        }
+        return $tokens;
+    }
 }
 
 /** @endcond */
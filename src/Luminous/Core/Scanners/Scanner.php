@@ -21,6 +21,9 @@
 namespace Luminous\Core\Scanners;
 
 use Exception;
+use ReflectionClass;
+use Luminous\Core\TokenBuffer;
+use Luminous\Core\TokenTypes;
 use Luminous\Core\Utils;
 
 /**
@@ -58,6 +61,18 @@ class Scanner extends StringScanner
      */
     public $version = 'master';
 
+    /**
+     * @brief The version of the scanner's grammar
+     *
+     * Cached output is keyed on this and the Luminous version (see
+     * Scanners::scannerFingerprint()), so a scanner overrides it with a
+     * higher number whenever a change alters its output: to its patterns, its
+     * keyword or identifier maps, its filters, or a scanner it embeds (in
+     * which case every scanner embedding it is bumped too). Changes to the
+     * shared code are covered by the Luminous version.
+     */
+    const GRAMMAR_VERSION = 1;
+
     /**
      * @brief The token stream
      *
@@ -69,6 +84,29 @@ class Scanner extends StringScanner
      */
     protected $tokens = array();
 
+    /**
+     * @brief Whether the token stream is recorded into a TokenBuffer
+     *
+     * When this is @c TRUE, record() and recordRange() append to
+     * $tokenBuffer instead of $tokens. A buffer holds source ranges as parallel
+     * arrays of type ID, offset and length, which is far smaller than an array
+     * of (type, string, escaped) triples. Token filters still receive triples.
+     * Stream filters receive the buffer if they were registered as
+     * buffer-aware; otherwise the stream is converted back to an array for them.
+     *
+     * Scanners which read or modify $tokens directly must leave this as
+     * @c FALSE.
+     */
+    protected $compactTokens = false;
+
+    /**
+     * @brief The token stream, if $compactTokens is set
+     *
+     * This is @c NULL until the first token is recorded, and once tagged() has
+     * had to convert the stream back to $tokens.
+     */
+    protected $tokenBuffer = null;
+
     /**
      * @brief State stack
      *
@@ -95,6 +133,19 @@ class Scanner extends StringScanner
      */
     protected $streamFilters = array();
 
+    /**
+     * @brief The filters compiled for filteredTokens(), or @c NULL
+     *
+     * This is built when it is first needed and dropped whenever a filter is
+     * added or removed. See compileFilters().
+     */
+    private $filterPipeline = null;
+
+    /**
+     * @brief The operators which make an identifier next to them 'OO' or 'OBJ'
+     */
+    private static $ooOperators = array('.' => true, '->' => true, '::' => true);
+
     /**
      * @brief Rule remappings
      *
@@ -125,6 +176,14 @@ class Scanner extends StringScanner
      */
     protected $identMap = array();
 
+    /**
+     * @brief The precedence of the token names in $identMap
+     *
+     * A map of TOKEN_NAME => rank, in the order the names were first added.
+     * An identifier given several names maps to the one added first.
+     */
+    protected $identRanks = array();
+
     /**
      * @brief Whether or not the language is case sensitive
      *
@@ -133,6 +192,98 @@ class Scanner extends StringScanner
      */
     protected $caseSensitive = true;
 
+    /**
+     * @brief Whether a scan can be checkpointed and resumed
+     *
+     * Checkpointing relies on all of main()'s state being held in properties.
+     * Scanners which carry state across iterations of main()'s loop in local
+     * variables must set this to @c FALSE.
+     *
+     * @see enableCheckpoints()
+     */
+    protected $checkpointable = true;
+
+    /**
+     * @brief Whether the scanner looks back through the recorded tokens
+     *
+     * Scanners which decide how to scan something from the tokens before it
+     * (e.g. whether a slash starts a regex or is a division) should set this,
+     * and read the tokens with recentToken(). Checkpoints then carry the
+     * most recent tokens, so a resumed scan sees the same ones as a full
+     * scan. These scanners can't use $compactTokens.
+     */
+    protected $lookbehind = false;
+
+    /**
+     * @brief Whether the scanner records definitions in $userDefs
+     *
+     * A definition changes how every use of the name is filtered, including
+     * uses before it, so such a scanner's output for part of a source can
+     * depend on anything after it. Scanners which write to $userDefs (or
+     * which host a subscanner which does) must set this.
+     *
+     * @see recordsUserDefs()
+     */
+    protected $recordsUserDefs = false;
+
+    /**
+     * @brief Tokens recorded before the checkpoint a scan was resumed from
+     *
+     * These are read by recentToken() but are not part of the output.
+     */
+    private $lookbehindTokens = array();
+
+    /**
+     * @brief Checkpoint bookkeeping while a scan is being checkpointed
+     *
+     * A map with the keys 'interval', 'recorded' (bytes recorded so far),
+     * 'line' and 'linePos' (the last line start seen and its line index) and
+     * 'next' (the line of the next checkpoint), or @c NULL.
+     */
+    private $checkpointing = null;
+
+    /**
+     * @brief The checkpoints taken so far
+     */
+    private $checkpoints = array();
+
+    /**
+     * @brief The property values after init(), which checkpoints are relative to
+     */
+    private $checkpointBaseline = null;
+
+    /**
+     * @brief Cache of class name => checkpointed properties
+     */
+    private static $checkpointProperties = array();
+
+    /**
+     * @brief The most tokens a checkpoint carries for $lookbehind, not
+     * counting comments and repeated whitespace
+     */
+    const LOOKBEHIND_TOKENS = 32;
+
+    /**
+     * @brief The most bytes of each token's string a checkpoint carries for
+     * $lookbehind
+     */
+    const LOOKBEHIND_BYTES = 64;
+
+    /**
+     * @brief Whether prepare() saves the state after init() for reuse
+     *
+     * @see makeReusable()
+     */
+    private $reusable = false;
+
+    /**
+     * @brief The property values after the first init(), or @c NULL
+     *
+     * Once this is set, prepare() restores these instead of calling init()
+     * again.
+     */
+    private $initialState = null;
+
     /**
      * constructor
      */
@@ -153,8 +304,8 @@ class Scanner extends StringScanner
 
         $this->addFilter('clean-ident', 'IDENT', array('Luminous\\Core\\Filters', 'cleanIdent'));
 
-        $this->addStreamFilter('rule-map', array($this, 'ruleMapperFilter'));
-        $this->addStreamFilter('oo-syntax', array('Luminous\\Core\\Filters', 'ooStreamFilter'));
+        $this->addStreamFilter('rule-map', array($this, 'ruleMapperFilter'), true);
+        $this->addStreamFilter('oo-syntax', array('Luminous\\Core\\Filters', 'ooStreamFilter'), true);
     }
 
     /**
@@ -199,6 +350,19 @@ class Scanner extends StringScanner
      */
     protected function ruleMapperFilter($tokens)
     {
+        if ($tokens instanceof TokenBuffer) {
+            $map = array();
+            foreach ($this->ruleTagMap as $from => $to) {
+                $map[TokenTypes::id($from === '' ? null : $from)] = $to;
+            }
+            $n = count($tokens);
+            for ($i = 0; $i < $n; $i++) {
+                if (array_key_exists($id = $tokens->typeId($i), $map)) {
+                    $tokens->setType($i, $map[$id]);
+                }
+            }
+            return $tokens;
+        }
         foreach ($tokens as &$t) {
             if (array_key_exists($t[0], $this->ruleTagMap)) {
                 $t[0] = $this->ruleTagMap[$t[0]];
@@ -220,12 +384,106 @@ class Scanner extends StringScanner
      */
     public function highlight($src)
     {
-        $this->string($src);
-        $this->init();
+        $this->prepare($src);
         $this->main();
         return $this->tagged();
     }
 
+    /**
+     * @brief Public convenience function for setting the string and scanning
+     * it into a filtered token stream
+     *
+     * As highlight(), but returns filteredTokens() instead of the XML string.
+     *
+     * @returns the token stream, as filteredTokens()
+     */
+    public function highlightTokens($src)
+    {
+        $this->prepare($src);
+        $this->main();
+        return $this->filteredTokens();
+    }
+
+    /**
+     * @brief Lets the scanner be reused for several sources
+     *
+     * The first prepare() after this saves the scanner's state once init()
+     * has run. Later calls restore that state instead of setting the scanner
+     * up again: the tokens, state stacks and user-defined identifiers are
+     * cleared, but the patterns, filters and identifier maps built by the
+     * constructor and init() are kept.
+     *
+     * @see Luminous::Scanners::acquireScanner()
+     */
+    public function makeReusable()
+    {
+        $this->reusable = true;
+    }
+
+    /**
+     * @brief Sets the string and sets up the scanner for main()
+     *
+     * This is string() followed by init(), except that a reusable scanner
+     * which has been prepared before is reset to its state after init()
+     * instead. See makeReusable().
+     *
+     * @param $src the source string
+     */
+    public function prepare($src)
+    {
+        if ($this->initialState !== null) {
+            $this->restoreInitialState($src);
+            return;
+        }
+        $this->string($src);
+        $this->init();
+        if ($this->reusable) {
+            $this->saveInitialState();
+        }
+    }
+
+    /**
+     * @brief Records the property values which prepare() restores
+     * @internal
+     */
+    private function saveInitialState()
+    {
+        $state = array();
+        foreach ($this->checkpointProperties() as $key => $p) {
+            $value = $p->getValue($this);
+            foreach (self::nestedScanners($value) as $scanner) {
+                $scanner->saveInitialState();
+            }
+            $state[$key] = $value;
+        }
+        $this->initialState = $state;
+    }
+
+    /**
+     * @brief Resets the scanner to its state after init(), and sets the
+     * string
+     *
+     * Sub-scanners held in properties are reset too, and given the same
+     * string. Subclasses which keep per-scan state in properties excluded from
+     * checkpoints (see checkpointIgnored()) should override this to clear it.
+     */
+    protected function restoreInitialState($src)
+    {
+        foreach ($this->checkpointProperties() as $key => $p) {
+            $value = $this->initialState[$key];
+            foreach (self::nestedScanners($value) as $scanner) {
+                $scanner->restoreInitialState($src);
+            }
+            $p->setValue($this, $value);
+        }
+        $this->tokens = array();
+        $this->tokenBuffer = null;
+        $this->lookbehindTokens = array();
+        $this->checkpoints = array();
+        $this->checkpointing = null;
+        $this->string($src);
+    }
+
     /**
      * @brief Set up the scanner immediately prior to tokenization.
      *
@@ -278,6 +536,7 @@ class Scanner extends StringScanner
             $this->filters[$token] = array();
         }
         $this->filters[$token][] = array($name, $filter);
+        $this->filterPipeline = null;
     }
 
     /**
@@ -292,6 +551,7 @@ class Scanner extends StringScanner
                 }
             }
         }
+        $this->filterPipeline = null;
     }
 
     /**
@@ -304,6 +564,7 @@ class Scanner extends StringScanner
                 unset($this->streamFilters[$k]);
             }
         }
+        $this->filterPipeline = null;
     }
 
     /**
@@ -311,9 +572,11 @@ class Scanner extends StringScanner
      *
      * A stream filter receives the entire token stream and should return it.
      *
-     * The parameters are: ([name], filter). Name is an optional argument.
+     * The parameters are: ([name], filter, [compact]). Name is an optional
+     * argument. If compact is @c TRUE, the filter also accepts (and returns) a
+     * TokenBuffer, see $compactTokens.
      */
-    public function addStreamFilter($arg1, $arg2 = null)
+    public function addStreamFilter($arg1, $arg2 = null, $compact = false)
     {
         $filter = null;
         $name = null;
@@ -323,7 +586,8 @@ class Scanner extends StringScanner
             $filter = $arg2;
             $name = $arg1;
         }
-        $this->streamFilters[] = array($name, $filter);
+        $this->streamFilters[] = array($name, $filter, $compact);
+        $this->filterPipeline = null;
     }
 
     /**
@@ -363,6 +627,22 @@ class Scanner extends StringScanner
     public function start()
     {
         $this->tokens = array();
+        $this->tokenBuffer = null;
+    }
+
+    /**
+     * @brief Getter and setter for the source string
+     *
+     * @see StringScanner::string()
+     */
+    public function string($s = null)
+    {
+        $src = parent::string($s);
+        if ($s !== null && $this->tokenBuffer !== null) {
+            // recorded ranges refer to the old string
+            $this->tokenBuffer->rebase($src);
+        }
+        return $src;
     }
 
     /**
@@ -381,7 +661,73 @@ class Scanner extends StringScanner
         if ($string === null) {
             throw new Exception('Tagging null string');
         }
-        $this->tokens[] = array($type, $string, $preEscaped);
+        if ($this->compactTokens) {
+            if ($this->tokenBuffer === null) {
+                $this->tokenBuffer = new TokenBuffer($this->string());
+            }
+            $this->tokenBuffer->addString($type, $string, $preEscaped);
+        } else {
+            $this->tokens[] = array($type, $string, $preEscaped);
+        }
+        // a checkpoint taken here includes this token in its lookbehind
+        if ($this->checkpointing !== null) {
+            $this->checkpointTick(
+                $preEscaped ? strlen(htmlspecialchars_decode(strip_tags($string), ENT_NOQUOTES)) : strlen($string)
+            );
+        }
+    }
+
+    /**
+     * @brief Gets a recently recorded token
+     *
+     * If the scan was resumed from a checkpoint, this continues into the
+     * tokens before the checkpoint, as far as the checkpoint kept them (see
+     * $lookbehind).
+     *
+     * @param $n how far back to look: 0 is the most recent token
+     * @return the token, or @c NULL if there aren't that many
+     */
+    protected function recentToken($n)
+    {
+        $c = count($this->tokens);
+        if ($n < $c) {
+            return $this->tokens[$c - 1 - $n];
+        }
+        $n -= $c;
+        $c = count($this->lookbehindTokens);
+        return ($n < $c) ? $this->lookbehindTokens[$c - 1 - $n] : null;
+    }
+
+    /**
+     * @brief Gets the recent tokens which a checkpoint carries
+     *
+     * These are the tokens back to the most recent one with a type, skipping
+     * comments, which every lookbehind skips, and runs of whitespace, which
+     * are all alike to them. Long strings are cut down to their end.
+     * @internal
+     */
+    private function lookbehindState()
+    {
+        $tokens = array();
+        $space = false;
+        for ($n = 0; count($tokens) < self::LOOKBEHIND_TOKENS && ($t = $this->recentToken($n)) !== null; $n++) {
+            if ($t[0] === 'COMMENT' || $t[0] === 'COMMENT_SL') {
+                continue;
+            }
+            $isSpace = $t[0] === null && ctype_space($t[1]);
+            if ($isSpace && $space) {
+                continue;
+            }
+            $space = $isSpace;
+            if (strlen($t[1]) > self::LOOKBEHIND_BYTES) {
+                $t[1] = substr($t[1], -self::LOOKBEHIND_BYTES);
+            }
+            $tokens[] = $t;
+            if ($t[0] !== null) {
+                break;
+            }
+        }
+        return array_reverse($tokens);
     }
 
     /**
@@ -403,6 +749,16 @@ class Scanner extends StringScanner
             return;
         }
         if ($to > $from) {
+            if ($this->compactTokens) {
+                if ($this->checkpointing !== null) {
+                    $this->checkpointTick($to - $from);
+                }
+                if ($this->tokenBuffer === null) {
+                    $this->tokenBuffer = new TokenBuffer($this->string());
+                }
+                $this->tokenBuffer->add($type, $from, $to - $from);
+                return;
+            }
             $this->record(substr($this->string(), $from, $to - $from), $type);
             return;
         }
@@ -417,34 +773,197 @@ class Scanner extends StringScanner
      */
     public function tagged()
     {
-        $out = '';
+        return Utils::tagTokens($this->filteredTokens());
+    }
 
-        // call stream filters.
-        foreach ($this->streamFilters as $f) {
-            $this->tokens = call_user_func($f[1], $this->tokens);
+    /**
+     * @brief Returns the token stream after all filters have been applied
+     *
+     * This runs the stream filters and the individual filters, exactly as
+     * tagged() does, but stops short of escaping and tagging the tokens. This
+     * is what a formatter which understands tokens (see
+     * Formatter::formatTokens()) is given, so it doesn't have to re-parse the
+     * XML string.
+     *
+     * @return An array of (type, string, escaped?) triples. Unescaped strings
+     *    are raw source text.
+     */
+    public function filteredTokens()
+    {
+        list($streamFilters, $ruleMap, $ooSyntax, $chains) = $this->compileFilters();
+        $buffer = $this->compactTokens ? $this->tokenBuffer : null;
+        // call the stream filters which can't be done token by token
+        foreach ($streamFilters as $f) {
+            if ($buffer !== null && !$f[2]) {
+                // this filter only understands token arrays
+                $this->tokens = $buffer->toArray();
+                $this->tokenBuffer = $buffer = null;
+            }
+            if ($buffer !== null) {
+                $buffer = call_user_func($f[1], $buffer);
+            } else {
+                $this->tokens = call_user_func($f[1], $this->tokens);
+            }
         }
-        foreach ($this->tokens as $t) {
-            $type = $t[0];
-
-            // speed is roughly 10% faster if we process the filters inside this
-            // loop instead of separately.
-            if (isset($this->filters[$type])) {
-                foreach ($this->filters[$type] as $filter) {
-                    $t = call_user_func($filter[1], $t);
+        if ($buffer !== null) {
+            return $this->filteredBuffer($buffer, $ruleMap, $ooSyntax, $chains);
+        }
+        $tokens = $this->tokens;
+        if (!$ruleMap && !$ooSyntax && empty($chains)) {
+            return $tokens;
+        }
+        if (!empty($streamFilters)) {
+            $tokens = array_values($tokens);
+        }
+        $map = $ruleMap ? $this->ruleTagMap : array();
+        $skip = false;
+        $c = count($tokens);
+        $out = array();
+        for ($i = 0; $i < $c; $i++) {
+            $t = $tokens[$i];
+            if ($map && array_key_exists($t[0], $map)) {
+                $t[0] = $map[$t[0]];
+            }
+            if ($skip) {
+                $skip = false;
+            } elseif ($ooSyntax && $t[0] === 'IDENT') {
+                // as Filters::ooStreamFilter(), which looks at the unfiltered
+                // neighbours
+                if ($i > 0 && isset(self::$ooOperators[$tokens[$i - 1][1]])) {
+                    $t[0] = 'OO';
+                    $skip = true;
+                } elseif ($i < $c - 1 && isset(self::$ooOperators[$tokens[$i + 1][1]])) {
+                    $t[0] = 'OBJ';
+                    $skip = true;
                 }
             }
-            list($type, $string, $esc) = $t;
+            if (isset($chains[$t[0]])) {
+                foreach ($chains[$t[0]] as $filter) {
+                    $t = call_user_func($filter, $t);
+                }
+            }
+            $out[] = $t;
+        }
+        return $out;
+    }
 
-            if (!$esc) {
-                $string = Utils::escapeString($string);
+    /**
+     * @brief Implementation of filteredTokens() for a TokenBuffer
+     *
+     * Token text is only extracted from the source here, and the filters are
+     * given triples only for token types which have filters bound.
+     *
+     * @internal
+     */
+    private function filteredBuffer($buffer, $ruleMap, $ooSyntax, $chains)
+    {
+        $map = $ruleMap ? $this->ruleTagMap : array();
+        $skip = false;
+        $tokens = array();
+        $n = count($buffer);
+        for ($i = 0; $i < $n; $i++) {
+            $type = $buffer->type($i);
+            if ($map && array_key_exists($type, $map)) {
+                $type = $map[$type];
             }
-            if ($type !== null) {
-                $out .= Utils::tagBlock($type, $string);
+            if ($skip) {
+                $skip = false;
+            } elseif ($ooSyntax && $type === 'IDENT') {
+                // an operator of more than two bytes can't be one we're
+                // looking for
+                if ($i > 0 && $buffer->length($i - 1) <= 2 && isset(self::$ooOperators[$buffer->text($i - 1)])) {
+                    $type = 'OO';
+                    $skip = true;
+                } elseif ($i < $n - 1 && $buffer->length($i + 1) <= 2
+                    && isset(self::$ooOperators[$buffer->text($i + 1)])
+                ) {
+                    $type = 'OBJ';
+                    $skip = true;
+                }
+            }
+            $t = array($type, $buffer->text($i), $buffer->escaped($i));
+            if (isset($chains[$type])) {
+                foreach ($chains[$type] as $filter) {
+                    $t = call_user_func($filter, $t);
+                }
+            }
+            $tokens[] = $t;
+        }
+        return $tokens;
+    }
+
+    /**
+     * @brief Compiles the filters into the form filteredTokens() runs
+     *
+     * The individual filters are grouped into a chain of callbacks per token
+     * type, leaving out types which have none. The built-in 'rule-map' and
+     * 'oo-syntax' stream filters look at one token at a time, so if they are
+     * the last stream filters they are folded into the same pass over the
+     * tokens as the individual filters instead of each walking the stream.
+     * Any other stream filters still get the whole stream, first.
+     *
+     * @return array(stream filters, rule map?, oo syntax?, type => callbacks)
+     * @internal
+     */
+    protected function compileFilters()
+    {
+        if ($this->filterPipeline !== null) {
+            return $this->filterPipeline;
+        }
+        $streamFilters = array_values($this->streamFilters);
+        $ruleMap = false;
+        $ooSyntax = false;
+        while (!empty($streamFilters)) {
+            $f = $streamFilters[count($streamFilters) - 1];
+            if (!$ruleMap && !$ooSyntax && $f[1] === array('Luminous\\Core\\Filters', 'ooStreamFilter')) {
+                $ooSyntax = true;
+            } elseif (!$ruleMap && $f[1] === array($this, 'ruleMapperFilter')) {
+                $ruleMap = true;
             } else {
-                $out .= $string;
+                break;
             }
+            array_pop($streamFilters);
         }
-        return $out;
+        $chains = array();
+        foreach ($this->filters as $type => $filters) {
+            foreach ($filters as $filter) {
+                $chains[$type][] = $filter[1];
+            }
+        }
+        $this->filterPipeline = array($streamFilters, $ruleMap, $ooSyntax, $chains);
+        return $this->filterPipeline;
+    }
+
+    /**
+     * @brief Whether the token stream can be filtered a line at a time
+     *
+     * The built-in stream filters only look at a token's immediate
+     * neighbours, and never act on a token which ends in a newline. So if
+     * they are the only stream filters, filtering a source's tokens in pieces
+     * which end at line ends gives the same result as filtering them all at
+     * once. Other stream filters may look anywhere in the stream, and so may
+     * the user-defs filter if the scanner records definitions.
+     */
+    public function filtersByLine()
+    {
+        if ($this->recordsUserDefs) {
+            return false;
+        }
+        list($streamFilters) = $this->compileFilters();
+        return empty($streamFilters);
+    }
+
+    /**
+     * @brief Whether the scanner records definitions, which change how names
+     * anywhere in the source are highlighted
+     *
+     * If so, highlighting part of a source only gives the same output as
+     * highlighting all of it if the scan carries on to the end of the
+     * source.
+     */
+    public function recordsUserDefs()
+    {
+        return $this->recordsUserDefs;
     }
 
     /**
@@ -453,9 +972,296 @@ class Scanner extends StringScanner
      */
     public function tokenArray()
     {
+        if ($this->tokenBuffer !== null) {
+            return $this->tokenBuffer->toArray();
+        }
         return $this->tokens;
     }
 
+    /**
+     * @brief Replaces the recorded token stream
+     *
+     * This lets a token stream which was recorded earlier (and possibly
+     * spliced together from several scans) be run through this scanner's
+     * filters, i.e. it is the inverse of tokenArray().
+     *
+     * @param $tokens An array of (type, string, escaped?) triples
+     */
+    public function setTokens($tokens)
+    {
+        $this->tokens = $tokens;
+        $this->tokenBuffer = null;
+    }
+
+    /**
+     * @brief Starts taking checkpoints during the scan
+     *
+     * Call this after init() and before main() (and before restoreCheckpoint(),
+     * if resuming). Every $interval lines, at the first line start where
+     * everything before has been recorded, the scanner saves its state as a
+     * checkpoint. A checkpoint can be given to restoreCheckpoint() on a fresh
+     * scanner with the same source, which then continues from that line.
+     *
+     * Checkpoints are arrays of scalars and arrays, so can be serialized. Only
+     * the properties which differ from their values after init() are saved,
+     * so they are generally small. Sub-scanners held in properties are saved
+     * recursively.
+     *
+     * If the scanner isn't checkpointable, no checkpoints are taken.
+     *
+     * @param $interval the minimum number of lines between checkpoints
+     */
+    public function enableCheckpoints($interval)
+    {
+        $this->checkpoints = array();
+        $this->checkpointing = null;
+        if (!$this->checkpointable || $interval <= 0) {
+            return;
+        }
+        $this->takeCheckpointBaseline();
+        $this->checkpointing = array(
+            'interval' => $interval,
+            'recorded' => 0,
+            'line' => 0,
+            'linePos' => 0,
+            'next' => $interval
+        );
+    }
+
+    /**
+     * @brief Whether the scanner can take checkpoints
+     *
+     * If not, enableCheckpoints() has no effect.
+     */
+    public function checkpointable()
+    {
+        return $this->checkpointable;
+    }
+
+    /**
+     * @brief Gets the checkpoints taken so far
+     *
+     * @return A list of checkpoints in source order. Each is a map with the
+     *    keys 'line' (the zero-based line index it was taken at), 'pos' (the
+     *    byte offset of that line) and 'state'.
+     */
+    public function checkpoints()
+    {
+        return $this->checkpoints;
+    }
+
+    /**
+     * @brief Restores the scanner to a checkpoint
+     *
+     * The scanner should be freshly set up with string() and init(), for the
+     * same source the checkpoint was taken on (or one which is identical up to
+     * the checkpoint). After this, main() continues scanning from the
+     * checkpoint, and records tokens for the rest of the source only.
+     *
+     * @param $checkpoint a checkpoint returned by checkpoints()
+     */
+    public function restoreCheckpoint($checkpoint)
+    {
+        $this->restoreCheckpointState($checkpoint['state']);
+        $this->pos($checkpoint['pos']);
+        if ($this->checkpointing !== null) {
+            $this->checkpointing['recorded'] = $checkpoint['pos'];
+            $this->checkpointing['line'] = $checkpoint['line'];
+            $this->checkpointing['linePos'] = $checkpoint['pos'];
+            $this->checkpointing['next'] = $checkpoint['line'] + $this->checkpointing['interval'];
+        }
+    }
+
+    /**
+     * @brief Notes that $length bytes were recorded, and takes a checkpoint if
+     * one is due
+     * @internal
+     */
+    protected function checkpointTick($length)
+    {
+        if ($this->checkpointing === null) {
+            return;
+        }
+        $cp = &$this->checkpointing;
+        $cp['recorded'] += $length;
+        $pos = $this->pos();
+        if ($pos !== $cp['recorded'] || $pos <= $cp['linePos']) {
+            return;
+        }
+        $src = $this->string();
+        if ($src[$pos - 1] !== "\n") {
+            return;
+        }
+        $cp['line'] += substr_count($src, "\n", $cp['linePos'], $pos - $cp['linePos']);
+        $cp['linePos'] = $pos;
+        if ($cp['line'] >= $cp['next']) {
+            $this->checkpoints[] = array('line' => $cp['line'], 'pos' => $pos, 'state' => $this->checkpointState());
+            $cp['next'] = $cp['line'] + $cp['interval'];
+        }
+    }
+
+    /**
+     * @brief Names of properties which are not part of a checkpoint
+     *
+     * These are the output, configuration which is not changed by scanning,
+     * and caches. Subclasses may add to this.
+     */
+    protected function checkpointIgnored()
+    {
+        return array(
+            'tokens', 'tokenBuffer', 'filters', 'streamFilters', 'version',
+            'checkpointable', 'checkpointing', 'checkpoints', 'checkpointBaseline',
+            'reusable', 'initialState', 'filterPipeline', 'lookbehind', 'lookbehindTokens', 'recordsUserDefs'
+        );
+    }
+
+    /**
+     * @brief Gets the properties which make up a checkpoint
+     *
+     * This is every non-static property of the scanner's class hierarchy down
+     * to (but not including) StringScanner, whose only state is the position.
+     *
+     * @return A map of 'Class::property' => ReflectionProperty
+     * @internal
+     */
+    private function checkpointProperties()
+    {
+        $className = get_class($this);
+        if (isset(self::$checkpointProperties[$className])) {
+            return self::$checkpointProperties[$className];
+        }
+        $ignored = array_flip($this->checkpointIgnored());
+        $properties = array();
+        for ($class = new ReflectionClass($this); $class !== false; $class = $class->getParentClass()) {
+            $name = $class->getName();
+            if ($name === 'Luminous\\Core\\Scanners\\StringScanner') {
+                break;
+            }
+            foreach ($class->getProperties() as $p) {
+                if ($p->isStatic() || $p->getDeclaringClass()->getName() !== $name
+                    || isset($ignored[$p->getName()])
+                ) {
+                    continue;
+                }
+                $p->setAccessible(true);
+                $properties[$name . '::' . $p->getName()] = $p;
+            }
+        }
+        self::$checkpointProperties[$className] = $properties;
+        return $properties;
+    }
+
+    /**
+     * @brief Gets the sub-scanners held in a property value
+     * @internal
+     */
+    private static function nestedScanners($value)
+    {
+        if ($value instanceof Scanner) {
+            return array($value);
+        }
+        if (!is_array($value) || empty($value)) {
+            return array();
+        }
+        foreach ($value as $v) {
+            if (!($v instanceof Scanner)) {
+                return array();
+            }
+        }
+        return $value;
+    }
+
+    /**
+     * @brief Records the property values which checkpoints are relative to
+     * @internal
+     */
+    private function takeCheckpointBaseline()
+    {
+        $baseline = array();
+        foreach ($this->checkpointProperties() as $key => $p) {
+            $value = $p->getValue($this);
+            foreach (self::nestedScanners($value) as $scanner) {
+                $scanner->takeCheckpointBaseline();
+            }
+            $baseline[$key] = $value;
+        }
+        $this->checkpointBaseline = $baseline;
+    }
+
+    /**
+     * @brief Gets the scanner's current state, for a checkpoint
+     *
+     * @return A map of property => value, of the properties which have changed
+     *    since the baseline. Sub-scanners are replaced by their own state.
+     *    This is empty in the scanner's initial state.
+     */
+    protected function checkpointState()
+    {
+        $state = array();
+        foreach ($this->checkpointProperties() as $key => $p) {
+            $value = $p->getValue($this);
+            if ($value instanceof Scanner) {
+                $value = $value->checkpointState();
+                if (empty($value)) {
+                    continue;
+                }
+            } elseif (($nested = self::nestedScanners($value))) {
+                $changed = false;
+                foreach ($nested as $k => $scanner) {
+                    $value[$k] = $scanner->checkpointState();
+                    $changed = $changed || !empty($value[$k]);
+                }
+                if (!$changed) {
+                    continue;
+                }
+            } elseif (is_object($value)) {
+                continue;
+            } elseif ($this->checkpointBaseline !== null
+                && array_key_exists($key, $this->checkpointBaseline)
+                && $this->checkpointBaseline[$key] === $value
+            ) {
+                continue;
+            }
+            $state[$key] = $value;
+        }
+        // only the scanner being checkpointed is in the middle of main(); a
+        // sub-scanner flushes its tokens when it is next run
+        if ($this->lookbehind && $this->checkpointing !== null && ($tokens = $this->lookbehindState())) {
+            $state['lookbehind'] = $tokens;
+        }
+        return $state;
+    }
+
+    /**
+     * @brief Restores state returned by checkpointState()
+     */
+    protected function restoreCheckpointState($state)
+    {
+        if (isset($state['lookbehind'])) {
+            $this->lookbehindTokens = $state['lookbehind'];
+            unset($state['lookbehind']);
+        }
+        $properties = $this->checkpointProperties();
+        foreach ($state as $key => $value) {
+            if (!isset($properties[$key])) {
+                continue;
+            }
+            $p = $properties[$key];
+            $current = $p->getValue($this);
+            if ($current instanceof Scanner) {
+                $current->restoreCheckpointState($value);
+            } elseif (($nested = self::nestedScanners($current))) {
+                foreach ($value as $k => $s) {
+                    if (isset($nested[$k])) {
+                        $nested[$k]->restoreCheckpointState($s);
+                    }
+                }
+            } else {
+                $p->setValue($this, $value);
+            }
+        }
+    }
+
     /**
      * @brief Identifier mapping filter
      *
@@ -465,15 +1271,9 @@ class Scanner extends StringScanner
      */
     public function mapIdentifierFilter($token)
     {
-        $ident = $token[1];
-        if (!$this->caseSensitive) {
-            $ident = strtolower($ident);
-        }
-        foreach ($this->identMap as $n => $hits) {
-            if (isset($hits[$ident])) {
-                $token[0] = $n;
-                break;
-            }
+        $ident = $this->caseSensitive ? $token[1] : strtolower($token[1]);
+        if (isset($this->identMap[$ident])) {
+            $token[0] = $this->identMap[$ident];
         }
         return $token;
     }
@@ -488,17 +1288,59 @@ class Scanner extends StringScanner
      */
     public function addIdentifierMapping($name, $matches)
     {
-        $array = array();
+        $rank = $this->identifierRank($name);
         foreach ($matches as $m) {
             if (!$this->caseSensitive) {
                 $m = strtolower($m);
             }
-            $array[$m] = true;
+            if (!isset($this->identMap[$m]) || $this->identRanks[$this->identMap[$m]] > $rank) {
+                $this->identMap[$m] = $name;
+            }
         }
-        if (!isset($this->identMap[$name])) {
-            $this->identMap[$name] = array();
+    }
+
+    /**
+     * @brief Adds a precompiled map of identifiers to token names
+     *
+     * This is the same as calling addIdentifierMapping() for each of $names
+     * in turn, but the map is already built (see the generated classes in
+     * Luminous\Scanners\Keywords), so if it is the first mapping to be added
+     * it is used as it is. The identifiers must already be lower case if the
+     * scanner is case insensitive.
+     *
+     * @param $names the token names in the map, in the order they take
+     *    precedence
+     * @param $map a map of identifier_string => TOKEN_NAME
+     */
+    public function addIdentifierMap($names, $map)
+    {
+        if (empty($this->identRanks)) {
+            $this->identRanks = array_flip($names);
+            $this->identMap = $map;
+            return;
+        }
+        foreach ($names as $name) {
+            $this->identifierRank($name);
+        }
+        foreach ($map as $ident => $name) {
+            $rank = $this->identRanks[$name];
+            if (!isset($this->identMap[$ident]) || $this->identRanks[$this->identMap[$ident]] > $rank) {
+                $this->identMap[$ident] = $name;
+            }
+        }
+    }
+
+    /**
+     * @brief Gets the precedence of a token name in the identifier map,
+     * adding it if it is new
+     * @internal
+     */
+    private function identifierRank($name)
+    {
+        if (!isset($this->identRanks[$name])) {
+            $this->identRanks[$name] = count($this->identRanks);
         }
-        $this->identMap[$name] = array_merge($this->identMap[$name], $array);
+        return $this->identRanks[$name];
     }
 
     /**
@@ -30,16 +30,28 @@ class SimpleScanner extends Scanner
      */
     protected $overrides = array();
 
+    /**
+     * @brief Rule tables are fused into a single expression
+     *
+     * @see StringScanner::$compilePatterns
+     */
+    protected $compilePatterns = true;
+
+    /**
+     * @brief Tokens are recorded as ranges of the source
+     *
+     * @see Scanner::$compactTokens
+     */
+    protected $compactTokens = true;
+
     public function main()
     {
         while (!$this->eos()) {
             $index = $this->pos();
-            if (($match = $this->nextMatch()) !== null) {
-                $tok = $match[0];
-                if ($match[1] > $index) {
-                    $this->record(substr($this->string(), $index, $match[1] - $index), null);
+            if (($tok = $this->nextMatchRange($start, $length)) !== null) {
+                if ($start > $index) {
+                    $this->recordRange($index, $start, null);
                 }
-                $match = $this->match();
                 if (isset($this->overrides[$tok])) {
                     $groups = $this->matchGroups();
                     $this->unscan();
@@ -51,8 +63,10 @@ class SimpleScanner extends Scanner
                     if ($this->pos() <= $p) {
                         throw new Exception('Failed to consume any string in override for ' . $tok);
                     }
+                } elseif ($this->compactTokens) {
+                    $this->recordRange($start, $start + $length, $tok);
                 } else {
-                    $this->record($match, $tok);
+                    $this->record($this->match(), $tok);
                 }
             } else {
                 $this->record(substr($this->string(), $index), null);
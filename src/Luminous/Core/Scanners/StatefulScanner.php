@@ -15,13 +15,10 @@ use Luminous\Core\Utils;
  * token tree. As such, the states follow a hierarchical parent->child
  * relationship rather than a strict from->to
  *
- * A node in the token tree looks like this:
- *
- * @code array('token_name' => 'name','children' => array(...)) @endcode
- *
- * Children is an ordered list and its elements may be either other token
- * nodes or just strings. We override tagged to try to collapse this into XML
- * while still applying filters.
+ * The token tree is stored flat, as a list of events: text recorded into the
+ * innermost open node, a node opening, or the innermost open node closing.
+ * We override tagged to collapse this into XML while still applying filters.
+ * See tokenTree() for the tree as nested arrays.
  *
  *
  * We now store patterns as the following tuple:
@@ -62,15 +59,30 @@ class StatefulScanner extends SimpleScanner
     protected $patterns = array();
 
     /**
-     * @brief The token tree
+     * @brief The token tree, as a flat list of events
      *
-     * The tokens we end up with are a tree which we build as we go along. The
-     * easiest way to build it is to keep track of the currently active node on
-     * top of a stack. When the node is completed, we pop it and insert it as
-     * a child of the element which is now at the top of the stack.
+     * The tokens we end up with are a tree which we build as we go along. Each
+     * element is a string of text recorded into the innermost open node, the
+     * index of a node being opened (see $nodeNames), or -1 for the innermost
+     * open node being closed.
      *
-     * At the end of the process we end up with one element in here which is
-     * the root node.
+     * This holds far less memory than nesting an array per node, and can be
+     * collapsed without recursion.
+     */
+    protected $treeEvents = array();
+
+    /**
+     * @brief The token name of each node in the tree, by index
+     *
+     * Node 0 is the root.
+     */
+    protected $nodeNames = array();
+
+    /**
+     * @brief The indices of the open nodes in the token tree
+     *
+     * The innermost node is on top of the stack. At the end of the process the
+     * only one left is the root node.
      */
     protected $tokenTreeStack = array();
 
@@ -91,17 +103,41 @@ class StatefulScanner extends SimpleScanner
      */
     private $transitionRuleCache = array();
 
+    /**
+     * Cache of compiled per-state tables, keyed by state name and termination
+     * pattern.
+     * @see nextTransitionData()
+     */
+    private $transitionTableCache = array();
+
+    /**
+     * Opens a new node in the token tree as a child of the currently active
+     * node
+     *
+     * @see pushState
+     * @internal
+     */
+    public function openNode($tokenName)
+    {
+        $node = count($this->nodeNames);
+        $this->nodeNames[] = $tokenName;
+        $this->treeEvents[] = $node;
+        $this->tokenTreeStack[] = $node;
+    }
+
     /**
      * Pushes a new token onto the stack as a child of the currently active
      * token
      *
-     * @see push_state
+     * @param $child a node array, array('token_name' => name, 'children' =>
+     *    array()). Its children are ignored.
+     * @deprecated use openNode()
      * @internal
      */
     public function pushChild($child)
     {
         assert(!empty($this->tokenTreeStack));
-        $this->tokenTreeStack[] = $child;
+        $this->openNode($child['token_name']);
     }
 
     /**
@@ -116,16 +152,15 @@ class StatefulScanner extends SimpleScanner
      */
     public function pushState($stateData)
     {
-        $tokenNode = array('token_name' => $stateData[0], 'children' => array());
-        $this->pushChild($tokenNode);
+        $this->openNode($stateData[0]);
         $this->push($stateData);
     }
 
     /**
      * @brief Pops a state from the stack.
      *
-     * The top token on the token_tree_stack is popped and appended as a child to
-     * the new top token.
+     * The top token on the token_tree_stack is closed, leaving it a complete
+     * child of the new top token.
      *
      * The top state on the state stack is popped and discarded.
      * @throw Exception if there is only the initial state on the stack
@@ -133,13 +168,11 @@ class StatefulScanner extends SimpleScanner
      */
     public function popState()
     {
-        $c = count($this->tokenTreeStack);
-        if ($c <= 1) {
+        if (count($this->tokenTreeStack) <= 1) {
             throw new Exception('Attempted to pop the initial state');
         }
-        $s = array_pop($this->tokenTreeStack);
-        // -2 because we popped once since counting
-        $this->tokenTreeStack[$c - 2]['children'][] = $s;
+        array_pop($this->tokenTreeStack);
+        $this->treeEvents[] = -1;
         $this->pop();
     }
 
@@ -235,18 +268,31 @@ class StatefulScanner extends SimpleScanner
      */
     public function nextStartData()
     {
-        $patterns = array();
-        $states = array();
+        list($patterns, $states) = $this->transitionRules();
+        $next = $this->getNextNamed($patterns);
+        // map to real state data
+        if ($next[1] !== -1) {
+            $next[0] = $states[$next[0]];
+        }
+        return $next;
+    }
+
+    /**
+     * @brief Gets the opening patterns legal in the current state
+     *
+     * @returns A tuple of (patterns, states): patterns is a list of opening
+     * patterns, and states holds the full pattern data at the same indices.
+     * @internal
+     */
+    protected function transitionRules()
+    {
         $sn = $this->stateName();
-        // at the moment we are using get_next_named, so we have to convert
-        // our patterns into key=>pattern so it can return to us a key. We use
-        // numerical indices which also correspond with 'states' for full pattern
-        // data. We are caching this.
-        // TODO turns out get_next_named is pretty slow and we'd be better off
-        // caching some results inside the pattern data
-        if (isset($this->transitionRuleCache[$sn])) {
-            list($patterns, $states) = $this->transitionRuleCache[$sn];
-        } else {
+        // we have to convert our patterns into key=>pattern so the search can
+        // return to us a key. We use numerical indices which also correspond
+        // with 'states' for full pattern data. We are caching this.
+        if (!isset($this->transitionRuleCache[$sn])) {
+            $patterns = array();
+            $states = array();
             foreach ($this->legalTransitions as $t) {
                 foreach ($this->patterns as $p) {
                     if ($p[0] === $t) {
@@ -257,12 +303,46 @@ class StatefulScanner extends SimpleScanner
             }
             $this->transitionRuleCache[$sn] = array($patterns, $states);
         }
-        $next = $this->getNextNamed($patterns);
-        // map to real state data
-        if ($next[1] !== -1) {
-            $next[0] = $states[$next[0]];
+        return $this->transitionRuleCache[$sn];
+    }
+
+    /**
+     * @brief Looks for the next state transition or state end, whichever is first
+     *
+     * This is equivalent to calling nextStartData() and nextEndData() and
+     * picking the nearest, with a transition winning a tie, but the opening
+     * patterns of the current state and its termination pattern are compiled
+     * into a single expression so each step costs one match.
+     *
+     * @returns A tuple of (pattern_data, next, matches, end, end_matches).
+     * At most one of next and end is not -1; if a transition was found,
+     * pattern_data and matches describe it, else if the state ended end and
+     * end_matches describe that.
+     */
+    public function nextTransitionData()
+    {
+        $stateData = $this->state();
+        $termPattern = ($stateData === null) ? null : $stateData[2];
+        $cacheKey = $this->stateName() . "\0" . $termPattern;
+        if (!isset($this->transitionTableCache[$cacheKey])) {
+            list($patterns, $states) = $this->transitionRules();
+            if ($termPattern !== null) {
+                $patterns['end'] = $termPattern;
+            }
+            $this->transitionTableCache[$cacheKey] = array(
+                self::compileAlternation($patterns),
+                $patterns,
+                $states
+            );
         }
-        return $next;
+        list($table, $patterns, $states) = $this->transitionTableCache[$cacheKey];
+        list($key, $index, $matches) = $this->getNextNamedCompiled($table, $patterns);
+        if ($index === -1) {
+            return array(null, -1, null, -1, null);
+        } elseif ($key === 'end') {
+            return array(null, -1, null, $index, $matches);
+        }
+        return array($states[$key], $index, $matches, -1, null);
     }
 
     /**
@@ -286,10 +366,75 @@ class StatefulScanner extends SimpleScanner
             }
             $this->transitions['initial'] = $initial;
         }
-        $this->tokenTreeStack[] = array('token_name' => 'initial', 'children' => array());
+        $this->openNode('initial');
         $this->ruleTagMap['initial'] = null;
     }
 
+    /**
+     * The token tree is saved in checkpoints as just the names of the open
+     * nodes, and the rest are caches.
+     */
+    protected function checkpointIgnored()
+    {
+        return array_merge(
+            parent::checkpointIgnored(),
+            array('treeEvents', 'nodeNames', 'tokenTreeStack', 'setup', 'lastState', 'legalTransitions',
+                'transitionRuleCache', 'transitionTableCache')
+        );
+    }
+
+    protected function checkpointState()
+    {
+        $state = parent::checkpointState();
+        $open = array();
+        foreach ($this->tokenTreeStack as $node) {
+            $open[] = $this->nodeNames[$node];
+        }
+        // leave the state empty when the scanner is in its initial state
+        if ($open !== array('initial')) {
+            $state['tokenTreeStack'] = $open;
+        }
+        return $state;
+    }
+
+    /**
+     * The open nodes of the token tree are restored empty, so the resumed
+     * output reopens them.
+     */
+    protected function restoreCheckpointState($state)
+    {
+        $open = null;
+        if (isset($state['tokenTreeStack'])) {
+            $open = $state['tokenTreeStack'];
+            unset($state['tokenTreeStack']);
+        }
+        parent::restoreCheckpointState($state);
+        $this->setup();
+        if ($open !== null) {
+            $this->treeEvents = array();
+            $this->nodeNames = array();
+            $this->tokenTreeStack = array();
+            foreach ($open as $name) {
+                $this->openNode($name);
+            }
+        }
+    }
+
+    /**
+     * The token tree is cleared and the FSM is set up again by the next
+     * main(), but the per-state caches are kept.
+     */
+    protected function restoreInitialState($src)
+    {
+        parent::restoreInitialState($src);
+        $this->setup = false;
+        $this->lastState = null;
+        $this->legalTransitions = array();
+        $this->treeEvents = array();
+        $this->nodeNames = array();
+        $this->tokenTreeStack = array();
+    }
+
     /**
      * Records a string as a child of the currently active token
      * @warning the second and third parameters are not applicable to this
@@ -304,10 +449,8 @@ class StatefulScanner extends SimpleScanner
                 . 'parameters'
             );
         }
-        // NOTE to self: if ever this needs to change, don't call count on $c.
-        // Dereference it first: http://bugs.php.net/bug.php?id=34540
-        $c = &$this->tokenTreeStack[count($this->tokenTreeStack) - 1]['children'];
-        $c[] = $str;
+        $this->checkpointTick(strlen($str));
+        $this->treeEvents[] = (string)$str;
     }
 
     /**
@@ -366,8 +509,8 @@ class StatefulScanner extends SimpleScanner
             $state = $this->stateName();
 
             $this->loadTransitions();
-            list($nextPatternData, $nextPatternIndex, $nextPatternMatches) = $this->nextStartData();
-            list($endIndex, $endMatches) = $this->nextEndData();
+            list($nextPatternData, $nextPatternIndex, $nextPatternMatches, $endIndex, $endMatches)
+                = $this->nextTransitionData();
 
             if (($nextPatternIndex <= $endIndex || $endIndex === -1) && $nextPatternIndex !== -1) {
                 // we're pushing a new state
@@ -419,33 +562,55 @@ class StatefulScanner extends SimpleScanner
         while (count($this->tokenTreeStack) > 1) {
             $this->popState();
         }
-
-        return $this->tokenTreeStack[0];
     }
 
     /**
-     * Recursive function to collapse the token tree into XML
+     * Collapses the token tree into XML
+     *
+     * Each node's text is built up as its events are read, and when it closes
+     * it is filtered, tagged and appended to its parent's text. Nodes which
+     * are still open at the end are closed.
      * @internal
      */
-    protected function collapseTokenTree($node)
+    protected function collapseTokenTree()
     {
-        $text = '';
-        foreach ($node['children'] as $c) {
-            if (is_string($c)) {
-                $text .= Utils::escapeString($c);
+        list(, , , $chains) = $this->compileFilters();
+        // the name and text of each open node, innermost last
+        $names = array();
+        $texts = array();
+        $depth = -1;
+        foreach ($this->treeEvents as $e) {
+            if (is_string($e)) {
+                $texts[$depth] .= Utils::escapeString($e);
+            } elseif ($e >= 0) {
+                $depth++;
+                $names[$depth] = $this->nodeNames[$e];
+                $texts[$depth] = '';
             } else {
-                $text .= $this->collapseTokenTree($c);
+                $text = $this->collapseNode($names[$depth], $texts[$depth], $chains);
+                $depth--;
+                $texts[$depth] .= $text;
             }
         }
-        $tokenName = $node['token_name'];
-        $token = array($node['token_name'], $text, true);
-
-        $token_ = $this->ruleMapperFilter(array($token));
-        $token = $token_[0];
+        for (; $depth > 0; $depth--) {
+            $texts[$depth - 1] .= $this->collapseNode($names[$depth], $texts[$depth], $chains);
+        }
+        return ($depth === 0) ? $this->collapseNode($names[0], $texts[0], $chains) : '';
+    }
 
-        if (isset($this->filters[$tokenName])) {
-            foreach ($this->filters[$tokenName] as $filter) {
-                $token = call_user_func($filter[1], $token);
+    /**
+     * Filters and tags the text of a node
+     * @internal
+     */
+    private function collapseNode($tokenName, $text, $chains)
+    {
+        $token = array($tokenName, $text, true);
+        if (array_key_exists($tokenName, $this->ruleTagMap)) {
+            $token[0] = $this->ruleTagMap[$tokenName];
+        }
+        if (isset($chains[$tokenName])) {
+            foreach ($chains[$tokenName] as $filter) {
+                $token = call_user_func($filter, $token);
             }
         }
         list($tokenName, $text,) = $token;
@@ -454,8 +619,55 @@ class StatefulScanner extends SimpleScanner
 
     public function tagged()
     {
-        $stream = $this->collapseTokenTree($this->tokenTreeStack[0]);
-        return $stream;
+        return $this->collapseTokenTree();
+    }
+
+    /**
+     * @brief Gets a node of the token tree as nested arrays
+     *
+     * This builds the tree the slow way, for debugging and tests.
+     *
+     * @param $node the node index, by default the root
+     * @return array('token_name' => name, 'children' => array(...)), where the
+     *    children are strings of text and child nodes in order
+     */
+    public function tokenTree($node = 0)
+    {
+        $stack = array();
+        $started = false;
+        foreach ($this->treeEvents as $e) {
+            if (!$started) {
+                if ($e !== $node) {
+                    continue;
+                }
+                $started = true;
+            }
+            if (is_string($e)) {
+                $stack[count($stack) - 1]['children'][] = $e;
+            } elseif ($e >= 0) {
+                $stack[] = array('token_name' => $this->nodeNames[$e], 'children' => array());
+            } else {
+                $child = array_pop($stack);
+                if (empty($stack)) {
+                    return $child;
+                }
+                $stack[count($stack) - 1]['children'][] = $child;
+            }
+        }
+        while (count($stack) > 1) {
+            $child = array_pop($stack);
+            $stack[count($stack) - 1]['children'][] = $child;
+        }
+        return empty($stack) ? null : $stack[0];
+    }
+
+    /**
+     * @brief The token tree is collapsed straight to XML, so the stream is a
+     * single pre-escaped token
+     */
+    public function filteredTokens()
+    {
+        return array(array(null, $this->tagged(), true));
     }
 }
 
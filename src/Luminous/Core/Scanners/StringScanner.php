@@ -51,7 +51,15 @@ class StringScanner
      *
      *  0 => Scan pointer when the match was found,
      *  1 => Match index (probably the same as scan pointer, but not necessarily),
-     *  2 => Match data (match groups, as map, as returned by PCRE)
+     *  2 => Match data (match groups, as map, as returned by PCRE), or
+     *       @c NULL if it is yet to be built from 3,
+     *  3 => Raw match data (as returned by PCRE with PREG_OFFSET_CAPTURE), or
+     *       @c NULL,
+     *  4, 5 => The first and last raw groups belonging to the match, or
+     *       @c NULL if they all do (see offsetGroups()).
+     *
+     * Matches found by nextMatchRange() are logged raw, so that the groups
+     * are only built if something asks for them.
      *
      * @note Numerical indices are used for performance.
      */
@@ -67,6 +75,29 @@ class StringScanner
      */
     private $patterns = array();
 
+    /**
+     * @brief Whether nextMatch() fuses the predefined patterns into one regex
+     *
+     * When this is @c TRUE, the patterns added with addPattern() are compiled
+     * into a single alternation, so each call to nextMatch() costs one regex
+     * execution instead of one per pattern. The result is the same: the
+     * leftmost match wins, and ties go to the pattern which was added first.
+     *
+     * Patterns which cannot be moved into an alternation safely (those with
+     * back-references, named groups or modifiers that have no inline form)
+     * are still searched individually alongside the fused expression.
+     */
+    protected $compilePatterns = false;
+
+    /**
+     * @brief The compiled pattern table, see compileAlternation()
+     *
+     * This is @c NULL until nextMatch() first needs it, and is reset whenever
+     * the pattern list changes. Otherwise it is array(table, key => pattern,
+     * key => prefilter hint).
+     */
+    private $compiled = null;
+
     /**
      * constructor
      */
@@ -166,6 +197,12 @@ class StringScanner
         $this->pos(0);
         $this->matchHistory = array(null, null);
         $this->ss = new StringSearch($this->src);
+        // each pattern's next match was found in the old string
+        foreach ($this->patterns as &$p) {
+            $p[2] = -1;
+            $p[3] = null;
+        }
+        unset($p);
     }
 
     /**
@@ -259,7 +296,8 @@ class StringScanner
     {
         // $index = false;
         if (isset($this->matchHistory[0])) {
-            return $this->matchHistory[0][2][0];
+            $h = $this->matchHistory[0];
+            return ($h[2] === null && $h[3] !== null) ? $h[3][0][0] : $h[2][0];
         }
         throw new Exception('match history empty');
     }
@@ -277,7 +315,7 @@ class StringScanner
     public function matchGroups()
     {
         if (isset($this->matchHistory[0])) {
-            return $this->matchHistory[0][2];
+            return $this->historyGroups();
         }
         throw new Exception('match history empty');
     }
@@ -298,9 +336,9 @@ class StringScanner
     public function matchGroup($g = 0)
     {
         if (isset($this->matchHistory[0])) {
-            if (isset($this->matchHistory[0][2])) {
-                if (isset($this->matchHistory[0][2][$g])) {
-                    return $this->matchHistory[0][2][$g];
+            if (($groups = $this->historyGroups()) !== null) {
+                if (isset($groups[$g])) {
+                    return $groups[$g];
                 }
                 throw new Exception("No such group '$g'");
             }
@@ -329,7 +367,7 @@ class StringScanner
      *
      * @internal
      */
-    private function logMatch($index, $matchPos, $matchData)
+    private function logMatch($index, $matchPos, $matchData, $raw = null, $first = null, $last = null)
     {
         if (isset($this->matchHistory[0])) {
             $this->matchHistory[1] = $this->matchHistory[0];
@@ -338,6 +376,50 @@ class StringScanner
         $m[0] = $index;
         $m[1] = $matchPos;
         $m[2] = $matchData;
+        $m[3] = $raw;
+        $m[4] = $first;
+        $m[5] = $last;
+    }
+
+    /**
+     * @brief Helper function to get the groups of the most recent match,
+     * building them from the raw match data if they haven't been already
+     *
+     * @internal
+     */
+    private function historyGroups()
+    {
+        $m = &$this->matchHistory[0];
+        if ($m[2] === null && $m[3] !== null) {
+            $m[2] = self::offsetGroups($m[3], $m[4], $m[5]);
+        }
+        return $m[2];
+    }
+
+    /**
+     * @brief Builds match groups from raw (PREG_OFFSET_CAPTURE) match data
+     *
+     * @param $raw The raw match data
+     * @param $first The first group belonging to the match, or @c NULL if all
+     * of them do
+     * @param $last The last group belonging to the match
+     * @return The groups, as preg_match would return them without offsets
+     * @internal
+     */
+    private static function offsetGroups($raw, $first, $last)
+    {
+        $groups = array();
+        if ($first === null) {
+            foreach ($raw as $k => $g) {
+                $groups[$k] = $g[0];
+            }
+            return $groups;
+        }
+        $groups[] = $raw[0][0];
+        for ($g = $first; $g <= $last; $g++) {
+            $groups[] = $raw[$g][0];
+        }
+        return $groups;
     }
 
     /**
@@ -374,14 +456,14 @@ class StringScanner
      * @param $pos (int) The match position
      * @param $consume_match (bool) Whether or not to consume the actual matched
      * text
-     * @param $match_data The matching groups, as returned by PCRE.
+     * @param $length The length of the match
      * @internal
      */
-    private function consume($pos, $consumeMatch, $matchData)
+    private function consume($pos, $consumeMatch, $length)
     {
         $this->index = $pos;
         if ($consumeMatch) {
-            $this->index += strlen($matchData[0]);
+            $this->index += $length;
         }
     }
 
@@ -431,7 +513,7 @@ class StringScanner
             $this->logMatch($index, $pos, $matches);
         }
         if ($matches !== null && $consume) {
-            $this->consume($pos, $consumeMatch, $matches);
+            $this->consume($pos, $consumeMatch, strlen($matches[0]));
         }
         return ($matches === null) ? null : $matches[0];
     }
@@ -585,10 +667,15 @@ class StringScanner
      *
      * @param $name A name for the pattern. This does not have to be unique.
      * @param $pattern A regular expression pattern.
+     * @param $firstBytes Optional hint: a string of bytes, one of which must
+     * begin any match of the pattern. By default this is derived from the
+     * pattern where possible. It lets next_match skip over regions where the
+     * pattern cannot match without running the regex engine.
      */
-    public function addPattern($name, $pattern)
+    public function addPattern($name, $pattern, $firstBytes = null)
     {
-        $this->patterns[] = array($name, $pattern . 'S', -1, null);
+        $this->patterns[] = array($name, $pattern . 'S', -1, null, $firstBytes);
+        $this->compiled = null;
     }
 
     /**
@@ -606,6 +693,215 @@ class StringScanner
                 unset($this->patterns[$k]);
             }
         }
+        $this->compiled = null;
+    }
+
+    /**
+     * @brief Splits a pattern into its body and modifiers
+     *
+     * @param $pattern a delimited regular expression
+     * @return array(body, modifiers), or @c NULL if the pattern cannot be
+     * embedded inside a larger expression without changing its meaning.
+     * @internal
+     */
+    private static function splitPattern($pattern)
+    {
+        if (($parts = StringSearch::splitPattern($pattern)) === null) {
+            return null;
+        }
+        list($body, $modifiers) = $parts;
+        // S is added by addPattern and applies to the whole expression anyway
+        $modifiers = str_replace('S', '', $modifiers);
+        if (!preg_match('/^[imsxU]*$/', $modifiers)) {
+            return null;
+        }
+        // group numbers and names change once fused, so anything which refers
+        // to a group (or declares a name) has to stay on its own, as do verbs
+        // and conditionals.
+        if (preg_match("/\\\\[1-9gk]|\\(\\?(?:P[<=>]|<\\w|'|&|R|[+-]?\\d|\\()|\\(\\*/", $body)) {
+            return null;
+        }
+        return array($body, $modifiers);
+    }
+
+    /**
+     * @brief Compiles a set of patterns into a single alternation
+     *
+     * Each fusable pattern becomes one branch of the alternation, with its
+     * modifiers applied inline, followed by an empty 'marker' group. PCRE
+     * trims trailing groups which did not participate, so the last group in
+     * the result is always the marker of the winning branch. Branches are in
+     * the same order as $patterns, so a tie goes to the earliest pattern.
+     *
+     * Tables are memoized for the life of the process, so scanners which build
+     * the same table only pay for its compilation once.
+     *
+     * @param $patterns An ordered map of key => pattern
+     * @param $firstBytes An optional map of key => prefilter hint, as
+     * StringSearch::match()
+     * @return An opaque table for getNextNamedCompiled()
+     */
+    protected static function compileAlternation($patterns, $firstBytes = array())
+    {
+        static $tables = array();
+        $cacheKey = serialize(array($patterns, $firstBytes));
+        if (isset($tables[$cacheKey])) {
+            return $tables[$cacheKey];
+        }
+
+        // rank => array(key, body, modifiers) for the fusable patterns, and
+        // rank => key for the rest
+        $parsed = array();
+        $loose = array();
+        $rank = 0;
+        foreach ($patterns as $k => $p) {
+            if (($parts = self::splitPattern($p)) === null) {
+                $loose[$rank] = $k;
+            } else {
+                $parsed[$rank] = array($k, $parts[0], $parts[1]);
+            }
+            $rank++;
+        }
+        // the delimiter has to be absent from every body; a control character
+        // is the last resort for scanners whose patterns use all the usual ones
+        $delimiter = null;
+        foreach (array('~', '%', '@', '!', '`', ';', ',', "\x01") as $d) {
+            foreach ($parsed as $parts) {
+                if (strpos($parts[1], $d) !== false) {
+                    continue 2;
+                }
+            }
+            $delimiter = $d;
+            break;
+        }
+        if ($delimiter === null) {
+            $parsed = array();
+            $loose = array_keys($patterns);
+        }
+
+        $branches = array();
+        $markers = array();
+        $group = 0;
+        // a match of the alternation starts with a byte from the union of its
+        // branches' first bytes, if every branch has them
+        $union = '';
+        foreach ($parsed as $rank => $parts) {
+            list($k, $body, $modifiers) = $parts;
+            // a trailing comment in extended mode would otherwise swallow the
+            // closing bracket
+            if (strpos($modifiers, 'x') !== false) {
+                $body .= "\n";
+            }
+            $branch = '(?' . $modifiers . ':' . $body . ')';
+            // count the groups by letting the branch match nothing, followed by a
+            // group which always matches: every group before it is then reported
+            if (@preg_match($delimiter . $branch . '?()' . $delimiter, '', $m) !== 1) {
+                $loose[$rank] = $k;
+                continue;
+            }
+            $numGroups = count($m) - 2;
+            if ($union !== null) {
+                if (isset($firstBytes[$k])) {
+                    $union = ($firstBytes[$k] === false) ? null : $union . $firstBytes[$k];
+                } else {
+                    list($prefix, $bytes) = StringSearch::prefilter($patterns[$k]);
+                    $union = ($prefix !== null) ? $union . $prefix[0] : (($bytes !== null) ? $union . $bytes : null);
+                }
+            }
+            $branches[] = $branch . '()';
+            $group += $numGroups + 1;
+            $markers[$group] = array($k, $group - $numGroups, $rank);
+        }
+        ksort($loose);
+
+        $regex = null;
+        if (!empty($branches)) {
+            $regex = $delimiter . implode('|', $branches) . $delimiter . 'S';
+            if (@preg_match($regex, '') === false) {
+                $regex = null;
+                $markers = array();
+                $loose = array_keys($patterns);
+            }
+        }
+        $union = ($union === null || $union === '') ? false : count_chars($union, 3);
+        $tables[$cacheKey] = array($regex, $markers, $loose, $union);
+        return $tables[$cacheKey];
+    }
+
+    /**
+     * @brief Find the next occurrence of a set of named patterns, in one pass
+     *
+     * This is the compiled counterpart of getNextNamed(): the result is the
+     * same, but the fused patterns cost a single regex execution.
+     *
+     * @param $table A table returned by compileAlternation()
+     * @param $patterns The map of $name=>$pattern the table was compiled from
+     * @param $firstBytes The prefilter hints the table was compiled with
+     * @return An array: ($name, $index, $matches). If there is no next match,
+     * name will be null, index will be -1 and matches will be null.
+     */
+    public function getNextNamedCompiled($table, $patterns, $firstBytes = array())
+    {
+        $name = $this->findCompiled($table, $patterns, $firstBytes, $next, $matches, $raw, $first, $last);
+        if ($raw !== null) {
+            $matches = self::offsetGroups($raw, $first, $last);
+        }
+        return array($name, $next, $matches);
+    }
+
+    /**
+     * @brief Implementation of getNextNamedCompiled()
+     *
+     * The match is returned through references, either as match groups (for
+     * patterns searched individually), or as raw match data of the fused
+     * expression along with the range of groups which belong to the pattern.
+     *
+     * @return The name of the pattern which matched, or @c NULL
+     * @internal
+     */
+    private function findCompiled($table, $patterns, $firstBytes, &$next, &$matches, &$raw, &$first, &$last)
+    {
+        list($regex, $markers, $loose, $union) = $table;
+
+        $name = null;
+        $next = -1;
+        $matches = null;
+        $raw = null;
+        $first = null;
+        $last = null;
+        $nextRank = -1;
+        if ($regex !== null && ($index = $this->ss->matchOffsets($regex, $this->index, $m, $union)) !== false) {
+            end($m);
+            $marker = key($m);
+            list($name, $first, $nextRank) = $markers[$marker];
+            // the groups belong to the pattern as it would number them on its
+            // own, i.e. from 1 and without trailing non-participants
+            $last = $first - 1;
+            for ($g = $marker - 1; $g >= $first; $g--) {
+                if ($m[$g][1] !== -1) {
+                    $last = $g;
+                    break;
+                }
+            }
+            $raw = $m;
+            $next = $index;
+        }
+
+        foreach ($loose as $rank => $k) {
+            if ($next === $this->index && $rank > $nextRank) {
+                break;
+            }
+            $hint = isset($firstBytes[$k]) ? $firstBytes[$k] : null;
+            $index = $this->ss->match($patterns[$k], $this->index, $m, $hint);
+            if ($index !== false && ($next === -1 || $index < $next || ($index === $next && $rank < $nextRank))) {
+                $name = $k;
+                $next = $index;
+                $matches = $m;
+                $raw = null;
+                $nextRank = $rank;
+            }
+        }
+        return $name;
     }
 
     /**
@@ -628,47 +924,106 @@ class StringScanner
      * array is also different, but the array does in fact hold different data.
      */
     public function nextMatch($consumeAndLog = true)
+    {
+        if (($name = $this->nextMatchRange($index, $length, $consumeAndLog)) === null) {
+            return null;
+        }
+        return array($name, $index);
+    }
+
+    /**
+     * @brief Offset-only counterpart of nextMatch()
+     *
+     * This behaves exactly like nextMatch(), but returns the match position
+     * and length through references rather than in a new array, and the match
+     * groups are only built if match_groups() or match_group() ask for them.
+     * match() returns the text PCRE already extracted, so recording a token
+     * needs no further substring either. On large inputs this saves several
+     * short-lived arrays per token.
+     *
+     * @param $index Set to the match index
+     * @param $length Set to the length of the match
+     * @param $consumeAndLog If this is @c FALSE, the pattern is not consumed
+     * or logged.
+     * @return The pattern name (as given to add_pattern), or @c NULL if there
+     * are no more matches, in which case nothing is logged and $index and
+     * $length are undefined.
+     */
+    public function nextMatchRange(&$index, &$length, $consumeAndLog = true)
     {
         $target = $this->index;
 
         $nearestIndex = -1;
-        $nearestKey = -1;
         $nearestName = null;
         $nearestMatchData = null;
+        $nearestRaw = null;
+        $first = null;
+        $last = null;
 
-        foreach ($this->patterns as &$pData) {
-            $name = $pData[0];
-            $pattern = $pData[1];
-            $index = &$pData[2];
-            $matchData = &$pData[3];
-
-            if ($index !== false && $index < $target) {
-                $index = $this->ss->match($pattern, $target, $matchData);
+        if ($this->compilePatterns) {
+            if ($this->compiled === null) {
+                $named = array();
+                $hints = array();
+                foreach ($this->patterns as $k => $p) {
+                    $named[$k] = $p[1];
+                    if ($p[4] !== null) {
+                        $hints[$k] = $p[4];
+                    }
+                }
+                $this->compiled = array(self::compileAlternation($named, $hints), $named, $hints);
             }
-
-            if ($index === false) {
-                unset($pData);
-                continue;
+            $key = $this->findCompiled(
+                $this->compiled[0],
+                $this->compiled[1],
+                $this->compiled[2],
+                $nearestIndex,
+                $nearestMatchData,
+                $nearestRaw,
+                $first,
+                $last
+            );
+            if ($key !== null) {
+                $nearestName = $this->patterns[$key][0];
             }
+        } else {
+            // each pattern's next match is kept raw alongside it, so the
+            // StringSearch cache would be redundant
+            foreach ($this->patterns as &$pData) {
+                $name = $pData[0];
+                $pattern = $pData[1];
+                $pIndex = &$pData[2];
+                $pRaw = &$pData[3];
 
-            if ($nearestIndex === -1 || $index < $nearestIndex) {
-                $nearestIndex = $index;
-                $nearestName = $name;
-                $nearestMatchData = $matchData;
-                if ($index === $target) {
-                    break;
+                if ($pIndex !== false && $pIndex < $target) {
+                    $pIndex = $this->ss->matchOffsets($pattern, $target, $pRaw, $pData[4]);
+                }
+
+                if ($pIndex === false) {
+                    unset($pData);
+                    continue;
+                }
+
+                if ($nearestIndex === -1 || $pIndex < $nearestIndex) {
+                    $nearestIndex = $pIndex;
+                    $nearestName = $name;
+                    $nearestRaw = $pRaw;
+                    if ($pIndex === $target) {
+                        break;
+                    }
                 }
             }
         }
 
-        if ($nearestIndex !== -1) {
-            if ($consumeAndLog) {
-                $this->logMatch($nearestIndex, $nearestIndex, $nearestMatchData);
-                $this->consume($nearestIndex, true, $nearestMatchData);
-            }
-            return array($nearestName, $nearestIndex);
+        if ($nearestIndex === -1) {
+            return null;
+        }
+        $index = $nearestIndex;
+        $length = strlen(($nearestRaw !== null) ? $nearestRaw[0][0] : $nearestMatchData[0]);
+        if ($consumeAndLog) {
+            $this->logMatch($nearestIndex, $nearestIndex, $nearestMatchData, $nearestRaw, $first, $last);
+            $this->consume($nearestIndex, true, $length);
         }
-        return null;
+        return $nearestName;
     }
 }
 
@@ -36,9 +36,706 @@ class StringSearch
      */
     private $cache = array();
 
+    /**
+     * Length of the string (cached for performance)
+     */
+    private $length;
+
+    /**
+     * Memo of prefilter() results, pattern => array(prefix, first bytes)
+     */
+    private static $prefilters = array();
+
+    /**
+     * Batched results, pattern => array(hits, cursor, from, coverage). Every
+     * match of the pattern starting in [from, coverage) is in hits, in order,
+     * as returned by preg_match_all with PREG_OFFSET_CAPTURE. See batchMatch().
+     */
+    private $batches = array();
+
+    /**
+     * The number of times each pattern has been run individually
+     */
+    private $runs = array();
+
+    /**
+     * Memo of windowExtent() results
+     */
+    private static $extents = array();
+
+    /**
+     * @brief The number of individual runs after which a pattern is batched
+     *
+     * A pattern that keeps being searched for is probably a high frequency
+     * one (identifiers, operators, ...), so after this many calls to
+     * preg_match it is switched over to preg_match_all windows.
+     */
+    public static $batchThreshold = 4;
+
+    /**
+     * @brief The size in bytes of a batch window
+     */
+    public static $batchWindow = 16384;
+
     public function __construct($str)
     {
         $this->string = $str;
+        $this->length = strlen($str);
+    }
+
+    /**
+     * @brief Splits a delimited pattern into its body and modifiers
+     *
+     * @param $pattern a delimited regular expression, e.g. '/abc/i'
+     * @return array(body, modifiers), or @c NULL if the delimiters can't be
+     * found.
+     */
+    public static function splitPattern($pattern)
+    {
+        if (!isset($pattern[0])) {
+            return null;
+        }
+        $end = strrpos($pattern, Utils::balanceDelimiter($pattern[0]));
+        if (!$end) {
+            return null;
+        }
+        return array(substr($pattern, 1, $end - 1), substr($pattern, $end + 1));
+    }
+
+    /**
+     * @brief Works out where a pattern can possibly start matching
+     *
+     * This looks at the leading atoms of the pattern. If it begins with a
+     * literal string of two or more bytes, that string must occur wherever the
+     * pattern matches, and strpos can skip to it. Otherwise, if the first atom
+     * is a literal or a simple character class, a match must begin with one of
+     * its bytes, and strcspn can skip to the next one. Anything more complex
+     * (alternations, groups, optional first atoms, negated classes) gives up.
+     *
+     * @param $pattern a delimited regular expression
+     * @return array(prefix, first_bytes); at most one is not @c NULL, and both
+     * are @c NULL if nothing could be derived.
+     */
+    public static function prefilter($pattern)
+    {
+        if (isset(self::$prefilters[$pattern])) {
+            return self::$prefilters[$pattern];
+        }
+        $result = array(null, null);
+        if (($parts = self::splitPattern($pattern)) !== null) {
+            $result = self::derivePrefilter($parts[0], $parts[1]);
+        }
+        self::$prefilters[$pattern] = $result;
+        return $result;
+    }
+
+    /**
+     * @brief Skips whitespace and comments in an extended (/x) pattern
+     * @internal
+     */
+    private static function skipIgnorable($body, &$i, $extended)
+    {
+        if (!$extended) {
+            return;
+        }
+        $len = strlen($body);
+        while ($i < $len) {
+            if (ctype_space($body[$i])) {
+                $i++;
+            } elseif ($body[$i] === '#') {
+                $i = (($nl = strpos($body, "\n", $i)) === false) ? $len : $nl + 1;
+            } else {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Does a pattern body contain an alternation outside any group?
+     * @internal
+     */
+    private static function hasTopLevelAlternation($body)
+    {
+        $depth = 0;
+        $len = strlen($body);
+        for ($i = 0; $i < $len; $i++) {
+            $c = $body[$i];
+            if ($c === '\\') {
+                $i++;
+            } elseif ($c === '[') {
+                $i++;
+                if (isset($body[$i]) && $body[$i] === '^') {
+                    $i++;
+                }
+                if (isset($body[$i]) && $body[$i] === ']') {
+                    $i++;
+                }
+                while ($i < $len && $body[$i] !== ']') {
+                    if ($body[$i] === '\\') {
+                        $i++;
+                    }
+                    $i++;
+                }
+            } elseif ($c === '(') {
+                $depth++;
+            } elseif ($c === ')') {
+                $depth--;
+            } elseif ($c === '|' && $depth === 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Gets the bytes an escape sequence can match, or @c NULL if unknown
+     * @internal
+     */
+    private static function escapeBytes($e)
+    {
+        switch ($e) {
+            case 'd':
+                return '0123456789';
+            case 's':
+                return " \t\n\r\f\x0b";
+            case 'w':
+                return 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_';
+            case 'n':
+                return "\n";
+            case 't':
+                return "\t";
+            default:
+                // other alphanumeric escapes are classes, assertions or codes
+                return ctype_alnum($e) ? null : $e;
+        }
+    }
+
+    /**
+     * @brief Gets the bytes a (non-negated) character class can match
+     *
+     * @param $i the offset of the opening bracket. On success this is moved past
+     * the closing bracket.
+     * @return the set of bytes, or @c NULL if the class is too complex.
+     * @internal
+     */
+    private static function classBytes($body, &$i)
+    {
+        $len = strlen($body);
+        $j = $i + 1;
+        if ($j < $len && $body[$j] === '^') {
+            return null;
+        }
+        $set = '';
+        $first = true;
+        while ($j < $len) {
+            $c = $body[$j];
+            if ($c === ']' && !$first) {
+                $i = $j + 1;
+                return ($set === '') ? null : $set;
+            }
+            $first = false;
+            if ($c === '[' && isset($body[$j + 1]) && $body[$j + 1] === ':') {
+                return null;
+            } elseif ($c === '\\') {
+                if (!isset($body[$j + 1]) || ($e = self::escapeBytes($body[$j + 1])) === null) {
+                    return null;
+                }
+                $set .= $e;
+                $j += 2;
+            } elseif (isset($body[$j + 2]) && $body[$j + 1] === '-' && $body[$j + 2] !== ']') {
+                $from = ord($c);
+                $to = ord($body[$j + 2]);
+                if ($body[$j + 2] === '\\' || $from > $to || $to > 127) {
+                    return null;
+                }
+                for ($o = $from; $o <= $to; $o++) {
+                    $set .= chr($o);
+                }
+                $j += 3;
+            } else {
+                $set .= $c;
+                $j++;
+            }
+        }
+        return null;
+    }
+
+    /**
+     * @brief Gets the bytes the atom at $i can match, and moves $i past it
+     * @return the set of bytes, or @c NULL if the atom is too complex.
+     * @internal
+     */
+    private static function atomBytes($body, &$i)
+    {
+        $c = $body[$i];
+        if ($c === '\\') {
+            if (!isset($body[$i + 1]) || ($set = self::escapeBytes($body[$i + 1])) === null) {
+                return null;
+            }
+            $i += 2;
+            return $set;
+        } elseif ($c === '[') {
+            return self::classBytes($body, $i);
+        } elseif (strpos('.()|^$?*+{', $c) !== false) {
+            return null;
+        }
+        $i++;
+        return $c;
+    }
+
+    /**
+     * @brief Implementation of prefilter() on a split pattern
+     * @internal
+     */
+    private static function derivePrefilter($body, $modifiers)
+    {
+        $extended = strpos($modifiers, 'x') !== false;
+        $caseless = strpos($modifiers, 'i') !== false;
+        // in UTF-8 mode, case folding and the \d\s\w classes reach beyond ASCII
+        if (self::hasTopLevelAlternation($body) || strpos($modifiers, 'u') !== false) {
+            return array(null, null);
+        }
+        $len = strlen($body);
+        $atoms = array();
+        $i = 0;
+        while (true) {
+            self::skipIgnorable($body, $i, $extended);
+            if ($i >= $len) {
+                break;
+            }
+            // leading zero-width assertions don't consume anything. \G is
+            // relative to the search offset, so it can't be skipped.
+            if (empty($atoms) && $body[$i] === '^') {
+                $i++;
+                continue;
+            } elseif (empty($atoms) && $body[$i] === '\\' && isset($body[$i + 1])
+                && strpos('bBA', $body[$i + 1]) !== false
+            ) {
+                $i += 2;
+                continue;
+            }
+            if (($set = self::atomBytes($body, $i)) === null) {
+                break;
+            }
+            self::skipIgnorable($body, $i, $extended);
+            $q = ($i < $len) ? $body[$i] : '';
+            if ($q === '?' || $q === '*' || ($q === '{' && preg_match('/\{(?:,|0+[,}])/A', $body, $m, 0, $i))) {
+                // an optional atom can't tell us anything, and it ends the prefix
+                if (empty($atoms)) {
+                    return array(null, null);
+                }
+                break;
+            }
+            $atoms[] = $set;
+            if ($q === '+' || $q === '{' || strlen($set) !== 1) {
+                break;
+            }
+        }
+        if (empty($atoms)) {
+            return array(null, null);
+        }
+
+        $prefix = '';
+        foreach ($atoms as $a) {
+            if (strlen($a) !== 1) {
+                break;
+            }
+            $prefix .= $a;
+        }
+        if (!$caseless && strlen($prefix) >= 2) {
+            return array($prefix, null);
+        }
+        $bytes = $atoms[0];
+        if ($caseless) {
+            $bytes = strtolower($bytes) . strtoupper($bytes);
+        }
+        return array(null, count_chars($bytes, 3));
+    }
+
+    /**
+     * @brief Works out how far a pattern looks around the text it matches
+     *
+     * A pattern can be searched for in a truncated window of the string only if
+     * whether it matches at an offset, and what it matches, is decided by a
+     * bounded amount of text around the offset. That means a pattern made of
+     * literals, escapes, character classes, groups and alternations, and
+     * lookbehinds and lookaheads with the same restrictions, where an unbounded
+     * repetition may only come last (so it can only stop at the window edge by
+     * matching up to it). Back-references, recursion, \G, $, \z and the like
+     * make a pattern unwindowable.
+     *
+     * @param $pattern a delimited regular expression
+     * @return array(ahead, behind) in bytes, where behind is -1 if the pattern
+     * needs to see the string from the start; or @c NULL if the pattern can't
+     * be windowed.
+     */
+    private static function windowExtent($pattern)
+    {
+        if (array_key_exists($pattern, self::$extents)) {
+            return self::$extents[$pattern];
+        }
+        $extent = null;
+        if (($parts = self::splitPattern($pattern)) !== null && preg_match('/^[imsuxDSU]*$/', $parts[1])) {
+            list($body, $modifiers) = $parts;
+            $i = 0;
+            $behind = 0;
+            $anchored = false;
+            $r = self::parseExtent($body, $i, strpos($modifiers, 'x') !== false, $behind, $anchored);
+            if ($r !== null && $i === strlen($body)) {
+                // in UTF-8 mode a window can't start mid-character, and each
+                // character may be four bytes
+                $utf8 = strpos($modifiers, 'u') !== false;
+                $extent = array(
+                    $r[0] * ($utf8 ? 4 : 1),
+                    ($anchored || $utf8) ? -1 : $behind + 1
+                );
+            }
+        }
+        self::$extents[$pattern] = $extent;
+        return $extent;
+    }
+
+    /**
+     * @brief Recursive implementation of windowExtent()
+     *
+     * Parses an alternation up to the end of the body or an unmatched ')'.
+     *
+     * @param $i the offset to start at, this is moved past the alternation
+     * @param $behind accumulates the lookbehind lengths
+     * @param $anchored set to true if the pattern uses ^ or \A
+     * @return array(ahead, open), where open means the alternation ends with an
+     * unbounded repetition; or @c NULL if the pattern can't be windowed.
+     * @internal
+     */
+    private static function parseExtent($body, &$i, $extended, &$behind, &$anchored)
+    {
+        $len = strlen($body);
+        $extent = 0;
+        $open = false;
+        $seq = 0;
+        $seqOpen = false;
+        while (true) {
+            self::skipIgnorable($body, $i, $extended);
+            if ($i >= $len || $body[$i] === ')' || $body[$i] === '|') {
+                $extent = max($extent, $seq);
+                $open = $open || $seqOpen;
+                if ($i < $len && $body[$i] === '|') {
+                    $i++;
+                    $seq = 0;
+                    $seqOpen = false;
+                    continue;
+                }
+                return array($extent, $open);
+            }
+            // only empty groups (i.e. compiled alternation markers) may follow
+            // an unbounded repetition
+            if ($seqOpen && substr($body, $i, 2) !== '()') {
+                return null;
+            }
+            $c = $body[$i];
+            $width = 1;
+            $elementOpen = false;
+            if ($c === '(') {
+                if (substr($body, $i, 3) === '(?#') {
+                    if (($close = strpos($body, ')', $i)) === false) {
+                        return null;
+                    }
+                    $i = $close + 1;
+                    continue;
+                }
+                $i++;
+                $look = null;
+                $groupExtended = $extended;
+                if (isset($body[$i]) && $body[$i] === '?') {
+                    $kind = substr($body, $i, 3);
+                    $next = isset($body[$i + 1]) ? $body[$i + 1] : '';
+                    if ($kind === '?<=' || $kind === '?<!') {
+                        $look = 'behind';
+                        $i += 3;
+                    } elseif ($next === '=' || $next === '!') {
+                        $look = 'ahead';
+                        $i += 2;
+                    } elseif ($next === '>') {
+                        $i += 2;
+                    } elseif (preg_match('/\?([imsxU]*)(?:-([imsxU]*))?:/A', $body, $m, 0, $i)) {
+                        if (strpos($m[1], 'x') !== false) {
+                            $groupExtended = true;
+                        } elseif (isset($m[2]) && strpos($m[2], 'x') !== false) {
+                            $groupExtended = false;
+                        }
+                        $i += strlen($m[0]);
+                    } else {
+                        return null;
+                    }
+                }
+                $inner = self::parseExtent($body, $i, $groupExtended, $behind, $anchored);
+                if ($inner === null || $i >= $len || ($look !== null && $inner[1])) {
+                    return null;
+                }
+                $i++;
+                if ($look === 'behind') {
+                    $behind += $inner[0];
+                    $width = 0;
+                } else {
+                    $width = $inner[0];
+                    $elementOpen = $inner[1];
+                }
+            } elseif ($c === '[') {
+                $j = $i + 1;
+                if (isset($body[$j]) && $body[$j] === '^') {
+                    $j++;
+                }
+                if (isset($body[$j]) && $body[$j] === ']') {
+                    $j++;
+                }
+                while ($j < $len && $body[$j] !== ']') {
+                    if ($body[$j] === '\\') {
+                        $j += 2;
+                    } elseif ($body[$j] === '[' && isset($body[$j + 1]) && $body[$j + 1] === ':'
+                        && ($close = strpos($body, ':]', $j + 2)) !== false
+                    ) {
+                        $j = $close + 2;
+                    } else {
+                        $j++;
+                    }
+                }
+                if ($j >= $len) {
+                    return null;
+                }
+                $i = $j + 1;
+            } elseif ($c === '\\') {
+                $e = isset($body[$i + 1]) ? $body[$i + 1] : '';
+                if ($e === '') {
+                    return null;
+                } elseif ($e === 'A') {
+                    $anchored = true;
+                    $width = 0;
+                    $i += 2;
+                } elseif ($e === 'R') {
+                    $width = 2;
+                    $i += 2;
+                } elseif (strpos('bBdDsSwWhHvVnrtfeaN', $e) !== false) {
+                    $i += 2;
+                } elseif (preg_match('/\\\\(?:x(?:\{[0-9a-fA-F]+\}|[0-9a-fA-F]{0,2})|[pP](?:\{\^?\w+\}|\w))/A', $body, $m, 0, $i)) {
+                    $i += strlen($m[0]);
+                } elseif (!ctype_alnum($e)) {
+                    $i += 2;
+                } else {
+                    return null;
+                }
+            } elseif ($c === '^') {
+                $anchored = true;
+                $width = 0;
+                $i++;
+            } elseif ($c === '$' || $c === '*' || $c === '+' || $c === '?') {
+                return null;
+            } else {
+                $i++;
+            }
+
+            self::skipIgnorable($body, $i, $extended);
+            $q = isset($body[$i]) ? $body[$i] : '';
+            $quantified = true;
+            if ($q === '?') {
+                $i++;
+            } elseif ($q === '*' || $q === '+') {
+                $elementOpen = true;
+                $i++;
+            } elseif ($q === '{' && preg_match('/\{(\d+)(?:(,)(\d*))?\}/A', $body, $m, 0, $i)) {
+                $i += strlen($m[0]);
+                if (!isset($m[2]) || $m[2] === '') {
+                    $width *= (int) $m[1];
+                } elseif ($m[3] === '') {
+                    $elementOpen = true;
+                } else {
+                    $width *= (int) $m[3];
+                }
+            } else {
+                $quantified = false;
+            }
+            // lazy and possessive quantifiers
+            if ($quantified && isset($body[$i]) && ($body[$i] === '?' || $body[$i] === '+')) {
+                $i++;
+            }
+            $seq += $width;
+            $seqOpen = $elementOpen;
+        }
+    }
+
+    /**
+     * @brief Runs preg_match_all over the next window of the string
+     *
+     * The window is truncated to $batchWindow bytes past $from (and to the
+     * pattern's lookbehind distance before it). Hits are kept only where
+     * truncation cannot have changed the result: those starting at least the
+     * pattern's lookahead distance before the window edge and not reaching it.
+     *
+     * @return true if the batch now covers some of the string past $from
+     * @internal
+     */
+    private function fillBatch($search, $from)
+    {
+        list($ahead, $behind) = self::windowExtent($search);
+        $end = $from + self::$batchWindow;
+        if ($end >= $this->length) {
+            $end = $this->length;
+            $coverage = $end;
+        } else {
+            $coverage = $end - $ahead;
+        }
+        $base = ($behind < 0) ? 0 : max(0, $from - $behind);
+        $subject = ($base === 0 && $end === $this->length) ? $this->string
+            : substr($this->string, $base, $end - $base);
+
+        $ret = preg_match_all($search, $subject, $all, PREG_SET_ORDER | PREG_OFFSET_CAPTURE, $from - $base);
+        if ($ret === false) {
+            if (LUMINOUS_DEBUG) {
+                throw new Exception(
+                    'preg_match_all returned false for pattern: "' . $search . '", with code: '
+                    . Utils::pcreErrorDecode(preg_last_error()) . " with string length "
+                    . strlen($this->string) . " and offset " . $from
+                );
+            }
+            return false;
+        }
+        $hits = array();
+        foreach ($all as $m) {
+            $start = $m[0][1] + $base;
+            if ($start >= $coverage) {
+                break;
+            }
+            // the hit may have been cut short by the window edge
+            if ($end < $this->length && $start + strlen($m[0][0]) >= $end) {
+                $coverage = $start;
+                break;
+            }
+            if ($base) {
+                foreach ($m as &$g) {
+                    if ($g[1] !== -1) {
+                        $g[1] += $base;
+                    }
+                }
+                unset($g);
+            }
+            $hits[] = $m;
+        }
+        if ($coverage <= $from) {
+            return false;
+        }
+        $this->batches[$search] = array($hits, 0, $from, $coverage);
+        return true;
+    }
+
+    /**
+     * @brief Serves a search from the pattern's batch, refilling it as needed
+     *
+     * preg_match_all finds non-overlapping matches, so the batch knows the
+     * answer for any offset that is not strictly inside one of its hits: the
+     * matching at an offset doesn't depend on where the search started (\G is
+     * never batched), and since the string is never cut before the
+     * lookbehind distance, lookbehinds and anchors see what they would see
+     * with preg_match.
+     *
+     * @return the match groups with offsets, false if there is no match, or
+     * @c NULL if the batch can't answer and preg_match should be used instead.
+     * @internal
+     */
+    private function batchMatch($search, $index)
+    {
+        while (true) {
+            $batch = &$this->batches[$search];
+            list($hits, $k, $from, $coverage) = $batch;
+            if ($index >= $from && $index <= $coverage) {
+                // StringSearch is used incrementally, but rewinding is legal
+                if ($k > 0 && $hits[$k - 1][0][1] >= $index) {
+                    $k = 0;
+                }
+                $n = count($hits);
+                while ($k < $n && $hits[$k][0][1] < $index) {
+                    $k++;
+                }
+                $inside = ($k > 0 && $hits[$k - 1][0][1] + strlen($hits[$k - 1][0][0]) > $index);
+                if (!$inside) {
+                    $batch[1] = $k;
+                    if ($k < $n) {
+                        return $hits[$k];
+                    } elseif ($coverage >= $this->length) {
+                        return false;
+                    }
+                    // nothing starts between $index and the end of the batch
+                    $index = $coverage;
+                }
+            }
+            unset($batch);
+            if (!$this->fillBatch($search, $index)) {
+                return null;
+            }
+        }
+    }
+
+    /**
+     * @brief Searches for a pattern past an offset
+     *
+     * @return the match groups with offsets, as preg_match with
+     * PREG_OFFSET_CAPTURE, or false if there is no match.
+     * @internal
+     */
+    private function find($search, $index, $firstBytes)
+    {
+        if (($index = $this->firstCandidate($search, $index, $firstBytes)) === false) {
+            return false;
+        }
+        if (!isset($this->batches[$search])) {
+            $runs = isset($this->runs[$search]) ? $this->runs[$search] + 1 : 1;
+            $this->runs[$search] = $runs;
+            if ($runs > self::$batchThreshold && ($extent = self::windowExtent($search)) !== null
+                && $extent[0] * 2 < self::$batchWindow
+            ) {
+                $this->batches[$search] = array(array(), 0, 0, 0);
+            }
+        }
+        if (isset($this->batches[$search]) && ($matches = $this->batchMatch($search, $index)) !== null) {
+            return $matches;
+        }
+
+        if (!($ret = preg_match($search, $this->string, $matches, PREG_OFFSET_CAPTURE, $index))) {
+            if ($ret === false && LUMINOUS_DEBUG) {
+                throw new Exception(
+                    'preg_match returned false for pattern: "' . $search . '", with code: '
+                    . Utils::pcreErrorDecode(preg_last_error()) . " with string length "
+                    . strlen($this->string) . " and offset " . $index
+                );
+            }
+            return false;
+        }
+        return $matches;
+    }
+
+    /**
+     * @brief Finds the first offset from $index where a match could start
+     *
+     * @param $search the pattern
+     * @param $index the minimum offset
+     * @param $firstBytes a prefilter hint, see match()
+     * @return the offset, or false if the pattern cannot match past $index
+     * @internal
+     */
+    private function firstCandidate($search, $index, $firstBytes)
+    {
+        $prefix = null;
+        if ($firstBytes === null) {
+            list($prefix, $firstBytes) = self::prefilter($search);
+        }
+        if ($prefix !== null) {
+            return ($index < $this->length) ? strpos($this->string, $prefix, $index) : false;
+        } elseif ($firstBytes !== null && $firstBytes !== false) {
+            if ($index >= $this->length) {
+                return false;
+            }
+            $index += strcspn($this->string, $firstBytes, $index);
+            return ($index < $this->length) ? $index : false;
+        }
+        return $index;
     }
 
     /**
@@ -46,9 +743,13 @@ class StringSearch
      * @param $search the pattern to search for
      * @param $index the minimum string index (offset) of a result
      * @param $matches a reference to the return location of the match groups
+     * @param $firstBytes a string of bytes, one of which must begin any match of
+     * the pattern. This lets the search skip regions where the pattern cannot
+     * match without running the regex engine. Leave this as @c NULL to derive
+     * it from the pattern (see prefilter()), or use @c FALSE for none.
      * @return the index or false if no match is found.
      */
-    public function match($search, $index, &$matches)
+    public function match($search, $index, &$matches, $firstBytes = null)
     {
         $r = false; // return value
 
@@ -68,14 +769,7 @@ class StringSearch
             }
         }
         // cache not set, or out of date, we have to perform the match
-        if (!($ret = preg_match($search, $this->string, $matches_, PREG_OFFSET_CAPTURE, $index))) {
-            if ($ret === false && LUMINOUS_DEBUG) {
-                throw new Exception(
-                    'preg_match returned false for pattern: "' . $search . '", with code: '
-                    . Utils::pcreErrorDecode(preg_last_error()) . " with string length "
-                    . strlen($this->string) . " and offset " . $index
-                );
-            }
+        if (($matches_ = $this->find($search, $index, $firstBytes)) === false) {
             $this->cache[$search] = false;
             return false;
         }
@@ -91,6 +785,32 @@ class StringSearch
         $matches = $matches_;
         return $r;
     }
+
+    /**
+     * @brief Performs an uncached search, keeping the group offsets
+     *
+     * This is for patterns whose hits are always consumed as soon as they are
+     * found (i.e. the cache could never be hit), and whose callers need to know
+     * which groups actually participated in the match.
+     *
+     * @param $search the pattern to search for
+     * @param $index the minimum string index (offset) of a result
+     * @param $matches a reference to the return location of the match groups,
+     * as returned by preg_match with PREG_OFFSET_CAPTURE
+     * @param $firstBytes a prefilter hint, as match()
+     * @return the index or false if no match is found.
+     */
+    public function matchOffsets($search, $index, &$matches, $firstBytes = null)
+    {
+        if (isset($this->cache[$search]) && $this->cache[$search] === false) {
+            return false;
+        }
+        if (($matches = $this->find($search, $index, $firstBytes)) === false) {
+            $this->cache[$search] = false;
+            return false;
+        }
+        return $matches[0][1];
+    }
 }
 
 /** @endcond */
@@ -0,0 +1,198 @@
+<?php
+
+/** @cond CORE */
+
+namespace Luminous\Core;
+
+use Countable;
+
+/**
+ * @brief A compact token stream
+ *
+ * This stores the same information as the token arrays used by Scanner, i.e.
+ * a list of (type, string, escaped?) triples, but as parallel packed arrays of
+ * type ID, start offset and length into the source string. The text of a
+ * token is only extracted from the source when something asks for it.
+ *
+ * Tokens whose text is not a range of the source (e.g. pre-escaped output of
+ * a sub-scanner) are kept as strings in a side table.
+ *
+ * Token type names are interned with TokenTypes.
+ */
+class TokenBuffer implements Countable
+{
+    /**
+     * The source string the token ranges refer to
+     */
+    private $source;
+
+    /**
+     * Token type IDs, see TokenTypes
+     */
+    private $types = array();
+
+    /**
+     * Start offsets into the source, or -1 if the token's text is held in
+     * $strings
+     */
+    private $starts = array();
+
+    /**
+     * Lengths of the tokens
+     */
+    private $lengths = array();
+
+    /**
+     * Tokens which are not ranges of the source, as index => (string, escaped?)
+     */
+    private $strings = array();
+
+    /**
+     * @param $source the source string which token ranges refer to
+     */
+    public function __construct($source)
+    {
+        $this->source = $source;
+    }
+
+    /**
+     * @brief Appends a range of the source as a token
+     * @param $type the token type name
+     * @param $start the start offset
+     * @param $length the length of the token
+     */
+    public function add($type, $start, $length)
+    {
+        $this->types[] = TokenTypes::id($type);
+        $this->starts[] = $start;
+        $this->lengths[] = $length;
+    }
+
+    /**
+     * @brief Appends a string as a token
+     * @param $type the token type name
+     * @param $string the token's text
+     * @param $escaped whether the text has already been XML-escaped
+     */
+    public function addString($type, $string, $escaped = false)
+    {
+        $this->strings[count($this->types)] = array($string, $escaped);
+        $this->types[] = TokenTypes::id($type);
+        $this->starts[] = -1;
+        $this->lengths[] = strlen($string);
+    }
+
+    /**
+     * @brief The number of tokens
+     */
+    public function count()
+    {
+        return count($this->types);
+    }
+
+    /**
+     * @brief Gets the type name of a token
+     */
+    public function type($i)
+    {
+        return TokenTypes::name($this->types[$i]);
+    }
+
+    /**
+     * @brief Gets the type ID of a token
+     */
+    public function typeId($i)
+    {
+        return $this->types[$i];
+    }
+
+    /**
+     * @brief Changes the type of a token
+     * @param $i the index of the token
+     * @param $type the new token type name
+     */
+    public function setType($i, $type)
+    {
+        $this->types[$i] = TokenTypes::id($type);
+    }
+
+    /**
+     * @brief Gets the text of a token
+     */
+    public function text($i)
+    {
+        $start = $this->starts[$i];
+        if ($start === -1) {
+            return $this->strings[$i][0];
+        }
+        return $this->lengths[$i] ? substr($this->source, $start, $this->lengths[$i]) : '';
+    }
+
+    /**
+     * @brief Gets the start offset of a token, or -1 if it isn't a range of the
+     * source
+     */
+    public function start($i)
+    {
+        return $this->starts[$i];
+    }
+
+    /**
+     * @brief Gets the length of a token's text
+     */
+    public function length($i)
+    {
+        return $this->lengths[$i];
+    }
+
+    /**
+     * @brief Gets whether a token's text has already been XML-escaped
+     */
+    public function escaped($i)
+    {
+        return $this->starts[$i] === -1 && $this->strings[$i][1];
+    }
+
+    /**
+     * @brief Gets a token as a (type, string, escaped?) triple
+     */
+    public function token($i)
+    {
+        return array($this->type($i), $this->text($i), $this->escaped($i));
+    }
+
+    /**
+     * @brief Gets the whole stream as an array of (type, string, escaped?)
+     * triples, as used by Scanner::$tokens
+     */
+    public function toArray()
+    {
+        $tokens = array();
+        $n = count($this->types);
+        for ($i = 0; $i < $n; $i++) {
+            $tokens[] = $this->token($i);
+        }
+        return $tokens;
+    }
+
+    /**
+     * @brief Points the buffer at a new source string
+     *
+     * The text of existing range tokens is copied out of the old source first,
+     * so they are unaffected.
+     *
+     * @param $source the new source string
+     */
+    public function rebase($source)
+    {
+        foreach ($this->starts as $i => $start) {
+            if ($start !== -1) {
+                $this->strings[$i] = array($this->text($i), false);
+                $this->starts[$i] = -1;
+            }
+        }
+        $this->source = $source;
+    }
+}
+
+/** @endcond */
@@ -0,0 +1,55 @@
+<?php
+
+/** @cond CORE */
+
+namespace Luminous\Core;
+
+/**
+ * @brief Registry of interned token type names
+ *
+ * Token types are names like 'COMMENT' or 'IDENT'. TokenBuffer stores them as
+ * small integer IDs, which are assigned here the first time a name is seen
+ * and are stable for the rest of the request. The @c NULL type (plain,
+ * untagged text) is always 0.
+ */
+class TokenTypes
+{
+    /**
+     * Map of name => ID
+     */
+    private static $ids = array();
+
+    /**
+     * Map of ID => name
+     */
+    private static $names = array(null);
+
+    /**
+     * @brief Gets the ID of a token type, interning it if necessary
+     * @param $name the token type name, or @c NULL
+     * @return the integer ID
+     */
+    public static function id($name)
+    {
+        if ($name === null) {
+            return 0;
+        }
+        if (!isset(self::$ids[$name])) {
+            self::$ids[$name] = count(self::$names);
+            self::$names[] = $name;
+        }
+        return self::$ids[$name];
+    }
+
+    /**
+     * @brief Gets the name of a token type ID
+     * @param $id an ID returned by id()
+     * @return the token type name, or @c NULL
+     */
+    public static function name($id)
+    {
+        return self::$names[$id];
+    }
+}
+
+/** @endcond */
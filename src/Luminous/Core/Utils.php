@@ -98,6 +98,30 @@ class Utils
         return $open . $block . $close;
     }
 
+    /**
+     * @brief Converts a filtered token stream into the tagged XML format
+     *
+     * @param $tokens An array of (type, string, escaped?) tokens, as returned
+     *    by Scanner::filteredTokens()
+     * @return The tagged string, as Scanner::tagged()
+     */
+    public static function tagTokens($tokens)
+    {
+        $out = '';
+        foreach ($tokens as $t) {
+            list($type, $string, $esc) = $t;
+            if (!$esc) {
+                $string = self::escapeString($string);
+            }
+            if ($type !== null) {
+                $out .= self::tagBlock($type, $string);
+            } else {
+                $out .= $string;
+            }
+        }
+        return $out;
+    }
+
     /**
      * @brief Decodes PCRE error codes to human readable strings
      *
@@ -273,6 +273,19 @@ class AnsiFormatter extends Formatter
 
     private $css = null;
 
+    /**
+     * Escape sequences by token type for the current formatTokens() call
+     */
+    private $sequences = array();
+
+    /**
+     * The theme is converted to the nearest terminal colors
+     */
+    public static function cacheOptions()
+    {
+        return array('wrapWidth', 'theme', 'colorDistanceAlgorithm');
+    }
+
     public function setTheme($theme)
     {
         $this->css = new CssParser();
@@ -335,6 +348,64 @@ class AnsiFormatter extends Formatter
         return $escSeq;
     }
 
+    public function formatTokens($tokens)
+    {
+        if (!$this->consumesTokens()) {
+            return parent::formatTokens($tokens);
+        }
+        if ($this->css === null) {
+            throw new Exception('ANSI formatter has not been set a theme');
+        }
+        $this->sequences = array();
+        return $this->walkTokens($tokens);
+    }
+
+    protected function streamBegin()
+    {
+        if ($this->css === null) {
+            throw new Exception('ANSI formatter has not been set a theme');
+        }
+    }
+
+    /**
+     * format() works line by line, so each piece is formatted on its own. A
+     * wrapped line always ends in a newline, otherwise the pieces need
+     * separating.
+     */
+    protected function pieceOutput($src, $line)
+    {
+        $sep = ($line > 0 && $this->wrapLength <= 0) ? "\n" : '';
+        return $sep . $this->format($src);
+    }
+
+    protected function pieceDocument($pieces, $lines)
+    {
+        return ($lines === 0) ? $this->format('') : implode('', $pieces);
+    }
+
+    protected function streamPiece($src, $line)
+    {
+        $this->emit($this->pieceOutput($src, $line));
+    }
+
+    protected function streamFinish($lines)
+    {
+    }
+
+    protected function tokenOpen($type)
+    {
+        // the nearest color search is expensive, so only do it once per type
+        if (!isset($this->sequences[$type])) {
+            $this->sequences[$type] = $this->insertEscapeSequences(array($type, $type));
+        }
+        return $this->sequences[$type];
+    }
+
+    protected function tokenClose($type)
+    {
+        return "\033[0m";
+    }
+
     public function format($str)
     {
         if ($this->css === null) {
@@ -343,7 +414,7 @@ class AnsiFormatter extends Formatter
         $out = '';
 
         $s = '';
-        $str = preg_replace('%<([^/>]+)>\s*</\\1>%', '', $str);
+        $str = self::stripEmptyTags($str);
         $str = str_replace("\t", '  ', $str);
 
         $lines = explode("\n", $str);
@@ -8,6 +8,10 @@
 
 namespace Luminous\Formatters;
 
+use ReflectionMethod;
+use Luminous\Core\Utils;
+use Luminous\Utils\OutputSink;
+
 /**
  * @brief Abstract class to convert Luminous output into a universal format.
  *
@@ -69,12 +73,50 @@ abstract class Formatter
      */
     public $language = null;
 
+    /**
+     * When formatting to a sink, the output is passed on and flushed every
+     * this many lines. 0 passes output on as soon as it is produced.
+     */
+    public $flushLines = 0;
+
     /**
      * The algorithm to use for calculating color distance, if the formatter
      * supports only a limited number of colors
      */
     public $colorDistanceAlgorithm = 'cie94';
 
+    /**
+     * Current column while walking a token stream, see walkTokens()
+     */
+    private $column = 0;
+
+    /**
+     * The OutputSink output is written to while streaming, see streamStart()
+     */
+    private $sink = null;
+
+    /**
+     * The number of lines passed to streamLines() so far
+     */
+    private $streamedLines = 0;
+
+    /**
+     * Whether streamPiece() can be trusted to format the pieces, see
+     * consumesTokens()
+     */
+    private $streamDirect = false;
+
+    /**
+     * The pieces collected by the default streamPiece()
+     */
+    private $streamBuffer = '';
+
+    /**
+     * Whether pieceOutput() can be trusted to format pieces, see
+     * formatPiece(), or @c NULL until it is worked out
+     */
+    private $piecesDirect = null;
+
     /**
      * The main method for interacting with formatter objects.
      * @param src the input string, which is of the form output by an instance of
@@ -83,6 +125,439 @@ abstract class Formatter
      */
     abstract public function format($src);
 
+    /**
+     * @brief Gets the options which affect this formatter's output
+     *
+     * The cache key includes only these options (see luminous::set()), so
+     * changing any other option doesn't miss the cache. Formatters should
+     * override this to list the options they observe; by default, it is all
+     * of them.
+     *
+     * @return a list of option names, in camelCaps
+     */
+    public static function cacheOptions()
+    {
+        return array(
+            'wrapWidth', 'lineNumbers', 'startLine', 'highlightLines', 'autoLink', 'maxHeight', 'htmlStrict',
+            'theme', 'colorDistanceAlgorithm'
+        );
+    }
+
+    /**
+     * Formats a filtered token stream, as returned by
+     * Scanner::filteredTokens().
+     *
+     * This lets a formatter build its output straight from the tokens instead
+     * of re-parsing the XML string. The default implementation just tags the
+     * tokens and calls format(), so overriding this is optional.
+     *
+     * @param tokens an array of (type, string, escaped?) tokens
+     * @return The formatted string, as format()
+     */
+    public function formatTokens($tokens)
+    {
+        return $this->format(Utils::tagTokens($tokens));
+    }
+
+    /**
+     * Whether it is safe to call formatTokens() instead of format().
+     *
+     * It isn't if format() is overridden further down the hierarchy than
+     * formatTokens(), because then the token path would bypass the override.
+     */
+    public function consumesTokens()
+    {
+        return !$this->overridesFormat('formatTokens');
+    }
+
+    /**
+     * @internal
+     * Whether format() is overridden further down the hierarchy than $method
+     */
+    private function overridesFormat($method)
+    {
+        $format = new ReflectionMethod($this, 'format');
+        $method = new ReflectionMethod($this, $method);
+        return $format->getDeclaringClass()->isSubclassOf($method->class);
+    }
+
+    /**
+     * Starts formatting a document a piece at a time.
+     *
+     * The document is then passed to streamLines() as a series of pieces of
+     * the XML string, each made of whole lines, and finished with
+     * streamEnd(). Output is passed to the sink as soon as it is produced, so
+     * a large document never has to be held in memory as a whole.
+     *
+     * Formatters which can work a piece at a time implement streamBegin(),
+     * streamPiece() and streamFinish(). The default implementation collects
+     * the pieces and formats them all in streamFinish().
+     *
+     * @param sink an OutputSink, or anything an OutputSink can be constructed
+     *    from (e.g. a callable which is passed each string of output). The
+     *    sink is flushed every $flushLines lines.
+     */
+    public function streamStart($sink)
+    {
+        if (!($sink instanceof OutputSink)) {
+            $sink = new OutputSink($sink, $this->flushLines);
+        }
+        $this->sink = $sink;
+        $this->streamedLines = 0;
+        $this->streamBuffer = '';
+        $this->streamDirect = !$this->overridesFormat('streamPiece');
+        if ($this->streamDirect) {
+            $this->streamBegin();
+        }
+    }
+
+    /**
+     * Formats the next piece of a streamed document.
+     *
+     * @param src whole lines of the XML string. The newline ending the last
+     *    line is left off, i.e. consecutive pieces are separated by a newline.
+     */
+    public function streamLines($src)
+    {
+        if ($this->streamDirect) {
+            $this->streamPiece($src, $this->streamedLines);
+        } else {
+            Formatter::streamPiece($src, $this->streamedLines);
+        }
+        $lines = substr_count($src, "\n") + 1;
+        $this->streamedLines += $lines;
+        $this->sink->lines($lines);
+    }
+
+    /**
+     * Finishes a streamed document
+     */
+    public function streamEnd()
+    {
+        if ($this->streamDirect) {
+            $this->streamFinish($this->streamedLines);
+        } else {
+            Formatter::streamFinish($this->streamedLines);
+        }
+        $this->sink->close();
+        $this->sink = null;
+    }
+
+    /**
+     * Formats a string as format() does, but writes the output to a sink
+     * instead of returning it, $flushLines lines at a time.
+     *
+     * @param src the input string, as format()
+     * @param sink the sink, as streamStart()
+     */
+    public function formatTo($src, $sink)
+    {
+        $this->streamStart($sink);
+        $offset = 0;
+        do {
+            $end = ($this->flushLines > 0) ? $offset - 1 : false;
+            for ($i = 0; $i < $this->flushLines; $i++) {
+                $end = strpos($src, "\n", $end + 1);
+                if ($end === false) {
+                    break;
+                }
+            }
+            if ($end === false) {
+                $this->streamLines((string)substr($src, $offset));
+            } else {
+                $this->streamLines((string)substr($src, $offset, $end - $offset));
+                $offset = $end + 1;
+            }
+        } while ($end !== false);
+        $this->streamEnd();
+    }
+
+    /**
+     * Formats one piece of a document by itself.
+     *
+     * This is for callers which hold a document as a list of formatted pieces
+     * and re-format only the pieces which change (see IncrementalHighlighter).
+     * joinPieces() then puts the document together, and the result is the
+     * same as format() gives for the whole document.
+     *
+     * @param src the piece, as streamLines()
+     * @param line the number of lines before the piece, so 0 for the first
+     *    piece
+     */
+    public function formatPiece($src, $line)
+    {
+        return $this->piecesDirect() ? $this->pieceOutput($src, $line) : Formatter::pieceOutput($src, $line);
+    }
+
+    /**
+     * Puts a document together from pieces formatted by formatPiece().
+     *
+     * @param pieces the formatted pieces, in order
+     * @param lines the number of lines in the document, as streamLines()
+     *    counts them
+     */
+    public function joinPieces($pieces, $lines)
+    {
+        if ($this->piecesDirect()) {
+            return $this->pieceDocument($pieces, $lines);
+        }
+        return Formatter::pieceDocument($pieces, $lines);
+    }
+
+    /**
+     * @internal
+     * Whether the formatter's own pieceOutput() and pieceDocument() are used,
+     * as streamStart() decides for streamPiece()
+     */
+    private function piecesDirect()
+    {
+        if ($this->piecesDirect === null) {
+            $this->piecesDirect = !$this->overridesFormat('pieceOutput');
+        }
+        return $this->piecesDirect;
+    }
+
+    /**
+     * Hook for formatPiece(). Formatters which can work a piece at a time
+     * override this and pieceDocument(); by default the piece is kept as it
+     * is, and pieceDocument() formats the whole document.
+     */
+    protected function pieceOutput($src, $line)
+    {
+        return ($line > 0) ? "\n" . $src : $src;
+    }
+
+    /**
+     * Hook for joinPieces()
+     */
+    protected function pieceDocument($pieces, $lines)
+    {
+        return $this->format(implode('', $pieces));
+    }
+
+    /**
+     * Hook for streamStart(): the formatter should emit any output which
+     * comes before the code
+     */
+    protected function streamBegin()
+    {
+    }
+
+    /**
+     * Hook for streamLines(): the formatter should format and emit a piece
+     *
+     * @param src the piece, as streamLines()
+     * @param line the number of lines streamed before this piece, so 0 for
+     *    the first piece
+     */
+    protected function streamPiece($src, $line)
+    {
+        if ($line > 0) {
+            $this->streamBuffer .= "\n";
+        }
+        $this->streamBuffer .= $src;
+    }
+
+    /**
+     * Hook for streamEnd(): the formatter should emit whatever is left
+     *
+     * @param lines the number of lines which were streamed
+     */
+    protected function streamFinish($lines)
+    {
+        $buffer = $this->streamBuffer;
+        $this->streamBuffer = '';
+        $this->emit($this->format($buffer));
+    }
+
+    /**
+     * Passes a string of output to the sink while streaming
+     */
+    protected function emit($output)
+    {
+        $this->sink->write($output);
+    }
+
+    /**
+     * @internal
+     * Converts a token stream to plain text output, calling tokenOpen(),
+     * tokenClose(), tokenText() and tokenNewline() to produce the markup.
+     *
+     * This follows the same rules as converting the XML string would: tabs are
+     * expanded to two spaces, tags are closed and reopened around newlines,
+     * and lines are wrapped as wrapLine() wraps them. Pre-escaped tokens are
+     * split into their nested tags and unescaped text. Tags around empty or
+     * whitespace-only segments are dropped but the whitespace is kept, as
+     * stripEmptyTags() does for the XML string.
+     *
+     * @param tokens a filtered token stream
+     * @return the output string
+     */
+    protected function walkTokens($tokens)
+    {
+        $out = '';
+        $this->column = 0;
+        foreach ($tokens as $t) {
+            list($type, $text, $esc) = $t;
+            if ($esc) {
+                $text = self::stripEmptyTags($text);
+            }
+            $segments = explode("\n", $text);
+            foreach ($segments as $i => $segment) {
+                if ($i) {
+                    $out .= $this->tokenNewline();
+                    $this->column = 0;
+                }
+                if ($segment === '') {
+                    continue;
+                }
+                $tagged = $type !== null && !ctype_space($segment);
+                if ($tagged) {
+                    $out .= $this->tokenOpen($type);
+                }
+                if (!$esc) {
+                    $out .= $this->walkText($segment);
+                } else {
+                    $out .= $this->walkEscaped($segment);
+                }
+                if ($tagged) {
+                    $out .= $this->tokenClose($type);
+                }
+            }
+        }
+        // wrapLine() terminates every line
+        if ($this->wrapLength > 0) {
+            $out .= $this->tokenNewline();
+        }
+        return $out;
+    }
+
+    /**
+     * @internal
+     * Removes the tags around empty or whitespace-only strings from an XML
+     * string, leaving the whitespace in place
+     */
+    protected static function stripEmptyTags($str)
+    {
+        return preg_replace('%<([^/>]+)>(\s*)</\\1>%', '$2', $str);
+    }
+
+    /**
+     * @internal
+     * Walks a pre-escaped segment, which may contain nested tags
+     */
+    private function walkEscaped($segment)
+    {
+        $out = '';
+        $pieces = preg_split('/(<[^>]+>)/', $segment, -1, PREG_SPLIT_DELIM_CAPTURE | PREG_SPLIT_NO_EMPTY);
+        foreach ($pieces as $piece) {
+            if ($piece[0] !== '<') {
+                $out .= $this->walkText(
+                    str_replace(array('&gt;', '&lt;', '&amp;'), array('>', '<', '&'), $piece)
+                );
+            } elseif ($piece[1] === '/') {
+                $out .= $this->tokenClose(substr($piece, 2, -1));
+            } else {
+                $out .= $this->tokenOpen(substr($piece, 1, -1));
+            }
+        }
+        return $out;
+    }
+
+    /**
+     * @internal
+     * Walks a piece of raw text which contains no newlines, wrapping it.
+     * The rules are the same as wrapLine()'s, where &, < and > are the
+     * characters which would have been entities.
+     */
+    private function walkText($text)
+    {
+        $text = str_replace("\t", '  ', $text);
+        $wrapLength = $this->wrapLength;
+        $len = strlen($text);
+        if ($wrapLength <= 0 || $this->column + $len <= $wrapLength) {
+            $this->column += $len;
+            return $this->tokenText($text);
+        }
+
+        $out = '';
+        $strlen = $this->column;
+        $pieces = preg_split('/([ \t]+|[&<>])/', $text, -1, PREG_SPLIT_NO_EMPTY | PREG_SPLIT_DELIM_CAPTURE);
+        foreach ($pieces as $l) {
+            $s = strlen($l);
+            if ($s === 1 && ($l === '&' || $l === '<' || $l === '>')) {
+                if (++$strlen > $wrapLength) {
+                    $strlen = 1;
+                    $out .= $this->tokenNewline();
+                }
+                $out .= $this->tokenText($l);
+                continue;
+            }
+            if ($s + $strlen <= $wrapLength) {
+                $out .= $this->tokenText($l);
+                $strlen += $s;
+                continue;
+            }
+            if ($s <= $wrapLength) {
+                $out .= $this->tokenNewline() . $this->tokenText($l);
+                $strlen = $s;
+                continue;
+            }
+            $diff = $wrapLength - $strlen;
+            $out .= $this->tokenText(substr($l, 0, $diff)) . $this->tokenNewline();
+            $l = substr($l, $diff);
+            $strlen = 0;
+            while (($strl = strlen($l)) > 0) {
+                if ($strl > $wrapLength) {
+                    $out .= $this->tokenText(substr($l, 0, $wrapLength)) . $this->tokenNewline();
+                    $l = substr($l, $wrapLength);
+                } else {
+                    $out .= $this->tokenText($l);
+                    $strlen = $strl;
+                    break;
+                }
+            }
+        }
+        $this->column = $strlen;
+        return $out;
+    }
+
+    /**
+     * @internal
+     * Hook for walkTokens(): the markup which opens a token type
+     */
+    protected function tokenOpen($type)
+    {
+        return '';
+    }
+
+    /**
+     * @internal
+     * Hook for walkTokens(): the markup which closes a token type
+     */
+    protected function tokenClose($type)
+    {
+        return '';
+    }
+
+    /**
+     * @internal
+     * Hook for walkTokens(): converts raw text to the output format
+     */
+    protected function tokenText($text)
+    {
+        return $text;
+    }
+
+    /**
+     * @internal
+     * Hook for walkTokens(): the output for a line break
+     */
+    protected function tokenNewline()
+    {
+        return "\n";
+    }
+
     /**
      * If relevant, the formatter should implement this and use LuminousCSSParser
      * to port the theme.
@@ -11,6 +11,14 @@ class FullPageHtmlFormatter extends HtmlFormatter
     protected $themeCss = null;
     protected $css = null;
 
+    /**
+     * The theme is embedded in the page, and there is no height constraint
+     */
+    public static function cacheOptions()
+    {
+        return array('wrapWidth', 'lineNumbers', 'startLine', 'highlightLines', 'autoLink', 'htmlStrict', 'theme');
+    }
+
     public function setTheme($css)
     {
         $this->themeCss = $css;
@@ -23,11 +31,17 @@ class FullPageHtmlFormatter extends HtmlFormatter
         $this->css = file_get_contents($path);
     }
 
-    public function format($src)
+    protected function prepare()
     {
         $this->height = 0;
-        $this->getLayout();
-        $fmted = parent::format($src);
+        // this runs for every piece of a document formatted piecewise
+        if ($this->css === null) {
+            $this->getLayout();
+        }
+    }
+
+    protected function document($fmted)
+    {
         return <<<EOF
 <!DOCTYPE html>
 <html>
@@ -11,12 +11,39 @@ class HtmlFormatter extends Formatter
     protected $inline = false;
     public $height = 0;
 
+    /**
+     * Marks where the code goes when the templates are split up for
+     * streaming. It can't occur in a template.
+     */
+    const STREAM_MARKER = "\0";
+
+    /**
+     * The output which goes after the code while streaming
+     */
+    private $streamTail = '';
+
+    /**
+     * While streaming numbered output: a temporary stream holding the code,
+     * which can only be emitted after the line numbers, and the template
+     * pieces around the line numbers
+     */
+    private $streamCode = null;
+    private $streamNumbered = null;
+
     /**
      * strict HTML standards: the target attribute won't be used in links
      * @since  0.5.7
      */
     public $strictStandards = false;
 
+    /**
+     * The theme is linked from the page, not part of the output
+     */
+    public static function cacheOptions()
+    {
+        return array('wrapWidth', 'lineNumbers', 'startLine', 'highlightLines', 'autoLink', 'maxHeight', 'htmlStrict');
+    }
+
     private function heightCss()
     {
         $height = trim('' . $this->height);
@@ -63,20 +90,167 @@ class HtmlFormatter extends Formatter
     }
 
     private function formatNumberless($src)
+    {
+        return $this->numberlessBlock($this->linesNumberless($src));
+    }
+
+    private function numberlessBlock($code)
     {
         return HtmlTemplates::format(
             HtmlTemplates::NUMBERLESS_TEMPLATE,
             array(
                 'height_css' => $this->heightCss(),
-                'code' => $this->linesNumberless($src)
+                'code' => $code
             )
         );
     }
 
+    /**
+     * Hook for subclasses to adjust their settings before formatting
+     */
+    protected function prepare()
+    {
+    }
+
+    /**
+     * Hook for subclasses to wrap the finished HTML
+     */
+    protected function document($html)
+    {
+        return $html;
+    }
+
     public function format($src)
     {
-        $lineNumbers = false;
+        $this->prepare();
+        return $this->document($this->formatCode($src, true));
+    }
+
+    /**
+     * Builds the HTML straight from the token stream. Tokens are escaped and
+     * wrapped in spans here, so the only tags which need converting are the
+     * nested ones inside pre-escaped tokens.
+     */
+    public function formatTokens($tokens)
+    {
+        if (!$this->consumesTokens()) {
+            return parent::formatTokens($tokens);
+        }
+        $this->prepare();
+        return $this->document($this->formatCode($this->tokensToHtml($tokens), false));
+    }
+
+    /**
+     * Splits the document around the code at STREAM_MARKER. The numbered
+     * layout puts the line numbers before the code, and the numbers aren't
+     * known until the end, so the code is held in a temporary stream (which
+     * PHP moves to disk once it grows) and everything is emitted at the end.
+     */
+    protected function streamBegin()
+    {
+        $this->prepare();
+        $outer = explode(self::STREAM_MARKER, $this->document(HtmlTemplates::format(
+            $this->inline ? HtmlTemplates::INLINE_TEMPLATE : HtmlTemplates::CONTAINER_TEMPLATE,
+            array(
+                'language' => ($this->language === null) ? '' : htmlentities($this->language),
+                'subelement' => self::STREAM_MARKER,
+                'height_css' => $this->heightCss()
+            )
+        )));
+        if ($this->lineNumbers) {
+            $this->streamNumbered = explode(self::STREAM_MARKER, HtmlTemplates::format(
+                HtmlTemplates::NUMBERED_TEMPLATE,
+                array(
+                    'start_line' => $this->startLine,
+                    'height_css' => $this->heightCss(),
+                    'highlight_lines' => implode(',', $this->highlightLines),
+                    'line_numbers' => self::STREAM_MARKER,
+                    'code' => self::STREAM_MARKER
+                )
+            ));
+            $this->streamCode = fopen('php://temp', 'w+b');
+            $this->emit($outer[0] . $this->streamNumbered[0]);
+            $this->streamTail = $this->streamNumbered[2] . $outer[1];
+        } else {
+            $inner = explode(self::STREAM_MARKER, HtmlTemplates::format(
+                HtmlTemplates::NUMBERLESS_TEMPLATE,
+                array('height_css' => $this->heightCss(), 'code' => self::STREAM_MARKER)
+            ));
+            $this->emit($outer[0] . $inner[0]);
+            $this->streamTail = $inner[1] . $outer[1];
+        }
+    }
+
+    protected function streamPiece($src, $line)
+    {
+        $html = $this->pieceOutput($src, $line);
+        if ($this->streamCode === null) {
+            $this->emit($html);
+        } else {
+            fwrite($this->streamCode, $html);
+        }
+    }
+
+    protected function streamFinish($lines)
+    {
+        if ($this->streamCode !== null) {
+            if ($lines === 0) {
+                $this->streamPiece('', 0);
+                $lines = 1;
+            }
+            // the line numbers, a few at a time
+            $last = $this->startLine + $lines - 1;
+            for ($i = $this->startLine; $i <= $last; $i += 1000) {
+                $this->emit('<span>' . implode('</span><span>', range($i, min($i + 999, $last))) . '</span>');
+            }
+            $this->emit($this->streamNumbered[1]);
+            rewind($this->streamCode);
+            while (!feof($this->streamCode)) {
+                $this->emit((string)fread($this->streamCode, 65536));
+            }
+            fclose($this->streamCode);
+            $this->streamCode = null;
+            $this->streamNumbered = null;
+        }
+        $this->emit($this->streamTail);
+        $this->streamTail = '';
+    }
+
+    /**
+     * Formats a piece of the code: its lines for the numbered layout, or its
+     * text for the numberless one
+     */
+    protected function pieceOutput($src, $line)
+    {
+        $this->prepare();
+        if ($this->link) {
+            $src = $this->linkify($src);
+        }
+        if ($this->lineNumbers) {
+            return self::convertTags('<span>' . str_replace("\n", "\n</span><span>", $src) . "\n</span>");
+        }
+        return self::convertTags((($line > 0) ? "\n" : '') . $this->linesNumberless($src));
+    }
 
+    protected function pieceDocument($pieces, $lines)
+    {
+        $this->prepare();
+        if ($lines === 0) {
+            $pieces = array($this->pieceOutput('', 0));
+            $lines = 1;
+        }
+        $code = implode('', $pieces);
+        $codeBlock = $this->lineNumbers ? $this->numberedBlock($code, $lines) : $this->numberlessBlock($code);
+        return $this->document($this->container($codeBlock));
+    }
+
+    /**
+     * @param $src the code, which is either the XML string or already HTML
+     * @param $convertTags whether $src is the XML string, in which case its
+     *    tags are converted to spans
+     */
+    private function formatCode($src, $convertTags)
+    {
         if ($this->link) {
             $src = $this->linkify($src);
         }
@@ -88,15 +262,17 @@ class HtmlFormatter extends Formatter
             $codeBlock = $this->formatNumberless($src);
         }
 
-        // convert </ABC> to </span>
-        $codeBlock = preg_replace('/(?<=<\/)[A-Z_0-9]+(?=>)/S', 'span', $codeBlock);
-        // convert <ABC> to <span class=ABC>
-        $cb = function ($matches) {
-            $m1 = strtolower($matches[1]);
-            return "<span class=" . $m1 . ">";
-        };
-        $codeBlock = preg_replace_callback('/<([A-Z_0-9]+)>/', $cb, $codeBlock);
+        if ($convertTags) {
+            $codeBlock = self::convertTags($codeBlock);
+        }
+        return $this->container($codeBlock);
+    }
 
+    /**
+     * Wraps the code block in the container
+     */
+    private function container($codeBlock)
+    {
         $formatData = array(
             'language' => ($this->language === null) ? '' : htmlentities($this->language),
             'subelement' => $codeBlock,
@@ -108,6 +284,55 @@ class HtmlFormatter extends Formatter
         );
     }
 
+    /**
+     * Converts </ABC> to </span> and <ABC> to <span class=abc>
+     */
+    private static function convertTags($str)
+    {
+        $str = preg_replace('/(?<=<\/)[A-Z_0-9]+(?=>)/S', 'span', $str);
+        $cb = function ($matches) {
+            $m1 = strtolower($matches[1]);
+            return "<span class=" . $m1 . ">";
+        };
+        return preg_replace_callback('/<([A-Z_0-9]+)>/', $cb, $str);
+    }
+
+    /**
+     * Converts a token stream to HTML, as convertTags(Utils::tagTokens())
+     * would.
+     */
+    private function tokensToHtml($tokens)
+    {
+        $out = '';
+        $tags = array();
+        foreach ($tokens as $t) {
+            list($type, $text, $esc) = $t;
+            if ($esc) {
+                if (strpos($text, '<') !== false) {
+                    $text = self::convertTags($text);
+                }
+            } else {
+                $text = htmlspecialchars($text, ENT_NOQUOTES);
+            }
+            if ($type === null) {
+                $out .= $text;
+                continue;
+            }
+            if (!isset($tags[$type])) {
+                $tags[$type] = preg_match('/^[A-Z_0-9]+$/', $type)
+                    ? array('<span class=' . strtolower($type) . '>', '</span>')
+                    : array("<$type>", "</$type>");
+            }
+            list($open, $close) = $tags[$type];
+            if (strpos($text, "\n") === false) {
+                $out .= $open . $text . $close;
+            } else {
+                $out .= $open . str_replace("\n", $close . "\n" . $open, $text) . $close;
+            }
+        }
+        return $out;
+    }
+
     /**
      * Detects and links URLs - callback
      */
@@ -171,8 +396,15 @@ class HtmlFormatter extends Formatter
     private function formatNumbered($src)
     {
         $lines = '<span>' . str_replace("\n", "\n</span><span>", $src, $numReplacements) . "\n</span>";
-        $numLines = $numReplacements + 1;
+        return $this->numberedBlock($lines, $numReplacements + 1);
+    }
 
+    /**
+     * @param $lines the code, with each line in a span
+     * @param $numLines the number of lines
+     */
+    private function numberedBlock($lines, $numLines)
+    {
         $lineNumbers =
             '<span>'
             . implode('</span><span>', range($this->startLine, $this->startLine + $numLines - 1, 1))
@@ -9,10 +9,27 @@ namespace Luminous\Formatters;
  */
 class IdentityFormatter extends Formatter
 {
+    /**
+     * The output is the input, whatever the options
+     */
+    public static function cacheOptions()
+    {
+        return array();
+    }
+
     public function format($str)
     {
         return $str;
     }
+
+    protected function streamPiece($src, $line)
+    {
+        $this->emit(($line > 0) ? "\n" . $src : $src);
+    }
+
+    protected function streamFinish($lines)
+    {
+    }
 }
 
 /** @endcond */
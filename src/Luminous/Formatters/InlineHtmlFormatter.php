@@ -6,12 +6,19 @@ namespace Luminous\Formatters;
 
 class InlineHtmlFormatter extends HtmlFormatter
 {
-    public function format($src)
+    /**
+     * Inline output has no line numbers or height constraint
+     */
+    public static function cacheOptions()
+    {
+        return array('wrapWidth', 'autoLink', 'htmlStrict');
+    }
+
+    protected function prepare()
     {
         $this->lineNumbers = false;
         $this->height = 0;
         $this->inline = true;
-        return parent::format($src);
     }
 }
 
@@ -15,6 +15,20 @@ class LatexFormatter extends Formatter
 {
     private $css = null;
 
+    /**
+     * The open \\lms commands while walking a token stream, which have to be
+     * closed and reopened around newlines
+     */
+    private $stack = array();
+
+    /**
+     * Links aren't supported, and lines are always numbered from 1
+     */
+    public static function cacheOptions()
+    {
+        return array('wrapWidth', 'lineNumbers', 'theme');
+    }
+
     public function setTheme($theme)
     {
         $this->css = new CssParser();
@@ -89,7 +103,7 @@ class LatexFormatter extends Formatter
         return "";
     }
 
-    public function format($str)
+    private function preamble()
     {
         $out = '';
 
@@ -111,9 +125,133 @@ class LatexFormatter extends Formatter
 $verbcmd
 
 EOF;
+        return $out;
+    }
+
+    private function postamble()
+    {
+        // MW: I'm not really sure why but here we need to escape the
+        // backslashes or we end up with strange characters in the output. They
+        // work OK in the preable section.
+        return <<<EOF
+
+\\end{Verbatim}
+\\end{document}
+
+EOF;
+    }
+
+    public function formatTokens($tokens)
+    {
+        if (!$this->consumesTokens()) {
+            return parent::formatTokens($tokens);
+        }
+        $out = $this->preamble();
+        $this->stack = array("\\lmsCODE{");
+        $out .= "\\lmsCODE{" . $this->walkTokens($tokens) . '}';
+        $this->stack = array();
+        return $out . $this->postamble();
+    }
+
+    protected function tokenOpen($type)
+    {
+        $cmd = "\\lms" . str_replace('_', '', $type) . '{';
+        $this->stack[] = $cmd;
+        return $cmd;
+    }
+
+    protected function tokenClose($type)
+    {
+        array_pop($this->stack);
+        return '}';
+    }
+
+    protected function tokenText($text)
+    {
+        return strtr($text, array(
+            '#' => '\\#',
+            '{' => '\\{',
+            '}' => '\\}',
+            '_' => '\\_',
+            '$' => '\\$',
+            '&' => '\\&',
+            '\\' => '{\\textbackslash}'
+        ));
+    }
+
+    /**
+     * Newline literals inside arguments are ignored, so all open lms commands
+     * are closed before the newline and reopened afterwards (see format()).
+     */
+    protected function tokenNewline()
+    {
+        return str_repeat('}', count($this->stack)) . "\n" . implode('', $this->stack);
+    }
+
+    protected function streamBegin()
+    {
+        $this->emit($this->preamble());
+    }
 
+    /**
+     * Each piece is formatted on its own. When lines are wrapped, every line
+     * ends with a newline after which the code command is reopened, so the
+     * reopening at the end of each piece is dropped and added once at the
+     * end. This gives the same output as format().
+     */
+    protected function pieceOutput($src, $line)
+    {
+        $body = $this->body($src);
+        if ($this->wrapLength <= 0) {
+            return (($line > 0) ? "\n" : '') . $body;
+        }
+        $reopen = '\lmsCODE{}';
+        if (substr($body, -strlen($reopen)) === $reopen) {
+            $body = substr($body, 0, -strlen($reopen));
+        }
+        return $body;
+    }
+
+    protected function pieceDocument($pieces, $lines)
+    {
+        return $this->preamble() . implode('', $pieces) . $this->bodyEnd($lines) . $this->postamble();
+    }
+
+    protected function streamPiece($src, $line)
+    {
+        $this->emit($this->pieceOutput($src, $line));
+    }
+
+    protected function streamFinish($lines)
+    {
+        $this->emit($this->bodyEnd($lines) . $this->postamble());
+    }
+
+    /**
+     * What goes after the pieces of a document with $lines lines
+     */
+    private function bodyEnd($lines)
+    {
+        if ($lines === 0) {
+            return $this->body('');
+        }
+        return ($this->wrapLength > 0) ? '\lmsCODE{}' : '';
+    }
+
+    public function format($str)
+    {
+        return $this->preamble() . $this->body($str) . $this->postamble();
+    }
+
+    /**
+     * Converts the XML string to LaTeX commands, without the document around
+     * them
+     */
+    private function body($str)
+    {
+        $out = '';
         $s = '';
-        $str = preg_replace('%<([^/>]+)>\s*</\\1>%', '', $str);
+        $str = self::stripEmptyTags($str);
         $str = str_replace("\t", '  ', $str);
 
         $lines = explode("\n", $str);
@@ -196,15 +334,6 @@ EOF;
         $s = implode('', $pieces);
 
         $out .= $s;
-        // MW: I'm not really sure why but here we need to escape the
-        // backslashes or we end up with strange characters in the output. They
-        // work OK in the preable section.
-        $out .= <<<EOF
-
-\\end{Verbatim}
-\\end{document}
-
-EOF;
         return $out;
     }
 }
@@ -0,0 +1,325 @@
+<?php
+
+namespace Luminous;
+
+use InvalidArgumentException;
+use Luminous\Core\Utils;
+
+/**
+ * @cond USER
+ *
+ * @brief Re-highlights a source string as it is edited
+ *
+ * This is for live previews, where the same source is highlighted again after
+ * every small edit. The document is held as a list of pieces, which start at
+ * line starts where the scanner took a checkpoint of its state (see
+ * Scanner::enableCheckpoints()). Each piece keeps its formatted output (see
+ * Formatter::formatPiece()) and the scanner state at its start.
+ *
+ * An edit rescans a window of the new source from the start of the piece
+ * before the one the edit starts in, resuming from that piece's saved state.
+ * The scanner is given the source up to the end of the window, so it sees the
+ * same context as a full scan. The rescan is back in sync as soon as it takes
+ * a checkpoint after the edit which matches the state saved for an old piece
+ * starting at the same place, since everything from there on then scans as
+ * it did before. Only the pieces up to that point are replaced and
+ * re-formatted. If no checkpoint matches, the window is doubled, up to the end
+ * of the source. Scanning, filtering and formatting then depend on the size
+ * of the edit rather than the size of the source; only joining the pieces
+ * back together sees the whole document.
+ *
+ * Scanners which can't take checkpoints, or whose filters need to see the
+ * whole token stream (see Scanner::filtersByLine()), are rescanned in full.
+ * That includes scanners which record definitions, since adding or renaming
+ * one changes how its name is highlighted before it as well as after.
+ * So are sources with carriage returns, which the scanner turns into
+ * newlines, so its offsets don't match the source's.
+ *
+ * Use luminous::highlightIncremental() to create one of these.
+ */
+class IncrementalHighlighter
+{
+    /**
+     * The scanner table
+     */
+    private $scanners;
+
+    /**
+     * The language code of the scanner
+     */
+    private $code;
+
+    /**
+     * The formatter instance
+     */
+    private $formatter;
+
+    /**
+     * The current source string
+     */
+    private $source;
+
+    /**
+     * The pieces of the document, in order. Each is a map with the keys
+     * 'length' (the number of bytes of source it covers), 'lines' (the number
+     * of lines it covers, as Formatter::streamLines() counts them), 'state'
+     * (the scanner state at its start, or @c NULL for the initial state) and
+     * 'output' (its formatted output). This is @c NULL if the scanner can't
+     * be resumed.
+     */
+    private $pieces = null;
+
+    /**
+     * The total number of lines in $pieces
+     */
+    private $lines = 0;
+
+    /**
+     * The formatted output for $source
+     */
+    private $output;
+
+    /**
+     * @param $scanners the Scanners table
+     * @param $code the language code of the scanner to use
+     * @param $source the initial source string
+     * @param $formatter the formatter to format the output with
+     */
+    public function __construct(Scanners $scanners, $code, $source, $formatter)
+    {
+        $this->scanners = $scanners;
+        $this->code = $code;
+        $this->formatter = $formatter;
+        $this->highlightAll($source);
+    }
+
+    /**
+     * @brief Gets the highlighted output for the current source
+     */
+    public function output()
+    {
+        return $this->output;
+    }
+
+    /**
+     * @brief Gets the current source string
+     */
+    public function source()
+    {
+        return $this->source;
+    }
+
+    /**
+     * @brief Applies an edit to the source and re-highlights it
+     *
+     * @param $offset the byte offset at which the edit starts
+     * @param $deleteLength the number of bytes removed at $offset
+     * @param $insert the string inserted at $offset
+     * @return the highlighted output for the edited source
+     * @throw InvalidArgumentException if the edit is outside the source
+     */
+    public function edit($offset, $deleteLength, $insert)
+    {
+        $length = strlen($this->source);
+        if ($offset < 0 || $deleteLength < 0 || $offset + $deleteLength > $length) {
+            throw new InvalidArgumentException("Invalid edit [$offset, +$deleteLength] of $length bytes");
+        }
+        $source = substr($this->source, 0, $offset) . $insert . substr($this->source, $offset + $deleteLength);
+        if ($this->pieces === null || strpos($insert, "\r") !== false) {
+            $this->highlightAll($source);
+        } else {
+            $this->splice($source, $offset, $offset + $deleteLength, strlen($insert) - $deleteLength);
+        }
+        return $this->output;
+    }
+
+    /**
+     * @brief Scans and formats a whole source string
+     * @internal
+     */
+    private function highlightAll($source)
+    {
+        $this->source = $source;
+        $start = array('line' => 0, 'pos' => 0, 'state' => null);
+        $scanner = $this->scanner($source, $start);
+        $scanner->main();
+        if ($scanner->checkpointable() && $scanner->filtersByLine() && strpos($source, "\r") === false) {
+            $this->pieces = $this->cut($scanner, $start, $scanner->checkpoints(), strlen($source));
+            $this->lines = 0;
+            foreach ($this->pieces as $piece) {
+                $this->lines += $piece['lines'];
+            }
+            $this->join();
+        } else {
+            $this->pieces = null;
+            $tokens = $scanner->filteredTokens();
+            $this->output = $this->formatter->consumesTokens()
+                ? $this->formatter->formatTokens($tokens)
+                : $this->formatter->format(Utils::tagTokens($tokens));
+        }
+        $this->scanners->releaseScanner($scanner);
+    }
+
+    /**
+     * @brief Gets a scanner from the pool, set up to scan the given string
+     * from a checkpoint, taking a checkpoint at every line it can
+     * @internal
+     */
+    private function scanner($text, $start)
+    {
+        $scanner = $this->scanners->acquireScanner($this->code);
+        $scanner->prepare($text);
+        $scanner->enableCheckpoints(1);
+        if ($start['state'] !== null) {
+            $scanner->restoreCheckpoint($start);
+        }
+        return $scanner;
+    }
+
+    /**
+     * @brief Cuts a scanned window of the source into pieces and formats them
+     *
+     * @param $scanner the scanner, which has scanned the window
+     * @param $start the checkpoint the window starts at
+     * @param $cuts the checkpoints to cut the window at, in order. The last
+     *    piece ends at the last of these.
+     * @param $end the end of the window, if the last piece carries on to it
+     *    after the last cut, otherwise @c NULL
+     * @return the list of pieces
+     * @internal
+     */
+    private function cut($scanner, $start, $cuts, $end)
+    {
+        // each line of the tagged string stands alone, so it can be cut at
+        // any newline
+        $tagged = explode("\n", $scanner->tagged());
+        if ($end !== null) {
+            $cuts[] = array('line' => $start['line'] + count($tagged), 'pos' => $end, 'state' => null);
+        }
+        $pieces = array();
+        $from = $start;
+        foreach ($cuts as $to) {
+            $lines = $to['line'] - $from['line'];
+            $pieces[] = array(
+                'length' => $to['pos'] - $from['pos'],
+                'lines' => $lines,
+                'state' => $from['state'],
+                'output' => $this->formatter->formatPiece(
+                    implode("\n", array_slice($tagged, $from['line'] - $start['line'], $lines)),
+                    $from['line']
+                )
+            );
+            $from = $to;
+        }
+        return $pieces;
+    }
+
+    /**
+     * @brief Rescans the pieces around an edit and splices them into the
+     * document
+     *
+     * @param $source the edited source
+     * @param $offset where the edit starts
+     * @param $end where the edit ends, in the old source
+     * @param $delta the change in length
+     * @internal
+     */
+    private function splice($source, $offset, $end, $delta)
+    {
+        $n = count($this->pieces);
+        // the piece the edit starts in, and where it starts
+        $first = 0;
+        $pos = 0;
+        $line = 0;
+        while ($first < $n - 1 && $pos + $this->pieces[$first]['length'] <= $offset) {
+            $pos += $this->pieces[$first]['length'];
+            $line += $this->pieces[$first]['lines'];
+            $first++;
+        }
+        // start a piece early, in case the scanner looked past the end of a
+        // line
+        if ($first > 0) {
+            $first--;
+            $pos -= $this->pieces[$first]['length'];
+            $line -= $this->pieces[$first]['lines'];
+        }
+        $start = array('line' => $line, 'pos' => $pos, 'state' => $this->pieces[$first]['state']);
+
+        for ($step = 2; true; $step *= 2) {
+            // the window runs to the end of the $step'th piece which ends
+            // after the edit, or to the end of the source
+            $stop = $first;
+            $stopPos = $pos;
+            for ($k = 0; $stop < $n && $k < $step; $stop++) {
+                $stopPos += $this->pieces[$stop]['length'];
+                if ($stopPos > $end) {
+                    $k++;
+                }
+            }
+            $atEnd = ($stop === $n);
+            $length = $stopPos + $delta;
+            $scanner = $this->scanner(substr($source, 0, $length), $start);
+            $scanner->main();
+
+            // look for a checkpoint after the edit which matches the start of
+            // an old piece. One at the end of the window can't be trusted, as
+            // the scanner didn't see past it.
+            $cuts = array();
+            $sync = null;
+            $j = $first;
+            $jPos = $pos;
+            foreach ($scanner->checkpoints() as $checkpoint) {
+                if (!$atEnd && $checkpoint['pos'] >= $length) {
+                    break;
+                }
+                $cuts[] = $checkpoint;
+                $old = $checkpoint['pos'] - $delta;
+                if ($old < $end) {
+                    continue;
+                }
+                while ($j < $n && $jPos < $old) {
+                    $jPos += $this->pieces[$j]['length'];
+                    $j++;
+                }
+                if ($j < $n && $jPos === $old && $this->pieces[$j]['state'] === $checkpoint['state']) {
+                    $sync = $j;
+                    break;
+                }
+            }
+            if ($sync !== null || $atEnd) {
+                break;
+            }
+            $this->scanners->releaseScanner($scanner);
+        }
+
+        if ($sync === null) {
+            $sync = $n;
+        }
+        $pieces = $this->cut($scanner, $start, $cuts, ($sync === $n) ? $length : null);
+        $this->scanners->releaseScanner($scanner);
+        for ($i = $first; $i < $sync; $i++) {
+            $this->lines -= $this->pieces[$i]['lines'];
+        }
+        foreach ($pieces as $piece) {
+            $this->lines += $piece['lines'];
+        }
+        array_splice($this->pieces, $first, $sync - $first, $pieces);
+        $this->source = $source;
+        $this->join();
+    }
+
+    /**
+     * @brief Puts the output together from the pieces
+     * @internal
+     */
+    private function join()
+    {
+        $outputs = array();
+        foreach ($this->pieces as $piece) {
+            $outputs[] = $piece['output'];
+        }
+        $this->output = $this->formatter->joinPieces($outputs, $this->lines);
+    }
+}
+
+/** @endcond */
@@ -0,0 +1,283 @@
+<?php
+
+/** @cond ALL */
+
+namespace Luminous;
+
+use Luminous\Classifier\NgramClassifier;
+
+/**
+ * @brief Guesses the language of a source string
+ *
+ * This asks each scanner's static guessLanguage() for the probability that
+ * the source is in its language, but tries to avoid doing so where it can:
+ *
+ * @li A filename's extension, if it is a registered language code, decides
+ *     the language outright.
+ * @li So does the interpreter named on a shebang (#!) line.
+ * @li Large sources are cut down to a sample of lines from the start and the
+ *     end before the scanners see them.
+ * @li Scanners are asked in turn, and as soon as one is certain (p = 1.0)
+ *     the rest are not asked (or even loaded), and get p = 0.0.
+ * @li Results are memoized by the source's hash, so guessing the same source
+ *     again is nearly free.
+ *
+ * Optionally, the scanners aren't asked at all and the NgramClassifier scores
+ * every language at once.
+ *
+ * Use luminous::guessLanguageFull() to guess a language.
+ */
+class LanguageGuesser
+{
+    /**
+     * How many bytes from the start and the end of the source the scanners
+     * look at. Sources larger than both together are sampled.
+     */
+    const SAMPLE_HEAD = 32768;
+    const SAMPLE_TAIL = 8192;
+
+    /**
+     * How many results to memoize
+     */
+    const MEMO_SIZE = 32;
+
+    /**
+     * Interpreters whose names aren't a language code, as interpreter =>
+     * language code
+     */
+    private static $interpreters = array(
+        'node' => 'js',
+        'nodejs' => 'js',
+        'rhino' => 'js',
+        'zsh' => 'bash',
+        'ksh' => 'bash',
+        'dash' => 'bash',
+        'runhaskell' => 'haskell',
+        'runghc' => 'haskell',
+        'escript' => 'erlang',
+    );
+
+    /**
+     * The scanner table
+     */
+    private $scanners;
+
+    /**
+     * The scanner table's languages when the results in the memo were
+     * guessed
+     */
+    private $languages = null;
+
+    /**
+     * Memo of key => result, oldest first
+     */
+    private $memo = array();
+
+    /**
+     * @param $scanners the Scanners table
+     */
+    public function __construct(Scanners $scanners)
+    {
+        $this->scanners = $scanners;
+    }
+
+    /**
+     * @brief Guesses the language of a source string
+     *
+     * @param $src the source string
+     * @param $filename the source's file name, if it is known. Only its
+     *    extension is used.
+     * @param $classify whether to use the NgramClassifier rather than the
+     *    scanners
+     * @return the guesses, as luminous::guessLanguageFull()
+     */
+    public function guess($src, $filename = null, $classify = false)
+    {
+        $languages = $this->scanners->listScanners();
+        ksort($languages);
+        if ($languages !== $this->languages) {
+            // a scanner was added or removed since the memo was filled
+            $this->languages = $languages;
+            $this->memo = array();
+        }
+        $extension = ($filename === null) ? '' : strtolower(pathinfo($filename, PATHINFO_EXTENSION));
+        $key = md5($src) . ':' . $extension . ($classify ? ':classify' : '');
+        if (isset($this->memo[$key])) {
+            return $this->memo[$key];
+        }
+
+        $code = $this->hintedCode($src, $extension);
+        $result = null;
+        if ($code !== null) {
+            $result = $this->certain($code);
+        } elseif ($classify) {
+            $result = $this->classify($this->sample($src));
+        }
+        if ($result === null) {
+            $result = $this->score($this->sample($src));
+        }
+        if (count($this->memo) >= self::MEMO_SIZE) {
+            array_shift($this->memo);
+        }
+        $this->memo[$key] = $result;
+        return $result;
+    }
+
+    /**
+     * @brief Gets the language code given by a file extension or shebang
+     *
+     * @return the language code, or @c null if neither names a registered
+     *    language
+     * @internal
+     */
+    private function hintedCode($src, $extension)
+    {
+        if ($extension !== '' && $this->scanners->getScanner($extension, false, false) !== null) {
+            return $extension;
+        }
+        if (!preg_match('/^#![ \t]*+(\S++)(?:[ \t]++(\S++))?/', $src, $m)) {
+            return null;
+        }
+        $interpreter = basename($m[1]);
+        if ($interpreter === 'env' && isset($m[2])) {
+            $interpreter = basename($m[2]);
+        }
+        // python3, python2.7, etc.
+        $interpreter = strtolower(preg_replace('/[\d.]+$/', '', $interpreter));
+        if (isset(self::$interpreters[$interpreter])) {
+            $interpreter = self::$interpreters[$interpreter];
+        }
+        if ($interpreter !== '' && $this->scanners->getScanner($interpreter, false, false) !== null) {
+            return $interpreter;
+        }
+        return null;
+    }
+
+    /**
+     * @brief Gets the result where a language is known for certain
+     * @internal
+     */
+    private function certain($code)
+    {
+        $first = null;
+        $rest = array();
+        foreach ($this->languages as $lang => $codes) {
+            $guess = array('language' => $lang, 'codes' => $codes, 'p' => 0.0);
+            if ($first === null && in_array($code, $codes, true)) {
+                $guess['p'] = 1.0;
+                $first = $guess;
+            } else {
+                $rest[] = $guess;
+            }
+        }
+        array_unshift($rest, $first);
+        return $rest;
+    }
+
+    /**
+     * @brief Gets the NgramClassifier's probabilities
+     *
+     * Languages the classifier doesn't know get p = 0.0.
+     *
+     * @return the result, or @c null if the classifier can't tell
+     * @internal
+     */
+    private function classify($src)
+    {
+        $probabilities = NgramClassifier::classify($src);
+        if (empty($probabilities)) {
+            return null;
+        }
+        $return = array();
+        foreach ($this->languages as $lang => $codes) {
+            $p = 0.0;
+            foreach ($codes as $code) {
+                if (isset($probabilities[$code])) {
+                    $p = $probabilities[$code];
+                    break;
+                }
+            }
+            $return[] = array('language' => $lang, 'codes' => $codes, 'p' => $p);
+        }
+        usort($return, function ($a, $b) {
+            if ($a['p'] === $b['p']) {
+                return 0;
+            }
+            return ($a['p'] > $b['p']) ? -1 : 1;
+        });
+        return $return;
+    }
+
+    /**
+     * @brief Cuts a large source down to whole lines from its start and end
+     * @internal
+     */
+    private function sample($src)
+    {
+        $length = strlen($src);
+        if ($length <= self::SAMPLE_HEAD + self::SAMPLE_TAIL) {
+            return $src;
+        }
+        $head = substr($src, 0, self::SAMPLE_HEAD);
+        $end = strrpos($head, "\n");
+        if ($end !== false) {
+            $head = substr($head, 0, $end + 1);
+        }
+        $tail = substr($src, $length - self::SAMPLE_TAIL);
+        $start = strpos($tail, "\n");
+        if ($start !== false) {
+            $tail = substr($tail, $start + 1);
+        }
+        return $head . $tail;
+    }
+
+    /**
+     * @brief Asks the scanners for their probabilities
+     * @internal
+     */
+    private function score($src)
+    {
+        // first we're going to make an 'info' array for the source, which
+        // precomputes some frequently useful things, like how many lines it
+        // has, etc. It prevents scanners from redundantly figuring these things
+        // out themselves
+        $lines = preg_split("/\r\n|[\r\n]/", $src);
+        $shebang = '';
+        if (preg_match('/^#!.*/', $src, $m)) {
+            $shebang = $m[0];
+        }
+
+        $info = array(
+            'lines' => $lines,
+            'num_lines' => count($lines),
+            'trimmed' => trim($src),
+            'shebang' => $shebang
+        );
+
+        $return = array();
+        $certain = false;
+        foreach ($this->languages as $lang => $codes) {
+            $p = 0.0;
+            if (!$certain) {
+                $scannerName = $this->scanners->getScanner($codes[0], false, false);
+                assert($scannerName !== null);
+                $p = call_user_func(array($scannerName, 'guessLanguage'), $src, $info);
+                $certain = $p >= 1.0;
+            }
+            $return[] = array('language' => $lang, 'codes' => $codes, 'p' => $p);
+        }
+        uasort($return, function ($a, $b) {
+            $c = $a['p'] - $b['p'];
+            if ($c === 0) {
+                return 0;
+            }
+            if ($c < 0) {
+                return -1;
+            }
+            return 1;
+        });
+        return array_reverse($return);
+    }
+}
+
+/** @endcond */
@@ -2,17 +2,16 @@
 
 namespace Luminous;
 
+use Exception;
+use InvalidArgumentException;
 use Luminous as LuminousUi;
 use Luminous\Core\Scanner;
+use Luminous\Core\Utils;
 use Luminous\Caches\SqlCache;
 use Luminous\Caches\FileSystemCache;
+use Luminous\Caches\MemoryCache;
+use Luminous\Caches\ApcuCache;
 use Luminous\Formatters\Formatter;
-use Luminous\Formatters\HtmlFormatter;
-use Luminous\Formatters\InlineHtmlFormatter;
-use Luminous\Formatters\FullPageHtmlFormatter;
-use Luminous\Formatters\LatexFormatter;
-use Luminous\Formatters\AnsiFormatter;
-use Luminous\Formatters\IdentityFormatter;
 
 /**
  * @cond ALL
@@ -49,6 +48,23 @@ class Luminous
      */
     public $language = null;
 
+    /**
+     * The built-in formatters, as format setting => class name
+     */
+    private static $formatters = array(
+        'html' => 'Luminous\\Formatters\\HtmlFormatter',
+        'html-inline' => 'Luminous\\Formatters\\InlineHtmlFormatter',
+        'html-full' => 'Luminous\\Formatters\\FullPageHtmlFormatter',
+        'latex' => 'Luminous\\Formatters\\LatexFormatter',
+        'ansi' => 'Luminous\\Formatters\\AnsiFormatter',
+        'none' => 'Luminous\\Formatters\\IdentityFormatter',
+    );
+
+    /**
+     * The language guesser, created when it is first needed
+     */
+    private $guesser = null;
+
     public function __construct()
     {
         $this->scanners = new Scanners();
@@ -114,43 +130,56 @@ class Luminous
         $this->scanners->SetDefaultScanner('plain');
     }
 
+    /**
+     * Guesses the language of a source string
+     * @see LanguageGuesser::guess()
+     */
+    public function guessLanguage($src, $filename = null)
+    {
+        if ($this->guesser === null) {
+            $this->guesser = new LanguageGuesser($this->scanners);
+        }
+        return $this->guesser->guess($src, $filename, $this->settings->guessClassifier);
+    }
+
     /**
      * Returns an instance of the current formatter
      */
     public function getFormatter()
     {
         $fmt = $this->settings->format;
-        $formatter = null;
-        if (!is_string($fmt) && is_subclass_of($fmt, 'Luminous\\Formatters\\Formatter')) {
-            $formatter = clone $fmt;
-        } elseif ($fmt === 'html') {
-            $formatter = new HtmlFormatter();
-        } elseif ($fmt ===  'html-inline') {
-            $formatter = new InlineHtmlFormatter();
-        } elseif ($fmt ===  'html-full') {
-            $formatter = new FullPageHtmlFormatter();
-        } elseif ($fmt === 'latex') {
-            $formatter = new LatexFormatter();
-        } elseif ($fmt === 'ansi') {
-            $formatter = new AnsiFormatter();
-        } elseif ($fmt ===  null || $fmt === 'none') {
-            $formatter = new IdentityFormatter();
-        }
-
-        if ($formatter === null) {
+        $class = $this->formatterClass();
+        if ($class === null) {
             throw new Exception('Unknown formatter: ' . $this->settings->format);
-            return null;
         }
+        $formatter = (is_string($fmt) || $fmt === null) ? new $class() : clone $fmt;
         $this->setFormatterOptions($formatter);
         return $formatter;
     }
 
+    /**
+     * Returns the class name of the current formatter, or null if the format
+     * setting is unknown
+     */
+    private function formatterClass()
+    {
+        $fmt = $this->settings->format;
+        if (!is_string($fmt) && is_subclass_of($fmt, 'Luminous\\Formatters\\Formatter')) {
+            return get_class($fmt);
+        }
+        if ($fmt === null) {
+            $fmt = 'none';
+        }
+        return isset(self::$formatters[$fmt]) ? self::$formatters[$fmt] : null;
+    }
+
     /**
      * Sets up a formatter instance according to our current options/settings
      */
     private function setFormatterOptions(&$formatter)
     {
         $formatter->wrapLength = $this->settings->wrapWidth;
+        $formatter->flushLines = $this->settings->flushLines;
         $formatter->lineNumbers = $this->settings->lineNumbers;
         $formatter->startLine = $this->settings->startLine;
         $formatter->link = $this->settings->autoLink;
@@ -165,31 +194,496 @@ class Luminous
     /**
      * calculates a 'cache_id' for the input. This is dependent upon the
      * source code and the settings. This should be (near-as-feasible) unique
-     * for any cobmination of source, language and settings
+     * for any cobmination of source, language and settings. The scanner is
+     * given as a fingerprint, see scannerFingerprint(), and the settings'
+     * fingerprint may be given if it is already known.
      */
-    private function cacheId($scanner, $source)
+    private function cacheIdFor($scannerFingerprint, $source, $settingsFingerprint = null)
     {
         // to figure out the cache id, we mash a load of stuff together and
         // md5 it. This gives us a unique (assuming no collisions) handle to
         // a cache file, which depends on the input source, the relevant formatter
-        // settings, the version, and scanner.
+        // settings, the version, and scanner. Only the source is hashed in
+        // full; the rest is short.
+        if ($settingsFingerprint === null) {
+            $settingsFingerprint = $this->settingsFingerprint();
+        }
+        return md5(md5($source) . $scannerFingerprint . $settingsFingerprint);
+    }
+
+    /**
+     * calculates the ID of a source's scanner output (its serialized filtered
+     * token stream) in the cache. This depends only on the source, the
+     * scanner and the version, not on the settings.
+     */
+    private function tokenCacheIdFor($scannerFingerprint, $source)
+    {
+        // the kind of entry is hashed in rather than prefixed, as the file
+        // system cache shards entries by the first characters of the ID
+        return md5('tokens' . md5($source) . $scannerFingerprint . LUMINOUS_VERSION);
+    }
+
+    /**
+     * Gets a fingerprint of a scanner: the scanner class's fingerprint for a
+     * language code, or a hash of an instance's serialization, since an
+     * instance may have been configured
+     */
+    private function scannerFingerprint($code, $scanner)
+    {
+        return ($code !== null) ? $this->scanners->scannerFingerprint($code) : md5(serialize($scanner));
+    }
+
+    /**
+     * Gets a fingerprint of the settings which affect the output. Of the
+     * formatter's options, only those it declares in cacheOptions() are
+     * included, so e.g. HTML isn't cached once per theme.
+     */
+    private function settingsFingerprint()
+    {
         $settings = array(
-            $this->settings->wrapWidth,
-            $this->settings->lineNumbers,
-            $this->settings->startLine,
-            $this->settings->autoLink,
-            $this->settings->maxHeight,
             $this->settings->format,
-            $this->settings->theme,
-            $this->settings->htmlStrict,
-            $this->settings->colorDistanceAlgorithm,
+            $this->settings->lines,
             LUMINOUS_VERSION,
         );
+        $class = $this->formatterClass();
+        $options = ($class !== null) ? call_user_func(array($class, 'cacheOptions')) : array();
+        foreach ($options as $option) {
+            $settings[$option] = $this->settings->$option;
+        }
+        return md5(serialize($settings));
+    }
+
+    /**
+     * @brief Creates the cache object for the current settings
+     *
+     * The in-process and APCu tiers, if they are enabled, are layered in
+     * front of the file system or SQL cache.
+     * @internal
+     */
+    private function createCache($id)
+    {
+        if ($this->settings->sqlFunction !== null) {
+            $cache = new SqlCache($id);
+            $cache->setSqlFunction($this->settings->sqlFunction);
+        } else {
+            $cache = new FileSystemCache($id);
+        }
+        $cache->setPurgeTime($this->settings->cacheAge);
+        if ($this->settings->memoryCacheSize > 0) {
+            $cache->addTier(new MemoryCache($id, $this->settings->memoryCacheSize));
+        }
+        if ($this->settings->apcuCache && ApcuCache::available()) {
+            $tier = new ApcuCache($id);
+            $tier->setPurgeTime($this->settings->cacheAge);
+            $cache->addTier($tier);
+        }
+        return $cache;
+    }
+
+    /**
+     * @brief Gets the byte offset where a line starts
+     *
+     * @param $source the source string
+     * @param $line the zero-based line index
+     * @return the offset, or the length of the source if it has fewer lines
+     * @internal
+     */
+    private static function lineOffset($source, $line)
+    {
+        $pos = 0;
+        for ($i = 0; $i < $line; $i++) {
+            $pos = strpos($source, "\n", $pos);
+            if ($pos === false) {
+                return strlen($source);
+            }
+            $pos++;
+        }
+        return $pos;
+    }
+
+    /**
+     * @brief Gets the cached checkpoint index for a source
+     *
+     * The index is built up as ranges of the source are highlighted, so no
+     * request has to scan further than the end of its own range.
+     *
+     * @param $cache set to the cache holding the index
+     * @return array('lines' => the number of lines the index covers,
+     *    'checkpoints' => the checkpoints in source order), or @c NULL if
+     *    checkpoints can't be used
+     * @internal
+     */
+    private function checkpointIndex($code, $source, &$cache)
+    {
+        if ($code === null || !$this->settings->cache) {
+            return null;
+        }
+        $id = md5(
+            'checkpoints' . md5($source)
+            . serialize(array($this->scanners->scannerFingerprint($code), $this->settings->checkpointInterval))
+        );
+        $cache = $this->createCache($id);
+        $data = $cache->read();
+        $index = ($data !== null) ? @unserialize($data) : false;
+        if (!is_array($index) || !isset($index['lines'], $index['checkpoints'])) {
+            $index = array('lines' => 0, 'checkpoints' => array());
+        }
+        return $index;
+    }
+
+    /**
+     * @brief Highlights the range of lines given by the 'lines' setting
+     *
+     * Scanning starts from the last checkpoint before the range, if there is a
+     * checkpoint index for the source, and otherwise from the top. Either way
+     * it stops at the end of the range, unless the scanner records definitions
+     * (see Scanner::recordsUserDefs()), which may come after the range and
+     * still change how it is highlighted. If the range ends past the end of the
+     * index, checkpoints are taken on the way and added to it. Only the
+     * requested lines are formatted, numbered from the first line of the
+     * range.
+     *
+     * @param $scanner the scanner instance
+     * @param $code the scanner's language code, or @c NULL if the scanner
+     *    was given as an instance, in which case checkpoints aren't used
+     * @param $source the whole source string
+     * @param $formatter the formatter instance
+     * @internal
+     */
+    private function highlightLines($scanner, $code, $source, $formatter)
+    {
+        list($first, $last) = $this->settings->lines;
+        $cache = null;
+        $index = $this->checkpointIndex($code, $source, $cache);
+        $checkpoint = null;
+        if ($index !== null) {
+            foreach ($index['checkpoints'] as $cp) {
+                if ($cp['line'] >= $first) {
+                    break;
+                }
+                $checkpoint = $cp;
+            }
+        }
+        // the source up to and including the newline ending the last line, or
+        // all of it if a definition after the range could change the range
+        $end = $scanner->recordsUserDefs() ? strlen($source) : self::lineOffset($source, $last);
+        $scanner->prepare(substr($source, 0, $end));
+        $extend = ($index !== null && $last > $index['lines']);
+        if ($extend) {
+            $scanner->enableCheckpoints($this->settings->checkpointInterval);
+        }
+        $line = 0;
+        if ($checkpoint !== null) {
+            $scanner->restoreCheckpoint($checkpoint);
+            $line = $checkpoint['line'];
+        }
+        $scanner->main();
+        if ($extend) {
+            $this->extendCheckpointIndex($cache, $index, $scanner->checkpoints(), $last, $end === strlen($source));
+        }
+        // the tagged string closes and reopens its tags at every newline, so
+        // each line of it stands alone
+        $lines = array_slice(explode("\n", $scanner->tagged()), $first - 1 - $line, $last - $first + 1);
+        $formatter->startLine = $this->settings->startLine + $first - 1;
+        return $formatter->format(implode("\n", $lines));
+    }
+
+    /**
+     * @brief Adds the checkpoints from a scan to the checkpoint index
+     *
+     * Unless the scan reached the end of the source, a checkpoint is only
+     * kept if there are a good number of lines after it in the scan, so it
+     * can't have been affected by the scan stopping early (as
+     * StreamHighlighter does).
+     *
+     * @param $cache the cache holding the index
+     * @param $index the index
+     * @param $checkpoints the checkpoints taken by the scan
+     * @param $lines the number of lines scanned
+     * @param $complete whether the scan reached the end of the source
+     * @internal
+     */
+    private function extendCheckpointIndex($cache, $index, $checkpoints, $lines, $complete)
+    {
+        $known = empty($index['checkpoints']) ? 0 : $index['checkpoints'][count($index['checkpoints']) - 1]['line'];
+        foreach ($checkpoints as $cp) {
+            if (!$complete && $cp['line'] + $this->settings->checkpointInterval > $lines) {
+                break;
+            }
+            if ($cp['line'] > $known) {
+                $index['checkpoints'][] = $cp;
+            }
+        }
+        $index['lines'] = $complete ? PHP_INT_MAX : $lines;
+        // the index was probably read from this entry, so write() would keep
+        // the old one
+        $cache->overwrite(serialize($index));
+    }
+
+    /**
+     * Sets up an IncrementalHighlighter for the given language code and source
+     * @throw InvalidArgumentException if $scanner is not a string, or if
+     *    $source is not a string.
+     */
+    public function highlightIncremental($scanner, $source, $settings = null)
+    {
+        if (!is_string($source)) {
+            throw new InvalidArgumentException('Non-string supplied for $source');
+        }
+        $formatter = $this->languageFormatter($scanner, $settings);
+        return new IncrementalHighlighter($this->scanners, $scanner, $source, $formatter);
+    }
+
+    /**
+     * Highlights a stream, passing the output to a sink as it is produced
+     * @param $input a readable stream resource, or the name of a file
+     * @param $sink where to write the output, see Luminous\Utils\OutputSink
+     * @throw InvalidArgumentException if $scanner is not a string, or if
+     *    $input is not a stream or a readable file.
+     */
+    public function highlightStream($scanner, $input, $sink = null, $settings = null)
+    {
+        $formatter = $this->languageFormatter($scanner, $settings);
+        $close = false;
+        if (is_string($input)) {
+            $file = $input;
+            if (!is_readable($file) || ($input = fopen($file, 'rb')) === false) {
+                throw new InvalidArgumentException("Cannot read '$file'");
+            }
+            $close = true;
+        } elseif (!is_resource($input)) {
+            throw new InvalidArgumentException('Non-stream supplied for $input');
+        }
+        $highlighter = new StreamHighlighter($this->scanners, $scanner, $formatter);
+        try {
+            $highlighter->highlight($input, $sink);
+        } catch (Exception $e) {
+            if ($close) {
+                fclose($input);
+            }
+            throw $e;
+        }
+        if ($close) {
+            fclose($input);
+        }
+    }
+
+    /**
+     * Highlights a string, writing the output to a sink
+     * @param $sink where to write the output, see Luminous\Utils\OutputSink
+     * @throw InvalidArgumentException if $scanner is not a string, or if
+     *    $source is not a string.
+     */
+    public function highlightTo($scanner, $source, $sink = null, $settings = null)
+    {
+        if (!is_string($source)) {
+            throw new InvalidArgumentException('Non-string supplied for $source');
+        }
+        $formatter = $this->languageFormatter($scanner, $settings);
+        $instance = $this->scanners->acquireScanner($scanner);
+        $tagged = $instance->highlight($source);
+        $this->scanners->releaseScanner($instance);
+        $formatter->formatTo($tagged, $sink);
+    }
+
+    /**
+     * Gets a formatter for the given language code, with the given settings
+     * applied on top of the current ones
+     * @throw InvalidArgumentException if $scanner is not a string
+     * @internal
+     */
+    private function languageFormatter($scanner, $settings)
+    {
+        if (!is_string($scanner)) {
+            throw new InvalidArgumentException('Non-string supplied for $scanner');
+        }
+        $oldSettings = null;
+        if ($settings !== null) {
+            $oldSettings = clone $this->settings;
+            foreach ($settings as $k => $v) {
+                $this->settings->set($k, $v);
+            }
+        }
+        if ($this->scanners->getScanner($scanner) === null) {
+            throw new Exception("No known scanner for '$scanner' and no default set");
+        }
+        $this->language = $this->scanners->getDescription($scanner);
+        $formatter = $this->getFormatter();
+        $this->language = null;
+        if ($oldSettings !== null) {
+            $this->settings = $oldSettings;
+        }
+        return $formatter;
+    }
+
+    /**
+     * Highlights several sources at once. Each language's scanner and
+     * formatter are only set up once, identical jobs are only highlighted
+     * once, and the cache is read and written in one batch.
+     * @param $jobs an array of array($scanner, $source), where $scanner is a
+     *    language code
+     * @param $settings settings which apply to every job, as highlight()
+     * @return an array of the highlighted output of each job, with the same
+     *    keys as $jobs
+     * @throw InvalidArgumentException if a job is not an array of two strings
+     */
+    public function highlightMany($jobs, $settings = null)
+    {
+        $oldSettings = null;
+        if ($settings !== null) {
+            if (!is_array($settings)) {
+                throw new Exception('Luminous internal error: Settings is not an array');
+            }
+            $oldSettings = clone $this->settings;
+            foreach ($settings as $k => $v) {
+                $this->settings->set($k, $v);
+            }
+        }
+        try {
+            $results = $this->highlightBatch($jobs);
+        } catch (Exception $e) {
+            if ($oldSettings !== null) {
+                $this->settings = $oldSettings;
+            }
+            throw $e;
+        }
+        if ($oldSettings !== null) {
+            $this->settings = $oldSettings;
+        }
+        return $results;
+    }
+
+    /**
+     * highlightMany() with its settings applied
+     * @internal
+     */
+    private function highlightBatch($jobs)
+    {
+        $this->cache = null;
+        // cache ID => (code, source), of the distinct jobs
+        $unique = array();
+        // job key => cache ID
+        $ids = array();
+        $fingerprints = array();
+        $settingsFingerprint = $this->settingsFingerprint();
+        foreach ($jobs as $key => $job) {
+            if (!is_array($job) || count($job) !== 2) {
+                throw new InvalidArgumentException('Each job must be an array of ($scanner, $source)');
+            }
+            list($code, $source) = array_values($job);
+            if (!is_string($code)) {
+                throw new InvalidArgumentException('Non-string supplied for $scanner');
+            }
+            if (!is_string($source)) {
+                throw new InvalidArgumentException('Non-string supplied for $source');
+            }
+            if (!isset($fingerprints[$code])) {
+                $fingerprints[$code] = $this->scanners->scannerFingerprint($code);
+                if ($fingerprints[$code] === null) {
+                    throw new Exception("No known scanner for '$code' and no default set");
+                }
+            }
+            $id = $this->cacheIdFor($fingerprints[$code], $source, $settingsFingerprint);
+            $ids[$key] = $id;
+            if (!isset($unique[$id])) {
+                $unique[$id] = array($code, $source);
+            }
+        }
+
+        $out = array();
+        if ($this->settings->cache && !empty($unique)) {
+            $this->cache = $this->createCache('');
+            $out = $this->cache->readMany(array_keys($unique));
+        }
+        $formatters = array();
+        $misses = array();
+        foreach ($unique as $id => $job) {
+            if (isset($out[$id])) {
+                continue;
+            }
+            list($code, $source) = $job;
+            if (!isset($formatters[$code])) {
+                $this->language = $this->scanners->getDescription($code);
+                $formatters[$code] = $this->getFormatter();
+                $this->language = null;
+            }
+            $scanner = $this->scanners->acquireScanner($code);
+            $out[$id] = $misses[$id] = $this->render(
+                $scanner,
+                $code,
+                $source,
+                $formatters[$code],
+                $fingerprints[$code]
+            );
+            $this->scanners->releaseScanner($scanner);
+        }
+        if ($this->cache !== null && !empty($misses)) {
+            $this->cache->writeMany($misses);
+        }
 
-        $id = md5($source);
-        $id = md5($id . serialize($scanner));
-        $id = md5($id . serialize($settings));
-        return $id;
+        $results = array();
+        foreach ($ids as $key => $id) {
+            $results[$key] = $out[$id];
+        }
+        return $results;
+    }
+
+    /**
+     * Scans and formats a source according to the current settings
+     *
+     * If the token cache is enabled, the scanner's output (the tagged string)
+     * is read from the cache, or written to it after scanning.
+     *
+     * @param $scanner the scanner instance
+     * @param $code the scanner's language code, or @c NULL if the scanner was
+     *    given as an instance
+     * @param $source the source string
+     * @param $formatter the formatter instance
+     * @param $fingerprint the scanner's fingerprint, if it is already known
+     * @internal
+     */
+    private function render($scanner, $code, $source, $formatter, $fingerprint = null)
+    {
+        if ($this->settings->lines !== null) {
+            return $this->highlightLines($scanner, $code, $source, $formatter);
+        }
+        $tokenCache = null;
+        if ($this->settings->cache && $this->settings->tokenCache) {
+            if ($fingerprint === null) {
+                $fingerprint = $this->scannerFingerprint($code, $scanner);
+            }
+            $tokenCache = $this->createCache($this->tokenCacheIdFor($fingerprint, $source));
+            $data = $tokenCache->read();
+            $tokens = ($data !== null) ? @unserialize($data) : false;
+            if (is_array($tokens)) {
+                return self::formatFiltered($formatter, $tokens);
+            }
+        }
+        if ($this->settings->processes > 1 && $code !== null) {
+            // the segments come back as one XML string, which is a single
+            // pre-escaped token
+            $parallel = new ParallelHighlighter($this->scanners, $code, $this->settings->processes);
+            $tokens = array(array(null, $parallel->highlight($source), true));
+        } else {
+            $tokens = $scanner->highlightTokens($source);
+        }
+        if ($tokenCache !== null) {
+            $tokenCache->write(serialize($tokens));
+        }
+        return self::formatFiltered($formatter, $tokens);
+    }
+
+    /**
+     * Formats a filtered token stream, straight from the tokens if the
+     * formatter can, so a token cache hit is formatted exactly as a miss is
+     */
+    private static function formatFiltered($formatter, $tokens)
+    {
+        if ($formatter->consumesTokens()) {
+            // skip building and re-parsing the XML string
+            return $formatter->formatTokens($tokens);
+        }
+        return $formatter->format(Utils::tagTokens($tokens));
     }
 
     /**
@@ -211,6 +705,7 @@ class Luminous
         }
         $shouldResetLanguage = false;
         $this->cache = null;
+        $code = null;
         if (!is_string($source)) {
             throw new InvalidArgumentException('Non-string supplied for $source');
         }
@@ -220,7 +715,7 @@ class Luminous
                 throw new InvalidArgumentException('Non-string or LuminousScanner instance supplied for $scanner');
             }
             $code = $scanner;
-            $scanner = $this->scanners->GetScanner($code);
+            $scanner = $this->scanners->acquireScanner($code);
             if ($scanner === null) {
                 throw new Exception("No known scanner for '$code' and no default set");
             }
@@ -229,22 +724,18 @@ class Luminous
         }
         $cacheHit = true;
         $out = null;
+        $fingerprint = null;
         if ($this->settings->cache) {
-            $cacheId = $this->cacheId($scanner, $source);
-            if ($this->settings->sqlFunction !== null) {
-                $this->cache = new SqlCache($cacheId);
-                $this->cache->setSqlFunction($this->settings->sqlFunction);
-            } else {
-                $this->cache = new FileSystemCache($cacheId);
-            }
-            $this->cache->setPurgeTime($this->settings->cacheAge);
+            $fingerprint = $this->scannerFingerprint($code, $scanner);
+            $this->cache = $this->createCache($this->cacheIdFor($fingerprint, $source));
             $out = $this->cache->read();
         }
         if ($out === null) {
             $cacheHit = false;
-            $outRaw = $scanner->highlight($source);
-            $formatter = $this->getFormatter();
-            $out = $formatter->format($outRaw);
+            $out = $this->render($scanner, $code, $source, $this->getFormatter(), $fingerprint);
+        }
+        if ($code !== null) {
+            $this->scanners->releaseScanner($scanner);
         }
 
         if ($this->settings->cache && !$cacheHit) {
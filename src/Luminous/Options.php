@@ -43,6 +43,37 @@ class Options
      */
     private $cacheAge = 7776000; // 90 days
 
+    /**
+     * @brief Whether to cache scanner output as well as formatted output
+     *
+     * If the cache is enabled, the scanner's output for a source is cached
+     * too, independently of the format and display options. Highlighting the
+     * same source with different options then only needs to run the
+     * formatter. The scanner output is stored as its filtered token stream,
+     * which takes rather more room than the formatted output, so this more
+     * than doubles the size of the cache.
+     */
+    private $tokenCache = true;
+
+    /**
+     * @brief Size of the in-process cache, in bytes
+     *
+     * If the cache is enabled, recently used entries are also kept in memory
+     * for the life of the process, up to this many bytes, so popular sources
+     * are served without touching the disk or database. 0 disables this.
+     */
+    private $memoryCacheSize = 4194304; // 4 MiB
+
+    /**
+     * @brief Whether to keep cache entries in APCu shared memory
+     *
+     * If the cache is enabled and the APCu extension is available, entries
+     * are also kept in shared memory, where every process on the server can
+     * read them, between the in-process cache and the file system or
+     * database.
+     */
+    private $apcuCache = false;
+
     /**
      * @brief Word wrapping
      *
@@ -51,6 +82,19 @@ class Options
      */
     private $wrapWidth = -1;
 
+    /**
+     * @brief Flush interval for output sinks
+     *
+     * When output is written to a sink (see luminous::highlightTo() and
+     * luminous::highlightStream()), it is passed on and flushed every this
+     * many lines (0 or -1 to pass output on as soon as it is produced).
+     *
+     * Formatters which can't work a piece at a time only produce output at
+     * the end, and so does the HTML formatter when lines are numbered, as
+     * the line numbers come before the code.
+     */
+    private $flushLines = 100;
+
     /**
      * @brief Line numbering
      *
@@ -75,6 +119,59 @@ class Options
      */
     private $highlightLines = array();
 
+    /**
+     * @brief Line range
+     *
+     * Highlights only a range of lines from the source, given as an array of
+     * (first, last) line numbers. Lines are counted from 1 and the range is
+     * inclusive. Line numbering in the output starts from the first line of
+     * the range (offset by startLine). @c NULL highlights the whole source.
+     *
+     * Only the range is formatted, but the scanner's state at the start of
+     * the range depends on everything before it. Without the cache, every
+     * range is scanned from the top of the source to the end of the range,
+     * so ranges near the end of a large source cost nearly as much to scan as
+     * the whole thing. With the cache, see checkpointInterval. Scanners which
+     * record definitions (e.g. PHP and Go functions) scan on to the end of the
+     * source, as a definition after the range changes how calls in the range
+     * are highlighted.
+     */
+    private $lines = null;
+
+    /**
+     * @brief Number of processes to highlight with
+     *
+     * If this is more than 1, large sources are split into segments which are
+     * scanned in parallel by forked processes. This needs the pcntl extension
+     * and only works from the command line; otherwise it is ignored. The
+     * output is the same either way.
+     */
+    private $processes = 1;
+
+    /**
+     * @brief Statistical language guessing
+     *
+     * If this is true, luminous::guessLanguage() and
+     * luminous::guessLanguageFull() score every language at once with a
+     * classifier trained on sample sources, instead of asking each scanner
+     * in turn. File extensions and shebangs are still observed first.
+     */
+    private $guessClassifier = false;
+
+    /**
+     * @brief Checkpoint interval for line ranges
+     *
+     * When a line range is highlighted with the cache enabled, the scanner's
+     * state is saved every this many lines, and stored in the cache. Later
+     * ranges of the same source then start scanning from the nearest
+     * checkpoint instead of the top of the file. The checkpoints are added as
+     * ranges are scanned, so the first range which reaches deep into a
+     * source still scans from the top (but no further than the end of the
+     * range), and later ones scan at most about this many lines before the
+     * range.
+     */
+    private $checkpointInterval = 500;
+
     /**
      * @brief Hyperlinking
      *
@@ -262,12 +359,16 @@ class Options
     {
         if ($name === 'autoLink') {
             $this->setBool($name, $value);
-        } elseif ($name === 'cache') {
+        } elseif ($name === 'cache' || $name === 'tokenCache' || $name === 'apcuCache') {
             $this->setBool($name, $value);
         } elseif ($name === 'cacheAge') {
             if (self::checkType($value, 'int')) {
                 $this->$name = $value;
             }
+        } elseif ($name === 'memoryCacheSize') {
+            if (self::checkType($value, 'int')) {
+                $this->$name = max(0, $value);
+            }
         } elseif ($name === 'failureTag') {
             if (self::checkType($value, 'string', true)) {
                 $this->$name = $value;
@@ -280,7 +381,7 @@ class Options
             }
         } elseif ($name === 'includeJavascript' || $name === 'includeJquery') {
             $this->setBool($name, $value);
-        } elseif ($name === 'lineNumbers') {
+        } elseif ($name === 'lineNumbers' || $name === 'guessClassifier') {
             $this->setBool($name, $value);
         } elseif ($name === 'startLine') {
             $this->setStartLine($value);
@@ -288,6 +389,15 @@ class Options
             if (self::checkType($value, 'array')) {
                 $this->highlightLines = $value;
             }
+        } elseif ($name === 'lines') {
+            $this->setLines($value);
+        } elseif ($name === 'checkpointInterval' || $name === 'processes') {
+            if (self::checkType($value, 'int')) {
+                if ($value < 1) {
+                    throw new InvalidArgumentException("Option $name must be a positive number");
+                }
+                $this->$name = $value;
+            }
         } elseif ($name === 'maxHeight') {
             $this->setHeight($value);
         } elseif ($name === 'colorDistanceAlgorithm') {
@@ -298,7 +408,7 @@ class Options
             }
         } elseif ($name === 'theme') {
             $this->setTheme($value);
-        } elseif ($name === 'wrapWidth') {
+        } elseif ($name === 'wrapWidth' || $name === 'flushLines') {
             if (self::checkType($value, 'int')) {
                 $this->$name = $value;
             }
@@ -336,6 +446,21 @@ class Options
         }
     }
 
+    private function setLines($value)
+    {
+        if (self::checkType($value, 'array', true)) {
+            if ($value !== null) {
+                $value = array_values($value);
+                if (count($value) !== 2 || !is_int($value[0]) || !is_int($value[1])
+                    || $value[0] < 1 || $value[1] < $value[0]
+                ) {
+                    throw new InvalidArgumentException('Line range must be an array of (first, last) line numbers');
+                }
+            }
+            $this->lines = $value;
+        }
+    }
+
     private function setFormat($value)
     {
         // formatter can either be an instance or an identifier (string)
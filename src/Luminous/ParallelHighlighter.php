@@ -0,0 +1,287 @@
+<?php
+
+/** @cond ALL */
+
+namespace Luminous;
+
+/**
+ * @brief Scans a large source in several processes at once
+ *
+ * The source is split into segments of whole lines, and each segment is
+ * scanned in its own forked process, starting from the scanner's initial
+ * state. The segments' tagged strings are then joined back together in
+ * order.
+ *
+ * A segment's output is only correct if the scanner really is in its initial
+ * state at the start of the segment. To check this, each process scans a few
+ * lines past the end of its segment with a checkpoint due at the end, and
+ * reports the state there. A seam is good if that checkpoint was taken
+ * exactly at the seam (so no token crosses it) and its state is the initial
+ * state. Where a seam is bad, the next segment is scanned again here from the
+ * reported state, and if there is no state to resume from, the rest of the
+ * source is scanned sequentially.
+ *
+ * Forking needs the pcntl extension and the CLI SAPI. Without them, or for
+ * scanners which can't take checkpoints, the source is scanned sequentially.
+ * So is the source for scanners which record definitions (see
+ * Scanner::recordsUserDefs()), since a segment's output then depends on the
+ * definitions in every other segment.
+ */
+class ParallelHighlighter
+{
+    /**
+     * Segments are at least this many lines long
+     */
+    const MIN_SEGMENT_LINES = 500;
+
+    /**
+     * How many lines past the end of its segment a process scans
+     */
+    const OVERLAP_LINES = 100;
+
+    /**
+     * The scanner table
+     */
+    private $scanners;
+
+    /**
+     * The language code of the scanner
+     */
+    private $code;
+
+    /**
+     * The maximum number of processes to use, including this one
+     */
+    private $processes;
+
+    /**
+     * The source, and the byte offsets and line counts of its segments. The
+     * offsets end with the length of the source.
+     */
+    private $source;
+    private $starts = array();
+    private $lines = array();
+
+    /**
+     * @param $scanners the Scanners table
+     * @param $code the language code of the scanner to use
+     * @param $processes the maximum number of processes to use
+     */
+    public function __construct(Scanners $scanners, $code, $processes)
+    {
+        $this->scanners = $scanners;
+        $this->code = $code;
+        $this->processes = max(1, (int)$processes);
+    }
+
+    /**
+     * @brief Whether this process is able to fork workers
+     */
+    public static function available()
+    {
+        return PHP_SAPI === 'cli' && function_exists('pcntl_fork') && function_exists('pcntl_waitpid');
+    }
+
+    /**
+     * @brief Scans a source string
+     *
+     * @param $source the source string
+     * @return the tagged string, as Scanner::highlight()
+     */
+    public function highlight($source)
+    {
+        $this->source = $source;
+        $this->split();
+        $count = count($this->lines);
+        $probe = $this->scanners->acquireScanner($this->code);
+        if ($count < 2 || !self::available() || !$probe->checkpointable() || $probe->recordsUserDefs()) {
+            $tagged = $probe->highlight($source);
+            $this->scanners->releaseScanner($probe);
+            return $tagged;
+        }
+        $this->scanners->releaseScanner($probe);
+
+        // segment 0 is scanned here while the workers scan the rest
+        $workers = $this->fork($count);
+        $first = $this->scanSegment(0, array());
+        $results = $this->collect($workers);
+        $results[0] = $first;
+
+        $pieces = array();
+        $state = array();
+        for ($i = 0; $i < $count; $i++) {
+            $result = ($state === array() && isset($results[$i])) ? $results[$i] : $this->scanSegment($i, $state);
+            if ($i < $count - 1 && $result['state'] === null) {
+                // a token crosses the seam, so there's no state to resume
+                // from: scan the rest of the source in one go
+                $pieces[] = $this->scanRest($i, $state);
+                break;
+            }
+            $pieces[] = $result['lines'];
+            $state = $result['state'];
+        }
+        return implode("\n", $pieces);
+    }
+
+    /**
+     * @brief Splits the source into segments
+     * @internal
+     */
+    private function split()
+    {
+        $total = substr_count($this->source, "\n") + 1;
+        $size = max(self::MIN_SEGMENT_LINES, (int)ceil($total / $this->processes));
+        $this->starts = array(0);
+        $this->lines = array();
+        $pos = 0;
+        $line = 0;
+        while ($total - $line > $size) {
+            $pos = $this->skipLines($pos, $size);
+            $this->starts[] = $pos;
+            $this->lines[] = $size;
+            $line += $size;
+        }
+        $this->starts[] = strlen($this->source);
+        $this->lines[] = $total - $line;
+    }
+
+    /**
+     * @brief Gets the offset $n lines after $pos, or the length of the source
+     * if there aren't that many
+     * @internal
+     */
+    private function skipLines($pos, $n)
+    {
+        for ($i = 0; $i < $n; $i++) {
+            $pos = strpos($this->source, "\n", $pos);
+            if ($pos === false) {
+                return strlen($this->source);
+            }
+            $pos++;
+        }
+        return $pos;
+    }
+
+    /**
+     * @brief Forks a worker for each segment after the first
+     *
+     * Each worker writes its result to a temporary file.
+     *
+     * @return A map of segment => (process ID, file name)
+     * @internal
+     */
+    private function fork($count)
+    {
+        $workers = array();
+        for ($i = 1; $i < $count; $i++) {
+            $file = tempnam(sys_get_temp_dir(), 'luminous');
+            if ($file === false) {
+                continue;
+            }
+            $pid = pcntl_fork();
+            if ($pid === -1) {
+                unlink($file);
+                continue;
+            }
+            if ($pid === 0) {
+                file_put_contents($file, serialize($this->scanSegment($i, array())));
+                // don't run shutdown functions or destructors, which could
+                // disturb resources shared with the parent
+                if (function_exists('posix_kill')) {
+                    posix_kill(posix_getpid(), SIGKILL);
+                }
+                exit(0);
+            }
+            $workers[$i] = array($pid, $file);
+        }
+        return $workers;
+    }
+
+    /**
+     * @brief Waits for the workers and reads their results
+     *
+     * @return the results by segment. A worker which failed has no result.
+     * @internal
+     */
+    private function collect($workers)
+    {
+        $results = array();
+        foreach ($workers as $i => $worker) {
+            list($pid, $file) = $worker;
+            pcntl_waitpid($pid, $status);
+            $data = @file_get_contents($file);
+            @unlink($file);
+            $result = ($data === false || $data === '') ? false : @unserialize($data);
+            if (is_array($result)) {
+                $results[$i] = $result;
+            }
+        }
+        return $results;
+    }
+
+    /**
+     * @brief Gets a scanner from the pool, set up to scan part of the source
+     * from the given state
+     * @internal
+     */
+    private function scanner($from, $to, $state, $interval)
+    {
+        $scanner = $this->scanners->acquireScanner($this->code);
+        $scanner->prepare((string)substr($this->source, $from, $to - $from));
+        $scanner->enableCheckpoints($interval);
+        if ($state !== array()) {
+            $scanner->restoreCheckpoint(array('line' => 0, 'pos' => 0, 'state' => $state));
+        }
+        return $scanner;
+    }
+
+    /**
+     * @brief Scans a segment from a state
+     *
+     * @return A map of 'lines', the segment's lines of the tagged string
+     *    (without the final newline) and 'state', the state at the end of the
+     *    segment, or @c NULL if the segment doesn't end at a checkpoint.
+     * @internal
+     */
+    private function scanSegment($i, $state)
+    {
+        $from = $this->starts[$i];
+        $to = $this->starts[$i + 1];
+        if ($i === count($this->lines) - 1) {
+            $scanner = $this->scanner($from, $to, $state, 0);
+            $scanner->main();
+            $tagged = $scanner->tagged();
+            $this->scanners->releaseScanner($scanner);
+            return array('lines' => $tagged, 'state' => array());
+        }
+        $lines = $this->lines[$i];
+        $scanner = $this->scanner($from, $this->skipLines($to, self::OVERLAP_LINES), $state, $lines);
+        $scanner->main();
+        // the first checkpoint is taken at the first clean line boundary at
+        // or after the seam
+        $checkpoints = $scanner->checkpoints();
+        $end = null;
+        if (!empty($checkpoints) && $checkpoints[0]['pos'] === $to - $from) {
+            $end = $checkpoints[0]['state'];
+        }
+        $tagged = explode("\n", $scanner->tagged(), $lines + 1);
+        $this->scanners->releaseScanner($scanner);
+        array_pop($tagged);
+        return array('lines' => implode("\n", $tagged), 'state' => $end);
+    }
+
+    /**
+     * @brief Scans from the start of a segment to the end of the source
+     * @internal
+     */
+    private function scanRest($i, $state)
+    {
+        $scanner = $this->scanner($this->starts[$i], strlen($this->source), $state, 0);
+        $scanner->main();
+        $tagged = $scanner->tagged();
+        $this->scanners->releaseScanner($scanner);
+        return $tagged;
+    }
+}
+
+/** @endcond */
@@ -36,6 +36,25 @@ class Scanners
 
     private $descriptions = array();
 
+    /**
+     * @brief The maximum number of idle scanners kept per scanner class
+     *
+     * Set this to 0 to disable pooling.
+     *
+     * @see acquireScanner()
+     */
+    public $poolSize = 4;
+
+    /**
+     * Idle reusable scanners, as class name => list of instances
+     */
+    private $pool = array();
+
+    /**
+     * Memo of class name => fingerprint
+     */
+    private $fingerprints = array();
+
     /**
      * Adds a scanner into the table, or overwrites an existing scanner.
      *
@@ -158,6 +177,79 @@ class Scanners
         return null;
     }
 
+    /**
+     * @brief Gets a reusable scanner for a language from the pool
+     *
+     * This is like getScanner(), but the scanner may have been used before:
+     * it is prepared with Scanner::prepare() rather than string() and init(),
+     * which resets it instead of setting it up again. Give it back with
+     * releaseScanner() once its output has been taken.
+     *
+     * In a long-running process, this saves rebuilding each scanner's
+     * patterns and identifier maps for every source.
+     *
+     * @param language_name the name under which the gramar was originally indexed
+     * @param default if true: if the scanner doesn't exist, return the default
+     *    scanner. If false, return false
+     * @return The scanner, the default scanner, or null.
+     */
+    public function acquireScanner($languageName, $default = true)
+    {
+        $g = $this->getScannerArray($languageName, $default);
+        if ($g === false) {
+            return null;
+        }
+        $class = ltrim($g['scanner'], '\\');
+        if (!empty($this->pool[$class])) {
+            return array_pop($this->pool[$class]);
+        }
+        $scanner = new $class;
+        $scanner->makeReusable();
+        return $scanner;
+    }
+
+    /**
+     * @brief Returns a scanner from acquireScanner() to the pool
+     *
+     * The scanner must not be used again by the caller.
+     */
+    public function releaseScanner($scanner)
+    {
+        $class = get_class($scanner);
+        if (!isset($this->pool[$class])) {
+            $this->pool[$class] = array();
+        }
+        if (count($this->pool[$class]) < $this->poolSize) {
+            $this->pool[$class][] = $scanner;
+        }
+    }
+
+    /**
+     * @brief Gets a fingerprint of a language's scanner class
+     *
+     * This identifies the scanner's configuration, e.g. for cache IDs, without
+     * constructing or serializing a scanner. It is a hash of the class name,
+     * the class's Scanner::GRAMMAR_VERSION and LUMINOUS_VERSION, so it is the
+     * same on every host and only changes when the grammar or the release
+     * does.
+     *
+     * @return The fingerprint, or null if there is no scanner
+     */
+    public function scannerFingerprint($languageName, $default = true)
+    {
+        $g = $this->getScannerArray($languageName, $default);
+        if ($g === false) {
+            return null;
+        }
+        $class = ltrim($g['scanner'], '\\');
+        if (!isset($this->fingerprints[$class])) {
+            $this->fingerprints[$class] = md5(
+                $class . ':' . constant($class . '::GRAMMAR_VERSION') . ':' . LUMINOUS_VERSION
+            );
+        }
+        return $this->fingerprints[$class];
+    }
+
     public function getDescription($languageName)
     {
         $g = $this->getScannerArray($languageName, true);
@@ -28,6 +28,11 @@ class BashScanner extends Scanner
 {
     public $interpolated = false;
 
+    /**
+     * main() keeps state in local variables
+     */
+    protected $checkpointable = false;
+
     public static function stringFilter($token)
     {
         $token = Utils::escapeToken($token);
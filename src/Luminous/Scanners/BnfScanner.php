@@ -15,6 +15,8 @@ use Luminous\Core\Scanners\StatefulScanner;
 
 class BnfScanner extends StatefulScanner
 {
+    protected $recordsUserDefs = true;
+
     public function userDefExt($matches)
     {
         if ($matches[1] !== '') {
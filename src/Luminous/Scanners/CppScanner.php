@@ -5,7 +5,7 @@ namespace Luminous\Scanners;
 use Luminous\Core\Utils;
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\CKeywords;
+use Luminous\Scanners\Keywords\CIdentifierMap;
 
 // TODO: trigraph... does anyone use these?
 
@@ -16,9 +16,7 @@ class CppScanner extends SimpleScanner
         parent::__construct($src);
         $this->addFilter('preprocessor', 'PREPROCESSOR', array($this, 'preprocessorFilter'));
 
-        $this->addIdentifierMapping('FUNCTION', CKeywords::$FUNCTIONS);
-        $this->addIdentifierMapping('KEYWORD', CKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', CKeywords::$TYPES);
+        $this->addIdentifierMap(CIdentifierMap::$NAMES, CIdentifierMap::$MAP);
     }
 
     public function init()
@@ -15,6 +15,11 @@ use Luminous\Core\Scanners\Scanner;
 class DiffScanner extends Scanner
 {
     public $patterns = array();
+
+    /**
+     * main() keeps state in local variables
+     */
+    protected $checkpointable = false;
     // pretty mode uses language sub-scanners
     // to try to highlight the embedded code
     public $prettyMode = false;
@@ -44,6 +44,7 @@ class EcmaScriptScanner extends EmbeddedWebScriptScanner
     // logs a persistent token stream so that we can lookbehind to figure out
     // operators vs regexes.
     protected $tokens = array();
+    protected $lookbehind = true;
 
     private $childState = null;
 
@@ -152,8 +153,8 @@ class EcmaScriptScanner extends EmbeddedWebScriptScanner
 
     public function isOperand()
     {
-        for ($i = count($this->tokens) - 1; $i >= 0; $i--) {
-            $tok = $this->tokens[$i][0];
+        for ($i = 0; ($t = $this->recentToken($i)) !== null; $i++) {
+            $tok = $t[0];
             if ($tok === null || $tok === 'COMMENT' || $tok === 'COMMENT_SL') {
                 continue;
             }
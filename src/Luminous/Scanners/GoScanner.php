@@ -18,6 +18,8 @@ use Luminous\Core\Scanners\SimpleScanner;
 
 class GoScanner extends SimpleScanner
 {
+    protected $recordsUserDefs = true;
+
     public function typeOverride($matches)
     {
         $this->record($matches[1], 'IDENT');
@@ -4,7 +4,7 @@ namespace Luminous\Scanners;
 
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\JavaKeywords;
+use Luminous\Scanners\Keywords\JavaIdentifierMap;
 
 /*
  * Groovy is pretty much a cross between Python and Java.
@@ -16,15 +16,20 @@ class GroovyScanner extends SimpleScanner
     public $interpolation = false;
     protected $braceStack = 0;
 
+    /**
+     * The overrides look back through the recorded tokens
+     */
+    protected $compactTokens = false;
+    protected $lookbehind = true;
+
     public function regexOverride($match)
     {
         assert($this->peek() === '/');
         assert($match === array(0 => '/'));
         $regex = false;
 
-        $i = count($this->tokens);
-        while ($i--) {
-            list($tok, $contents) = $this->tokens[$i];
+        for ($i = 0; ($t = $this->recentToken($i)) !== null; $i++) {
+            list($tok, $contents) = $t;
             if ($tok === 'COMMENT') {
                 continue;
             } elseif ($tok === 'OPERATOR') {
@@ -124,8 +129,7 @@ class GroovyScanner extends SimpleScanner
 
     public function init()
     {
-        $this->addIdentifierMapping('KEYWORD', JavaKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', JavaKeywords::$TYPES);
+        $this->addIdentifierMap(JavaIdentifierMap::$NAMES, JavaIdentifierMap::$MAP);
         $this->addIdentifierMapping('KEYWORD', array('any', 'as', 'def', 'in', 'with', 'do', 'strictfp', 'println'));
 
         // C+P from python
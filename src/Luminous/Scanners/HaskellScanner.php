@@ -4,7 +4,7 @@ namespace Luminous\Scanners;
 
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\HaskellKeywords;
+use Luminous\Scanners\Keywords\HaskellIdentifierMap;
 
 // Haskell scanner.
 // We do not yet support TemplateHaskell because it looks INSANE.
@@ -28,10 +28,7 @@ class HaskellScanner extends SimpleScanner
 
     public function init()
     {
-        $this->addIdentifierMapping('KEYWORD', HaskellKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', HaskellKeywords::$TYPES);
-        $this->addIdentifierMapping('FUNCTION', HaskellKeywords::$FUNCTIONS);
-        $this->addIdentifierMapping('VALUE', HaskellKeywords::$VALUES);
+        $this->addIdentifierMap(HaskellIdentifierMap::$NAMES, HaskellIdentifierMap::$MAP);
 
         // shebang
         $this->addPattern('COMMENT', '/^#!.*/');
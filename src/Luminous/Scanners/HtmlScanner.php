@@ -47,7 +47,7 @@ class HtmlScanner extends EmbeddedWebScriptScanner
         $scanner = $this->childScanners[$lang];
         $scanner->pos($this->pos());
         $substr = $scanner->main();
-        $this->tokens[] = array(null, $scanner->tagged(), true);
+        $this->record($scanner->tagged(), null, true);
         $this->pos($scanner->pos());
         if ($scanner->interrupt) {
             $this->childState = array($lang, $this->pos());
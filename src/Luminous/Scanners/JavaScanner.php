@@ -4,14 +4,13 @@ namespace Luminous\Scanners;
 
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\JavaKeywords;
+use Luminous\Scanners\Keywords\JavaIdentifierMap;
 
 class JavaScanner extends SimpleScanner
 {
     public function init()
     {
-        $this->addIdentifierMapping('KEYWORD', JavaKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', JavaKeywords::$TYPES);
+        $this->addIdentifierMap(JavaIdentifierMap::$NAMES, JavaIdentifierMap::$MAP);
 
         $this->addPattern('COMMENT', TokenPresets::$C_COMMENT_ML);
         $this->addPattern('COMMENT', TokenPresets::$C_COMMENT_SL);
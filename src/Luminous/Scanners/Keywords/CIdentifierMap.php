@@ -0,0 +1,381 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from CKeywords by generate.php, do not edit.
+ */
+class CIdentifierMap
+{
+    public static $NAMES = array('FUNCTION', 'KEYWORD', 'TYPE');
+
+    public static $MAP = array(
+        'assert' => 'FUNCTION',
+        'cabs' => 'FUNCTION',
+        'cacos' => 'FUNCTION',
+        'cacosh' => 'FUNCTION',
+        'carg' => 'FUNCTION',
+        'casin' => 'FUNCTION',
+        'casinh' => 'FUNCTION',
+        'catan' => 'FUNCTION',
+        'catanh' => 'FUNCTION',
+        'ccos' => 'FUNCTION',
+        'ccosh' => 'FUNCTION',
+        'cexp' => 'FUNCTION',
+        'cimag' => 'FUNCTION',
+        'cis' => 'FUNCTION',
+        'clog' => 'FUNCTION',
+        'conj' => 'FUNCTION',
+        'cpow' => 'FUNCTION',
+        'cproj' => 'FUNCTION',
+        'creal' => 'FUNCTION',
+        'csin' => 'FUNCTION',
+        'csinh' => 'FUNCTION',
+        'csqrt' => 'FUNCTION',
+        'ctan' => 'FUNCTION',
+        'ctanh' => 'FUNCTION',
+        'digittoint' => 'FUNCTION',
+        'isalnum' => 'FUNCTION',
+        'isalpha' => 'FUNCTION',
+        'isascii' => 'FUNCTION',
+        'isblank' => 'FUNCTION',
+        'iscntrl' => 'FUNCTION',
+        'isdigit' => 'FUNCTION',
+        'isgraph' => 'FUNCTION',
+        'islower' => 'FUNCTION',
+        'isprint' => 'FUNCTION',
+        'ispunct' => 'FUNCTION',
+        'isspace' => 'FUNCTION',
+        'isupper' => 'FUNCTION',
+        'isxdigit' => 'FUNCTION',
+        'toascii' => 'FUNCTION',
+        'tolower' => 'FUNCTION',
+        'toupper' => 'FUNCTION',
+        'imaxabs' => 'FUNCTION',
+        'imaxdiv' => 'FUNCTION',
+        'strtoimax' => 'FUNCTION',
+        'strtoumax' => 'FUNCTION',
+        'wcstoimax' => 'FUNCTION',
+        'wcstoumax' => 'FUNCTION',
+        'localeconv' => 'FUNCTION',
+        'setlocale' => 'FUNCTION',
+        'acos' => 'FUNCTION',
+        'asin' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'atan2' => 'FUNCTION',
+        'atof' => 'FUNCTION',
+        'ceil' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'cosh' => 'FUNCTION',
+        'exp' => 'FUNCTION',
+        'fabs' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'frexp' => 'FUNCTION',
+        'ldexp' => 'FUNCTION',
+        'log' => 'FUNCTION',
+        'log10' => 'FUNCTION',
+        'modf' => 'FUNCTION',
+        'pow' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sinh' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'tan' => 'FUNCTION',
+        'tanh' => 'FUNCTION',
+        'longjmp' => 'FUNCTION',
+        'setjmp' => 'FUNCTION',
+        'raise' => 'FUNCTION',
+        'va_arg' => 'FUNCTION',
+        'va_copy' => 'FUNCTION',
+        'va_end' => 'FUNCTION',
+        'va_start' => 'FUNCTION',
+        'offsetof' => 'FUNCTION',
+        'clearerr' => 'FUNCTION',
+        'fclose' => 'FUNCTION',
+        'feof' => 'FUNCTION',
+        'ferror' => 'FUNCTION',
+        'fflush' => 'FUNCTION',
+        'fgetc' => 'FUNCTION',
+        'fgetpos' => 'FUNCTION',
+        'fgets' => 'FUNCTION',
+        'fopen' => 'FUNCTION',
+        'freopen' => 'FUNCTION',
+        'fdopen' => 'FUNCTION',
+        'fprintf' => 'FUNCTION',
+        'fputc' => 'FUNCTION',
+        'fputs' => 'FUNCTION',
+        'fread' => 'FUNCTION',
+        'fscanf' => 'FUNCTION',
+        'fseek' => 'FUNCTION',
+        'fsetpos' => 'FUNCTION',
+        'ftell' => 'FUNCTION',
+        'fwrite' => 'FUNCTION',
+        'getc' => 'FUNCTION',
+        'getchar' => 'FUNCTION',
+        'gets' => 'FUNCTION',
+        'perror' => 'FUNCTION',
+        'printf' => 'FUNCTION',
+        'sprintf' => 'FUNCTION',
+        'snprintf' => 'FUNCTION',
+        'putc' => 'FUNCTION',
+        'putchar' => 'FUNCTION',
+        'fputchar' => 'FUNCTION',
+        'puts' => 'FUNCTION',
+        'remove' => 'FUNCTION',
+        'rename' => 'FUNCTION',
+        'rewind' => 'FUNCTION',
+        'scanf' => 'FUNCTION',
+        'sscanf' => 'FUNCTION',
+        'vfscanf' => 'FUNCTION',
+        'vscanf' => 'FUNCTION',
+        'vsscanf' => 'FUNCTION',
+        'setbuf' => 'FUNCTION',
+        'setvbuf' => 'FUNCTION',
+        'tmpfile' => 'FUNCTION',
+        'tmpnam' => 'FUNCTION',
+        'ungetc' => 'FUNCTION',
+        'vprintf' => 'FUNCTION',
+        'vfprintf' => 'FUNCTION',
+        'vsprintf' => 'FUNCTION',
+        'abort' => 'FUNCTION',
+        'abs' => 'FUNCTION',
+        'labs' => 'FUNCTION',
+        'atexit' => 'FUNCTION',
+        'atoi' => 'FUNCTION',
+        'atol' => 'FUNCTION',
+        'bsearch' => 'FUNCTION',
+        'div' => 'FUNCTION',
+        'ldiv' => 'FUNCTION',
+        'exit' => 'FUNCTION',
+        'free' => 'FUNCTION',
+        'itoa' => 'FUNCTION',
+        'getenv' => 'FUNCTION',
+        'ltoa' => 'FUNCTION',
+        'malloc' => 'FUNCTION',
+        'alloc' => 'FUNCTION',
+        'realloc' => 'FUNCTION',
+        'qsort' => 'FUNCTION',
+        'rand' => 'FUNCTION',
+        'srand' => 'FUNCTION',
+        'strtod' => 'FUNCTION',
+        'strtol' => 'FUNCTION',
+        'strtoul' => 'FUNCTION',
+        'system' => 'FUNCTION',
+        'memchr' => 'FUNCTION',
+        'memcmp' => 'FUNCTION',
+        'memcpy' => 'FUNCTION',
+        'memmove' => 'FUNCTION',
+        'memset' => 'FUNCTION',
+        'strcat' => 'FUNCTION',
+        'strncat' => 'FUNCTION',
+        'strchr' => 'FUNCTION',
+        'strcmp' => 'FUNCTION',
+        'strncmp' => 'FUNCTION',
+        'strcoll' => 'FUNCTION',
+        'strcpy' => 'FUNCTION',
+        'strncpy' => 'FUNCTION',
+        'strcspn' => 'FUNCTION',
+        'strerror' => 'FUNCTION',
+        'strlen' => 'FUNCTION',
+        'strpbrk' => 'FUNCTION',
+        'strrchr' => 'FUNCTION',
+        'strspn' => 'FUNCTION',
+        'strstr' => 'FUNCTION',
+        'strtok' => 'FUNCTION',
+        'strxfrm' => 'FUNCTION',
+        'asctime' => 'FUNCTION',
+        'clock' => 'FUNCTION',
+        'ctime' => 'FUNCTION',
+        'difftime' => 'FUNCTION',
+        'gmtime' => 'FUNCTION',
+        'localtime' => 'FUNCTION',
+        'mktime' => 'FUNCTION',
+        'strftime' => 'FUNCTION',
+        'time' => 'FUNCTION',
+        'btowc' => 'FUNCTION',
+        'fgetwc' => 'FUNCTION',
+        'fgetws' => 'FUNCTION',
+        'fputwc' => 'FUNCTION',
+        'fputws' => 'FUNCTION',
+        'fwide' => 'FUNCTION',
+        'fwprintf' => 'FUNCTION',
+        'fwscanf' => 'FUNCTION',
+        'getwc' => 'FUNCTION',
+        'getwchar' => 'FUNCTION',
+        'mbrlen' => 'FUNCTION',
+        'mbrtowc' => 'FUNCTION',
+        'mbsinit' => 'FUNCTION',
+        'mbsrtowcs' => 'FUNCTION',
+        'putwc' => 'FUNCTION',
+        'putwchar' => 'FUNCTION',
+        'swprintf' => 'FUNCTION',
+        'swscanf' => 'FUNCTION',
+        'ungetwc' => 'FUNCTION',
+        'vfwprintf' => 'FUNCTION',
+        'vswprintf' => 'FUNCTION',
+        'vwprintf' => 'FUNCTION',
+        'wcrtomb' => 'FUNCTION',
+        'wcscat' => 'FUNCTION',
+        'wcschr' => 'FUNCTION',
+        'wcscmp' => 'FUNCTION',
+        'wcscoll' => 'FUNCTION',
+        'wcscpy' => 'FUNCTION',
+        'wcscspn' => 'FUNCTION',
+        'wcsftime' => 'FUNCTION',
+        'wcslen' => 'FUNCTION',
+        'wcsncat' => 'FUNCTION',
+        'wcsncmp' => 'FUNCTION',
+        'wcsncpy' => 'FUNCTION',
+        'wcspbrk' => 'FUNCTION',
+        'wcsrchr' => 'FUNCTION',
+        'wcsrtombs' => 'FUNCTION',
+        'wcsspn' => 'FUNCTION',
+        'wcsstr' => 'FUNCTION',
+        'wcstod' => 'FUNCTION',
+        'wcstok' => 'FUNCTION',
+        'wcstol' => 'FUNCTION',
+        'wcstoul' => 'FUNCTION',
+        'wcsxfrm' => 'FUNCTION',
+        'wctob' => 'FUNCTION',
+        'wmemchr' => 'FUNCTION',
+        'wmemcmp' => 'FUNCTION',
+        'wmemcpy' => 'FUNCTION',
+        'wmemmove' => 'FUNCTION',
+        'wmemset' => 'FUNCTION',
+        'wprintf' => 'FUNCTION',
+        'wscanf' => 'FUNCTION',
+        'iswalnum' => 'FUNCTION',
+        'iswalpha' => 'FUNCTION',
+        'iswcntrl' => 'FUNCTION',
+        'iswctype' => 'FUNCTION',
+        'iswdigit' => 'FUNCTION',
+        'iswgraph' => 'FUNCTION',
+        'iswlower' => 'FUNCTION',
+        'iswprint' => 'FUNCTION',
+        'iswpunct' => 'FUNCTION',
+        'iswspace' => 'FUNCTION',
+        'iswupper' => 'FUNCTION',
+        'iswxdigit' => 'FUNCTION',
+        'towctrans' => 'FUNCTION',
+        'towlower' => 'FUNCTION',
+        'towupper' => 'FUNCTION',
+        'wctrans' => 'FUNCTION',
+        'wctype' => 'FUNCTION',
+        'farmalloc' => 'FUNCTION',
+        'getch' => 'FUNCTION',
+        'getche' => 'FUNCTION',
+        'gotoxy' => 'FUNCTION',
+        'getaddrinfo' => 'FUNCTION',
+        'getnameinfo' => 'FUNCTION',
+        'asm' => 'KEYWORD',
+        'auto' => 'KEYWORD',
+        'break' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'class' => 'KEYWORD',
+        'continue' => 'KEYWORD',
+        'const' => 'KEYWORD',
+        'const_cast' => 'KEYWORD',
+        'connect' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'delete' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'dynamic_cast' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'explicit' => 'KEYWORD',
+        'extern' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'for_each' => 'KEYWORD',
+        'friend' => 'KEYWORD',
+        'goto' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'inline' => 'KEYWORD',
+        'mutable' => 'KEYWORD',
+        'namespace' => 'KEYWORD',
+        'new' => 'KEYWORD',
+        'operator' => 'KEYWORD',
+        'private' => 'KEYWORD',
+        'protected' => 'KEYWORD',
+        'public' => 'KEYWORD',
+        'register' => 'KEYWORD',
+        'reinterpret_cast' => 'KEYWORD',
+        'return' => 'KEYWORD',
+        'static' => 'KEYWORD',
+        'static_cast' => 'KEYWORD',
+        'switch' => 'KEYWORD',
+        'sizeof' => 'KEYWORD',
+        'signed' => 'KEYWORD',
+        'template' => 'KEYWORD',
+        'this' => 'KEYWORD',
+        'throw' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'typedef' => 'KEYWORD',
+        'typeid' => 'KEYWORD',
+        'typename' => 'KEYWORD',
+        'using' => 'KEYWORD',
+        'unsigned' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'NULL' => 'KEYWORD',
+        'SIGNAL' => 'KEYWORD',
+        'SLOT' => 'KEYWORD',
+        'TRUE' => 'KEYWORD',
+        'FALSE' => 'KEYWORD',
+        'true' => 'KEYWORD',
+        'false' => 'KEYWORD',
+        'bool' => 'TYPE',
+        'char' => 'TYPE',
+        'clock_t' => 'TYPE',
+        'double' => 'TYPE',
+        'div_t' => 'TYPE',
+        'enum' => 'TYPE',
+        'float' => 'TYPE',
+        'fpos_t' => 'TYPE',
+        'int' => 'TYPE',
+        'int8' => 'TYPE',
+        'int16' => 'TYPE',
+        'int32' => 'TYPE',
+        'int64' => 'TYPE',
+        'int8_t' => 'TYPE',
+        'int16_t' => 'TYPE',
+        'int32_t' => 'TYPE',
+        'int64_t' => 'TYPE',
+        'long' => 'TYPE',
+        'ldiv_t' => 'TYPE',
+        'short' => 'TYPE',
+        'struct' => 'TYPE',
+        'size_t' => 'TYPE',
+        'ptrdiff_t' => 'TYPE',
+        'time_t' => 'TYPE',
+        'union' => 'TYPE',
+        'uint' => 'TYPE',
+        'uint8' => 'TYPE',
+        'uint16' => 'TYPE',
+        'uint32' => 'TYPE',
+        'uint64' => 'TYPE',
+        'uint8_t' => 'TYPE',
+        'uint16_t' => 'TYPE',
+        'uint32_t' => 'TYPE',
+        'uint64_t' => 'TYPE',
+        'void' => 'TYPE',
+        'va_list' => 'TYPE',
+        'wchar_t' => 'TYPE',
+        'pair' => 'TYPE',
+        'list' => 'TYPE',
+        'deque' => 'TYPE',
+        'queue' => 'TYPE',
+        'priority_queue' => 'TYPE',
+        'set' => 'TYPE',
+        'stack' => 'TYPE',
+        'string' => 'TYPE',
+        'map' => 'TYPE',
+        'multiset' => 'TYPE',
+        'multimap' => 'TYPE',
+        'hash_set' => 'TYPE',
+        'hash_multiset' => 'TYPE',
+        'hash_map' => 'TYPE',
+        'hash_multimap' => 'TYPE',
+        'bitset' => 'TYPE',
+        'vector' => 'TYPE',
+        'valarray' => 'TYPE',
+        'iterator' => 'TYPE'
+    );
+}
@@ -0,0 +1,256 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from HaskellKeywords by generate.php, do not edit.
+ */
+class HaskellIdentifierMap
+{
+    public static $NAMES = array('KEYWORD', 'TYPE', 'FUNCTION', 'VALUE');
+
+    public static $MAP = array(
+        'as' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'of' => 'KEYWORD',
+        'class' => 'KEYWORD',
+        'data' => 'KEYWORD',
+        'family' => 'KEYWORD',
+        'instance' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'deriving' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'forall' => 'KEYWORD',
+        'foreign' => 'KEYWORD',
+        'hiding' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'then' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'import' => 'KEYWORD',
+        'infix' => 'KEYWORD',
+        'infixl' => 'KEYWORD',
+        'infixr' => 'KEYWORD',
+        'let' => 'KEYWORD',
+        'in' => 'KEYWORD',
+        'mdo' => 'KEYWORD',
+        'module' => 'KEYWORD',
+        'newtype' => 'KEYWORD',
+        'proc' => 'KEYWORD',
+        'qualified' => 'KEYWORD',
+        'rec' => 'KEYWORD',
+        'type' => 'KEYWORD',
+        'where' => 'KEYWORD',
+        'Bool' => 'TYPE',
+        'Char' => 'TYPE',
+        'Double' => 'TYPE',
+        'Either' => 'TYPE',
+        'FilePath' => 'TYPE',
+        'Float' => 'TYPE',
+        'Int' => 'TYPE',
+        'Integer' => 'TYPE',
+        'IO' => 'TYPE',
+        'IOError' => 'TYPE',
+        'Maybe' => 'TYPE',
+        'Ordering' => 'TYPE',
+        'ReadS' => 'TYPE',
+        'ShowS' => 'TYPE',
+        'String' => 'TYPE',
+        'Bounded' => 'TYPE',
+        'Enum' => 'TYPE',
+        'Eq' => 'TYPE',
+        'Floating' => 'TYPE',
+        'Fractional' => 'TYPE',
+        'Functor' => 'TYPE',
+        'Integral' => 'TYPE',
+        'Monad' => 'TYPE',
+        'Num' => 'TYPE',
+        'Ord' => 'TYPE',
+        'Read' => 'TYPE',
+        'Real' => 'TYPE',
+        'RealFloat' => 'TYPE',
+        'RealFrac' => 'TYPE',
+        'Show' => 'TYPE',
+        'abs' => 'FUNCTION',
+        'acos' => 'FUNCTION',
+        'acosh' => 'FUNCTION',
+        'all' => 'FUNCTION',
+        'and' => 'FUNCTION',
+        'any' => 'FUNCTION',
+        'appendFile' => 'FUNCTION',
+        'applyM' => 'FUNCTION',
+        'asTypeOf' => 'FUNCTION',
+        'asin' => 'FUNCTION',
+        'asinh' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'atan2' => 'FUNCTION',
+        'atanh' => 'FUNCTION',
+        'break' => 'FUNCTION',
+        'catch' => 'FUNCTION',
+        'ceiling' => 'FUNCTION',
+        'compare' => 'FUNCTION',
+        'concat' => 'FUNCTION',
+        'concatMap' => 'FUNCTION',
+        'const' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'cosh' => 'FUNCTION',
+        'curry' => 'FUNCTION',
+        'cycle' => 'FUNCTION',
+        'decodeFloat' => 'FUNCTION',
+        'div' => 'FUNCTION',
+        'divMod' => 'FUNCTION',
+        'drop' => 'FUNCTION',
+        'dropWhile' => 'FUNCTION',
+        'elem' => 'FUNCTION',
+        'encodeFloat' => 'FUNCTION',
+        'enumFrom' => 'FUNCTION',
+        'enumFromThen' => 'FUNCTION',
+        'enumFromThenTo' => 'FUNCTION',
+        'enumFromTo' => 'FUNCTION',
+        'error' => 'FUNCTION',
+        'even' => 'FUNCTION',
+        'exp' => 'FUNCTION',
+        'exponent' => 'FUNCTION',
+        'fail' => 'FUNCTION',
+        'filter' => 'FUNCTION',
+        'flip' => 'FUNCTION',
+        'floatDigits' => 'FUNCTION',
+        'floatRadix' => 'FUNCTION',
+        'floatRange' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'fmap' => 'FUNCTION',
+        'foldl' => 'FUNCTION',
+        'foldl1' => 'FUNCTION',
+        'foldr' => 'FUNCTION',
+        'foldr1' => 'FUNCTION',
+        'fromEnum' => 'FUNCTION',
+        'fromInteger' => 'FUNCTION',
+        'fromIntegral' => 'FUNCTION',
+        'fromRational' => 'FUNCTION',
+        'fst' => 'FUNCTION',
+        'gcd' => 'FUNCTION',
+        'getChar' => 'FUNCTION',
+        'getContents' => 'FUNCTION',
+        'getLine' => 'FUNCTION',
+        'head' => 'FUNCTION',
+        'id' => 'FUNCTION',
+        'init' => 'FUNCTION',
+        'interact' => 'FUNCTION',
+        'ioError' => 'FUNCTION',
+        'isDenormalized' => 'FUNCTION',
+        'isIEEE' => 'FUNCTION',
+        'isInfinite' => 'FUNCTION',
+        'isNaN' => 'FUNCTION',
+        'isNegativeZero' => 'FUNCTION',
+        'iterate' => 'FUNCTION',
+        'last' => 'FUNCTION',
+        'lcm' => 'FUNCTION',
+        'length' => 'FUNCTION',
+        'lex' => 'FUNCTION',
+        'lines' => 'FUNCTION',
+        'log' => 'FUNCTION',
+        'logBase' => 'FUNCTION',
+        'lookup' => 'FUNCTION',
+        'map' => 'FUNCTION',
+        'mapM' => 'FUNCTION',
+        'mapM_' => 'FUNCTION',
+        'max' => 'FUNCTION',
+        'maxBound' => 'FUNCTION',
+        'maximum' => 'FUNCTION',
+        'maybe' => 'FUNCTION',
+        'min' => 'FUNCTION',
+        'minBound' => 'FUNCTION',
+        'minimum' => 'FUNCTION',
+        'mod' => 'FUNCTION',
+        'negate' => 'FUNCTION',
+        'not' => 'FUNCTION',
+        'notElem' => 'FUNCTION',
+        'null' => 'FUNCTION',
+        'odd' => 'FUNCTION',
+        'or' => 'FUNCTION',
+        'otherwise' => 'FUNCTION',
+        'pi' => 'FUNCTION',
+        'pred' => 'FUNCTION',
+        'print' => 'FUNCTION',
+        'product' => 'FUNCTION',
+        'properFraction' => 'FUNCTION',
+        'putChar' => 'FUNCTION',
+        'putStr' => 'FUNCTION',
+        'putStrLn' => 'FUNCTION',
+        'quot' => 'FUNCTION',
+        'quotRem' => 'FUNCTION',
+        'read' => 'FUNCTION',
+        'readFile' => 'FUNCTION',
+        'readIO' => 'FUNCTION',
+        'readList' => 'FUNCTION',
+        'readLn' => 'FUNCTION',
+        'readParen' => 'FUNCTION',
+        'reads' => 'FUNCTION',
+        'readsPrec' => 'FUNCTION',
+        'realToFrac' => 'FUNCTION',
+        'recip' => 'FUNCTION',
+        'rem' => 'FUNCTION',
+        'repeat' => 'FUNCTION',
+        'replicate' => 'FUNCTION',
+        'return' => 'FUNCTION',
+        'reverse' => 'FUNCTION',
+        'round' => 'FUNCTION',
+        'scaleFloat' => 'FUNCTION',
+        'scanl' => 'FUNCTION',
+        'scanl1' => 'FUNCTION',
+        'scanr' => 'FUNCTION',
+        'scanr1' => 'FUNCTION',
+        'seq' => 'FUNCTION',
+        'sequence' => 'FUNCTION',
+        'sequence_' => 'FUNCTION',
+        'show' => 'FUNCTION',
+        'showChar' => 'FUNCTION',
+        'showList' => 'FUNCTION',
+        'showParen' => 'FUNCTION',
+        'showString' => 'FUNCTION',
+        'shows' => 'FUNCTION',
+        'showsPrec' => 'FUNCTION',
+        'significand' => 'FUNCTION',
+        'signum' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sinh' => 'FUNCTION',
+        'snd' => 'FUNCTION',
+        'span' => 'FUNCTION',
+        'splitAt' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'subtract' => 'FUNCTION',
+        'succ' => 'FUNCTION',
+        'sum' => 'FUNCTION',
+        'tail' => 'FUNCTION',
+        'take' => 'FUNCTION',
+        'takeWhile' => 'FUNCTION',
+        'tan' => 'FUNCTION',
+        'tanh' => 'FUNCTION',
+        'toEnum' => 'FUNCTION',
+        'toInteger' => 'FUNCTION',
+        'toRational' => 'FUNCTION',
+        'truncate' => 'FUNCTION',
+        'uncurry' => 'FUNCTION',
+        'undefined' => 'FUNCTION',
+        'unlines' => 'FUNCTION',
+        'until' => 'FUNCTION',
+        'unwords' => 'FUNCTION',
+        'unzip' => 'FUNCTION',
+        'unzip3' => 'FUNCTION',
+        'userError' => 'FUNCTION',
+        'words' => 'FUNCTION',
+        'writeFile' => 'FUNCTION',
+        'zip' => 'FUNCTION',
+        'zip3' => 'FUNCTION',
+        'zipWith' => 'FUNCTION',
+        'zipWith3' => 'FUNCTION',
+        'EQ' => 'VALUE',
+        'False' => 'VALUE',
+        'GT' => 'VALUE',
+        'Just' => 'VALUE',
+        'Left' => 'VALUE',
+        'LT' => 'VALUE',
+        'Nothing' => 'VALUE',
+        'Right' => 'VALUE',
+        'True' => 'VALUE'
+    );
+}
@@ -0,0 +1,2658 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from JavaKeywords by generate.php, do not edit.
+ */
+class JavaIdentifierMap
+{
+    public static $NAMES = array('KEYWORD', 'TYPE');
+
+    public static $MAP = array(
+        'abstract' => 'KEYWORD',
+        'assert' => 'KEYWORD',
+        'break' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'class' => 'KEYWORD',
+        'continue' => 'KEYWORD',
+        'const' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'final' => 'KEYWORD',
+        'finally' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'goto' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'implements' => 'KEYWORD',
+        'import' => 'KEYWORD',
+        'instanceof' => 'KEYWORD',
+        'interface' => 'KEYWORD',
+        'native' => 'KEYWORD',
+        'new' => 'KEYWORD',
+        'package' => 'KEYWORD',
+        'private' => 'KEYWORD',
+        'public' => 'KEYWORD',
+        'protected' => 'KEYWORD',
+        'return' => 'KEYWORD',
+        'static' => 'KEYWORD',
+        'strictfp' => 'KEYWORD',
+        'switch' => 'KEYWORD',
+        'synchronized' => 'KEYWORD',
+        'this' => 'KEYWORD',
+        'throw' => 'KEYWORD',
+        'throws' => 'KEYWORD',
+        'transient' => 'KEYWORD',
+        'volatile' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'true' => 'KEYWORD',
+        'false' => 'KEYWORD',
+        'null' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'bool' => 'TYPE',
+        'boolean' => 'TYPE',
+        'byte' => 'TYPE',
+        'char' => 'TYPE',
+        'double' => 'TYPE',
+        'enum' => 'TYPE',
+        'float' => 'TYPE',
+        'int' => 'TYPE',
+        'long' => 'TYPE',
+        'short' => 'TYPE',
+        'void' => 'TYPE',
+        'ARG_IN' => 'TYPE',
+        'ARG_INOUT' => 'TYPE',
+        'ARG_OUT' => 'TYPE',
+        'AWTError' => 'TYPE',
+        'AWTEvent' => 'TYPE',
+        'AWTEventListener' => 'TYPE',
+        'AWTEventListenerProxy' => 'TYPE',
+        'AWTEventMulticaster' => 'TYPE',
+        'AWTException' => 'TYPE',
+        'AWTKeyStroke' => 'TYPE',
+        'AWTPermission' => 'TYPE',
+        'AbstractAction' => 'TYPE',
+        'AbstractBorder' => 'TYPE',
+        'AbstractButton' => 'TYPE',
+        'AbstractCellEditor' => 'TYPE',
+        'AbstractCollection' => 'TYPE',
+        'AbstractColorChooserPanel' => 'TYPE',
+        'AbstractDocument' => 'TYPE',
+        'AttributeContext' => 'TYPE',
+        'Content' => 'TYPE',
+        'ElementEdit' => 'TYPE',
+        'AbstractInterruptibleChannel' => 'TYPE',
+        'AbstractLayoutCache' => 'TYPE',
+        'NodeDimensions' => 'TYPE',
+        'AbstractList' => 'TYPE',
+        'AbstractListModel' => 'TYPE',
+        'AbstractMap' => 'TYPE',
+        'AbstractMethodError' => 'TYPE',
+        'AbstractPreferences' => 'TYPE',
+        'AbstractSelectableChannel' => 'TYPE',
+        'AbstractSelectionKey' => 'TYPE',
+        'AbstractSelector' => 'TYPE',
+        'AbstractSequentialList' => 'TYPE',
+        'AbstractSet' => 'TYPE',
+        'AbstractSpinnerModel' => 'TYPE',
+        'AbstractTableModel' => 'TYPE',
+        'AbstractUndoableEdit' => 'TYPE',
+        'AbstractWriter' => 'TYPE',
+        'AccessControlContext' => 'TYPE',
+        'AccessControlException' => 'TYPE',
+        'AccessController' => 'TYPE',
+        'AccessException' => 'TYPE',
+        'Accessible' => 'TYPE',
+        'AccessibleAction' => 'TYPE',
+        'AccessibleBundle' => 'TYPE',
+        'AccessibleComponent' => 'TYPE',
+        'AccessibleContext' => 'TYPE',
+        'AccessibleEditableText' => 'TYPE',
+        'AccessibleExtendedComponent' => 'TYPE',
+        'AccessibleExtendedTable' => 'TYPE',
+        'AccessibleHyperlink' => 'TYPE',
+        'AccessibleHypertext' => 'TYPE',
+        'AccessibleIcon' => 'TYPE',
+        'AccessibleKeyBinding' => 'TYPE',
+        'AccessibleObject' => 'TYPE',
+        'AccessibleRelation' => 'TYPE',
+        'AccessibleRelationSet' => 'TYPE',
+        'AccessibleResourceBundle' => 'TYPE',
+        'AccessibleRole' => 'TYPE',
+        'AccessibleSelection' => 'TYPE',
+        'AccessibleState' => 'TYPE',
+        'AccessibleStateSet' => 'TYPE',
+        'AccessibleTable' => 'TYPE',
+        'AccessibleTableModelChange' => 'TYPE',
+        'AccessibleText' => 'TYPE',
+        'AccessibleValue' => 'TYPE',
+        'AccountExpiredException' => 'TYPE',
+        'Acl' => 'TYPE',
+        'AclEntry' => 'TYPE',
+        'AclNotFoundException' => 'TYPE',
+        'Action' => 'TYPE',
+        'ActionEvent' => 'TYPE',
+        'ActionListener' => 'TYPE',
+        'ActionMap' => 'TYPE',
+        'ActionMapUIResource' => 'TYPE',
+        'Activatable' => 'TYPE',
+        'ActivateFailedException' => 'TYPE',
+        'ActivationDesc' => 'TYPE',
+        'ActivationException' => 'TYPE',
+        'ActivationGroup' => 'TYPE',
+        'ActivationGroupDesc' => 'TYPE',
+        'CommandEnvironment' => 'TYPE',
+        'ActivationGroupID' => 'TYPE',
+        'ActivationGroup_Stub' => 'TYPE',
+        'ActivationID' => 'TYPE',
+        'ActivationInstantiator' => 'TYPE',
+        'ActivationMonitor' => 'TYPE',
+        'ActivationSystem' => 'TYPE',
+        'Activator' => 'TYPE',
+        'ActiveEvent' => 'TYPE',
+        'AdapterActivator' => 'TYPE',
+        'AdapterActivatorOperations' => 'TYPE',
+        'AdapterAlreadyExists' => 'TYPE',
+        'AdapterAlreadyExistsHelper' => 'TYPE',
+        'AdapterInactive' => 'TYPE',
+        'AdapterInactiveHelper' => 'TYPE',
+        'AdapterNonExistent' => 'TYPE',
+        'AdapterNonExistentHelper' => 'TYPE',
+        'AddressHelper' => 'TYPE',
+        'Adjustable' => 'TYPE',
+        'AdjustmentEvent' => 'TYPE',
+        'AdjustmentListener' => 'TYPE',
+        'Adler32' => 'TYPE',
+        'AffineTransform' => 'TYPE',
+        'AffineTransformOp' => 'TYPE',
+        'AlgorithmParameterGenerator' => 'TYPE',
+        'AlgorithmParameterGeneratorSpi' => 'TYPE',
+        'AlgorithmParameterSpec' => 'TYPE',
+        'AlgorithmParameters' => 'TYPE',
+        'AlgorithmParametersSpi' => 'TYPE',
+        'AllPermission' => 'TYPE',
+        'AlphaComposite' => 'TYPE',
+        'AlreadyBound' => 'TYPE',
+        'AlreadyBoundException' => 'TYPE',
+        'AlreadyBoundHelper' => 'TYPE',
+        'AlreadyBoundHolder' => 'TYPE',
+        'AlreadyConnectedException' => 'TYPE',
+        'AncestorEvent' => 'TYPE',
+        'AncestorListener' => 'TYPE',
+        'Annotation' => 'TYPE',
+        'Any' => 'TYPE',
+        'AnyHolder' => 'TYPE',
+        'AnySeqHelper' => 'TYPE',
+        'AnySeqHolder' => 'TYPE',
+        'AppConfigurationEntry' => 'TYPE',
+        'LoginModuleControlFlag' => 'TYPE',
+        'Applet' => 'TYPE',
+        'AppletContext' => 'TYPE',
+        'AppletInitializer' => 'TYPE',
+        'AppletStub' => 'TYPE',
+        'ApplicationException' => 'TYPE',
+        'Arc2D' => 'TYPE',
+        'Double' => 'TYPE',
+        'Float' => 'TYPE',
+        'Area' => 'TYPE',
+        'AreaAveragingScaleFilter' => 'TYPE',
+        'ArithmeticException' => 'TYPE',
+        'Array' => 'TYPE',
+        'ArrayIndexOutOfBoundsException' => 'TYPE',
+        'ArrayList' => 'TYPE',
+        'ArrayStoreException' => 'TYPE',
+        'Arrays' => 'TYPE',
+        'AssertionError' => 'TYPE',
+        'AsyncBoxView' => 'TYPE',
+        'AsynchronousCloseException' => 'TYPE',
+        'Attr' => 'TYPE',
+        'Attribute' => 'TYPE',
+        'AttributeException' => 'TYPE',
+        'AttributeInUseException' => 'TYPE',
+        'AttributeList' => 'TYPE',
+        'AttributeListImpl' => 'TYPE',
+        'AttributeModificationException' => 'TYPE',
+        'AttributeSet' => 'TYPE',
+        'CharacterAttribute' => 'TYPE',
+        'ColorAttribute' => 'TYPE',
+        'FontAttribute' => 'TYPE',
+        'ParagraphAttribute' => 'TYPE',
+        'AttributeSetUtilities' => 'TYPE',
+        'AttributedCharacterIterator' => 'TYPE',
+        'AttributedString' => 'TYPE',
+        'Attributes' => 'TYPE',
+        'Name' => 'TYPE',
+        'AttributesImpl' => 'TYPE',
+        'AudioClip' => 'TYPE',
+        'AudioFileFormat' => 'TYPE',
+        'Type' => 'TYPE',
+        'AudioFileReader' => 'TYPE',
+        'AudioFileWriter' => 'TYPE',
+        'AudioFormat' => 'TYPE',
+        'Encoding' => 'TYPE',
+        'AudioInputStream' => 'TYPE',
+        'AudioPermission' => 'TYPE',
+        'AudioSystem' => 'TYPE',
+        'AuthPermission' => 'TYPE',
+        'AuthenticationException' => 'TYPE',
+        'AuthenticationNotSupportedException' => 'TYPE',
+        'Authenticator' => 'TYPE',
+        'Autoscroll' => 'TYPE',
+        'BAD_CONTEXT' => 'TYPE',
+        'BAD_INV_ORDER' => 'TYPE',
+        'BAD_OPERATION' => 'TYPE',
+        'BAD_PARAM' => 'TYPE',
+        'BAD_POLICY' => 'TYPE',
+        'BAD_POLICY_TYPE' => 'TYPE',
+        'BAD_POLICY_VALUE' => 'TYPE',
+        'BAD_TYPECODE' => 'TYPE',
+        'BackingStoreException' => 'TYPE',
+        'BadKind' => 'TYPE',
+        'BadLocationException' => 'TYPE',
+        'BadPaddingException' => 'TYPE',
+        'BandCombineOp' => 'TYPE',
+        'BandedSampleModel' => 'TYPE',
+        'BasicArrowButton' => 'TYPE',
+        'BasicAttribute' => 'TYPE',
+        'BasicAttributes' => 'TYPE',
+        'BasicBorders' => 'TYPE',
+        'ButtonBorder' => 'TYPE',
+        'FieldBorder' => 'TYPE',
+        'MarginBorder' => 'TYPE',
+        'MenuBarBorder' => 'TYPE',
+        'RadioButtonBorder' => 'TYPE',
+        'RolloverButtonBorder' => 'TYPE',
+        'SplitPaneBorder' => 'TYPE',
+        'ToggleButtonBorder' => 'TYPE',
+        'BasicButtonListener' => 'TYPE',
+        'BasicButtonUI' => 'TYPE',
+        'BasicCheckBoxMenuItemUI' => 'TYPE',
+        'BasicCheckBoxUI' => 'TYPE',
+        'BasicColorChooserUI' => 'TYPE',
+        'BasicComboBoxEditor' => 'TYPE',
+        'UIResource' => 'TYPE',
+        'BasicComboBoxRenderer' => 'TYPE',
+        'BasicComboBoxUI' => 'TYPE',
+        'BasicComboPopup' => 'TYPE',
+        'BasicDesktopIconUI' => 'TYPE',
+        'BasicDesktopPaneUI' => 'TYPE',
+        'BasicDirectoryModel' => 'TYPE',
+        'BasicEditorPaneUI' => 'TYPE',
+        'BasicFileChooserUI' => 'TYPE',
+        'BasicFormattedTextFieldUI' => 'TYPE',
+        'BasicGraphicsUtils' => 'TYPE',
+        'BasicHTML' => 'TYPE',
+        'BasicIconFactory' => 'TYPE',
+        'BasicInternalFrameTitlePane' => 'TYPE',
+        'BasicInternalFrameUI' => 'TYPE',
+        'BasicLabelUI' => 'TYPE',
+        'BasicListUI' => 'TYPE',
+        'BasicLookAndFeel' => 'TYPE',
+        'BasicMenuBarUI' => 'TYPE',
+        'BasicMenuItemUI' => 'TYPE',
+        'BasicMenuUI' => 'TYPE',
+        'BasicOptionPaneUI' => 'TYPE',
+        'ButtonAreaLayout' => 'TYPE',
+        'BasicPanelUI' => 'TYPE',
+        'BasicPasswordFieldUI' => 'TYPE',
+        'BasicPermission' => 'TYPE',
+        'BasicPopupMenuSeparatorUI' => 'TYPE',
+        'BasicPopupMenuUI' => 'TYPE',
+        'BasicProgressBarUI' => 'TYPE',
+        'BasicRadioButtonMenuItemUI' => 'TYPE',
+        'BasicRadioButtonUI' => 'TYPE',
+        'BasicRootPaneUI' => 'TYPE',
+        'BasicScrollBarUI' => 'TYPE',
+        'BasicScrollPaneUI' => 'TYPE',
+        'BasicSeparatorUI' => 'TYPE',
+        'BasicSliderUI' => 'TYPE',
+        'BasicSpinnerUI' => 'TYPE',
+        'BasicSplitPaneDivider' => 'TYPE',
+        'BasicSplitPaneUI' => 'TYPE',
+        'BasicStroke' => 'TYPE',
+        'BasicTabbedPaneUI' => 'TYPE',
+        'BasicTableHeaderUI' => 'TYPE',
+        'BasicTableUI' => 'TYPE',
+        'BasicTextAreaUI' => 'TYPE',
+        'BasicTextFieldUI' => 'TYPE',
+        'BasicTextPaneUI' => 'TYPE',
+        'BasicTextUI' => 'TYPE',
+        'BasicCaret' => 'TYPE',
+        'BasicHighlighter' => 'TYPE',
+        'BasicToggleButtonUI' => 'TYPE',
+        'BasicToolBarSeparatorUI' => 'TYPE',
+        'BasicToolBarUI' => 'TYPE',
+        'BasicToolTipUI' => 'TYPE',
+        'BasicTreeUI' => 'TYPE',
+        'BasicViewportUI' => 'TYPE',
+        'BatchUpdateException' => 'TYPE',
+        'BeanContext' => 'TYPE',
+        'BeanContextChild' => 'TYPE',
+        'BeanContextChildComponentProxy' => 'TYPE',
+        'BeanContextChildSupport' => 'TYPE',
+        'BeanContextContainerProxy' => 'TYPE',
+        'BeanContextEvent' => 'TYPE',
+        'BeanContextMembershipEvent' => 'TYPE',
+        'BeanContextMembershipListener' => 'TYPE',
+        'BeanContextProxy' => 'TYPE',
+        'BeanContextServiceAvailableEvent' => 'TYPE',
+        'BeanContextServiceProvider' => 'TYPE',
+        'BeanContextServiceProviderBeanInfo' => 'TYPE',
+        'BeanContextServiceRevokedEvent' => 'TYPE',
+        'BeanContextServiceRevokedListener' => 'TYPE',
+        'BeanContextServices' => 'TYPE',
+        'BeanContextServicesListener' => 'TYPE',
+        'BeanContextServicesSupport' => 'TYPE',
+        'BCSSServiceProvider' => 'TYPE',
+        'BeanContextSupport' => 'TYPE',
+        'BCSIterator' => 'TYPE',
+        'BeanDescriptor' => 'TYPE',
+        'BeanInfo' => 'TYPE',
+        'Beans' => 'TYPE',
+        'BevelBorder' => 'TYPE',
+        'Bidi' => 'TYPE',
+        'BigDecimal' => 'TYPE',
+        'BigInteger' => 'TYPE',
+        'BinaryRefAddr' => 'TYPE',
+        'BindException' => 'TYPE',
+        'Binding' => 'TYPE',
+        'BindingHelper' => 'TYPE',
+        'BindingHolder' => 'TYPE',
+        'BindingIterator' => 'TYPE',
+        'BindingIteratorHelper' => 'TYPE',
+        'BindingIteratorHolder' => 'TYPE',
+        'BindingIteratorOperations' => 'TYPE',
+        'BindingIteratorPOA' => 'TYPE',
+        'BindingListHelper' => 'TYPE',
+        'BindingListHolder' => 'TYPE',
+        'BindingType' => 'TYPE',
+        'BindingTypeHelper' => 'TYPE',
+        'BindingTypeHolder' => 'TYPE',
+        'BitSet' => 'TYPE',
+        'Blob' => 'TYPE',
+        'BlockView' => 'TYPE',
+        'Book' => 'TYPE',
+        'Boolean' => 'TYPE',
+        'BooleanControl' => 'TYPE',
+        'BooleanHolder' => 'TYPE',
+        'BooleanSeqHelper' => 'TYPE',
+        'BooleanSeqHolder' => 'TYPE',
+        'Border' => 'TYPE',
+        'BorderFactory' => 'TYPE',
+        'BorderLayout' => 'TYPE',
+        'BorderUIResource' => 'TYPE',
+        'BevelBorderUIResource' => 'TYPE',
+        'CompoundBorderUIResource' => 'TYPE',
+        'EmptyBorderUIResource' => 'TYPE',
+        'EtchedBorderUIResource' => 'TYPE',
+        'LineBorderUIResource' => 'TYPE',
+        'MatteBorderUIResource' => 'TYPE',
+        'TitledBorderUIResource' => 'TYPE',
+        'BoundedRangeModel' => 'TYPE',
+        'Bounds' => 'TYPE',
+        'Box' => 'TYPE',
+        'Filler' => 'TYPE',
+        'BoxLayout' => 'TYPE',
+        'BoxView' => 'TYPE',
+        'BoxedValueHelper' => 'TYPE',
+        'BreakIterator' => 'TYPE',
+        'Buffer' => 'TYPE',
+        'BufferCapabilities' => 'TYPE',
+        'FlipContents' => 'TYPE',
+        'BufferOverflowException' => 'TYPE',
+        'BufferStrategy' => 'TYPE',
+        'BufferUnderflowException' => 'TYPE',
+        'BufferedImage' => 'TYPE',
+        'BufferedImageFilter' => 'TYPE',
+        'BufferedImageOp' => 'TYPE',
+        'BufferedInputStream' => 'TYPE',
+        'BufferedOutputStream' => 'TYPE',
+        'BufferedReader' => 'TYPE',
+        'BufferedWriter' => 'TYPE',
+        'Button' => 'TYPE',
+        'ButtonGroup' => 'TYPE',
+        'ButtonModel' => 'TYPE',
+        'ButtonUI' => 'TYPE',
+        'Byte' => 'TYPE',
+        'ByteArrayInputStream' => 'TYPE',
+        'ByteArrayOutputStream' => 'TYPE',
+        'ByteBuffer' => 'TYPE',
+        'ByteChannel' => 'TYPE',
+        'ByteHolder' => 'TYPE',
+        'ByteLookupTable' => 'TYPE',
+        'ByteOrder' => 'TYPE',
+        'CDATASection' => 'TYPE',
+        'CMMException' => 'TYPE',
+        'COMM_FAILURE' => 'TYPE',
+        'CRC32' => 'TYPE',
+        'CRL' => 'TYPE',
+        'CRLException' => 'TYPE',
+        'CRLSelector' => 'TYPE',
+        'CSS' => 'TYPE',
+        'CTX_RESTRICT_SCOPE' => 'TYPE',
+        'Calendar' => 'TYPE',
+        'CallableStatement' => 'TYPE',
+        'Callback' => 'TYPE',
+        'CallbackHandler' => 'TYPE',
+        'CancelablePrintJob' => 'TYPE',
+        'CancelledKeyException' => 'TYPE',
+        'CannotProceed' => 'TYPE',
+        'CannotProceedException' => 'TYPE',
+        'CannotProceedHelper' => 'TYPE',
+        'CannotProceedHolder' => 'TYPE',
+        'CannotRedoException' => 'TYPE',
+        'CannotUndoException' => 'TYPE',
+        'Canvas' => 'TYPE',
+        'CardLayout' => 'TYPE',
+        'Caret' => 'TYPE',
+        'CaretEvent' => 'TYPE',
+        'CaretListener' => 'TYPE',
+        'CellEditor' => 'TYPE',
+        'CellEditorListener' => 'TYPE',
+        'CellRendererPane' => 'TYPE',
+        'CertPath' => 'TYPE',
+        'CertPathRep' => 'TYPE',
+        'CertPathBuilder' => 'TYPE',
+        'CertPathBuilderException' => 'TYPE',
+        'CertPathBuilderResult' => 'TYPE',
+        'CertPathBuilderSpi' => 'TYPE',
+        'CertPathParameters' => 'TYPE',
+        'CertPathValidator' => 'TYPE',
+        'CertPathValidatorException' => 'TYPE',
+        'CertPathValidatorResult' => 'TYPE',
+        'CertPathValidatorSpi' => 'TYPE',
+        'CertSelector' => 'TYPE',
+        'CertStore' => 'TYPE',
+        'CertStoreException' => 'TYPE',
+        'CertStoreParameters' => 'TYPE',
+        'CertStoreSpi' => 'TYPE',
+        'Certificate' => 'TYPE',
+        'CertificateRep' => 'TYPE',
+        'CertificateEncodingException' => 'TYPE',
+        'CertificateException' => 'TYPE',
+        'CertificateExpiredException' => 'TYPE',
+        'CertificateFactory' => 'TYPE',
+        'CertificateFactorySpi' => 'TYPE',
+        'CertificateNotYetValidException' => 'TYPE',
+        'CertificateParsingException' => 'TYPE',
+        'ChangeEvent' => 'TYPE',
+        'ChangeListener' => 'TYPE',
+        'ChangedCharSetException' => 'TYPE',
+        'Channel' => 'TYPE',
+        'ChannelBinding' => 'TYPE',
+        'Channels' => 'TYPE',
+        'CharArrayReader' => 'TYPE',
+        'CharArrayWriter' => 'TYPE',
+        'CharBuffer' => 'TYPE',
+        'CharConversionException' => 'TYPE',
+        'CharHolder' => 'TYPE',
+        'CharSeqHelper' => 'TYPE',
+        'CharSeqHolder' => 'TYPE',
+        'CharSequence' => 'TYPE',
+        'Character' => 'TYPE',
+        'Subset' => 'TYPE',
+        'UnicodeBlock' => 'TYPE',
+        'CharacterCodingException' => 'TYPE',
+        'CharacterData' => 'TYPE',
+        'CharacterIterator' => 'TYPE',
+        'Charset' => 'TYPE',
+        'CharsetDecoder' => 'TYPE',
+        'CharsetEncoder' => 'TYPE',
+        'CharsetProvider' => 'TYPE',
+        'Checkbox' => 'TYPE',
+        'CheckboxGroup' => 'TYPE',
+        'CheckboxMenuItem' => 'TYPE',
+        'CheckedInputStream' => 'TYPE',
+        'CheckedOutputStream' => 'TYPE',
+        'Checksum' => 'TYPE',
+        'Choice' => 'TYPE',
+        'ChoiceCallback' => 'TYPE',
+        'ChoiceFormat' => 'TYPE',
+        'Chromaticity' => 'TYPE',
+        'Cipher' => 'TYPE',
+        'CipherInputStream' => 'TYPE',
+        'CipherOutputStream' => 'TYPE',
+        'CipherSpi' => 'TYPE',
+        'Class' => 'TYPE',
+        'ClassCastException' => 'TYPE',
+        'ClassCircularityError' => 'TYPE',
+        'ClassDesc' => 'TYPE',
+        'ClassFormatError' => 'TYPE',
+        'ClassLoader' => 'TYPE',
+        'ClassNotFoundException' => 'TYPE',
+        'ClientRequestInfo' => 'TYPE',
+        'ClientRequestInfoOperations' => 'TYPE',
+        'ClientRequestInterceptor' => 'TYPE',
+        'ClientRequestInterceptorOperations' => 'TYPE',
+        'Clip' => 'TYPE',
+        'Clipboard' => 'TYPE',
+        'ClipboardOwner' => 'TYPE',
+        'Clob' => 'TYPE',
+        'CloneNotSupportedException' => 'TYPE',
+        'Cloneable' => 'TYPE',
+        'ClosedByInterruptException' => 'TYPE',
+        'ClosedChannelException' => 'TYPE',
+        'ClosedSelectorException' => 'TYPE',
+        'CodeSets' => 'TYPE',
+        'CodeSource' => 'TYPE',
+        'Codec' => 'TYPE',
+        'CodecFactory' => 'TYPE',
+        'CodecFactoryHelper' => 'TYPE',
+        'CodecFactoryOperations' => 'TYPE',
+        'CodecOperations' => 'TYPE',
+        'CoderMalfunctionError' => 'TYPE',
+        'CoderResult' => 'TYPE',
+        'CodingErrorAction' => 'TYPE',
+        'CollationElementIterator' => 'TYPE',
+        'CollationKey' => 'TYPE',
+        'Collator' => 'TYPE',
+        'Collection' => 'TYPE',
+        'CollectionCertStoreParameters' => 'TYPE',
+        'Collections' => 'TYPE',
+        'Color' => 'TYPE',
+        'ColorChooserComponentFactory' => 'TYPE',
+        'ColorChooserUI' => 'TYPE',
+        'ColorConvertOp' => 'TYPE',
+        'ColorModel' => 'TYPE',
+        'ColorSelectionModel' => 'TYPE',
+        'ColorSpace' => 'TYPE',
+        'ColorSupported' => 'TYPE',
+        'ColorUIResource' => 'TYPE',
+        'ComboBoxEditor' => 'TYPE',
+        'ComboBoxModel' => 'TYPE',
+        'ComboBoxUI' => 'TYPE',
+        'ComboPopup' => 'TYPE',
+        'Comment' => 'TYPE',
+        'CommunicationException' => 'TYPE',
+        'Comparable' => 'TYPE',
+        'Comparator' => 'TYPE',
+        'Compiler' => 'TYPE',
+        'CompletionStatus' => 'TYPE',
+        'CompletionStatusHelper' => 'TYPE',
+        'Component' => 'TYPE',
+        'ComponentAdapter' => 'TYPE',
+        'ComponentColorModel' => 'TYPE',
+        'ComponentEvent' => 'TYPE',
+        'ComponentIdHelper' => 'TYPE',
+        'ComponentInputMap' => 'TYPE',
+        'ComponentInputMapUIResource' => 'TYPE',
+        'ComponentListener' => 'TYPE',
+        'ComponentOrientation' => 'TYPE',
+        'ComponentSampleModel' => 'TYPE',
+        'ComponentUI' => 'TYPE',
+        'ComponentView' => 'TYPE',
+        'Composite' => 'TYPE',
+        'CompositeContext' => 'TYPE',
+        'CompositeName' => 'TYPE',
+        'CompositeView' => 'TYPE',
+        'CompoundBorder' => 'TYPE',
+        'CompoundControl' => 'TYPE',
+        'CompoundEdit' => 'TYPE',
+        'CompoundName' => 'TYPE',
+        'Compression' => 'TYPE',
+        'ConcurrentModificationException' => 'TYPE',
+        'Configuration' => 'TYPE',
+        'ConfigurationException' => 'TYPE',
+        'ConfirmationCallback' => 'TYPE',
+        'ConnectException' => 'TYPE',
+        'ConnectIOException' => 'TYPE',
+        'Connection' => 'TYPE',
+        'ConnectionEvent' => 'TYPE',
+        'ConnectionEventListener' => 'TYPE',
+        'ConnectionPendingException' => 'TYPE',
+        'ConnectionPoolDataSource' => 'TYPE',
+        'ConsoleHandler' => 'TYPE',
+        'Constructor' => 'TYPE',
+        'Container' => 'TYPE',
+        'ContainerAdapter' => 'TYPE',
+        'ContainerEvent' => 'TYPE',
+        'ContainerListener' => 'TYPE',
+        'ContainerOrderFocusTraversalPolicy' => 'TYPE',
+        'ContentHandler' => 'TYPE',
+        'ContentHandlerFactory' => 'TYPE',
+        'ContentModel' => 'TYPE',
+        'Context' => 'TYPE',
+        'ContextList' => 'TYPE',
+        'ContextNotEmptyException' => 'TYPE',
+        'ContextualRenderedImageFactory' => 'TYPE',
+        'Control' => 'TYPE',
+        'ControlFactory' => 'TYPE',
+        'ControllerEventListener' => 'TYPE',
+        'ConvolveOp' => 'TYPE',
+        'CookieHolder' => 'TYPE',
+        'Copies' => 'TYPE',
+        'CopiesSupported' => 'TYPE',
+        'CredentialExpiredException' => 'TYPE',
+        'CropImageFilter' => 'TYPE',
+        'CubicCurve2D' => 'TYPE',
+        'Currency' => 'TYPE',
+        'Current' => 'TYPE',
+        'CurrentHelper' => 'TYPE',
+        'CurrentHolder' => 'TYPE',
+        'CurrentOperations' => 'TYPE',
+        'Cursor' => 'TYPE',
+        'CustomMarshal' => 'TYPE',
+        'CustomValue' => 'TYPE',
+        'Customizer' => 'TYPE',
+        'DATA_CONVERSION' => 'TYPE',
+        'DESKeySpec' => 'TYPE',
+        'DESedeKeySpec' => 'TYPE',
+        'DGC' => 'TYPE',
+        'DHGenParameterSpec' => 'TYPE',
+        'DHKey' => 'TYPE',
+        'DHParameterSpec' => 'TYPE',
+        'DHPrivateKey' => 'TYPE',
+        'DHPrivateKeySpec' => 'TYPE',
+        'DHPublicKey' => 'TYPE',
+        'DHPublicKeySpec' => 'TYPE',
+        'DOMException' => 'TYPE',
+        'DOMImplementation' => 'TYPE',
+        'DOMLocator' => 'TYPE',
+        'DOMResult' => 'TYPE',
+        'DOMSource' => 'TYPE',
+        'DSAKey' => 'TYPE',
+        'DSAKeyPairGenerator' => 'TYPE',
+        'DSAParameterSpec' => 'TYPE',
+        'DSAParams' => 'TYPE',
+        'DSAPrivateKey' => 'TYPE',
+        'DSAPrivateKeySpec' => 'TYPE',
+        'DSAPublicKey' => 'TYPE',
+        'DSAPublicKeySpec' => 'TYPE',
+        'DTD' => 'TYPE',
+        'DTDConstants' => 'TYPE',
+        'DTDHandler' => 'TYPE',
+        'DataBuffer' => 'TYPE',
+        'DataBufferByte' => 'TYPE',
+        'DataBufferDouble' => 'TYPE',
+        'DataBufferFloat' => 'TYPE',
+        'DataBufferInt' => 'TYPE',
+        'DataBufferShort' => 'TYPE',
+        'DataBufferUShort' => 'TYPE',
+        'DataFlavor' => 'TYPE',
+        'DataFormatException' => 'TYPE',
+        'DataInput' => 'TYPE',
+        'DataInputStream' => 'TYPE',
+        'DataLine' => 'TYPE',
+        'Info' => 'TYPE',
+        'DataOutput' => 'TYPE',
+        'DataOutputStream' => 'TYPE',
+        'DataSource' => 'TYPE',
+        'DataTruncation' => 'TYPE',
+        'DatabaseMetaData' => 'TYPE',
+        'DatagramChannel' => 'TYPE',
+        'DatagramPacket' => 'TYPE',
+        'DatagramSocket' => 'TYPE',
+        'DatagramSocketImpl' => 'TYPE',
+        'DatagramSocketImplFactory' => 'TYPE',
+        'Date' => 'TYPE',
+        'DateFormat' => 'TYPE',
+        'Field' => 'TYPE',
+        'DateFormatSymbols' => 'TYPE',
+        'DateFormatter' => 'TYPE',
+        'DateTimeAtCompleted' => 'TYPE',
+        'DateTimeAtCreation' => 'TYPE',
+        'DateTimeAtProcessing' => 'TYPE',
+        'DateTimeSyntax' => 'TYPE',
+        'DebugGraphics' => 'TYPE',
+        'DecimalFormat' => 'TYPE',
+        'DecimalFormatSymbols' => 'TYPE',
+        'DeclHandler' => 'TYPE',
+        'DefaultBoundedRangeModel' => 'TYPE',
+        'DefaultButtonModel' => 'TYPE',
+        'DefaultCaret' => 'TYPE',
+        'DefaultCellEditor' => 'TYPE',
+        'DefaultColorSelectionModel' => 'TYPE',
+        'DefaultComboBoxModel' => 'TYPE',
+        'DefaultDesktopManager' => 'TYPE',
+        'DefaultEditorKit' => 'TYPE',
+        'BeepAction' => 'TYPE',
+        'CopyAction' => 'TYPE',
+        'CutAction' => 'TYPE',
+        'DefaultKeyTypedAction' => 'TYPE',
+        'InsertBreakAction' => 'TYPE',
+        'InsertContentAction' => 'TYPE',
+        'InsertTabAction' => 'TYPE',
+        'PasteAction' => 'TYPE',
+        'DefaultFocusManager' => 'TYPE',
+        'DefaultFocusTraversalPolicy' => 'TYPE',
+        'DefaultFormatter' => 'TYPE',
+        'DefaultFormatterFactory' => 'TYPE',
+        'DefaultHandler' => 'TYPE',
+        'DefaultHighlighter' => 'TYPE',
+        'DefaultHighlightPainter' => 'TYPE',
+        'DefaultKeyboardFocusManager' => 'TYPE',
+        'DefaultListCellRenderer' => 'TYPE',
+        'DefaultListModel' => 'TYPE',
+        'DefaultListSelectionModel' => 'TYPE',
+        'DefaultMenuLayout' => 'TYPE',
+        'DefaultMetalTheme' => 'TYPE',
+        'DefaultMutableTreeNode' => 'TYPE',
+        'DefaultPersistenceDelegate' => 'TYPE',
+        'DefaultSingleSelectionModel' => 'TYPE',
+        'DefaultStyledDocument' => 'TYPE',
+        'AttributeUndoableEdit' => 'TYPE',
+        'ElementSpec' => 'TYPE',
+        'DefaultTableCellRenderer' => 'TYPE',
+        'DefaultTableColumnModel' => 'TYPE',
+        'DefaultTableModel' => 'TYPE',
+        'DefaultTextUI' => 'TYPE',
+        'DefaultTreeCellEditor' => 'TYPE',
+        'DefaultTreeCellRenderer' => 'TYPE',
+        'DefaultTreeModel' => 'TYPE',
+        'DefaultTreeSelectionModel' => 'TYPE',
+        'DefinitionKind' => 'TYPE',
+        'DefinitionKindHelper' => 'TYPE',
+        'Deflater' => 'TYPE',
+        'DeflaterOutputStream' => 'TYPE',
+        'Delegate' => 'TYPE',
+        'DelegationPermission' => 'TYPE',
+        'DesignMode' => 'TYPE',
+        'DesktopIconUI' => 'TYPE',
+        'DesktopManager' => 'TYPE',
+        'DesktopPaneUI' => 'TYPE',
+        'Destination' => 'TYPE',
+        'DestroyFailedException' => 'TYPE',
+        'Destroyable' => 'TYPE',
+        'Dialog' => 'TYPE',
+        'Dictionary' => 'TYPE',
+        'DigestException' => 'TYPE',
+        'DigestInputStream' => 'TYPE',
+        'DigestOutputStream' => 'TYPE',
+        'Dimension' => 'TYPE',
+        'Dimension2D' => 'TYPE',
+        'DimensionUIResource' => 'TYPE',
+        'DirContext' => 'TYPE',
+        'DirObjectFactory' => 'TYPE',
+        'DirStateFactory' => 'TYPE',
+        'Result' => 'TYPE',
+        'DirectColorModel' => 'TYPE',
+        'DirectoryManager' => 'TYPE',
+        'DisplayMode' => 'TYPE',
+        'DnDConstants' => 'TYPE',
+        'Doc' => 'TYPE',
+        'DocAttribute' => 'TYPE',
+        'DocAttributeSet' => 'TYPE',
+        'DocFlavor' => 'TYPE',
+        'BYTE_ARRAY' => 'TYPE',
+        'CHAR_ARRAY' => 'TYPE',
+        'INPUT_STREAM' => 'TYPE',
+        'READER' => 'TYPE',
+        'SERVICE_FORMATTED' => 'TYPE',
+        'STRING' => 'TYPE',
+        'URL' => 'TYPE',
+        'DocPrintJob' => 'TYPE',
+        'Document' => 'TYPE',
+        'DocumentBuilder' => 'TYPE',
+        'DocumentBuilderFactory' => 'TYPE',
+        'DocumentEvent' => 'TYPE',
+        'ElementChange' => 'TYPE',
+        'EventType' => 'TYPE',
+        'DocumentFilter' => 'TYPE',
+        'FilterBypass' => 'TYPE',
+        'DocumentFragment' => 'TYPE',
+        'DocumentHandler' => 'TYPE',
+        'DocumentListener' => 'TYPE',
+        'DocumentName' => 'TYPE',
+        'DocumentParser' => 'TYPE',
+        'DocumentType' => 'TYPE',
+        'DomainCombiner' => 'TYPE',
+        'DomainManager' => 'TYPE',
+        'DomainManagerOperations' => 'TYPE',
+        'DoubleBuffer' => 'TYPE',
+        'DoubleHolder' => 'TYPE',
+        'DoubleSeqHelper' => 'TYPE',
+        'DoubleSeqHolder' => 'TYPE',
+        'DragGestureEvent' => 'TYPE',
+        'DragGestureListener' => 'TYPE',
+        'DragGestureRecognizer' => 'TYPE',
+        'DragSource' => 'TYPE',
+        'DragSourceAdapter' => 'TYPE',
+        'DragSourceContext' => 'TYPE',
+        'DragSourceDragEvent' => 'TYPE',
+        'DragSourceDropEvent' => 'TYPE',
+        'DragSourceEvent' => 'TYPE',
+        'DragSourceListener' => 'TYPE',
+        'DragSourceMotionListener' => 'TYPE',
+        'Driver' => 'TYPE',
+        'DriverManager' => 'TYPE',
+        'DriverPropertyInfo' => 'TYPE',
+        'DropTarget' => 'TYPE',
+        'DropTargetAutoScroller' => 'TYPE',
+        'DropTargetAdapter' => 'TYPE',
+        'DropTargetContext' => 'TYPE',
+        'DropTargetDragEvent' => 'TYPE',
+        'DropTargetDropEvent' => 'TYPE',
+        'DropTargetEvent' => 'TYPE',
+        'DropTargetListener' => 'TYPE',
+        'DuplicateName' => 'TYPE',
+        'DuplicateNameHelper' => 'TYPE',
+        'DynAny' => 'TYPE',
+        'DynAnyFactory' => 'TYPE',
+        'DynAnyFactoryHelper' => 'TYPE',
+        'DynAnyFactoryOperations' => 'TYPE',
+        'DynAnyHelper' => 'TYPE',
+        'DynAnyOperations' => 'TYPE',
+        'DynAnySeqHelper' => 'TYPE',
+        'DynArray' => 'TYPE',
+        'DynArrayHelper' => 'TYPE',
+        'DynArrayOperations' => 'TYPE',
+        'DynEnum' => 'TYPE',
+        'DynEnumHelper' => 'TYPE',
+        'DynEnumOperations' => 'TYPE',
+        'DynFixed' => 'TYPE',
+        'DynFixedHelper' => 'TYPE',
+        'DynFixedOperations' => 'TYPE',
+        'DynSequence' => 'TYPE',
+        'DynSequenceHelper' => 'TYPE',
+        'DynSequenceOperations' => 'TYPE',
+        'DynStruct' => 'TYPE',
+        'DynStructHelper' => 'TYPE',
+        'DynStructOperations' => 'TYPE',
+        'DynUnion' => 'TYPE',
+        'DynUnionHelper' => 'TYPE',
+        'DynUnionOperations' => 'TYPE',
+        'DynValue' => 'TYPE',
+        'DynValueBox' => 'TYPE',
+        'DynValueBoxOperations' => 'TYPE',
+        'DynValueCommon' => 'TYPE',
+        'DynValueCommonOperations' => 'TYPE',
+        'DynValueHelper' => 'TYPE',
+        'DynValueOperations' => 'TYPE',
+        'DynamicImplementation' => 'TYPE',
+        'ENCODING_CDR_ENCAPS' => 'TYPE',
+        'EOFException' => 'TYPE',
+        'EditorKit' => 'TYPE',
+        'Element' => 'TYPE',
+        'ElementIterator' => 'TYPE',
+        'Ellipse2D' => 'TYPE',
+        'EmptyBorder' => 'TYPE',
+        'EmptyStackException' => 'TYPE',
+        'EncodedKeySpec' => 'TYPE',
+        'Encoder' => 'TYPE',
+        'EncryptedPrivateKeyInfo' => 'TYPE',
+        'Entity' => 'TYPE',
+        'EntityReference' => 'TYPE',
+        'EntityResolver' => 'TYPE',
+        'EnumControl' => 'TYPE',
+        'EnumSyntax' => 'TYPE',
+        'Enumeration' => 'TYPE',
+        'Environment' => 'TYPE',
+        'Error' => 'TYPE',
+        'ErrorHandler' => 'TYPE',
+        'ErrorListener' => 'TYPE',
+        'ErrorManager' => 'TYPE',
+        'EtchedBorder' => 'TYPE',
+        'Event' => 'TYPE',
+        'EventContext' => 'TYPE',
+        'EventDirContext' => 'TYPE',
+        'EventHandler' => 'TYPE',
+        'EventListener' => 'TYPE',
+        'EventListenerList' => 'TYPE',
+        'EventListenerProxy' => 'TYPE',
+        'EventObject' => 'TYPE',
+        'EventQueue' => 'TYPE',
+        'EventSetDescriptor' => 'TYPE',
+        'Exception' => 'TYPE',
+        'ExceptionInInitializerError' => 'TYPE',
+        'ExceptionList' => 'TYPE',
+        'ExceptionListener' => 'TYPE',
+        'ExemptionMechanism' => 'TYPE',
+        'ExemptionMechanismException' => 'TYPE',
+        'ExemptionMechanismSpi' => 'TYPE',
+        'ExpandVetoException' => 'TYPE',
+        'ExportException' => 'TYPE',
+        'Expression' => 'TYPE',
+        'ExtendedRequest' => 'TYPE',
+        'ExtendedResponse' => 'TYPE',
+        'Externalizable' => 'TYPE',
+        'FREE_MEM' => 'TYPE',
+        'FactoryConfigurationError' => 'TYPE',
+        'FailedLoginException' => 'TYPE',
+        'FeatureDescriptor' => 'TYPE',
+        'Fidelity' => 'TYPE',
+        'FieldNameHelper' => 'TYPE',
+        'FieldPosition' => 'TYPE',
+        'FieldView' => 'TYPE',
+        'File' => 'TYPE',
+        'FileCacheImageInputStream' => 'TYPE',
+        'FileCacheImageOutputStream' => 'TYPE',
+        'FileChannel' => 'TYPE',
+        'MapMode' => 'TYPE',
+        'FileChooserUI' => 'TYPE',
+        'FileDescriptor' => 'TYPE',
+        'FileDialog' => 'TYPE',
+        'FileFilter' => 'TYPE',
+        'FileHandler' => 'TYPE',
+        'FileImageInputStream' => 'TYPE',
+        'FileImageOutputStream' => 'TYPE',
+        'FileInputStream' => 'TYPE',
+        'FileLock' => 'TYPE',
+        'FileLockInterruptionException' => 'TYPE',
+        'FileNameMap' => 'TYPE',
+        'FileNotFoundException' => 'TYPE',
+        'FileOutputStream' => 'TYPE',
+        'FilePermission' => 'TYPE',
+        'FileReader' => 'TYPE',
+        'FileSystemView' => 'TYPE',
+        'FileView' => 'TYPE',
+        'FileWriter' => 'TYPE',
+        'FilenameFilter' => 'TYPE',
+        'Filter' => 'TYPE',
+        'FilterInputStream' => 'TYPE',
+        'FilterOutputStream' => 'TYPE',
+        'FilterReader' => 'TYPE',
+        'FilterWriter' => 'TYPE',
+        'FilteredImageSource' => 'TYPE',
+        'Finishings' => 'TYPE',
+        'FixedHeightLayoutCache' => 'TYPE',
+        'FixedHolder' => 'TYPE',
+        'FlatteningPathIterator' => 'TYPE',
+        'FlavorException' => 'TYPE',
+        'FlavorMap' => 'TYPE',
+        'FlavorTable' => 'TYPE',
+        'FloatBuffer' => 'TYPE',
+        'FloatControl' => 'TYPE',
+        'FloatHolder' => 'TYPE',
+        'FloatSeqHelper' => 'TYPE',
+        'FloatSeqHolder' => 'TYPE',
+        'FlowLayout' => 'TYPE',
+        'FlowView' => 'TYPE',
+        'FlowStrategy' => 'TYPE',
+        'FocusAdapter' => 'TYPE',
+        'FocusEvent' => 'TYPE',
+        'FocusListener' => 'TYPE',
+        'FocusManager' => 'TYPE',
+        'FocusTraversalPolicy' => 'TYPE',
+        'Font' => 'TYPE',
+        'FontFormatException' => 'TYPE',
+        'FontMetrics' => 'TYPE',
+        'FontRenderContext' => 'TYPE',
+        'FontUIResource' => 'TYPE',
+        'FormView' => 'TYPE',
+        'Format' => 'TYPE',
+        'FormatConversionProvider' => 'TYPE',
+        'FormatMismatch' => 'TYPE',
+        'FormatMismatchHelper' => 'TYPE',
+        'Formatter' => 'TYPE',
+        'ForwardRequest' => 'TYPE',
+        'ForwardRequestHelper' => 'TYPE',
+        'Frame' => 'TYPE',
+        'GSSContext' => 'TYPE',
+        'GSSCredential' => 'TYPE',
+        'GSSException' => 'TYPE',
+        'GSSManager' => 'TYPE',
+        'GSSName' => 'TYPE',
+        'GZIPInputStream' => 'TYPE',
+        'GZIPOutputStream' => 'TYPE',
+        'GapContent' => 'TYPE',
+        'GatheringByteChannel' => 'TYPE',
+        'GeneralPath' => 'TYPE',
+        'GeneralSecurityException' => 'TYPE',
+        'GlyphJustificationInfo' => 'TYPE',
+        'GlyphMetrics' => 'TYPE',
+        'GlyphVector' => 'TYPE',
+        'GlyphView' => 'TYPE',
+        'GlyphPainter' => 'TYPE',
+        'GradientPaint' => 'TYPE',
+        'GraphicAttribute' => 'TYPE',
+        'Graphics' => 'TYPE',
+        'Graphics2D' => 'TYPE',
+        'GraphicsConfigTemplate' => 'TYPE',
+        'GraphicsConfiguration' => 'TYPE',
+        'GraphicsDevice' => 'TYPE',
+        'GraphicsEnvironment' => 'TYPE',
+        'GrayFilter' => 'TYPE',
+        'GregorianCalendar' => 'TYPE',
+        'GridBagConstraints' => 'TYPE',
+        'GridBagLayout' => 'TYPE',
+        'GridLayout' => 'TYPE',
+        'Group' => 'TYPE',
+        'Guard' => 'TYPE',
+        'GuardedObject' => 'TYPE',
+        'HTML' => 'TYPE',
+        'Tag' => 'TYPE',
+        'UnknownTag' => 'TYPE',
+        'HTMLDocument' => 'TYPE',
+        'Iterator' => 'TYPE',
+        'HTMLEditorKit' => 'TYPE',
+        'HTMLFactory' => 'TYPE',
+        'HTMLTextAction' => 'TYPE',
+        'InsertHTMLTextAction' => 'TYPE',
+        'LinkController' => 'TYPE',
+        'Parser' => 'TYPE',
+        'ParserCallback' => 'TYPE',
+        'HTMLFrameHyperlinkEvent' => 'TYPE',
+        'HTMLWriter' => 'TYPE',
+        'Handler' => 'TYPE',
+        'HandlerBase' => 'TYPE',
+        'HandshakeCompletedEvent' => 'TYPE',
+        'HandshakeCompletedListener' => 'TYPE',
+        'HasControls' => 'TYPE',
+        'HashAttributeSet' => 'TYPE',
+        'HashDocAttributeSet' => 'TYPE',
+        'HashMap' => 'TYPE',
+        'HashPrintJobAttributeSet' => 'TYPE',
+        'HashPrintRequestAttributeSet' => 'TYPE',
+        'HashPrintServiceAttributeSet' => 'TYPE',
+        'HashSet' => 'TYPE',
+        'Hashtable' => 'TYPE',
+        'HeadlessException' => 'TYPE',
+        'HierarchyBoundsAdapter' => 'TYPE',
+        'HierarchyBoundsListener' => 'TYPE',
+        'HierarchyEvent' => 'TYPE',
+        'HierarchyListener' => 'TYPE',
+        'Highlighter' => 'TYPE',
+        'Highlight' => 'TYPE',
+        'HighlightPainter' => 'TYPE',
+        'HostnameVerifier' => 'TYPE',
+        'HttpURLConnection' => 'TYPE',
+        'HttpsURLConnection' => 'TYPE',
+        'HyperlinkEvent' => 'TYPE',
+        'HyperlinkListener' => 'TYPE',
+        'ICC_ColorSpace' => 'TYPE',
+        'ICC_Profile' => 'TYPE',
+        'ICC_ProfileGray' => 'TYPE',
+        'ICC_ProfileRGB' => 'TYPE',
+        'IDLEntity' => 'TYPE',
+        'IDLType' => 'TYPE',
+        'IDLTypeHelper' => 'TYPE',
+        'IDLTypeOperations' => 'TYPE',
+        'ID_ASSIGNMENT_POLICY_ID' => 'TYPE',
+        'ID_UNIQUENESS_POLICY_ID' => 'TYPE',
+        'IIOByteBuffer' => 'TYPE',
+        'IIOException' => 'TYPE',
+        'IIOImage' => 'TYPE',
+        'IIOInvalidTreeException' => 'TYPE',
+        'IIOMetadata' => 'TYPE',
+        'IIOMetadataController' => 'TYPE',
+        'IIOMetadataFormat' => 'TYPE',
+        'IIOMetadataFormatImpl' => 'TYPE',
+        'IIOMetadataNode' => 'TYPE',
+        'IIOParam' => 'TYPE',
+        'IIOParamController' => 'TYPE',
+        'IIOReadProgressListener' => 'TYPE',
+        'IIOReadUpdateListener' => 'TYPE',
+        'IIOReadWarningListener' => 'TYPE',
+        'IIORegistry' => 'TYPE',
+        'IIOServiceProvider' => 'TYPE',
+        'IIOWriteProgressListener' => 'TYPE',
+        'IIOWriteWarningListener' => 'TYPE',
+        'IMPLICIT_ACTIVATION_POLICY_ID' => 'TYPE',
+        'IMP_LIMIT' => 'TYPE',
+        'INITIALIZE' => 'TYPE',
+        'INTERNAL' => 'TYPE',
+        'INTF_REPOS' => 'TYPE',
+        'INVALID_TRANSACTION' => 'TYPE',
+        'INV_FLAG' => 'TYPE',
+        'INV_IDENT' => 'TYPE',
+        'INV_OBJREF' => 'TYPE',
+        'INV_POLICY' => 'TYPE',
+        'IOException' => 'TYPE',
+        'IOR' => 'TYPE',
+        'IORHelper' => 'TYPE',
+        'IORHolder' => 'TYPE',
+        'IORInfo' => 'TYPE',
+        'IORInfoOperations' => 'TYPE',
+        'IORInterceptor' => 'TYPE',
+        'IORInterceptorOperations' => 'TYPE',
+        'IRObject' => 'TYPE',
+        'IRObjectOperations' => 'TYPE',
+        'Icon' => 'TYPE',
+        'IconUIResource' => 'TYPE',
+        'IconView' => 'TYPE',
+        'IdAssignmentPolicy' => 'TYPE',
+        'IdAssignmentPolicyOperations' => 'TYPE',
+        'IdAssignmentPolicyValue' => 'TYPE',
+        'IdUniquenessPolicy' => 'TYPE',
+        'IdUniquenessPolicyOperations' => 'TYPE',
+        'IdUniquenessPolicyValue' => 'TYPE',
+        'IdentifierHelper' => 'TYPE',
+        'Identity' => 'TYPE',
+        'IdentityHashMap' => 'TYPE',
+        'IdentityScope' => 'TYPE',
+        'IllegalAccessError' => 'TYPE',
+        'IllegalAccessException' => 'TYPE',
+        'IllegalArgumentException' => 'TYPE',
+        'IllegalBlockSizeException' => 'TYPE',
+        'IllegalBlockingModeException' => 'TYPE',
+        'IllegalCharsetNameException' => 'TYPE',
+        'IllegalComponentStateException' => 'TYPE',
+        'IllegalMonitorStateException' => 'TYPE',
+        'IllegalPathStateException' => 'TYPE',
+        'IllegalSelectorException' => 'TYPE',
+        'IllegalStateException' => 'TYPE',
+        'IllegalThreadStateException' => 'TYPE',
+        'Image' => 'TYPE',
+        'ImageCapabilities' => 'TYPE',
+        'ImageConsumer' => 'TYPE',
+        'ImageFilter' => 'TYPE',
+        'ImageGraphicAttribute' => 'TYPE',
+        'ImageIO' => 'TYPE',
+        'ImageIcon' => 'TYPE',
+        'ImageInputStream' => 'TYPE',
+        'ImageInputStreamImpl' => 'TYPE',
+        'ImageInputStreamSpi' => 'TYPE',
+        'ImageObserver' => 'TYPE',
+        'ImageOutputStream' => 'TYPE',
+        'ImageOutputStreamImpl' => 'TYPE',
+        'ImageOutputStreamSpi' => 'TYPE',
+        'ImageProducer' => 'TYPE',
+        'ImageReadParam' => 'TYPE',
+        'ImageReader' => 'TYPE',
+        'ImageReaderSpi' => 'TYPE',
+        'ImageReaderWriterSpi' => 'TYPE',
+        'ImageTranscoder' => 'TYPE',
+        'ImageTranscoderSpi' => 'TYPE',
+        'ImageTypeSpecifier' => 'TYPE',
+        'ImageView' => 'TYPE',
+        'ImageWriteParam' => 'TYPE',
+        'ImageWriter' => 'TYPE',
+        'ImageWriterSpi' => 'TYPE',
+        'ImagingOpException' => 'TYPE',
+        'ImplicitActivationPolicy' => 'TYPE',
+        'ImplicitActivationPolicyOperations' => 'TYPE',
+        'ImplicitActivationPolicyValue' => 'TYPE',
+        'IncompatibleClassChangeError' => 'TYPE',
+        'InconsistentTypeCode' => 'TYPE',
+        'InconsistentTypeCodeHelper' => 'TYPE',
+        'IndexColorModel' => 'TYPE',
+        'IndexOutOfBoundsException' => 'TYPE',
+        'IndexedPropertyDescriptor' => 'TYPE',
+        'IndirectionException' => 'TYPE',
+        'Inet4Address' => 'TYPE',
+        'Inet6Address' => 'TYPE',
+        'InetAddress' => 'TYPE',
+        'InetSocketAddress' => 'TYPE',
+        'Inflater' => 'TYPE',
+        'InflaterInputStream' => 'TYPE',
+        'InheritableThreadLocal' => 'TYPE',
+        'InitialContext' => 'TYPE',
+        'InitialContextFactory' => 'TYPE',
+        'InitialContextFactoryBuilder' => 'TYPE',
+        'InitialDirContext' => 'TYPE',
+        'InitialLdapContext' => 'TYPE',
+        'InlineView' => 'TYPE',
+        'InputContext' => 'TYPE',
+        'InputEvent' => 'TYPE',
+        'InputMap' => 'TYPE',
+        'InputMapUIResource' => 'TYPE',
+        'InputMethod' => 'TYPE',
+        'InputMethodContext' => 'TYPE',
+        'InputMethodDescriptor' => 'TYPE',
+        'InputMethodEvent' => 'TYPE',
+        'InputMethodHighlight' => 'TYPE',
+        'InputMethodListener' => 'TYPE',
+        'InputMethodRequests' => 'TYPE',
+        'InputSource' => 'TYPE',
+        'InputStream' => 'TYPE',
+        'InputStreamReader' => 'TYPE',
+        'InputSubset' => 'TYPE',
+        'InputVerifier' => 'TYPE',
+        'Insets' => 'TYPE',
+        'InsetsUIResource' => 'TYPE',
+        'InstantiationError' => 'TYPE',
+        'InstantiationException' => 'TYPE',
+        'Instrument' => 'TYPE',
+        'InsufficientResourcesException' => 'TYPE',
+        'IntBuffer' => 'TYPE',
+        'IntHolder' => 'TYPE',
+        'Integer' => 'TYPE',
+        'IntegerSyntax' => 'TYPE',
+        'Interceptor' => 'TYPE',
+        'InterceptorOperations' => 'TYPE',
+        'InternalError' => 'TYPE',
+        'InternalFrameAdapter' => 'TYPE',
+        'InternalFrameEvent' => 'TYPE',
+        'InternalFrameFocusTraversalPolicy' => 'TYPE',
+        'InternalFrameListener' => 'TYPE',
+        'InternalFrameUI' => 'TYPE',
+        'InternationalFormatter' => 'TYPE',
+        'InterruptedException' => 'TYPE',
+        'InterruptedIOException' => 'TYPE',
+        'InterruptedNamingException' => 'TYPE',
+        'InterruptibleChannel' => 'TYPE',
+        'IntrospectionException' => 'TYPE',
+        'Introspector' => 'TYPE',
+        'Invalid' => 'TYPE',
+        'InvalidAddress' => 'TYPE',
+        'InvalidAddressHelper' => 'TYPE',
+        'InvalidAddressHolder' => 'TYPE',
+        'InvalidAlgorithmParameterException' => 'TYPE',
+        'InvalidAttributeIdentifierException' => 'TYPE',
+        'InvalidAttributeValueException' => 'TYPE',
+        'InvalidAttributesException' => 'TYPE',
+        'InvalidClassException' => 'TYPE',
+        'InvalidDnDOperationException' => 'TYPE',
+        'InvalidKeyException' => 'TYPE',
+        'InvalidKeySpecException' => 'TYPE',
+        'InvalidMarkException' => 'TYPE',
+        'InvalidMidiDataException' => 'TYPE',
+        'InvalidName' => 'TYPE',
+        'InvalidNameException' => 'TYPE',
+        'InvalidNameHelper' => 'TYPE',
+        'InvalidNameHolder' => 'TYPE',
+        'InvalidObjectException' => 'TYPE',
+        'InvalidParameterException' => 'TYPE',
+        'InvalidParameterSpecException' => 'TYPE',
+        'InvalidPolicy' => 'TYPE',
+        'InvalidPolicyHelper' => 'TYPE',
+        'InvalidPreferencesFormatException' => 'TYPE',
+        'InvalidSearchControlsException' => 'TYPE',
+        'InvalidSearchFilterException' => 'TYPE',
+        'InvalidSeq' => 'TYPE',
+        'InvalidSlot' => 'TYPE',
+        'InvalidSlotHelper' => 'TYPE',
+        'InvalidTransactionException' => 'TYPE',
+        'InvalidTypeForEncoding' => 'TYPE',
+        'InvalidTypeForEncodingHelper' => 'TYPE',
+        'InvalidValue' => 'TYPE',
+        'InvalidValueHelper' => 'TYPE',
+        'InvocationEvent' => 'TYPE',
+        'InvocationHandler' => 'TYPE',
+        'InvocationTargetException' => 'TYPE',
+        'InvokeHandler' => 'TYPE',
+        'IstringHelper' => 'TYPE',
+        'ItemEvent' => 'TYPE',
+        'ItemListener' => 'TYPE',
+        'ItemSelectable' => 'TYPE',
+        'IvParameterSpec' => 'TYPE',
+        'JApplet' => 'TYPE',
+        'JButton' => 'TYPE',
+        'JCheckBox' => 'TYPE',
+        'JCheckBoxMenuItem' => 'TYPE',
+        'JColorChooser' => 'TYPE',
+        'JComboBox' => 'TYPE',
+        'KeySelectionManager' => 'TYPE',
+        'JComponent' => 'TYPE',
+        'JDesktopPane' => 'TYPE',
+        'JDialog' => 'TYPE',
+        'JEditorPane' => 'TYPE',
+        'JFileChooser' => 'TYPE',
+        'JFormattedTextField' => 'TYPE',
+        'AbstractFormatter' => 'TYPE',
+        'AbstractFormatterFactory' => 'TYPE',
+        'JFrame' => 'TYPE',
+        'JInternalFrame' => 'TYPE',
+        'JDesktopIcon' => 'TYPE',
+        'JLabel' => 'TYPE',
+        'JLayeredPane' => 'TYPE',
+        'JList' => 'TYPE',
+        'JMenu' => 'TYPE',
+        'JMenuBar' => 'TYPE',
+        'JMenuItem' => 'TYPE',
+        'JOptionPane' => 'TYPE',
+        'JPEGHuffmanTable' => 'TYPE',
+        'JPEGImageReadParam' => 'TYPE',
+        'JPEGImageWriteParam' => 'TYPE',
+        'JPEGQTable' => 'TYPE',
+        'JPanel' => 'TYPE',
+        'JPasswordField' => 'TYPE',
+        'JPopupMenu' => 'TYPE',
+        'Separator' => 'TYPE',
+        'JProgressBar' => 'TYPE',
+        'JRadioButton' => 'TYPE',
+        'JRadioButtonMenuItem' => 'TYPE',
+        'JRootPane' => 'TYPE',
+        'JScrollBar' => 'TYPE',
+        'JScrollPane' => 'TYPE',
+        'JSeparator' => 'TYPE',
+        'JSlider' => 'TYPE',
+        'JSpinner' => 'TYPE',
+        'DateEditor' => 'TYPE',
+        'DefaultEditor' => 'TYPE',
+        'ListEditor' => 'TYPE',
+        'NumberEditor' => 'TYPE',
+        'JSplitPane' => 'TYPE',
+        'JTabbedPane' => 'TYPE',
+        'JTable' => 'TYPE',
+        'JTableHeader' => 'TYPE',
+        'JTextArea' => 'TYPE',
+        'JTextComponent' => 'TYPE',
+        'KeyBinding' => 'TYPE',
+        'JTextField' => 'TYPE',
+        'JTextPane' => 'TYPE',
+        'JToggleButton' => 'TYPE',
+        'ToggleButtonModel' => 'TYPE',
+        'JToolBar' => 'TYPE',
+        'JToolTip' => 'TYPE',
+        'JTree' => 'TYPE',
+        'DynamicUtilTreeNode' => 'TYPE',
+        'EmptySelectionModel' => 'TYPE',
+        'JViewport' => 'TYPE',
+        'JWindow' => 'TYPE',
+        'JarEntry' => 'TYPE',
+        'JarException' => 'TYPE',
+        'JarFile' => 'TYPE',
+        'JarInputStream' => 'TYPE',
+        'JarOutputStream' => 'TYPE',
+        'JarURLConnection' => 'TYPE',
+        'JobAttributes' => 'TYPE',
+        'DefaultSelectionType' => 'TYPE',
+        'DestinationType' => 'TYPE',
+        'DialogType' => 'TYPE',
+        'MultipleDocumentHandlingType' => 'TYPE',
+        'SidesType' => 'TYPE',
+        'JobHoldUntil' => 'TYPE',
+        'JobImpressions' => 'TYPE',
+        'JobImpressionsCompleted' => 'TYPE',
+        'JobImpressionsSupported' => 'TYPE',
+        'JobKOctets' => 'TYPE',
+        'JobKOctetsProcessed' => 'TYPE',
+        'JobKOctetsSupported' => 'TYPE',
+        'JobMediaSheets' => 'TYPE',
+        'JobMediaSheetsCompleted' => 'TYPE',
+        'JobMediaSheetsSupported' => 'TYPE',
+        'JobMessageFromOperator' => 'TYPE',
+        'JobName' => 'TYPE',
+        'JobOriginatingUserName' => 'TYPE',
+        'JobPriority' => 'TYPE',
+        'JobPrioritySupported' => 'TYPE',
+        'JobSheets' => 'TYPE',
+        'JobState' => 'TYPE',
+        'JobStateReason' => 'TYPE',
+        'JobStateReasons' => 'TYPE',
+        'KerberosKey' => 'TYPE',
+        'KerberosPrincipal' => 'TYPE',
+        'KerberosTicket' => 'TYPE',
+        'Kernel' => 'TYPE',
+        'Key' => 'TYPE',
+        'KeyAdapter' => 'TYPE',
+        'KeyAgreement' => 'TYPE',
+        'KeyAgreementSpi' => 'TYPE',
+        'KeyEvent' => 'TYPE',
+        'KeyEventDispatcher' => 'TYPE',
+        'KeyEventPostProcessor' => 'TYPE',
+        'KeyException' => 'TYPE',
+        'KeyFactory' => 'TYPE',
+        'KeyFactorySpi' => 'TYPE',
+        'KeyGenerator' => 'TYPE',
+        'KeyGeneratorSpi' => 'TYPE',
+        'KeyListener' => 'TYPE',
+        'KeyManagementException' => 'TYPE',
+        'KeyManager' => 'TYPE',
+        'KeyManagerFactory' => 'TYPE',
+        'KeyManagerFactorySpi' => 'TYPE',
+        'KeyPair' => 'TYPE',
+        'KeyPairGenerator' => 'TYPE',
+        'KeyPairGeneratorSpi' => 'TYPE',
+        'KeySpec' => 'TYPE',
+        'KeyStore' => 'TYPE',
+        'KeyStoreException' => 'TYPE',
+        'KeyStoreSpi' => 'TYPE',
+        'KeyStroke' => 'TYPE',
+        'KeyboardFocusManager' => 'TYPE',
+        'Keymap' => 'TYPE',
+        'LDAPCertStoreParameters' => 'TYPE',
+        'LIFESPAN_POLICY_ID' => 'TYPE',
+        'LOCATION_FORWARD' => 'TYPE',
+        'Label' => 'TYPE',
+        'LabelUI' => 'TYPE',
+        'LabelView' => 'TYPE',
+        'LanguageCallback' => 'TYPE',
+        'LastOwnerException' => 'TYPE',
+        'LayeredHighlighter' => 'TYPE',
+        'LayerPainter' => 'TYPE',
+        'LayoutFocusTraversalPolicy' => 'TYPE',
+        'LayoutManager' => 'TYPE',
+        'LayoutManager2' => 'TYPE',
+        'LayoutQueue' => 'TYPE',
+        'LdapContext' => 'TYPE',
+        'LdapReferralException' => 'TYPE',
+        'Lease' => 'TYPE',
+        'Level' => 'TYPE',
+        'LexicalHandler' => 'TYPE',
+        'LifespanPolicy' => 'TYPE',
+        'LifespanPolicyOperations' => 'TYPE',
+        'LifespanPolicyValue' => 'TYPE',
+        'LimitExceededException' => 'TYPE',
+        'Line' => 'TYPE',
+        'Line2D' => 'TYPE',
+        'LineBorder' => 'TYPE',
+        'LineBreakMeasurer' => 'TYPE',
+        'LineEvent' => 'TYPE',
+        'LineListener' => 'TYPE',
+        'LineMetrics' => 'TYPE',
+        'LineNumberInputStream' => 'TYPE',
+        'LineNumberReader' => 'TYPE',
+        'LineUnavailableException' => 'TYPE',
+        'LinkException' => 'TYPE',
+        'LinkLoopException' => 'TYPE',
+        'LinkRef' => 'TYPE',
+        'LinkageError' => 'TYPE',
+        'LinkedHashMap' => 'TYPE',
+        'LinkedHashSet' => 'TYPE',
+        'LinkedList' => 'TYPE',
+        'List' => 'TYPE',
+        'ListCellRenderer' => 'TYPE',
+        'ListDataEvent' => 'TYPE',
+        'ListDataListener' => 'TYPE',
+        'ListIterator' => 'TYPE',
+        'ListModel' => 'TYPE',
+        'ListResourceBundle' => 'TYPE',
+        'ListSelectionEvent' => 'TYPE',
+        'ListSelectionListener' => 'TYPE',
+        'ListSelectionModel' => 'TYPE',
+        'ListUI' => 'TYPE',
+        'ListView' => 'TYPE',
+        'LoaderHandler' => 'TYPE',
+        'LocalObject' => 'TYPE',
+        'Locale' => 'TYPE',
+        'LocateRegistry' => 'TYPE',
+        'Locator' => 'TYPE',
+        'LocatorImpl' => 'TYPE',
+        'LogManager' => 'TYPE',
+        'LogRecord' => 'TYPE',
+        'LogStream' => 'TYPE',
+        'Logger' => 'TYPE',
+        'LoggingPermission' => 'TYPE',
+        'LoginContext' => 'TYPE',
+        'LoginException' => 'TYPE',
+        'LoginModule' => 'TYPE',
+        'Long' => 'TYPE',
+        'LongBuffer' => 'TYPE',
+        'LongHolder' => 'TYPE',
+        'LongLongSeqHelper' => 'TYPE',
+        'LongLongSeqHolder' => 'TYPE',
+        'LongSeqHelper' => 'TYPE',
+        'LongSeqHolder' => 'TYPE',
+        'LookAndFeel' => 'TYPE',
+        'LookupOp' => 'TYPE',
+        'LookupTable' => 'TYPE',
+        'MARSHAL' => 'TYPE',
+        'Mac' => 'TYPE',
+        'MacSpi' => 'TYPE',
+        'MalformedInputException' => 'TYPE',
+        'MalformedLinkException' => 'TYPE',
+        'MalformedURLException' => 'TYPE',
+        'ManagerFactoryParameters' => 'TYPE',
+        'Manifest' => 'TYPE',
+        'Map' => 'TYPE',
+        'Entry' => 'TYPE',
+        'MappedByteBuffer' => 'TYPE',
+        'MarshalException' => 'TYPE',
+        'MarshalledObject' => 'TYPE',
+        'MaskFormatter' => 'TYPE',
+        'Matcher' => 'TYPE',
+        'Math' => 'TYPE',
+        'MatteBorder' => 'TYPE',
+        'Media' => 'TYPE',
+        'MediaName' => 'TYPE',
+        'MediaPrintableArea' => 'TYPE',
+        'MediaSize' => 'TYPE',
+        'Engineering' => 'TYPE',
+        'ISO' => 'TYPE',
+        'JIS' => 'TYPE',
+        'NA' => 'TYPE',
+        'Other' => 'TYPE',
+        'MediaSizeName' => 'TYPE',
+        'MediaTracker' => 'TYPE',
+        'MediaTray' => 'TYPE',
+        'Member' => 'TYPE',
+        'MemoryCacheImageInputStream' => 'TYPE',
+        'MemoryCacheImageOutputStream' => 'TYPE',
+        'MemoryHandler' => 'TYPE',
+        'MemoryImageSource' => 'TYPE',
+        'Menu' => 'TYPE',
+        'MenuBar' => 'TYPE',
+        'MenuBarUI' => 'TYPE',
+        'MenuComponent' => 'TYPE',
+        'MenuContainer' => 'TYPE',
+        'MenuDragMouseEvent' => 'TYPE',
+        'MenuDragMouseListener' => 'TYPE',
+        'MenuElement' => 'TYPE',
+        'MenuEvent' => 'TYPE',
+        'MenuItem' => 'TYPE',
+        'MenuItemUI' => 'TYPE',
+        'MenuKeyEvent' => 'TYPE',
+        'MenuKeyListener' => 'TYPE',
+        'MenuListener' => 'TYPE',
+        'MenuSelectionManager' => 'TYPE',
+        'MenuShortcut' => 'TYPE',
+        'MessageDigest' => 'TYPE',
+        'MessageDigestSpi' => 'TYPE',
+        'MessageFormat' => 'TYPE',
+        'MessageProp' => 'TYPE',
+        'MetaEventListener' => 'TYPE',
+        'MetaMessage' => 'TYPE',
+        'MetalBorders' => 'TYPE',
+        'Flush3DBorder' => 'TYPE',
+        'InternalFrameBorder' => 'TYPE',
+        'MenuItemBorder' => 'TYPE',
+        'OptionDialogBorder' => 'TYPE',
+        'PaletteBorder' => 'TYPE',
+        'PopupMenuBorder' => 'TYPE',
+        'ScrollPaneBorder' => 'TYPE',
+        'TableHeaderBorder' => 'TYPE',
+        'TextFieldBorder' => 'TYPE',
+        'ToolBarBorder' => 'TYPE',
+        'MetalButtonUI' => 'TYPE',
+        'MetalCheckBoxIcon' => 'TYPE',
+        'MetalCheckBoxUI' => 'TYPE',
+        'MetalComboBoxButton' => 'TYPE',
+        'MetalComboBoxEditor' => 'TYPE',
+        'MetalComboBoxIcon' => 'TYPE',
+        'MetalComboBoxUI' => 'TYPE',
+        'MetalDesktopIconUI' => 'TYPE',
+        'MetalFileChooserUI' => 'TYPE',
+        'MetalIconFactory' => 'TYPE',
+        'FileIcon16' => 'TYPE',
+        'FolderIcon16' => 'TYPE',
+        'PaletteCloseIcon' => 'TYPE',
+        'TreeControlIcon' => 'TYPE',
+        'TreeFolderIcon' => 'TYPE',
+        'TreeLeafIcon' => 'TYPE',
+        'MetalInternalFrameTitlePane' => 'TYPE',
+        'MetalInternalFrameUI' => 'TYPE',
+        'MetalLabelUI' => 'TYPE',
+        'MetalLookAndFeel' => 'TYPE',
+        'MetalPopupMenuSeparatorUI' => 'TYPE',
+        'MetalProgressBarUI' => 'TYPE',
+        'MetalRadioButtonUI' => 'TYPE',
+        'MetalRootPaneUI' => 'TYPE',
+        'MetalScrollBarUI' => 'TYPE',
+        'MetalScrollButton' => 'TYPE',
+        'MetalScrollPaneUI' => 'TYPE',
+        'MetalSeparatorUI' => 'TYPE',
+        'MetalSliderUI' => 'TYPE',
+        'MetalSplitPaneUI' => 'TYPE',
+        'MetalTabbedPaneUI' => 'TYPE',
+        'MetalTextFieldUI' => 'TYPE',
+        'MetalTheme' => 'TYPE',
+        'MetalToggleButtonUI' => 'TYPE',
+        'MetalToolBarUI' => 'TYPE',
+        'MetalToolTipUI' => 'TYPE',
+        'MetalTreeUI' => 'TYPE',
+        'Method' => 'TYPE',
+        'MethodDescriptor' => 'TYPE',
+        'MidiChannel' => 'TYPE',
+        'MidiDevice' => 'TYPE',
+        'MidiDeviceProvider' => 'TYPE',
+        'MidiEvent' => 'TYPE',
+        'MidiFileFormat' => 'TYPE',
+        'MidiFileReader' => 'TYPE',
+        'MidiFileWriter' => 'TYPE',
+        'MidiMessage' => 'TYPE',
+        'MidiSystem' => 'TYPE',
+        'MidiUnavailableException' => 'TYPE',
+        'MimeTypeParseException' => 'TYPE',
+        'MinimalHTMLWriter' => 'TYPE',
+        'MissingResourceException' => 'TYPE',
+        'Mixer' => 'TYPE',
+        'MixerProvider' => 'TYPE',
+        'ModificationItem' => 'TYPE',
+        'Modifier' => 'TYPE',
+        'MouseAdapter' => 'TYPE',
+        'MouseDragGestureRecognizer' => 'TYPE',
+        'MouseEvent' => 'TYPE',
+        'MouseInputAdapter' => 'TYPE',
+        'MouseInputListener' => 'TYPE',
+        'MouseListener' => 'TYPE',
+        'MouseMotionAdapter' => 'TYPE',
+        'MouseMotionListener' => 'TYPE',
+        'MouseWheelEvent' => 'TYPE',
+        'MouseWheelListener' => 'TYPE',
+        'MultiButtonUI' => 'TYPE',
+        'MultiColorChooserUI' => 'TYPE',
+        'MultiComboBoxUI' => 'TYPE',
+        'MultiDesktopIconUI' => 'TYPE',
+        'MultiDesktopPaneUI' => 'TYPE',
+        'MultiDoc' => 'TYPE',
+        'MultiDocPrintJob' => 'TYPE',
+        'MultiDocPrintService' => 'TYPE',
+        'MultiFileChooserUI' => 'TYPE',
+        'MultiInternalFrameUI' => 'TYPE',
+        'MultiLabelUI' => 'TYPE',
+        'MultiListUI' => 'TYPE',
+        'MultiLookAndFeel' => 'TYPE',
+        'MultiMenuBarUI' => 'TYPE',
+        'MultiMenuItemUI' => 'TYPE',
+        'MultiOptionPaneUI' => 'TYPE',
+        'MultiPanelUI' => 'TYPE',
+        'MultiPixelPackedSampleModel' => 'TYPE',
+        'MultiPopupMenuUI' => 'TYPE',
+        'MultiProgressBarUI' => 'TYPE',
+        'MultiRootPaneUI' => 'TYPE',
+        'MultiScrollBarUI' => 'TYPE',
+        'MultiScrollPaneUI' => 'TYPE',
+        'MultiSeparatorUI' => 'TYPE',
+        'MultiSliderUI' => 'TYPE',
+        'MultiSpinnerUI' => 'TYPE',
+        'MultiSplitPaneUI' => 'TYPE',
+        'MultiTabbedPaneUI' => 'TYPE',
+        'MultiTableHeaderUI' => 'TYPE',
+        'MultiTableUI' => 'TYPE',
+        'MultiTextUI' => 'TYPE',
+        'MultiToolBarUI' => 'TYPE',
+        'MultiToolTipUI' => 'TYPE',
+        'MultiTreeUI' => 'TYPE',
+        'MultiViewportUI' => 'TYPE',
+        'MulticastSocket' => 'TYPE',
+        'MultipleComponentProfileHelper' => 'TYPE',
+        'MultipleComponentProfileHolder' => 'TYPE',
+        'MultipleDocumentHandling' => 'TYPE',
+        'MultipleMaster' => 'TYPE',
+        'MutableAttributeSet' => 'TYPE',
+        'MutableComboBoxModel' => 'TYPE',
+        'MutableTreeNode' => 'TYPE',
+        'NO_IMPLEMENT' => 'TYPE',
+        'NO_MEMORY' => 'TYPE',
+        'NO_PERMISSION' => 'TYPE',
+        'NO_RESOURCES' => 'TYPE',
+        'NO_RESPONSE' => 'TYPE',
+        'NVList' => 'TYPE',
+        'NameAlreadyBoundException' => 'TYPE',
+        'NameCallback' => 'TYPE',
+        'NameClassPair' => 'TYPE',
+        'NameComponent' => 'TYPE',
+        'NameComponentHelper' => 'TYPE',
+        'NameComponentHolder' => 'TYPE',
+        'NameDynAnyPair' => 'TYPE',
+        'NameDynAnyPairHelper' => 'TYPE',
+        'NameDynAnyPairSeqHelper' => 'TYPE',
+        'NameHelper' => 'TYPE',
+        'NameHolder' => 'TYPE',
+        'NameNotFoundException' => 'TYPE',
+        'NameParser' => 'TYPE',
+        'NameValuePair' => 'TYPE',
+        'NameValuePairHelper' => 'TYPE',
+        'NameValuePairSeqHelper' => 'TYPE',
+        'NamedNodeMap' => 'TYPE',
+        'NamedValue' => 'TYPE',
+        'NamespaceChangeListener' => 'TYPE',
+        'NamespaceSupport' => 'TYPE',
+        'Naming' => 'TYPE',
+        'NamingContext' => 'TYPE',
+        'NamingContextExt' => 'TYPE',
+        'NamingContextExtHelper' => 'TYPE',
+        'NamingContextExtHolder' => 'TYPE',
+        'NamingContextExtOperations' => 'TYPE',
+        'NamingContextExtPOA' => 'TYPE',
+        'NamingContextHelper' => 'TYPE',
+        'NamingContextHolder' => 'TYPE',
+        'NamingContextOperations' => 'TYPE',
+        'NamingContextPOA' => 'TYPE',
+        'NamingEnumeration' => 'TYPE',
+        'NamingEvent' => 'TYPE',
+        'NamingException' => 'TYPE',
+        'NamingExceptionEvent' => 'TYPE',
+        'NamingListener' => 'TYPE',
+        'NamingManager' => 'TYPE',
+        'NamingSecurityException' => 'TYPE',
+        'NavigationFilter' => 'TYPE',
+        'NegativeArraySizeException' => 'TYPE',
+        'NetPermission' => 'TYPE',
+        'NetworkInterface' => 'TYPE',
+        'NoClassDefFoundError' => 'TYPE',
+        'NoConnectionPendingException' => 'TYPE',
+        'NoContext' => 'TYPE',
+        'NoContextHelper' => 'TYPE',
+        'NoInitialContextException' => 'TYPE',
+        'NoPermissionException' => 'TYPE',
+        'NoRouteToHostException' => 'TYPE',
+        'NoServant' => 'TYPE',
+        'NoServantHelper' => 'TYPE',
+        'NoSuchAlgorithmException' => 'TYPE',
+        'NoSuchAttributeException' => 'TYPE',
+        'NoSuchElementException' => 'TYPE',
+        'NoSuchFieldError' => 'TYPE',
+        'NoSuchFieldException' => 'TYPE',
+        'NoSuchMethodError' => 'TYPE',
+        'NoSuchMethodException' => 'TYPE',
+        'NoSuchObjectException' => 'TYPE',
+        'NoSuchPaddingException' => 'TYPE',
+        'NoSuchProviderException' => 'TYPE',
+        'Node' => 'TYPE',
+        'NodeChangeEvent' => 'TYPE',
+        'NodeChangeListener' => 'TYPE',
+        'NodeList' => 'TYPE',
+        'NonReadableChannelException' => 'TYPE',
+        'NonWritableChannelException' => 'TYPE',
+        'NoninvertibleTransformException' => 'TYPE',
+        'NotActiveException' => 'TYPE',
+        'NotBoundException' => 'TYPE',
+        'NotContextException' => 'TYPE',
+        'NotEmpty' => 'TYPE',
+        'NotEmptyHelper' => 'TYPE',
+        'NotEmptyHolder' => 'TYPE',
+        'NotFound' => 'TYPE',
+        'NotFoundHelper' => 'TYPE',
+        'NotFoundHolder' => 'TYPE',
+        'NotFoundReason' => 'TYPE',
+        'NotFoundReasonHelper' => 'TYPE',
+        'NotFoundReasonHolder' => 'TYPE',
+        'NotOwnerException' => 'TYPE',
+        'NotSerializableException' => 'TYPE',
+        'NotYetBoundException' => 'TYPE',
+        'NotYetConnectedException' => 'TYPE',
+        'Notation' => 'TYPE',
+        'NullCipher' => 'TYPE',
+        'NullPointerException' => 'TYPE',
+        'Number' => 'TYPE',
+        'NumberFormat' => 'TYPE',
+        'NumberFormatException' => 'TYPE',
+        'NumberFormatter' => 'TYPE',
+        'NumberOfDocuments' => 'TYPE',
+        'NumberOfInterveningJobs' => 'TYPE',
+        'NumberUp' => 'TYPE',
+        'NumberUpSupported' => 'TYPE',
+        'NumericShaper' => 'TYPE',
+        'OBJECT_NOT_EXIST' => 'TYPE',
+        'OBJ_ADAPTER' => 'TYPE',
+        'OMGVMCID' => 'TYPE',
+        'ORB' => 'TYPE',
+        'ORBInitInfo' => 'TYPE',
+        'ORBInitInfoOperations' => 'TYPE',
+        'ORBInitializer' => 'TYPE',
+        'ORBInitializerOperations' => 'TYPE',
+        'ObjID' => 'TYPE',
+        'Object' => 'TYPE',
+        'ObjectAlreadyActive' => 'TYPE',
+        'ObjectAlreadyActiveHelper' => 'TYPE',
+        'ObjectChangeListener' => 'TYPE',
+        'ObjectFactory' => 'TYPE',
+        'ObjectFactoryBuilder' => 'TYPE',
+        'ObjectHelper' => 'TYPE',
+        'ObjectHolder' => 'TYPE',
+        'ObjectIdHelper' => 'TYPE',
+        'ObjectImpl' => 'TYPE',
+        'ObjectInput' => 'TYPE',
+        'ObjectInputStream' => 'TYPE',
+        'GetField' => 'TYPE',
+        'ObjectInputValidation' => 'TYPE',
+        'ObjectNotActive' => 'TYPE',
+        'ObjectNotActiveHelper' => 'TYPE',
+        'ObjectOutput' => 'TYPE',
+        'ObjectOutputStream' => 'TYPE',
+        'PutField' => 'TYPE',
+        'ObjectStreamClass' => 'TYPE',
+        'ObjectStreamConstants' => 'TYPE',
+        'ObjectStreamException' => 'TYPE',
+        'ObjectStreamField' => 'TYPE',
+        'ObjectView' => 'TYPE',
+        'Observable' => 'TYPE',
+        'Observer' => 'TYPE',
+        'OctetSeqHelper' => 'TYPE',
+        'OctetSeqHolder' => 'TYPE',
+        'Oid' => 'TYPE',
+        'OpenType' => 'TYPE',
+        'Operation' => 'TYPE',
+        'OperationNotSupportedException' => 'TYPE',
+        'Option' => 'TYPE',
+        'OptionPaneUI' => 'TYPE',
+        'OptionalDataException' => 'TYPE',
+        'OrientationRequested' => 'TYPE',
+        'OutOfMemoryError' => 'TYPE',
+        'OutputDeviceAssigned' => 'TYPE',
+        'OutputKeys' => 'TYPE',
+        'OutputStream' => 'TYPE',
+        'OutputStreamWriter' => 'TYPE',
+        'OverlappingFileLockException' => 'TYPE',
+        'OverlayLayout' => 'TYPE',
+        'Owner' => 'TYPE',
+        'PBEKey' => 'TYPE',
+        'PBEKeySpec' => 'TYPE',
+        'PBEParameterSpec' => 'TYPE',
+        'PDLOverrideSupported' => 'TYPE',
+        'PERSIST_STORE' => 'TYPE',
+        'PKCS8EncodedKeySpec' => 'TYPE',
+        'PKIXBuilderParameters' => 'TYPE',
+        'PKIXCertPathBuilderResult' => 'TYPE',
+        'PKIXCertPathChecker' => 'TYPE',
+        'PKIXCertPathValidatorResult' => 'TYPE',
+        'PKIXParameters' => 'TYPE',
+        'POA' => 'TYPE',
+        'POAHelper' => 'TYPE',
+        'POAManager' => 'TYPE',
+        'POAManagerOperations' => 'TYPE',
+        'POAOperations' => 'TYPE',
+        'PRIVATE_MEMBER' => 'TYPE',
+        'PSSParameterSpec' => 'TYPE',
+        'PUBLIC_MEMBER' => 'TYPE',
+        'Package' => 'TYPE',
+        'PackedColorModel' => 'TYPE',
+        'PageAttributes' => 'TYPE',
+        'ColorType' => 'TYPE',
+        'MediaType' => 'TYPE',
+        'OrientationRequestedType' => 'TYPE',
+        'OriginType' => 'TYPE',
+        'PrintQualityType' => 'TYPE',
+        'PageFormat' => 'TYPE',
+        'PageRanges' => 'TYPE',
+        'Pageable' => 'TYPE',
+        'PagesPerMinute' => 'TYPE',
+        'PagesPerMinuteColor' => 'TYPE',
+        'Paint' => 'TYPE',
+        'PaintContext' => 'TYPE',
+        'PaintEvent' => 'TYPE',
+        'Panel' => 'TYPE',
+        'PanelUI' => 'TYPE',
+        'Paper' => 'TYPE',
+        'ParagraphView' => 'TYPE',
+        'Parameter' => 'TYPE',
+        'ParameterBlock' => 'TYPE',
+        'ParameterDescriptor' => 'TYPE',
+        'ParameterMetaData' => 'TYPE',
+        'ParameterMode' => 'TYPE',
+        'ParameterModeHelper' => 'TYPE',
+        'ParameterModeHolder' => 'TYPE',
+        'ParseException' => 'TYPE',
+        'ParsePosition' => 'TYPE',
+        'ParserAdapter' => 'TYPE',
+        'ParserConfigurationException' => 'TYPE',
+        'ParserDelegator' => 'TYPE',
+        'ParserFactory' => 'TYPE',
+        'PartialResultException' => 'TYPE',
+        'PasswordAuthentication' => 'TYPE',
+        'PasswordCallback' => 'TYPE',
+        'PasswordView' => 'TYPE',
+        'Patch' => 'TYPE',
+        'PathIterator' => 'TYPE',
+        'Pattern' => 'TYPE',
+        'PatternSyntaxException' => 'TYPE',
+        'Permission' => 'TYPE',
+        'PermissionCollection' => 'TYPE',
+        'Permissions' => 'TYPE',
+        'PersistenceDelegate' => 'TYPE',
+        'PhantomReference' => 'TYPE',
+        'Pipe' => 'TYPE',
+        'SinkChannel' => 'TYPE',
+        'SourceChannel' => 'TYPE',
+        'PipedInputStream' => 'TYPE',
+        'PipedOutputStream' => 'TYPE',
+        'PipedReader' => 'TYPE',
+        'PipedWriter' => 'TYPE',
+        'PixelGrabber' => 'TYPE',
+        'PixelInterleavedSampleModel' => 'TYPE',
+        'PlainDocument' => 'TYPE',
+        'PlainView' => 'TYPE',
+        'Point' => 'TYPE',
+        'Point2D' => 'TYPE',
+        'Policy' => 'TYPE',
+        'PolicyError' => 'TYPE',
+        'PolicyErrorCodeHelper' => 'TYPE',
+        'PolicyErrorHelper' => 'TYPE',
+        'PolicyErrorHolder' => 'TYPE',
+        'PolicyFactory' => 'TYPE',
+        'PolicyFactoryOperations' => 'TYPE',
+        'PolicyHelper' => 'TYPE',
+        'PolicyHolder' => 'TYPE',
+        'PolicyListHelper' => 'TYPE',
+        'PolicyListHolder' => 'TYPE',
+        'PolicyNode' => 'TYPE',
+        'PolicyOperations' => 'TYPE',
+        'PolicyQualifierInfo' => 'TYPE',
+        'PolicyTypeHelper' => 'TYPE',
+        'Polygon' => 'TYPE',
+        'PooledConnection' => 'TYPE',
+        'Popup' => 'TYPE',
+        'PopupFactory' => 'TYPE',
+        'PopupMenu' => 'TYPE',
+        'PopupMenuEvent' => 'TYPE',
+        'PopupMenuListener' => 'TYPE',
+        'PopupMenuUI' => 'TYPE',
+        'Port' => 'TYPE',
+        'PortUnreachableException' => 'TYPE',
+        'PortableRemoteObject' => 'TYPE',
+        'PortableRemoteObjectDelegate' => 'TYPE',
+        'Position' => 'TYPE',
+        'Bias' => 'TYPE',
+        'PreferenceChangeEvent' => 'TYPE',
+        'PreferenceChangeListener' => 'TYPE',
+        'Preferences' => 'TYPE',
+        'PreferencesFactory' => 'TYPE',
+        'PreparedStatement' => 'TYPE',
+        'PresentationDirection' => 'TYPE',
+        'Principal' => 'TYPE',
+        'PrincipalHolder' => 'TYPE',
+        'PrintEvent' => 'TYPE',
+        'PrintException' => 'TYPE',
+        'PrintGraphics' => 'TYPE',
+        'PrintJob' => 'TYPE',
+        'PrintJobAdapter' => 'TYPE',
+        'PrintJobAttribute' => 'TYPE',
+        'PrintJobAttributeEvent' => 'TYPE',
+        'PrintJobAttributeListener' => 'TYPE',
+        'PrintJobAttributeSet' => 'TYPE',
+        'PrintJobEvent' => 'TYPE',
+        'PrintJobListener' => 'TYPE',
+        'PrintQuality' => 'TYPE',
+        'PrintRequestAttribute' => 'TYPE',
+        'PrintRequestAttributeSet' => 'TYPE',
+        'PrintService' => 'TYPE',
+        'PrintServiceAttribute' => 'TYPE',
+        'PrintServiceAttributeEvent' => 'TYPE',
+        'PrintServiceAttributeListener' => 'TYPE',
+        'PrintServiceAttributeSet' => 'TYPE',
+        'PrintServiceLookup' => 'TYPE',
+        'PrintStream' => 'TYPE',
+        'PrintWriter' => 'TYPE',
+        'Printable' => 'TYPE',
+        'PrinterAbortException' => 'TYPE',
+        'PrinterException' => 'TYPE',
+        'PrinterGraphics' => 'TYPE',
+        'PrinterIOException' => 'TYPE',
+        'PrinterInfo' => 'TYPE',
+        'PrinterIsAcceptingJobs' => 'TYPE',
+        'PrinterJob' => 'TYPE',
+        'PrinterLocation' => 'TYPE',
+        'PrinterMakeAndModel' => 'TYPE',
+        'PrinterMessageFromOperator' => 'TYPE',
+        'PrinterMoreInfo' => 'TYPE',
+        'PrinterMoreInfoManufacturer' => 'TYPE',
+        'PrinterName' => 'TYPE',
+        'PrinterResolution' => 'TYPE',
+        'PrinterState' => 'TYPE',
+        'PrinterStateReason' => 'TYPE',
+        'PrinterStateReasons' => 'TYPE',
+        'PrinterURI' => 'TYPE',
+        'PrivateCredentialPermission' => 'TYPE',
+        'PrivateKey' => 'TYPE',
+        'PrivilegedAction' => 'TYPE',
+        'PrivilegedActionException' => 'TYPE',
+        'PrivilegedExceptionAction' => 'TYPE',
+        'Process' => 'TYPE',
+        'ProcessingInstruction' => 'TYPE',
+        'ProfileDataException' => 'TYPE',
+        'ProfileIdHelper' => 'TYPE',
+        'ProgressBarUI' => 'TYPE',
+        'ProgressMonitor' => 'TYPE',
+        'ProgressMonitorInputStream' => 'TYPE',
+        'Properties' => 'TYPE',
+        'PropertyChangeEvent' => 'TYPE',
+        'PropertyChangeListener' => 'TYPE',
+        'PropertyChangeListenerProxy' => 'TYPE',
+        'PropertyChangeSupport' => 'TYPE',
+        'PropertyDescriptor' => 'TYPE',
+        'PropertyEditor' => 'TYPE',
+        'PropertyEditorManager' => 'TYPE',
+        'PropertyEditorSupport' => 'TYPE',
+        'PropertyPermission' => 'TYPE',
+        'PropertyResourceBundle' => 'TYPE',
+        'PropertyVetoException' => 'TYPE',
+        'ProtectionDomain' => 'TYPE',
+        'ProtocolException' => 'TYPE',
+        'Provider' => 'TYPE',
+        'ProviderException' => 'TYPE',
+        'Proxy' => 'TYPE',
+        'PublicKey' => 'TYPE',
+        'PushbackInputStream' => 'TYPE',
+        'PushbackReader' => 'TYPE',
+        'QuadCurve2D' => 'TYPE',
+        'QueuedJobCount' => 'TYPE',
+        'RC2ParameterSpec' => 'TYPE',
+        'RC5ParameterSpec' => 'TYPE',
+        'REQUEST_PROCESSING_POLICY_ID' => 'TYPE',
+        'RGBImageFilter' => 'TYPE',
+        'RMIClassLoader' => 'TYPE',
+        'RMIClassLoaderSpi' => 'TYPE',
+        'RMIClientSocketFactory' => 'TYPE',
+        'RMIFailureHandler' => 'TYPE',
+        'RMISecurityException' => 'TYPE',
+        'RMISecurityManager' => 'TYPE',
+        'RMIServerSocketFactory' => 'TYPE',
+        'RMISocketFactory' => 'TYPE',
+        'RSAKey' => 'TYPE',
+        'RSAKeyGenParameterSpec' => 'TYPE',
+        'RSAMultiPrimePrivateCrtKey' => 'TYPE',
+        'RSAMultiPrimePrivateCrtKeySpec' => 'TYPE',
+        'RSAOtherPrimeInfo' => 'TYPE',
+        'RSAPrivateCrtKey' => 'TYPE',
+        'RSAPrivateCrtKeySpec' => 'TYPE',
+        'RSAPrivateKey' => 'TYPE',
+        'RSAPrivateKeySpec' => 'TYPE',
+        'RSAPublicKey' => 'TYPE',
+        'RSAPublicKeySpec' => 'TYPE',
+        'RTFEditorKit' => 'TYPE',
+        'Random' => 'TYPE',
+        'RandomAccess' => 'TYPE',
+        'RandomAccessFile' => 'TYPE',
+        'Raster' => 'TYPE',
+        'RasterFormatException' => 'TYPE',
+        'RasterOp' => 'TYPE',
+        'ReadOnlyBufferException' => 'TYPE',
+        'ReadableByteChannel' => 'TYPE',
+        'Reader' => 'TYPE',
+        'Receiver' => 'TYPE',
+        'Rectangle' => 'TYPE',
+        'Rectangle2D' => 'TYPE',
+        'RectangularShape' => 'TYPE',
+        'Ref' => 'TYPE',
+        'RefAddr' => 'TYPE',
+        'Reference' => 'TYPE',
+        'ReferenceQueue' => 'TYPE',
+        'ReferenceUriSchemesSupported' => 'TYPE',
+        'Referenceable' => 'TYPE',
+        'ReferralException' => 'TYPE',
+        'ReflectPermission' => 'TYPE',
+        'RefreshFailedException' => 'TYPE',
+        'Refreshable' => 'TYPE',
+        'RegisterableService' => 'TYPE',
+        'Registry' => 'TYPE',
+        'RegistryHandler' => 'TYPE',
+        'RemarshalException' => 'TYPE',
+        'Remote' => 'TYPE',
+        'RemoteCall' => 'TYPE',
+        'RemoteException' => 'TYPE',
+        'RemoteObject' => 'TYPE',
+        'RemoteRef' => 'TYPE',
+        'RemoteServer' => 'TYPE',
+        'RemoteStub' => 'TYPE',
+        'RenderContext' => 'TYPE',
+        'RenderableImage' => 'TYPE',
+        'RenderableImageOp' => 'TYPE',
+        'RenderableImageProducer' => 'TYPE',
+        'RenderedImage' => 'TYPE',
+        'RenderedImageFactory' => 'TYPE',
+        'Renderer' => 'TYPE',
+        'RenderingHints' => 'TYPE',
+        'RepaintManager' => 'TYPE',
+        'ReplicateScaleFilter' => 'TYPE',
+        'RepositoryIdHelper' => 'TYPE',
+        'Request' => 'TYPE',
+        'RequestInfo' => 'TYPE',
+        'RequestInfoOperations' => 'TYPE',
+        'RequestProcessingPolicy' => 'TYPE',
+        'RequestProcessingPolicyOperations' => 'TYPE',
+        'RequestProcessingPolicyValue' => 'TYPE',
+        'RequestingUserName' => 'TYPE',
+        'RescaleOp' => 'TYPE',
+        'ResolutionSyntax' => 'TYPE',
+        'ResolveResult' => 'TYPE',
+        'Resolver' => 'TYPE',
+        'ResourceBundle' => 'TYPE',
+        'ResponseHandler' => 'TYPE',
+        'ResultSet' => 'TYPE',
+        'ResultSetMetaData' => 'TYPE',
+        'ReverbType' => 'TYPE',
+        'Robot' => 'TYPE',
+        'RootPaneContainer' => 'TYPE',
+        'RootPaneUI' => 'TYPE',
+        'RoundRectangle2D' => 'TYPE',
+        'RowMapper' => 'TYPE',
+        'RowSet' => 'TYPE',
+        'RowSetEvent' => 'TYPE',
+        'RowSetInternal' => 'TYPE',
+        'RowSetListener' => 'TYPE',
+        'RowSetMetaData' => 'TYPE',
+        'RowSetReader' => 'TYPE',
+        'RowSetWriter' => 'TYPE',
+        'RuleBasedCollator' => 'TYPE',
+        'RunTime' => 'TYPE',
+        'RunTimeOperations' => 'TYPE',
+        'Runnable' => 'TYPE',
+        'Runtime' => 'TYPE',
+        'RuntimeException' => 'TYPE',
+        'RuntimePermission' => 'TYPE',
+        'SAXException' => 'TYPE',
+        'SAXNotRecognizedException' => 'TYPE',
+        'SAXNotSupportedException' => 'TYPE',
+        'SAXParseException' => 'TYPE',
+        'SAXParser' => 'TYPE',
+        'SAXParserFactory' => 'TYPE',
+        'SAXResult' => 'TYPE',
+        'SAXSource' => 'TYPE',
+        'SAXTransformerFactory' => 'TYPE',
+        'SERVANT_RETENTION_POLICY_ID' => 'TYPE',
+        'SQLData' => 'TYPE',
+        'SQLException' => 'TYPE',
+        'SQLInput' => 'TYPE',
+        'SQLOutput' => 'TYPE',
+        'SQLPermission' => 'TYPE',
+        'SQLWarning' => 'TYPE',
+        'SSLContext' => 'TYPE',
+        'SSLContextSpi' => 'TYPE',
+        'SSLException' => 'TYPE',
+        'SSLHandshakeException' => 'TYPE',
+        'SSLKeyException' => 'TYPE',
+        'SSLPeerUnverifiedException' => 'TYPE',
+        'SSLPermission' => 'TYPE',
+        'SSLProtocolException' => 'TYPE',
+        'SSLServerSocket' => 'TYPE',
+        'SSLServerSocketFactory' => 'TYPE',
+        'SSLSession' => 'TYPE',
+        'SSLSessionBindingEvent' => 'TYPE',
+        'SSLSessionBindingListener' => 'TYPE',
+        'SSLSessionContext' => 'TYPE',
+        'SSLSocket' => 'TYPE',
+        'SSLSocketFactory' => 'TYPE',
+        'SUCCESSFUL' => 'TYPE',
+        'SYNC_WITH_TRANSPORT' => 'TYPE',
+        'SYSTEM_EXCEPTION' => 'TYPE',
+        'SampleModel' => 'TYPE',
+        'Savepoint' => 'TYPE',
+        'ScatteringByteChannel' => 'TYPE',
+        'SchemaViolationException' => 'TYPE',
+        'ScrollBarUI' => 'TYPE',
+        'ScrollPane' => 'TYPE',
+        'ScrollPaneAdjustable' => 'TYPE',
+        'ScrollPaneConstants' => 'TYPE',
+        'ScrollPaneLayout' => 'TYPE',
+        'ScrollPaneUI' => 'TYPE',
+        'Scrollable' => 'TYPE',
+        'Scrollbar' => 'TYPE',
+        'SealedObject' => 'TYPE',
+        'SearchControls' => 'TYPE',
+        'SearchResult' => 'TYPE',
+        'SecretKey' => 'TYPE',
+        'SecretKeyFactory' => 'TYPE',
+        'SecretKeyFactorySpi' => 'TYPE',
+        'SecretKeySpec' => 'TYPE',
+        'SecureClassLoader' => 'TYPE',
+        'SecureRandom' => 'TYPE',
+        'SecureRandomSpi' => 'TYPE',
+        'Security' => 'TYPE',
+        'SecurityException' => 'TYPE',
+        'SecurityManager' => 'TYPE',
+        'SecurityPermission' => 'TYPE',
+        'Segment' => 'TYPE',
+        'SelectableChannel' => 'TYPE',
+        'SelectionKey' => 'TYPE',
+        'Selector' => 'TYPE',
+        'SelectorProvider' => 'TYPE',
+        'SeparatorUI' => 'TYPE',
+        'Sequence' => 'TYPE',
+        'SequenceInputStream' => 'TYPE',
+        'Sequencer' => 'TYPE',
+        'SyncMode' => 'TYPE',
+        'Serializable' => 'TYPE',
+        'SerializablePermission' => 'TYPE',
+        'Servant' => 'TYPE',
+        'ServantActivator' => 'TYPE',
+        'ServantActivatorHelper' => 'TYPE',
+        'ServantActivatorOperations' => 'TYPE',
+        'ServantActivatorPOA' => 'TYPE',
+        'ServantAlreadyActive' => 'TYPE',
+        'ServantAlreadyActiveHelper' => 'TYPE',
+        'ServantLocator' => 'TYPE',
+        'ServantLocatorHelper' => 'TYPE',
+        'ServantLocatorOperations' => 'TYPE',
+        'ServantLocatorPOA' => 'TYPE',
+        'ServantManager' => 'TYPE',
+        'ServantManagerOperations' => 'TYPE',
+        'ServantNotActive' => 'TYPE',
+        'ServantNotActiveHelper' => 'TYPE',
+        'ServantObject' => 'TYPE',
+        'ServantRetentionPolicy' => 'TYPE',
+        'ServantRetentionPolicyOperations' => 'TYPE',
+        'ServantRetentionPolicyValue' => 'TYPE',
+        'ServerCloneException' => 'TYPE',
+        'ServerError' => 'TYPE',
+        'ServerException' => 'TYPE',
+        'ServerNotActiveException' => 'TYPE',
+        'ServerRef' => 'TYPE',
+        'ServerRequest' => 'TYPE',
+        'ServerRequestInfo' => 'TYPE',
+        'ServerRequestInfoOperations' => 'TYPE',
+        'ServerRequestInterceptor' => 'TYPE',
+        'ServerRequestInterceptorOperations' => 'TYPE',
+        'ServerRuntimeException' => 'TYPE',
+        'ServerSocket' => 'TYPE',
+        'ServerSocketChannel' => 'TYPE',
+        'ServerSocketFactory' => 'TYPE',
+        'ServiceContext' => 'TYPE',
+        'ServiceContextHelper' => 'TYPE',
+        'ServiceContextHolder' => 'TYPE',
+        'ServiceContextListHelper' => 'TYPE',
+        'ServiceContextListHolder' => 'TYPE',
+        'ServiceDetail' => 'TYPE',
+        'ServiceDetailHelper' => 'TYPE',
+        'ServiceIdHelper' => 'TYPE',
+        'ServiceInformation' => 'TYPE',
+        'ServiceInformationHelper' => 'TYPE',
+        'ServiceInformationHolder' => 'TYPE',
+        'ServicePermission' => 'TYPE',
+        'ServiceRegistry' => 'TYPE',
+        'ServiceUI' => 'TYPE',
+        'ServiceUIFactory' => 'TYPE',
+        'ServiceUnavailableException' => 'TYPE',
+        'Set' => 'TYPE',
+        'SetOfIntegerSyntax' => 'TYPE',
+        'SetOverrideType' => 'TYPE',
+        'SetOverrideTypeHelper' => 'TYPE',
+        'Severity' => 'TYPE',
+        'Shape' => 'TYPE',
+        'ShapeGraphicAttribute' => 'TYPE',
+        'SheetCollate' => 'TYPE',
+        'Short' => 'TYPE',
+        'ShortBuffer' => 'TYPE',
+        'ShortBufferException' => 'TYPE',
+        'ShortHolder' => 'TYPE',
+        'ShortLookupTable' => 'TYPE',
+        'ShortMessage' => 'TYPE',
+        'ShortSeqHelper' => 'TYPE',
+        'ShortSeqHolder' => 'TYPE',
+        'Sides' => 'TYPE',
+        'Signature' => 'TYPE',
+        'SignatureException' => 'TYPE',
+        'SignatureSpi' => 'TYPE',
+        'SignedObject' => 'TYPE',
+        'Signer' => 'TYPE',
+        'SimpleAttributeSet' => 'TYPE',
+        'SimpleBeanInfo' => 'TYPE',
+        'SimpleDateFormat' => 'TYPE',
+        'SimpleDoc' => 'TYPE',
+        'SimpleFormatter' => 'TYPE',
+        'SimpleTimeZone' => 'TYPE',
+        'SinglePixelPackedSampleModel' => 'TYPE',
+        'SingleSelectionModel' => 'TYPE',
+        'Size2DSyntax' => 'TYPE',
+        'SizeLimitExceededException' => 'TYPE',
+        'SizeRequirements' => 'TYPE',
+        'SizeSequence' => 'TYPE',
+        'Skeleton' => 'TYPE',
+        'SkeletonMismatchException' => 'TYPE',
+        'SkeletonNotFoundException' => 'TYPE',
+        'SliderUI' => 'TYPE',
+        'Socket' => 'TYPE',
+        'SocketAddress' => 'TYPE',
+        'SocketChannel' => 'TYPE',
+        'SocketException' => 'TYPE',
+        'SocketFactory' => 'TYPE',
+        'SocketHandler' => 'TYPE',
+        'SocketImpl' => 'TYPE',
+        'SocketImplFactory' => 'TYPE',
+        'SocketOptions' => 'TYPE',
+        'SocketPermission' => 'TYPE',
+        'SocketSecurityException' => 'TYPE',
+        'SocketTimeoutException' => 'TYPE',
+        'SoftBevelBorder' => 'TYPE',
+        'SoftReference' => 'TYPE',
+        'SortedMap' => 'TYPE',
+        'SortedSet' => 'TYPE',
+        'SortingFocusTraversalPolicy' => 'TYPE',
+        'Soundbank' => 'TYPE',
+        'SoundbankReader' => 'TYPE',
+        'SoundbankResource' => 'TYPE',
+        'Source' => 'TYPE',
+        'SourceDataLine' => 'TYPE',
+        'SourceLocator' => 'TYPE',
+        'SpinnerDateModel' => 'TYPE',
+        'SpinnerListModel' => 'TYPE',
+        'SpinnerModel' => 'TYPE',
+        'SpinnerNumberModel' => 'TYPE',
+        'SpinnerUI' => 'TYPE',
+        'SplitPaneUI' => 'TYPE',
+        'Spring' => 'TYPE',
+        'SpringLayout' => 'TYPE',
+        'Constraints' => 'TYPE',
+        'Stack' => 'TYPE',
+        'StackOverflowError' => 'TYPE',
+        'StackTraceElement' => 'TYPE',
+        'StartTlsRequest' => 'TYPE',
+        'StartTlsResponse' => 'TYPE',
+        'State' => 'TYPE',
+        'StateEdit' => 'TYPE',
+        'StateEditable' => 'TYPE',
+        'StateFactory' => 'TYPE',
+        'Statement' => 'TYPE',
+        'StreamCorruptedException' => 'TYPE',
+        'StreamHandler' => 'TYPE',
+        'StreamPrintService' => 'TYPE',
+        'StreamPrintServiceFactory' => 'TYPE',
+        'StreamResult' => 'TYPE',
+        'StreamSource' => 'TYPE',
+        'StreamTokenizer' => 'TYPE',
+        'Streamable' => 'TYPE',
+        'StreamableValue' => 'TYPE',
+        'StrictMath' => 'TYPE',
+        'String' => 'TYPE',
+        'StringBuffer' => 'TYPE',
+        'StringBufferInputStream' => 'TYPE',
+        'StringCharacterIterator' => 'TYPE',
+        'StringContent' => 'TYPE',
+        'StringHolder' => 'TYPE',
+        'StringIndexOutOfBoundsException' => 'TYPE',
+        'StringNameHelper' => 'TYPE',
+        'StringReader' => 'TYPE',
+        'StringRefAddr' => 'TYPE',
+        'StringSelection' => 'TYPE',
+        'StringSeqHelper' => 'TYPE',
+        'StringSeqHolder' => 'TYPE',
+        'StringTokenizer' => 'TYPE',
+        'StringValueHelper' => 'TYPE',
+        'StringWriter' => 'TYPE',
+        'Stroke' => 'TYPE',
+        'Struct' => 'TYPE',
+        'StructMember' => 'TYPE',
+        'StructMemberHelper' => 'TYPE',
+        'Stub' => 'TYPE',
+        'StubDelegate' => 'TYPE',
+        'StubNotFoundException' => 'TYPE',
+        'Style' => 'TYPE',
+        'StyleConstants' => 'TYPE',
+        'CharacterConstants' => 'TYPE',
+        'ColorConstants' => 'TYPE',
+        'FontConstants' => 'TYPE',
+        'ParagraphConstants' => 'TYPE',
+        'StyleContext' => 'TYPE',
+        'StyleSheet' => 'TYPE',
+        'BoxPainter' => 'TYPE',
+        'ListPainter' => 'TYPE',
+        'StyledDocument' => 'TYPE',
+        'StyledEditorKit' => 'TYPE',
+        'AlignmentAction' => 'TYPE',
+        'BoldAction' => 'TYPE',
+        'FontFamilyAction' => 'TYPE',
+        'FontSizeAction' => 'TYPE',
+        'ForegroundAction' => 'TYPE',
+        'ItalicAction' => 'TYPE',
+        'StyledTextAction' => 'TYPE',
+        'UnderlineAction' => 'TYPE',
+        'Subject' => 'TYPE',
+        'SubjectDomainCombiner' => 'TYPE',
+        'SupportedValuesAttribute' => 'TYPE',
+        'SwingConstants' => 'TYPE',
+        'SwingPropertyChangeSupport' => 'TYPE',
+        'SwingUtilities' => 'TYPE',
+        'SyncFailedException' => 'TYPE',
+        'SyncScopeHelper' => 'TYPE',
+        'Synthesizer' => 'TYPE',
+        'SysexMessage' => 'TYPE',
+        'System' => 'TYPE',
+        'SystemColor' => 'TYPE',
+        'SystemException' => 'TYPE',
+        'SystemFlavorMap' => 'TYPE',
+        'TAG_ALTERNATE_IIOP_ADDRESS' => 'TYPE',
+        'TAG_CODE_SETS' => 'TYPE',
+        'TAG_INTERNET_IOP' => 'TYPE',
+        'TAG_JAVA_CODEBASE' => 'TYPE',
+        'TAG_MULTIPLE_COMPONENTS' => 'TYPE',
+        'TAG_ORB_TYPE' => 'TYPE',
+        'TAG_POLICIES' => 'TYPE',
+        'TCKind' => 'TYPE',
+        'THREAD_POLICY_ID' => 'TYPE',
+        'TRANSACTION_REQUIRED' => 'TYPE',
+        'TRANSACTION_ROLLEDBACK' => 'TYPE',
+        'TRANSIENT' => 'TYPE',
+        'TRANSPORT_RETRY' => 'TYPE',
+        'TabExpander' => 'TYPE',
+        'TabSet' => 'TYPE',
+        'TabStop' => 'TYPE',
+        'TabableView' => 'TYPE',
+        'TabbedPaneUI' => 'TYPE',
+        'TableCellEditor' => 'TYPE',
+        'TableCellRenderer' => 'TYPE',
+        'TableColumn' => 'TYPE',
+        'TableColumnModel' => 'TYPE',
+        'TableColumnModelEvent' => 'TYPE',
+        'TableColumnModelListener' => 'TYPE',
+        'TableHeaderUI' => 'TYPE',
+        'TableModel' => 'TYPE',
+        'TableModelEvent' => 'TYPE',
+        'TableModelListener' => 'TYPE',
+        'TableUI' => 'TYPE',
+        'TableView' => 'TYPE',
+        'TagElement' => 'TYPE',
+        'TaggedComponent' => 'TYPE',
+        'TaggedComponentHelper' => 'TYPE',
+        'TaggedComponentHolder' => 'TYPE',
+        'TaggedProfile' => 'TYPE',
+        'TaggedProfileHelper' => 'TYPE',
+        'TaggedProfileHolder' => 'TYPE',
+        'TargetDataLine' => 'TYPE',
+        'Templates' => 'TYPE',
+        'TemplatesHandler' => 'TYPE',
+        'Text' => 'TYPE',
+        'TextAction' => 'TYPE',
+        'TextArea' => 'TYPE',
+        'TextAttribute' => 'TYPE',
+        'TextComponent' => 'TYPE',
+        'TextEvent' => 'TYPE',
+        'TextField' => 'TYPE',
+        'TextHitInfo' => 'TYPE',
+        'TextInputCallback' => 'TYPE',
+        'TextLayout' => 'TYPE',
+        'CaretPolicy' => 'TYPE',
+        'TextListener' => 'TYPE',
+        'TextMeasurer' => 'TYPE',
+        'TextOutputCallback' => 'TYPE',
+        'TextSyntax' => 'TYPE',
+        'TextUI' => 'TYPE',
+        'TexturePaint' => 'TYPE',
+        'Thread' => 'TYPE',
+        'ThreadDeath' => 'TYPE',
+        'ThreadGroup' => 'TYPE',
+        'ThreadLocal' => 'TYPE',
+        'ThreadPolicy' => 'TYPE',
+        'ThreadPolicyOperations' => 'TYPE',
+        'ThreadPolicyValue' => 'TYPE',
+        'Throwable' => 'TYPE',
+        'Tie' => 'TYPE',
+        'TileObserver' => 'TYPE',
+        'Time' => 'TYPE',
+        'TimeLimitExceededException' => 'TYPE',
+        'TimeZone' => 'TYPE',
+        'Timer' => 'TYPE',
+        'TimerTask' => 'TYPE',
+        'Timestamp' => 'TYPE',
+        'TitledBorder' => 'TYPE',
+        'TooManyListenersException' => 'TYPE',
+        'ToolBarUI' => 'TYPE',
+        'ToolTipManager' => 'TYPE',
+        'ToolTipUI' => 'TYPE',
+        'Toolkit' => 'TYPE',
+        'Track' => 'TYPE',
+        'TransactionRequiredException' => 'TYPE',
+        'TransactionRolledbackException' => 'TYPE',
+        'TransactionService' => 'TYPE',
+        'TransferHandler' => 'TYPE',
+        'Transferable' => 'TYPE',
+        'TransformAttribute' => 'TYPE',
+        'Transformer' => 'TYPE',
+        'TransformerConfigurationException' => 'TYPE',
+        'TransformerException' => 'TYPE',
+        'TransformerFactory' => 'TYPE',
+        'TransformerFactoryConfigurationError' => 'TYPE',
+        'TransformerHandler' => 'TYPE',
+        'Transmitter' => 'TYPE',
+        'Transparency' => 'TYPE',
+        'TreeCellEditor' => 'TYPE',
+        'TreeCellRenderer' => 'TYPE',
+        'TreeExpansionEvent' => 'TYPE',
+        'TreeExpansionListener' => 'TYPE',
+        'TreeMap' => 'TYPE',
+        'TreeModel' => 'TYPE',
+        'TreeModelEvent' => 'TYPE',
+        'TreeModelListener' => 'TYPE',
+        'TreeNode' => 'TYPE',
+        'TreePath' => 'TYPE',
+        'TreeSelectionEvent' => 'TYPE',
+        'TreeSelectionListener' => 'TYPE',
+        'TreeSelectionModel' => 'TYPE',
+        'TreeSet' => 'TYPE',
+        'TreeUI' => 'TYPE',
+        'TreeWillExpandListener' => 'TYPE',
+        'TrustAnchor' => 'TYPE',
+        'TrustManager' => 'TYPE',
+        'TrustManagerFactory' => 'TYPE',
+        'TrustManagerFactorySpi' => 'TYPE',
+        'TypeCode' => 'TYPE',
+        'TypeCodeHolder' => 'TYPE',
+        'TypeMismatch' => 'TYPE',
+        'TypeMismatchHelper' => 'TYPE',
+        'Types' => 'TYPE',
+        'UID' => 'TYPE',
+        'UIDefaults' => 'TYPE',
+        'ActiveValue' => 'TYPE',
+        'LazyInputMap' => 'TYPE',
+        'LazyValue' => 'TYPE',
+        'ProxyLazyValue' => 'TYPE',
+        'UIManager' => 'TYPE',
+        'LookAndFeelInfo' => 'TYPE',
+        'ULongLongSeqHelper' => 'TYPE',
+        'ULongLongSeqHolder' => 'TYPE',
+        'ULongSeqHelper' => 'TYPE',
+        'ULongSeqHolder' => 'TYPE',
+        'UNKNOWN' => 'TYPE',
+        'UNSUPPORTED_POLICY' => 'TYPE',
+        'UNSUPPORTED_POLICY_VALUE' => 'TYPE',
+        'URI' => 'TYPE',
+        'URIException' => 'TYPE',
+        'URIResolver' => 'TYPE',
+        'URISyntax' => 'TYPE',
+        'URISyntaxException' => 'TYPE',
+        'URLClassLoader' => 'TYPE',
+        'URLConnection' => 'TYPE',
+        'URLDecoder' => 'TYPE',
+        'URLEncoder' => 'TYPE',
+        'URLStreamHandler' => 'TYPE',
+        'URLStreamHandlerFactory' => 'TYPE',
+        'URLStringHelper' => 'TYPE',
+        'USER_EXCEPTION' => 'TYPE',
+        'UShortSeqHelper' => 'TYPE',
+        'UShortSeqHolder' => 'TYPE',
+        'UTFDataFormatException' => 'TYPE',
+        'UndeclaredThrowableException' => 'TYPE',
+        'UndoManager' => 'TYPE',
+        'UndoableEdit' => 'TYPE',
+        'UndoableEditEvent' => 'TYPE',
+        'UndoableEditListener' => 'TYPE',
+        'UndoableEditSupport' => 'TYPE',
+        'UnexpectedException' => 'TYPE',
+        'UnicastRemoteObject' => 'TYPE',
+        'UnionMember' => 'TYPE',
+        'UnionMemberHelper' => 'TYPE',
+        'UnknownEncoding' => 'TYPE',
+        'UnknownEncodingHelper' => 'TYPE',
+        'UnknownError' => 'TYPE',
+        'UnknownException' => 'TYPE',
+        'UnknownGroupException' => 'TYPE',
+        'UnknownHostException' => 'TYPE',
+        'UnknownObjectException' => 'TYPE',
+        'UnknownServiceException' => 'TYPE',
+        'UnknownUserException' => 'TYPE',
+        'UnknownUserExceptionHelper' => 'TYPE',
+        'UnknownUserExceptionHolder' => 'TYPE',
+        'UnmappableCharacterException' => 'TYPE',
+        'UnmarshalException' => 'TYPE',
+        'UnmodifiableSetException' => 'TYPE',
+        'UnrecoverableKeyException' => 'TYPE',
+        'Unreferenced' => 'TYPE',
+        'UnresolvedAddressException' => 'TYPE',
+        'UnresolvedPermission' => 'TYPE',
+        'UnsatisfiedLinkError' => 'TYPE',
+        'UnsolicitedNotification' => 'TYPE',
+        'UnsolicitedNotificationEvent' => 'TYPE',
+        'UnsolicitedNotificationListener' => 'TYPE',
+        'UnsupportedAddressTypeException' => 'TYPE',
+        'UnsupportedAudioFileException' => 'TYPE',
+        'UnsupportedCallbackException' => 'TYPE',
+        'UnsupportedCharsetException' => 'TYPE',
+        'UnsupportedClassVersionError' => 'TYPE',
+        'UnsupportedEncodingException' => 'TYPE',
+        'UnsupportedFlavorException' => 'TYPE',
+        'UnsupportedLookAndFeelException' => 'TYPE',
+        'UnsupportedOperationException' => 'TYPE',
+        'UserException' => 'TYPE',
+        'Util' => 'TYPE',
+        'UtilDelegate' => 'TYPE',
+        'Utilities' => 'TYPE',
+        'VMID' => 'TYPE',
+        'VM_ABSTRACT' => 'TYPE',
+        'VM_CUSTOM' => 'TYPE',
+        'VM_NONE' => 'TYPE',
+        'VM_TRUNCATABLE' => 'TYPE',
+        'ValueBase' => 'TYPE',
+        'ValueBaseHelper' => 'TYPE',
+        'ValueBaseHolder' => 'TYPE',
+        'ValueFactory' => 'TYPE',
+        'ValueHandler' => 'TYPE',
+        'ValueMember' => 'TYPE',
+        'ValueMemberHelper' => 'TYPE',
+        'VariableHeightLayoutCache' => 'TYPE',
+        'Vector' => 'TYPE',
+        'VerifyError' => 'TYPE',
+        'VersionSpecHelper' => 'TYPE',
+        'VetoableChangeListener' => 'TYPE',
+        'VetoableChangeListenerProxy' => 'TYPE',
+        'VetoableChangeSupport' => 'TYPE',
+        'View' => 'TYPE',
+        'ViewFactory' => 'TYPE',
+        'ViewportLayout' => 'TYPE',
+        'ViewportUI' => 'TYPE',
+        'VirtualMachineError' => 'TYPE',
+        'Visibility' => 'TYPE',
+        'VisibilityHelper' => 'TYPE',
+        'VoiceStatus' => 'TYPE',
+        'Void' => 'TYPE',
+        'VolatileImage' => 'TYPE',
+        'WCharSeqHelper' => 'TYPE',
+        'WCharSeqHolder' => 'TYPE',
+        'WStringSeqHelper' => 'TYPE',
+        'WStringSeqHolder' => 'TYPE',
+        'WStringValueHelper' => 'TYPE',
+        'WeakHashMap' => 'TYPE',
+        'WeakReference' => 'TYPE',
+        'Window' => 'TYPE',
+        'WindowAdapter' => 'TYPE',
+        'WindowConstants' => 'TYPE',
+        'WindowEvent' => 'TYPE',
+        'WindowFocusListener' => 'TYPE',
+        'WindowListener' => 'TYPE',
+        'WindowStateListener' => 'TYPE',
+        'WrappedPlainView' => 'TYPE',
+        'WritableByteChannel' => 'TYPE',
+        'WritableRaster' => 'TYPE',
+        'WritableRenderedImage' => 'TYPE',
+        'WriteAbortedException' => 'TYPE',
+        'Writer' => 'TYPE',
+        'WrongAdapter' => 'TYPE',
+        'WrongAdapterHelper' => 'TYPE',
+        'WrongPolicy' => 'TYPE',
+        'WrongPolicyHelper' => 'TYPE',
+        'WrongTransaction' => 'TYPE',
+        'WrongTransactionHelper' => 'TYPE',
+        'WrongTransactionHolder' => 'TYPE',
+        'X500Principal' => 'TYPE',
+        'X500PrivateCredential' => 'TYPE',
+        'X509CRL' => 'TYPE',
+        'X509CRLEntry' => 'TYPE',
+        'X509CRLSelector' => 'TYPE',
+        'X509CertSelector' => 'TYPE',
+        'X509Certificate' => 'TYPE',
+        'X509EncodedKeySpec' => 'TYPE',
+        'X509Extension' => 'TYPE',
+        'X509KeyManager' => 'TYPE',
+        'X509TrustManager' => 'TYPE',
+        'XAConnection' => 'TYPE',
+        'XADataSource' => 'TYPE',
+        'XAException' => 'TYPE',
+        'XAResource' => 'TYPE',
+        'XMLDecoder' => 'TYPE',
+        'XMLEncoder' => 'TYPE',
+        'XMLFilter' => 'TYPE',
+        'XMLFilterImpl' => 'TYPE',
+        'XMLFormatter' => 'TYPE',
+        'XMLReader' => 'TYPE',
+        'XMLReaderAdapter' => 'TYPE',
+        'XMLReaderFactory' => 'TYPE',
+        'Xid' => 'TYPE',
+        'ZipEntry' => 'TYPE',
+        'ZipException' => 'TYPE',
+        'ZipFile' => 'TYPE',
+        'ZipInputStream' => 'TYPE',
+        'ZipOutputStream' => 'TYPE',
+        'ZoneView' => 'TYPE',
+        '_BindingIteratorImplBase' => 'TYPE',
+        '_BindingIteratorStub' => 'TYPE',
+        '_DynAnyFactoryStub' => 'TYPE',
+        '_DynAnyStub' => 'TYPE',
+        '_DynArrayStub' => 'TYPE',
+        '_DynEnumStub' => 'TYPE',
+        '_DynFixedStub' => 'TYPE',
+        '_DynSequenceStub' => 'TYPE',
+        '_DynStructStub' => 'TYPE',
+        '_DynUnionStub' => 'TYPE',
+        '_DynValueStub' => 'TYPE',
+        '_IDLTypeStub' => 'TYPE',
+        '_NamingContextExtStub' => 'TYPE',
+        '_NamingContextImplBase' => 'TYPE',
+        '_NamingContextStub' => 'TYPE',
+        '_PolicyStub' => 'TYPE',
+        '_Remote_Stub' => 'TYPE',
+        '_ServantActivatorStub' => 'TYPE',
+        '_ServantLocatorStub' => 'TYPE'
+    );
+}
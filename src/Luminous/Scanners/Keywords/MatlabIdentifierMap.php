@@ -0,0 +1,6101 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from MatlabKeywords by generate.php, do not edit.
+ */
+class MatlabIdentifierMap
+{
+    public static $NAMES = array('KEYWORD', 'VALUE', 'FUNCTION');
+
+    public static $MAP = array(
+        'break' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'classdef' => 'KEYWORD',
+        'continue' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'elseif' => 'KEYWORD',
+        'end' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'function' => 'KEYWORD',
+        'global' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'otherwise' => 'KEYWORD',
+        'parfor' => 'KEYWORD',
+        'persistent' => 'KEYWORD',
+        'return' => 'KEYWORD',
+        'spmd' => 'KEYWORD',
+        'switch' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'eps' => 'VALUE',
+        'i' => 'VALUE',
+        'Inf' => 'VALUE',
+        'intmax' => 'VALUE',
+        'intmin' => 'VALUE',
+        'j' => 'VALUE',
+        'NaN' => 'VALUE',
+        'pi' => 'VALUE',
+        'realmax' => 'VALUE',
+        'realmin' => 'VALUE',
+        'aa2int' => 'FUNCTION',
+        'aa2nt' => 'FUNCTION',
+        'aacount' => 'FUNCTION',
+        'abcd2h' => 'FUNCTION',
+        'abcd2s' => 'FUNCTION',
+        'abcd2y' => 'FUNCTION',
+        'abs' => 'FUNCTION',
+        'abs2active' => 'FUNCTION',
+        'abstract' => 'FUNCTION',
+        'ac2poly' => 'FUNCTION',
+        'ac2rc' => 'FUNCTION',
+        'accrfrac' => 'FUNCTION',
+        'accumarray' => 'FUNCTION',
+        'acker' => 'FUNCTION',
+        'acos' => 'FUNCTION',
+        'acosd' => 'FUNCTION',
+        'acosh' => 'FUNCTION',
+        'acot' => 'FUNCTION',
+        'acotd' => 'FUNCTION',
+        'acoth' => 'FUNCTION',
+        'acrubond' => 'FUNCTION',
+        'acrudisc' => 'FUNCTION',
+        'acsc' => 'FUNCTION',
+        'acscd' => 'FUNCTION',
+        'acsch' => 'FUNCTION',
+        'activate' => 'FUNCTION',
+        'active2abs' => 'FUNCTION',
+        'ActiveInputs' => 'FUNCTION',
+        'actual2normalized' => 'FUNCTION',
+        'actxcontrol' => 'FUNCTION',
+        'actxcontrollist' => 'FUNCTION',
+        'actxcontrolselect' => 'FUNCTION',
+        'actxGetRunningServer' => 'FUNCTION',
+        'actxserver' => 'FUNCTION',
+        'adapt' => 'FUNCTION',
+        'adaptfilt' => 'FUNCTION',
+        'adapthisteq' => 'FUNCTION',
+        'adaptmesh' => 'FUNCTION',
+        'add' => 'FUNCTION',
+        'Add' => 'FUNCTION',
+        'add_block' => 'FUNCTION',
+        'add_exec_event_listener' => 'FUNCTION',
+        'add_line' => 'FUNCTION',
+        'add_param' => 'FUNCTION',
+        'addAdditionalHeaderFile' => 'FUNCTION',
+        'addAdditionalIncludePath' => 'FUNCTION',
+        'addAdditionalLinkObj' => 'FUNCTION',
+        'addAdditionalLinkObjPath' => 'FUNCTION',
+        'addAdditionalSourceFile' => 'FUNCTION',
+        'addAdditionalSourcePath' => 'FUNCTION',
+        'addAnalogInputChannel' => 'FUNCTION',
+        'addAnalogOutputChannel' => 'FUNCTION',
+        'addArgConf' => 'FUNCTION',
+        'addArtifact' => 'FUNCTION',
+        'addBody' => 'FUNCTION',
+        'addCallback' => 'FUNCTION',
+        'addCause' => 'FUNCTION',
+        'addchannel' => 'FUNCTION',
+        'addCheck' => 'FUNCTION',
+        'addCompileFlags' => 'FUNCTION',
+        'addConceptualArg' => 'FUNCTION',
+        'addConfigSet' => 'FUNCTION',
+        'AddConstraint' => 'FUNCTION',
+        'addDefines' => 'FUNCTION',
+        'adddelay' => 'FUNCTION',
+        'AddDesign' => 'FUNCTION',
+        'addedvarplot' => 'FUNCTION',
+        'addEntry' => 'FUNCTION',
+        'addevent' => 'FUNCTION',
+        'addEventConf' => 'FUNCTION',
+        'AddFilter' => 'FUNCTION',
+        'addgroup' => 'FUNCTION',
+        'addGroup' => 'FUNCTION',
+        'addIncludeFiles' => 'FUNCTION',
+        'addIncludePaths' => 'FUNCTION',
+        'addInputData' => 'FUNCTION',
+        'addIOConf' => 'FUNCTION',
+        'additem' => 'FUNCTION',
+        'addItem' => 'FUNCTION',
+        'addlevels' => 'FUNCTION',
+        'addlift' => 'FUNCTION',
+        'addline' => 'FUNCTION',
+        'addLinkFlags' => 'FUNCTION',
+        'addLinkObjects' => 'FUNCTION',
+        'addlistener' => 'FUNCTION',
+        'addmf' => 'FUNCTION',
+        'addmuxchannel' => 'FUNCTION',
+        'addNode' => 'FUNCTION',
+        'addNonBuildFiles' => 'FUNCTION',
+        'addOptional' => 'FUNCTION',
+        'addoutputspec' => 'FUNCTION',
+        'addParam' => 'FUNCTION',
+        'addParamValue' => 'FUNCTION',
+        'addpath' => 'FUNCTION',
+        'addPostLoadFiles' => 'FUNCTION',
+        'addpref' => 'FUNCTION',
+        'addprop' => 'FUNCTION',
+        'addproperty' => 'FUNCTION',
+        'addreg' => 'FUNCTION',
+        'addRequired' => 'FUNCTION',
+        'address' => 'FUNCTION',
+        'addRoute' => 'FUNCTION',
+        'addRow' => 'FUNCTION',
+        'addrule' => 'FUNCTION',
+        'addsample' => 'FUNCTION',
+        'addsampletocollection' => 'FUNCTION',
+        'addscope' => 'FUNCTION',
+        'addsignal' => 'FUNCTION',
+        'addSourceFiles' => 'FUNCTION',
+        'addSourcePaths' => 'FUNCTION',
+        'addTask' => 'FUNCTION',
+        'addterms' => 'FUNCTION',
+        'AddTestFilter' => 'FUNCTION',
+        'addTitle' => 'FUNCTION',
+        'addTMFTokens' => 'FUNCTION',
+        'addtodate' => 'FUNCTION',
+        'addts' => 'FUNCTION',
+        'addvar' => 'FUNCTION',
+        'AddVariable' => 'FUNCTION',
+        'addViewpoint' => 'FUNCTION',
+        'addXLabel' => 'FUNCTION',
+        'addYLabel' => 'FUNCTION',
+        'adftest' => 'FUNCTION',
+        'adivdsp' => 'FUNCTION',
+        'adivdspsetup' => 'FUNCTION',
+        'adline' => 'FUNCTION',
+        'adosc' => 'FUNCTION',
+        'advice' => 'FUNCTION',
+        'Aero' => 'FUNCTION',
+        'aff2pol' => 'FUNCTION',
+        'affygcrma' => 'FUNCTION',
+        'affyinvarsetnorm' => 'FUNCTION',
+        'affyprobeaffinities' => 'FUNCTION',
+        'affyprobeseqread' => 'FUNCTION',
+        'affyread' => 'FUNCTION',
+        'affyrma' => 'FUNCTION',
+        'affysnpannotread' => 'FUNCTION',
+        'affysnpintensitysplit' => 'FUNCTION',
+        'affysnpquartets' => 'FUNCTION',
+        'agencyoas' => 'FUNCTION',
+        'agencyprice' => 'FUNCTION',
+        'agferead' => 'FUNCTION',
+        'aic' => 'FUNCTION',
+        'aicbic' => 'FUNCTION',
+        'airspeed' => 'FUNCTION',
+        'airy' => 'FUNCTION',
+        'algdeintrlv' => 'FUNCTION',
+        'algintrlv' => 'FUNCTION',
+        'AliasMatrix' => 'FUNCTION',
+        'align' => 'FUNCTION',
+        'align2cigar' => 'FUNCTION',
+        'alignsignals' => 'FUNCTION',
+        'alim' => 'FUNCTION',
+        'all' => 'FUNCTION',
+        'allchild' => 'FUNCTION',
+        'allmargin' => 'FUNCTION',
+        'allNames' => 'FUNCTION',
+        'allnodes' => 'FUNCTION',
+        'allshortestpaths' => 'FUNCTION',
+        'almanac' => 'FUNCTION',
+        'alpha' => 'FUNCTION',
+        'alphabeta' => 'FUNCTION',
+        'alphamap' => 'FUNCTION',
+        'AlternativeModelStatistics' => 'FUNCTION',
+        'AlternativeResponses' => 'FUNCTION',
+        'amd' => 'FUNCTION',
+        'amdemod' => 'FUNCTION',
+        'aminolookup' => 'FUNCTION',
+        'ammod' => 'FUNCTION',
+        'amortize' => 'FUNCTION',
+        'analoginput' => 'FUNCTION',
+        'analogoutput' => 'FUNCTION',
+        'analyze75info' => 'FUNCTION',
+        'analyze75read' => 'FUNCTION',
+        'ancestor' => 'FUNCTION',
+        'and' => 'FUNCTION',
+        'andrewsplot' => 'FUNCTION',
+        'anfis' => 'FUNCTION',
+        'anfisedit' => 'FUNCTION',
+        'angl2str' => 'FUNCTION',
+        'angle' => 'FUNCTION',
+        'angle2dcm' => 'FUNCTION',
+        'angle2quat' => 'FUNCTION',
+        'animate' => 'FUNCTION',
+        'annotation' => 'FUNCTION',
+        'Annotation' => 'FUNCTION',
+        'annurate' => 'FUNCTION',
+        'annuterm' => 'FUNCTION',
+        'anova1' => 'FUNCTION',
+        'anova2' => 'FUNCTION',
+        'anovan' => 'FUNCTION',
+        'ans' => 'FUNCTION',
+        'ansaribradley' => 'FUNCTION',
+        'antipode' => 'FUNCTION',
+        'any' => 'FUNCTION',
+        'aoctool' => 'FUNCTION',
+        'appcoef' => 'FUNCTION',
+        'appcoef2' => 'FUNCTION',
+        'append' => 'FUNCTION',
+        'Append' => 'FUNCTION',
+        'applycform' => 'FUNCTION',
+        'applylut' => 'FUNCTION',
+        'aptknt' => 'FUNCTION',
+        'ar' => 'FUNCTION',
+        'arburg' => 'FUNCTION',
+        'arcgridread' => 'FUNCTION',
+        'archtest' => 'FUNCTION',
+        'arcov' => 'FUNCTION',
+        'area' => 'FUNCTION',
+        'areaint' => 'FUNCTION',
+        'areamat' => 'FUNCTION',
+        'areaquad' => 'FUNCTION',
+        'Areaseries' => 'FUNCTION',
+        'argnames' => 'FUNCTION',
+        'arith2geom' => 'FUNCTION',
+        'arithdeco' => 'FUNCTION',
+        'arithenco' => 'FUNCTION',
+        'Arithmetic' => 'FUNCTION',
+        'armax' => 'FUNCTION',
+        'armcov' => 'FUNCTION',
+        'arrayfun' => 'FUNCTION',
+        'arx' => 'FUNCTION',
+        'arxdata' => 'FUNCTION',
+        'arxml' => 'FUNCTION',
+        'arxstruc' => 'FUNCTION',
+        'aryule' => 'FUNCTION',
+        'ascii2fts' => 'FUNCTION',
+        'asec' => 'FUNCTION',
+        'asecd' => 'FUNCTION',
+        'asech' => 'FUNCTION',
+        'asianbycrr' => 'FUNCTION',
+        'asianbyeqp' => 'FUNCTION',
+        'asianbyitt' => 'FUNCTION',
+        'asin' => 'FUNCTION',
+        'asind' => 'FUNCTION',
+        'asinh' => 'FUNCTION',
+        'assema' => 'FUNCTION',
+        'assemb' => 'FUNCTION',
+        'assempde' => 'FUNCTION',
+        'assert' => 'FUNCTION',
+        'assetbybls' => 'FUNCTION',
+        'assetsensbybls' => 'FUNCTION',
+        'assignin' => 'FUNCTION',
+        'assignmentquantizer' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'atan2' => 'FUNCTION',
+        'atand' => 'FUNCTION',
+        'atanh' => 'FUNCTION',
+        'atmoscira' => 'FUNCTION',
+        'atmoscoesa' => 'FUNCTION',
+        'atmosisa' => 'FUNCTION',
+        'atmoslapse' => 'FUNCTION',
+        'atmosnonstd' => 'FUNCTION',
+        'atmosnrlmsise00' => 'FUNCTION',
+        'atmospalt' => 'FUNCTION',
+        'atomiccomp' => 'FUNCTION',
+        'attachConfigSet' => 'FUNCTION',
+        'attachConfigSetCopy' => 'FUNCTION',
+        'AttachData' => 'FUNCTION',
+        'attachDatabase' => 'FUNCTION',
+        'attachToModel' => 'FUNCTION',
+        'attr' => 'FUNCTION',
+        'audiodevinfo' => 'FUNCTION',
+        'audioplayer' => 'FUNCTION',
+        'audiorecorder' => 'FUNCTION',
+        'aufinfo' => 'FUNCTION',
+        'augknt' => 'FUNCTION',
+        'Augment' => 'FUNCTION',
+        'augstate' => 'FUNCTION',
+        'augw' => 'FUNCTION',
+        'auread' => 'FUNCTION',
+        'autocorr' => 'FUNCTION',
+        'autofixexp' => 'FUNCTION',
+        'autoscale' => 'FUNCTION',
+        'auwrite' => 'FUNCTION',
+        'aveknt' => 'FUNCTION',
+        'avhrrgoode' => 'FUNCTION',
+        'avhrrlambert' => 'FUNCTION',
+        'avifile' => 'FUNCTION',
+        'aviinfo' => 'FUNCTION',
+        'aviread' => 'FUNCTION',
+        'awgn' => 'FUNCTION',
+        'axes' => 'FUNCTION',
+        'axes2ecc' => 'FUNCTION',
+        'axes2pix' => 'FUNCTION',
+        'axesm' => 'FUNCTION',
+        'axesscale' => 'FUNCTION',
+        'axis' => 'FUNCTION',
+        'azimuth' => 'FUNCTION',
+        'balance' => 'FUNCTION',
+        'balancmr' => 'FUNCTION',
+        'balreal' => 'FUNCTION',
+        'balred' => 'FUNCTION',
+        'balredOptions' => 'FUNCTION',
+        'bamindexread' => 'FUNCTION',
+        'baminfo' => 'FUNCTION',
+        'bamread' => 'FUNCTION',
+        'bandwidth' => 'FUNCTION',
+        'bar' => 'FUNCTION',
+        'bar3' => 'FUNCTION',
+        'barh' => 'FUNCTION',
+        'barrierbycrr' => 'FUNCTION',
+        'barrierbyeqp' => 'FUNCTION',
+        'barrierbyitt' => 'FUNCTION',
+        'Barseries' => 'FUNCTION',
+        'barthannwin' => 'FUNCTION',
+        'bartlett' => 'FUNCTION',
+        'barttest' => 'FUNCTION',
+        'baryToCart' => 'FUNCTION',
+        'base2dec' => 'FUNCTION',
+        'basecount' => 'FUNCTION',
+        'baselookup' => 'FUNCTION',
+        'basketbyju' => 'FUNCTION',
+        'basketbyls' => 'FUNCTION',
+        'basketsensbyju' => 'FUNCTION',
+        'basketsensbyls' => 'FUNCTION',
+        'basketstockspec' => 'FUNCTION',
+        'batch' => 'FUNCTION',
+        'bbdesign' => 'FUNCTION',
+        'bchdec' => 'FUNCTION',
+        'bchenc' => 'FUNCTION',
+        'bchgenpoly' => 'FUNCTION',
+        'bchnumerr' => 'FUNCTION',
+        'bdclose' => 'FUNCTION',
+        'bdIsLoaded' => 'FUNCTION',
+        'bdroot' => 'FUNCTION',
+        'bdschur' => 'FUNCTION',
+        'bdtprice' => 'FUNCTION',
+        'bdtsens' => 'FUNCTION',
+        'bdttimespec' => 'FUNCTION',
+        'bdttree' => 'FUNCTION',
+        'bdtvolspec' => 'FUNCTION',
+        'beep' => 'FUNCTION',
+        'BeginEdit' => 'FUNCTION',
+        'bench' => 'FUNCTION',
+        'berawgn' => 'FUNCTION',
+        'bercoding' => 'FUNCTION',
+        'berconfint' => 'FUNCTION',
+        'berfading' => 'FUNCTION',
+        'berfit' => 'FUNCTION',
+        'bersync' => 'FUNCTION',
+        'bertool' => 'FUNCTION',
+        'besselap' => 'FUNCTION',
+        'besself' => 'FUNCTION',
+        'besselh' => 'FUNCTION',
+        'besseli' => 'FUNCTION',
+        'besselj' => 'FUNCTION',
+        'besselk' => 'FUNCTION',
+        'bessely' => 'FUNCTION',
+        'bestblk' => 'FUNCTION',
+        'BestDesign' => 'FUNCTION',
+        'bestlevt' => 'FUNCTION',
+        'BestModel' => 'FUNCTION',
+        'bestrowid' => 'FUNCTION',
+        'besttree' => 'FUNCTION',
+        'beta' => 'FUNCTION',
+        'betacdf' => 'FUNCTION',
+        'betafit' => 'FUNCTION',
+        'betainc' => 'FUNCTION',
+        'betaincinv' => 'FUNCTION',
+        'betainv' => 'FUNCTION',
+        'betalike' => 'FUNCTION',
+        'betaln' => 'FUNCTION',
+        'betapdf' => 'FUNCTION',
+        'betarnd' => 'FUNCTION',
+        'betastat' => 'FUNCTION',
+        'beytbill' => 'FUNCTION',
+        'bi2de' => 'FUNCTION',
+        'bicg' => 'FUNCTION',
+        'bicgstab' => 'FUNCTION',
+        'bicgstabl' => 'FUNCTION',
+        'bilin' => 'FUNCTION',
+        'bilinear' => 'FUNCTION',
+        'bin' => 'FUNCTION',
+        'bin2dec' => 'FUNCTION',
+        'bin2gray' => 'FUNCTION',
+        'bin2num' => 'FUNCTION',
+        'binblockread' => 'FUNCTION',
+        'binblockwrite' => 'FUNCTION',
+        'binocdf' => 'FUNCTION',
+        'binofit' => 'FUNCTION',
+        'binoinv' => 'FUNCTION',
+        'binopdf' => 'FUNCTION',
+        'binornd' => 'FUNCTION',
+        'binostat' => 'FUNCTION',
+        'binprice' => 'FUNCTION',
+        'bintprog' => 'FUNCTION',
+        'binvec2dec' => 'FUNCTION',
+        'biograph' => 'FUNCTION',
+        'biorfilt' => 'FUNCTION',
+        'biorwavf' => 'FUNCTION',
+        'biplot' => 'FUNCTION',
+        'bitand' => 'FUNCTION',
+        'bitandreduce' => 'FUNCTION',
+        'bitcmp' => 'FUNCTION',
+        'bitconcat' => 'FUNCTION',
+        'biterr' => 'FUNCTION',
+        'bitget' => 'FUNCTION',
+        'bitmax' => 'FUNCTION',
+        'bitor' => 'FUNCTION',
+        'bitorreduce' => 'FUNCTION',
+        'bitreplicate' => 'FUNCTION',
+        'bitrevorder' => 'FUNCTION',
+        'bitrol' => 'FUNCTION',
+        'bitror' => 'FUNCTION',
+        'bitset' => 'FUNCTION',
+        'bitshift' => 'FUNCTION',
+        'bitsliceget' => 'FUNCTION',
+        'bitsll' => 'FUNCTION',
+        'bitsra' => 'FUNCTION',
+        'bitsrl' => 'FUNCTION',
+        'bitxor' => 'FUNCTION',
+        'bitxorreduce' => 'FUNCTION',
+        'bj' => 'FUNCTION',
+        'bkbrk' => 'FUNCTION',
+        'bkcall' => 'FUNCTION',
+        'bkcaplet' => 'FUNCTION',
+        'bkfloorlet' => 'FUNCTION',
+        'bkprice' => 'FUNCTION',
+        'bkput' => 'FUNCTION',
+        'bksens' => 'FUNCTION',
+        'bktimespec' => 'FUNCTION',
+        'bktree' => 'FUNCTION',
+        'bkvolspec' => 'FUNCTION',
+        'blackman' => 'FUNCTION',
+        'blackmanharris' => 'FUNCTION',
+        'blanks' => 'FUNCTION',
+        'blastformat' => 'FUNCTION',
+        'blastlocal' => 'FUNCTION',
+        'blastncbi' => 'FUNCTION',
+        'blastread' => 'FUNCTION',
+        'blastreadlocal' => 'FUNCTION',
+        'blkdiag' => 'FUNCTION',
+        'blkimpv' => 'FUNCTION',
+        'blkprice' => 'FUNCTION',
+        'block' => 'FUNCTION',
+        'blockproc' => 'FUNCTION',
+        'blosum' => 'FUNCTION',
+        'blp' => 'FUNCTION',
+        'blsdelta' => 'FUNCTION',
+        'blsgamma' => 'FUNCTION',
+        'blsimpv' => 'FUNCTION',
+        'blslambda' => 'FUNCTION',
+        'blsprice' => 'FUNCTION',
+        'blsrho' => 'FUNCTION',
+        'blstheta' => 'FUNCTION',
+        'blsvega' => 'FUNCTION',
+        'bm' => 'FUNCTION',
+        'bndconvp' => 'FUNCTION',
+        'bndconvy' => 'FUNCTION',
+        'bnddurp' => 'FUNCTION',
+        'bnddury' => 'FUNCTION',
+        'bndfutimprepo' => 'FUNCTION',
+        'bndfutprice' => 'FUNCTION',
+        'bndkrdur' => 'FUNCTION',
+        'bndprice' => 'FUNCTION',
+        'bndspread' => 'FUNCTION',
+        'bndyield' => 'FUNCTION',
+        'bode' => 'FUNCTION',
+        'bodemag' => 'FUNCTION',
+        'bodeoptions' => 'FUNCTION',
+        'bodeplot' => 'FUNCTION',
+        'Body' => 'FUNCTION',
+        'bohmanwin' => 'FUNCTION',
+        'bolling' => 'FUNCTION',
+        'bollinger' => 'FUNCTION',
+        'bondbybdt' => 'FUNCTION',
+        'bondbybk' => 'FUNCTION',
+        'bondbyhjm' => 'FUNCTION',
+        'bondbyhw' => 'FUNCTION',
+        'bondbyzero' => 'FUNCTION',
+        'bootci' => 'FUNCTION',
+        'bootstrap' => 'FUNCTION',
+        'bootstrp' => 'FUNCTION',
+        'boundary' => 'FUNCTION',
+        'Boundary' => 'FUNCTION',
+        'BoundaryModel' => 'FUNCTION',
+        'boundImageSize' => 'FUNCTION',
+        'bowtieread' => 'FUNCTION',
+        'box' => 'FUNCTION',
+        'boxcox' => 'FUNCTION',
+        'BoxCoxSSE' => 'FUNCTION',
+        'boxdist' => 'FUNCTION',
+        'boxplot' => 'FUNCTION',
+        'breakHdlSim' => 'FUNCTION',
+        'brighten' => 'FUNCTION',
+        'brk2knt' => 'FUNCTION',
+        'brush' => 'FUNCTION',
+        'bsc' => 'FUNCTION',
+        'bspligui' => 'FUNCTION',
+        'bspline' => 'FUNCTION',
+        'bstmr' => 'FUNCTION',
+        'bswfun' => 'FUNCTION',
+        'bsxfun' => 'FUNCTION',
+        'buffer' => 'FUNCTION',
+        'bufferm' => 'FUNCTION',
+        'build' => 'FUNCTION',
+        'builddocsearchdb' => 'FUNCTION',
+        'builtin' => 'FUNCTION',
+        'busdate' => 'FUNCTION',
+        'busdays' => 'FUNCTION',
+        'bushpath' => 'FUNCTION',
+        'bushshape' => 'FUNCTION',
+        'buttap' => 'FUNCTION',
+        'butter' => 'FUNCTION',
+        'buttord' => 'FUNCTION',
+        'bvp4c' => 'FUNCTION',
+        'bvp5c' => 'FUNCTION',
+        'bvpget' => 'FUNCTION',
+        'bvpinit' => 'FUNCTION',
+        'bvpset' => 'FUNCTION',
+        'bvpxtend' => 'FUNCTION',
+        'bwarea' => 'FUNCTION',
+        'bwareaopen' => 'FUNCTION',
+        'bwboundaries' => 'FUNCTION',
+        'bwconncomp' => 'FUNCTION',
+        'bwdist' => 'FUNCTION',
+        'bweuler' => 'FUNCTION',
+        'bwhitmiss' => 'FUNCTION',
+        'bwlabel' => 'FUNCTION',
+        'bwlabeln' => 'FUNCTION',
+        'bwmorph' => 'FUNCTION',
+        'bwpack' => 'FUNCTION',
+        'bwperim' => 'FUNCTION',
+        'bwselect' => 'FUNCTION',
+        'bwtraceboundary' => 'FUNCTION',
+        'bwulterode' => 'FUNCTION',
+        'bwunpack' => 'FUNCTION',
+        'c2d' => 'FUNCTION',
+        'c2dOptions' => 'FUNCTION',
+        'ca2tf' => 'FUNCTION',
+        'cage' => 'FUNCTION',
+        'calendar' => 'FUNCTION',
+        'calllib' => 'FUNCTION',
+        'callSoapService' => 'FUNCTION',
+        'camdolly' => 'FUNCTION',
+        'Camera' => 'FUNCTION',
+        'cameratoolbar' => 'FUNCTION',
+        'camlight' => 'FUNCTION',
+        'camlookat' => 'FUNCTION',
+        'camorbit' => 'FUNCTION',
+        'campan' => 'FUNCTION',
+        'campos' => 'FUNCTION',
+        'camposm' => 'FUNCTION',
+        'camproj' => 'FUNCTION',
+        'camroll' => 'FUNCTION',
+        'camtarget' => 'FUNCTION',
+        'camtargm' => 'FUNCTION',
+        'camup' => 'FUNCTION',
+        'camupm' => 'FUNCTION',
+        'camva' => 'FUNCTION',
+        'camzoom' => 'FUNCTION',
+        'cancel' => 'FUNCTION',
+        'cancelasync' => 'FUNCTION',
+        'canChannel' => 'FUNCTION',
+        'canDatabase' => 'FUNCTION',
+        'candexch' => 'FUNCTION',
+        'candgen' => 'FUNCTION',
+        'candle' => 'FUNCTION',
+        'canHWInfo' => 'FUNCTION',
+        'canMessage' => 'FUNCTION',
+        'canMessageCompatibilityMode' => 'FUNCTION',
+        'canMessageImport' => 'FUNCTION',
+        'canon' => 'FUNCTION',
+        'canoncorr' => 'FUNCTION',
+        'canSupport' => 'FUNCTION',
+        'canTool' => 'FUNCTION',
+        'canvas' => 'FUNCTION',
+        'capability' => 'FUNCTION',
+        'capaplot' => 'FUNCTION',
+        'capbybdt' => 'FUNCTION',
+        'capbybk' => 'FUNCTION',
+        'capbyblk' => 'FUNCTION',
+        'capbyhjm' => 'FUNCTION',
+        'capbyhw' => 'FUNCTION',
+        'capture' => 'FUNCTION',
+        'care' => 'FUNCTION',
+        'cart2grn' => 'FUNCTION',
+        'cart2pol' => 'FUNCTION',
+        'cart2sph' => 'FUNCTION',
+        'cartToBary' => 'FUNCTION',
+        'cascadeforwardnet' => 'FUNCTION',
+        'cascadesparams' => 'FUNCTION',
+        'caseread' => 'FUNCTION',
+        'casewrite' => 'FUNCTION',
+        'cashbybls' => 'FUNCTION',
+        'cashsensbybls' => 'FUNCTION',
+        'cast' => 'FUNCTION',
+        'cat' => 'FUNCTION',
+        'categorical' => 'FUNCTION',
+        'category' => 'FUNCTION',
+        'catelements' => 'FUNCTION',
+        'catsamples' => 'FUNCTION',
+        'catsignals' => 'FUNCTION',
+        'catsplit' => 'FUNCTION',
+        'cattimesteps' => 'FUNCTION',
+        'caxis' => 'FUNCTION',
+        'cbprice' => 'FUNCTION',
+        'ccdesign' => 'FUNCTION',
+        'cceps' => 'FUNCTION',
+        'ccode' => 'FUNCTION',
+        'cconv' => 'FUNCTION',
+        'ccsboardinfo' => 'FUNCTION',
+        'cd' => 'FUNCTION',
+        'cdai' => 'FUNCTION',
+        'cdf' => 'FUNCTION',
+        'cdf2rdf' => 'FUNCTION',
+        'cdfepoch' => 'FUNCTION',
+        'cdfinfo' => 'FUNCTION',
+        'cdflib' => 'FUNCTION',
+        'cdfplot' => 'FUNCTION',
+        'cdfread' => 'FUNCTION',
+        'cdfwrite' => 'FUNCTION',
+        'cdprice' => 'FUNCTION',
+        'cdsbootstrap' => 'FUNCTION',
+        'cdsprice' => 'FUNCTION',
+        'cdsspread' => 'FUNCTION',
+        'cdyield' => 'FUNCTION',
+        'ceil' => 'FUNCTION',
+        'celintensityread' => 'FUNCTION',
+        'cell' => 'FUNCTION',
+        'cell2mat' => 'FUNCTION',
+        'cell2sos' => 'FUNCTION',
+        'cell2struct' => 'FUNCTION',
+        'celldisp' => 'FUNCTION',
+        'cellfun' => 'FUNCTION',
+        'cellmat' => 'FUNCTION',
+        'cellplot' => 'FUNCTION',
+        'cellstr' => 'FUNCTION',
+        'Centers' => 'FUNCTION',
+        'centfrq' => 'FUNCTION',
+        'cev' => 'FUNCTION',
+        'cfamounts' => 'FUNCTION',
+        'cfbybdt' => 'FUNCTION',
+        'cfbybk' => 'FUNCTION',
+        'cfbyhjm' => 'FUNCTION',
+        'cfbyhw' => 'FUNCTION',
+        'cfbyzero' => 'FUNCTION',
+        'cfconv' => 'FUNCTION',
+        'cfdates' => 'FUNCTION',
+        'cfdur' => 'FUNCTION',
+        'cfirpm' => 'FUNCTION',
+        'cfit' => 'FUNCTION',
+        'cflibhelp' => 'FUNCTION',
+        'cfport' => 'FUNCTION',
+        'cfs2wpt' => 'FUNCTION',
+        'cftimes' => 'FUNCTION',
+        'cftool' => 'FUNCTION',
+        'cgauwavf' => 'FUNCTION',
+        'cghcbs' => 'FUNCTION',
+        'cghfreqplot' => 'FUNCTION',
+        'cgoptimoptions' => 'FUNCTION',
+        'cgoptimstore' => 'FUNCTION',
+        'cgs' => 'FUNCTION',
+        'chaikosc' => 'FUNCTION',
+        'chaikvolat' => 'FUNCTION',
+        'changem' => 'FUNCTION',
+        'changePassword' => 'FUNCTION',
+        'char' => 'FUNCTION',
+        'chartfts' => 'FUNCTION',
+        'chbpnt' => 'FUNCTION',
+        'cheb1ap' => 'FUNCTION',
+        'cheb1ord' => 'FUNCTION',
+        'cheb2ap' => 'FUNCTION',
+        'cheb2ord' => 'FUNCTION',
+        'chebwin' => 'FUNCTION',
+        'cheby1' => 'FUNCTION',
+        'cheby2' => 'FUNCTION',
+        'checkEnvSetup' => 'FUNCTION',
+        'checkerboard' => 'FUNCTION',
+        'checkhdl' => 'FUNCTION',
+        'checkin' => 'FUNCTION',
+        'checkout' => 'FUNCTION',
+        'chfield' => 'FUNCTION',
+        'chgunits' => 'FUNCTION',
+        'chgwdeccfs' => 'FUNCTION',
+        'chi2cdf' => 'FUNCTION',
+        'chi2gof' => 'FUNCTION',
+        'chi2inv' => 'FUNCTION',
+        'chi2pdf' => 'FUNCTION',
+        'chi2rnd' => 'FUNCTION',
+        'chi2stat' => 'FUNCTION',
+        'children' => 'FUNCTION',
+        'chirp' => 'FUNCTION',
+        'chol' => 'FUNCTION',
+        'cholcov' => 'FUNCTION',
+        'cholinc' => 'FUNCTION',
+        'cholupdate' => 'FUNCTION',
+        'ChooseAsBest' => 'FUNCTION',
+        'chooserbybls' => 'FUNCTION',
+        'chromosomeplot' => 'FUNCTION',
+        'cigar2align' => 'FUNCTION',
+        'cir' => 'FUNCTION',
+        'circcirc' => 'FUNCTION',
+        'circshift' => 'FUNCTION',
+        'circumcenters' => 'FUNCTION',
+        'cl2tf' => 'FUNCTION',
+        'cla' => 'FUNCTION',
+        'clabel' => 'FUNCTION',
+        'clabelm' => 'FUNCTION',
+        'class' => 'FUNCTION',
+        'classcount' => 'FUNCTION',
+        'classfin' => 'FUNCTION',
+        'classify' => 'FUNCTION',
+        'classperf' => 'FUNCTION',
+        'classprob' => 'FUNCTION',
+        'classregtree' => 'FUNCTION',
+        'clc' => 'FUNCTION',
+        'clear' => 'FUNCTION',
+        'cleareventlog' => 'FUNCTION',
+        'clearLocalPassword' => 'FUNCTION',
+        'ClearTimer' => 'FUNCTION',
+        'clearvars' => 'FUNCTION',
+        'clearwarnings' => 'FUNCTION',
+        'cleave' => 'FUNCTION',
+        'cleavelookup' => 'FUNCTION',
+        'clegendm' => 'FUNCTION',
+        'clf' => 'FUNCTION',
+        'clipboard' => 'FUNCTION',
+        'clipdata' => 'FUNCTION',
+        'clma' => 'FUNCTION',
+        'clmo' => 'FUNCTION',
+        'clock' => 'FUNCTION',
+        'cloffset' => 'FUNCTION',
+        'clonegroup' => 'FUNCTION',
+        'close' => 'FUNCTION',
+        'close_system' => 'FUNCTION',
+        'closeDialog' => 'FUNCTION',
+        'closeloop' => 'FUNCTION',
+        'closePolygonParts' => 'FUNCTION',
+        'closepreview' => 'FUNCTION',
+        'closereq' => 'FUNCTION',
+        'clrdevice' => 'FUNCTION',
+        'clrmenu' => 'FUNCTION',
+        'cluster' => 'FUNCTION',
+        'clusterdata' => 'FUNCTION',
+        'clustergram' => 'FUNCTION',
+        'clusterGroup' => 'FUNCTION',
+        'cma' => 'FUNCTION',
+        'cmddenoise' => 'FUNCTION',
+        'cmdscale' => 'FUNCTION',
+        'cmopts' => 'FUNCTION',
+        'cmorwavf' => 'FUNCTION',
+        'cmsclsyn' => 'FUNCTION',
+        'codistributed' => 'FUNCTION',
+        'codistributor' => 'FUNCTION',
+        'codistributor1d' => 'FUNCTION',
+        'codistributor2dbc' => 'FUNCTION',
+        'codonbias' => 'FUNCTION',
+        'codoncount' => 'FUNCTION',
+        'coeffnames' => 'FUNCTION',
+        'coeffs' => 'FUNCTION',
+        'coeffvalues' => 'FUNCTION',
+        'coifwavf' => 'FUNCTION',
+        'col2im' => 'FUNCTION',
+        'colamd' => 'FUNCTION',
+        'colfilt' => 'FUNCTION',
+        'collect' => 'FUNCTION',
+        'colnames' => 'FUNCTION',
+        'colon' => 'FUNCTION',
+        'color' => 'FUNCTION',
+        'colorbar' => 'FUNCTION',
+        'colordef' => 'FUNCTION',
+        'colorm' => 'FUNCTION',
+        'colormap' => 'FUNCTION',
+        'colormapeditor' => 'FUNCTION',
+        'ColorSpec' => 'FUNCTION',
+        'colorui' => 'FUNCTION',
+        'colperm' => 'FUNCTION',
+        'cols' => 'FUNCTION',
+        'colspace' => 'FUNCTION',
+        'columnnames' => 'FUNCTION',
+        'columnprivileges' => 'FUNCTION',
+        'columns' => 'FUNCTION',
+        'combine' => 'FUNCTION',
+        'combnk' => 'FUNCTION',
+        'combntns' => 'FUNCTION',
+        'combvec' => 'FUNCTION',
+        'comet' => 'FUNCTION',
+        'comet3' => 'FUNCTION',
+        'comet3m' => 'FUNCTION',
+        'cometm' => 'FUNCTION',
+        'comm_links' => 'FUNCTION',
+        'commandhistory' => 'FUNCTION',
+        'commandwindow' => 'FUNCTION',
+        'commit' => 'FUNCTION',
+        'CommitEdit' => 'FUNCTION',
+        'commlib' => 'FUNCTION',
+        'commmeasure' => 'FUNCTION',
+        'commscope' => 'FUNCTION',
+        'commsrc' => 'FUNCTION',
+        'commstartup' => 'FUNCTION',
+        'commtest' => 'FUNCTION',
+        'compact' => 'FUNCTION',
+        'CompactTreeBagger' => 'FUNCTION',
+        'compan' => 'FUNCTION',
+        'compand' => 'FUNCTION',
+        'compare' => 'FUNCTION',
+        'compass' => 'FUNCTION',
+        'compet' => 'FUNCTION',
+        'competlayer' => 'FUNCTION',
+        'complex' => 'FUNCTION',
+        'componentinfo' => 'FUNCTION',
+        'compose' => 'FUNCTION',
+        'Composite' => 'FUNCTION',
+        'compoundbycrr' => 'FUNCTION',
+        'compoundbyeqp' => 'FUNCTION',
+        'compoundbyitt' => 'FUNCTION',
+        'computer' => 'FUNCTION',
+        'con2seq' => 'FUNCTION',
+        'concur' => 'FUNCTION',
+        'cond' => 'FUNCTION',
+        'condeig' => 'FUNCTION',
+        'condest' => 'FUNCTION',
+        'conditioninfo' => 'FUNCTION',
+        'coneplot' => 'FUNCTION',
+        'confds' => 'FUNCTION',
+        'configBusSpeed' => 'FUNCTION',
+        'configModel' => 'FUNCTION',
+        'configure' => 'FUNCTION',
+        'configuremodelsim' => 'FUNCTION',
+        'confint' => 'FUNCTION',
+        'confusion' => 'FUNCTION',
+        'confusionmat' => 'FUNCTION',
+        'conj' => 'FUNCTION',
+        'conncomp' => 'FUNCTION',
+        'conndef' => 'FUNCTION',
+        'connect' => 'FUNCTION',
+        'ConstrainedGenerate' => 'FUNCTION',
+        'Constraints' => 'FUNCTION',
+        'containers' => 'FUNCTION',
+        'contour' => 'FUNCTION',
+        'contour3' => 'FUNCTION',
+        'contour3m' => 'FUNCTION',
+        'contourc' => 'FUNCTION',
+        'contourcmap' => 'FUNCTION',
+        'contourf' => 'FUNCTION',
+        'contourfm' => 'FUNCTION',
+        'Contourgroup' => 'FUNCTION',
+        'contourm' => 'FUNCTION',
+        'contourslice' => 'FUNCTION',
+        'contrast' => 'FUNCTION',
+        'controlchart' => 'FUNCTION',
+        'controlrules' => 'FUNCTION',
+        'conv' => 'FUNCTION',
+        'conv2' => 'FUNCTION',
+        'convacc' => 'FUNCTION',
+        'convang' => 'FUNCTION',
+        'convangacc' => 'FUNCTION',
+        'convangvel' => 'FUNCTION',
+        'convdeintrlv' => 'FUNCTION',
+        'convdensity' => 'FUNCTION',
+        'convenc' => 'FUNCTION',
+        'convergent' => 'FUNCTION',
+        'convert' => 'FUNCTION',
+        'convert2sur' => 'FUNCTION',
+        'convertlat' => 'FUNCTION',
+        'convertto' => 'FUNCTION',
+        'convexHull' => 'FUNCTION',
+        'convfactor' => 'FUNCTION',
+        'convforce' => 'FUNCTION',
+        'convhull' => 'FUNCTION',
+        'convhulln' => 'FUNCTION',
+        'convintrlv' => 'FUNCTION',
+        'convlength' => 'FUNCTION',
+        'convmass' => 'FUNCTION',
+        'convmtx' => 'FUNCTION',
+        'convmtx2' => 'FUNCTION',
+        'convn' => 'FUNCTION',
+        'convpres' => 'FUNCTION',
+        'convtemp' => 'FUNCTION',
+        'convwf' => 'FUNCTION',
+        'cophenet' => 'FUNCTION',
+        'copulacdf' => 'FUNCTION',
+        'copulafit' => 'FUNCTION',
+        'copulaparam' => 'FUNCTION',
+        'copulapdf' => 'FUNCTION',
+        'copularnd' => 'FUNCTION',
+        'copulastat' => 'FUNCTION',
+        'copy' => 'FUNCTION',
+        'copyConceptualArgsToImplementation' => 'FUNCTION',
+        'CopyData' => 'FUNCTION',
+        'copyfile' => 'FUNCTION',
+        'copyobj' => 'FUNCTION',
+        'cordexch' => 'FUNCTION',
+        'cordiccexp' => 'FUNCTION',
+        'cordiccos' => 'FUNCTION',
+        'cordicsin' => 'FUNCTION',
+        'cordicsincos' => 'FUNCTION',
+        'corner' => 'FUNCTION',
+        'cornermetric' => 'FUNCTION',
+        'corr' => 'FUNCTION',
+        'corr2' => 'FUNCTION',
+        'corr2cov' => 'FUNCTION',
+        'corrcoef' => 'FUNCTION',
+        'corrcov' => 'FUNCTION',
+        'Correlation' => 'FUNCTION',
+        'corrmtx' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'cosd' => 'FUNCTION',
+        'cosets' => 'FUNCTION',
+        'cosh' => 'FUNCTION',
+        'cosint' => 'FUNCTION',
+        'cost' => 'FUNCTION',
+        'cot' => 'FUNCTION',
+        'cotd' => 'FUNCTION',
+        'coth' => 'FUNCTION',
+        'cov' => 'FUNCTION',
+        'cov2corr' => 'FUNCTION',
+        'covar' => 'FUNCTION',
+        'Covariance' => 'FUNCTION',
+        'covf' => 'FUNCTION',
+        'coxphfit' => 'FUNCTION',
+        'cp2tform' => 'FUNCTION',
+        'cpcorr' => 'FUNCTION',
+        'cpgisland' => 'FUNCTION',
+        'cplxpair' => 'FUNCTION',
+        'cpmargin' => 'FUNCTION',
+        'cpncount' => 'FUNCTION',
+        'cpndaten' => 'FUNCTION',
+        'cpndatenq' => 'FUNCTION',
+        'cpndatep' => 'FUNCTION',
+        'cpndatepq' => 'FUNCTION',
+        'cpndaysn' => 'FUNCTION',
+        'cpndaysp' => 'FUNCTION',
+        'cpnpersz' => 'FUNCTION',
+        'cpsd' => 'FUNCTION',
+        'cpselect' => 'FUNCTION',
+        'cpstruct2pairs' => 'FUNCTION',
+        'cputime' => 'FUNCTION',
+        'cra' => 'FUNCTION',
+        'CreateAlgorithm' => 'FUNCTION',
+        'CreateAlternativeModels' => 'FUNCTION',
+        'createAndAddConceptualArg' => 'FUNCTION',
+        'createAndAddImplementationArg' => 'FUNCTION',
+        'createAndSetCImplementationReturn' => 'FUNCTION',
+        'createBody' => 'FUNCTION',
+        'CreateBoundary' => 'FUNCTION',
+        'createCalibrationComponentObjects' => 'FUNCTION',
+        'CreateCandidateSet' => 'FUNCTION',
+        'createClassFromWsdl' => 'FUNCTION',
+        'createComponentAsModel' => 'FUNCTION',
+        'createComponentAsSubsystem' => 'FUNCTION',
+        'CreateConstraint' => 'FUNCTION',
+        'createCopy' => 'FUNCTION',
+        'CreateData' => 'FUNCTION',
+        'CreateDesign' => 'FUNCTION',
+        'createholidays' => 'FUNCTION',
+        'CreateModel' => 'FUNCTION',
+        'createns' => 'FUNCTION',
+        'createOperationAsConfigurableSubsystems' => 'FUNCTION',
+        'createOptimProblem' => 'FUNCTION',
+        'CreateProject' => 'FUNCTION',
+        'CreateResponse' => 'FUNCTION',
+        'CreateResponseFeature' => 'FUNCTION',
+        'createSoapMessage' => 'FUNCTION',
+        'createTask' => 'FUNCTION',
+        'CreateTestplan' => 'FUNCTION',
+        'createToleranceFile' => 'FUNCTION',
+        'cross' => 'FUNCTION',
+        'crosscorr' => 'FUNCTION',
+        'crossfix' => 'FUNCTION',
+        'crossreference' => 'FUNCTION',
+        'crosstab' => 'FUNCTION',
+        'crossval' => 'FUNCTION',
+        'crossvalind' => 'FUNCTION',
+        'crrprice' => 'FUNCTION',
+        'crrsens' => 'FUNCTION',
+        'crrtimespec' => 'FUNCTION',
+        'crrtree' => 'FUNCTION',
+        'csape' => 'FUNCTION',
+        'csapi' => 'FUNCTION',
+        'csaps' => 'FUNCTION',
+        'csc' => 'FUNCTION',
+        'cscd' => 'FUNCTION',
+        'csch' => 'FUNCTION',
+        'cscvn' => 'FUNCTION',
+        'csgchk' => 'FUNCTION',
+        'csgdel' => 'FUNCTION',
+        'csvread' => 'FUNCTION',
+        'csvwrite' => 'FUNCTION',
+        'ctfroot' => 'FUNCTION',
+        'ctranspose' => 'FUNCTION',
+        'ctrb' => 'FUNCTION',
+        'ctrlpref' => 'FUNCTION',
+        'cumprod' => 'FUNCTION',
+        'cumsec' => 'FUNCTION',
+        'cumsum' => 'FUNCTION',
+        'cumtrapz' => 'FUNCTION',
+        'cur2frac' => 'FUNCTION',
+        'cur2str' => 'FUNCTION',
+        'curl' => 'FUNCTION',
+        'cursor' => 'FUNCTION',
+        'customnet' => 'FUNCTION',
+        'customreg' => 'FUNCTION',
+        'customverctrl' => 'FUNCTION',
+        'cutcategories' => 'FUNCTION',
+        'cutpoint' => 'FUNCTION',
+        'cuttype' => 'FUNCTION',
+        'cutvar' => 'FUNCTION',
+        'cv' => 'FUNCTION',
+        'cvexit' => 'FUNCTION',
+        'cvhtml' => 'FUNCTION',
+        'cvload' => 'FUNCTION',
+        'cvmodelview' => 'FUNCTION',
+        'cvpartition' => 'FUNCTION',
+        'cvsave' => 'FUNCTION',
+        'cvsim' => 'FUNCTION',
+        'cvsimref' => 'FUNCTION',
+        'cvtest' => 'FUNCTION',
+        'cvtree' => 'FUNCTION',
+        'cwt' => 'FUNCTION',
+        'cwtext' => 'FUNCTION',
+        'cyclgen' => 'FUNCTION',
+        'cyclpoly' => 'FUNCTION',
+        'cylinder' => 'FUNCTION',
+        'cytobandread' => 'FUNCTION',
+        'czt' => 'FUNCTION',
+        'd2c' => 'FUNCTION',
+        'd2cOptions' => 'FUNCTION',
+        'd2d' => 'FUNCTION',
+        'd2dOptions' => 'FUNCTION',
+        'damp' => 'FUNCTION',
+        'daq' => 'FUNCTION',
+        'daqcallback' => 'FUNCTION',
+        'daqfind' => 'FUNCTION',
+        'daqhelp' => 'FUNCTION',
+        'daqhwinfo' => 'FUNCTION',
+        'daqmem' => 'FUNCTION',
+        'daqread' => 'FUNCTION',
+        'daqregister' => 'FUNCTION',
+        'daqreset' => 'FUNCTION',
+        'dare' => 'FUNCTION',
+        'daspect' => 'FUNCTION',
+        'daspectm' => 'FUNCTION',
+        'Data' => 'FUNCTION',
+        'data2state' => 'FUNCTION',
+        'DataAvailable' => 'FUNCTION',
+        'database' => 'FUNCTION',
+        'datacursormode' => 'FUNCTION',
+        'DataFileTypes' => 'FUNCTION',
+        'DataMatrix' => 'FUNCTION',
+        'DataRequired' => 'FUNCTION',
+        'dataset' => 'FUNCTION',
+        'datasetfun' => 'FUNCTION',
+        'datastats' => 'FUNCTION',
+        'datastream' => 'FUNCTION',
+        'datatipinfo' => 'FUNCTION',
+        'datcomimport' => 'FUNCTION',
+        'date' => 'FUNCTION',
+        'date2time' => 'FUNCTION',
+        'dateaxis' => 'FUNCTION',
+        'datedisp' => 'FUNCTION',
+        'datefind' => 'FUNCTION',
+        'datemnth' => 'FUNCTION',
+        'datenum' => 'FUNCTION',
+        'datestr' => 'FUNCTION',
+        'datetick' => 'FUNCTION',
+        'datevec' => 'FUNCTION',
+        'datewrkdy' => 'FUNCTION',
+        'daugment' => 'FUNCTION',
+        'day' => 'FUNCTION',
+        'dayhoff' => 'FUNCTION',
+        'days360' => 'FUNCTION',
+        'days360e' => 'FUNCTION',
+        'days360isda' => 'FUNCTION',
+        'days360psa' => 'FUNCTION',
+        'days365' => 'FUNCTION',
+        'daysact' => 'FUNCTION',
+        'daysadd' => 'FUNCTION',
+        'daysdif' => 'FUNCTION',
+        'db2mag' => 'FUNCTION',
+        'db2pow' => 'FUNCTION',
+        'dbaux' => 'FUNCTION',
+        'dbclear' => 'FUNCTION',
+        'dbcont' => 'FUNCTION',
+        'dbdown' => 'FUNCTION',
+        'dblquad' => 'FUNCTION',
+        'dbmex' => 'FUNCTION',
+        'dbquit' => 'FUNCTION',
+        'dbstack' => 'FUNCTION',
+        'dbstatus' => 'FUNCTION',
+        'dbstep' => 'FUNCTION',
+        'dbstop' => 'FUNCTION',
+        'dbtype' => 'FUNCTION',
+        'dbup' => 'FUNCTION',
+        'dbwavf' => 'FUNCTION',
+        'dcgain' => 'FUNCTION',
+        'dcm2alphabeta' => 'FUNCTION',
+        'dcm2angle' => 'FUNCTION',
+        'dcm2latlon' => 'FUNCTION',
+        'dcm2quat' => 'FUNCTION',
+        'dcmbody2wind' => 'FUNCTION',
+        'dcmecef2ned' => 'FUNCTION',
+        'dcovary' => 'FUNCTION',
+        'dct' => 'FUNCTION',
+        'dct2' => 'FUNCTION',
+        'dctmtx' => 'FUNCTION',
+        'dcwdata' => 'FUNCTION',
+        'dcwgaz' => 'FUNCTION',
+        'dcwread' => 'FUNCTION',
+        'dcwrhead' => 'FUNCTION',
+        'dde23' => 'FUNCTION',
+        'ddeget' => 'FUNCTION',
+        'ddencmp' => 'FUNCTION',
+        'ddesd' => 'FUNCTION',
+        'ddeset' => 'FUNCTION',
+        'de2bi' => 'FUNCTION',
+        'deadzone' => 'FUNCTION',
+        'deal' => 'FUNCTION',
+        'deblank' => 'FUNCTION',
+        'dec' => 'FUNCTION',
+        'dec2base' => 'FUNCTION',
+        'dec2bin' => 'FUNCTION',
+        'dec2binvec' => 'FUNCTION',
+        'dec2hex' => 'FUNCTION',
+        'dec2mat' => 'FUNCTION',
+        'dec2mvl' => 'FUNCTION',
+        'dec2thirtytwo' => 'FUNCTION',
+        'decay' => 'FUNCTION',
+        'decic' => 'FUNCTION',
+        'decimate' => 'FUNCTION',
+        'decinfo' => 'FUNCTION',
+        'decisioninfo' => 'FUNCTION',
+        'decnbr' => 'FUNCTION',
+        'decode' => 'FUNCTION',
+        'deconv' => 'FUNCTION',
+        'deconvblind' => 'FUNCTION',
+        'deconvlucy' => 'FUNCTION',
+        'deconvreg' => 'FUNCTION',
+        'deconvwnr' => 'FUNCTION',
+        'decorrstretch' => 'FUNCTION',
+        'decsg' => 'FUNCTION',
+        'decyear' => 'FUNCTION',
+        'deembedsparams' => 'FUNCTION',
+        'defaultm' => 'FUNCTION',
+        'DefaultModels' => 'FUNCTION',
+        'defaultParallelConfig' => 'FUNCTION',
+        'defcx' => 'FUNCTION',
+        'DefineNumberOfRecordsPerTest' => 'FUNCTION',
+        'DefineTestGroups' => 'FUNCTION',
+        'defuzz' => 'FUNCTION',
+        'deg2km' => 'FUNCTION',
+        'degrees2dm' => 'FUNCTION',
+        'degrees2dms' => 'FUNCTION',
+        'degtorad' => 'FUNCTION',
+        'deintrlv' => 'FUNCTION',
+        'del2' => 'FUNCTION',
+        'delaunay' => 'FUNCTION',
+        'delaunay3' => 'FUNCTION',
+        'delaunayn' => 'FUNCTION',
+        'DelaunayTri' => 'FUNCTION',
+        'delay2z' => 'FUNCTION',
+        'delayest' => 'FUNCTION',
+        'delayss' => 'FUNCTION',
+        'delete' => 'FUNCTION',
+        'delete_block' => 'FUNCTION',
+        'delete_line' => 'FUNCTION',
+        'delete_param' => 'FUNCTION',
+        'deleteproperty' => 'FUNCTION',
+        'delevent' => 'FUNCTION',
+        'delsample' => 'FUNCTION',
+        'delsamplefromcollection' => 'FUNCTION',
+        'demcmap' => 'FUNCTION',
+        'demdataui' => 'FUNCTION',
+        'demo' => 'FUNCTION',
+        'demod' => 'FUNCTION',
+        'demosaic' => 'FUNCTION',
+        'demote' => 'FUNCTION',
+        'dendrogram' => 'FUNCTION',
+        'denormalize' => 'FUNCTION',
+        'denormalmax' => 'FUNCTION',
+        'denormalmin' => 'FUNCTION',
+        'departure' => 'FUNCTION',
+        'depdir' => 'FUNCTION',
+        'dependnames' => 'FUNCTION',
+        'depfixdb' => 'FUNCTION',
+        'depfun' => 'FUNCTION',
+        'depgendb' => 'FUNCTION',
+        'deployprint' => 'FUNCTION',
+        'deploytool' => 'FUNCTION',
+        'depo2ind' => 'FUNCTION',
+        'deprdv' => 'FUNCTION',
+        'depsoyd' => 'FUNCTION',
+        'depstln' => 'FUNCTION',
+        'derivget' => 'FUNCTION',
+        'derivset' => 'FUNCTION',
+        'design' => 'FUNCTION',
+        'designconstraint' => 'FUNCTION',
+        'designmethods' => 'FUNCTION',
+        'designopts' => 'FUNCTION',
+        'Designs' => 'FUNCTION',
+        'destroy' => 'FUNCTION',
+        'det' => 'FUNCTION',
+        'detachConfigSet' => 'FUNCTION',
+        'DetachData' => 'FUNCTION',
+        'detcoef' => 'FUNCTION',
+        'detcoef2' => 'FUNCTION',
+        'detrend' => 'FUNCTION',
+        'deval' => 'FUNCTION',
+        'devicereset' => 'FUNCTION',
+        'dfe' => 'FUNCTION',
+        'dfeval' => 'FUNCTION',
+        'dfevalasync' => 'FUNCTION',
+        'dfilt' => 'FUNCTION',
+        'dfittool' => 'FUNCTION',
+        'dftmtx' => 'FUNCTION',
+        'diag' => 'FUNCTION',
+        'DiagnosticStatistics' => 'FUNCTION',
+        'dialog' => 'FUNCTION',
+        'diary' => 'FUNCTION',
+        'dicomanon' => 'FUNCTION',
+        'dicomdict' => 'FUNCTION',
+        'dicominfo' => 'FUNCTION',
+        'dicomlookup' => 'FUNCTION',
+        'dicomread' => 'FUNCTION',
+        'dicomuid' => 'FUNCTION',
+        'dicomwrite' => 'FUNCTION',
+        'diff' => 'FUNCTION',
+        'differentiate' => 'FUNCTION',
+        'diffuse' => 'FUNCTION',
+        'diffusion' => 'FUNCTION',
+        'digitalio' => 'FUNCTION',
+        'digitrevorder' => 'FUNCTION',
+        'digits' => 'FUNCTION',
+        'dimercount' => 'FUNCTION',
+        'dir' => 'FUNCTION',
+        'dirac' => 'FUNCTION',
+        'diric' => 'FUNCTION',
+        'disable' => 'FUNCTION',
+        'disableimplicitsignalresolution' => 'FUNCTION',
+        'disc2rate' => 'FUNCTION',
+        'disc2zero' => 'FUNCTION',
+        'disconnect' => 'FUNCTION',
+        'discrate' => 'FUNCTION',
+        'Discrepancy' => 'FUNCTION',
+        'diskinfo' => 'FUNCTION',
+        'disp' => 'FUNCTION',
+        'display' => 'FUNCTION',
+        'displaym' => 'FUNCTION',
+        'displayReport' => 'FUNCTION',
+        'displs' => 'FUNCTION',
+        'dist' => 'FUNCTION',
+        'dist2str' => 'FUNCTION',
+        'distance' => 'FUNCTION',
+        'distdelaynet' => 'FUNCTION',
+        'distortcalc' => 'FUNCTION',
+        'distributed' => 'FUNCTION',
+        'distspec' => 'FUNCTION',
+        'disttool' => 'FUNCTION',
+        'divergence' => 'FUNCTION',
+        'divide' => 'FUNCTION',
+        'dkitopt' => 'FUNCTION',
+        'dksyn' => 'FUNCTION',
+        'dlmread' => 'FUNCTION',
+        'dlmwrite' => 'FUNCTION',
+        'dlqr' => 'FUNCTION',
+        'dlyap' => 'FUNCTION',
+        'dlyapchol' => 'FUNCTION',
+        'dm2degrees' => 'FUNCTION',
+        'dmarrayfun' => 'FUNCTION',
+        'dmbsxfun' => 'FUNCTION',
+        'dmd' => 'FUNCTION',
+        'dmNames' => 'FUNCTION',
+        'dmperm' => 'FUNCTION',
+        'dmplot' => 'FUNCTION',
+        'dms2degrees' => 'FUNCTION',
+        'dmwrite' => 'FUNCTION',
+        'dna2rna' => 'FUNCTION',
+        'dnds' => 'FUNCTION',
+        'dndsml' => 'FUNCTION',
+        'doc' => 'FUNCTION',
+        'docblock' => 'FUNCTION',
+        'docsearch' => 'FUNCTION',
+        'dolayout' => 'FUNCTION',
+        'doppler' => 'FUNCTION',
+        'dos' => 'FUNCTION',
+        'dot' => 'FUNCTION',
+        'dotprod' => 'FUNCTION',
+        'double' => 'FUNCTION',
+        'DoubleInputData' => 'FUNCTION',
+        'DoubleResponseData' => 'FUNCTION',
+        'downsample' => 'FUNCTION',
+        'dpcmdeco' => 'FUNCTION',
+        'dpcmenco' => 'FUNCTION',
+        'dpcmopt' => 'FUNCTION',
+        'dpressure' => 'FUNCTION',
+        'dpskdemod' => 'FUNCTION',
+        'dpskmod' => 'FUNCTION',
+        'dpss' => 'FUNCTION',
+        'dpssclear' => 'FUNCTION',
+        'dpssdir' => 'FUNCTION',
+        'dpssload' => 'FUNCTION',
+        'dragrect' => 'FUNCTION',
+        'drawmag' => 'FUNCTION',
+        'drawnow' => 'FUNCTION',
+        'drawtree' => 'FUNCTION',
+        'dreckon' => 'FUNCTION',
+        'drift' => 'FUNCTION',
+        'driftcorr' => 'FUNCTION',
+        'driftvel' => 'FUNCTION',
+        'driver' => 'FUNCTION',
+        'drivermanager' => 'FUNCTION',
+        'droplevels' => 'FUNCTION',
+        'drss' => 'FUNCTION',
+        'dsearch' => 'FUNCTION',
+        'dsearchn' => 'FUNCTION',
+        'dsigmf' => 'FUNCTION',
+        'dsolve' => 'FUNCTION',
+        'dsort' => 'FUNCTION',
+        'dsp_links' => 'FUNCTION',
+        'dspdata' => 'FUNCTION',
+        'dsplib' => 'FUNCTION',
+        'dspstartup' => 'FUNCTION',
+        'dss' => 'FUNCTION',
+        'dssdata' => 'FUNCTION',
+        'dst' => 'FUNCTION',
+        'dted' => 'FUNCTION',
+        'dteds' => 'FUNCTION',
+        'dtree' => 'FUNCTION',
+        'dummyvar' => 'FUNCTION',
+        'dvbs2ldpc' => 'FUNCTION',
+        'dwt' => 'FUNCTION',
+        'dwt2' => 'FUNCTION',
+        'dwt3' => 'FUNCTION',
+        'dwtest' => 'FUNCTION',
+        'dyaddown' => 'FUNCTION',
+        'dyadup' => 'FUNCTION',
+        'dynamicprops' => 'FUNCTION',
+        'earthRadius' => 'FUNCTION',
+        'ecc2flat' => 'FUNCTION',
+        'ecc2n' => 'FUNCTION',
+        'ecdf' => 'FUNCTION',
+        'ecdfhist' => 'FUNCTION',
+        'ecef2geodetic' => 'FUNCTION',
+        'ecef2lla' => 'FUNCTION',
+        'ecef2lv' => 'FUNCTION',
+        'echo' => 'FUNCTION',
+        'echodemo' => 'FUNCTION',
+        'echotcpip' => 'FUNCTION',
+        'echoudp' => 'FUNCTION',
+        'eclipseide' => 'FUNCTION',
+        'eclipseidesetup' => 'FUNCTION',
+        'ecmlsrmle' => 'FUNCTION',
+        'ecmlsrobj' => 'FUNCTION',
+        'ecmmvnrfish' => 'FUNCTION',
+        'ecmmvnrmle' => 'FUNCTION',
+        'ecmmvnrobj' => 'FUNCTION',
+        'ecmmvnrstd' => 'FUNCTION',
+        'ecmnfish' => 'FUNCTION',
+        'ecmnhess' => 'FUNCTION',
+        'ecmninit' => 'FUNCTION',
+        'ecmnmle' => 'FUNCTION',
+        'ecmnobj' => 'FUNCTION',
+        'ecmnstd' => 'FUNCTION',
+        'edge' => 'FUNCTION',
+        'edgeAttachments' => 'FUNCTION',
+        'edges' => 'FUNCTION',
+        'edgetaper' => 'FUNCTION',
+        'edit' => 'FUNCTION',
+        'effrr' => 'FUNCTION',
+        'egm96geoid' => 'FUNCTION',
+        'eig' => 'FUNCTION',
+        'eigs' => 'FUNCTION',
+        'elementData' => 'FUNCTION',
+        'elementNames' => 'FUNCTION',
+        'elevation' => 'FUNCTION',
+        'ellip' => 'FUNCTION',
+        'ellipap' => 'FUNCTION',
+        'ellipj' => 'FUNCTION',
+        'ellipke' => 'FUNCTION',
+        'ellipord' => 'FUNCTION',
+        'ellipse1' => 'FUNCTION',
+        'ellipsoid' => 'FUNCTION',
+        'elmannet' => 'FUNCTION',
+        'elpm' => 'FUNCTION',
+        'emaxdrawdown' => 'FUNCTION',
+        'emblread' => 'FUNCTION',
+        'emlBlock' => 'FUNCTION',
+        'emlc' => 'FUNCTION',
+        'enable' => 'FUNCTION',
+        'enableCPP' => 'FUNCTION',
+        'enableNETfromNetworkDrive' => 'FUNCTION',
+        'enableservice' => 'FUNCTION',
+        'encode' => 'FUNCTION',
+        'encodem' => 'FUNCTION',
+        'entropy' => 'FUNCTION',
+        'entropyfilt' => 'FUNCTION',
+        'entrupd' => 'FUNCTION',
+        'enumeration' => 'FUNCTION',
+        'eomdate' => 'FUNCTION',
+        'eomday' => 'FUNCTION',
+        'epsm' => 'FUNCTION',
+        'eq' => 'FUNCTION',
+        'eqa2grn' => 'FUNCTION',
+        'eqpprice' => 'FUNCTION',
+        'eqpsens' => 'FUNCTION',
+        'eqptimespec' => 'FUNCTION',
+        'eqptree' => 'FUNCTION',
+        'eqtflength' => 'FUNCTION',
+        'equalize' => 'FUNCTION',
+        'equiripple' => 'FUNCTION',
+        'erf' => 'FUNCTION',
+        'erfc' => 'FUNCTION',
+        'erfcinv' => 'FUNCTION',
+        'erfcx' => 'FUNCTION',
+        'erfinv' => 'FUNCTION',
+        'errmean' => 'FUNCTION',
+        'error' => 'FUNCTION',
+        'errorbar' => 'FUNCTION',
+        'Errorbarseries' => 'FUNCTION',
+        'errordlg' => 'FUNCTION',
+        'ErrorOccurred' => 'FUNCTION',
+        'errpdf' => 'FUNCTION',
+        'errsurf' => 'FUNCTION',
+        'errvar' => 'FUNCTION',
+        'esig' => 'FUNCTION',
+        'esort' => 'FUNCTION',
+        'estim' => 'FUNCTION',
+        'estimateFundamentalMatrix' => 'FUNCTION',
+        'etfe' => 'FUNCTION',
+        'etime' => 'FUNCTION',
+        'etopo' => 'FUNCTION',
+        'etree' => 'FUNCTION',
+        'etreeplot' => 'FUNCTION',
+        'euclidfactors' => 'FUNCTION',
+        'eval' => 'FUNCTION',
+        'evalc' => 'FUNCTION',
+        'evalfis' => 'FUNCTION',
+        'evalfr' => 'FUNCTION',
+        'evalin' => 'FUNCTION',
+        'evallmi' => 'FUNCTION',
+        'evalmf' => 'FUNCTION',
+        'evalrasmolscript' => 'FUNCTION',
+        'evaluate' => 'FUNCTION',
+        'Evaluate' => 'FUNCTION',
+        'evcdf' => 'FUNCTION',
+        'event' => 'FUNCTION',
+        'eventlisteners' => 'FUNCTION',
+        'events' => 'FUNCTION',
+        'evfit' => 'FUNCTION',
+        'evinv' => 'FUNCTION',
+        'evlike' => 'FUNCTION',
+        'evpdf' => 'FUNCTION',
+        'evrnd' => 'FUNCTION',
+        'evstat' => 'FUNCTION',
+        'ewstats' => 'FUNCTION',
+        'excludeCheck' => 'FUNCTION',
+        'excludedata' => 'FUNCTION',
+        'exec' => 'FUNCTION',
+        'Execute' => 'FUNCTION',
+        'exifread' => 'FUNCTION',
+        'exist' => 'FUNCTION',
+        'exit' => 'FUNCTION',
+        'exp' => 'FUNCTION',
+        'expand' => 'FUNCTION',
+        'expcdf' => 'FUNCTION',
+        'expfit' => 'FUNCTION',
+        'expint' => 'FUNCTION',
+        'expinv' => 'FUNCTION',
+        'explike' => 'FUNCTION',
+        'expm' => 'FUNCTION',
+        'expm1' => 'FUNCTION',
+        'exponentbias' => 'FUNCTION',
+        'exponentlength' => 'FUNCTION',
+        'exponentmax' => 'FUNCTION',
+        'exponentmin' => 'FUNCTION',
+        'export' => 'FUNCTION',
+        'Export' => 'FUNCTION',
+        'export2wsdlg' => 'FUNCTION',
+        'exportedkeys' => 'FUNCTION',
+        'ExportToMBCDataStructure' => 'FUNCTION',
+        'exppdf' => 'FUNCTION',
+        'expressions' => 'FUNCTION',
+        'exprnd' => 'FUNCTION',
+        'exprprofrange' => 'FUNCTION',
+        'exprprofvar' => 'FUNCTION',
+        'exprWrite' => 'FUNCTION',
+        'expstat' => 'FUNCTION',
+        'exptData' => 'FUNCTION',
+        'exptInfo' => 'FUNCTION',
+        'extendts' => 'FUNCTION',
+        'extfield' => 'FUNCTION',
+        'extractAll' => 'FUNCTION',
+        'extractfield' => 'FUNCTION',
+        'extractm' => 'FUNCTION',
+        'extractRecent' => 'FUNCTION',
+        'extractTime' => 'FUNCTION',
+        'eye' => 'FUNCTION',
+        'eyediagram' => 'FUNCTION',
+        'EyeScope' => 'FUNCTION',
+        'ezcontour' => 'FUNCTION',
+        'ezcontourf' => 'FUNCTION',
+        'ezmesh' => 'FUNCTION',
+        'ezmeshc' => 'FUNCTION',
+        'ezplot' => 'FUNCTION',
+        'ezplot3' => 'FUNCTION',
+        'ezpolar' => 'FUNCTION',
+        'ezsurf' => 'FUNCTION',
+        'ezsurfc' => 'FUNCTION',
+        'faceNormals' => 'FUNCTION',
+        'factor' => 'FUNCTION',
+        'factoran' => 'FUNCTION',
+        'factorial' => 'FUNCTION',
+        'factset' => 'FUNCTION',
+        'false' => 'FUNCTION',
+        'fan2para' => 'FUNCTION',
+        'fanbeam' => 'FUNCTION',
+        'fastainfo' => 'FUNCTION',
+        'fastaread' => 'FUNCTION',
+        'fastawrite' => 'FUNCTION',
+        'fastqinfo' => 'FUNCTION',
+        'fastqread' => 'FUNCTION',
+        'fastqwrite' => 'FUNCTION',
+        'fbspwavf' => 'FUNCTION',
+        'fbusdate' => 'FUNCTION',
+        'fcat' => 'FUNCTION',
+        'fcdf' => 'FUNCTION',
+        'fclose' => 'FUNCTION',
+        'fcm' => 'FUNCTION',
+        'fdatool' => 'FUNCTION',
+        'fdel' => 'FUNCTION',
+        'fdesign' => 'FUNCTION',
+        'fdhdltool' => 'FUNCTION',
+        'feasp' => 'FUNCTION',
+        'feather' => 'FUNCTION',
+        'featureData' => 'FUNCTION',
+        'featureEdges' => 'FUNCTION',
+        'featureNames' => 'FUNCTION',
+        'featuresmap' => 'FUNCTION',
+        'featuresparse' => 'FUNCTION',
+        'featureVarDesc' => 'FUNCTION',
+        'featureVarNames' => 'FUNCTION',
+        'featureVarValues' => 'FUNCTION',
+        'fec' => 'FUNCTION',
+        'feedback' => 'FUNCTION',
+        'feedforwardnet' => 'FUNCTION',
+        'feof' => 'FUNCTION',
+        'ferror' => 'FUNCTION',
+        'fetch' => 'FUNCTION',
+        'fetchmulti' => 'FUNCTION',
+        'feval' => 'FUNCTION',
+        'Feval' => 'FUNCTION',
+        'ff2n' => 'FUNCTION',
+        'ffplot' => 'FUNCTION',
+        'fft' => 'FUNCTION',
+        'fft2' => 'FUNCTION',
+        'fftcoeffs' => 'FUNCTION',
+        'fftfilt' => 'FUNCTION',
+        'fftn' => 'FUNCTION',
+        'fftshift' => 'FUNCTION',
+        'fftw' => 'FUNCTION',
+        'fganimation' => 'FUNCTION',
+        'fgetl' => 'FUNCTION',
+        'fgets' => 'FUNCTION',
+        'fgoalattain' => 'FUNCTION',
+        'fi' => 'FUNCTION',
+        'fieldnames' => 'FUNCTION',
+        'figToImStream' => 'FUNCTION',
+        'figure' => 'FUNCTION',
+        'figurepalette' => 'FUNCTION',
+        'fileattrib' => 'FUNCTION',
+        'filebrowser' => 'FUNCTION',
+        'fileinfo' => 'FUNCTION',
+        'filemarker' => 'FUNCTION',
+        'Filename' => 'FUNCTION',
+        'fileparts' => 'FUNCTION',
+        'fileread' => 'FUNCTION',
+        'filesep' => 'FUNCTION',
+        'filetable' => 'FUNCTION',
+        'fill' => 'FUNCTION',
+        'fill3' => 'FUNCTION',
+        'fill3m' => 'FUNCTION',
+        'fillm' => 'FUNCTION',
+        'fillProximities' => 'FUNCTION',
+        'fillts' => 'FUNCTION',
+        'filt' => 'FUNCTION',
+        'filt2ls' => 'FUNCTION',
+        'filter' => 'FUNCTION',
+        'filter2' => 'FUNCTION',
+        'filterAcceptRange' => 'FUNCTION',
+        'filterBlockRange' => 'FUNCTION',
+        'filterbuilder' => 'FUNCTION',
+        'filterByFlag' => 'FUNCTION',
+        'filterm' => 'FUNCTION',
+        'filternorm' => 'FUNCTION',
+        'filterReset' => 'FUNCTION',
+        'Filters' => 'FUNCTION',
+        'filterSet' => 'FUNCTION',
+        'filtfilt' => 'FUNCTION',
+        'filtic' => 'FUNCTION',
+        'filtstates' => 'FUNCTION',
+        'fimath' => 'FUNCTION',
+        'find' => 'FUNCTION',
+        'find_mdlrefs' => 'FUNCTION',
+        'find_system' => 'FUNCTION',
+        'findall' => 'FUNCTION',
+        'findbounds' => 'FUNCTION',
+        'findcluster' => 'FUNCTION',
+        'findconstr' => 'FUNCTION',
+        'finddelay' => 'FUNCTION',
+        'finddepend' => 'FUNCTION',
+        'FindDesign' => 'FUNCTION',
+        'findfigs' => 'FUNCTION',
+        'findIncludeFiles' => 'FUNCTION',
+        'findm' => 'FUNCTION',
+        'findobj' => 'FUNCTION',
+        'findop' => 'FUNCTION',
+        'findpar' => 'FUNCTION',
+        'findprop' => 'FUNCTION',
+        'findResource' => 'FUNCTION',
+        'findstartstoptimes' => 'FUNCTION',
+        'findstates' => 'FUNCTION',
+        'findstr' => 'FUNCTION',
+        'findTask' => 'FUNCTION',
+        'finish' => 'FUNCTION',
+        'fints' => 'FUNCTION',
+        'finv' => 'FUNCTION',
+        'finverse' => 'FUNCTION',
+        'fipref' => 'FUNCTION',
+        'fipsname' => 'FUNCTION',
+        'fir1' => 'FUNCTION',
+        'fir2' => 'FUNCTION',
+        'fircband' => 'FUNCTION',
+        'firceqrip' => 'FUNCTION',
+        'fircls' => 'FUNCTION',
+        'fircls1' => 'FUNCTION',
+        'fireqint' => 'FUNCTION',
+        'firgr' => 'FUNCTION',
+        'firhalfband' => 'FUNCTION',
+        'firlp2hp' => 'FUNCTION',
+        'firlp2lp' => 'FUNCTION',
+        'firlpnorm' => 'FUNCTION',
+        'firls' => 'FUNCTION',
+        'firminphase' => 'FUNCTION',
+        'firnyquist' => 'FUNCTION',
+        'firpm' => 'FUNCTION',
+        'firpmord' => 'FUNCTION',
+        'firrcos' => 'FUNCTION',
+        'firtype' => 'FUNCTION',
+        'fit' => 'FUNCTION',
+        'Fit' => 'FUNCTION',
+        'FitAlgorithm' => 'FUNCTION',
+        'fitdist' => 'FUNCTION',
+        'fitfrd' => 'FUNCTION',
+        'fitFunction' => 'FUNCTION',
+        'fitmagfrd' => 'FUNCTION',
+        'fitNelsonSiegel' => 'FUNCTION',
+        'fitnet' => 'FUNCTION',
+        'fitoptions' => 'FUNCTION',
+        'fitsinfo' => 'FUNCTION',
+        'fitSmoothingSpline' => 'FUNCTION',
+        'fitsread' => 'FUNCTION',
+        'fitSvensson' => 'FUNCTION',
+        'Fitted' => 'FUNCTION',
+        'fittype' => 'FUNCTION',
+        'fix' => 'FUNCTION',
+        'fixdt' => 'FUNCTION',
+        'fixedbybdt' => 'FUNCTION',
+        'fixedbybk' => 'FUNCTION',
+        'fixedbyhjm' => 'FUNCTION',
+        'fixedbyhw' => 'FUNCTION',
+        'fixedbyzero' => 'FUNCTION',
+        'FixPoints' => 'FUNCTION',
+        'fixpt_evenspace_cleanup' => 'FUNCTION',
+        'fixpt_instrument_purge' => 'FUNCTION',
+        'fixpt_interp1' => 'FUNCTION',
+        'fixpt_look1_func_approx' => 'FUNCTION',
+        'fixpt_look1_func_plot' => 'FUNCTION',
+        'fixpt_set_all' => 'FUNCTION',
+        'fixptbestexp' => 'FUNCTION',
+        'fixptbestprec' => 'FUNCTION',
+        'fixunknowns' => 'FUNCTION',
+        'flat2ecc' => 'FUNCTION',
+        'flatearthpoly' => 'FUNCTION',
+        'flatnamespace' => 'FUNCTION',
+        'flattopwin' => 'FUNCTION',
+        'flipdim' => 'FUNCTION',
+        'fliplr' => 'FUNCTION',
+        'fliptform' => 'FUNCTION',
+        'flipud' => 'FUNCTION',
+        'float' => 'FUNCTION',
+        'floatbybdt' => 'FUNCTION',
+        'floatbybk' => 'FUNCTION',
+        'floatbyhjm' => 'FUNCTION',
+        'floatbyhw' => 'FUNCTION',
+        'floatbyzero' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'floorbybdt' => 'FUNCTION',
+        'floorbybk' => 'FUNCTION',
+        'floorbyblk' => 'FUNCTION',
+        'floorbyhjm' => 'FUNCTION',
+        'floorbyhw' => 'FUNCTION',
+        'flow' => 'FUNCTION',
+        'flowfanno' => 'FUNCTION',
+        'flowisentropic' => 'FUNCTION',
+        'flownormalshock' => 'FUNCTION',
+        'flowprandtlmeyer' => 'FUNCTION',
+        'flowrayleigh' => 'FUNCTION',
+        'flush' => 'FUNCTION',
+        'flushdata' => 'FUNCTION',
+        'flushinput' => 'FUNCTION',
+        'flushoutput' => 'FUNCTION',
+        'fmdemod' => 'FUNCTION',
+        'fminbnd' => 'FUNCTION',
+        'fmincon' => 'FUNCTION',
+        'fminimax' => 'FUNCTION',
+        'fminsearch' => 'FUNCTION',
+        'fminunc' => 'FUNCTION',
+        'fmmod' => 'FUNCTION',
+        'fn2fm' => 'FUNCTION',
+        'fnbrk' => 'FUNCTION',
+        'fnchg' => 'FUNCTION',
+        'fncmb' => 'FUNCTION',
+        'fnder' => 'FUNCTION',
+        'fndir' => 'FUNCTION',
+        'fnint' => 'FUNCTION',
+        'fnjmp' => 'FUNCTION',
+        'fnmin' => 'FUNCTION',
+        'fnorm' => 'FUNCTION',
+        'fnplt' => 'FUNCTION',
+        'fnrfn' => 'FUNCTION',
+        'fntlr' => 'FUNCTION',
+        'fnval' => 'FUNCTION',
+        'fnxtr' => 'FUNCTION',
+        'fnzeros' => 'FUNCTION',
+        'fopen' => 'FUNCTION',
+        'format' => 'FUNCTION',
+        'formula' => 'FUNCTION',
+        'formwb' => 'FUNCTION',
+        'fortran' => 'FUNCTION',
+        'fourier' => 'FUNCTION',
+        'fpctkd' => 'FUNCTION',
+        'fpdf' => 'FUNCTION',
+        'fpe' => 'FUNCTION',
+        'fpgamodelsetup' => 'FUNCTION',
+        'fplot' => 'FUNCTION',
+        'fprintf' => 'FUNCTION',
+        'frac' => 'FUNCTION',
+        'frac2cur' => 'FUNCTION',
+        'fracfact' => 'FUNCTION',
+        'fracfactgen' => 'FUNCTION',
+        'fractionlength' => 'FUNCTION',
+        'frame2im' => 'FUNCTION',
+        'framem' => 'FUNCTION',
+        'franke' => 'FUNCTION',
+        'frd' => 'FUNCTION',
+        'frdata' => 'FUNCTION',
+        'fread' => 'FUNCTION',
+        'fred' => 'FUNCTION',
+        'freeBoundary' => 'FUNCTION',
+        'freqnum' => 'FUNCTION',
+        'freqresp' => 'FUNCTION',
+        'freqrespest' => 'FUNCTION',
+        'freqrespopts' => 'FUNCTION',
+        'freqs' => 'FUNCTION',
+        'freqsamp' => 'FUNCTION',
+        'freqspace' => 'FUNCTION',
+        'freqstr' => 'FUNCTION',
+        'freqz' => 'FUNCTION',
+        'freqz2' => 'FUNCTION',
+        'frest' => 'FUNCTION',
+        'frestimate' => 'FUNCTION',
+        'frestimateOptions' => 'FUNCTION',
+        'frewind' => 'FUNCTION',
+        'friedman' => 'FUNCTION',
+        'frnd' => 'FUNCTION',
+        'fromDegrees' => 'FUNCTION',
+        'fromnndata' => 'FUNCTION',
+        'fromRadians' => 'FUNCTION',
+        'frontcon' => 'FUNCTION',
+        'frontier' => 'FUNCTION',
+        'fsamp2' => 'FUNCTION',
+        'fscanf' => 'FUNCTION',
+        'fseek' => 'FUNCTION',
+        'fselect' => 'FUNCTION',
+        'fseminf' => 'FUNCTION',
+        'fskdemod' => 'FUNCTION',
+        'fskmod' => 'FUNCTION',
+        'fsolve' => 'FUNCTION',
+        'fspecial' => 'FUNCTION',
+        'fstat' => 'FUNCTION',
+        'fsurfht' => 'FUNCTION',
+        'ftell' => 'FUNCTION',
+        'FTP' => 'FUNCTION',
+        'ftrans2' => 'FUNCTION',
+        'fts2ascii' => 'FUNCTION',
+        'fts2mat' => 'FUNCTION',
+        'ftsbound' => 'FUNCTION',
+        'ftsgui' => 'FUNCTION',
+        'ftsinfo' => 'FUNCTION',
+        'ftstool' => 'FUNCTION',
+        'ftsuniq' => 'FUNCTION',
+        'full' => 'FUNCTION',
+        'fullfact' => 'FUNCTION',
+        'fullfile' => 'FUNCTION',
+        'func2str' => 'FUNCTION',
+        'function_handle' => 'FUNCTION',
+        'functions' => 'FUNCTION',
+        'funm' => 'FUNCTION',
+        'funtool' => 'FUNCTION',
+        'fuzblock' => 'FUNCTION',
+        'fuzzy' => 'FUNCTION',
+        'fvdisc' => 'FUNCTION',
+        'fvfix' => 'FUNCTION',
+        'fvtool' => 'FUNCTION',
+        'fvvar' => 'FUNCTION',
+        'fwd2zero' => 'FUNCTION',
+        'fwht' => 'FUNCTION',
+        'fwind1' => 'FUNCTION',
+        'fwind2' => 'FUNCTION',
+        'fwrite' => 'FUNCTION',
+        'fxptdlg' => 'FUNCTION',
+        'fzero' => 'FUNCTION',
+        'fzmult' => 'FUNCTION',
+        'ga' => 'FUNCTION',
+        'gadd' => 'FUNCTION',
+        'gagerr' => 'FUNCTION',
+        'gallery' => 'FUNCTION',
+        'galread' => 'FUNCTION',
+        'gamcdf' => 'FUNCTION',
+        'gamfit' => 'FUNCTION',
+        'gaminv' => 'FUNCTION',
+        'gamlike' => 'FUNCTION',
+        'gamma' => 'FUNCTION',
+        'gamma2z' => 'FUNCTION',
+        'gammain' => 'FUNCTION',
+        'gammainc' => 'FUNCTION',
+        'gammaincinv' => 'FUNCTION',
+        'gammaln' => 'FUNCTION',
+        'gammaml' => 'FUNCTION',
+        'gammams' => 'FUNCTION',
+        'gampdf' => 'FUNCTION',
+        'gamrnd' => 'FUNCTION',
+        'gamstat' => 'FUNCTION',
+        'gamultiobj' => 'FUNCTION',
+        'gangstr' => 'FUNCTION',
+        'gaoptimget' => 'FUNCTION',
+        'gaoptimset' => 'FUNCTION',
+        'gapbybls' => 'FUNCTION',
+        'gapmetric' => 'FUNCTION',
+        'gapsensbybls' => 'FUNCTION',
+        'garchar' => 'FUNCTION',
+        'garchcount' => 'FUNCTION',
+        'garchdisp' => 'FUNCTION',
+        'garchfit' => 'FUNCTION',
+        'garchget' => 'FUNCTION',
+        'garchinfer' => 'FUNCTION',
+        'garchma' => 'FUNCTION',
+        'garchplot' => 'FUNCTION',
+        'garchpred' => 'FUNCTION',
+        'garchset' => 'FUNCTION',
+        'garchsim' => 'FUNCTION',
+        'gather' => 'FUNCTION',
+        'gauspuls' => 'FUNCTION',
+        'gauss2mf' => 'FUNCTION',
+        'gaussfir' => 'FUNCTION',
+        'gaussmf' => 'FUNCTION',
+        'gausswin' => 'FUNCTION',
+        'gauswavf' => 'FUNCTION',
+        'gbellmf' => 'FUNCTION',
+        'gbm' => 'FUNCTION',
+        'gc2sc' => 'FUNCTION',
+        'gca' => 'FUNCTION',
+        'gcare' => 'FUNCTION',
+        'gcat' => 'FUNCTION',
+        'gcb' => 'FUNCTION',
+        'gcbf' => 'FUNCTION',
+        'gcbh' => 'FUNCTION',
+        'gcbo' => 'FUNCTION',
+        'gcd' => 'FUNCTION',
+        'gcf' => 'FUNCTION',
+        'gcm' => 'FUNCTION',
+        'gco' => 'FUNCTION',
+        'gcpmap' => 'FUNCTION',
+        'gcrma' => 'FUNCTION',
+        'gcrmabackadj' => 'FUNCTION',
+        'gcs' => 'FUNCTION',
+        'gcwaypts' => 'FUNCTION',
+        'gcxgc' => 'FUNCTION',
+        'gcxsc' => 'FUNCTION',
+        'gdare' => 'FUNCTION',
+        'gdivide' => 'FUNCTION',
+        'ge' => 'FUNCTION',
+        'gen2par' => 'FUNCTION',
+        'genbankread' => 'FUNCTION',
+        'geneentropyfilter' => 'FUNCTION',
+        'genelowvalfilter' => 'FUNCTION',
+        'geneont' => 'FUNCTION',
+        'generangefilter' => 'FUNCTION',
+        'Generate' => 'FUNCTION',
+        'generatehdl' => 'FUNCTION',
+        'generatePatches' => 'FUNCTION',
+        'GenerateRunScript' => 'FUNCTION',
+        'generatetb' => 'FUNCTION',
+        'generatetbstimulus' => 'FUNCTION',
+        'generateTimeseries' => 'FUNCTION',
+        'Generator' => 'FUNCTION',
+        'geneticcode' => 'FUNCTION',
+        'genevarfilter' => 'FUNCTION',
+        'genfis1' => 'FUNCTION',
+        'genfis2' => 'FUNCTION',
+        'genfis3' => 'FUNCTION',
+        'genpath' => 'FUNCTION',
+        'genpeptread' => 'FUNCTION',
+        'genphase' => 'FUNCTION',
+        'genqamdemod' => 'FUNCTION',
+        'genqammod' => 'FUNCTION',
+        'gensig' => 'FUNCTION',
+        'gensim' => 'FUNCTION',
+        'genslread' => 'FUNCTION',
+        'genslwrite' => 'FUNCTION',
+        'gensurf' => 'FUNCTION',
+        'genvarname' => 'FUNCTION',
+        'geoc2geod' => 'FUNCTION',
+        'geocdf' => 'FUNCTION',
+        'geocentric2geodeticLat' => 'FUNCTION',
+        'geocradius' => 'FUNCTION',
+        'geod2geoc' => 'FUNCTION',
+        'geodetic2ecef' => 'FUNCTION',
+        'geodetic2geocentricLat' => 'FUNCTION',
+        'geoidegm96' => 'FUNCTION',
+        'geoidheight' => 'FUNCTION',
+        'geoinv' => 'FUNCTION',
+        'geoloc2grid' => 'FUNCTION',
+        'geom2arith' => 'FUNCTION',
+        'geomean' => 'FUNCTION',
+        'Geometry' => 'FUNCTION',
+        'geopdf' => 'FUNCTION',
+        'geornd' => 'FUNCTION',
+        'geoseriesread' => 'FUNCTION',
+        'geoshow' => 'FUNCTION',
+        'geosoftread' => 'FUNCTION',
+        'geostat' => 'FUNCTION',
+        'geotiff2mstruct' => 'FUNCTION',
+        'geotiffinfo' => 'FUNCTION',
+        'geotiffread' => 'FUNCTION',
+        'get' => 'FUNCTION',
+        'get_param' => 'FUNCTION',
+        'getabstime' => 'FUNCTION',
+        'getActiveConfigSet' => 'FUNCTION',
+        'getAlignment' => 'FUNCTION',
+        'getAll' => 'FUNCTION',
+        'getAllOutputArguments' => 'FUNCTION',
+        'GetAllTerms' => 'FUNCTION',
+        'getAlternativeNames' => 'FUNCTION',
+        'getAlternativeTypes' => 'FUNCTION',
+        'getancestors' => 'FUNCTION',
+        'getappdata' => 'FUNCTION',
+        'getArgCategory' => 'FUNCTION',
+        'getArgName' => 'FUNCTION',
+        'getArgPosition' => 'FUNCTION',
+        'getArgQualifier' => 'FUNCTION',
+        'getblast' => 'FUNCTION',
+        'getBlockSimState' => 'FUNCTION',
+        'getbuildopt' => 'FUNCTION',
+        'getbyname' => 'FUNCTION',
+        'getCalibrationComponentNames' => 'FUNCTION',
+        'getCallbackAnnotation' => 'FUNCTION',
+        'getcanonical' => 'FUNCTION',
+        'getCapabilities' => 'FUNCTION',
+        'GetCharArray' => 'FUNCTION',
+        'getClassName' => 'FUNCTION',
+        'getCodistributor' => 'FUNCTION',
+        'getCompactAlignment' => 'FUNCTION',
+        'getCompileFlags' => 'FUNCTION',
+        'getComponentName' => 'FUNCTION',
+        'getComponentNames' => 'FUNCTION',
+        'getConfigSet' => 'FUNCTION',
+        'getConfigSets' => 'FUNCTION',
+        'getCoverage' => 'FUNCTION',
+        'getCoverageInfo' => 'FUNCTION',
+        'getCurrent' => 'FUNCTION',
+        'getCurrentJob' => 'FUNCTION',
+        'getCurrentJobmanager' => 'FUNCTION',
+        'getCurrentTask' => 'FUNCTION',
+        'getCurrentWorker' => 'FUNCTION',
+        'getcurve' => 'FUNCTION',
+        'getdata' => 'FUNCTION',
+        'getdatasamples' => 'FUNCTION',
+        'getdatasamplesize' => 'FUNCTION',
+        'getdatasources' => 'FUNCTION',
+        'getDataTypePackageName' => 'FUNCTION',
+        'getDebugLog' => 'FUNCTION',
+        'getDefaultConf' => 'FUNCTION',
+        'getDefines' => 'FUNCTION',
+        'getDelayInfo' => 'FUNCTION',
+        'getdelaymodel' => 'FUNCTION',
+        'getDependencies' => 'FUNCTION',
+        'getdescendants' => 'FUNCTION',
+        'getDiscountFactors' => 'FUNCTION',
+        'getdisp' => 'FUNCTION',
+        'getedgesbynodeid' => 'FUNCTION',
+        'getelements' => 'FUNCTION',
+        'getembl' => 'FUNCTION',
+        'getEntry' => 'FUNCTION',
+        'getEntryByIndex' => 'FUNCTION',
+        'getEntryByKey' => 'FUNCTION',
+        'getenv' => 'FUNCTION',
+        'geterror' => 'FUNCTION',
+        'getestim' => 'FUNCTION',
+        'getEventType' => 'FUNCTION',
+        'getExecutionPeriod' => 'FUNCTION',
+        'getexp' => 'FUNCTION',
+        'getfield' => 'FUNCTION',
+        'getFile' => 'FUNCTION',
+        'getFileDependencyDir' => 'FUNCTION',
+        'getfilesize' => 'FUNCTION',
+        'getfis' => 'FUNCTION',
+        'getFlag' => 'FUNCTION',
+        'getForwardRates' => 'FUNCTION',
+        'getframe' => 'FUNCTION',
+        'getFullFileList' => 'FUNCTION',
+        'GetFullMatrix' => 'FUNCTION',
+        'getfullname' => 'FUNCTION',
+        'getFunctionName' => 'FUNCTION',
+        'getgenbank' => 'FUNCTION',
+        'getgenpept' => 'FUNCTION',
+        'getgeodata' => 'FUNCTION',
+        'getHeader' => 'FUNCTION',
+        'getheight' => 'FUNCTION',
+        'gethmmalignment' => 'FUNCTION',
+        'gethmmprof' => 'FUNCTION',
+        'gethmmtree' => 'FUNCTION',
+        'getID' => 'FUNCTION',
+        'getimage' => 'FUNCTION',
+        'getimagemodel' => 'FUNCTION',
+        'getImplementationName' => 'FUNCTION',
+        'GetIncludedTerms' => 'FUNCTION',
+        'getIncludeFiles' => 'FUNCTION',
+        'getIncludePaths' => 'FUNCTION',
+        'getIndexByKey' => 'FUNCTION',
+        'getindist' => 'FUNCTION',
+        'getInfo' => 'FUNCTION',
+        'getinit' => 'FUNCTION',
+        'getInitEventName' => 'FUNCTION',
+        'getInitRunnableName' => 'FUNCTION',
+        'getinputstruct' => 'FUNCTION',
+        'getInterfacePackageName' => 'FUNCTION',
+        'getInternalBehaviorName' => 'FUNCTION',
+        'getinterpmethod' => 'FUNCTION',
+        'getIOAutosarPortName' => 'FUNCTION',
+        'getIODataAccessMode' => 'FUNCTION',
+        'getIODataElement' => 'FUNCTION',
+        'getIOErrorStatusReceiver' => 'FUNCTION',
+        'getIOInterfaceName' => 'FUNCTION',
+        'getIOPortNumber' => 'FUNCTION',
+        'getIOServiceInterface' => 'FUNCTION',
+        'getIOServiceName' => 'FUNCTION',
+        'getIOServiceOperation' => 'FUNCTION',
+        'getIsServerOperation' => 'FUNCTION',
+        'getJobSchedulerData' => 'FUNCTION',
+        'getKeys' => 'FUNCTION',
+        'getlabels' => 'FUNCTION',
+        'getlevels' => 'FUNCTION',
+        'getline' => 'FUNCTION',
+        'getlinio' => 'FUNCTION',
+        'getLinkFlags' => 'FUNCTION',
+        'getlinplant' => 'FUNCTION',
+        'getlmis' => 'FUNCTION',
+        'getLocalBoundary' => 'FUNCTION',
+        'getLocalPart' => 'FUNCTION',
+        'getlog' => 'FUNCTION',
+        'getlsb' => 'FUNCTION',
+        'getm' => 'FUNCTION',
+        'getMap' => 'FUNCTION',
+        'getMappingQuality' => 'FUNCTION',
+        'getMatePosition' => 'FUNCTION',
+        'getmatrix' => 'FUNCTION',
+        'getmcruserdata' => 'FUNCTION',
+        'getmpcdata' => 'FUNCTION',
+        'getmsb' => 'FUNCTION',
+        'getname' => 'FUNCTION',
+        'getName' => 'FUNCTION',
+        'getnameidx' => 'FUNCTION',
+        'getnamespace' => 'FUNCTION',
+        'getneighbors' => 'FUNCTION',
+        'getnewickstr' => 'FUNCTION',
+        'getnhood' => 'FUNCTION',
+        'getnodesbyid' => 'FUNCTION',
+        'getNonBuildFiles' => 'FUNCTION',
+        'getNSeqs' => 'FUNCTION',
+        'getNumArgs' => 'FUNCTION',
+        'getoptions' => 'FUNCTION',
+        'getoutdist' => 'FUNCTION',
+        'getOutputData' => 'FUNCTION',
+        'getpar' => 'FUNCTION',
+        'getparam' => 'FUNCTION',
+        'getparamid' => 'FUNCTION',
+        'getparamname' => 'FUNCTION',
+        'getParYields' => 'FUNCTION',
+        'getpdb' => 'FUNCTION',
+        'getPeriodicEventName' => 'FUNCTION',
+        'getPeriodicRunnableName' => 'FUNCTION',
+        'getpixelposition' => 'FUNCTION',
+        'getpref' => 'FUNCTION',
+        'getPreview' => 'FUNCTION',
+        'getpts' => 'FUNCTION',
+        'getQuality' => 'FUNCTION',
+        'getqualitydesc' => 'FUNCTION',
+        'getrangefromclass' => 'FUNCTION',
+        'getrect' => 'FUNCTION',
+        'getReference' => 'FUNCTION',
+        'getreg' => 'FUNCTION',
+        'getrelatives' => 'FUNCTION',
+        'getReport' => 'FUNCTION',
+        'getReportData' => 'FUNCTION',
+        'getsample' => 'FUNCTION',
+        'getsamples' => 'FUNCTION',
+        'getsampleusingtime' => 'FUNCTION',
+        'getSavedSignals' => 'FUNCTION',
+        'getscope' => 'FUNCTION',
+        'getseeds' => 'FUNCTION',
+        'getselectedsource' => 'FUNCTION',
+        'getsequence' => 'FUNCTION',
+        'getSequence' => 'FUNCTION',
+        'getServerInterfaceName' => 'FUNCTION',
+        'getServerOperationPrototype' => 'FUNCTION',
+        'getServerPortName' => 'FUNCTION',
+        'getServerType' => 'FUNCTION',
+        'getsignal' => 'FUNCTION',
+        'getSignal' => 'FUNCTION',
+        'getsignalid' => 'FUNCTION',
+        'getsignalidsfromlabel' => 'FUNCTION',
+        'getsignallabel' => 'FUNCTION',
+        'getsignalname' => 'FUNCTION',
+        'getsignals' => 'FUNCTION',
+        'getSignature' => 'FUNCTION',
+        'getsiminit' => 'FUNCTION',
+        'getsnapshot' => 'FUNCTION',
+        'getSourceFiles' => 'FUNCTION',
+        'getSourcePaths' => 'FUNCTION',
+        'getsro' => 'FUNCTION',
+        'getStart' => 'FUNCTION',
+        'getstatestruct' => 'FUNCTION',
+        'getStepMethodName' => 'FUNCTION',
+        'getStop' => 'FUNCTION',
+        'getSubsequence' => 'FUNCTION',
+        'getSubset' => 'FUNCTION',
+        'getTargetNames' => 'FUNCTION',
+        'getTflArgFromString' => 'FUNCTION',
+        'gettimeseriesnames' => 'FUNCTION',
+        'gettimesteps' => 'FUNCTION',
+        'getTrend' => 'FUNCTION',
+        'getTriggerPortName' => 'FUNCTION',
+        'gettsafteratevent' => 'FUNCTION',
+        'gettsafterevent' => 'FUNCTION',
+        'gettsatevent' => 'FUNCTION',
+        'gettsbeforeatevent' => 'FUNCTION',
+        'gettsbeforeevent' => 'FUNCTION',
+        'gettsbetweenevents' => 'FUNCTION',
+        'getvalue' => 'FUNCTION',
+        'getVar' => 'FUNCTION',
+        'GetVariable' => 'FUNCTION',
+        'getwb' => 'FUNCTION',
+        'GetWorkspaceData' => 'FUNCTION',
+        'getworldfilename' => 'FUNCTION',
+        'getxpcenv' => 'FUNCTION',
+        'getxpcinfo' => 'FUNCTION',
+        'getxpcpci' => 'FUNCTION',
+        'getxu' => 'FUNCTION',
+        'getZeroRates' => 'FUNCTION',
+        'gevcdf' => 'FUNCTION',
+        'gevfit' => 'FUNCTION',
+        'gevinv' => 'FUNCTION',
+        'gevlike' => 'FUNCTION',
+        'gevp' => 'FUNCTION',
+        'gevpdf' => 'FUNCTION',
+        'gevrnd' => 'FUNCTION',
+        'gevstat' => 'FUNCTION',
+        'gf' => 'FUNCTION',
+        'gfadd' => 'FUNCTION',
+        'gfconv' => 'FUNCTION',
+        'gfcosets' => 'FUNCTION',
+        'gfdeconv' => 'FUNCTION',
+        'gfdiv' => 'FUNCTION',
+        'gffilter' => 'FUNCTION',
+        'gflineq' => 'FUNCTION',
+        'gfminpol' => 'FUNCTION',
+        'gfmul' => 'FUNCTION',
+        'gfpretty' => 'FUNCTION',
+        'gfprimck' => 'FUNCTION',
+        'gfprimdf' => 'FUNCTION',
+        'gfprimfd' => 'FUNCTION',
+        'gfrank' => 'FUNCTION',
+        'gfrepcov' => 'FUNCTION',
+        'gfroots' => 'FUNCTION',
+        'gfsub' => 'FUNCTION',
+        'gftable' => 'FUNCTION',
+        'gftrunc' => 'FUNCTION',
+        'gftuple' => 'FUNCTION',
+        'gfweight' => 'FUNCTION',
+        'ghsmulti' => 'FUNCTION',
+        'ghsmulticonfig' => 'FUNCTION',
+        'ginput' => 'FUNCTION',
+        'gline' => 'FUNCTION',
+        'glmfit' => 'FUNCTION',
+        'glmval' => 'FUNCTION',
+        'Global' => 'FUNCTION',
+        'globalfimath' => 'FUNCTION',
+        'globalIndices' => 'FUNCTION',
+        'GlobalModel' => 'FUNCTION',
+        'globedem' => 'FUNCTION',
+        'globedems' => 'FUNCTION',
+        'glyphplot' => 'FUNCTION',
+        'gmdistribution' => 'FUNCTION',
+        'gmonopuls' => 'FUNCTION',
+        'gmres' => 'FUNCTION',
+        'gmultiply' => 'FUNCTION',
+        'gname' => 'FUNCTION',
+        'gnegate' => 'FUNCTION',
+        'goannotread' => 'FUNCTION',
+        'goertzel' => 'FUNCTION',
+        'gonnet' => 'FUNCTION',
+        'gop' => 'FUNCTION',
+        'gpc2mpc' => 'FUNCTION',
+        'gpcdf' => 'FUNCTION',
+        'gpfit' => 'FUNCTION',
+        'gpib' => 'FUNCTION',
+        'gpinv' => 'FUNCTION',
+        'gplike' => 'FUNCTION',
+        'gplot' => 'FUNCTION',
+        'gplotmatrix' => 'FUNCTION',
+        'gplus' => 'FUNCTION',
+        'gppdf' => 'FUNCTION',
+        'gprnd' => 'FUNCTION',
+        'gprread' => 'FUNCTION',
+        'gpstat' => 'FUNCTION',
+        'gpuArray' => 'FUNCTION',
+        'gpuDevice' => 'FUNCTION',
+        'gpuDeviceCount' => 'FUNCTION',
+        'grabcode' => 'FUNCTION',
+        'gradient' => 'FUNCTION',
+        'gradientm' => 'FUNCTION',
+        'gram' => 'FUNCTION',
+        'graphallshortestpaths' => 'FUNCTION',
+        'graphconncomp' => 'FUNCTION',
+        'graphisdag' => 'FUNCTION',
+        'graphisomorphism' => 'FUNCTION',
+        'graphisspantree' => 'FUNCTION',
+        'graphmaxflow' => 'FUNCTION',
+        'graphminspantree' => 'FUNCTION',
+        'graphpred2path' => 'FUNCTION',
+        'graphshortestpath' => 'FUNCTION',
+        'graphtopoorder' => 'FUNCTION',
+        'graphtraverse' => 'FUNCTION',
+        'gravitycentrifugal' => 'FUNCTION',
+        'gravitysphericalharmonic' => 'FUNCTION',
+        'gravitywgs84' => 'FUNCTION',
+        'gravityzonal' => 'FUNCTION',
+        'gray2bin' => 'FUNCTION',
+        'gray2ind' => 'FUNCTION',
+        'graycomatrix' => 'FUNCTION',
+        'graycoprops' => 'FUNCTION',
+        'graymon' => 'FUNCTION',
+        'grayslice' => 'FUNCTION',
+        'graythresh' => 'FUNCTION',
+        'grepfields' => 'FUNCTION',
+        'grid' => 'FUNCTION',
+        'grid2image' => 'FUNCTION',
+        'griddata' => 'FUNCTION',
+        'griddata3' => 'FUNCTION',
+        'griddatan' => 'FUNCTION',
+        'gridm' => 'FUNCTION',
+        'gridtop' => 'FUNCTION',
+        'gridunc' => 'FUNCTION',
+        'gridureal' => 'FUNCTION',
+        'grn2eqa' => 'FUNCTION',
+        'growTrees' => 'FUNCTION',
+        'grp2idx' => 'FUNCTION',
+        'grpdelay' => 'FUNCTION',
+        'grpstats' => 'FUNCTION',
+        'gscatter' => 'FUNCTION',
+        'gshhs' => 'FUNCTION',
+        'gsqrt' => 'FUNCTION',
+        'gsubtract' => 'FUNCTION',
+        'gsvd' => 'FUNCTION',
+        'gt' => 'FUNCTION',
+        'gtext' => 'FUNCTION',
+        'gtextm' => 'FUNCTION',
+        'gtopo30' => 'FUNCTION',
+        'gtopo30s' => 'FUNCTION',
+        'guidata' => 'FUNCTION',
+        'guide' => 'FUNCTION',
+        'guihandles' => 'FUNCTION',
+        'gunzip' => 'FUNCTION',
+        'gzip' => 'FUNCTION',
+        'd' => 'FUNCTION',
+        'h2g' => 'FUNCTION',
+        'h2hinfsyn' => 'FUNCTION',
+        'h2s' => 'FUNCTION',
+        'h2syn' => 'FUNCTION',
+        'h2y' => 'FUNCTION',
+        'h2z' => 'FUNCTION',
+        'hadamard' => 'FUNCTION',
+        'halt' => 'FUNCTION',
+        'haltonset' => 'FUNCTION',
+        'hammgen' => 'FUNCTION',
+        'hamming' => 'FUNCTION',
+        'handle' => 'FUNCTION',
+        'handlem' => 'FUNCTION',
+        'hank2sys' => 'FUNCTION',
+        'hankel' => 'FUNCTION',
+        'hankelmr' => 'FUNCTION',
+        'hankelsv' => 'FUNCTION',
+        'hann' => 'FUNCTION',
+        'hardlim' => 'FUNCTION',
+        'hardlims' => 'FUNCTION',
+        'harmmean' => 'FUNCTION',
+        'hasdelay' => 'FUNCTION',
+        'haver' => 'FUNCTION',
+        'havertool' => 'FUNCTION',
+        'hdf' => 'FUNCTION',
+        'hdf5' => 'FUNCTION',
+        'hdf5info' => 'FUNCTION',
+        'hdf5read' => 'FUNCTION',
+        'hdf5write' => 'FUNCTION',
+        'hdfinfo' => 'FUNCTION',
+        'hdfread' => 'FUNCTION',
+        'hdftool' => 'FUNCTION',
+        'hdladvisor' => 'FUNCTION',
+        'hdlapplycontrolfile' => 'FUNCTION',
+        'hdldaemon' => 'FUNCTION',
+        'hdldispblkparams' => 'FUNCTION',
+        'hdldispmdlparams' => 'FUNCTION',
+        'hdlfilterserialinfo' => 'FUNCTION',
+        'hdlget_param' => 'FUNCTION',
+        'hdllib' => 'FUNCTION',
+        'hdlnewblackbox' => 'FUNCTION',
+        'hdlnewcontrol' => 'FUNCTION',
+        'hdlnewcontrolfile' => 'FUNCTION',
+        'hdlnewforeach' => 'FUNCTION',
+        'hdlset_param' => 'FUNCTION',
+        'hdlsetup' => 'FUNCTION',
+        'hdlsimmatlab' => 'FUNCTION',
+        'hdlsimulink' => 'FUNCTION',
+        'hdrread' => 'FUNCTION',
+        'hdrwrite' => 'FUNCTION',
+        'HeatMap' => 'FUNCTION',
+        'heaviside' => 'FUNCTION',
+        'hedgeopt' => 'FUNCTION',
+        'hedgeslf' => 'FUNCTION',
+        'heldeintrlv' => 'FUNCTION',
+        'helintrlv' => 'FUNCTION',
+        'help' => 'FUNCTION',
+        'helpbrowser' => 'FUNCTION',
+        'helpdlg' => 'FUNCTION',
+        'helpwin' => 'FUNCTION',
+        'helscandeintrlv' => 'FUNCTION',
+        'helscanintrlv' => 'FUNCTION',
+        'hess' => 'FUNCTION',
+        'heston' => 'FUNCTION',
+        'hex' => 'FUNCTION',
+        'hex2dec' => 'FUNCTION',
+        'hex2num' => 'FUNCTION',
+        'hextop' => 'FUNCTION',
+        'hgexport' => 'FUNCTION',
+        'hggroup' => 'FUNCTION',
+        'hgload' => 'FUNCTION',
+        'hgsave' => 'FUNCTION',
+        'hgsetget' => 'FUNCTION',
+        'hgtransform' => 'FUNCTION',
+        'hhigh' => 'FUNCTION',
+        'hidden' => 'FUNCTION',
+        'hide' => 'FUNCTION',
+        'hidem' => 'FUNCTION',
+        'highlow' => 'FUNCTION',
+        'hilb' => 'FUNCTION',
+        'hilbert' => 'FUNCTION',
+        'hilbiir' => 'FUNCTION',
+        'hilite_system' => 'FUNCTION',
+        'hinfgs' => 'FUNCTION',
+        'hinfstruct' => 'FUNCTION',
+        'hinfsyn' => 'FUNCTION',
+        'hist' => 'FUNCTION',
+        'hist3' => 'FUNCTION',
+        'hista' => 'FUNCTION',
+        'histc' => 'FUNCTION',
+        'histeq' => 'FUNCTION',
+        'histfit' => 'FUNCTION',
+        'hjmprice' => 'FUNCTION',
+        'hjmsens' => 'FUNCTION',
+        'hjmtimespec' => 'FUNCTION',
+        'hjmtree' => 'FUNCTION',
+        'hjmvolspec' => 'FUNCTION',
+        'hmmdecode' => 'FUNCTION',
+        'hmmestimate' => 'FUNCTION',
+        'hmmgenerate' => 'FUNCTION',
+        'hmmprofalign' => 'FUNCTION',
+        'hmmprofestimate' => 'FUNCTION',
+        'hmmprofgenerate' => 'FUNCTION',
+        'hmmprofmerge' => 'FUNCTION',
+        'hmmprofstruct' => 'FUNCTION',
+        'hmmtrain' => 'FUNCTION',
+        'hmmviterbi' => 'FUNCTION',
+        'hold' => 'FUNCTION',
+        'holdings2weights' => 'FUNCTION',
+        'holidays' => 'FUNCTION',
+        'home' => 'FUNCTION',
+        'horner' => 'FUNCTION',
+        'horzcat' => 'FUNCTION',
+        'hostid' => 'FUNCTION',
+        'hougen' => 'FUNCTION',
+        'hough' => 'FUNCTION',
+        'houghlines' => 'FUNCTION',
+        'houghpeaks' => 'FUNCTION',
+        'hour' => 'FUNCTION',
+        'hpfilter' => 'FUNCTION',
+        'hsv2rgb' => 'FUNCTION',
+        'hsvd' => 'FUNCTION',
+        'hsvdOptions' => 'FUNCTION',
+        'hsvoptions' => 'FUNCTION',
+        'hsvplot' => 'FUNCTION',
+        'huffmandeco' => 'FUNCTION',
+        'huffmandict' => 'FUNCTION',
+        'huffmanenco' => 'FUNCTION',
+        'hwcalbycap' => 'FUNCTION',
+        'hwcalbyfloor' => 'FUNCTION',
+        'hwprice' => 'FUNCTION',
+        'hwsens' => 'FUNCTION',
+        'hwtimespec' => 'FUNCTION',
+        'hwtree' => 'FUNCTION',
+        'hwv' => 'FUNCTION',
+        'hwvolspec' => 'FUNCTION',
+        'hygecdf' => 'FUNCTION',
+        'hygeinv' => 'FUNCTION',
+        'hygepdf' => 'FUNCTION',
+        'hygernd' => 'FUNCTION',
+        'hygestat' => 'FUNCTION',
+        'hyperbolic' => 'FUNCTION',
+        'hypergeom' => 'FUNCTION',
+        'hypot' => 'FUNCTION',
+        'icceps' => 'FUNCTION',
+        'iccfind' => 'FUNCTION',
+        'iccread' => 'FUNCTION',
+        'iccroot' => 'FUNCTION',
+        'iccwrite' => 'FUNCTION',
+        'icdevice' => 'FUNCTION',
+        'icdf' => 'FUNCTION',
+        'iconnect' => 'FUNCTION',
+        'icsignal' => 'FUNCTION',
+        'idarx' => 'FUNCTION',
+        'idc' => 'FUNCTION',
+        'idct' => 'FUNCTION',
+        'idct2' => 'FUNCTION',
+        'iddata' => 'FUNCTION',
+        'idealfilter' => 'FUNCTION',
+        'ident' => 'FUNCTION',
+        'idfilt' => 'FUNCTION',
+        'idfrd' => 'FUNCTION',
+        'idgrey' => 'FUNCTION',
+        'idinput' => 'FUNCTION',
+        'idivide' => 'FUNCTION',
+        'idmodel' => 'FUNCTION',
+        'idnlarx' => 'FUNCTION',
+        'idnlgrey' => 'FUNCTION',
+        'idnlhw' => 'FUNCTION',
+        'idnlmodel' => 'FUNCTION',
+        'idpoly' => 'FUNCTION',
+        'idproc' => 'FUNCTION',
+        'idresamp' => 'FUNCTION',
+        'idss' => 'FUNCTION',
+        'idwt' => 'FUNCTION',
+        'idwt2' => 'FUNCTION',
+        'idwt3' => 'FUNCTION',
+        'ifanbeam' => 'FUNCTION',
+        'ifft' => 'FUNCTION',
+        'ifft2' => 'FUNCTION',
+        'ifftn' => 'FUNCTION',
+        'ifftshift' => 'FUNCTION',
+        'ifir' => 'FUNCTION',
+        'ifourier' => 'FUNCTION',
+        'ifwht' => 'FUNCTION',
+        'iircomb' => 'FUNCTION',
+        'iirgrpdelay' => 'FUNCTION',
+        'iirlinphase' => 'FUNCTION',
+        'iirlp2bp' => 'FUNCTION',
+        'iirlp2bs' => 'FUNCTION',
+        'iirlp2hp' => 'FUNCTION',
+        'iirlp2lp' => 'FUNCTION',
+        'iirlpnorm' => 'FUNCTION',
+        'iirlpnormc' => 'FUNCTION',
+        'iirnotch' => 'FUNCTION',
+        'iirpeak' => 'FUNCTION',
+        'iirpowcomp' => 'FUNCTION',
+        'ilaplace' => 'FUNCTION',
+        'ilmnbslookup' => 'FUNCTION',
+        'ilmnbsread' => 'FUNCTION',
+        'ilu' => 'FUNCTION',
+        'ilwt' => 'FUNCTION',
+        'ilwt2' => 'FUNCTION',
+        'im2bw' => 'FUNCTION',
+        'im2col' => 'FUNCTION',
+        'im2double' => 'FUNCTION',
+        'im2frame' => 'FUNCTION',
+        'im2int16' => 'FUNCTION',
+        'im2java' => 'FUNCTION',
+        'im2java2d' => 'FUNCTION',
+        'im2single' => 'FUNCTION',
+        'im2uint16' => 'FUNCTION',
+        'im2uint8' => 'FUNCTION',
+        'imabsdiff' => 'FUNCTION',
+        'imadd' => 'FUNCTION',
+        'imadjust' => 'FUNCTION',
+        'imag' => 'FUNCTION',
+        'image' => 'FUNCTION',
+        'ImageAdapter' => 'FUNCTION',
+        'imageinfo' => 'FUNCTION',
+        'imageneread' => 'FUNCTION',
+        'imagesc' => 'FUNCTION',
+        'imapprox' => 'FUNCTION',
+        'imaqfind' => 'FUNCTION',
+        'imaqhelp' => 'FUNCTION',
+        'imaqhwinfo' => 'FUNCTION',
+        'imaqmem' => 'FUNCTION',
+        'imaqmontage' => 'FUNCTION',
+        'imaqreset' => 'FUNCTION',
+        'imaqtool' => 'FUNCTION',
+        'imattributes' => 'FUNCTION',
+        'imbedm' => 'FUNCTION',
+        'imbothat' => 'FUNCTION',
+        'imclearborder' => 'FUNCTION',
+        'imclose' => 'FUNCTION',
+        'imcomplement' => 'FUNCTION',
+        'imcontour' => 'FUNCTION',
+        'imcontrast' => 'FUNCTION',
+        'imcrop' => 'FUNCTION',
+        'imdilate' => 'FUNCTION',
+        'imdisplayrange' => 'FUNCTION',
+        'imdistline' => 'FUNCTION',
+        'imdivide' => 'FUNCTION',
+        'imellipse' => 'FUNCTION',
+        'imerode' => 'FUNCTION',
+        'imextendedmax' => 'FUNCTION',
+        'imextendedmin' => 'FUNCTION',
+        'imfill' => 'FUNCTION',
+        'imfilter' => 'FUNCTION',
+        'imfinfo' => 'FUNCTION',
+        'imformats' => 'FUNCTION',
+        'imfreehand' => 'FUNCTION',
+        'imgca' => 'FUNCTION',
+        'imgcf' => 'FUNCTION',
+        'imgetfile' => 'FUNCTION',
+        'imhandles' => 'FUNCTION',
+        'imhist' => 'FUNCTION',
+        'imhmax' => 'FUNCTION',
+        'imhmin' => 'FUNCTION',
+        'imimposemin' => 'FUNCTION',
+        'imlincomb' => 'FUNCTION',
+        'imline' => 'FUNCTION',
+        'immagbox' => 'FUNCTION',
+        'immovie' => 'FUNCTION',
+        'immultiply' => 'FUNCTION',
+        'imnoise' => 'FUNCTION',
+        'imopen' => 'FUNCTION',
+        'imoverview' => 'FUNCTION',
+        'imoverviewpanel' => 'FUNCTION',
+        'imp2exp' => 'FUNCTION',
+        'imp2ss' => 'FUNCTION',
+        'impinvar' => 'FUNCTION',
+        'impixel' => 'FUNCTION',
+        'impixelinfo' => 'FUNCTION',
+        'impixelinfoval' => 'FUNCTION',
+        'impixelregion' => 'FUNCTION',
+        'impixelregionpanel' => 'FUNCTION',
+        'implay' => 'FUNCTION',
+        'impoint' => 'FUNCTION',
+        'impoly' => 'FUNCTION',
+        'import' => 'FUNCTION',
+        'import_physmod' => 'FUNCTION',
+        'importdata' => 'FUNCTION',
+        'importedkeys' => 'FUNCTION',
+        'ImportFromFile' => 'FUNCTION',
+        'ImportFromMBCDataStructure' => 'FUNCTION',
+        'importParallelConfig' => 'FUNCTION',
+        'improfile' => 'FUNCTION',
+        'impulse' => 'FUNCTION',
+        'impulseplot' => 'FUNCTION',
+        'impvbybjs' => 'FUNCTION',
+        'impvbyblk' => 'FUNCTION',
+        'impvbybls' => 'FUNCTION',
+        'impvbyrgw' => 'FUNCTION',
+        'impyramid' => 'FUNCTION',
+        'impz' => 'FUNCTION',
+        'imread' => 'FUNCTION',
+        'imreconstruct' => 'FUNCTION',
+        'imrect' => 'FUNCTION',
+        'imregionalmax' => 'FUNCTION',
+        'imregionalmin' => 'FUNCTION',
+        'imresize' => 'FUNCTION',
+        'imroi' => 'FUNCTION',
+        'imrotate' => 'FUNCTION',
+        'imscrollpanel' => 'FUNCTION',
+        'imshow' => 'FUNCTION',
+        'imsubtract' => 'FUNCTION',
+        'imtool' => 'FUNCTION',
+        'imtophat' => 'FUNCTION',
+        'imtransform' => 'FUNCTION',
+        'imwrite' => 'FUNCTION',
+        'InBest' => 'FUNCTION',
+        'incenters' => 'FUNCTION',
+        'inconsistent' => 'FUNCTION',
+        'ind2depo' => 'FUNCTION',
+        'ind2gray' => 'FUNCTION',
+        'ind2rgb' => 'FUNCTION',
+        'ind2rgb8' => 'FUNCTION',
+        'ind2sub' => 'FUNCTION',
+        'ind2vec' => 'FUNCTION',
+        'indepnames' => 'FUNCTION',
+        'indexinfo' => 'FUNCTION',
+        'indwt' => 'FUNCTION',
+        'inferiorto' => 'FUNCTION',
+        'info' => 'FUNCTION',
+        'inforatio' => 'FUNCTION',
+        'ingeoquad' => 'FUNCTION',
+        'init' => 'FUNCTION',
+        'initcon' => 'FUNCTION',
+        'initial' => 'FUNCTION',
+        'initialize' => 'FUNCTION',
+        'initialplot' => 'FUNCTION',
+        'initIfNeeded' => 'FUNCTION',
+        'initlay' => 'FUNCTION',
+        'initlvq' => 'FUNCTION',
+        'initmesh' => 'FUNCTION',
+        'initnw' => 'FUNCTION',
+        'initopspec' => 'FUNCTION',
+        'initpar' => 'FUNCTION',
+        'initsompc' => 'FUNCTION',
+        'initwb' => 'FUNCTION',
+        'initzero' => 'FUNCTION',
+        'inline' => 'FUNCTION',
+        'inmem' => 'FUNCTION',
+        'innerprodintbits' => 'FUNCTION',
+        'inOutStatus' => 'FUNCTION',
+        'inpolygon' => 'FUNCTION',
+        'input' => 'FUNCTION',
+        'InputData' => 'FUNCTION',
+        'inputdlg' => 'FUNCTION',
+        'inputm' => 'FUNCTION',
+        'inputname' => 'FUNCTION',
+        'inputParser' => 'FUNCTION',
+        'Inputs' => 'FUNCTION',
+        'InputSetupDialog' => 'FUNCTION',
+        'InputSignalNames' => 'FUNCTION',
+        'inputSingleScan' => 'FUNCTION',
+        'InputsPerLevel' => 'FUNCTION',
+        'insert' => 'FUNCTION',
+        'inspect' => 'FUNCTION',
+        'instadd' => 'FUNCTION',
+        'instaddfield' => 'FUNCTION',
+        'instasian' => 'FUNCTION',
+        'instbarrier' => 'FUNCTION',
+        'instbond' => 'FUNCTION',
+        'instcap' => 'FUNCTION',
+        'instcf' => 'FUNCTION',
+        'instcompound' => 'FUNCTION',
+        'instdelete' => 'FUNCTION',
+        'instdisp' => 'FUNCTION',
+        'instfields' => 'FUNCTION',
+        'instfind' => 'FUNCTION',
+        'instfixed' => 'FUNCTION',
+        'instfloat' => 'FUNCTION',
+        'instfloor' => 'FUNCTION',
+        'instget' => 'FUNCTION',
+        'instgetcell' => 'FUNCTION',
+        'instlength' => 'FUNCTION',
+        'instlookback' => 'FUNCTION',
+        'instoptbnd' => 'FUNCTION',
+        'instoptembnd' => 'FUNCTION',
+        'instoptstock' => 'FUNCTION',
+        'instrcallback' => 'FUNCTION',
+        'instrfind' => 'FUNCTION',
+        'instrfindall' => 'FUNCTION',
+        'instrhelp' => 'FUNCTION',
+        'instrhwinfo' => 'FUNCTION',
+        'instrid' => 'FUNCTION',
+        'instrnotify' => 'FUNCTION',
+        'instrreset' => 'FUNCTION',
+        'instselect' => 'FUNCTION',
+        'instsetfield' => 'FUNCTION',
+        'instswap' => 'FUNCTION',
+        'instswaption' => 'FUNCTION',
+        'insttypes' => 'FUNCTION',
+        'int' => 'FUNCTION',
+        'int16' => 'FUNCTION',
+        'int2aa' => 'FUNCTION',
+        'int2nt' => 'FUNCTION',
+        'int2str' => 'FUNCTION',
+        'int32' => 'FUNCTION',
+        'int64' => 'FUNCTION',
+        'int8' => 'FUNCTION',
+        'intdump' => 'FUNCTION',
+        'integrate' => 'FUNCTION',
+        'intenvget' => 'FUNCTION',
+        'intenvprice' => 'FUNCTION',
+        'intenvsens' => 'FUNCTION',
+        'intenvset' => 'FUNCTION',
+        'interactionplot' => 'FUNCTION',
+        'interfaces' => 'FUNCTION',
+        'interfileinfo' => 'FUNCTION',
+        'interfileread' => 'FUNCTION',
+        'interp' => 'FUNCTION',
+        'interp1' => 'FUNCTION',
+        'interp1q' => 'FUNCTION',
+        'interp2' => 'FUNCTION',
+        'interp3' => 'FUNCTION',
+        'interpft' => 'FUNCTION',
+        'interpm' => 'FUNCTION',
+        'interpn' => 'FUNCTION',
+        'interpolate' => 'FUNCTION',
+        'interpstreamspeed' => 'FUNCTION',
+        'intersect' => 'FUNCTION',
+        'intersectgeoquad' => 'FUNCTION',
+        'intfilt' => 'FUNCTION',
+        'intlut' => 'FUNCTION',
+        'intrlv' => 'FUNCTION',
+        'intrplat' => 'FUNCTION',
+        'intrplon' => 'FUNCTION',
+        'intwave' => 'FUNCTION',
+        'inv' => 'FUNCTION',
+        'invfreqs' => 'FUNCTION',
+        'invfreqz' => 'FUNCTION',
+        'invhilb' => 'FUNCTION',
+        'invoke' => 'FUNCTION',
+        'invpred' => 'FUNCTION',
+        'iopzmap' => 'FUNCTION',
+        'iopzplot' => 'FUNCTION',
+        'ipermute' => 'FUNCTION',
+        'ippl' => 'FUNCTION',
+        'iptaddcallback' => 'FUNCTION',
+        'iptcheckconn' => 'FUNCTION',
+        'iptcheckhandle' => 'FUNCTION',
+        'iptcheckinput' => 'FUNCTION',
+        'iptcheckmap' => 'FUNCTION',
+        'iptchecknargin' => 'FUNCTION',
+        'iptcheckstrs' => 'FUNCTION',
+        'iptdemos' => 'FUNCTION',
+        'iptgetapi' => 'FUNCTION',
+        'iptGetPointerBehavior' => 'FUNCTION',
+        'iptgetpref' => 'FUNCTION',
+        'ipticondir' => 'FUNCTION',
+        'iptnum2ordinal' => 'FUNCTION',
+        'iptPointerManager' => 'FUNCTION',
+        'iptprefs' => 'FUNCTION',
+        'iptremovecallback' => 'FUNCTION',
+        'iptSetPointerBehavior' => 'FUNCTION',
+        'iptsetpref' => 'FUNCTION',
+        'iptwindowalign' => 'FUNCTION',
+        'iqr' => 'FUNCTION',
+        'iradon' => 'FUNCTION',
+        'IRBootstrapOptions' => 'FUNCTION',
+        'IRDataCurve' => 'FUNCTION',
+        'IRFitOptions' => 'FUNCTION',
+        'IRFunctionCurve' => 'FUNCTION',
+        'irr' => 'FUNCTION',
+        'is' => 'FUNCTION',
+        'is2rc' => 'FUNCTION',
+        'isa' => 'FUNCTION',
+        'isafin' => 'FUNCTION',
+        'isallpass' => 'FUNCTION',
+        'IsAlternative' => 'FUNCTION',
+        'isappdata' => 'FUNCTION',
+        'isaUnderlying' => 'FUNCTION',
+        'IsBeingEdited' => 'FUNCTION',
+        'isboolean' => 'FUNCTION',
+        'isbranch' => 'FUNCTION',
+        'isbusday' => 'FUNCTION',
+        'iscatastrophic' => 'FUNCTION',
+        'iscell' => 'FUNCTION',
+        'iscellstr' => 'FUNCTION',
+        'ischannel' => 'FUNCTION',
+        'ischar' => 'FUNCTION',
+        'iscolumn' => 'FUNCTION',
+        'iscom' => 'FUNCTION',
+        'iscompatible' => 'FUNCTION',
+        'isComplete' => 'FUNCTION',
+        'isconfigured' => 'FUNCTION',
+        'isconnection' => 'FUNCTION',
+        'isct' => 'FUNCTION',
+        'isdag' => 'FUNCTION',
+        'isdeployed' => 'FUNCTION',
+        'isdioline' => 'FUNCTION',
+        'isdir' => 'FUNCTION',
+        'isdouble' => 'FUNCTION',
+        'isdriver' => 'FUNCTION',
+        'isEdge' => 'FUNCTION',
+        'IsEditable' => 'FUNCTION',
+        'isempty' => 'FUNCTION',
+        'isenabled' => 'FUNCTION',
+        'isEqLagOp' => 'FUNCTION',
+        'isequal' => 'FUNCTION',
+        'isequalwithequalnans' => 'FUNCTION',
+        'isevent' => 'FUNCTION',
+        'isfi' => 'FUNCTION',
+        'isfield' => 'FUNCTION',
+        'isfilterseparable' => 'FUNCTION',
+        'isfimath' => 'FUNCTION',
+        'isfimathlocal' => 'FUNCTION',
+        'isfinite' => 'FUNCTION',
+        'isfipref' => 'FUNCTION',
+        'isfir' => 'FUNCTION',
+        'isfixed' => 'FUNCTION',
+        'isflat' => 'FUNCTION',
+        'isfloat' => 'FUNCTION',
+        'isglobal' => 'FUNCTION',
+        'ishandle' => 'FUNCTION',
+        'ishghandle' => 'FUNCTION',
+        'ishold' => 'FUNCTION',
+        'isicc' => 'FUNCTION',
+        'isinf' => 'FUNCTION',
+        'isinteger' => 'FUNCTION',
+        'isinterface' => 'FUNCTION',
+        'isjava' => 'FUNCTION',
+        'isjdbc' => 'FUNCTION',
+        'isKey' => 'FUNCTION',
+        'iskeyword' => 'FUNCTION',
+        'isletter' => 'FUNCTION',
+        'islevel' => 'FUNCTION',
+        'islinear' => 'FUNCTION',
+        'islinphase' => 'FUNCTION',
+        'islogging' => 'FUNCTION',
+        'islogical' => 'FUNCTION',
+        'ismac' => 'FUNCTION',
+        'ismap' => 'FUNCTION',
+        'ismapped' => 'FUNCTION',
+        'ismatrix' => 'FUNCTION',
+        'ismaxphase' => 'FUNCTION',
+        'ismcc' => 'FUNCTION',
+        'ismember' => 'FUNCTION',
+        'ismethod' => 'FUNCTION',
+        'isminphase' => 'FUNCTION',
+        'isnan' => 'FUNCTION',
+        'isnode' => 'FUNCTION',
+        'isNonZero' => 'FUNCTION',
+        'isnullcolumn' => 'FUNCTION',
+        'isnumeric' => 'FUNCTION',
+        'isnumerictype' => 'FUNCTION',
+        'isobject' => 'FUNCTION',
+        'isocaps' => 'FUNCTION',
+        'isocolors' => 'FUNCTION',
+        'isoelectric' => 'FUNCTION',
+        'isomorphism' => 'FUNCTION',
+        'isonormals' => 'FUNCTION',
+        'isosurface' => 'FUNCTION',
+        'isotopicdist' => 'FUNCTION',
+        'ispassive' => 'FUNCTION',
+        'ispc' => 'FUNCTION',
+        'ispolycw' => 'FUNCTION',
+        'ispref' => 'FUNCTION',
+        'isprime' => 'FUNCTION',
+        'isprimitive' => 'FUNCTION',
+        'isprop' => 'FUNCTION',
+        'ispropequal' => 'FUNCTION',
+        'isproper' => 'FUNCTION',
+        'ispsys' => 'FUNCTION',
+        'isquantizer' => 'FUNCTION',
+        'isreadable' => 'FUNCTION',
+        'isreadonly' => 'FUNCTION',
+        'isreal' => 'FUNCTION',
+        'isreplicated' => 'FUNCTION',
+        'isrow' => 'FUNCTION',
+        'isrset' => 'FUNCTION',
+        'isrtdxcapable' => 'FUNCTION',
+        'isrunning' => 'FUNCTION',
+        'isscalar' => 'FUNCTION',
+        'isscaleddouble' => 'FUNCTION',
+        'isscaledtype' => 'FUNCTION',
+        'isscalingbinarypoint' => 'FUNCTION',
+        'isscalingslopebias' => 'FUNCTION',
+        'isscalingunspecified' => 'FUNCTION',
+        'issending' => 'FUNCTION',
+        'isShapeMultipart' => 'FUNCTION',
+        'isSignal' => 'FUNCTION',
+        'issigned' => 'FUNCTION',
+        'issingle' => 'FUNCTION',
+        'issiso' => 'FUNCTION',
+        'isslopebiasscaled' => 'FUNCTION',
+        'issorted' => 'FUNCTION',
+        'issos' => 'FUNCTION',
+        'isspace' => 'FUNCTION',
+        'isspantree' => 'FUNCTION',
+        'issparse' => 'FUNCTION',
+        'isstable' => 'FUNCTION',
+        'isStable' => 'FUNCTION',
+        'isstr' => 'FUNCTION',
+        'isstrprop' => 'FUNCTION',
+        'isstruct' => 'FUNCTION',
+        'isstudent' => 'FUNCTION',
+        'istnode' => 'FUNCTION',
+        'istrellis' => 'FUNCTION',
+        'isuncertain' => 'FUNCTION',
+        'isundefined' => 'FUNCTION',
+        'isunix' => 'FUNCTION',
+        'isurl' => 'FUNCTION',
+        'isvalid' => 'FUNCTION',
+        'isvarname' => 'FUNCTION',
+        'isvector' => 'FUNCTION',
+        'isvisible' => 'FUNCTION',
+        'iswritable' => 'FUNCTION',
+        'iswt' => 'FUNCTION',
+        'iswt2' => 'FUNCTION',
+        'Item' => 'FUNCTION',
+        'ittprice' => 'FUNCTION',
+        'ittsens' => 'FUNCTION',
+        'itttimespec' => 'FUNCTION',
+        'itttree' => 'FUNCTION',
+        'iv4' => 'FUNCTION',
+        'ivar' => 'FUNCTION',
+        'iviconfigurationstore' => 'FUNCTION',
+        'ivstruc' => 'FUNCTION',
+        'ivx' => 'FUNCTION',
+        'iwishrnd' => 'FUNCTION',
+        'iztrans' => 'FUNCTION',
+        'jackknife' => 'FUNCTION',
+        'jacobian' => 'FUNCTION',
+        'Jacobian' => 'FUNCTION',
+        'javaaddpath' => 'FUNCTION',
+        'javaArray' => 'FUNCTION',
+        'javachk' => 'FUNCTION',
+        'javaclasspath' => 'FUNCTION',
+        'javaMethod' => 'FUNCTION',
+        'javaMethodEDT' => 'FUNCTION',
+        'javaObject' => 'FUNCTION',
+        'javaObjectEDT' => 'FUNCTION',
+        'javarmpath' => 'FUNCTION',
+        'jbtest' => 'FUNCTION',
+        'jcampread' => 'FUNCTION',
+        'jigglemesh' => 'FUNCTION',
+        'jobStartup' => 'FUNCTION',
+        'johnsrnd' => 'FUNCTION',
+        'join' => 'FUNCTION',
+        'joinseq' => 'FUNCTION',
+        'jordan' => 'FUNCTION',
+        'juliandate' => 'FUNCTION',
+        'kagi' => 'FUNCTION',
+        'kaiser' => 'FUNCTION',
+        'kaiserord' => 'FUNCTION',
+        'kaiserwin' => 'FUNCTION',
+        'kalman' => 'FUNCTION',
+        'kalmd' => 'FUNCTION',
+        'keyboard' => 'FUNCTION',
+        'keys' => 'FUNCTION',
+        'km2deg' => 'FUNCTION',
+        'km2nm' => 'FUNCTION',
+        'km2rad' => 'FUNCTION',
+        'kmeans' => 'FUNCTION',
+        'kmlwrite' => 'FUNCTION',
+        'knnclassify' => 'FUNCTION',
+        'knnimpute' => 'FUNCTION',
+        'knnsearch' => 'FUNCTION',
+        'knt2brk' => 'FUNCTION',
+        'kpsstest' => 'FUNCTION',
+        'kron' => 'FUNCTION',
+        'kruskalwallis' => 'FUNCTION',
+        'ksdensity' => 'FUNCTION',
+        'kstest' => 'FUNCTION',
+        'kstest2' => 'FUNCTION',
+        'ktrlink' => 'FUNCTION',
+        'kurtosis' => 'FUNCTION',
+        'kx' => 'FUNCTION',
+        'lab2double' => 'FUNCTION',
+        'lab2uint16' => 'FUNCTION',
+        'lab2uint8' => 'FUNCTION',
+        'labBarrier' => 'FUNCTION',
+        'labBroadcast' => 'FUNCTION',
+        'label2rgb' => 'FUNCTION',
+        'labindex' => 'FUNCTION',
+        'labProbe' => 'FUNCTION',
+        'labReceive' => 'FUNCTION',
+        'labSend' => 'FUNCTION',
+        'labSendReceive' => 'FUNCTION',
+        'lagmatrix' => 'FUNCTION',
+        'LagOp' => 'FUNCTION',
+        'lagts' => 'FUNCTION',
+        'lambertw' => 'FUNCTION',
+        'laplace' => 'FUNCTION',
+        'lar2rc' => 'FUNCTION',
+        'last' => 'FUNCTION',
+        'lastwarn' => 'FUNCTION',
+        'latc2tf' => 'FUNCTION',
+        'latcfilt' => 'FUNCTION',
+        'latex' => 'FUNCTION',
+        'latlon2pix' => 'FUNCTION',
+        'launchDiscovery' => 'FUNCTION',
+        'laurmat' => 'FUNCTION',
+        'laurpoly' => 'FUNCTION',
+        'layrecnet' => 'FUNCTION',
+        'lbqtest' => 'FUNCTION',
+        'lbusdate' => 'FUNCTION',
+        'lcm' => 'FUNCTION',
+        'lcolorbar' => 'FUNCTION',
+        'ldivide' => 'FUNCTION',
+        'ldl' => 'FUNCTION',
+        'le' => 'FUNCTION',
+        'leadts' => 'FUNCTION',
+        'leapyear' => 'FUNCTION',
+        'learncon' => 'FUNCTION',
+        'learngd' => 'FUNCTION',
+        'learngdm' => 'FUNCTION',
+        'learnh' => 'FUNCTION',
+        'learnhd' => 'FUNCTION',
+        'learnis' => 'FUNCTION',
+        'learnk' => 'FUNCTION',
+        'learnlv1' => 'FUNCTION',
+        'learnlv2' => 'FUNCTION',
+        'learnos' => 'FUNCTION',
+        'learnp' => 'FUNCTION',
+        'learnpn' => 'FUNCTION',
+        'learnsom' => 'FUNCTION',
+        'learnsomb' => 'FUNCTION',
+        'learnwh' => 'FUNCTION',
+        'leaves' => 'FUNCTION',
+        'legacy_code' => 'FUNCTION',
+        'legacychannelsim' => 'FUNCTION',
+        'legend' => 'FUNCTION',
+        'legendre' => 'FUNCTION',
+        'legs' => 'FUNCTION',
+        'length' => 'FUNCTION',
+        'Level' => 'FUNCTION',
+        'levelcounts' => 'FUNCTION',
+        'Levels' => 'FUNCTION',
+        'leverage' => 'FUNCTION',
+        'levinson' => 'FUNCTION',
+        'lft' => 'FUNCTION',
+        'lftdata' => 'FUNCTION',
+        'lhsdesign' => 'FUNCTION',
+        'lhsnorm' => 'FUNCTION',
+        'libfunctions' => 'FUNCTION',
+        'libfunctionsview' => 'FUNCTION',
+        'libinfo' => 'FUNCTION',
+        'libisloaded' => 'FUNCTION',
+        'liblinks' => 'FUNCTION',
+        'liborduration' => 'FUNCTION',
+        'liborfloat2fixed' => 'FUNCTION',
+        'liborprice' => 'FUNCTION',
+        'libpointer' => 'FUNCTION',
+        'libstruct' => 'FUNCTION',
+        'license' => 'FUNCTION',
+        'liftfilt' => 'FUNCTION',
+        'liftwave' => 'FUNCTION',
+        'light' => 'FUNCTION',
+        'lightangle' => 'FUNCTION',
+        'lighting' => 'FUNCTION',
+        'lightm' => 'FUNCTION',
+        'lightmui' => 'FUNCTION',
+        'lillietest' => 'FUNCTION',
+        'limit' => 'FUNCTION',
+        'limitcycle' => 'FUNCTION',
+        'limitm' => 'FUNCTION',
+        'lin2mu' => 'FUNCTION',
+        'linapp' => 'FUNCTION',
+        'line' => 'FUNCTION',
+        'linear' => 'FUNCTION',
+        'lineareq' => 'FUNCTION',
+        'linearize' => 'FUNCTION',
+        'linearlayer' => 'FUNCTION',
+        'linebreak' => 'FUNCTION',
+        'linecirc' => 'FUNCTION',
+        'linem' => 'FUNCTION',
+        'Lineseries' => 'FUNCTION',
+        'LineSpec' => 'FUNCTION',
+        'linhyptest' => 'FUNCTION',
+        'linio' => 'FUNCTION',
+        'linkage' => 'FUNCTION',
+        'linkaxes' => 'FUNCTION',
+        'linkdata' => 'FUNCTION',
+        'linkdist' => 'FUNCTION',
+        'linkprop' => 'FUNCTION',
+        'linlft' => 'FUNCTION',
+        'linlftfold' => 'FUNCTION',
+        'linmod' => 'FUNCTION',
+        'linoptions' => 'FUNCTION',
+        'linprog' => 'FUNCTION',
+        'linsolve' => 'FUNCTION',
+        'linspace' => 'FUNCTION',
+        'list' => 'FUNCTION',
+        'listdlg' => 'FUNCTION',
+        'listfonts' => 'FUNCTION',
+        'listsessions' => 'FUNCTION',
+        'lla2ecef' => 'FUNCTION',
+        'llow' => 'FUNCTION',
+        'lloyds' => 'FUNCTION',
+        'lmctest' => 'FUNCTION',
+        'lmiedit' => 'FUNCTION',
+        'lmiinfo' => 'FUNCTION',
+        'lminbr' => 'FUNCTION',
+        'lmiterm' => 'FUNCTION',
+        'lmivar' => 'FUNCTION',
+        'lms' => 'FUNCTION',
+        'lmtest' => 'FUNCTION',
+        'load' => 'FUNCTION',
+        'Load' => 'FUNCTION',
+        'load_system' => 'FUNCTION',
+        'loadlibrary' => 'FUNCTION',
+        'loadobj' => 'FUNCTION',
+        'loadparamset' => 'FUNCTION',
+        'LoadProject' => 'FUNCTION',
+        'Local' => 'FUNCTION',
+        'localalign' => 'FUNCTION',
+        'LocalBoundaries' => 'FUNCTION',
+        'localmax' => 'FUNCTION',
+        'LocalModel' => 'FUNCTION',
+        'LocalResponses' => 'FUNCTION',
+        'log' => 'FUNCTION',
+        'log10' => 'FUNCTION',
+        'log1p' => 'FUNCTION',
+        'log2' => 'FUNCTION',
+        'logical' => 'FUNCTION',
+        'logintimeout' => 'FUNCTION',
+        'loglog' => 'FUNCTION',
+        'logm' => 'FUNCTION',
+        'logncdf' => 'FUNCTION',
+        'lognfit' => 'FUNCTION',
+        'logninv' => 'FUNCTION',
+        'lognlike' => 'FUNCTION',
+        'lognpdf' => 'FUNCTION',
+        'lognrnd' => 'FUNCTION',
+        'lognstat' => 'FUNCTION',
+        'logreport' => 'FUNCTION',
+        'logsig' => 'FUNCTION',
+        'logspace' => 'FUNCTION',
+        'lookbackbycrr' => 'FUNCTION',
+        'lookbackbyeqp' => 'FUNCTION',
+        'lookbackbyitt' => 'FUNCTION',
+        'lookfor' => 'FUNCTION',
+        'loopmargin' => 'FUNCTION',
+        'loopsens' => 'FUNCTION',
+        'loopsyn' => 'FUNCTION',
+        'los2' => 'FUNCTION',
+        'lower' => 'FUNCTION',
+        'lowerbound' => 'FUNCTION',
+        'lowerparams' => 'FUNCTION',
+        'lp2bp' => 'FUNCTION',
+        'lp2bs' => 'FUNCTION',
+        'lp2hp' => 'FUNCTION',
+        'lp2lp' => 'FUNCTION',
+        'lpc' => 'FUNCTION',
+        'lpm' => 'FUNCTION',
+        'lqg' => 'FUNCTION',
+        'lqgreg' => 'FUNCTION',
+        'lqgtrack' => 'FUNCTION',
+        'lqi' => 'FUNCTION',
+        'lqr' => 'FUNCTION',
+        'lqrd' => 'FUNCTION',
+        'lqry' => 'FUNCTION',
+        'lratiotest' => 'FUNCTION',
+        'lrtimespec' => 'FUNCTION',
+        'lrtree' => 'FUNCTION',
+        'ls' => 'FUNCTION',
+        'ls2filt' => 'FUNCTION',
+        'lsb' => 'FUNCTION',
+        'lscov' => 'FUNCTION',
+        'lsf2poly' => 'FUNCTION',
+        'lsim' => 'FUNCTION',
+        'lsiminfo' => 'FUNCTION',
+        'lsinfo' => 'FUNCTION',
+        'lsline' => 'FUNCTION',
+        'lsqcurvefit' => 'FUNCTION',
+        'lsqlin' => 'FUNCTION',
+        'lsqnonlin' => 'FUNCTION',
+        'lsqnonneg' => 'FUNCTION',
+        'lsqr' => 'FUNCTION',
+        'lt' => 'FUNCTION',
+        'LTI' => 'FUNCTION',
+        'lti' => 'FUNCTION',
+        'ltiblock' => 'FUNCTION',
+        'ltimodels' => 'FUNCTION',
+        'ltiprops' => 'FUNCTION',
+        'ltiview' => 'FUNCTION',
+        'ltln2val' => 'FUNCTION',
+        'ltrsyn' => 'FUNCTION',
+        'lu' => 'FUNCTION',
+        'luinc' => 'FUNCTION',
+        'lv2ecef' => 'FUNCTION',
+        'lvqnet' => 'FUNCTION',
+        'lvqoutputs' => 'FUNCTION',
+        'lweekdate' => 'FUNCTION',
+        'lwt' => 'FUNCTION',
+        'lwt2' => 'FUNCTION',
+        'lwtcoef' => 'FUNCTION',
+        'lwtcoef2' => 'FUNCTION',
+        'lyap' => 'FUNCTION',
+        'lyapchol' => 'FUNCTION',
+        'm2xdate' => 'FUNCTION',
+        'maboxplot' => 'FUNCTION',
+        'macaddr' => 'FUNCTION',
+        'macd' => 'FUNCTION',
+        'machnumber' => 'FUNCTION',
+        'mad' => 'FUNCTION',
+        'mae' => 'FUNCTION',
+        'mafdr' => 'FUNCTION',
+        'mag2db' => 'FUNCTION',
+        'magetfield' => 'FUNCTION',
+        'magic' => 'FUNCTION',
+        'mahal' => 'FUNCTION',
+        'maimage' => 'FUNCTION',
+        'maineffectsplot' => 'FUNCTION',
+        'mainvarsetnorm' => 'FUNCTION',
+        'mairplot' => 'FUNCTION',
+        'majaxis' => 'FUNCTION',
+        'makeattribspec' => 'FUNCTION',
+        'makecform' => 'FUNCTION',
+        'makeConstrainToRectFcn' => 'FUNCTION',
+        'makeDefault' => 'FUNCTION',
+        'makefpgaproject' => 'FUNCTION',
+        'makehdl' => 'FUNCTION',
+        'makehdltb' => 'FUNCTION',
+        'makehdr' => 'FUNCTION',
+        'makehgtform' => 'FUNCTION',
+        'MakeHierarchicalResponse' => 'FUNCTION',
+        'makelut' => 'FUNCTION',
+        'makemapped' => 'FUNCTION',
+        'makemid' => 'FUNCTION',
+        'makenames' => 'FUNCTION',
+        'makepassive' => 'FUNCTION',
+        'makepublic' => 'FUNCTION',
+        'makerefmat' => 'FUNCTION',
+        'makeresampler' => 'FUNCTION',
+        'makesymbolspec' => 'FUNCTION',
+        'maketform' => 'FUNCTION',
+        'maloglog' => 'FUNCTION',
+        'malowess' => 'FUNCTION',
+        'mandist' => 'FUNCTION',
+        'manorm' => 'FUNCTION',
+        'manova1' => 'FUNCTION',
+        'manovacluster' => 'FUNCTION',
+        'map2pix' => 'FUNCTION',
+        'mapbbox' => 'FUNCTION',
+        'mapcaplot' => 'FUNCTION',
+        'maplist' => 'FUNCTION',
+        'mapminmax' => 'FUNCTION',
+        'mapoutline' => 'FUNCTION',
+        'mapprofile' => 'FUNCTION',
+        'maps' => 'FUNCTION',
+        'mapshow' => 'FUNCTION',
+        'mapstd' => 'FUNCTION',
+        'maptool' => 'FUNCTION',
+        'maptrim' => 'FUNCTION',
+        'maptriml' => 'FUNCTION',
+        'maptrimp' => 'FUNCTION',
+        'maptrims' => 'FUNCTION',
+        'mapview' => 'FUNCTION',
+        'marcumq' => 'FUNCTION',
+        'margin' => 'FUNCTION',
+        'mask2shift' => 'FUNCTION',
+        'mat2cell' => 'FUNCTION',
+        'mat2dec' => 'FUNCTION',
+        'mat2gray' => 'FUNCTION',
+        'mat2str' => 'FUNCTION',
+        'MatchInputs' => 'FUNCTION',
+        'matdeintrlv' => 'FUNCTION',
+        'material' => 'FUNCTION',
+        'matintrlv' => 'FUNCTION',
+        'matlab' => 'FUNCTION',
+        'matlabcp' => 'FUNCTION',
+        'matlabfcn' => 'FUNCTION',
+        'matlabFunction' => 'FUNCTION',
+        'matlabinit' => 'FUNCTION',
+        'matlabpool' => 'FUNCTION',
+        'matlabrc' => 'FUNCTION',
+        'matlabroot' => 'FUNCTION',
+        'matlabsub' => 'FUNCTION',
+        'matlabtb' => 'FUNCTION',
+        'matlabtbeval' => 'FUNCTION',
+        'matnbr' => 'FUNCTION',
+        'mattest' => 'FUNCTION',
+        'mavolcanoplot' => 'FUNCTION',
+        'max' => 'FUNCTION',
+        'maxassetbystulz' => 'FUNCTION',
+        'maxassetsensbystulz' => 'FUNCTION',
+        'maxdrawdown' => 'FUNCTION',
+        'maxflat' => 'FUNCTION',
+        'maxflow' => 'FUNCTION',
+        'Maximin' => 'FUNCTION',
+        'MaximizeCommandWindow' => 'FUNCTION',
+        'maxlinlr' => 'FUNCTION',
+        'maxlog' => 'FUNCTION',
+        'maxstep' => 'FUNCTION',
+        'mbcboundary' => 'FUNCTION',
+        'mbcconfig' => 'FUNCTION',
+        'mbcmodel' => 'FUNCTION',
+        'mbcPointByPointModel' => 'FUNCTION',
+        'mbscfamounts' => 'FUNCTION',
+        'mbsconvp' => 'FUNCTION',
+        'mbsconvy' => 'FUNCTION',
+        'mbsdurp' => 'FUNCTION',
+        'mbsdury' => 'FUNCTION',
+        'mbsnoprepay' => 'FUNCTION',
+        'mbsoas2price' => 'FUNCTION',
+        'mbsoas2yield' => 'FUNCTION',
+        'mbspassthrough' => 'FUNCTION',
+        'mbsprice' => 'FUNCTION',
+        'mbsprice2oas' => 'FUNCTION',
+        'mbsprice2speed' => 'FUNCTION',
+        'mbswal' => 'FUNCTION',
+        'mbsyield' => 'FUNCTION',
+        'mbsyield2oas' => 'FUNCTION',
+        'mbsyield2speed' => 'FUNCTION',
+        'mbuild' => 'FUNCTION',
+        'mcc' => 'FUNCTION',
+        'mcdcinfo' => 'FUNCTION',
+        'mclGetLastErrorMessage' => 'FUNCTION',
+        'mclGetLogFileName' => 'FUNCTION',
+        'mclGetMCRUserData' => 'FUNCTION',
+        'mclInitializeApplication' => 'FUNCTION',
+        'mclIsJVMEnabled' => 'FUNCTION',
+        'mclIsMCRInitialized' => 'FUNCTION',
+        'mclIsNoDisplaySet' => 'FUNCTION',
+        'mclRunMain' => 'FUNCTION',
+        'mclSetCmdLineUserData' => 'FUNCTION',
+        'mclSetMCRUserData' => 'FUNCTION',
+        'mclTerminateApplication' => 'FUNCTION',
+        'mclWaitForFiguresToDie' => 'FUNCTION',
+        'mcrinstaller' => 'FUNCTION',
+        'mcrversion' => 'FUNCTION',
+        'mdistort' => 'FUNCTION',
+        'mdscale' => 'FUNCTION',
+        'mdsProx' => 'FUNCTION',
+        'mdwtcluster' => 'FUNCTION',
+        'mdwtdec' => 'FUNCTION',
+        'mdwtrec' => 'FUNCTION',
+        'mean' => 'FUNCTION',
+        'mean2' => 'FUNCTION',
+        'meanabs' => 'FUNCTION',
+        'meanm' => 'FUNCTION',
+        'meanMargin' => 'FUNCTION',
+        'meansqr' => 'FUNCTION',
+        'measerr' => 'FUNCTION',
+        'measure' => 'FUNCTION',
+        'mech_get_states' => 'FUNCTION',
+        'mech_import' => 'FUNCTION',
+        'mech_runtime_states' => 'FUNCTION',
+        'mech_set_states' => 'FUNCTION',
+        'mech_stateVectorMgr' => 'FUNCTION',
+        'mech_transfer_states' => 'FUNCTION',
+        'medfilt1' => 'FUNCTION',
+        'medfilt2' => 'FUNCTION',
+        'median' => 'FUNCTION',
+        'medprice' => 'FUNCTION',
+        'memmap' => 'FUNCTION',
+        'memmapfile' => 'FUNCTION',
+        'memory' => 'FUNCTION',
+        'mempeek' => 'FUNCTION',
+        'mempoke' => 'FUNCTION',
+        'memread' => 'FUNCTION',
+        'memunmap' => 'FUNCTION',
+        'memwrite' => 'FUNCTION',
+        'menu' => 'FUNCTION',
+        'merge' => 'FUNCTION',
+        'Merge' => 'FUNCTION',
+        'mergelevels' => 'FUNCTION',
+        'meridianarc' => 'FUNCTION',
+        'meridianfwd' => 'FUNCTION',
+        'mesh' => 'FUNCTION',
+        'meshc' => 'FUNCTION',
+        'meshgrat' => 'FUNCTION',
+        'meshgrid' => 'FUNCTION',
+        'meshlsrm' => 'FUNCTION',
+        'meshm' => 'FUNCTION',
+        'meshz' => 'FUNCTION',
+        'messageInfo' => 'FUNCTION',
+        'meta' => 'FUNCTION',
+        'metaclass' => 'FUNCTION',
+        'methods' => 'FUNCTION',
+        'methodsview' => 'FUNCTION',
+        'mex' => 'FUNCTION',
+        'MException' => 'FUNCTION',
+        'mexext' => 'FUNCTION',
+        'mexihat' => 'FUNCTION',
+        'meyer' => 'FUNCTION',
+        'meyeraux' => 'FUNCTION',
+        'mf2mf' => 'FUNCTION',
+        'mfedit' => 'FUNCTION',
+        'mfilename' => 'FUNCTION',
+        'mfilt' => 'FUNCTION',
+        'mfun' => 'FUNCTION',
+        'mfunlist' => 'FUNCTION',
+        'mfwdtran' => 'FUNCTION',
+        'mhsample' => 'FUNCTION',
+        'microplateplot' => 'FUNCTION',
+        'midedit' => 'FUNCTION',
+        'midpoint' => 'FUNCTION',
+        'midprefs' => 'FUNCTION',
+        'midtest' => 'FUNCTION',
+        'mimochan' => 'FUNCTION',
+        'min' => 'FUNCTION',
+        'minassetbystulz' => 'FUNCTION',
+        'minassetsensbystulz' => 'FUNCTION',
+        'minaxis' => 'FUNCTION',
+        'mincx' => 'FUNCTION',
+        'Minimax' => 'FUNCTION',
+        'MinimizeCommandWindow' => 'FUNCTION',
+        'minlog' => 'FUNCTION',
+        'minmax' => 'FUNCTION',
+        'minpol' => 'FUNCTION',
+        'minreal' => 'FUNCTION',
+        'minres' => 'FUNCTION',
+        'minspantree' => 'FUNCTION',
+        'minus' => 'FUNCTION',
+        'minute' => 'FUNCTION',
+        'minvtran' => 'FUNCTION',
+        'mirr' => 'FUNCTION',
+        'misdata' => 'FUNCTION',
+        'mislocked' => 'FUNCTION',
+        'mixsyn' => 'FUNCTION',
+        'mjuliandate' => 'FUNCTION',
+        'mkbush' => 'FUNCTION',
+        'mkdir' => 'FUNCTION',
+        'mkfilter' => 'FUNCTION',
+        'mkpp' => 'FUNCTION',
+        'mktito' => 'FUNCTION',
+        'mktree' => 'FUNCTION',
+        'mktrintree' => 'FUNCTION',
+        'mlabel' => 'FUNCTION',
+        'mlabelzero22pi' => 'FUNCTION',
+        'MLAppendMatrix' => 'FUNCTION',
+        'MLAutoStart' => 'FUNCTION',
+        'mlayers' => 'FUNCTION',
+        'MLClose' => 'FUNCTION',
+        'MLDeleteMatrix' => 'FUNCTION',
+        'mldivide' => 'FUNCTION',
+        'mle' => 'FUNCTION',
+        'mlecov' => 'FUNCTION',
+        'MLEvalString' => 'FUNCTION',
+        'MLGetFigure' => 'FUNCTION',
+        'MLGetMatrix' => 'FUNCTION',
+        'MLGetVar' => 'FUNCTION',
+        'mlint' => 'FUNCTION',
+        'MLMissingDataAsNaN' => 'FUNCTION',
+        'mlock' => 'FUNCTION',
+        'MLOpen' => 'FUNCTION',
+        'MLPutMatrix' => 'FUNCTION',
+        'MLPutVar' => 'FUNCTION',
+        'mlseeq' => 'FUNCTION',
+        'MLShowMatlabErrors' => 'FUNCTION',
+        'MLStartDir' => 'FUNCTION',
+        'MLUseCellArray' => 'FUNCTION',
+        'MLUseFullDesktop' => 'FUNCTION',
+        'mmfileinfo' => 'FUNCTION',
+        'mmktbybdt' => 'FUNCTION',
+        'mmktbyhjm' => 'FUNCTION',
+        'mmreader' => 'FUNCTION',
+        'mnpdf' => 'FUNCTION',
+        'mnrfit' => 'FUNCTION',
+        'mnrnd' => 'FUNCTION',
+        'mnrval' => 'FUNCTION',
+        'mobjects' => 'FUNCTION',
+        'mod' => 'FUNCTION',
+        'mode' => 'FUNCTION',
+        'model' => 'FUNCTION',
+        'Model' => 'FUNCTION',
+        'model_initialize' => 'FUNCTION',
+        'model_SetEventsForThisBaseStep' => 'FUNCTION',
+        'model_step' => 'FUNCTION',
+        'model_terminate' => 'FUNCTION',
+        'modeladvisor' => 'FUNCTION',
+        'ModelAdvisor' => 'FUNCTION',
+        'ModelForTest' => 'FUNCTION',
+        'modelinput' => 'FUNCTION',
+        'Models' => 'FUNCTION',
+        'ModelSetup' => 'FUNCTION',
+        'modem' => 'FUNCTION',
+        'Modified' => 'FUNCTION',
+        'ModifyFilter' => 'FUNCTION',
+        'modifyInheritedParam' => 'FUNCTION',
+        'ModifyTestFilter' => 'FUNCTION',
+        'ModifyVariable' => 'FUNCTION',
+        'modnorm' => 'FUNCTION',
+        'modreal' => 'FUNCTION',
+        'modred' => 'FUNCTION',
+        'modsep' => 'FUNCTION',
+        'modulate' => 'FUNCTION',
+        'molviewer' => 'FUNCTION',
+        'molweight' => 'FUNCTION',
+        'moment' => 'FUNCTION',
+        'montage' => 'FUNCTION',
+        'month' => 'FUNCTION',
+        'months' => 'FUNCTION',
+        'more' => 'FUNCTION',
+        'morlet' => 'FUNCTION',
+        'movavg' => 'FUNCTION',
+        'move' => 'FUNCTION',
+        'moveBody' => 'FUNCTION',
+        'movefile' => 'FUNCTION',
+        'movegui' => 'FUNCTION',
+        'movie' => 'FUNCTION',
+        'movie2avi' => 'FUNCTION',
+        'mpc' => 'FUNCTION',
+        'mpchelp' => 'FUNCTION',
+        'mpcmove' => 'FUNCTION',
+        'mpcprops' => 'FUNCTION',
+        'mpcsimopt' => 'FUNCTION',
+        'mpcstate' => 'FUNCTION',
+        'mpctool' => 'FUNCTION',
+        'mpcverbosity' => 'FUNCTION',
+        'mpiLibConf' => 'FUNCTION',
+        'mpiprofile' => 'FUNCTION',
+        'mpiSettings' => 'FUNCTION',
+        'mplay' => 'FUNCTION',
+        'mpower' => 'FUNCTION',
+        'mpy' => 'FUNCTION',
+        'mrdivide' => 'FUNCTION',
+        'msalign' => 'FUNCTION',
+        'msbackadj' => 'FUNCTION',
+        'mscohere' => 'FUNCTION',
+        'msdotplot' => 'FUNCTION',
+        'mse' => 'FUNCTION',
+        'msepred' => 'FUNCTION',
+        'msesim' => 'FUNCTION',
+        'msgbox' => 'FUNCTION',
+        'msgcount' => 'FUNCTION',
+        'msheatmap' => 'FUNCTION',
+        'mskdemod' => 'FUNCTION',
+        'mskmod' => 'FUNCTION',
+        'mslowess' => 'FUNCTION',
+        'msnorm' => 'FUNCTION',
+        'mspalign' => 'FUNCTION',
+        'mspeaks' => 'FUNCTION',
+        'msppresample' => 'FUNCTION',
+        'msresample' => 'FUNCTION',
+        'mssgolay' => 'FUNCTION',
+        'msviewer' => 'FUNCTION',
+        'mswcmp' => 'FUNCTION',
+        'mswcmpscr' => 'FUNCTION',
+        'mswcmptp' => 'FUNCTION',
+        'mswden' => 'FUNCTION',
+        'mswthresh' => 'FUNCTION',
+        'mtimes' => 'FUNCTION',
+        'mu2lin' => 'FUNCTION',
+        'multcompare' => 'FUNCTION',
+        'multialign' => 'FUNCTION',
+        'multialignread' => 'FUNCTION',
+        'multialignviewer' => 'FUNCTION',
+        'multialignwrite' => 'FUNCTION',
+        'multibandread' => 'FUNCTION',
+        'multibandwrite' => 'FUNCTION',
+        'MultipleVIF' => 'FUNCTION',
+        'multistage' => 'FUNCTION',
+        'multivarichart' => 'FUNCTION',
+        'munlock' => 'FUNCTION',
+        'mupad' => 'FUNCTION',
+        'mupadwelcome' => 'FUNCTION',
+        'mussv' => 'FUNCTION',
+        'mussvextract' => 'FUNCTION',
+        'muxchanidx' => 'FUNCTION',
+        'muxdeintrlv' => 'FUNCTION',
+        'muxintrlv' => 'FUNCTION',
+        'mvl2dec' => 'FUNCTION',
+        'mvncdf' => 'FUNCTION',
+        'mvnpdf' => 'FUNCTION',
+        'mvnrfish' => 'FUNCTION',
+        'mvnrmle' => 'FUNCTION',
+        'mvnrnd' => 'FUNCTION',
+        'mvnrobj' => 'FUNCTION',
+        'mvnrstd' => 'FUNCTION',
+        'mvregress' => 'FUNCTION',
+        'mvregresslike' => 'FUNCTION',
+        'mvtcdf' => 'FUNCTION',
+        'mvtpdf' => 'FUNCTION',
+        'mvtrnd' => 'FUNCTION',
+        'mzcdf2peaks' => 'FUNCTION',
+        'mzcdfinfo' => 'FUNCTION',
+        'mzcdfread' => 'FUNCTION',
+        'mzxml2peaks' => 'FUNCTION',
+        'mzxmlinfo' => 'FUNCTION',
+        'mzxmlread' => 'FUNCTION',
+        'n2ecc' => 'FUNCTION',
+        'n4sid' => 'FUNCTION',
+        'NaiveBayes' => 'FUNCTION',
+        'Name' => 'FUNCTION',
+        'namecolumn' => 'FUNCTION',
+        'namelengthmax' => 'FUNCTION',
+        'namem' => 'FUNCTION',
+        'Names' => 'FUNCTION',
+        'nanclip' => 'FUNCTION',
+        'nancov' => 'FUNCTION',
+        'nanm' => 'FUNCTION',
+        'nanmax' => 'FUNCTION',
+        'nanmean' => 'FUNCTION',
+        'nanmedian' => 'FUNCTION',
+        'nanmin' => 'FUNCTION',
+        'nanstd' => 'FUNCTION',
+        'nansum' => 'FUNCTION',
+        'nanvar' => 'FUNCTION',
+        'nargchk' => 'FUNCTION',
+        'nargin' => 'FUNCTION',
+        'nargoutchk' => 'FUNCTION',
+        'narnet' => 'FUNCTION',
+        'narxnet' => 'FUNCTION',
+        'native2unicode' => 'FUNCTION',
+        'navfix' => 'FUNCTION',
+        'nbinfit' => 'FUNCTION',
+        'nbininv' => 'FUNCTION',
+        'nbinpdf' => 'FUNCTION',
+        'nbinrnd' => 'FUNCTION',
+        'nbinstat' => 'FUNCTION',
+        'ncdupdate' => 'FUNCTION',
+        'ncfcdf' => 'FUNCTION',
+        'ncfinv' => 'FUNCTION',
+        'ncfmargin' => 'FUNCTION',
+        'ncfmr' => 'FUNCTION',
+        'ncfpdf' => 'FUNCTION',
+        'ncfrnd' => 'FUNCTION',
+        'ncfstat' => 'FUNCTION',
+        'ncfsyn' => 'FUNCTION',
+        'nchoosek' => 'FUNCTION',
+        'nclaunch' => 'FUNCTION',
+        'nctcdf' => 'FUNCTION',
+        'nctinv' => 'FUNCTION',
+        'nctool' => 'FUNCTION',
+        'nctpdf' => 'FUNCTION',
+        'nctrnd' => 'FUNCTION',
+        'nctstat' => 'FUNCTION',
+        'ncx2cdf' => 'FUNCTION',
+        'ncx2inv' => 'FUNCTION',
+        'ncx2pdf' => 'FUNCTION',
+        'ncx2rnd' => 'FUNCTION',
+        'ncx2stat' => 'FUNCTION',
+        'ndgrid' => 'FUNCTION',
+        'ndims' => 'FUNCTION',
+        'ndwt' => 'FUNCTION',
+        'ndwt2' => 'FUNCTION',
+        'ne' => 'FUNCTION',
+        'nearest' => 'FUNCTION',
+        'nearestNeighbor' => 'FUNCTION',
+        'negdist' => 'FUNCTION',
+        'negvolidx' => 'FUNCTION',
+        'neighbors' => 'FUNCTION',
+        'net' => 'FUNCTION',
+        'NET' => 'FUNCTION',
+        'netcdf' => 'FUNCTION',
+        'netinv' => 'FUNCTION',
+        'netprod' => 'FUNCTION',
+        'netsum' => 'FUNCTION',
+        'network' => 'FUNCTION',
+        'neuralnet' => 'FUNCTION',
+        'new' => 'FUNCTION',
+        'New' => 'FUNCTION',
+        'new_system' => 'FUNCTION',
+        'newfis' => 'FUNCTION',
+        'newgrnn' => 'FUNCTION',
+        'newknt' => 'FUNCTION',
+        'newlind' => 'FUNCTION',
+        'newlmi' => 'FUNCTION',
+        'neworig' => 'FUNCTION',
+        'newplot' => 'FUNCTION',
+        'newpnn' => 'FUNCTION',
+        'newpole' => 'FUNCTION',
+        'newrb' => 'FUNCTION',
+        'newrbe' => 'FUNCTION',
+        'newsro' => 'FUNCTION',
+        'nextpow2' => 'FUNCTION',
+        'nftool' => 'FUNCTION',
+        'ngrid' => 'FUNCTION',
+        'nichols' => 'FUNCTION',
+        'nicholsoptions' => 'FUNCTION',
+        'nicholsplot' => 'FUNCTION',
+        'nitfinfo' => 'FUNCTION',
+        'nitfread' => 'FUNCTION',
+        'nkshift' => 'FUNCTION',
+        'nlarx' => 'FUNCTION',
+        'nlfilter' => 'FUNCTION',
+        'nlhw' => 'FUNCTION',
+        'nlinfit' => 'FUNCTION',
+        'nlintool' => 'FUNCTION',
+        'nlmefit' => 'FUNCTION',
+        'nlmefitsa' => 'FUNCTION',
+        'nlparci' => 'FUNCTION',
+        'nlpredci' => 'FUNCTION',
+        'nmercount' => 'FUNCTION',
+        'nncell2mat' => 'FUNCTION',
+        'nncorr' => 'FUNCTION',
+        'nndata' => 'FUNCTION',
+        'nndata2sim' => 'FUNCTION',
+        'nnmf' => 'FUNCTION',
+        'nnsize' => 'FUNCTION',
+        'nntool' => 'FUNCTION',
+        'nntraintool' => 'FUNCTION',
+        'nnz' => 'FUNCTION',
+        'noanimate' => 'FUNCTION',
+        'Node' => 'FUNCTION',
+        'nodeasc' => 'FUNCTION',
+        'nodedesc' => 'FUNCTION',
+        'nodeerr' => 'FUNCTION',
+        'nodeInfo' => 'FUNCTION',
+        'nodejoin' => 'FUNCTION',
+        'nodepar' => 'FUNCTION',
+        'nodeprob' => 'FUNCTION',
+        'nodesize' => 'FUNCTION',
+        'nodesplt' => 'FUNCTION',
+        'noisebw' => 'FUNCTION',
+        'noisecnv' => 'FUNCTION',
+        'noisepsd' => 'FUNCTION',
+        'noisepsdopts' => 'FUNCTION',
+        'noleaves' => 'FUNCTION',
+        'noloop' => 'FUNCTION',
+        'nomatlabtb' => 'FUNCTION',
+        'nominal' => 'FUNCTION',
+        'nomrr' => 'FUNCTION',
+        'nonzeros' => 'FUNCTION',
+        'noperations' => 'FUNCTION',
+        'norm' => 'FUNCTION',
+        'normalize' => 'FUNCTION',
+        'normalized2actual' => 'FUNCTION',
+        'normalizefreq' => 'FUNCTION',
+        'normc' => 'FUNCTION',
+        'normcdf' => 'FUNCTION',
+        'normest' => 'FUNCTION',
+        'normfit' => 'FUNCTION',
+        'norminv' => 'FUNCTION',
+        'normlike' => 'FUNCTION',
+        'normlms' => 'FUNCTION',
+        'normpdf' => 'FUNCTION',
+        'normplot' => 'FUNCTION',
+        'normprod' => 'FUNCTION',
+        'normr' => 'FUNCTION',
+        'normrnd' => 'FUNCTION',
+        'normspec' => 'FUNCTION',
+        'normstat' => 'FUNCTION',
+        'normxcorr2' => 'FUNCTION',
+        'northarrow' => 'FUNCTION',
+        'not' => 'FUNCTION',
+        'notebook' => 'FUNCTION',
+        'notify' => 'FUNCTION',
+        'notifyMatlabServer' => 'FUNCTION',
+        'noverflows' => 'FUNCTION',
+        'now' => 'FUNCTION',
+        'nprtool' => 'FUNCTION',
+        'nsegments' => 'FUNCTION',
+        'nstates' => 'FUNCTION',
+        'nt2aa' => 'FUNCTION',
+        'nt2int' => 'FUNCTION',
+        'ntdensity' => 'FUNCTION',
+        'nthroot' => 'FUNCTION',
+        'ntnode' => 'FUNCTION',
+        'ntree' => 'FUNCTION',
+        'ntsc2rgb' => 'FUNCTION',
+        'ntstool' => 'FUNCTION',
+        'nuc44' => 'FUNCTION',
+        'nuderst' => 'FUNCTION',
+        'null' => 'FUNCTION',
+        'num2bin' => 'FUNCTION',
+        'num2cell' => 'FUNCTION',
+        'num2fixpt' => 'FUNCTION',
+        'num2goid' => 'FUNCTION',
+        'num2hex' => 'FUNCTION',
+        'num2int' => 'FUNCTION',
+        'num2str' => 'FUNCTION',
+        'numargs' => 'FUNCTION',
+        'numberofelements' => 'FUNCTION',
+        'NumberOfInputs' => 'FUNCTION',
+        'NumberOfParameters' => 'FUNCTION',
+        'NumberOfPoints' => 'FUNCTION',
+        'NumberOfRecords' => 'FUNCTION',
+        'NumberOfTests' => 'FUNCTION',
+        'numcoeffs' => 'FUNCTION',
+        'numden' => 'FUNCTION',
+        'numel' => 'FUNCTION',
+        'numelements' => 'FUNCTION',
+        'numerictype' => 'FUNCTION',
+        'NumericTypeScope' => 'FUNCTION',
+        'numfinite' => 'FUNCTION',
+        'numlabs' => 'FUNCTION',
+        'numnan' => 'FUNCTION',
+        'numnodes' => 'FUNCTION',
+        'numsamples' => 'FUNCTION',
+        'numsignals' => 'FUNCTION',
+        'numtimesteps' => 'FUNCTION',
+        'nunderflows' => 'FUNCTION',
+        'nuttallwin' => 'FUNCTION',
+        'nwalign' => 'FUNCTION',
+        'nweekdate' => 'FUNCTION',
+        'nyquist' => 'FUNCTION',
+        'nyquistplot' => 'FUNCTION',
+        'nyseclosures' => 'FUNCTION',
+        'nzmax' => 'FUNCTION',
+        'obj2mfile' => 'FUNCTION',
+        'obsv' => 'FUNCTION',
+        'oct' => 'FUNCTION',
+        'oct2dec' => 'FUNCTION',
+        'ode15i' => 'FUNCTION',
+        'ode23' => 'FUNCTION',
+        'odefile' => 'FUNCTION',
+        'odeget' => 'FUNCTION',
+        'odeset' => 'FUNCTION',
+        'odextend' => 'FUNCTION',
+        'oe' => 'FUNCTION',
+        'oligoprop' => 'FUNCTION',
+        'onbalvol' => 'FUNCTION',
+        'onCleanup' => 'FUNCTION',
+        'onem' => 'FUNCTION',
+        'ones' => 'FUNCTION',
+        'oobError' => 'FUNCTION',
+        'oobMargin' => 'FUNCTION',
+        'oobMeanMargin' => 'FUNCTION',
+        'oobPredict' => 'FUNCTION',
+        'opccallback' => 'FUNCTION',
+        'opcda' => 'FUNCTION',
+        'opcfind' => 'FUNCTION',
+        'opchelp' => 'FUNCTION',
+        'opcqid' => 'FUNCTION',
+        'opcqparts' => 'FUNCTION',
+        'opcqstr' => 'FUNCTION',
+        'opcread' => 'FUNCTION',
+        'opcregister' => 'FUNCTION',
+        'opcreset' => 'FUNCTION',
+        'opcserverinfo' => 'FUNCTION',
+        'opcstruct2array' => 'FUNCTION',
+        'opcstruct2timeseries' => 'FUNCTION',
+        'opcsupport' => 'FUNCTION',
+        'opctool' => 'FUNCTION',
+        'open' => 'FUNCTION',
+        'open_system' => 'FUNCTION',
+        'openDialog' => 'FUNCTION',
+        'openfig' => 'FUNCTION',
+        'opengl' => 'FUNCTION',
+        'openloop' => 'FUNCTION',
+        'openmn' => 'FUNCTION',
+        'openmu' => 'FUNCTION',
+        'openmuphlp' => 'FUNCTION',
+        'openosf' => 'FUNCTION',
+        'openrset' => 'FUNCTION',
+        'openvar' => 'FUNCTION',
+        'openxvc' => 'FUNCTION',
+        'openxvz' => 'FUNCTION',
+        'OperatingPoints' => 'FUNCTION',
+        'operpoint' => 'FUNCTION',
+        'operspec' => 'FUNCTION',
+        'opprofit' => 'FUNCTION',
+        'optbndbybdt' => 'FUNCTION',
+        'optbndbybk' => 'FUNCTION',
+        'optbndbyhjm' => 'FUNCTION',
+        'optbndbyhw' => 'FUNCTION',
+        'optembndbybdt' => 'FUNCTION',
+        'optembndbybk' => 'FUNCTION',
+        'optembndbyhjm' => 'FUNCTION',
+        'optembndbyhw' => 'FUNCTION',
+        'OptimalCriteria' => 'FUNCTION',
+        'optimalleaforder' => 'FUNCTION',
+        'optimget' => 'FUNCTION',
+        'optimize' => 'FUNCTION',
+        'optimset' => 'FUNCTION',
+        'optimtool' => 'FUNCTION',
+        'optknt' => 'FUNCTION',
+        'optstockbybjs' => 'FUNCTION',
+        'optstockbyblk' => 'FUNCTION',
+        'optstockbybls' => 'FUNCTION',
+        'optstockbycrr' => 'FUNCTION',
+        'optstockbyeqp' => 'FUNCTION',
+        'optstockbyitt' => 'FUNCTION',
+        'optstockbylr' => 'FUNCTION',
+        'optstockbyrgw' => 'FUNCTION',
+        'optstocksensbybjs' => 'FUNCTION',
+        'optstocksensbyblk' => 'FUNCTION',
+        'optstocksensbybls' => 'FUNCTION',
+        'optstocksensbylr' => 'FUNCTION',
+        'optstocksensbyrgw' => 'FUNCTION',
+        'oqpskdemod' => 'FUNCTION',
+        'oqpskmod' => 'FUNCTION',
+        'or' => 'FUNCTION',
+        'ordeig' => 'FUNCTION',
+        'order' => 'FUNCTION',
+        'orderfields' => 'FUNCTION',
+        'ordfilt2' => 'FUNCTION',
+        'ordinal' => 'FUNCTION',
+        'ordqz' => 'FUNCTION',
+        'ordschur' => 'FUNCTION',
+        'org2pol' => 'FUNCTION',
+        'orient' => 'FUNCTION',
+        'originui' => 'FUNCTION',
+        'orth' => 'FUNCTION',
+        'orthfilt' => 'FUNCTION',
+        'otf2psf' => 'FUNCTION',
+        'otnodes' => 'FUNCTION',
+        'OutlierIndices' => 'FUNCTION',
+        'OutlierIndicesForTest' => 'FUNCTION',
+        'outlierMeasure' => 'FUNCTION',
+        'outlinegeoquad' => 'FUNCTION',
+        'OutputData' => 'FUNCTION',
+        'outputSingleScan' => 'FUNCTION',
+        'Owner' => 'FUNCTION',
+        'pack' => 'FUNCTION',
+        'packNGo' => 'FUNCTION',
+        'padarray' => 'FUNCTION',
+        'pade' => 'FUNCTION',
+        'padecoef' => 'FUNCTION',
+        'palindromes' => 'FUNCTION',
+        'pam' => 'FUNCTION',
+        'pamdemod' => 'FUNCTION',
+        'pammod' => 'FUNCTION',
+        'pan' => 'FUNCTION',
+        'panzoom' => 'FUNCTION',
+        'paperscale' => 'FUNCTION',
+        'para2fan' => 'FUNCTION',
+        'parabolic' => 'FUNCTION',
+        'parallel' => 'FUNCTION',
+        'parallelcoords' => 'FUNCTION',
+        'parallelui' => 'FUNCTION',
+        'paramci' => 'FUNCTION',
+        'Parameters' => 'FUNCTION',
+        'ParameterStatistics' => 'FUNCTION',
+        'parcorr' => 'FUNCTION',
+        'parent' => 'FUNCTION',
+        'pareto' => 'FUNCTION',
+        'paretotails' => 'FUNCTION',
+        'parse' => 'FUNCTION',
+        'parseSoapResponse' => 'FUNCTION',
+        'parsrule' => 'FUNCTION',
+        'partialcorr' => 'FUNCTION',
+        'PartialVIF' => 'FUNCTION',
+        'parzenwin' => 'FUNCTION',
+        'pascal' => 'FUNCTION',
+        'pat2cwav' => 'FUNCTION',
+        'patch' => 'FUNCTION',
+        'patchesm' => 'FUNCTION',
+        'patchm' => 'FUNCTION',
+        'path' => 'FUNCTION',
+        'path2rc' => 'FUNCTION',
+        'pathsep' => 'FUNCTION',
+        'pathtool' => 'FUNCTION',
+        'patternnet' => 'FUNCTION',
+        'patternsearch' => 'FUNCTION',
+        'pause' => 'FUNCTION',
+        'payadv' => 'FUNCTION',
+        'payodd' => 'FUNCTION',
+        'payper' => 'FUNCTION',
+        'payuni' => 'FUNCTION',
+        'pbaspect' => 'FUNCTION',
+        'pburg' => 'FUNCTION',
+        'pcacov' => 'FUNCTION',
+        'pcalims' => 'FUNCTION',
+        'pcares' => 'FUNCTION',
+        'pcg' => 'FUNCTION',
+        'pcgcomp' => 'FUNCTION',
+        'pcglims' => 'FUNCTION',
+        'pchip' => 'FUNCTION',
+        'pcode' => 'FUNCTION',
+        'pcolor' => 'FUNCTION',
+        'pcolorm' => 'FUNCTION',
+        'pcov' => 'FUNCTION',
+        'pcpval' => 'FUNCTION',
+        'pctconfig' => 'FUNCTION',
+        'pctRunDeployedCleanup' => 'FUNCTION',
+        'pctRunOnAll' => 'FUNCTION',
+        'pdbdistplot' => 'FUNCTION',
+        'pdbread' => 'FUNCTION',
+        'pdbsuperpose' => 'FUNCTION',
+        'pdbtransform' => 'FUNCTION',
+        'pdbwrite' => 'FUNCTION',
+        'pdeadgsc' => 'FUNCTION',
+        'pdeadworst' => 'FUNCTION',
+        'pdearcl' => 'FUNCTION',
+        'pdebound' => 'FUNCTION',
+        'pdecgrad' => 'FUNCTION',
+        'pdecirc' => 'FUNCTION',
+        'pdecont' => 'FUNCTION',
+        'pdeeig' => 'FUNCTION',
+        'pdeellip' => 'FUNCTION',
+        'pdeent' => 'FUNCTION',
+        'pdegeom' => 'FUNCTION',
+        'pdegplot' => 'FUNCTION',
+        'pdegrad' => 'FUNCTION',
+        'pdeintrp' => 'FUNCTION',
+        'pdejmps' => 'FUNCTION',
+        'pdemdlcv' => 'FUNCTION',
+        'pdemesh' => 'FUNCTION',
+        'pdenonlin' => 'FUNCTION',
+        'pdepe' => 'FUNCTION',
+        'pdeplot' => 'FUNCTION',
+        'pdepoly' => 'FUNCTION',
+        'pdeprtni' => 'FUNCTION',
+        'pderect' => 'FUNCTION',
+        'pdesdp' => 'FUNCTION',
+        'pdesmech' => 'FUNCTION',
+        'pdesurf' => 'FUNCTION',
+        'pdetool' => 'FUNCTION',
+        'pdetrg' => 'FUNCTION',
+        'pdetriq' => 'FUNCTION',
+        'pdeval' => 'FUNCTION',
+        'pdf' => 'FUNCTION',
+        'pdist' => 'FUNCTION',
+        'pdist2' => 'FUNCTION',
+        'pdlstab' => 'FUNCTION',
+        'pdsimul' => 'FUNCTION',
+        'pe' => 'FUNCTION',
+        'peaks' => 'FUNCTION',
+        'pearsrnd' => 'FUNCTION',
+        'peekdata' => 'FUNCTION',
+        'peig' => 'FUNCTION',
+        'pem' => 'FUNCTION',
+        'peravg' => 'FUNCTION',
+        'perceptron' => 'FUNCTION',
+        'perfcurve' => 'FUNCTION',
+        'perform' => 'FUNCTION',
+        'periodicreturns' => 'FUNCTION',
+        'periodogram' => 'FUNCTION',
+        'perl' => 'FUNCTION',
+        'perms' => 'FUNCTION',
+        'permute' => 'FUNCTION',
+        'PEV' => 'FUNCTION',
+        'PEVForTest' => 'FUNCTION',
+        'pexcit' => 'FUNCTION',
+        'pfamhmmread' => 'FUNCTION',
+        'phantom' => 'FUNCTION',
+        'phasedelay' => 'FUNCTION',
+        'phasez' => 'FUNCTION',
+        'phytree' => 'FUNCTION',
+        'phytreeread' => 'FUNCTION',
+        'phytreetool' => 'FUNCTION',
+        'phytreewrite' => 'FUNCTION',
+        'pid' => 'FUNCTION',
+        'piddata' => 'FUNCTION',
+        'pidstd' => 'FUNCTION',
+        'pidstddata' => 'FUNCTION',
+        'pidtool' => 'FUNCTION',
+        'pidtune' => 'FUNCTION',
+        'pie' => 'FUNCTION',
+        'pie3' => 'FUNCTION',
+        'piecewisedistribution' => 'FUNCTION',
+        'pimf' => 'FUNCTION',
+        'ping' => 'FUNCTION',
+        'pingHdlSim' => 'FUNCTION',
+        'pinv' => 'FUNCTION',
+        'pix2map' => 'FUNCTION',
+        'pixcenters' => 'FUNCTION',
+        'plabel' => 'FUNCTION',
+        'place' => 'FUNCTION',
+        'planerot' => 'FUNCTION',
+        'play' => 'FUNCTION',
+        'playshow' => 'FUNCTION',
+        'plccoderdemos' => 'FUNCTION',
+        'plccoderpref' => 'FUNCTION',
+        'plcgeneratecode' => 'FUNCTION',
+        'plcopenconfigset' => 'FUNCTION',
+        'pload' => 'FUNCTION',
+        'plot' => 'FUNCTION',
+        'plot3' => 'FUNCTION',
+        'plot3m' => 'FUNCTION',
+        'plotbrowser' => 'FUNCTION',
+        'plotconfusion' => 'FUNCTION',
+        'plotedit' => 'FUNCTION',
+        'plotep' => 'FUNCTION',
+        'ploterrcorr' => 'FUNCTION',
+        'ploterrhist' => 'FUNCTION',
+        'plotes' => 'FUNCTION',
+        'plotfis' => 'FUNCTION',
+        'plotfit' => 'FUNCTION',
+        'plotinerrcorr' => 'FUNCTION',
+        'plotm' => 'FUNCTION',
+        'plotmatrix' => 'FUNCTION',
+        'plotmf' => 'FUNCTION',
+        'plotpc' => 'FUNCTION',
+        'plotperform' => 'FUNCTION',
+        'plotpv' => 'FUNCTION',
+        'plotregression' => 'FUNCTION',
+        'plotroc' => 'FUNCTION',
+        'plotsomhits' => 'FUNCTION',
+        'plotsomnc' => 'FUNCTION',
+        'plotsomnd' => 'FUNCTION',
+        'plotsomplanes' => 'FUNCTION',
+        'plotsompos' => 'FUNCTION',
+        'plotsomtop' => 'FUNCTION',
+        'plottools' => 'FUNCTION',
+        'plottrainstate' => 'FUNCTION',
+        'plotv' => 'FUNCTION',
+        'plotvec' => 'FUNCTION',
+        'plotwb' => 'FUNCTION',
+        'plotxy' => 'FUNCTION',
+        'plotyy' => 'FUNCTION',
+        'plsregress' => 'FUNCTION',
+        'plus' => 'FUNCTION',
+        'pm_adddimension' => 'FUNCTION',
+        'pm_addunit' => 'FUNCTION',
+        'pm_getdimensions' => 'FUNCTION',
+        'pm_getunits' => 'FUNCTION',
+        'pmcov' => 'FUNCTION',
+        'pmdemod' => 'FUNCTION',
+        'pmmod' => 'FUNCTION',
+        'pmode' => 'FUNCTION',
+        'pmtm' => 'FUNCTION',
+        'pmusic' => 'FUNCTION',
+        'pnormc' => 'FUNCTION',
+        'poiasma' => 'FUNCTION',
+        'poicalc' => 'FUNCTION',
+        'poiindex' => 'FUNCTION',
+        'poimesh' => 'FUNCTION',
+        'pointfig' => 'FUNCTION',
+        'pointLocation' => 'FUNCTION',
+        'Points' => 'FUNCTION',
+        'PointTypes' => 'FUNCTION',
+        'poisolv' => 'FUNCTION',
+        'poisscdf' => 'FUNCTION',
+        'poissfit' => 'FUNCTION',
+        'poissinv' => 'FUNCTION',
+        'poisspdf' => 'FUNCTION',
+        'poissrnd' => 'FUNCTION',
+        'poisstat' => 'FUNCTION',
+        'pol2cart' => 'FUNCTION',
+        'polar' => 'FUNCTION',
+        'polcmap' => 'FUNCTION',
+        'pole' => 'FUNCTION',
+        'poly' => 'FUNCTION',
+        'poly1d' => 'FUNCTION',
+        'poly2ac' => 'FUNCTION',
+        'poly2ccw' => 'FUNCTION',
+        'poly2cw' => 'FUNCTION',
+        'poly2fv' => 'FUNCTION',
+        'poly2lsf' => 'FUNCTION',
+        'poly2mask' => 'FUNCTION',
+        'poly2rc' => 'FUNCTION',
+        'poly2sym' => 'FUNCTION',
+        'poly2trellis' => 'FUNCTION',
+        'polyarea' => 'FUNCTION',
+        'polybool' => 'FUNCTION',
+        'polyconf' => 'FUNCTION',
+        'polycut' => 'FUNCTION',
+        'polydata' => 'FUNCTION',
+        'polydec' => 'FUNCTION',
+        'polyder' => 'FUNCTION',
+        'polyeig' => 'FUNCTION',
+        'polyfit' => 'FUNCTION',
+        'polyint' => 'FUNCTION',
+        'polyjoin' => 'FUNCTION',
+        'polymerge' => 'FUNCTION',
+        'polyphase' => 'FUNCTION',
+        'polyreg' => 'FUNCTION',
+        'polyscale' => 'FUNCTION',
+        'polysplit' => 'FUNCTION',
+        'polystab' => 'FUNCTION',
+        'polytool' => 'FUNCTION',
+        'polyval' => 'FUNCTION',
+        'polyvalm' => 'FUNCTION',
+        'polyxpoly' => 'FUNCTION',
+        'poolStartup' => 'FUNCTION',
+        'popov' => 'FUNCTION',
+        'portalloc' => 'FUNCTION',
+        'portalpha' => 'FUNCTION',
+        'portcons' => 'FUNCTION',
+        'portopt' => 'FUNCTION',
+        'portrand' => 'FUNCTION',
+        'portror' => 'FUNCTION',
+        'portsim' => 'FUNCTION',
+        'portstats' => 'FUNCTION',
+        'portvar' => 'FUNCTION',
+        'portvrisk' => 'FUNCTION',
+        'poslin' => 'FUNCTION',
+        'posterior' => 'FUNCTION',
+        'posvolidx' => 'FUNCTION',
+        'pow2' => 'FUNCTION',
+        'pow2db' => 'FUNCTION',
+        'power' => 'FUNCTION',
+        'power_analyze' => 'FUNCTION',
+        'power_cableparam' => 'FUNCTION',
+        'power_fftscope' => 'FUNCTION',
+        'power_hysteresis' => 'FUNCTION',
+        'power_init' => 'FUNCTION',
+        'power_initstates' => 'FUNCTION',
+        'power_lineparam' => 'FUNCTION',
+        'power_loadflow' => 'FUNCTION',
+        'power_ltiview' => 'FUNCTION',
+        'power_report' => 'FUNCTION',
+        'power_statespace' => 'FUNCTION',
+        'power_steadystate' => 'FUNCTION',
+        'power_zmeter' => 'FUNCTION',
+        'powergain' => 'FUNCTION',
+        'ppmak' => 'FUNCTION',
+        'pptest' => 'FUNCTION',
+        'ppval' => 'FUNCTION',
+        'prbyzero' => 'FUNCTION',
+        'prcroc' => 'FUNCTION',
+        'prctile' => 'FUNCTION',
+        'prdisc' => 'FUNCTION',
+        'predict' => 'FUNCTION',
+        'PredictedValue' => 'FUNCTION',
+        'PredictedValueForTest' => 'FUNCTION',
+        'predint' => 'FUNCTION',
+        'prefdir' => 'FUNCTION',
+        'preferences' => 'FUNCTION',
+        'prepare' => 'FUNCTION',
+        'prepareSurfaceData' => 'FUNCTION',
+        'preparets' => 'FUNCTION',
+        'prescale' => 'FUNCTION',
+        'present' => 'FUNCTION',
+        'pretty' => 'FUNCTION',
+        'preview' => 'FUNCTION',
+        'previewmap' => 'FUNCTION',
+        'price2ret' => 'FUNCTION',
+        'priceandvol' => 'FUNCTION',
+        'primarykeys' => 'FUNCTION',
+        'primes' => 'FUNCTION',
+        'primpoly' => 'FUNCTION',
+        'princomp' => 'FUNCTION',
+        'print' => 'FUNCTION',
+        'printdlg' => 'FUNCTION',
+        'printpreview' => 'FUNCTION',
+        'prmat' => 'FUNCTION',
+        'ProbDistUnivKernel' => 'FUNCTION',
+        'ProbDistUnivParam' => 'FUNCTION',
+        'probelibraryinfo' => 'FUNCTION',
+        'probesetlink' => 'FUNCTION',
+        'probesetlookup' => 'FUNCTION',
+        'probesetplot' => 'FUNCTION',
+        'probesetvalues' => 'FUNCTION',
+        'probnames' => 'FUNCTION',
+        'probplot' => 'FUNCTION',
+        'probvalues' => 'FUNCTION',
+        'procedurecolumns' => 'FUNCTION',
+        'procedures' => 'FUNCTION',
+        'processpca' => 'FUNCTION',
+        'procrustes' => 'FUNCTION',
+        'prod' => 'FUNCTION',
+        'profalign' => 'FUNCTION',
+        'profile' => 'FUNCTION',
+        'profsave' => 'FUNCTION',
+        'project' => 'FUNCTION',
+        'projfwd' => 'FUNCTION',
+        'projinv' => 'FUNCTION',
+        'projlist' => 'FUNCTION',
+        'promote' => 'FUNCTION',
+        'prony' => 'FUNCTION',
+        'propedit' => 'FUNCTION',
+        'properties' => 'FUNCTION',
+        'Properties' => 'FUNCTION',
+        'property' => 'FUNCTION',
+        'propertyeditor' => 'FUNCTION',
+        'propinfo' => 'FUNCTION',
+        'proteinplot' => 'FUNCTION',
+        'proteinpropplot' => 'FUNCTION',
+        'proximity' => 'FUNCTION',
+        'prtbill' => 'FUNCTION',
+        'prune' => 'FUNCTION',
+        'prunedata' => 'FUNCTION',
+        'psaspeed2default' => 'FUNCTION',
+        'psaspeed2rate' => 'FUNCTION',
+        'psave' => 'FUNCTION',
+        'psf2otf' => 'FUNCTION',
+        'psi' => 'FUNCTION',
+        'psigmf' => 'FUNCTION',
+        'psinfo' => 'FUNCTION',
+        'pskdemod' => 'FUNCTION',
+        'pskmod' => 'FUNCTION',
+        'psoptimget' => 'FUNCTION',
+        'psoptimset' => 'FUNCTION',
+        'publish' => 'FUNCTION',
+        'pubMedID' => 'FUNCTION',
+        'pulstran' => 'FUNCTION',
+        'purelin' => 'FUNCTION',
+        'put' => 'FUNCTION',
+        'PutCharArray' => 'FUNCTION',
+        'putdata' => 'FUNCTION',
+        'PutFullMatrix' => 'FUNCTION',
+        'putpole' => 'FUNCTION',
+        'putsample' => 'FUNCTION',
+        'putvalue' => 'FUNCTION',
+        'PutWorkspaceData' => 'FUNCTION',
+        'pvec' => 'FUNCTION',
+        'pvfix' => 'FUNCTION',
+        'pvinfo' => 'FUNCTION',
+        'pvtrend' => 'FUNCTION',
+        'pvvar' => 'FUNCTION',
+        'pwd' => 'FUNCTION',
+        'pwelch' => 'FUNCTION',
+        'pwlinear' => 'FUNCTION',
+        'pyld2zero' => 'FUNCTION',
+        'pyulear' => 'FUNCTION',
+        'pzmap' => 'FUNCTION',
+        'pzoptions' => 'FUNCTION',
+        'pzplot' => 'FUNCTION',
+        'qamdemod' => 'FUNCTION',
+        'qammod' => 'FUNCTION',
+        'qfunc' => 'FUNCTION',
+        'qfuncinv' => 'FUNCTION',
+        'qmf' => 'FUNCTION',
+        'qmr' => 'FUNCTION',
+        'qpdantz' => 'FUNCTION',
+        'qqplot' => 'FUNCTION',
+        'qr' => 'FUNCTION',
+        'qrand' => 'FUNCTION',
+        'qrandset' => 'FUNCTION',
+        'qrandstream' => 'FUNCTION',
+        'qrdelete' => 'FUNCTION',
+        'qreport' => 'FUNCTION',
+        'qrinsert' => 'FUNCTION',
+        'qrupdate' => 'FUNCTION',
+        'qrydata' => 'FUNCTION',
+        'qtdecomp' => 'FUNCTION',
+        'qtgetblk' => 'FUNCTION',
+        'qtsetblk' => 'FUNCTION',
+        'quad' => 'FUNCTION',
+        'quad2d' => 'FUNCTION',
+        'quadgk' => 'FUNCTION',
+        'quadl' => 'FUNCTION',
+        'quadperf' => 'FUNCTION',
+        'quadprog' => 'FUNCTION',
+        'quadstab' => 'FUNCTION',
+        'quadv' => 'FUNCTION',
+        'quant' => 'FUNCTION',
+        'quantile' => 'FUNCTION',
+        'quantilenorm' => 'FUNCTION',
+        'quantiz' => 'FUNCTION',
+        'quantize' => 'FUNCTION',
+        'quantizer' => 'FUNCTION',
+        'quat2angle' => 'FUNCTION',
+        'quat2dcm' => 'FUNCTION',
+        'quatconj' => 'FUNCTION',
+        'quatdivide' => 'FUNCTION',
+        'quatinv' => 'FUNCTION',
+        'quatmod' => 'FUNCTION',
+        'quatmultiply' => 'FUNCTION',
+        'quatnorm' => 'FUNCTION',
+        'quatnormalize' => 'FUNCTION',
+        'quatrotate' => 'FUNCTION',
+        'query' => 'FUNCTION',
+        'querybuilder' => 'FUNCTION',
+        'querytimeout' => 'FUNCTION',
+        'questdlg' => 'FUNCTION',
+        'queueOutputData' => 'FUNCTION',
+        'quit' => 'FUNCTION',
+        'Quit' => 'FUNCTION',
+        'quiver' => 'FUNCTION',
+        'quiver3' => 'FUNCTION',
+        'Quivergroup' => 'FUNCTION',
+        'quiverm' => 'FUNCTION',
+        'quorem' => 'FUNCTION',
+        'qz' => 'FUNCTION',
+        'rad2km' => 'FUNCTION',
+        'radbas' => 'FUNCTION',
+        'radbasn' => 'FUNCTION',
+        'radon' => 'FUNCTION',
+        'radtodeg' => 'FUNCTION',
+        'ramachandran' => 'FUNCTION',
+        'rand' => 'FUNCTION',
+        'randatom' => 'FUNCTION',
+        'randdeintrlv' => 'FUNCTION',
+        'randerr' => 'FUNCTION',
+        'randfeatures' => 'FUNCTION',
+        'randg' => 'FUNCTION',
+        'randi' => 'FUNCTION',
+        'randint' => 'FUNCTION',
+        'randintrlv' => 'FUNCTION',
+        'randn' => 'FUNCTION',
+        'randnc' => 'FUNCTION',
+        'randnr' => 'FUNCTION',
+        'random' => 'FUNCTION',
+        'randperm' => 'FUNCTION',
+        'randquant' => 'FUNCTION',
+        'rands' => 'FUNCTION',
+        'randsample' => 'FUNCTION',
+        'randseed' => 'FUNCTION',
+        'randseq' => 'FUNCTION',
+        'randsmall' => 'FUNCTION',
+        'randsrc' => 'FUNCTION',
+        'RandStream' => 'FUNCTION',
+        'randtool' => 'FUNCTION',
+        'randtop' => 'FUNCTION',
+        'randumat' => 'FUNCTION',
+        'randunc' => 'FUNCTION',
+        'randuss' => 'FUNCTION',
+        'range' => 'FUNCTION',
+        'rangefilt' => 'FUNCTION',
+        'rank' => 'FUNCTION',
+        'rankfeatures' => 'FUNCTION',
+        'ranksum' => 'FUNCTION',
+        'rarmax' => 'FUNCTION',
+        'rarx' => 'FUNCTION',
+        'rat' => 'FUNCTION',
+        'rate2disc' => 'FUNCTION',
+        'ratetimes' => 'FUNCTION',
+        'rationalfit' => 'FUNCTION',
+        'raylcdf' => 'FUNCTION',
+        'rayleighchan' => 'FUNCTION',
+        'raylfit' => 'FUNCTION',
+        'raylinv' => 'FUNCTION',
+        'raylpdf' => 'FUNCTION',
+        'raylrnd' => 'FUNCTION',
+        'raylstat' => 'FUNCTION',
+        'rbbox' => 'FUNCTION',
+        'rbiowavf' => 'FUNCTION',
+        'rbj' => 'FUNCTION',
+        'rc2ac' => 'FUNCTION',
+        'rc2is' => 'FUNCTION',
+        'rc2lar' => 'FUNCTION',
+        'rc2poly' => 'FUNCTION',
+        'rceps' => 'FUNCTION',
+        'rcond' => 'FUNCTION',
+        'rcoplot' => 'FUNCTION',
+        'rcosfir' => 'FUNCTION',
+        'rcosflt' => 'FUNCTION',
+        'rcosiir' => 'FUNCTION',
+        'rcosine' => 'FUNCTION',
+        'rcurve' => 'FUNCTION',
+        'rdivide' => 'FUNCTION',
+        'rdth' => 'FUNCTION',
+        'rdthloader' => 'FUNCTION',
+        'read' => 'FUNCTION',
+        'readasync' => 'FUNCTION',
+        'readfields' => 'FUNCTION',
+        'readfis' => 'FUNCTION',
+        'readfk5' => 'FUNCTION',
+        'readmat' => 'FUNCTION',
+        'readmsg' => 'FUNCTION',
+        'readmtx' => 'FUNCTION',
+        'readRegion' => 'FUNCTION',
+        'readtree' => 'FUNCTION',
+        'readxpcfile' => 'FUNCTION',
+        'real' => 'FUNCTION',
+        'realdata' => 'FUNCTION',
+        'realizemdl' => 'FUNCTION',
+        'reallog' => 'FUNCTION',
+        'realpow' => 'FUNCTION',
+        'realsqrt' => 'FUNCTION',
+        'rebasecuts' => 'FUNCTION',
+        'reboot' => 'FUNCTION',
+        'rebuffer_delay' => 'FUNCTION',
+        'receive' => 'FUNCTION',
+        'receiveRaw' => 'FUNCTION',
+        'reckon' => 'FUNCTION',
+        'record' => 'FUNCTION',
+        'RecordsPerTest' => 'FUNCTION',
+        'rectangle' => 'FUNCTION',
+        'rectint' => 'FUNCTION',
+        'rectpuls' => 'FUNCTION',
+        'rectpulse' => 'FUNCTION',
+        'rectwin' => 'FUNCTION',
+        'recycle' => 'FUNCTION',
+        'redbluecmap' => 'FUNCTION',
+        'redgreencmap' => 'FUNCTION',
+        'redistribute' => 'FUNCTION',
+        'reduce' => 'FUNCTION',
+        'reducem' => 'FUNCTION',
+        'reducepatch' => 'FUNCTION',
+        'reducevolume' => 'FUNCTION',
+        'refcurve' => 'FUNCTION',
+        'reffilter' => 'FUNCTION',
+        'refine' => 'FUNCTION',
+        'refineLimits' => 'FUNCTION',
+        'refinemesh' => 'FUNCTION',
+        'reflect' => 'FUNCTION',
+        'refline' => 'FUNCTION',
+        'refmat2vec' => 'FUNCTION',
+        'refresh' => 'FUNCTION',
+        'refreshdata' => 'FUNCTION',
+        'refvec2mat' => 'FUNCTION',
+        'reg' => 'FUNCTION',
+        'regexp' => 'FUNCTION',
+        'regexprep' => 'FUNCTION',
+        'regexptranslate' => 'FUNCTION',
+        'regionprops' => 'FUNCTION',
+        'register' => 'FUNCTION',
+        'registerCFunctionEntry' => 'FUNCTION',
+        'registerCPPFunctionEntry' => 'FUNCTION',
+        'registerCPromotableMacroEntry' => 'FUNCTION',
+        'registerevent' => 'FUNCTION',
+        'regread' => 'FUNCTION',
+        'regress' => 'FUNCTION',
+        'regression' => 'FUNCTION',
+        'regstats' => 'FUNCTION',
+        'regwrite' => 'FUNCTION',
+        'rehash' => 'FUNCTION',
+        'reinterpretcast' => 'FUNCTION',
+        'Relational' => 'FUNCTION',
+        'relationaloperators' => 'FUNCTION',
+        'release' => 'FUNCTION',
+        'relieff' => 'FUNCTION',
+        'reload' => 'FUNCTION',
+        'rem' => 'FUNCTION',
+        'remove' => 'FUNCTION',
+        'Remove' => 'FUNCTION',
+        'removeBody' => 'FUNCTION',
+        'removeChannel' => 'FUNCTION',
+        'removeconstantrows' => 'FUNCTION',
+        'RemoveData' => 'FUNCTION',
+        'removedefaultfimathpref' => 'FUNCTION',
+        'removedelay' => 'FUNCTION',
+        'RemoveDesign' => 'FUNCTION',
+        'removeEventConf' => 'FUNCTION',
+        'removeExtraNanSeparators' => 'FUNCTION',
+        'removefile' => 'FUNCTION',
+        'RemoveFilter' => 'FUNCTION',
+        'removeglobalfimathpref' => 'FUNCTION',
+        'removeInheritedCheck' => 'FUNCTION',
+        'removeInheritedParam' => 'FUNCTION',
+        'removeNode' => 'FUNCTION',
+        'RemoveOutliers' => 'FUNCTION',
+        'RemoveOutliersForTest' => 'FUNCTION',
+        'RemovePoints' => 'FUNCTION',
+        'removepublicgroup' => 'FUNCTION',
+        'removerows' => 'FUNCTION',
+        'removeSignal' => 'FUNCTION',
+        'RemoveTestFilter' => 'FUNCTION',
+        'removets' => 'FUNCTION',
+        'RemoveVariable' => 'FUNCTION',
+        'removeViewpoint' => 'FUNCTION',
+        'remscope' => 'FUNCTION',
+        'remsignal' => 'FUNCTION',
+        'renameSignal' => 'FUNCTION',
+        'renko' => 'FUNCTION',
+        'reorder' => 'FUNCTION',
+        'reorderlevels' => 'FUNCTION',
+        'repartition' => 'FUNCTION',
+        'replace_block' => 'FUNCTION',
+        'replacedata' => 'FUNCTION',
+        'replay' => 'FUNCTION',
+        'repmat' => 'FUNCTION',
+        'reroot' => 'FUNCTION',
+        'resample' => 'FUNCTION',
+        'resamplets' => 'FUNCTION',
+        'rescale' => 'FUNCTION',
+        'reset' => 'FUNCTION',
+        'resetdefaultfimath' => 'FUNCTION',
+        'resetglobalfimath' => 'FUNCTION',
+        'resetlog' => 'FUNCTION',
+        'reshape' => 'FUNCTION',
+        'resid' => 'FUNCTION',
+        'residue' => 'FUNCTION',
+        'residuez' => 'FUNCTION',
+        'resizem' => 'FUNCTION',
+        'resolvehost' => 'FUNCTION',
+        'Response' => 'FUNCTION',
+        'ResponseFeatures' => 'FUNCTION',
+        'Responses' => 'FUNCTION',
+        'ResponseSignalName' => 'FUNCTION',
+        'restack' => 'FUNCTION',
+        'restart' => 'FUNCTION',
+        'RestoreData' => 'FUNCTION',
+        'RestoreDataForTest' => 'FUNCTION',
+        'restoredefaultpath' => 'FUNCTION',
+        'restrict' => 'FUNCTION',
+        'resultset' => 'FUNCTION',
+        'resume' => 'FUNCTION',
+        'ret2price' => 'FUNCTION',
+        'ret2tick' => 'FUNCTION',
+        'rethrow' => 'FUNCTION',
+        'retrend' => 'FUNCTION',
+        'reuters' => 'FUNCTION',
+        'revgeneticcode' => 'FUNCTION',
+        'rftool' => 'FUNCTION',
+        'rgb2gray' => 'FUNCTION',
+        'rgb2hsv' => 'FUNCTION',
+        'rgb2ind' => 'FUNCTION',
+        'rgb2ntsc' => 'FUNCTION',
+        'rgb2ycbcr' => 'FUNCTION',
+        'rgbplot' => 'FUNCTION',
+        'rhxrh' => 'FUNCTION',
+        'ribbon' => 'FUNCTION',
+        'ricianchan' => 'FUNCTION',
+        'ridge' => 'FUNCTION',
+        'risk' => 'FUNCTION',
+        'rlevinson' => 'FUNCTION',
+        'rlocus' => 'FUNCTION',
+        'rlocusplot' => 'FUNCTION',
+        'rls' => 'FUNCTION',
+        'rmabackadj' => 'FUNCTION',
+        'rmappdata' => 'FUNCTION',
+        'rmasummary' => 'FUNCTION',
+        'rmdir' => 'FUNCTION',
+        'rmdsconfig' => 'FUNCTION',
+        'rmfield' => 'FUNCTION',
+        'rmi' => 'FUNCTION',
+        'rmidocrename' => 'FUNCTION',
+        'rmiobjnavigate' => 'FUNCTION',
+        'rmitag' => 'FUNCTION',
+        'rmmf' => 'FUNCTION',
+        'rmpath' => 'FUNCTION',
+        'rmpref' => 'FUNCTION',
+        'rmvar' => 'FUNCTION',
+        'rna2dna' => 'FUNCTION',
+        'rnaconvert' => 'FUNCTION',
+        'rnafold' => 'FUNCTION',
+        'rnaplot' => 'FUNCTION',
+        'rnseloader' => 'FUNCTION',
+        'robopt' => 'FUNCTION',
+        'robustdemo' => 'FUNCTION',
+        'robustfit' => 'FUNCTION',
+        'robustperf' => 'FUNCTION',
+        'robuststab' => 'FUNCTION',
+        'roc' => 'FUNCTION',
+        'roe' => 'FUNCTION',
+        'roicolor' => 'FUNCTION',
+        'roifill' => 'FUNCTION',
+        'roifilt2' => 'FUNCTION',
+        'roipoly' => 'FUNCTION',
+        'rollback' => 'FUNCTION',
+        'RollbackEdit' => 'FUNCTION',
+        'root' => 'FUNCTION',
+        'rooteig' => 'FUNCTION',
+        'rootlayr' => 'FUNCTION',
+        'rootmusic' => 'FUNCTION',
+        'roots' => 'FUNCTION',
+        'rose' => 'FUNCTION',
+        'rosser' => 'FUNCTION',
+        'rot90' => 'FUNCTION',
+        'rotate' => 'FUNCTION',
+        'rotate3d' => 'FUNCTION',
+        'rotatem' => 'FUNCTION',
+        'rotatetext' => 'FUNCTION',
+        'round' => 'FUNCTION',
+        'roundn' => 'FUNCTION',
+        'rowexch' => 'FUNCTION',
+        'rownames' => 'FUNCTION',
+        'rows' => 'FUNCTION',
+        'rpem' => 'FUNCTION',
+        'rplr' => 'FUNCTION',
+        'rpmak' => 'FUNCTION',
+        'rrdelta' => 'FUNCTION',
+        'rref' => 'FUNCTION',
+        'rrsigma' => 'FUNCTION',
+        'rrtheta' => 'FUNCTION',
+        'rscvn' => 'FUNCTION',
+        'rsdec' => 'FUNCTION',
+        'rsdecof' => 'FUNCTION',
+        'rsenc' => 'FUNCTION',
+        'rsencof' => 'FUNCTION',
+        'rsetwrite' => 'FUNCTION',
+        'rsf2csf' => 'FUNCTION',
+        'rsgenpoly' => 'FUNCTION',
+        'rsgenpolycoeffs' => 'FUNCTION',
+        'rsimgetrtp' => 'FUNCTION',
+        'rsimsetrtpparam' => 'FUNCTION',
+        'rsindex' => 'FUNCTION',
+        'rsmak' => 'FUNCTION',
+        'rsmd' => 'FUNCTION',
+        'rsmdemo' => 'FUNCTION',
+        'rsphere' => 'FUNCTION',
+        'rss' => 'FUNCTION',
+        'rstool' => 'FUNCTION',
+        'rsums' => 'FUNCTION',
+        'rtiostream_wrapper' => 'FUNCTION',
+        'rtIOStreamClose' => 'FUNCTION',
+        'rtIOStreamOpen' => 'FUNCTION',
+        'rtIOStreamRecv' => 'FUNCTION',
+        'rtIOStreamSend' => 'FUNCTION',
+        'RTW' => 'FUNCTION',
+        'rtw' => 'FUNCTION',
+        'rtw_precompile_libs' => 'FUNCTION',
+        'rtwbuild' => 'FUNCTION',
+        'rtwho' => 'FUNCTION',
+        'rtwinconfigset' => 'FUNCTION',
+        'rtwintgt' => 'FUNCTION',
+        'rtwrebuild' => 'FUNCTION',
+        'rtwreport' => 'FUNCTION',
+        'rtwtrace' => 'FUNCTION',
+        'ruleedit' => 'FUNCTION',
+        'ruleview' => 'FUNCTION',
+        'run' => 'FUNCTION',
+        'runstest' => 'FUNCTION',
+        'runstoredprocedure' => 'FUNCTION',
+        'runValidation' => 'FUNCTION',
+        's2abcd' => 'FUNCTION',
+        's2h' => 'FUNCTION',
+        's2s' => 'FUNCTION',
+        's2scc' => 'FUNCTION',
+        's2scd' => 'FUNCTION',
+        's2sdc' => 'FUNCTION',
+        's2sdd' => 'FUNCTION',
+        's2smm' => 'FUNCTION',
+        's2t' => 'FUNCTION',
+        's2tf' => 'FUNCTION',
+        's2y' => 'FUNCTION',
+        's2z' => 'FUNCTION',
+        'saminfo' => 'FUNCTION',
+        'samplealign' => 'FUNCTION',
+        'sampleData' => 'FUNCTION',
+        'sampleNames' => 'FUNCTION',
+        'sampleVarDesc' => 'FUNCTION',
+        'sampleVarNames' => 'FUNCTION',
+        'sampleVarValues' => 'FUNCTION',
+        'sampsizepwr' => 'FUNCTION',
+        'samread' => 'FUNCTION',
+        'saoptimget' => 'FUNCTION',
+        'saoptimset' => 'FUNCTION',
+        'satbath' => 'FUNCTION',
+        'satlin' => 'FUNCTION',
+        'satlins' => 'FUNCTION',
+        'saturation' => 'FUNCTION',
+        'save' => 'FUNCTION',
+        'Save' => 'FUNCTION',
+        'save_system' => 'FUNCTION',
+        'saveas' => 'FUNCTION',
+        'SaveAs' => 'FUNCTION',
+        'saveas_commblks' => 'FUNCTION',
+        'savedefaultfimathpref' => 'FUNCTION',
+        'savefipref' => 'FUNCTION',
+        'saveglobalfimathpref' => 'FUNCTION',
+        'saveobj' => 'FUNCTION',
+        'saveparamset' => 'FUNCTION',
+        'savepath' => 'FUNCTION',
+        'sawtooth' => 'FUNCTION',
+        'sbioabstractkineticlaw' => 'FUNCTION',
+        'sbioaccelerate' => 'FUNCTION',
+        'sbioaddtolibrary' => 'FUNCTION',
+        'sbioconsmoiety' => 'FUNCTION',
+        'sbioconvertunits' => 'FUNCTION',
+        'sbiocopylibrary' => 'FUNCTION',
+        'sbiodesktop' => 'FUNCTION',
+        'sbiodose' => 'FUNCTION',
+        'sbioensembleplot' => 'FUNCTION',
+        'sbioensemblerun' => 'FUNCTION',
+        'sbioensemblestats' => 'FUNCTION',
+        'sbiofitstatusplot' => 'FUNCTION',
+        'sbiogetmodel' => 'FUNCTION',
+        'sbiogetnamedstate' => 'FUNCTION',
+        'sbiohelp' => 'FUNCTION',
+        'sbiolasterror' => 'FUNCTION',
+        'sbiolastwarning' => 'FUNCTION',
+        'sbioloadproject' => 'FUNCTION',
+        'sbiomodel' => 'FUNCTION',
+        'sbionlinfit' => 'FUNCTION',
+        'sbionlmefit' => 'FUNCTION',
+        'sbionlmefitsa' => 'FUNCTION',
+        'sbionmfiledef' => 'FUNCTION',
+        'sbionmimport' => 'FUNCTION',
+        'sbioparamestim' => 'FUNCTION',
+        'sbioplot' => 'FUNCTION',
+        'sbioregisterunitprefix' => 'FUNCTION',
+        'sbioremovefromlibrary' => 'FUNCTION',
+        'sbioreset' => 'FUNCTION',
+        'sbioroot' => 'FUNCTION',
+        'sbiosaveproject' => 'FUNCTION',
+        'sbioselect' => 'FUNCTION',
+        'sbioshowunitprefixes' => 'FUNCTION',
+        'sbioshowunits' => 'FUNCTION',
+        'sbiosimulate' => 'FUNCTION',
+        'sbiosubplot' => 'FUNCTION',
+        'sbiotrellis' => 'FUNCTION',
+        'sbiounit' => 'FUNCTION',
+        'sbiounitcalculator' => 'FUNCTION',
+        'sbiounitprefix' => 'FUNCTION',
+        'sbioupdate' => 'FUNCTION',
+        'sbiovariant' => 'FUNCTION',
+        'sbiowhos' => 'FUNCTION',
+        'sbmlexport' => 'FUNCTION',
+        'sbmlimport' => 'FUNCTION',
+        'scal2frq' => 'FUNCTION',
+        'scale' => 'FUNCTION',
+        'scalecheck' => 'FUNCTION',
+        'scaleruler' => 'FUNCTION',
+        'scalprod' => 'FUNCTION',
+        'scanstr' => 'FUNCTION',
+        'scatter' => 'FUNCTION',
+        'Scatter2D' => 'FUNCTION',
+        'scatter3' => 'FUNCTION',
+        'Scattergroup' => 'FUNCTION',
+        'scatterhist' => 'FUNCTION',
+        'scatterm' => 'FUNCTION',
+        'scatterplot' => 'FUNCTION',
+        'scfread' => 'FUNCTION',
+        'schur' => 'FUNCTION',
+        'schurmr' => 'FUNCTION',
+        'schurrc' => 'FUNCTION',
+        'scircle1' => 'FUNCTION',
+        'scircle2' => 'FUNCTION',
+        'scircleg' => 'FUNCTION',
+        'scirclui' => 'FUNCTION',
+        'scramble' => 'FUNCTION',
+        'script' => 'FUNCTION',
+        'scxsc' => 'FUNCTION',
+        'sde' => 'FUNCTION',
+        'sdec' => 'FUNCTION',
+        'sdeddo' => 'FUNCTION',
+        'sdeld' => 'FUNCTION',
+        'sdemrd' => 'FUNCTION',
+        'sdhinfnorm' => 'FUNCTION',
+        'sdhinfsyn' => 'FUNCTION',
+        'sdlsim' => 'FUNCTION',
+        'sdtsdemread' => 'FUNCTION',
+        'sdtsinfo' => 'FUNCTION',
+        'se_getdbopts' => 'FUNCTION',
+        'se_getseeds' => 'FUNCTION',
+        'se_randomizeseeds' => 'FUNCTION',
+        'se_setseeds' => 'FUNCTION',
+        'sec' => 'FUNCTION',
+        'secd' => 'FUNCTION',
+        'sech' => 'FUNCTION',
+        'second' => 'FUNCTION',
+        'sectf' => 'FUNCTION',
+        'sectorg' => 'FUNCTION',
+        'sedb' => 'FUNCTION',
+        'sedebug' => 'FUNCTION',
+        'seedm' => 'FUNCTION',
+        'segment' => 'FUNCTION',
+        'select' => 'FUNCTION',
+        'selectdrive' => 'FUNCTION',
+        'selectmoveresize' => 'FUNCTION',
+        'selectreturn' => 'FUNCTION',
+        'selforgmap' => 'FUNCTION',
+        'selftest' => 'FUNCTION',
+        'selstruc' => 'FUNCTION',
+        'semianalytic' => 'FUNCTION',
+        'semilogx' => 'FUNCTION',
+        'semilogy' => 'FUNCTION',
+        'sendmail' => 'FUNCTION',
+        'sensitivity' => 'FUNCTION',
+        'separatewb' => 'FUNCTION',
+        'seq2con' => 'FUNCTION',
+        'seq2regexp' => 'FUNCTION',
+        'seqcomplement' => 'FUNCTION',
+        'seqconsensus' => 'FUNCTION',
+        'seqdisp' => 'FUNCTION',
+        'seqdotplot' => 'FUNCTION',
+        'seqgen' => 'FUNCTION',
+        'seqinsertgaps' => 'FUNCTION',
+        'seqlinkage' => 'FUNCTION',
+        'seqlogo' => 'FUNCTION',
+        'seqmatch' => 'FUNCTION',
+        'seqneighjoin' => 'FUNCTION',
+        'seqpdist' => 'FUNCTION',
+        'seqperiod' => 'FUNCTION',
+        'seqprofile' => 'FUNCTION',
+        'seqrcomplement' => 'FUNCTION',
+        'seqreverse' => 'FUNCTION',
+        'seqshoworfs' => 'FUNCTION',
+        'seqshowwords' => 'FUNCTION',
+        'seqtool' => 'FUNCTION',
+        'sequentialfs' => 'FUNCTION',
+        'seqwordcount' => 'FUNCTION',
+        'serial' => 'FUNCTION',
+        'serialbreak' => 'FUNCTION',
+        'series' => 'FUNCTION',
+        'serveritemprops' => 'FUNCTION',
+        'serveritems' => 'FUNCTION',
+        'servers' => 'FUNCTION',
+        'serverTitles' => 'FUNCTION',
+        'set' => 'FUNCTION',
+        'set_param' => 'FUNCTION',
+        'set2int' => 'FUNCTION',
+        'setabstime' => 'FUNCTION',
+        'setAction' => 'FUNCTION',
+        'setActiveConfigSet' => 'FUNCTION',
+        'setAlign' => 'FUNCTION',
+        'setappdata' => 'FUNCTION',
+        'setArgCategory' => 'FUNCTION',
+        'setArgName' => 'FUNCTION',
+        'setArgPosition' => 'FUNCTION',
+        'setArgQualifier' => 'FUNCTION',
+        'setBlockSimState' => 'FUNCTION',
+        'setBold' => 'FUNCTION',
+        'setbuildopt' => 'FUNCTION',
+        'setCallbackFcn' => 'FUNCTION',
+        'setCheck' => 'FUNCTION',
+        'setCheckText' => 'FUNCTION',
+        'setClassName' => 'FUNCTION',
+        'setColHeading' => 'FUNCTION',
+        'setColHeadingAlign' => 'FUNCTION',
+        'setColor' => 'FUNCTION',
+        'setColSpan' => 'FUNCTION',
+        'setColTitles' => 'FUNCTION',
+        'setColWidth' => 'FUNCTION',
+        'setComponentName' => 'FUNCTION',
+        'setDataType' => 'FUNCTION',
+        'setdbprefs' => 'FUNCTION',
+        'setdefaultfimath' => 'FUNCTION',
+        'SetDefaultYfit' => 'FUNCTION',
+        'setdelaymodel' => 'FUNCTION',
+        'setDependencies' => 'FUNCTION',
+        'setdiff' => 'FUNCTION',
+        'setdisp' => 'FUNCTION',
+        'setelements' => 'FUNCTION',
+        'setEntry' => 'FUNCTION',
+        'setEntryAlign' => 'FUNCTION',
+        'setenv' => 'FUNCTION',
+        'setestim' => 'FUNCTION',
+        'setEventType' => 'FUNCTION',
+        'setExecutionPeriod' => 'FUNCTION',
+        'setfield' => 'FUNCTION',
+        'setFile' => 'FUNCTION',
+        'setfis' => 'FUNCTION',
+        'setFlag' => 'FUNCTION',
+        'setFunctionName' => 'FUNCTION',
+        'setHeader' => 'FUNCTION',
+        'setHeading' => 'FUNCTION',
+        'setHeadingAlign' => 'FUNCTION',
+        'setHyperlink' => 'FUNCTION',
+        'setImageSource' => 'FUNCTION',
+        'setindist' => 'FUNCTION',
+        'setInformation' => 'FUNCTION',
+        'setinit' => 'FUNCTION',
+        'setInitEventName' => 'FUNCTION',
+        'setInitRunnableName' => 'FUNCTION',
+        'setInputParameters' => 'FUNCTION',
+        'setInputParametersLayoutGrid' => 'FUNCTION',
+        'setinterpmethod' => 'FUNCTION',
+        'setIOAutosarPortName' => 'FUNCTION',
+        'setIODataAccessMode' => 'FUNCTION',
+        'setIODataElement' => 'FUNCTION',
+        'setIOInterfaceName' => 'FUNCTION',
+        'setIsServerOperation' => 'FUNCTION',
+        'setItalic' => 'FUNCTION',
+        'setJobSchedulerData' => 'FUNCTION',
+        'setlabels' => 'FUNCTION',
+        'setlinio' => 'FUNCTION',
+        'setListObj' => 'FUNCTION',
+        'setlmis' => 'FUNCTION',
+        'setltln' => 'FUNCTION',
+        'setm' => 'FUNCTION',
+        'setMappingQuality' => 'FUNCTION',
+        'setMatePosition' => 'FUNCTION',
+        'setmcruserdata' => 'FUNCTION',
+        'setmpcdata' => 'FUNCTION',
+        'setmpcsignals' => 'FUNCTION',
+        'setname' => 'FUNCTION',
+        'setName' => 'FUNCTION',
+        'setNameSpace' => 'FUNCTION',
+        'setObjectiveName' => 'FUNCTION',
+        'setoptions' => 'FUNCTION',
+        'setoutdist' => 'FUNCTION',
+        'setOutputDir' => 'FUNCTION',
+        'setOutputFile' => 'FUNCTION',
+        'setpar' => 'FUNCTION',
+        'setparam' => 'FUNCTION',
+        'setPeriodicEventName' => 'FUNCTION',
+        'setPeriodicRunnableName' => 'FUNCTION',
+        'setpixelposition' => 'FUNCTION',
+        'setpname' => 'FUNCTION',
+        'setPolyFormat' => 'FUNCTION',
+        'setpostn' => 'FUNCTION',
+        'setpref' => 'FUNCTION',
+        'setQuality' => 'FUNCTION',
+        'setRecAction' => 'FUNCTION',
+        'setReference' => 'FUNCTION',
+        'setRefLink' => 'FUNCTION',
+        'setReservedIdentifiers' => 'FUNCTION',
+        'setRetainSpaceReturn' => 'FUNCTION',
+        'setRowHeading' => 'FUNCTION',
+        'setRowHeadingAlign' => 'FUNCTION',
+        'setRowSpan' => 'FUNCTION',
+        'setsamples' => 'FUNCTION',
+        'setSequence' => 'FUNCTION',
+        'setServerInterfaceName' => 'FUNCTION',
+        'setServerOperationPrototype' => 'FUNCTION',
+        'setServerPortName' => 'FUNCTION',
+        'setServerType' => 'FUNCTION',
+        'setSignal' => 'FUNCTION',
+        'setsignals' => 'FUNCTION',
+        'setSignature' => 'FUNCTION',
+        'setsiminit' => 'FUNCTION',
+        'setspecs' => 'FUNCTION',
+        'setStart' => 'FUNCTION',
+        'setStepMethodName' => 'FUNCTION',
+        'setstruc' => 'FUNCTION',
+        'setSubBar' => 'FUNCTION',
+        'setSubResultStatus' => 'FUNCTION',
+        'setSubResultStatusText' => 'FUNCTION',
+        'setSubscript' => 'FUNCTION',
+        'setSubsequence' => 'FUNCTION',
+        'setSubset' => 'FUNCTION',
+        'setSubTitle' => 'FUNCTION',
+        'setSuperscript' => 'FUNCTION',
+        'setTableInfo' => 'FUNCTION',
+        'setTableTitle' => 'FUNCTION',
+        'SetTermStatus' => 'FUNCTION',
+        'setTflCFunctionEntryParameters' => 'FUNCTION',
+        'setTflCOperationEntryParameters' => 'FUNCTION',
+        'SetTimer' => 'FUNCTION',
+        'settimeseriesnames' => 'FUNCTION',
+        'settimesteps' => 'FUNCTION',
+        'setTriggerPortName' => 'FUNCTION',
+        'setType' => 'FUNCTION',
+        'setunc' => 'FUNCTION',
+        'setUnderlined' => 'FUNCTION',
+        'SetupDialog' => 'FUNCTION',
+        'setupForParallelExecution' => 'FUNCTION',
+        'setupxilinxtools' => 'FUNCTION',
+        'setVar' => 'FUNCTION',
+        'setverify' => 'FUNCTION',
+        'setwb' => 'FUNCTION',
+        'setxor' => 'FUNCTION',
+        'setxpcenv' => 'FUNCTION',
+        'setxu' => 'FUNCTION',
+        'sfclipboard' => 'FUNCTION',
+        'sfclose' => 'FUNCTION',
+        'sfdebugger' => 'FUNCTION',
+        'sfexplr' => 'FUNCTION',
+        'sffinfo' => 'FUNCTION',
+        'sffis' => 'FUNCTION',
+        'sffread' => 'FUNCTION',
+        'sfgco' => 'FUNCTION',
+        'sfhelp' => 'FUNCTION',
+        'sfi' => 'FUNCTION',
+        'sfit' => 'FUNCTION',
+        'sfix' => 'FUNCTION',
+        'sflib' => 'FUNCTION',
+        'sfnew' => 'FUNCTION',
+        'sfopen' => 'FUNCTION',
+        'sfprint' => 'FUNCTION',
+        'sfrac' => 'FUNCTION',
+        'sfroot' => 'FUNCTION',
+        'sfsave' => 'FUNCTION',
+        'sftool' => 'FUNCTION',
+        'sgolay' => 'FUNCTION',
+        'sgolayfilt' => 'FUNCTION',
+        'sgrid' => 'FUNCTION',
+        'shaderel' => 'FUNCTION',
+        'shading' => 'FUNCTION',
+        'shanwavf' => 'FUNCTION',
+        'shapeinfo' => 'FUNCTION',
+        'shaperead' => 'FUNCTION',
+        'shapewrite' => 'FUNCTION',
+        'sharpe' => 'FUNCTION',
+        'shg' => 'FUNCTION',
+        'shift2mask' => 'FUNCTION',
+        'shiftdata' => 'FUNCTION',
+        'shiftdim' => 'FUNCTION',
+        'shortestpath' => 'FUNCTION',
+        'show' => 'FUNCTION',
+        'showalignment' => 'FUNCTION',
+        'showaxes' => 'FUNCTION',
+        'showdaqevents' => 'FUNCTION',
+        'showfis' => 'FUNCTION',
+        'showfixptsimerrors' => 'FUNCTION',
+        'showfixptsimranges' => 'FUNCTION',
+        'showhmmprof' => 'FUNCTION',
+        'showlmi' => 'FUNCTION',
+        'showm' => 'FUNCTION',
+        'showopcevents' => 'FUNCTION',
+        'showplottool' => 'FUNCTION',
+        'showrule' => 'FUNCTION',
+        'shrinkfaces' => 'FUNCTION',
+        'sigma' => 'FUNCTION',
+        'sigmaoptions' => 'FUNCTION',
+        'sigmaplot' => 'FUNCTION',
+        'sigmf' => 'FUNCTION',
+        'sigmoidnet' => 'FUNCTION',
+        'sign' => 'FUNCTION',
+        'signalbuilder' => 'FUNCTION',
+        'signalInfo' => 'FUNCTION',
+        'SignalNames' => 'FUNCTION',
+        'SignalUnits' => 'FUNCTION',
+        'signlms' => 'FUNCTION',
+        'signrank' => 'FUNCTION',
+        'signtest' => 'FUNCTION',
+        'sigrangeinfo' => 'FUNCTION',
+        'sigsizeinfo' => 'FUNCTION',
+        'silhouette' => 'FUNCTION',
+        'sim' => 'FUNCTION',
+        'sim2nndata' => 'FUNCTION',
+        'simbiology' => 'FUNCTION',
+        'simByEuler' => 'FUNCTION',
+        'simBySolution' => 'FUNCTION',
+        'simeventsconfig' => 'FUNCTION',
+        'simeventsdocex' => 'FUNCTION',
+        'simeventslib' => 'FUNCTION',
+        'simeventsstartup' => 'FUNCTION',
+        'simget' => 'FUNCTION',
+        'simple' => 'FUNCTION',
+        'simplify' => 'FUNCTION',
+        'simplot' => 'FUNCTION',
+        'simscape' => 'FUNCTION',
+        'simscapeEquation' => 'FUNCTION',
+        'simsd' => 'FUNCTION',
+        'simset' => 'FUNCTION',
+        'simulannealbnd' => 'FUNCTION',
+        'simulate' => 'FUNCTION',
+        'simulink' => 'FUNCTION',
+        'Simulink' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sinc' => 'FUNCTION',
+        'sind' => 'FUNCTION',
+        'single' => 'FUNCTION',
+        'SingleVIF' => 'FUNCTION',
+        'sinh' => 'FUNCTION',
+        'sinint' => 'FUNCTION',
+        'sint' => 'FUNCTION',
+        'sisoinit' => 'FUNCTION',
+        'sisotool' => 'FUNCTION',
+        'size' => 'FUNCTION',
+        'sizem' => 'FUNCTION',
+        'SizeOfParameterSet' => 'FUNCTION',
+        'skewdec' => 'FUNCTION',
+        'skewness' => 'FUNCTION',
+        'sl_postprocess' => 'FUNCTION',
+        'slbuild' => 'FUNCTION',
+        'slCharacterEncoding' => 'FUNCTION',
+        'slConfigUIGetVal' => 'FUNCTION',
+        'slConfigUISetEnabled' => 'FUNCTION',
+        'slConfigUISetVal' => 'FUNCTION',
+        'sldebug' => 'FUNCTION',
+        'sldiagnostics' => 'FUNCTION',
+        'sldiscmdl' => 'FUNCTION',
+        'sldv' => 'FUNCTION',
+        'sldvblockreplacement' => 'FUNCTION',
+        'sldvcompat' => 'FUNCTION',
+        'sldvextract' => 'FUNCTION',
+        'sldvgencov' => 'FUNCTION',
+        'sldvharnessopts' => 'FUNCTION',
+        'sldvisactive' => 'FUNCTION',
+        'sldvlogsignals' => 'FUNCTION',
+        'sldvmakeharness' => 'FUNCTION',
+        'sldvmergeharness' => 'FUNCTION',
+        'sldvoptions' => 'FUNCTION',
+        'sldvreport' => 'FUNCTION',
+        'sldvrun' => 'FUNCTION',
+        'sldvruncgvtest' => 'FUNCTION',
+        'sldvruntest' => 'FUNCTION',
+        'sldvruntestopts' => 'FUNCTION',
+        'slice' => 'FUNCTION',
+        'slicesample' => 'FUNCTION',
+        'slIsFileChangedOnDisk' => 'FUNCTION',
+        'slmdldiscui' => 'FUNCTION',
+        'slowfast' => 'FUNCTION',
+        'slreplace_mux' => 'FUNCTION',
+        'slupdate' => 'FUNCTION',
+        'slvblk' => 'FUNCTION',
+        'slvnvextract' => 'FUNCTION',
+        'slvnvharnessopts' => 'FUNCTION',
+        'slvnvlogsignals' => 'FUNCTION',
+        'slvnvmakeharness' => 'FUNCTION',
+        'slvnvmergeharness' => 'FUNCTION',
+        'slvnvruncgvtest' => 'FUNCTION',
+        'slvnvruntest' => 'FUNCTION',
+        'slvnvruntestopts' => 'FUNCTION',
+        'smf' => 'FUNCTION',
+        'sminreal' => 'FUNCTION',
+        'smithchart' => 'FUNCTION',
+        'smm2s' => 'FUNCTION',
+        'smooth' => 'FUNCTION',
+        'smooth3' => 'FUNCTION',
+        'smoothts' => 'FUNCTION',
+        'snapnow' => 'FUNCTION',
+        'snp2smp' => 'FUNCTION',
+        'soapread' => 'FUNCTION',
+        'sobolset' => 'FUNCTION',
+        'softmax' => 'FUNCTION',
+        'solve' => 'FUNCTION',
+        'sort' => 'FUNCTION',
+        'sortcols' => 'FUNCTION',
+        'sorted' => 'FUNCTION',
+        'sortfts' => 'FUNCTION',
+        'sortrows' => 'FUNCTION',
+        'sos2cell' => 'FUNCTION',
+        'sos2ss' => 'FUNCTION',
+        'sos2tf' => 'FUNCTION',
+        'sos2zp' => 'FUNCTION',
+        'sosfilt' => 'FUNCTION',
+        'sound' => 'FUNCTION',
+        'soundsc' => 'FUNCTION',
+        'spa' => 'FUNCTION',
+        'spafdr' => 'FUNCTION',
+        'spalloc' => 'FUNCTION',
+        'spap2' => 'FUNCTION',
+        'spapi' => 'FUNCTION',
+        'spaps' => 'FUNCTION',
+        'sparse' => 'FUNCTION',
+        'spaugment' => 'FUNCTION',
+        'spcol' => 'FUNCTION',
+        'spconvert' => 'FUNCTION',
+        'spcread' => 'FUNCTION',
+        'spcrv' => 'FUNCTION',
+        'spctkd' => 'FUNCTION',
+        'spdiags' => 'FUNCTION',
+        'Special' => 'FUNCTION',
+        'specifyall' => 'FUNCTION',
+        'spectrogram' => 'FUNCTION',
+        'spectrum' => 'FUNCTION',
+        'specular' => 'FUNCTION',
+        'spetool' => 'FUNCTION',
+        'speye' => 'FUNCTION',
+        'spfun' => 'FUNCTION',
+        'sph2cart' => 'FUNCTION',
+        'sphere' => 'FUNCTION',
+        'spinmap' => 'FUNCTION',
+        'spline' => 'FUNCTION',
+        'splinetool' => 'FUNCTION',
+        'splpp' => 'FUNCTION',
+        'spmak' => 'FUNCTION',
+        'spoll' => 'FUNCTION',
+        'spones' => 'FUNCTION',
+        'spparms' => 'FUNCTION',
+        'sprand' => 'FUNCTION',
+        'sprandn' => 'FUNCTION',
+        'sprandsym' => 'FUNCTION',
+        'sprank' => 'FUNCTION',
+        'sprintf' => 'FUNCTION',
+        'sptarn' => 'FUNCTION',
+        'spterms' => 'FUNCTION',
+        'sptool' => 'FUNCTION',
+        'sptread' => 'FUNCTION',
+        'spy' => 'FUNCTION',
+        'spzerom' => 'FUNCTION',
+        'sql2native' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'sqrtm' => 'FUNCTION',
+        'square' => 'FUNCTION',
+        'squareform' => 'FUNCTION',
+        'squeeze' => 'FUNCTION',
+        'srchbac' => 'FUNCTION',
+        'srchbre' => 'FUNCTION',
+        'srchcha' => 'FUNCTION',
+        'srchgol' => 'FUNCTION',
+        'srchhyb' => 'FUNCTION',
+        'ss' => 'FUNCTION',
+        'ss2sos' => 'FUNCTION',
+        'ss2ss' => 'FUNCTION',
+        'ss2tf' => 'FUNCTION',
+        'ss2zp' => 'FUNCTION',
+        'ssbdemod' => 'FUNCTION',
+        'ssbmod' => 'FUNCTION',
+        'ssc_build' => 'FUNCTION',
+        'ssc_clean' => 'FUNCTION',
+        'ssc_mirror' => 'FUNCTION',
+        'ssc_new' => 'FUNCTION',
+        'ssc_protect' => 'FUNCTION',
+        'ssc_reserved' => 'FUNCTION',
+        'sscanf' => 'FUNCTION',
+        'ssdata' => 'FUNCTION',
+        'sse' => 'FUNCTION',
+        'stabilityk' => 'FUNCTION',
+        'stabilitymu' => 'FUNCTION',
+        'stabsep' => 'FUNCTION',
+        'stabsepOptions' => 'FUNCTION',
+        'stack' => 'FUNCTION',
+        'stairs' => 'FUNCTION',
+        'Stairseries' => 'FUNCTION',
+        'start' => 'FUNCTION',
+        'startat' => 'FUNCTION',
+        'startBackground' => 'FUNCTION',
+        'startForeground' => 'FUNCTION',
+        'startup' => 'FUNCTION',
+        'stateflow' => 'FUNCTION',
+        'statget' => 'FUNCTION',
+        'StatisticsDialog' => 'FUNCTION',
+        'statset' => 'FUNCTION',
+        'Status' => 'FUNCTION',
+        'stcol' => 'FUNCTION',
+        'std' => 'FUNCTION',
+        'std2' => 'FUNCTION',
+        'stdchan' => 'FUNCTION',
+        'stdfilt' => 'FUNCTION',
+        'stdist' => 'FUNCTION',
+        'stdm' => 'FUNCTION',
+        'stem' => 'FUNCTION',
+        'stem3' => 'FUNCTION',
+        'stem3m' => 'FUNCTION',
+        'Stemseries' => 'FUNCTION',
+        'step' => 'FUNCTION',
+        'stepcpncfamounts' => 'FUNCTION',
+        'stepcpnprice' => 'FUNCTION',
+        'stepcpnyield' => 'FUNCTION',
+        'stepinfo' => 'FUNCTION',
+        'stepplot' => 'FUNCTION',
+        'stepwise' => 'FUNCTION',
+        'stepwisefit' => 'FUNCTION',
+        'StepwiseRegression' => 'FUNCTION',
+        'StepwiseSelection' => 'FUNCTION',
+        'StepwiseStatus' => 'FUNCTION',
+        'stepz' => 'FUNCTION',
+        'stl2vrml' => 'FUNCTION',
+        'stLoadTestCases' => 'FUNCTION',
+        'stmak' => 'FUNCTION',
+        'stmcb' => 'FUNCTION',
+        'stochosc' => 'FUNCTION',
+        'stockoptspec' => 'FUNCTION',
+        'stockspec' => 'FUNCTION',
+        'stop' => 'FUNCTION',
+        'stopasync' => 'FUNCTION',
+        'stoppreview' => 'FUNCTION',
+        'str2angle' => 'FUNCTION',
+        'str2double' => 'FUNCTION',
+        'str2func' => 'FUNCTION',
+        'str2mat' => 'FUNCTION',
+        'str2num' => 'FUNCTION',
+        'strcat' => 'FUNCTION',
+        'strcmp' => 'FUNCTION',
+        'stream2' => 'FUNCTION',
+        'stream3' => 'FUNCTION',
+        'streamline' => 'FUNCTION',
+        'streamparticles' => 'FUNCTION',
+        'streamribbon' => 'FUNCTION',
+        'streamslice' => 'FUNCTION',
+        'streamtube' => 'FUNCTION',
+        'strel' => 'FUNCTION',
+        'stretchlim' => 'FUNCTION',
+        'strfind' => 'FUNCTION',
+        'strings' => 'FUNCTION',
+        'strips' => 'FUNCTION',
+        'stripscaling' => 'FUNCTION',
+        'strjust' => 'FUNCTION',
+        'strmatch' => 'FUNCTION',
+        'strncmp' => 'FUNCTION',
+        'strread' => 'FUNCTION',
+        'strrep' => 'FUNCTION',
+        'strseq' => 'FUNCTION',
+        'strtok' => 'FUNCTION',
+        'strtrim' => 'FUNCTION',
+        'struc' => 'FUNCTION',
+        'struct' => 'FUNCTION',
+        'struct2cell' => 'FUNCTION',
+        'structfun' => 'FUNCTION',
+        'strun' => 'FUNCTION',
+        'strvcat' => 'FUNCTION',
+        'stSaveTestCases' => 'FUNCTION',
+        'stviewer' => 'FUNCTION',
+        'Style' => 'FUNCTION',
+        'sub' => 'FUNCTION',
+        'sub2ind' => 'FUNCTION',
+        'subclust' => 'FUNCTION',
+        'subexpr' => 'FUNCTION',
+        'subimage' => 'FUNCTION',
+        'submit' => 'FUNCTION',
+        'subplot' => 'FUNCTION',
+        'subplus' => 'FUNCTION',
+        'subs' => 'FUNCTION',
+        'subsasgn' => 'FUNCTION',
+        'subsindex' => 'FUNCTION',
+        'subspace' => 'FUNCTION',
+        'subsref' => 'FUNCTION',
+        'substruct' => 'FUNCTION',
+        'subtree' => 'FUNCTION',
+        'subvolume' => 'FUNCTION',
+        'sum' => 'FUNCTION',
+        'sumabs' => 'FUNCTION',
+        'sumblk' => 'FUNCTION',
+        'summary' => 'FUNCTION',
+        'SummaryStatistics' => 'FUNCTION',
+        'SummaryStatisticsForTest' => 'FUNCTION',
+        'sumsqr' => 'FUNCTION',
+        'superclasses' => 'FUNCTION',
+        'superiorto' => 'FUNCTION',
+        'supersharebybls' => 'FUNCTION',
+        'supersharesensbybls' => 'FUNCTION',
+        'support' => 'FUNCTION',
+        'supports' => 'FUNCTION',
+        'surf' => 'FUNCTION',
+        'surf2patch' => 'FUNCTION',
+        'surface' => 'FUNCTION',
+        'surfacem' => 'FUNCTION',
+        'Surfaceplot' => 'FUNCTION',
+        'surfc' => 'FUNCTION',
+        'surfdist' => 'FUNCTION',
+        'surfht' => 'FUNCTION',
+        'surfl' => 'FUNCTION',
+        'surflm' => 'FUNCTION',
+        'surflsrm' => 'FUNCTION',
+        'surfm' => 'FUNCTION',
+        'surfnorm' => 'FUNCTION',
+        'surfview' => 'FUNCTION',
+        'svd' => 'FUNCTION',
+        'svds' => 'FUNCTION',
+        'svmclassify' => 'FUNCTION',
+        'svmsmoset' => 'FUNCTION',
+        'svmtrain' => 'FUNCTION',
+        'swalign' => 'FUNCTION',
+        'swapbybdt' => 'FUNCTION',
+        'swapbybk' => 'FUNCTION',
+        'swapbyhjm' => 'FUNCTION',
+        'swapbyhw' => 'FUNCTION',
+        'swapbytes' => 'FUNCTION',
+        'swapbyzero' => 'FUNCTION',
+        'swaptionbybdt' => 'FUNCTION',
+        'swaptionbybk' => 'FUNCTION',
+        'swaptionbyhjm' => 'FUNCTION',
+        'swaptionbyhw' => 'FUNCTION',
+        'switchTarget' => 'FUNCTION',
+        'swt' => 'FUNCTION',
+        'swt2' => 'FUNCTION',
+        'sym' => 'FUNCTION',
+        'sym2poly' => 'FUNCTION',
+        'symamd' => 'FUNCTION',
+        'symaux' => 'FUNCTION',
+        'symbfact' => 'FUNCTION',
+        'symbol' => 'FUNCTION',
+        'symbolm' => 'FUNCTION',
+        'symdec' => 'FUNCTION',
+        'symengine' => 'FUNCTION',
+        'symerr' => 'FUNCTION',
+        'symmlq' => 'FUNCTION',
+        'symrcm' => 'FUNCTION',
+        'syms' => 'FUNCTION',
+        'symsum' => 'FUNCTION',
+        'symvar' => 'FUNCTION',
+        'symwavf' => 'FUNCTION',
+        'synchronize' => 'FUNCTION',
+        'syncWithModel' => 'FUNCTION',
+        'syndtable' => 'FUNCTION',
+        'syntax' => 'FUNCTION',
+        'sysic' => 'FUNCTION',
+        'system' => 'FUNCTION',
+        'systemtest' => 'FUNCTION',
+        'systest' => 'FUNCTION',
+        't2s' => 'FUNCTION',
+        'tableinfo' => 'FUNCTION',
+        'tableprivileges' => 'FUNCTION',
+        'tables' => 'FUNCTION',
+        'tabulate' => 'FUNCTION',
+        'tagm' => 'FUNCTION',
+        'tan' => 'FUNCTION',
+        'tand' => 'FUNCTION',
+        'tanh' => 'FUNCTION',
+        'tansig' => 'FUNCTION',
+        'tapdelay' => 'FUNCTION',
+        'tar' => 'FUNCTION',
+        'targetping' => 'FUNCTION',
+        'targetreturn' => 'FUNCTION',
+        'taskFinish' => 'FUNCTION',
+        'taskStartup' => 'FUNCTION',
+        'taxedrr' => 'FUNCTION',
+        'taylor' => 'FUNCTION',
+        'taylortool' => 'FUNCTION',
+        'taylorwin' => 'FUNCTION',
+        'tbase' => 'FUNCTION',
+        'tbilldisc2yield' => 'FUNCTION',
+        'tbillprice' => 'FUNCTION',
+        'tbillrepo' => 'FUNCTION',
+        'tbillval01' => 'FUNCTION',
+        'tbillyield' => 'FUNCTION',
+        'tbillyield2disc' => 'FUNCTION',
+        'tbl2bond' => 'FUNCTION',
+        'tblread' => 'FUNCTION',
+        'tblwrite' => 'FUNCTION',
+        'tcdf' => 'FUNCTION',
+        'tclHdlSim' => 'FUNCTION',
+        'tcpip' => 'FUNCTION',
+        'tdfread' => 'FUNCTION',
+        'tempdir' => 'FUNCTION',
+        'tempname' => 'FUNCTION',
+        'test' => 'FUNCTION',
+        'TestFilters' => 'FUNCTION',
+        'TestPlan' => 'FUNCTION',
+        'TestPlans' => 'FUNCTION',
+        'tetramesh' => 'FUNCTION',
+        'texlabel' => 'FUNCTION',
+        'text' => 'FUNCTION',
+        'textm' => 'FUNCTION',
+        'textread' => 'FUNCTION',
+        'textscan' => 'FUNCTION',
+        'textwrap' => 'FUNCTION',
+        'tf' => 'FUNCTION',
+        'tf2ca' => 'FUNCTION',
+        'tf2cl' => 'FUNCTION',
+        'tf2latc' => 'FUNCTION',
+        'tf2sos' => 'FUNCTION',
+        'tf2ss' => 'FUNCTION',
+        'tf2zp' => 'FUNCTION',
+        'tf2zpk' => 'FUNCTION',
+        'tfdata' => 'FUNCTION',
+        'tfestimate' => 'FUNCTION',
+        'tformarray' => 'FUNCTION',
+        'tformfwd' => 'FUNCTION',
+        'tforminv' => 'FUNCTION',
+        'tfqmr' => 'FUNCTION',
+        'tfutbyprice' => 'FUNCTION',
+        'tfutbyyield' => 'FUNCTION',
+        'tfutimprepo' => 'FUNCTION',
+        'tfutpricebyrepo' => 'FUNCTION',
+        'tfutyieldbyrepo' => 'FUNCTION',
+        'tgrline' => 'FUNCTION',
+        'tgspcinfo' => 'FUNCTION',
+        'tgspcread' => 'FUNCTION',
+        'thiran' => 'FUNCTION',
+        'thirdwednesday' => 'FUNCTION',
+        'thirtytwo2dec' => 'FUNCTION',
+        'throw' => 'FUNCTION',
+        'throwAsCaller' => 'FUNCTION',
+        'thselect' => 'FUNCTION',
+        'tic' => 'FUNCTION',
+        'ticcs' => 'FUNCTION',
+        'tick2ret' => 'FUNCTION',
+        'tiedrank' => 'FUNCTION',
+        'Tiff' => 'FUNCTION',
+        'tightmap' => 'FUNCTION',
+        'time' => 'FUNCTION',
+        'time2date' => 'FUNCTION',
+        'timedelaynet' => 'FUNCTION',
+        'timeoptions' => 'FUNCTION',
+        'timer' => 'FUNCTION',
+        'timerfind' => 'FUNCTION',
+        'timerfindall' => 'FUNCTION',
+        'times' => 'FUNCTION',
+        'timeseries' => 'FUNCTION',
+        'timestamp' => 'FUNCTION',
+        'timezone' => 'FUNCTION',
+        'tinv' => 'FUNCTION',
+        'tissot' => 'FUNCTION',
+        'titanium' => 'FUNCTION',
+        'title' => 'FUNCTION',
+        'tlc' => 'FUNCTION',
+        'tmtool' => 'FUNCTION',
+        'tnodes' => 'FUNCTION',
+        'toannual' => 'FUNCTION',
+        'toCellArray' => 'FUNCTION',
+        'todaily' => 'FUNCTION',
+        'todatenum' => 'FUNCTION',
+        'today' => 'FUNCTION',
+        'todecimal' => 'FUNCTION',
+        'toDegrees' => 'FUNCTION',
+        'toeplitz' => 'FUNCTION',
+        'tomonthly' => 'FUNCTION',
+        'tonemap' => 'FUNCTION',
+        'tonndata' => 'FUNCTION',
+        'toolboxdir' => 'FUNCTION',
+        'topoorder' => 'FUNCTION',
+        'toquarterly' => 'FUNCTION',
+        'toquoted' => 'FUNCTION',
+        'toRadians' => 'FUNCTION',
+        'toRateSpec' => 'FUNCTION',
+        'tosemi' => 'FUNCTION',
+        'tostring' => 'FUNCTION',
+        'totaldelay' => 'FUNCTION',
+        'totalreturnprice' => 'FUNCTION',
+        'toweekly' => 'FUNCTION',
+        'tpaps' => 'FUNCTION',
+        'tpdf' => 'FUNCTION',
+        'tr2bonds' => 'FUNCTION',
+        'trace' => 'FUNCTION',
+        'traceplot' => 'FUNCTION',
+        'track' => 'FUNCTION',
+        'track1' => 'FUNCTION',
+        'track2' => 'FUNCTION',
+        'trackg' => 'FUNCTION',
+        'trackui' => 'FUNCTION',
+        'train' => 'FUNCTION',
+        'trainb' => 'FUNCTION',
+        'trainbfg' => 'FUNCTION',
+        'trainbfgc' => 'FUNCTION',
+        'trainbr' => 'FUNCTION',
+        'trainbu' => 'FUNCTION',
+        'trainc' => 'FUNCTION',
+        'traincgb' => 'FUNCTION',
+        'traincgf' => 'FUNCTION',
+        'traincgp' => 'FUNCTION',
+        'traingd' => 'FUNCTION',
+        'traingda' => 'FUNCTION',
+        'traingdm' => 'FUNCTION',
+        'traingdx' => 'FUNCTION',
+        'training' => 'FUNCTION',
+        'trainlm' => 'FUNCTION',
+        'trainoss' => 'FUNCTION',
+        'trainr' => 'FUNCTION',
+        'trainrp' => 'FUNCTION',
+        'trainru' => 'FUNCTION',
+        'trains' => 'FUNCTION',
+        'trainscg' => 'FUNCTION',
+        'translate' => 'FUNCTION',
+        'transmit' => 'FUNCTION',
+        'transmitConfiguration' => 'FUNCTION',
+        'transmitEvent' => 'FUNCTION',
+        'transmitPeriodic' => 'FUNCTION',
+        'transpose' => 'FUNCTION',
+        'transprob' => 'FUNCTION',
+        'transprobbytotals' => 'FUNCTION',
+        'trapmf' => 'FUNCTION',
+        'trapz' => 'FUNCTION',
+        'traverse' => 'FUNCTION',
+        'TreeBagger' => 'FUNCTION',
+        'treedpth' => 'FUNCTION',
+        'treelayout' => 'FUNCTION',
+        'treeord' => 'FUNCTION',
+        'treepartition' => 'FUNCTION',
+        'treepath' => 'FUNCTION',
+        'treeplot' => 'FUNCTION',
+        'treeshape' => 'FUNCTION',
+        'treeviewer' => 'FUNCTION',
+        'trend' => 'FUNCTION',
+        'TrendInfo' => 'FUNCTION',
+        'tri2grid' => 'FUNCTION',
+        'triang' => 'FUNCTION',
+        'tribas' => 'FUNCTION',
+        'trigger' => 'FUNCTION',
+        'triggerconfig' => 'FUNCTION',
+        'triggerinfo' => 'FUNCTION',
+        'tril' => 'FUNCTION',
+        'trim' => 'FUNCTION',
+        'trimcart' => 'FUNCTION',
+        'trimdata' => 'FUNCTION',
+        'trimesh' => 'FUNCTION',
+        'trimf' => 'FUNCTION',
+        'trimmean' => 'FUNCTION',
+        'trintreepath' => 'FUNCTION',
+        'trintreeshape' => 'FUNCTION',
+        'triplequad' => 'FUNCTION',
+        'triplot' => 'FUNCTION',
+        'tripuls' => 'FUNCTION',
+        'TriRep' => 'FUNCTION',
+        'TriScatteredInterp' => 'FUNCTION',
+        'trisurf' => 'FUNCTION',
+        'tritop' => 'FUNCTION',
+        'triu' => 'FUNCTION',
+        'trnd' => 'FUNCTION',
+        'true' => 'FUNCTION',
+        'truesize' => 'FUNCTION',
+        'ts2func' => 'FUNCTION',
+        'tsaccel' => 'FUNCTION',
+        'tscollection' => 'FUNCTION',
+        'tsdata' => 'FUNCTION',
+        'tsearch' => 'FUNCTION',
+        'tsearchn' => 'FUNCTION',
+        'tsmom' => 'FUNCTION',
+        'tsmovavg' => 'FUNCTION',
+        'tstat' => 'FUNCTION',
+        'tstool' => 'FUNCTION',
+        'ttest' => 'FUNCTION',
+        'ttest2' => 'FUNCTION',
+        'tukeywin' => 'FUNCTION',
+        'tunablevars2parameterobjects' => 'FUNCTION',
+        'type' => 'FUNCTION',
+        'Type' => 'FUNCTION',
+        'typecast' => 'FUNCTION',
+        'typprice' => 'FUNCTION',
+        'ucomplex' => 'FUNCTION',
+        'ucomplexm' => 'FUNCTION',
+        'udecode' => 'FUNCTION',
+        'udp' => 'FUNCTION',
+        'udyn' => 'FUNCTION',
+        'uencode' => 'FUNCTION',
+        'ufi' => 'FUNCTION',
+        'ufind' => 'FUNCTION',
+        'ufix' => 'FUNCTION',
+        'ufrac' => 'FUNCTION',
+        'ufrd' => 'FUNCTION',
+        'ugarch' => 'FUNCTION',
+        'ugarchllf' => 'FUNCTION',
+        'ugarchpred' => 'FUNCTION',
+        'ugarchsim' => 'FUNCTION',
+        'uibuttongroup' => 'FUNCTION',
+        'uicalendar' => 'FUNCTION',
+        'uicontextmenu' => 'FUNCTION',
+        'uicontrol' => 'FUNCTION',
+        'uigetdir' => 'FUNCTION',
+        'uigetfile' => 'FUNCTION',
+        'uigetpref' => 'FUNCTION',
+        'uiimport' => 'FUNCTION',
+        'uimaptbx' => 'FUNCTION',
+        'uimenu' => 'FUNCTION',
+        'uint' => 'FUNCTION',
+        'uint16' => 'FUNCTION',
+        'uint32' => 'FUNCTION',
+        'uint64' => 'FUNCTION',
+        'uint8' => 'FUNCTION',
+        'uiopen' => 'FUNCTION',
+        'uipanel' => 'FUNCTION',
+        'uipushtool' => 'FUNCTION',
+        'uiputfile' => 'FUNCTION',
+        'uiresume' => 'FUNCTION',
+        'uisave' => 'FUNCTION',
+        'uisetcolor' => 'FUNCTION',
+        'uisetfont' => 'FUNCTION',
+        'uisetpref' => 'FUNCTION',
+        'uistack' => 'FUNCTION',
+        'uitable' => 'FUNCTION',
+        'uitoggletool' => 'FUNCTION',
+        'uitoolbar' => 'FUNCTION',
+        'uiwait' => 'FUNCTION',
+        'ulinearize' => 'FUNCTION',
+        'ultidyn' => 'FUNCTION',
+        'umat' => 'FUNCTION',
+        'uminus' => 'FUNCTION',
+        'unconfigure' => 'FUNCTION',
+        'undocheckout' => 'FUNCTION',
+        'undoclip' => 'FUNCTION',
+        'undotrim' => 'FUNCTION',
+        'unicode2native' => 'FUNCTION',
+        'unidcdf' => 'FUNCTION',
+        'unidinv' => 'FUNCTION',
+        'unidpdf' => 'FUNCTION',
+        'unidrnd' => 'FUNCTION',
+        'unidstat' => 'FUNCTION',
+        'unifcdf' => 'FUNCTION',
+        'unifinv' => 'FUNCTION',
+        'unifit' => 'FUNCTION',
+        'unifpdf' => 'FUNCTION',
+        'unifrnd' => 'FUNCTION',
+        'unifstat' => 'FUNCTION',
+        'union' => 'FUNCTION',
+        'unique' => 'FUNCTION',
+        'unitgain' => 'FUNCTION',
+        'unitquantize' => 'FUNCTION',
+        'unitquantizer' => 'FUNCTION',
+        'Units' => 'FUNCTION',
+        'unitsratio' => 'FUNCTION',
+        'unix' => 'FUNCTION',
+        'unload' => 'FUNCTION',
+        'unloadlibrary' => 'FUNCTION',
+        'unmesh' => 'FUNCTION',
+        'unmkpp' => 'FUNCTION',
+        'unpack' => 'FUNCTION',
+        'unregister' => 'FUNCTION',
+        'unregisterallevents' => 'FUNCTION',
+        'unregisterevent' => 'FUNCTION',
+        'unshiftdata' => 'FUNCTION',
+        'unstack' => 'FUNCTION',
+        'untar' => 'FUNCTION',
+        'unwrap' => 'FUNCTION',
+        'unwrapMultipart' => 'FUNCTION',
+        'unzip' => 'FUNCTION',
+        'upcoef' => 'FUNCTION',
+        'upcoef2' => 'FUNCTION',
+        'update' => 'FUNCTION',
+        'Update' => 'FUNCTION',
+        'updateBodies' => 'FUNCTION',
+        'updateCamera' => 'FUNCTION',
+        'UpdateDesign' => 'FUNCTION',
+        'updateFilePathsAndExtensions' => 'FUNCTION',
+        'updateFileSeparator' => 'FUNCTION',
+        'updategeostruct' => 'FUNCTION',
+        'updateLayers' => 'FUNCTION',
+        'updateNodes' => 'FUNCTION',
+        'UpdateResponse' => 'FUNCTION',
+        'UpdateResponseFeatures' => 'FUNCTION',
+        'updatexpcenv' => 'FUNCTION',
+        'upfirdn' => 'FUNCTION',
+        'uplus' => 'FUNCTION',
+        'upper' => 'FUNCTION',
+        'upperbound' => 'FUNCTION',
+        'upperparams' => 'FUNCTION',
+        'upsample' => 'FUNCTION',
+        'upwlev' => 'FUNCTION',
+        'upwlev2' => 'FUNCTION',
+        'ureal' => 'FUNCTION',
+        'urlread' => 'FUNCTION',
+        'urlwrite' => 'FUNCTION',
+        'usamap' => 'FUNCTION',
+        'usample' => 'FUNCTION',
+        'usejava' => 'FUNCTION',
+        'userpath' => 'FUNCTION',
+        'UserVariables' => 'FUNCTION',
+        'usgs24kdem' => 'FUNCTION',
+        'usgsdem' => 'FUNCTION',
+        'usgsdems' => 'FUNCTION',
+        'uss' => 'FUNCTION',
+        'usubs' => 'FUNCTION',
+        'utmgeoid' => 'FUNCTION',
+        'utmzone' => 'FUNCTION',
+        'utmzoneui' => 'FUNCTION',
+        'validateattributes' => 'FUNCTION',
+        'validatestring' => 'FUNCTION',
+        'validstructures' => 'FUNCTION',
+        'Value' => 'FUNCTION',
+        'values' => 'FUNCTION',
+        'Values' => 'FUNCTION',
+        'vander' => 'FUNCTION',
+        'var' => 'FUNCTION',
+        'varargin' => 'FUNCTION',
+        'varargout' => 'FUNCTION',
+        'variableDesc' => 'FUNCTION',
+        'variableNames' => 'FUNCTION',
+        'variableValues' => 'FUNCTION',
+        'varimportance' => 'FUNCTION',
+        'varlms' => 'FUNCTION',
+        'vartest' => 'FUNCTION',
+        'vartest2' => 'FUNCTION',
+        'vartestn' => 'FUNCTION',
+        'varValuesTable' => 'FUNCTION',
+        'vco' => 'FUNCTION',
+        'vec2ind' => 'FUNCTION',
+        'vec2mat' => 'FUNCTION',
+        'vec2mtx' => 'FUNCTION',
+        'vectorize' => 'FUNCTION',
+        'ver' => 'FUNCTION',
+        'verctrl' => 'FUNCTION',
+        'verLessThan' => 'FUNCTION',
+        'version' => 'FUNCTION',
+        'versioncolumns' => 'FUNCTION',
+        'vertcat' => 'FUNCTION',
+        'vertexAttachments' => 'FUNCTION',
+        'vfwdtran' => 'FUNCTION',
+        'vgxar' => 'FUNCTION',
+        'vgxcount' => 'FUNCTION',
+        'vgxdisp' => 'FUNCTION',
+        'vgxget' => 'FUNCTION',
+        'vgxinfer' => 'FUNCTION',
+        'vgxloglik' => 'FUNCTION',
+        'vgxma' => 'FUNCTION',
+        'vgxplot' => 'FUNCTION',
+        'vgxpred' => 'FUNCTION',
+        'vgxproc' => 'FUNCTION',
+        'vgxqual' => 'FUNCTION',
+        'vgxset' => 'FUNCTION',
+        'vgxsim' => 'FUNCTION',
+        'vgxvarx' => 'FUNCTION',
+        'videoinput' => 'FUNCTION',
+        'VideoReader' => 'FUNCTION',
+        'VideoWriter' => 'FUNCTION',
+        'view' => 'FUNCTION',
+        'view_mdlrefs' => 'FUNCTION',
+        'viewmtx' => 'FUNCTION',
+        'Viewpoint' => 'FUNCTION',
+        'viewReport' => 'FUNCTION',
+        'viewshed' => 'FUNCTION',
+        'vinvtran' => 'FUNCTION',
+        'viplib' => 'FUNCTION',
+        'VirtualRealityAnimation' => 'FUNCTION',
+        'visa' => 'FUNCTION',
+        'visdiff' => 'FUNCTION',
+        'visible' => 'FUNCTION',
+        'vitdec' => 'FUNCTION',
+        'vmap0data' => 'FUNCTION',
+        'vmap0read' => 'FUNCTION',
+        'vmap0rhead' => 'FUNCTION',
+        'vmap0ui' => 'FUNCTION',
+        'volarea' => 'FUNCTION',
+        'volroc' => 'FUNCTION',
+        'volumebounds' => 'FUNCTION',
+        'voronoi' => 'FUNCTION',
+        'voronoiDiagram' => 'FUNCTION',
+        'voronoin' => 'FUNCTION',
+        'vpa' => 'FUNCTION',
+        'vr' => 'FUNCTION',
+        'vratiotest' => 'FUNCTION',
+        'vrcadcleanup' => 'FUNCTION',
+        'vrclear' => 'FUNCTION',
+        'vrclose' => 'FUNCTION',
+        'vrdir2ori' => 'FUNCTION',
+        'vrdrawnow' => 'FUNCTION',
+        'vrfigure' => 'FUNCTION',
+        'vrgcbf' => 'FUNCTION',
+        'vrgcf' => 'FUNCTION',
+        'vrgetpref' => 'FUNCTION',
+        'vrinstall' => 'FUNCTION',
+        'vrjoystick' => 'FUNCTION',
+        'vrlib' => 'FUNCTION',
+        'vrnode' => 'FUNCTION',
+        'vrori2dir' => 'FUNCTION',
+        'vrphysmod' => 'FUNCTION',
+        'vrplay' => 'FUNCTION',
+        'vrrotmat2vec' => 'FUNCTION',
+        'vrrotvec' => 'FUNCTION',
+        'vrrotvec2mat' => 'FUNCTION',
+        'vrsetpref' => 'FUNCTION',
+        'vrspacemouse' => 'FUNCTION',
+        'vrview' => 'FUNCTION',
+        'vrwho' => 'FUNCTION',
+        'vrwhos' => 'FUNCTION',
+        'vrworld' => 'FUNCTION',
+        'vsim' => 'FUNCTION',
+        'vsimmatlab' => 'FUNCTION',
+        'vsimulink' => 'FUNCTION',
+        'vswr' => 'FUNCTION',
+        'wait' => 'FUNCTION',
+        'waitbar' => 'FUNCTION',
+        'waitfor' => 'FUNCTION',
+        'waitforbuttonpress' => 'FUNCTION',
+        'waitForHdlClient' => 'FUNCTION',
+        'waitForState' => 'FUNCTION',
+        'waldtest' => 'FUNCTION',
+        'warndlg' => 'FUNCTION',
+        'warning' => 'FUNCTION',
+        'warp' => 'FUNCTION',
+        'waterfall' => 'FUNCTION',
+        'watershed' => 'FUNCTION',
+        'wave2lp' => 'FUNCTION',
+        'wavedec' => 'FUNCTION',
+        'wavedec2' => 'FUNCTION',
+        'wavedec3' => 'FUNCTION',
+        'wavedemo' => 'FUNCTION',
+        'wavefun' => 'FUNCTION',
+        'wavefun2' => 'FUNCTION',
+        'waveinfo' => 'FUNCTION',
+        'waveletfamilies' => 'FUNCTION',
+        'wavemenu' => 'FUNCTION',
+        'wavemngr' => 'FUNCTION',
+        'wavenames' => 'FUNCTION',
+        'wavenet' => 'FUNCTION',
+        'waverec' => 'FUNCTION',
+        'waverec2' => 'FUNCTION',
+        'waverec3' => 'FUNCTION',
+        'wavfinfo' => 'FUNCTION',
+        'wavplay' => 'FUNCTION',
+        'wavread' => 'FUNCTION',
+        'wavrecord' => 'FUNCTION',
+        'wavsupport' => 'FUNCTION',
+        'wavwrite' => 'FUNCTION',
+        'wblcdf' => 'FUNCTION',
+        'wblfit' => 'FUNCTION',
+        'wblinv' => 'FUNCTION',
+        'wbllike' => 'FUNCTION',
+        'wblpdf' => 'FUNCTION',
+        'wblplot' => 'FUNCTION',
+        'wblrnd' => 'FUNCTION',
+        'wblstat' => 'FUNCTION',
+        'wbmpen' => 'FUNCTION',
+        'wbound' => 'FUNCTION',
+        'wcgain' => 'FUNCTION',
+        'wcgopt' => 'FUNCTION',
+        'wclose' => 'FUNCTION',
+        'wcmargin' => 'FUNCTION',
+        'wcnorm' => 'FUNCTION',
+        'wcodemat' => 'FUNCTION',
+        'wcoher' => 'FUNCTION',
+        'wcompress' => 'FUNCTION',
+        'wcsens' => 'FUNCTION',
+        'wdcbm' => 'FUNCTION',
+        'wdcbm2' => 'FUNCTION',
+        'wdcenergy' => 'FUNCTION',
+        'wden' => 'FUNCTION',
+        'wdencmp' => 'FUNCTION',
+        'web' => 'FUNCTION',
+        'WebMapServer' => 'FUNCTION',
+        'weekday' => 'FUNCTION',
+        'weeknum' => 'FUNCTION',
+        'weights' => 'FUNCTION',
+        'weights2holdings' => 'FUNCTION',
+        'wenergy2' => 'FUNCTION',
+        'wentropy' => 'FUNCTION',
+        'wextend' => 'FUNCTION',
+        'wfbm' => 'FUNCTION',
+        'wfbmesti' => 'FUNCTION',
+        'wfilters' => 'FUNCTION',
+        'wfusimg' => 'FUNCTION',
+        'wfusmat' => 'FUNCTION',
+        'wgeom' => 'FUNCTION',
+        'wgn' => 'FUNCTION',
+        'what' => 'FUNCTION',
+        'whatsnew' => 'FUNCTION',
+        'which' => 'FUNCTION',
+        'whitebg' => 'FUNCTION',
+        'whitepoint' => 'FUNCTION',
+        'who' => 'FUNCTION',
+        'whos' => 'FUNCTION',
+        'width' => 'FUNCTION',
+        'Widths' => 'FUNCTION',
+        'wiener2' => 'FUNCTION',
+        'wilkinson' => 'FUNCTION',
+        'willad' => 'FUNCTION',
+        'willpctr' => 'FUNCTION',
+        'window' => 'FUNCTION',
+        'winopen' => 'FUNCTION',
+        'winqueryreg' => 'FUNCTION',
+        'wintool' => 'FUNCTION',
+        'wishrnd' => 'FUNCTION',
+        'wk1finfo' => 'FUNCTION',
+        'wk1read' => 'FUNCTION',
+        'wk1write' => 'FUNCTION',
+        'wkeep' => 'FUNCTION',
+        'wmaxlev' => 'FUNCTION',
+        'WMSCapabilities' => 'FUNCTION',
+        'wmsfind' => 'FUNCTION',
+        'wmsinfo' => 'FUNCTION',
+        'WMSLayer' => 'FUNCTION',
+        'WMSMapRequest' => 'FUNCTION',
+        'wmspca' => 'FUNCTION',
+        'wmsread' => 'FUNCTION',
+        'wmsupdate' => 'FUNCTION',
+        'wmulden' => 'FUNCTION',
+        'wnoise' => 'FUNCTION',
+        'wnoisest' => 'FUNCTION',
+        'wordlength' => 'FUNCTION',
+        'workspace' => 'FUNCTION',
+        'worldfileread' => 'FUNCTION',
+        'worldfilewrite' => 'FUNCTION',
+        'worldmap' => 'FUNCTION',
+        'wp2wtree' => 'FUNCTION',
+        'wpbmpen' => 'FUNCTION',
+        'wpcoef' => 'FUNCTION',
+        'wpcutree' => 'FUNCTION',
+        'wpdec' => 'FUNCTION',
+        'wpdec2' => 'FUNCTION',
+        'wpdencmp' => 'FUNCTION',
+        'wpfun' => 'FUNCTION',
+        'wpjoin' => 'FUNCTION',
+        'wprcoef' => 'FUNCTION',
+        'wprec' => 'FUNCTION',
+        'wprec2' => 'FUNCTION',
+        'wpsplt' => 'FUNCTION',
+        'wpthcoef' => 'FUNCTION',
+        'wptree' => 'FUNCTION',
+        'wpviewcf' => 'FUNCTION',
+        'wrapTo180' => 'FUNCTION',
+        'wrapTo2Pi' => 'FUNCTION',
+        'wrapTo360' => 'FUNCTION',
+        'wrapToPi' => 'FUNCTION',
+        'wrcoef' => 'FUNCTION',
+        'wrcoef2' => 'FUNCTION',
+        'wrev' => 'FUNCTION',
+        'write' => 'FUNCTION',
+        'writeasync' => 'FUNCTION',
+        'writefis' => 'FUNCTION',
+        'writemsg' => 'FUNCTION',
+        'writeRegion' => 'FUNCTION',
+        'wrkdydif' => 'FUNCTION',
+        'wrldmagm' => 'FUNCTION',
+        'wscalogram' => 'FUNCTION',
+        'wtbo' => 'FUNCTION',
+        'wtbxmngr' => 'FUNCTION',
+        'wthcoef' => 'FUNCTION',
+        'wthcoef2' => 'FUNCTION',
+        'wthresh' => 'FUNCTION',
+        'wthrmngr' => 'FUNCTION',
+        'wtreemgr' => 'FUNCTION',
+        'wvarchg' => 'FUNCTION',
+        'wvtool' => 'FUNCTION',
+        'x2fx' => 'FUNCTION',
+        'x2mdate' => 'FUNCTION',
+        'xcorr' => 'FUNCTION',
+        'xcorr2' => 'FUNCTION',
+        'xcov' => 'FUNCTION',
+        'xirr' => 'FUNCTION',
+        'xlabel' => 'FUNCTION',
+        'xlim' => 'FUNCTION',
+        'xlsfinfo' => 'FUNCTION',
+        'xlsread' => 'FUNCTION',
+        'xlswrite' => 'FUNCTION',
+        'xmakefilesetup' => 'FUNCTION',
+        'xmlread' => 'FUNCTION',
+        'xmlwrite' => 'FUNCTION',
+        'xor' => 'FUNCTION',
+        'xpc' => 'FUNCTION',
+        'xpcbootdisk' => 'FUNCTION',
+        'xpcbytes2file' => 'FUNCTION',
+        'xpcexplr' => 'FUNCTION',
+        'xpctarget' => 'FUNCTION',
+        'xpctargetping' => 'FUNCTION',
+        'xpctargetspy' => 'FUNCTION',
+        'xpctest' => 'FUNCTION',
+        'xpcwwwenable' => 'FUNCTION',
+        'xperm' => 'FUNCTION',
+        'xptread' => 'FUNCTION',
+        'xregstatsmodel' => 'FUNCTION',
+        'xslt' => 'FUNCTION',
+        'xyz2double' => 'FUNCTION',
+        'xyz2uint16' => 'FUNCTION',
+        'y2abcd' => 'FUNCTION',
+        'y2h' => 'FUNCTION',
+        'y2s' => 'FUNCTION',
+        'y2z' => 'FUNCTION',
+        'yahoo' => 'FUNCTION',
+        'ycbcr2rgb' => 'FUNCTION',
+        'year' => 'FUNCTION',
+        'yeardays' => 'FUNCTION',
+        'yearfrac' => 'FUNCTION',
+        'ylddisc' => 'FUNCTION',
+        'yldmat' => 'FUNCTION',
+        'yldtbill' => 'FUNCTION',
+        'ylim' => 'FUNCTION',
+        'yulewalk' => 'FUNCTION',
+        'z2abcd' => 'FUNCTION',
+        'z2gamma' => 'FUNCTION',
+        'z2h' => 'FUNCTION',
+        'z2s' => 'FUNCTION',
+        'z2y' => 'FUNCTION',
+        'zbtprice' => 'FUNCTION',
+        'zbtyield' => 'FUNCTION',
+        'zdatam' => 'FUNCTION',
+        'zero' => 'FUNCTION',
+        'zero2disc' => 'FUNCTION',
+        'zero2fwd' => 'FUNCTION',
+        'zero2pyld' => 'FUNCTION',
+        'zerom' => 'FUNCTION',
+        'zerophase' => 'FUNCTION',
+        'zeroprice' => 'FUNCTION',
+        'zeros' => 'FUNCTION',
+        'zeroyield' => 'FUNCTION',
+        'zeta' => 'FUNCTION',
+        'zgrid' => 'FUNCTION',
+        'zip' => 'FUNCTION',
+        'zlim' => 'FUNCTION',
+        'zmf' => 'FUNCTION',
+        'zonebackadj' => 'FUNCTION',
+        'zoom' => 'FUNCTION',
+        'zp2sos' => 'FUNCTION',
+        'zp2ss' => 'FUNCTION',
+        'zp2tf' => 'FUNCTION',
+        'zpk' => 'FUNCTION',
+        'zpkdata' => 'FUNCTION',
+        'zplane' => 'FUNCTION',
+        'zscore' => 'FUNCTION',
+        'ztest' => 'FUNCTION',
+        'ztrans' => 'FUNCTION'
+    );
+}
@@ -0,0 +1,5771 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from PhpKeywords by generate.php, do not edit.
+ */
+class PhpIdentifierMap
+{
+    public static $NAMES = array('FUNCTION', 'KEYWORD');
+
+    public static $MAP = array(
+        'phar' => 'FUNCTION',
+        'phardata' => 'FUNCTION',
+        'pharexception' => 'FUNCTION',
+        'pharfileinfo' => 'FUNCTION',
+        'abs' => 'FUNCTION',
+        'acos' => 'FUNCTION',
+        'acosh' => 'FUNCTION',
+        'addcslashes' => 'FUNCTION',
+        'addslashes' => 'FUNCTION',
+        'aggregate' => 'FUNCTION',
+        'aggregate_info' => 'FUNCTION',
+        'aggregate_methods' => 'FUNCTION',
+        'aggregate_methods_by_list' => 'FUNCTION',
+        'aggregate_methods_by_regexp' => 'FUNCTION',
+        'aggregate_properties' => 'FUNCTION',
+        'aggregate_properties_by_list' => 'FUNCTION',
+        'aggregate_properties_by_regexp' => 'FUNCTION',
+        'aggregation_info' => 'FUNCTION',
+        'amqpconnection' => 'FUNCTION',
+        'amqpexchange' => 'FUNCTION',
+        'amqpqueue' => 'FUNCTION',
+        'apache_child_terminate' => 'FUNCTION',
+        'apache_get_modules' => 'FUNCTION',
+        'apache_get_version' => 'FUNCTION',
+        'apache_getenv' => 'FUNCTION',
+        'apache_lookup_uri' => 'FUNCTION',
+        'apache_note' => 'FUNCTION',
+        'apache_request_headers' => 'FUNCTION',
+        'apache_reset_timeout' => 'FUNCTION',
+        'apache_response_headers' => 'FUNCTION',
+        'apache_setenv' => 'FUNCTION',
+        'apc_add' => 'FUNCTION',
+        'apc_bin_dump' => 'FUNCTION',
+        'apc_bin_dumpfile' => 'FUNCTION',
+        'apc_bin_load' => 'FUNCTION',
+        'apc_bin_loadfile' => 'FUNCTION',
+        'apc_cache_info' => 'FUNCTION',
+        'apc_cas' => 'FUNCTION',
+        'apc_clear_cache' => 'FUNCTION',
+        'apc_compile_file' => 'FUNCTION',
+        'apc_dec' => 'FUNCTION',
+        'apc_define_constants' => 'FUNCTION',
+        'apc_delete' => 'FUNCTION',
+        'apc_delete_file' => 'FUNCTION',
+        'apc_exists' => 'FUNCTION',
+        'apc_fetch' => 'FUNCTION',
+        'apc_inc' => 'FUNCTION',
+        'apc_load_constants' => 'FUNCTION',
+        'apc_sma_info' => 'FUNCTION',
+        'apc_store' => 'FUNCTION',
+        'apciterator' => 'FUNCTION',
+        'apd_breakpoint' => 'FUNCTION',
+        'apd_callstack' => 'FUNCTION',
+        'apd_clunk' => 'FUNCTION',
+        'apd_continue' => 'FUNCTION',
+        'apd_croak' => 'FUNCTION',
+        'apd_dump_function_table' => 'FUNCTION',
+        'apd_dump_persistent_resources' => 'FUNCTION',
+        'apd_dump_regular_resources' => 'FUNCTION',
+        'apd_echo' => 'FUNCTION',
+        'apd_get_active_symbols' => 'FUNCTION',
+        'apd_set_pprof_trace' => 'FUNCTION',
+        'apd_set_session' => 'FUNCTION',
+        'apd_set_session_trace' => 'FUNCTION',
+        'apd_set_session_trace_socket' => 'FUNCTION',
+        'appenditerator' => 'FUNCTION',
+        'array' => 'FUNCTION',
+        'array_change_key_case' => 'FUNCTION',
+        'array_chunk' => 'FUNCTION',
+        'array_combine' => 'FUNCTION',
+        'array_count_values' => 'FUNCTION',
+        'array_diff' => 'FUNCTION',
+        'array_diff_assoc' => 'FUNCTION',
+        'array_diff_key' => 'FUNCTION',
+        'array_diff_uassoc' => 'FUNCTION',
+        'array_diff_ukey' => 'FUNCTION',
+        'array_fill' => 'FUNCTION',
+        'array_fill_keys' => 'FUNCTION',
+        'array_filter' => 'FUNCTION',
+        'array_flip' => 'FUNCTION',
+        'array_intersect' => 'FUNCTION',
+        'array_intersect_assoc' => 'FUNCTION',
+        'array_intersect_key' => 'FUNCTION',
+        'array_intersect_uassoc' => 'FUNCTION',
+        'array_intersect_ukey' => 'FUNCTION',
+        'array_key_exists' => 'FUNCTION',
+        'array_keys' => 'FUNCTION',
+        'array_map' => 'FUNCTION',
+        'array_merge' => 'FUNCTION',
+        'array_merge_recursive' => 'FUNCTION',
+        'array_multisort' => 'FUNCTION',
+        'array_pad' => 'FUNCTION',
+        'array_pop' => 'FUNCTION',
+        'array_product' => 'FUNCTION',
+        'array_push' => 'FUNCTION',
+        'array_rand' => 'FUNCTION',
+        'array_reduce' => 'FUNCTION',
+        'array_replace' => 'FUNCTION',
+        'array_replace_recursive' => 'FUNCTION',
+        'array_reverse' => 'FUNCTION',
+        'array_search' => 'FUNCTION',
+        'array_shift' => 'FUNCTION',
+        'array_slice' => 'FUNCTION',
+        'array_splice' => 'FUNCTION',
+        'array_sum' => 'FUNCTION',
+        'array_udiff' => 'FUNCTION',
+        'array_udiff_assoc' => 'FUNCTION',
+        'array_udiff_uassoc' => 'FUNCTION',
+        'array_uintersect' => 'FUNCTION',
+        'array_uintersect_assoc' => 'FUNCTION',
+        'array_uintersect_uassoc' => 'FUNCTION',
+        'array_unique' => 'FUNCTION',
+        'array_unshift' => 'FUNCTION',
+        'array_values' => 'FUNCTION',
+        'array_walk' => 'FUNCTION',
+        'array_walk_recursive' => 'FUNCTION',
+        'arrayaccess' => 'FUNCTION',
+        'arrayiterator' => 'FUNCTION',
+        'arrayobject' => 'FUNCTION',
+        'arsort' => 'FUNCTION',
+        'asin' => 'FUNCTION',
+        'asinh' => 'FUNCTION',
+        'asort' => 'FUNCTION',
+        'assert' => 'FUNCTION',
+        'assert_options' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'atan2' => 'FUNCTION',
+        'atanh' => 'FUNCTION',
+        'audioproperties' => 'FUNCTION',
+        'badfunctioncallexception' => 'FUNCTION',
+        'badmethodcallexception' => 'FUNCTION',
+        'base64_decode' => 'FUNCTION',
+        'base64_encode' => 'FUNCTION',
+        'base_convert' => 'FUNCTION',
+        'basename' => 'FUNCTION',
+        'bbcode_add_element' => 'FUNCTION',
+        'bbcode_add_smiley' => 'FUNCTION',
+        'bbcode_create' => 'FUNCTION',
+        'bbcode_destroy' => 'FUNCTION',
+        'bbcode_parse' => 'FUNCTION',
+        'bbcode_set_arg_parser' => 'FUNCTION',
+        'bbcode_set_flags' => 'FUNCTION',
+        'bcadd' => 'FUNCTION',
+        'bccomp' => 'FUNCTION',
+        'bcdiv' => 'FUNCTION',
+        'bcmod' => 'FUNCTION',
+        'bcmul' => 'FUNCTION',
+        'bcompiler_load' => 'FUNCTION',
+        'bcompiler_load_exe' => 'FUNCTION',
+        'bcompiler_parse_class' => 'FUNCTION',
+        'bcompiler_read' => 'FUNCTION',
+        'bcompiler_write_class' => 'FUNCTION',
+        'bcompiler_write_constant' => 'FUNCTION',
+        'bcompiler_write_exe_footer' => 'FUNCTION',
+        'bcompiler_write_file' => 'FUNCTION',
+        'bcompiler_write_footer' => 'FUNCTION',
+        'bcompiler_write_function' => 'FUNCTION',
+        'bcompiler_write_functions_from_file' => 'FUNCTION',
+        'bcompiler_write_header' => 'FUNCTION',
+        'bcompiler_write_included_filename' => 'FUNCTION',
+        'bcpow' => 'FUNCTION',
+        'bcpowmod' => 'FUNCTION',
+        'bcscale' => 'FUNCTION',
+        'bcsqrt' => 'FUNCTION',
+        'bcsub' => 'FUNCTION',
+        'bin2hex' => 'FUNCTION',
+        'bind_textdomain_codeset' => 'FUNCTION',
+        'bindec' => 'FUNCTION',
+        'bindtextdomain' => 'FUNCTION',
+        'bson_decode' => 'FUNCTION',
+        'bson_encode' => 'FUNCTION',
+        'bumpvalue' => 'FUNCTION',
+        'bzclose' => 'FUNCTION',
+        'bzcompress' => 'FUNCTION',
+        'bzdecompress' => 'FUNCTION',
+        'bzerrno' => 'FUNCTION',
+        'bzerror' => 'FUNCTION',
+        'bzerrstr' => 'FUNCTION',
+        'bzflush' => 'FUNCTION',
+        'bzopen' => 'FUNCTION',
+        'bzread' => 'FUNCTION',
+        'bzwrite' => 'FUNCTION',
+        'cachingiterator' => 'FUNCTION',
+        'cairo' => 'FUNCTION',
+        'cairo_create' => 'FUNCTION',
+        'cairo_font_face_get_type' => 'FUNCTION',
+        'cairo_font_face_status' => 'FUNCTION',
+        'cairo_font_options_create' => 'FUNCTION',
+        'cairo_font_options_equal' => 'FUNCTION',
+        'cairo_font_options_get_antialias' => 'FUNCTION',
+        'cairo_font_options_get_hint_metrics' => 'FUNCTION',
+        'cairo_font_options_get_hint_style' => 'FUNCTION',
+        'cairo_font_options_get_subpixel_order' => 'FUNCTION',
+        'cairo_font_options_hash' => 'FUNCTION',
+        'cairo_font_options_merge' => 'FUNCTION',
+        'cairo_font_options_set_antialias' => 'FUNCTION',
+        'cairo_font_options_set_hint_metrics' => 'FUNCTION',
+        'cairo_font_options_set_hint_style' => 'FUNCTION',
+        'cairo_font_options_set_subpixel_order' => 'FUNCTION',
+        'cairo_font_options_status' => 'FUNCTION',
+        'cairo_format_stride_for_width' => 'FUNCTION',
+        'cairo_image_surface_create' => 'FUNCTION',
+        'cairo_image_surface_create_for_data' => 'FUNCTION',
+        'cairo_image_surface_create_from_png' => 'FUNCTION',
+        'cairo_image_surface_get_data' => 'FUNCTION',
+        'cairo_image_surface_get_format' => 'FUNCTION',
+        'cairo_image_surface_get_height' => 'FUNCTION',
+        'cairo_image_surface_get_stride' => 'FUNCTION',
+        'cairo_image_surface_get_width' => 'FUNCTION',
+        'cairo_matrix_create_scale' => 'FUNCTION',
+        'cairo_matrix_create_translate' => 'FUNCTION',
+        'cairo_matrix_invert' => 'FUNCTION',
+        'cairo_matrix_multiply' => 'FUNCTION',
+        'cairo_matrix_rotate' => 'FUNCTION',
+        'cairo_matrix_transform_distance' => 'FUNCTION',
+        'cairo_matrix_transform_point' => 'FUNCTION',
+        'cairo_matrix_translate' => 'FUNCTION',
+        'cairo_pattern_add_color_stop_rgb' => 'FUNCTION',
+        'cairo_pattern_add_color_stop_rgba' => 'FUNCTION',
+        'cairo_pattern_create_for_surface' => 'FUNCTION',
+        'cairo_pattern_create_linear' => 'FUNCTION',
+        'cairo_pattern_create_radial' => 'FUNCTION',
+        'cairo_pattern_create_rgb' => 'FUNCTION',
+        'cairo_pattern_create_rgba' => 'FUNCTION',
+        'cairo_pattern_get_color_stop_count' => 'FUNCTION',
+        'cairo_pattern_get_color_stop_rgba' => 'FUNCTION',
+        'cairo_pattern_get_extend' => 'FUNCTION',
+        'cairo_pattern_get_filter' => 'FUNCTION',
+        'cairo_pattern_get_linear_points' => 'FUNCTION',
+        'cairo_pattern_get_matrix' => 'FUNCTION',
+        'cairo_pattern_get_radial_circles' => 'FUNCTION',
+        'cairo_pattern_get_rgba' => 'FUNCTION',
+        'cairo_pattern_get_surface' => 'FUNCTION',
+        'cairo_pattern_get_type' => 'FUNCTION',
+        'cairo_pattern_set_extend' => 'FUNCTION',
+        'cairo_pattern_set_filter' => 'FUNCTION',
+        'cairo_pattern_set_matrix' => 'FUNCTION',
+        'cairo_pattern_status' => 'FUNCTION',
+        'cairo_pdf_surface_create' => 'FUNCTION',
+        'cairo_pdf_surface_set_size' => 'FUNCTION',
+        'cairo_ps_get_levels' => 'FUNCTION',
+        'cairo_ps_level_to_string' => 'FUNCTION',
+        'cairo_ps_surface_create' => 'FUNCTION',
+        'cairo_ps_surface_dsc_begin_page_setup' => 'FUNCTION',
+        'cairo_ps_surface_dsc_begin_setup' => 'FUNCTION',
+        'cairo_ps_surface_dsc_comment' => 'FUNCTION',
+        'cairo_ps_surface_get_eps' => 'FUNCTION',
+        'cairo_ps_surface_restrict_to_level' => 'FUNCTION',
+        'cairo_ps_surface_set_eps' => 'FUNCTION',
+        'cairo_ps_surface_set_size' => 'FUNCTION',
+        'cairo_scaled_font_create' => 'FUNCTION',
+        'cairo_scaled_font_extents' => 'FUNCTION',
+        'cairo_scaled_font_get_ctm' => 'FUNCTION',
+        'cairo_scaled_font_get_font_face' => 'FUNCTION',
+        'cairo_scaled_font_get_font_matrix' => 'FUNCTION',
+        'cairo_scaled_font_get_font_options' => 'FUNCTION',
+        'cairo_scaled_font_get_scale_matrix' => 'FUNCTION',
+        'cairo_scaled_font_get_type' => 'FUNCTION',
+        'cairo_scaled_font_glyph_extents' => 'FUNCTION',
+        'cairo_scaled_font_status' => 'FUNCTION',
+        'cairo_scaled_font_text_extents' => 'FUNCTION',
+        'cairo_surface_copy_page' => 'FUNCTION',
+        'cairo_surface_create_similar' => 'FUNCTION',
+        'cairo_surface_finish' => 'FUNCTION',
+        'cairo_surface_flush' => 'FUNCTION',
+        'cairo_surface_get_content' => 'FUNCTION',
+        'cairo_surface_get_device_offset' => 'FUNCTION',
+        'cairo_surface_get_font_options' => 'FUNCTION',
+        'cairo_surface_get_type' => 'FUNCTION',
+        'cairo_surface_mark_dirty' => 'FUNCTION',
+        'cairo_surface_mark_dirty_rectangle' => 'FUNCTION',
+        'cairo_surface_set_device_offset' => 'FUNCTION',
+        'cairo_surface_set_fallback_resolution' => 'FUNCTION',
+        'cairo_surface_show_page' => 'FUNCTION',
+        'cairo_surface_status' => 'FUNCTION',
+        'cairo_surface_write_to_png' => 'FUNCTION',
+        'cairo_svg_surface_create' => 'FUNCTION',
+        'cairo_svg_surface_restrict_to_version' => 'FUNCTION',
+        'cairo_svg_version_to_string' => 'FUNCTION',
+        'cairoantialias' => 'FUNCTION',
+        'cairocontent' => 'FUNCTION',
+        'cairocontext' => 'FUNCTION',
+        'cairoexception' => 'FUNCTION',
+        'cairoextend' => 'FUNCTION',
+        'cairofillrule' => 'FUNCTION',
+        'cairofilter' => 'FUNCTION',
+        'cairofontface' => 'FUNCTION',
+        'cairofontoptions' => 'FUNCTION',
+        'cairofontslant' => 'FUNCTION',
+        'cairofonttype' => 'FUNCTION',
+        'cairofontweight' => 'FUNCTION',
+        'cairoformat' => 'FUNCTION',
+        'cairogradientpattern' => 'FUNCTION',
+        'cairohintmetrics' => 'FUNCTION',
+        'cairohintstyle' => 'FUNCTION',
+        'cairoimagesurface' => 'FUNCTION',
+        'cairolineargradient' => 'FUNCTION',
+        'cairolinecap' => 'FUNCTION',
+        'cairolinejoin' => 'FUNCTION',
+        'cairomatrix' => 'FUNCTION',
+        'cairooperator' => 'FUNCTION',
+        'cairopath' => 'FUNCTION',
+        'cairopattern' => 'FUNCTION',
+        'cairopatterntype' => 'FUNCTION',
+        'cairopdfsurface' => 'FUNCTION',
+        'cairopslevel' => 'FUNCTION',
+        'cairopssurface' => 'FUNCTION',
+        'cairoradialgradient' => 'FUNCTION',
+        'cairoscaledfont' => 'FUNCTION',
+        'cairosolidpattern' => 'FUNCTION',
+        'cairostatus' => 'FUNCTION',
+        'cairosubpixelorder' => 'FUNCTION',
+        'cairosurface' => 'FUNCTION',
+        'cairosurfacepattern' => 'FUNCTION',
+        'cairosurfacetype' => 'FUNCTION',
+        'cairosvgsurface' => 'FUNCTION',
+        'cairosvgversion' => 'FUNCTION',
+        'cairotoyfontface' => 'FUNCTION',
+        'cal_days_in_month' => 'FUNCTION',
+        'cal_from_jd' => 'FUNCTION',
+        'cal_info' => 'FUNCTION',
+        'cal_to_jd' => 'FUNCTION',
+        'calcul_hmac' => 'FUNCTION',
+        'calculhmac' => 'FUNCTION',
+        'call_user_func' => 'FUNCTION',
+        'call_user_func_array' => 'FUNCTION',
+        'call_user_method' => 'FUNCTION',
+        'call_user_method_array' => 'FUNCTION',
+        'ceil' => 'FUNCTION',
+        'chdb' => 'FUNCTION',
+        'chdb_create' => 'FUNCTION',
+        'chdir' => 'FUNCTION',
+        'checkdate' => 'FUNCTION',
+        'checkdnsrr' => 'FUNCTION',
+        'chgrp' => 'FUNCTION',
+        'chmod' => 'FUNCTION',
+        'chop' => 'FUNCTION',
+        'chown' => 'FUNCTION',
+        'chr' => 'FUNCTION',
+        'chroot' => 'FUNCTION',
+        'chunk_split' => 'FUNCTION',
+        'class_alias' => 'FUNCTION',
+        'class_exists' => 'FUNCTION',
+        'class_implements' => 'FUNCTION',
+        'class_parents' => 'FUNCTION',
+        'classkit_import' => 'FUNCTION',
+        'classkit_method_add' => 'FUNCTION',
+        'classkit_method_copy' => 'FUNCTION',
+        'classkit_method_redefine' => 'FUNCTION',
+        'classkit_method_remove' => 'FUNCTION',
+        'classkit_method_rename' => 'FUNCTION',
+        'clearstatcache' => 'FUNCTION',
+        'closedir' => 'FUNCTION',
+        'closelog' => 'FUNCTION',
+        'collator' => 'FUNCTION',
+        'com' => 'FUNCTION',
+        'com_addref' => 'FUNCTION',
+        'com_create_guid' => 'FUNCTION',
+        'com_event_sink' => 'FUNCTION',
+        'com_get' => 'FUNCTION',
+        'com_get_active_object' => 'FUNCTION',
+        'com_invoke' => 'FUNCTION',
+        'com_isenum' => 'FUNCTION',
+        'com_load' => 'FUNCTION',
+        'com_load_typelib' => 'FUNCTION',
+        'com_message_pump' => 'FUNCTION',
+        'com_print_typeinfo' => 'FUNCTION',
+        'com_propget' => 'FUNCTION',
+        'com_propput' => 'FUNCTION',
+        'com_propset' => 'FUNCTION',
+        'com_release' => 'FUNCTION',
+        'com_set' => 'FUNCTION',
+        'compact' => 'FUNCTION',
+        'connection_aborted' => 'FUNCTION',
+        'connection_status' => 'FUNCTION',
+        'connection_timeout' => 'FUNCTION',
+        'constant' => 'FUNCTION',
+        'construct' => 'FUNCTION',
+        'convert_cyr_string' => 'FUNCTION',
+        'convert_uudecode' => 'FUNCTION',
+        'convert_uuencode' => 'FUNCTION',
+        'copy' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'cosh' => 'FUNCTION',
+        'count' => 'FUNCTION',
+        'count_chars' => 'FUNCTION',
+        'countable' => 'FUNCTION',
+        'counter_bump' => 'FUNCTION',
+        'counter_bump_value' => 'FUNCTION',
+        'counter_create' => 'FUNCTION',
+        'counter_get' => 'FUNCTION',
+        'counter_get_meta' => 'FUNCTION',
+        'counter_get_named' => 'FUNCTION',
+        'counter_get_value' => 'FUNCTION',
+        'counter_reset' => 'FUNCTION',
+        'counter_reset_value' => 'FUNCTION',
+        'crack_check' => 'FUNCTION',
+        'crack_closedict' => 'FUNCTION',
+        'crack_getlastmessage' => 'FUNCTION',
+        'crack_opendict' => 'FUNCTION',
+        'crc32' => 'FUNCTION',
+        'create_function' => 'FUNCTION',
+        'crypt' => 'FUNCTION',
+        'ctype_alnum' => 'FUNCTION',
+        'ctype_alpha' => 'FUNCTION',
+        'ctype_cntrl' => 'FUNCTION',
+        'ctype_digit' => 'FUNCTION',
+        'ctype_graph' => 'FUNCTION',
+        'ctype_lower' => 'FUNCTION',
+        'ctype_print' => 'FUNCTION',
+        'ctype_punct' => 'FUNCTION',
+        'ctype_space' => 'FUNCTION',
+        'ctype_upper' => 'FUNCTION',
+        'ctype_xdigit' => 'FUNCTION',
+        'cubrid_affected_rows' => 'FUNCTION',
+        'cubrid_bind' => 'FUNCTION',
+        'cubrid_client_encoding' => 'FUNCTION',
+        'cubrid_close' => 'FUNCTION',
+        'cubrid_close_prepare' => 'FUNCTION',
+        'cubrid_close_request' => 'FUNCTION',
+        'cubrid_col_get' => 'FUNCTION',
+        'cubrid_col_size' => 'FUNCTION',
+        'cubrid_column_names' => 'FUNCTION',
+        'cubrid_column_types' => 'FUNCTION',
+        'cubrid_commit' => 'FUNCTION',
+        'cubrid_connect' => 'FUNCTION',
+        'cubrid_connect_with_url' => 'FUNCTION',
+        'cubrid_current_oid' => 'FUNCTION',
+        'cubrid_data_seek' => 'FUNCTION',
+        'cubrid_db_name' => 'FUNCTION',
+        'cubrid_disconnect' => 'FUNCTION',
+        'cubrid_drop' => 'FUNCTION',
+        'cubrid_errno' => 'FUNCTION',
+        'cubrid_error' => 'FUNCTION',
+        'cubrid_error_code' => 'FUNCTION',
+        'cubrid_error_code_facility' => 'FUNCTION',
+        'cubrid_error_msg' => 'FUNCTION',
+        'cubrid_execute' => 'FUNCTION',
+        'cubrid_fetch' => 'FUNCTION',
+        'cubrid_fetch_array' => 'FUNCTION',
+        'cubrid_fetch_assoc' => 'FUNCTION',
+        'cubrid_fetch_field' => 'FUNCTION',
+        'cubrid_fetch_lengths' => 'FUNCTION',
+        'cubrid_fetch_object' => 'FUNCTION',
+        'cubrid_fetch_row' => 'FUNCTION',
+        'cubrid_field_flags' => 'FUNCTION',
+        'cubrid_field_len' => 'FUNCTION',
+        'cubrid_field_name' => 'FUNCTION',
+        'cubrid_field_seek' => 'FUNCTION',
+        'cubrid_field_table' => 'FUNCTION',
+        'cubrid_field_type' => 'FUNCTION',
+        'cubrid_free_result' => 'FUNCTION',
+        'cubrid_get' => 'FUNCTION',
+        'cubrid_get_charset' => 'FUNCTION',
+        'cubrid_get_class_name' => 'FUNCTION',
+        'cubrid_get_client_info' => 'FUNCTION',
+        'cubrid_get_db_parameter' => 'FUNCTION',
+        'cubrid_get_server_info' => 'FUNCTION',
+        'cubrid_insert_id' => 'FUNCTION',
+        'cubrid_is_instance' => 'FUNCTION',
+        'cubrid_list_dbs' => 'FUNCTION',
+        'cubrid_load_from_glo' => 'FUNCTION',
+        'cubrid_lob_close' => 'FUNCTION',
+        'cubrid_lob_export' => 'FUNCTION',
+        'cubrid_lob_get' => 'FUNCTION',
+        'cubrid_lob_send' => 'FUNCTION',
+        'cubrid_lob_size' => 'FUNCTION',
+        'cubrid_lock_read' => 'FUNCTION',
+        'cubrid_lock_write' => 'FUNCTION',
+        'cubrid_move_cursor' => 'FUNCTION',
+        'cubrid_new_glo' => 'FUNCTION',
+        'cubrid_num_cols' => 'FUNCTION',
+        'cubrid_num_fields' => 'FUNCTION',
+        'cubrid_num_rows' => 'FUNCTION',
+        'cubrid_ping' => 'FUNCTION',
+        'cubrid_prepare' => 'FUNCTION',
+        'cubrid_put' => 'FUNCTION',
+        'cubrid_query' => 'FUNCTION',
+        'cubrid_real_escape_string' => 'FUNCTION',
+        'cubrid_result' => 'FUNCTION',
+        'cubrid_rollback' => 'FUNCTION',
+        'cubrid_save_to_glo' => 'FUNCTION',
+        'cubrid_schema' => 'FUNCTION',
+        'cubrid_send_glo' => 'FUNCTION',
+        'cubrid_seq_drop' => 'FUNCTION',
+        'cubrid_seq_insert' => 'FUNCTION',
+        'cubrid_seq_put' => 'FUNCTION',
+        'cubrid_set_add' => 'FUNCTION',
+        'cubrid_set_drop' => 'FUNCTION',
+        'cubrid_unbuffered_query' => 'FUNCTION',
+        'cubrid_version' => 'FUNCTION',
+        'curl_close' => 'FUNCTION',
+        'curl_copy_handle' => 'FUNCTION',
+        'curl_errno' => 'FUNCTION',
+        'curl_error' => 'FUNCTION',
+        'curl_exec' => 'FUNCTION',
+        'curl_getinfo' => 'FUNCTION',
+        'curl_init' => 'FUNCTION',
+        'curl_multi_add_handle' => 'FUNCTION',
+        'curl_multi_close' => 'FUNCTION',
+        'curl_multi_exec' => 'FUNCTION',
+        'curl_multi_getcontent' => 'FUNCTION',
+        'curl_multi_info_read' => 'FUNCTION',
+        'curl_multi_init' => 'FUNCTION',
+        'curl_multi_remove_handle' => 'FUNCTION',
+        'curl_multi_select' => 'FUNCTION',
+        'curl_setopt' => 'FUNCTION',
+        'curl_setopt_array' => 'FUNCTION',
+        'curl_version' => 'FUNCTION',
+        'current' => 'FUNCTION',
+        'cyrus_authenticate' => 'FUNCTION',
+        'cyrus_bind' => 'FUNCTION',
+        'cyrus_close' => 'FUNCTION',
+        'cyrus_connect' => 'FUNCTION',
+        'cyrus_query' => 'FUNCTION',
+        'cyrus_unbind' => 'FUNCTION',
+        'date' => 'FUNCTION',
+        'date_add' => 'FUNCTION',
+        'date_create' => 'FUNCTION',
+        'date_create_from_format' => 'FUNCTION',
+        'date_date_set' => 'FUNCTION',
+        'date_default_timezone_get' => 'FUNCTION',
+        'date_default_timezone_set' => 'FUNCTION',
+        'date_diff' => 'FUNCTION',
+        'date_format' => 'FUNCTION',
+        'date_get_last_errors' => 'FUNCTION',
+        'date_interval_create_from_date_string' => 'FUNCTION',
+        'date_interval_format' => 'FUNCTION',
+        'date_isodate_set' => 'FUNCTION',
+        'date_modify' => 'FUNCTION',
+        'date_offset_get' => 'FUNCTION',
+        'date_parse' => 'FUNCTION',
+        'date_parse_from_format' => 'FUNCTION',
+        'date_sub' => 'FUNCTION',
+        'date_sun_info' => 'FUNCTION',
+        'date_sunrise' => 'FUNCTION',
+        'date_sunset' => 'FUNCTION',
+        'date_time_set' => 'FUNCTION',
+        'date_timestamp_get' => 'FUNCTION',
+        'date_timestamp_set' => 'FUNCTION',
+        'date_timezone_get' => 'FUNCTION',
+        'date_timezone_set' => 'FUNCTION',
+        'dateinterval' => 'FUNCTION',
+        'dateperiod' => 'FUNCTION',
+        'datetime' => 'FUNCTION',
+        'datetimezone' => 'FUNCTION',
+        'db2_autocommit' => 'FUNCTION',
+        'db2_bind_param' => 'FUNCTION',
+        'db2_client_info' => 'FUNCTION',
+        'db2_close' => 'FUNCTION',
+        'db2_column_privileges' => 'FUNCTION',
+        'db2_columns' => 'FUNCTION',
+        'db2_commit' => 'FUNCTION',
+        'db2_conn_error' => 'FUNCTION',
+        'db2_conn_errormsg' => 'FUNCTION',
+        'db2_connect' => 'FUNCTION',
+        'db2_cursor_type' => 'FUNCTION',
+        'db2_escape_string' => 'FUNCTION',
+        'db2_exec' => 'FUNCTION',
+        'db2_execute' => 'FUNCTION',
+        'db2_fetch_array' => 'FUNCTION',
+        'db2_fetch_assoc' => 'FUNCTION',
+        'db2_fetch_both' => 'FUNCTION',
+        'db2_fetch_object' => 'FUNCTION',
+        'db2_fetch_row' => 'FUNCTION',
+        'db2_field_display_size' => 'FUNCTION',
+        'db2_field_name' => 'FUNCTION',
+        'db2_field_num' => 'FUNCTION',
+        'db2_field_precision' => 'FUNCTION',
+        'db2_field_scale' => 'FUNCTION',
+        'db2_field_type' => 'FUNCTION',
+        'db2_field_width' => 'FUNCTION',
+        'db2_foreign_keys' => 'FUNCTION',
+        'db2_free_result' => 'FUNCTION',
+        'db2_free_stmt' => 'FUNCTION',
+        'db2_get_option' => 'FUNCTION',
+        'db2_last_insert_id' => 'FUNCTION',
+        'db2_lob_read' => 'FUNCTION',
+        'db2_next_result' => 'FUNCTION',
+        'db2_num_fields' => 'FUNCTION',
+        'db2_num_rows' => 'FUNCTION',
+        'db2_pclose' => 'FUNCTION',
+        'db2_pconnect' => 'FUNCTION',
+        'db2_prepare' => 'FUNCTION',
+        'db2_primary_keys' => 'FUNCTION',
+        'db2_procedure_columns' => 'FUNCTION',
+        'db2_procedures' => 'FUNCTION',
+        'db2_result' => 'FUNCTION',
+        'db2_rollback' => 'FUNCTION',
+        'db2_server_info' => 'FUNCTION',
+        'db2_set_option' => 'FUNCTION',
+        'db2_special_columns' => 'FUNCTION',
+        'db2_statistics' => 'FUNCTION',
+        'db2_stmt_error' => 'FUNCTION',
+        'db2_stmt_errormsg' => 'FUNCTION',
+        'db2_table_privileges' => 'FUNCTION',
+        'db2_tables' => 'FUNCTION',
+        'dba_close' => 'FUNCTION',
+        'dba_delete' => 'FUNCTION',
+        'dba_exists' => 'FUNCTION',
+        'dba_fetch' => 'FUNCTION',
+        'dba_firstkey' => 'FUNCTION',
+        'dba_handlers' => 'FUNCTION',
+        'dba_insert' => 'FUNCTION',
+        'dba_key_split' => 'FUNCTION',
+        'dba_list' => 'FUNCTION',
+        'dba_nextkey' => 'FUNCTION',
+        'dba_open' => 'FUNCTION',
+        'dba_optimize' => 'FUNCTION',
+        'dba_popen' => 'FUNCTION',
+        'dba_replace' => 'FUNCTION',
+        'dba_sync' => 'FUNCTION',
+        'dbase_add_record' => 'FUNCTION',
+        'dbase_close' => 'FUNCTION',
+        'dbase_create' => 'FUNCTION',
+        'dbase_delete_record' => 'FUNCTION',
+        'dbase_get_header_info' => 'FUNCTION',
+        'dbase_get_record' => 'FUNCTION',
+        'dbase_get_record_with_names' => 'FUNCTION',
+        'dbase_numfields' => 'FUNCTION',
+        'dbase_numrecords' => 'FUNCTION',
+        'dbase_open' => 'FUNCTION',
+        'dbase_pack' => 'FUNCTION',
+        'dbase_replace_record' => 'FUNCTION',
+        'dbplus_add' => 'FUNCTION',
+        'dbplus_aql' => 'FUNCTION',
+        'dbplus_chdir' => 'FUNCTION',
+        'dbplus_close' => 'FUNCTION',
+        'dbplus_curr' => 'FUNCTION',
+        'dbplus_errcode' => 'FUNCTION',
+        'dbplus_errno' => 'FUNCTION',
+        'dbplus_find' => 'FUNCTION',
+        'dbplus_first' => 'FUNCTION',
+        'dbplus_flush' => 'FUNCTION',
+        'dbplus_freealllocks' => 'FUNCTION',
+        'dbplus_freelock' => 'FUNCTION',
+        'dbplus_freerlocks' => 'FUNCTION',
+        'dbplus_getlock' => 'FUNCTION',
+        'dbplus_getunique' => 'FUNCTION',
+        'dbplus_info' => 'FUNCTION',
+        'dbplus_last' => 'FUNCTION',
+        'dbplus_lockrel' => 'FUNCTION',
+        'dbplus_next' => 'FUNCTION',
+        'dbplus_open' => 'FUNCTION',
+        'dbplus_prev' => 'FUNCTION',
+        'dbplus_rchperm' => 'FUNCTION',
+        'dbplus_rcreate' => 'FUNCTION',
+        'dbplus_rcrtexact' => 'FUNCTION',
+        'dbplus_rcrtlike' => 'FUNCTION',
+        'dbplus_resolve' => 'FUNCTION',
+        'dbplus_restorepos' => 'FUNCTION',
+        'dbplus_rkeys' => 'FUNCTION',
+        'dbplus_ropen' => 'FUNCTION',
+        'dbplus_rquery' => 'FUNCTION',
+        'dbplus_rrename' => 'FUNCTION',
+        'dbplus_rsecindex' => 'FUNCTION',
+        'dbplus_runlink' => 'FUNCTION',
+        'dbplus_rzap' => 'FUNCTION',
+        'dbplus_savepos' => 'FUNCTION',
+        'dbplus_setindex' => 'FUNCTION',
+        'dbplus_setindexbynumber' => 'FUNCTION',
+        'dbplus_sql' => 'FUNCTION',
+        'dbplus_tcl' => 'FUNCTION',
+        'dbplus_tremove' => 'FUNCTION',
+        'dbplus_undo' => 'FUNCTION',
+        'dbplus_undoprepare' => 'FUNCTION',
+        'dbplus_unlockrel' => 'FUNCTION',
+        'dbplus_unselect' => 'FUNCTION',
+        'dbplus_update' => 'FUNCTION',
+        'dbplus_xlockrel' => 'FUNCTION',
+        'dbplus_xunlockrel' => 'FUNCTION',
+        'dbx_close' => 'FUNCTION',
+        'dbx_compare' => 'FUNCTION',
+        'dbx_connect' => 'FUNCTION',
+        'dbx_error' => 'FUNCTION',
+        'dbx_escape_string' => 'FUNCTION',
+        'dbx_fetch_row' => 'FUNCTION',
+        'dbx_query' => 'FUNCTION',
+        'dbx_sort' => 'FUNCTION',
+        'dcgettext' => 'FUNCTION',
+        'dcngettext' => 'FUNCTION',
+        'deaggregate' => 'FUNCTION',
+        'debug_backtrace' => 'FUNCTION',
+        'debug_print_backtrace' => 'FUNCTION',
+        'debug_zval_dump' => 'FUNCTION',
+        'decbin' => 'FUNCTION',
+        'dechex' => 'FUNCTION',
+        'decoct' => 'FUNCTION',
+        'define' => 'FUNCTION',
+        'define_syslog_variables' => 'FUNCTION',
+        'defined' => 'FUNCTION',
+        'deg2rad' => 'FUNCTION',
+        'delete' => 'FUNCTION',
+        'dgettext' => 'FUNCTION',
+        'die' => 'FUNCTION',
+        'dio_close' => 'FUNCTION',
+        'dio_fcntl' => 'FUNCTION',
+        'dio_open' => 'FUNCTION',
+        'dio_read' => 'FUNCTION',
+        'dio_seek' => 'FUNCTION',
+        'dio_stat' => 'FUNCTION',
+        'dio_tcsetattr' => 'FUNCTION',
+        'dio_truncate' => 'FUNCTION',
+        'dio_write' => 'FUNCTION',
+        'dir' => 'FUNCTION',
+        'directoryiterator' => 'FUNCTION',
+        'dirname' => 'FUNCTION',
+        'disk_free_space' => 'FUNCTION',
+        'disk_total_space' => 'FUNCTION',
+        'diskfreespace' => 'FUNCTION',
+        'dl' => 'FUNCTION',
+        'dngettext' => 'FUNCTION',
+        'dns_check_record' => 'FUNCTION',
+        'dns_get_mx' => 'FUNCTION',
+        'dns_get_record' => 'FUNCTION',
+        'dom_import_simplexml' => 'FUNCTION',
+        'domainexception' => 'FUNCTION',
+        'domattr' => 'FUNCTION',
+        'domattribute_name' => 'FUNCTION',
+        'domattribute_set_value' => 'FUNCTION',
+        'domattribute_specified' => 'FUNCTION',
+        'domattribute_value' => 'FUNCTION',
+        'domcharacterdata' => 'FUNCTION',
+        'domcomment' => 'FUNCTION',
+        'domdocument' => 'FUNCTION',
+        'domdocument_add_root' => 'FUNCTION',
+        'domdocument_create_attribute' => 'FUNCTION',
+        'domdocument_create_cdata_section' => 'FUNCTION',
+        'domdocument_create_comment' => 'FUNCTION',
+        'domdocument_create_element' => 'FUNCTION',
+        'domdocument_create_element_ns' => 'FUNCTION',
+        'domdocument_create_entity_reference' => 'FUNCTION',
+        'domdocument_create_processing_instruction' => 'FUNCTION',
+        'domdocument_create_text_node' => 'FUNCTION',
+        'domdocument_doctype' => 'FUNCTION',
+        'domdocument_document_element' => 'FUNCTION',
+        'domdocument_dump_file' => 'FUNCTION',
+        'domdocument_dump_mem' => 'FUNCTION',
+        'domdocument_get_element_by_id' => 'FUNCTION',
+        'domdocument_get_elements_by_tagname' => 'FUNCTION',
+        'domdocument_html_dump_mem' => 'FUNCTION',
+        'domdocument_xinclude' => 'FUNCTION',
+        'domdocumentfragment' => 'FUNCTION',
+        'domdocumenttype' => 'FUNCTION',
+        'domdocumenttype_entities' => 'FUNCTION',
+        'domdocumenttype_internal_subset' => 'FUNCTION',
+        'domdocumenttype_name' => 'FUNCTION',
+        'domdocumenttype_notations' => 'FUNCTION',
+        'domdocumenttype_public_id' => 'FUNCTION',
+        'domdocumenttype_system_id' => 'FUNCTION',
+        'domelement' => 'FUNCTION',
+        'domelement_get_attribute' => 'FUNCTION',
+        'domelement_get_attribute_node' => 'FUNCTION',
+        'domelement_get_elements_by_tagname' => 'FUNCTION',
+        'domelement_has_attribute' => 'FUNCTION',
+        'domelement_remove_attribute' => 'FUNCTION',
+        'domelement_set_attribute' => 'FUNCTION',
+        'domelement_set_attribute_node' => 'FUNCTION',
+        'domelement_tagname' => 'FUNCTION',
+        'domentity' => 'FUNCTION',
+        'domentityreference' => 'FUNCTION',
+        'domexception' => 'FUNCTION',
+        'domimplementation' => 'FUNCTION',
+        'domnamednodemap' => 'FUNCTION',
+        'domnode' => 'FUNCTION',
+        'domnode_add_namespace' => 'FUNCTION',
+        'domnode_append_child' => 'FUNCTION',
+        'domnode_append_sibling' => 'FUNCTION',
+        'domnode_attributes' => 'FUNCTION',
+        'domnode_child_nodes' => 'FUNCTION',
+        'domnode_clone_node' => 'FUNCTION',
+        'domnode_dump_node' => 'FUNCTION',
+        'domnode_first_child' => 'FUNCTION',
+        'domnode_get_content' => 'FUNCTION',
+        'domnode_has_attributes' => 'FUNCTION',
+        'domnode_has_child_nodes' => 'FUNCTION',
+        'domnode_insert_before' => 'FUNCTION',
+        'domnode_is_blank_node' => 'FUNCTION',
+        'domnode_last_child' => 'FUNCTION',
+        'domnode_next_sibling' => 'FUNCTION',
+        'domnode_node_name' => 'FUNCTION',
+        'domnode_node_type' => 'FUNCTION',
+        'domnode_node_value' => 'FUNCTION',
+        'domnode_owner_document' => 'FUNCTION',
+        'domnode_parent_node' => 'FUNCTION',
+        'domnode_prefix' => 'FUNCTION',
+        'domnode_previous_sibling' => 'FUNCTION',
+        'domnode_remove_child' => 'FUNCTION',
+        'domnode_replace_child' => 'FUNCTION',
+        'domnode_replace_node' => 'FUNCTION',
+        'domnode_set_content' => 'FUNCTION',
+        'domnode_set_name' => 'FUNCTION',
+        'domnode_set_namespace' => 'FUNCTION',
+        'domnode_unlink_node' => 'FUNCTION',
+        'domnodelist' => 'FUNCTION',
+        'domnotation' => 'FUNCTION',
+        'domprocessinginstruction' => 'FUNCTION',
+        'domprocessinginstruction_data' => 'FUNCTION',
+        'domprocessinginstruction_target' => 'FUNCTION',
+        'domtext' => 'FUNCTION',
+        'domxml_new_doc' => 'FUNCTION',
+        'domxml_open_file' => 'FUNCTION',
+        'domxml_open_mem' => 'FUNCTION',
+        'domxml_version' => 'FUNCTION',
+        'domxml_xmltree' => 'FUNCTION',
+        'domxml_xslt_stylesheet' => 'FUNCTION',
+        'domxml_xslt_stylesheet_doc' => 'FUNCTION',
+        'domxml_xslt_stylesheet_file' => 'FUNCTION',
+        'domxml_xslt_version' => 'FUNCTION',
+        'domxpath' => 'FUNCTION',
+        'domxsltstylesheet_process' => 'FUNCTION',
+        'domxsltstylesheet_result_dump_file' => 'FUNCTION',
+        'domxsltstylesheet_result_dump_mem' => 'FUNCTION',
+        'dotnet' => 'FUNCTION',
+        'dotnet_load' => 'FUNCTION',
+        'doubleval' => 'FUNCTION',
+        'each' => 'FUNCTION',
+        'easter_date' => 'FUNCTION',
+        'easter_days' => 'FUNCTION',
+        'echo' => 'FUNCTION',
+        'empty' => 'FUNCTION',
+        'emptyiterator' => 'FUNCTION',
+        'enchant_broker_describe' => 'FUNCTION',
+        'enchant_broker_dict_exists' => 'FUNCTION',
+        'enchant_broker_free' => 'FUNCTION',
+        'enchant_broker_free_dict' => 'FUNCTION',
+        'enchant_broker_get_error' => 'FUNCTION',
+        'enchant_broker_init' => 'FUNCTION',
+        'enchant_broker_list_dicts' => 'FUNCTION',
+        'enchant_broker_request_dict' => 'FUNCTION',
+        'enchant_broker_request_pwl_dict' => 'FUNCTION',
+        'enchant_broker_set_ordering' => 'FUNCTION',
+        'enchant_dict_add_to_personal' => 'FUNCTION',
+        'enchant_dict_add_to_session' => 'FUNCTION',
+        'enchant_dict_check' => 'FUNCTION',
+        'enchant_dict_describe' => 'FUNCTION',
+        'enchant_dict_get_error' => 'FUNCTION',
+        'enchant_dict_is_in_session' => 'FUNCTION',
+        'enchant_dict_quick_check' => 'FUNCTION',
+        'enchant_dict_store_replacement' => 'FUNCTION',
+        'enchant_dict_suggest' => 'FUNCTION',
+        'end' => 'FUNCTION',
+        'ereg' => 'FUNCTION',
+        'ereg_replace' => 'FUNCTION',
+        'eregi' => 'FUNCTION',
+        'eregi_replace' => 'FUNCTION',
+        'error_get_last' => 'FUNCTION',
+        'error_log' => 'FUNCTION',
+        'error_reporting' => 'FUNCTION',
+        'errorexception' => 'FUNCTION',
+        'escapeshellarg' => 'FUNCTION',
+        'escapeshellcmd' => 'FUNCTION',
+        'eval' => 'FUNCTION',
+        'event_add' => 'FUNCTION',
+        'event_base_free' => 'FUNCTION',
+        'event_base_loop' => 'FUNCTION',
+        'event_base_loopbreak' => 'FUNCTION',
+        'event_base_loopexit' => 'FUNCTION',
+        'event_base_new' => 'FUNCTION',
+        'event_base_priority_init' => 'FUNCTION',
+        'event_base_set' => 'FUNCTION',
+        'event_buffer_base_set' => 'FUNCTION',
+        'event_buffer_disable' => 'FUNCTION',
+        'event_buffer_enable' => 'FUNCTION',
+        'event_buffer_fd_set' => 'FUNCTION',
+        'event_buffer_free' => 'FUNCTION',
+        'event_buffer_new' => 'FUNCTION',
+        'event_buffer_priority_set' => 'FUNCTION',
+        'event_buffer_read' => 'FUNCTION',
+        'event_buffer_set_callback' => 'FUNCTION',
+        'event_buffer_timeout_set' => 'FUNCTION',
+        'event_buffer_watermark_set' => 'FUNCTION',
+        'event_buffer_write' => 'FUNCTION',
+        'event_del' => 'FUNCTION',
+        'event_free' => 'FUNCTION',
+        'event_new' => 'FUNCTION',
+        'event_set' => 'FUNCTION',
+        'exception' => 'FUNCTION',
+        'exec' => 'FUNCTION',
+        'exif_imagetype' => 'FUNCTION',
+        'exif_read_data' => 'FUNCTION',
+        'exif_tagname' => 'FUNCTION',
+        'exif_thumbnail' => 'FUNCTION',
+        'exit' => 'FUNCTION',
+        'exp' => 'FUNCTION',
+        'expect_expectl' => 'FUNCTION',
+        'expect_popen' => 'FUNCTION',
+        'explode' => 'FUNCTION',
+        'expm1' => 'FUNCTION',
+        'export' => 'FUNCTION',
+        'extension_loaded' => 'FUNCTION',
+        'extract' => 'FUNCTION',
+        'ezmlm_hash' => 'FUNCTION',
+        'fam_cancel_monitor' => 'FUNCTION',
+        'fam_close' => 'FUNCTION',
+        'fam_monitor_collection' => 'FUNCTION',
+        'fam_monitor_directory' => 'FUNCTION',
+        'fam_monitor_file' => 'FUNCTION',
+        'fam_next_event' => 'FUNCTION',
+        'fam_open' => 'FUNCTION',
+        'fam_pending' => 'FUNCTION',
+        'fam_resume_monitor' => 'FUNCTION',
+        'fam_suspend_monitor' => 'FUNCTION',
+        'fbsql_affected_rows' => 'FUNCTION',
+        'fbsql_autocommit' => 'FUNCTION',
+        'fbsql_blob_size' => 'FUNCTION',
+        'fbsql_change_user' => 'FUNCTION',
+        'fbsql_clob_size' => 'FUNCTION',
+        'fbsql_close' => 'FUNCTION',
+        'fbsql_commit' => 'FUNCTION',
+        'fbsql_connect' => 'FUNCTION',
+        'fbsql_create_blob' => 'FUNCTION',
+        'fbsql_create_clob' => 'FUNCTION',
+        'fbsql_create_db' => 'FUNCTION',
+        'fbsql_data_seek' => 'FUNCTION',
+        'fbsql_database' => 'FUNCTION',
+        'fbsql_database_password' => 'FUNCTION',
+        'fbsql_db_query' => 'FUNCTION',
+        'fbsql_db_status' => 'FUNCTION',
+        'fbsql_drop_db' => 'FUNCTION',
+        'fbsql_errno' => 'FUNCTION',
+        'fbsql_error' => 'FUNCTION',
+        'fbsql_fetch_array' => 'FUNCTION',
+        'fbsql_fetch_assoc' => 'FUNCTION',
+        'fbsql_fetch_field' => 'FUNCTION',
+        'fbsql_fetch_lengths' => 'FUNCTION',
+        'fbsql_fetch_object' => 'FUNCTION',
+        'fbsql_fetch_row' => 'FUNCTION',
+        'fbsql_field_flags' => 'FUNCTION',
+        'fbsql_field_len' => 'FUNCTION',
+        'fbsql_field_name' => 'FUNCTION',
+        'fbsql_field_seek' => 'FUNCTION',
+        'fbsql_field_table' => 'FUNCTION',
+        'fbsql_field_type' => 'FUNCTION',
+        'fbsql_free_result' => 'FUNCTION',
+        'fbsql_get_autostart_info' => 'FUNCTION',
+        'fbsql_hostname' => 'FUNCTION',
+        'fbsql_insert_id' => 'FUNCTION',
+        'fbsql_list_dbs' => 'FUNCTION',
+        'fbsql_list_fields' => 'FUNCTION',
+        'fbsql_list_tables' => 'FUNCTION',
+        'fbsql_next_result' => 'FUNCTION',
+        'fbsql_num_fields' => 'FUNCTION',
+        'fbsql_num_rows' => 'FUNCTION',
+        'fbsql_password' => 'FUNCTION',
+        'fbsql_pconnect' => 'FUNCTION',
+        'fbsql_query' => 'FUNCTION',
+        'fbsql_read_blob' => 'FUNCTION',
+        'fbsql_read_clob' => 'FUNCTION',
+        'fbsql_result' => 'FUNCTION',
+        'fbsql_rollback' => 'FUNCTION',
+        'fbsql_rows_fetched' => 'FUNCTION',
+        'fbsql_select_db' => 'FUNCTION',
+        'fbsql_set_characterset' => 'FUNCTION',
+        'fbsql_set_lob_mode' => 'FUNCTION',
+        'fbsql_set_password' => 'FUNCTION',
+        'fbsql_set_transaction' => 'FUNCTION',
+        'fbsql_start_db' => 'FUNCTION',
+        'fbsql_stop_db' => 'FUNCTION',
+        'fbsql_table_name' => 'FUNCTION',
+        'fbsql_tablename' => 'FUNCTION',
+        'fbsql_username' => 'FUNCTION',
+        'fbsql_warnings' => 'FUNCTION',
+        'fclose' => 'FUNCTION',
+        'fdf_add_doc_javascript' => 'FUNCTION',
+        'fdf_add_template' => 'FUNCTION',
+        'fdf_close' => 'FUNCTION',
+        'fdf_create' => 'FUNCTION',
+        'fdf_enum_values' => 'FUNCTION',
+        'fdf_errno' => 'FUNCTION',
+        'fdf_error' => 'FUNCTION',
+        'fdf_get_ap' => 'FUNCTION',
+        'fdf_get_attachment' => 'FUNCTION',
+        'fdf_get_encoding' => 'FUNCTION',
+        'fdf_get_file' => 'FUNCTION',
+        'fdf_get_flags' => 'FUNCTION',
+        'fdf_get_opt' => 'FUNCTION',
+        'fdf_get_status' => 'FUNCTION',
+        'fdf_get_value' => 'FUNCTION',
+        'fdf_get_version' => 'FUNCTION',
+        'fdf_header' => 'FUNCTION',
+        'fdf_next_field_name' => 'FUNCTION',
+        'fdf_open' => 'FUNCTION',
+        'fdf_open_string' => 'FUNCTION',
+        'fdf_remove_item' => 'FUNCTION',
+        'fdf_save' => 'FUNCTION',
+        'fdf_save_string' => 'FUNCTION',
+        'fdf_set_ap' => 'FUNCTION',
+        'fdf_set_encoding' => 'FUNCTION',
+        'fdf_set_file' => 'FUNCTION',
+        'fdf_set_flags' => 'FUNCTION',
+        'fdf_set_javascript_action' => 'FUNCTION',
+        'fdf_set_on_import_javascript' => 'FUNCTION',
+        'fdf_set_opt' => 'FUNCTION',
+        'fdf_set_status' => 'FUNCTION',
+        'fdf_set_submit_form_action' => 'FUNCTION',
+        'fdf_set_target_frame' => 'FUNCTION',
+        'fdf_set_value' => 'FUNCTION',
+        'fdf_set_version' => 'FUNCTION',
+        'feof' => 'FUNCTION',
+        'fflush' => 'FUNCTION',
+        'fgetc' => 'FUNCTION',
+        'fgetcsv' => 'FUNCTION',
+        'fgets' => 'FUNCTION',
+        'fgetss' => 'FUNCTION',
+        'file' => 'FUNCTION',
+        'file_exists' => 'FUNCTION',
+        'file_get_contents' => 'FUNCTION',
+        'file_put_contents' => 'FUNCTION',
+        'fileatime' => 'FUNCTION',
+        'filectime' => 'FUNCTION',
+        'filegroup' => 'FUNCTION',
+        'fileinode' => 'FUNCTION',
+        'filemtime' => 'FUNCTION',
+        'fileowner' => 'FUNCTION',
+        'fileperms' => 'FUNCTION',
+        'filepro' => 'FUNCTION',
+        'filepro_fieldcount' => 'FUNCTION',
+        'filepro_fieldname' => 'FUNCTION',
+        'filepro_fieldtype' => 'FUNCTION',
+        'filepro_fieldwidth' => 'FUNCTION',
+        'filepro_retrieve' => 'FUNCTION',
+        'filepro_rowcount' => 'FUNCTION',
+        'filesize' => 'FUNCTION',
+        'filesystemiterator' => 'FUNCTION',
+        'filetype' => 'FUNCTION',
+        'filter_has_var' => 'FUNCTION',
+        'filter_id' => 'FUNCTION',
+        'filter_input' => 'FUNCTION',
+        'filter_input_array' => 'FUNCTION',
+        'filter_list' => 'FUNCTION',
+        'filter_var' => 'FUNCTION',
+        'filter_var_array' => 'FUNCTION',
+        'filteriterator' => 'FUNCTION',
+        'finfo_buffer' => 'FUNCTION',
+        'finfo_close' => 'FUNCTION',
+        'finfo_file' => 'FUNCTION',
+        'finfo_open' => 'FUNCTION',
+        'finfo_set_flags' => 'FUNCTION',
+        'floatval' => 'FUNCTION',
+        'flock' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'flush' => 'FUNCTION',
+        'fmod' => 'FUNCTION',
+        'fnmatch' => 'FUNCTION',
+        'fopen' => 'FUNCTION',
+        'forward_static_call' => 'FUNCTION',
+        'forward_static_call_array' => 'FUNCTION',
+        'fpassthru' => 'FUNCTION',
+        'fprintf' => 'FUNCTION',
+        'fputcsv' => 'FUNCTION',
+        'fputs' => 'FUNCTION',
+        'fread' => 'FUNCTION',
+        'frenchtojd' => 'FUNCTION',
+        'fribidi_log2vis' => 'FUNCTION',
+        'fscanf' => 'FUNCTION',
+        'fseek' => 'FUNCTION',
+        'fsockopen' => 'FUNCTION',
+        'fstat' => 'FUNCTION',
+        'ftell' => 'FUNCTION',
+        'ftok' => 'FUNCTION',
+        'ftp_alloc' => 'FUNCTION',
+        'ftp_cdup' => 'FUNCTION',
+        'ftp_chdir' => 'FUNCTION',
+        'ftp_chmod' => 'FUNCTION',
+        'ftp_close' => 'FUNCTION',
+        'ftp_connect' => 'FUNCTION',
+        'ftp_delete' => 'FUNCTION',
+        'ftp_exec' => 'FUNCTION',
+        'ftp_fget' => 'FUNCTION',
+        'ftp_fput' => 'FUNCTION',
+        'ftp_get' => 'FUNCTION',
+        'ftp_get_option' => 'FUNCTION',
+        'ftp_login' => 'FUNCTION',
+        'ftp_mdtm' => 'FUNCTION',
+        'ftp_mkdir' => 'FUNCTION',
+        'ftp_nb_continue' => 'FUNCTION',
+        'ftp_nb_fget' => 'FUNCTION',
+        'ftp_nb_fput' => 'FUNCTION',
+        'ftp_nb_get' => 'FUNCTION',
+        'ftp_nb_put' => 'FUNCTION',
+        'ftp_nlist' => 'FUNCTION',
+        'ftp_pasv' => 'FUNCTION',
+        'ftp_put' => 'FUNCTION',
+        'ftp_pwd' => 'FUNCTION',
+        'ftp_quit' => 'FUNCTION',
+        'ftp_raw' => 'FUNCTION',
+        'ftp_rawlist' => 'FUNCTION',
+        'ftp_rename' => 'FUNCTION',
+        'ftp_rmdir' => 'FUNCTION',
+        'ftp_set_option' => 'FUNCTION',
+        'ftp_site' => 'FUNCTION',
+        'ftp_size' => 'FUNCTION',
+        'ftp_ssl_connect' => 'FUNCTION',
+        'ftp_systype' => 'FUNCTION',
+        'ftruncate' => 'FUNCTION',
+        'func_get_arg' => 'FUNCTION',
+        'func_get_args' => 'FUNCTION',
+        'func_num_args' => 'FUNCTION',
+        'function_exists' => 'FUNCTION',
+        'fwrite' => 'FUNCTION',
+        'gc_collect_cycles' => 'FUNCTION',
+        'gc_disable' => 'FUNCTION',
+        'gc_enable' => 'FUNCTION',
+        'gc_enabled' => 'FUNCTION',
+        'gd_info' => 'FUNCTION',
+        'gearmanclient' => 'FUNCTION',
+        'gearmanjob' => 'FUNCTION',
+        'gearmantask' => 'FUNCTION',
+        'gearmanworker' => 'FUNCTION',
+        'geoip_continent_code_by_name' => 'FUNCTION',
+        'geoip_country_code3_by_name' => 'FUNCTION',
+        'geoip_country_code_by_name' => 'FUNCTION',
+        'geoip_country_name_by_name' => 'FUNCTION',
+        'geoip_database_info' => 'FUNCTION',
+        'geoip_db_avail' => 'FUNCTION',
+        'geoip_db_filename' => 'FUNCTION',
+        'geoip_db_get_all_info' => 'FUNCTION',
+        'geoip_id_by_name' => 'FUNCTION',
+        'geoip_isp_by_name' => 'FUNCTION',
+        'geoip_org_by_name' => 'FUNCTION',
+        'geoip_record_by_name' => 'FUNCTION',
+        'geoip_region_by_name' => 'FUNCTION',
+        'geoip_region_name_by_code' => 'FUNCTION',
+        'geoip_time_zone_by_country_and_region' => 'FUNCTION',
+        'getmeta' => 'FUNCTION',
+        'getnamed' => 'FUNCTION',
+        'getvalue' => 'FUNCTION',
+        'get_browser' => 'FUNCTION',
+        'get_called_class' => 'FUNCTION',
+        'get_cfg_var' => 'FUNCTION',
+        'get_class' => 'FUNCTION',
+        'get_class_methods' => 'FUNCTION',
+        'get_class_vars' => 'FUNCTION',
+        'get_current_user' => 'FUNCTION',
+        'get_declared_classes' => 'FUNCTION',
+        'get_declared_interfaces' => 'FUNCTION',
+        'get_defined_constants' => 'FUNCTION',
+        'get_defined_functions' => 'FUNCTION',
+        'get_defined_vars' => 'FUNCTION',
+        'get_extension_funcs' => 'FUNCTION',
+        'get_headers' => 'FUNCTION',
+        'get_html_translation_table' => 'FUNCTION',
+        'get_include_path' => 'FUNCTION',
+        'get_included_files' => 'FUNCTION',
+        'get_loaded_extensions' => 'FUNCTION',
+        'get_magic_quotes_gpc' => 'FUNCTION',
+        'get_magic_quotes_runtime' => 'FUNCTION',
+        'get_meta_tags' => 'FUNCTION',
+        'get_object_vars' => 'FUNCTION',
+        'get_parent_class' => 'FUNCTION',
+        'get_required_files' => 'FUNCTION',
+        'get_resource_type' => 'FUNCTION',
+        'getallheaders' => 'FUNCTION',
+        'getconstant' => 'FUNCTION',
+        'getconstants' => 'FUNCTION',
+        'getconstructor' => 'FUNCTION',
+        'getcwd' => 'FUNCTION',
+        'getdate' => 'FUNCTION',
+        'getdefaultproperties' => 'FUNCTION',
+        'getdoccomment' => 'FUNCTION',
+        'getendline' => 'FUNCTION',
+        'getenv' => 'FUNCTION',
+        'getextension' => 'FUNCTION',
+        'getextensionname' => 'FUNCTION',
+        'getfilename' => 'FUNCTION',
+        'gethostbyaddr' => 'FUNCTION',
+        'gethostbyname' => 'FUNCTION',
+        'gethostbynamel' => 'FUNCTION',
+        'gethostname' => 'FUNCTION',
+        'getimagesize' => 'FUNCTION',
+        'getinterfacenames' => 'FUNCTION',
+        'getinterfaces' => 'FUNCTION',
+        'getlastmod' => 'FUNCTION',
+        'getmethod' => 'FUNCTION',
+        'getmethods' => 'FUNCTION',
+        'getmodifiers' => 'FUNCTION',
+        'getmxrr' => 'FUNCTION',
+        'getmygid' => 'FUNCTION',
+        'getmyinode' => 'FUNCTION',
+        'getmypid' => 'FUNCTION',
+        'getmyuid' => 'FUNCTION',
+        'getname' => 'FUNCTION',
+        'getnamespacename' => 'FUNCTION',
+        'getopt' => 'FUNCTION',
+        'getparentclass' => 'FUNCTION',
+        'getproperties' => 'FUNCTION',
+        'getproperty' => 'FUNCTION',
+        'getprotobyname' => 'FUNCTION',
+        'getprotobynumber' => 'FUNCTION',
+        'getrandmax' => 'FUNCTION',
+        'getrusage' => 'FUNCTION',
+        'getservbyname' => 'FUNCTION',
+        'getservbyport' => 'FUNCTION',
+        'getshortname' => 'FUNCTION',
+        'getstartline' => 'FUNCTION',
+        'getstaticproperties' => 'FUNCTION',
+        'getstaticpropertyvalue' => 'FUNCTION',
+        'gettext' => 'FUNCTION',
+        'gettimeofday' => 'FUNCTION',
+        'gettype' => 'FUNCTION',
+        'glob' => 'FUNCTION',
+        'globiterator' => 'FUNCTION',
+        'gmagick' => 'FUNCTION',
+        'gmagickdraw' => 'FUNCTION',
+        'gmagickpixel' => 'FUNCTION',
+        'gmdate' => 'FUNCTION',
+        'gmmktime' => 'FUNCTION',
+        'gmp_abs' => 'FUNCTION',
+        'gmp_add' => 'FUNCTION',
+        'gmp_and' => 'FUNCTION',
+        'gmp_clrbit' => 'FUNCTION',
+        'gmp_cmp' => 'FUNCTION',
+        'gmp_com' => 'FUNCTION',
+        'gmp_div' => 'FUNCTION',
+        'gmp_div_q' => 'FUNCTION',
+        'gmp_div_qr' => 'FUNCTION',
+        'gmp_div_r' => 'FUNCTION',
+        'gmp_divexact' => 'FUNCTION',
+        'gmp_fact' => 'FUNCTION',
+        'gmp_gcd' => 'FUNCTION',
+        'gmp_gcdext' => 'FUNCTION',
+        'gmp_hamdist' => 'FUNCTION',
+        'gmp_init' => 'FUNCTION',
+        'gmp_intval' => 'FUNCTION',
+        'gmp_invert' => 'FUNCTION',
+        'gmp_jacobi' => 'FUNCTION',
+        'gmp_legendre' => 'FUNCTION',
+        'gmp_mod' => 'FUNCTION',
+        'gmp_mul' => 'FUNCTION',
+        'gmp_neg' => 'FUNCTION',
+        'gmp_nextprime' => 'FUNCTION',
+        'gmp_or' => 'FUNCTION',
+        'gmp_perfect_square' => 'FUNCTION',
+        'gmp_popcount' => 'FUNCTION',
+        'gmp_pow' => 'FUNCTION',
+        'gmp_powm' => 'FUNCTION',
+        'gmp_prob_prime' => 'FUNCTION',
+        'gmp_random' => 'FUNCTION',
+        'gmp_scan0' => 'FUNCTION',
+        'gmp_scan1' => 'FUNCTION',
+        'gmp_setbit' => 'FUNCTION',
+        'gmp_sign' => 'FUNCTION',
+        'gmp_sqrt' => 'FUNCTION',
+        'gmp_sqrtrem' => 'FUNCTION',
+        'gmp_strval' => 'FUNCTION',
+        'gmp_sub' => 'FUNCTION',
+        'gmp_testbit' => 'FUNCTION',
+        'gmp_xor' => 'FUNCTION',
+        'gmstrftime' => 'FUNCTION',
+        'gnupg_adddecryptkey' => 'FUNCTION',
+        'gnupg_addencryptkey' => 'FUNCTION',
+        'gnupg_addsignkey' => 'FUNCTION',
+        'gnupg_cleardecryptkeys' => 'FUNCTION',
+        'gnupg_clearencryptkeys' => 'FUNCTION',
+        'gnupg_clearsignkeys' => 'FUNCTION',
+        'gnupg_decrypt' => 'FUNCTION',
+        'gnupg_decryptverify' => 'FUNCTION',
+        'gnupg_encrypt' => 'FUNCTION',
+        'gnupg_encryptsign' => 'FUNCTION',
+        'gnupg_export' => 'FUNCTION',
+        'gnupg_geterror' => 'FUNCTION',
+        'gnupg_getprotocol' => 'FUNCTION',
+        'gnupg_import' => 'FUNCTION',
+        'gnupg_init' => 'FUNCTION',
+        'gnupg_keyinfo' => 'FUNCTION',
+        'gnupg_setarmor' => 'FUNCTION',
+        'gnupg_seterrormode' => 'FUNCTION',
+        'gnupg_setsignmode' => 'FUNCTION',
+        'gnupg_sign' => 'FUNCTION',
+        'gnupg_verify' => 'FUNCTION',
+        'gopher_parsedir' => 'FUNCTION',
+        'grapheme_extract' => 'FUNCTION',
+        'grapheme_stripos' => 'FUNCTION',
+        'grapheme_stristr' => 'FUNCTION',
+        'grapheme_strlen' => 'FUNCTION',
+        'grapheme_strpos' => 'FUNCTION',
+        'grapheme_strripos' => 'FUNCTION',
+        'grapheme_strrpos' => 'FUNCTION',
+        'grapheme_strstr' => 'FUNCTION',
+        'grapheme_substr' => 'FUNCTION',
+        'gregoriantojd' => 'FUNCTION',
+        'gupnp_context_get_host_ip' => 'FUNCTION',
+        'gupnp_context_get_port' => 'FUNCTION',
+        'gupnp_context_get_subscription_timeout' => 'FUNCTION',
+        'gupnp_context_host_path' => 'FUNCTION',
+        'gupnp_context_new' => 'FUNCTION',
+        'gupnp_context_set_subscription_timeout' => 'FUNCTION',
+        'gupnp_context_timeout_add' => 'FUNCTION',
+        'gupnp_context_unhost_path' => 'FUNCTION',
+        'gupnp_control_point_browse_start' => 'FUNCTION',
+        'gupnp_control_point_browse_stop' => 'FUNCTION',
+        'gupnp_control_point_callback_set' => 'FUNCTION',
+        'gupnp_control_point_new' => 'FUNCTION',
+        'gupnp_device_action_callback_set' => 'FUNCTION',
+        'gupnp_device_info_get' => 'FUNCTION',
+        'gupnp_device_info_get_service' => 'FUNCTION',
+        'gupnp_root_device_get_available' => 'FUNCTION',
+        'gupnp_root_device_get_relative_location' => 'FUNCTION',
+        'gupnp_root_device_new' => 'FUNCTION',
+        'gupnp_root_device_set_available' => 'FUNCTION',
+        'gupnp_root_device_start' => 'FUNCTION',
+        'gupnp_root_device_stop' => 'FUNCTION',
+        'gupnp_service_action_get' => 'FUNCTION',
+        'gupnp_service_action_return' => 'FUNCTION',
+        'gupnp_service_action_return_error' => 'FUNCTION',
+        'gupnp_service_action_set' => 'FUNCTION',
+        'gupnp_service_freeze_notify' => 'FUNCTION',
+        'gupnp_service_info_get' => 'FUNCTION',
+        'gupnp_service_info_get_introspection' => 'FUNCTION',
+        'gupnp_service_introspection_get_state_variable' => 'FUNCTION',
+        'gupnp_service_notify' => 'FUNCTION',
+        'gupnp_service_proxy_action_get' => 'FUNCTION',
+        'gupnp_service_proxy_action_set' => 'FUNCTION',
+        'gupnp_service_proxy_add_notify' => 'FUNCTION',
+        'gupnp_service_proxy_callback_set' => 'FUNCTION',
+        'gupnp_service_proxy_get_subscribed' => 'FUNCTION',
+        'gupnp_service_proxy_remove_notify' => 'FUNCTION',
+        'gupnp_service_proxy_set_subscribed' => 'FUNCTION',
+        'gupnp_service_thaw_notify' => 'FUNCTION',
+        'gzclose' => 'FUNCTION',
+        'gzcompress' => 'FUNCTION',
+        'gzdecode' => 'FUNCTION',
+        'gzdeflate' => 'FUNCTION',
+        'gzencode' => 'FUNCTION',
+        'gzeof' => 'FUNCTION',
+        'gzfile' => 'FUNCTION',
+        'gzgetc' => 'FUNCTION',
+        'gzgets' => 'FUNCTION',
+        'gzgetss' => 'FUNCTION',
+        'gzinflate' => 'FUNCTION',
+        'gzopen' => 'FUNCTION',
+        'gzpassthru' => 'FUNCTION',
+        'gzputs' => 'FUNCTION',
+        'gzread' => 'FUNCTION',
+        'gzrewind' => 'FUNCTION',
+        'gzseek' => 'FUNCTION',
+        'gztell' => 'FUNCTION',
+        'gzuncompress' => 'FUNCTION',
+        'gzwrite' => 'FUNCTION',
+        'halt_compiler' => 'FUNCTION',
+        'haruannotation' => 'FUNCTION',
+        'haruannotation_setborderstyle' => 'FUNCTION',
+        'haruannotation_sethighlightmode' => 'FUNCTION',
+        'haruannotation_seticon' => 'FUNCTION',
+        'haruannotation_setopened' => 'FUNCTION',
+        'harudestination' => 'FUNCTION',
+        'harudestination_setfit' => 'FUNCTION',
+        'harudestination_setfitb' => 'FUNCTION',
+        'harudestination_setfitbh' => 'FUNCTION',
+        'harudestination_setfitbv' => 'FUNCTION',
+        'harudestination_setfith' => 'FUNCTION',
+        'harudestination_setfitr' => 'FUNCTION',
+        'harudestination_setfitv' => 'FUNCTION',
+        'harudestination_setxyz' => 'FUNCTION',
+        'harudoc' => 'FUNCTION',
+        'harudoc_addpage' => 'FUNCTION',
+        'harudoc_addpagelabel' => 'FUNCTION',
+        'harudoc_construct' => 'FUNCTION',
+        'harudoc_createoutline' => 'FUNCTION',
+        'harudoc_getcurrentencoder' => 'FUNCTION',
+        'harudoc_getcurrentpage' => 'FUNCTION',
+        'harudoc_getencoder' => 'FUNCTION',
+        'harudoc_getfont' => 'FUNCTION',
+        'harudoc_getinfoattr' => 'FUNCTION',
+        'harudoc_getpagelayout' => 'FUNCTION',
+        'harudoc_getpagemode' => 'FUNCTION',
+        'harudoc_getstreamsize' => 'FUNCTION',
+        'harudoc_insertpage' => 'FUNCTION',
+        'harudoc_loadjpeg' => 'FUNCTION',
+        'harudoc_loadpng' => 'FUNCTION',
+        'harudoc_loadraw' => 'FUNCTION',
+        'harudoc_loadttc' => 'FUNCTION',
+        'harudoc_loadttf' => 'FUNCTION',
+        'harudoc_loadtype1' => 'FUNCTION',
+        'harudoc_output' => 'FUNCTION',
+        'harudoc_readfromstream' => 'FUNCTION',
+        'harudoc_reseterror' => 'FUNCTION',
+        'harudoc_resetstream' => 'FUNCTION',
+        'harudoc_save' => 'FUNCTION',
+        'harudoc_savetostream' => 'FUNCTION',
+        'harudoc_setcompressionmode' => 'FUNCTION',
+        'harudoc_setcurrentencoder' => 'FUNCTION',
+        'harudoc_setencryptionmode' => 'FUNCTION',
+        'harudoc_setinfoattr' => 'FUNCTION',
+        'harudoc_setinfodateattr' => 'FUNCTION',
+        'harudoc_setopenaction' => 'FUNCTION',
+        'harudoc_setpagelayout' => 'FUNCTION',
+        'harudoc_setpagemode' => 'FUNCTION',
+        'harudoc_setpagesconfiguration' => 'FUNCTION',
+        'harudoc_setpassword' => 'FUNCTION',
+        'harudoc_setpermission' => 'FUNCTION',
+        'harudoc_usecnsencodings' => 'FUNCTION',
+        'harudoc_usecnsfonts' => 'FUNCTION',
+        'harudoc_usecntencodings' => 'FUNCTION',
+        'harudoc_usecntfonts' => 'FUNCTION',
+        'harudoc_usejpencodings' => 'FUNCTION',
+        'harudoc_usejpfonts' => 'FUNCTION',
+        'harudoc_usekrencodings' => 'FUNCTION',
+        'harudoc_usekrfonts' => 'FUNCTION',
+        'haruencoder' => 'FUNCTION',
+        'haruencoder_getbytetype' => 'FUNCTION',
+        'haruencoder_gettype' => 'FUNCTION',
+        'haruencoder_getunicode' => 'FUNCTION',
+        'haruencoder_getwritingmode' => 'FUNCTION',
+        'haruexception' => 'FUNCTION',
+        'harufont' => 'FUNCTION',
+        'harufont_getascent' => 'FUNCTION',
+        'harufont_getcapheight' => 'FUNCTION',
+        'harufont_getdescent' => 'FUNCTION',
+        'harufont_getencodingname' => 'FUNCTION',
+        'harufont_getfontname' => 'FUNCTION',
+        'harufont_gettextwidth' => 'FUNCTION',
+        'harufont_getunicodewidth' => 'FUNCTION',
+        'harufont_getxheight' => 'FUNCTION',
+        'harufont_measuretext' => 'FUNCTION',
+        'haruimage' => 'FUNCTION',
+        'haruimage_getbitspercomponent' => 'FUNCTION',
+        'haruimage_getcolorspace' => 'FUNCTION',
+        'haruimage_getheight' => 'FUNCTION',
+        'haruimage_getsize' => 'FUNCTION',
+        'haruimage_getwidth' => 'FUNCTION',
+        'haruimage_setcolormask' => 'FUNCTION',
+        'haruimage_setmaskimage' => 'FUNCTION',
+        'haruoutline' => 'FUNCTION',
+        'haruoutline_setdestination' => 'FUNCTION',
+        'haruoutline_setopened' => 'FUNCTION',
+        'harupage' => 'FUNCTION',
+        'harupage_arc' => 'FUNCTION',
+        'harupage_begintext' => 'FUNCTION',
+        'harupage_circle' => 'FUNCTION',
+        'harupage_closepath' => 'FUNCTION',
+        'harupage_concat' => 'FUNCTION',
+        'harupage_createdestination' => 'FUNCTION',
+        'harupage_createlinkannotation' => 'FUNCTION',
+        'harupage_createtextannotation' => 'FUNCTION',
+        'harupage_createurlannotation' => 'FUNCTION',
+        'harupage_curveto' => 'FUNCTION',
+        'harupage_curveto2' => 'FUNCTION',
+        'harupage_curveto3' => 'FUNCTION',
+        'harupage_drawimage' => 'FUNCTION',
+        'harupage_ellipse' => 'FUNCTION',
+        'harupage_endpath' => 'FUNCTION',
+        'harupage_endtext' => 'FUNCTION',
+        'harupage_eofill' => 'FUNCTION',
+        'harupage_eofillstroke' => 'FUNCTION',
+        'harupage_fill' => 'FUNCTION',
+        'harupage_fillstroke' => 'FUNCTION',
+        'harupage_getcharspace' => 'FUNCTION',
+        'harupage_getcmykfill' => 'FUNCTION',
+        'harupage_getcmykstroke' => 'FUNCTION',
+        'harupage_getcurrentfont' => 'FUNCTION',
+        'harupage_getcurrentfontsize' => 'FUNCTION',
+        'harupage_getcurrentpos' => 'FUNCTION',
+        'harupage_getcurrenttextpos' => 'FUNCTION',
+        'harupage_getdash' => 'FUNCTION',
+        'harupage_getfillingcolorspace' => 'FUNCTION',
+        'harupage_getflatness' => 'FUNCTION',
+        'harupage_getgmode' => 'FUNCTION',
+        'harupage_getgrayfill' => 'FUNCTION',
+        'harupage_getgraystroke' => 'FUNCTION',
+        'harupage_getheight' => 'FUNCTION',
+        'harupage_gethorizontalscaling' => 'FUNCTION',
+        'harupage_getlinecap' => 'FUNCTION',
+        'harupage_getlinejoin' => 'FUNCTION',
+        'harupage_getlinewidth' => 'FUNCTION',
+        'harupage_getmiterlimit' => 'FUNCTION',
+        'harupage_getrgbfill' => 'FUNCTION',
+        'harupage_getrgbstroke' => 'FUNCTION',
+        'harupage_getstrokingcolorspace' => 'FUNCTION',
+        'harupage_gettextleading' => 'FUNCTION',
+        'harupage_gettextmatrix' => 'FUNCTION',
+        'harupage_gettextrenderingmode' => 'FUNCTION',
+        'harupage_gettextrise' => 'FUNCTION',
+        'harupage_gettextwidth' => 'FUNCTION',
+        'harupage_gettransmatrix' => 'FUNCTION',
+        'harupage_getwidth' => 'FUNCTION',
+        'harupage_getwordspace' => 'FUNCTION',
+        'harupage_lineto' => 'FUNCTION',
+        'harupage_measuretext' => 'FUNCTION',
+        'harupage_movetextpos' => 'FUNCTION',
+        'harupage_moveto' => 'FUNCTION',
+        'harupage_movetonextline' => 'FUNCTION',
+        'harupage_rectangle' => 'FUNCTION',
+        'harupage_setcharspace' => 'FUNCTION',
+        'harupage_setcmykfill' => 'FUNCTION',
+        'harupage_setcmykstroke' => 'FUNCTION',
+        'harupage_setdash' => 'FUNCTION',
+        'harupage_setflatness' => 'FUNCTION',
+        'harupage_setfontandsize' => 'FUNCTION',
+        'harupage_setgrayfill' => 'FUNCTION',
+        'harupage_setgraystroke' => 'FUNCTION',
+        'harupage_setheight' => 'FUNCTION',
+        'harupage_sethorizontalscaling' => 'FUNCTION',
+        'harupage_setlinecap' => 'FUNCTION',
+        'harupage_setlinejoin' => 'FUNCTION',
+        'harupage_setlinewidth' => 'FUNCTION',
+        'harupage_setmiterlimit' => 'FUNCTION',
+        'harupage_setrgbfill' => 'FUNCTION',
+        'harupage_setrgbstroke' => 'FUNCTION',
+        'harupage_setrotate' => 'FUNCTION',
+        'harupage_setsize' => 'FUNCTION',
+        'harupage_setslideshow' => 'FUNCTION',
+        'harupage_settextleading' => 'FUNCTION',
+        'harupage_settextmatrix' => 'FUNCTION',
+        'harupage_settextrenderingmode' => 'FUNCTION',
+        'harupage_settextrise' => 'FUNCTION',
+        'harupage_setwidth' => 'FUNCTION',
+        'harupage_setwordspace' => 'FUNCTION',
+        'harupage_showtext' => 'FUNCTION',
+        'harupage_showtextnextline' => 'FUNCTION',
+        'harupage_stroke' => 'FUNCTION',
+        'harupage_textout' => 'FUNCTION',
+        'harupage_textrect' => 'FUNCTION',
+        'hasconstant' => 'FUNCTION',
+        'hash' => 'FUNCTION',
+        'hash_algos' => 'FUNCTION',
+        'hash_copy' => 'FUNCTION',
+        'hash_file' => 'FUNCTION',
+        'hash_final' => 'FUNCTION',
+        'hash_hmac' => 'FUNCTION',
+        'hash_hmac_file' => 'FUNCTION',
+        'hash_init' => 'FUNCTION',
+        'hash_update' => 'FUNCTION',
+        'hash_update_file' => 'FUNCTION',
+        'hash_update_stream' => 'FUNCTION',
+        'hasmethod' => 'FUNCTION',
+        'hasproperty' => 'FUNCTION',
+        'header' => 'FUNCTION',
+        'header_remove' => 'FUNCTION',
+        'headers_list' => 'FUNCTION',
+        'headers_sent' => 'FUNCTION',
+        'hebrev' => 'FUNCTION',
+        'hebrevc' => 'FUNCTION',
+        'hexdec' => 'FUNCTION',
+        'highlight_file' => 'FUNCTION',
+        'highlight_string' => 'FUNCTION',
+        'html_entity_decode' => 'FUNCTION',
+        'htmlentities' => 'FUNCTION',
+        'htmlspecialchars' => 'FUNCTION',
+        'htmlspecialchars_decode' => 'FUNCTION',
+        'http_build_cookie' => 'FUNCTION',
+        'http_build_query' => 'FUNCTION',
+        'http_build_str' => 'FUNCTION',
+        'http_build_url' => 'FUNCTION',
+        'http_cache_etag' => 'FUNCTION',
+        'http_cache_last_modified' => 'FUNCTION',
+        'http_chunked_decode' => 'FUNCTION',
+        'http_date' => 'FUNCTION',
+        'http_deflate' => 'FUNCTION',
+        'http_get' => 'FUNCTION',
+        'http_get_request_body' => 'FUNCTION',
+        'http_get_request_body_stream' => 'FUNCTION',
+        'http_get_request_headers' => 'FUNCTION',
+        'http_head' => 'FUNCTION',
+        'http_inflate' => 'FUNCTION',
+        'http_match_etag' => 'FUNCTION',
+        'http_match_modified' => 'FUNCTION',
+        'http_match_request_header' => 'FUNCTION',
+        'http_negotiate_charset' => 'FUNCTION',
+        'http_negotiate_content_type' => 'FUNCTION',
+        'http_negotiate_language' => 'FUNCTION',
+        'http_parse_cookie' => 'FUNCTION',
+        'http_parse_headers' => 'FUNCTION',
+        'http_parse_message' => 'FUNCTION',
+        'http_parse_params' => 'FUNCTION',
+        'http_persistent_handles_clean' => 'FUNCTION',
+        'http_persistent_handles_count' => 'FUNCTION',
+        'http_persistent_handles_ident' => 'FUNCTION',
+        'http_post_data' => 'FUNCTION',
+        'http_post_fields' => 'FUNCTION',
+        'http_put_data' => 'FUNCTION',
+        'http_put_file' => 'FUNCTION',
+        'http_put_stream' => 'FUNCTION',
+        'http_redirect' => 'FUNCTION',
+        'http_request' => 'FUNCTION',
+        'http_request_body_encode' => 'FUNCTION',
+        'http_request_method_exists' => 'FUNCTION',
+        'http_request_method_name' => 'FUNCTION',
+        'http_request_method_register' => 'FUNCTION',
+        'http_request_method_unregister' => 'FUNCTION',
+        'http_send_content_disposition' => 'FUNCTION',
+        'http_send_content_type' => 'FUNCTION',
+        'http_send_data' => 'FUNCTION',
+        'http_send_file' => 'FUNCTION',
+        'http_send_last_modified' => 'FUNCTION',
+        'http_send_status' => 'FUNCTION',
+        'http_send_stream' => 'FUNCTION',
+        'http_support' => 'FUNCTION',
+        'http_throttle' => 'FUNCTION',
+        'httpdeflatestream' => 'FUNCTION',
+        'httpdeflatestream_construct' => 'FUNCTION',
+        'httpdeflatestream_factory' => 'FUNCTION',
+        'httpdeflatestream_finish' => 'FUNCTION',
+        'httpdeflatestream_flush' => 'FUNCTION',
+        'httpdeflatestream_update' => 'FUNCTION',
+        'httpinflatestream' => 'FUNCTION',
+        'httpinflatestream_construct' => 'FUNCTION',
+        'httpinflatestream_factory' => 'FUNCTION',
+        'httpinflatestream_finish' => 'FUNCTION',
+        'httpinflatestream_flush' => 'FUNCTION',
+        'httpinflatestream_update' => 'FUNCTION',
+        'httpmessage' => 'FUNCTION',
+        'httpmessage_addheaders' => 'FUNCTION',
+        'httpmessage_construct' => 'FUNCTION',
+        'httpmessage_detach' => 'FUNCTION',
+        'httpmessage_factory' => 'FUNCTION',
+        'httpmessage_fromenv' => 'FUNCTION',
+        'httpmessage_fromstring' => 'FUNCTION',
+        'httpmessage_getbody' => 'FUNCTION',
+        'httpmessage_getheader' => 'FUNCTION',
+        'httpmessage_getheaders' => 'FUNCTION',
+        'httpmessage_gethttpversion' => 'FUNCTION',
+        'httpmessage_getparentmessage' => 'FUNCTION',
+        'httpmessage_getrequestmethod' => 'FUNCTION',
+        'httpmessage_getrequesturl' => 'FUNCTION',
+        'httpmessage_getresponsecode' => 'FUNCTION',
+        'httpmessage_getresponsestatus' => 'FUNCTION',
+        'httpmessage_gettype' => 'FUNCTION',
+        'httpmessage_guesscontenttype' => 'FUNCTION',
+        'httpmessage_prepend' => 'FUNCTION',
+        'httpmessage_reverse' => 'FUNCTION',
+        'httpmessage_send' => 'FUNCTION',
+        'httpmessage_setbody' => 'FUNCTION',
+        'httpmessage_setheaders' => 'FUNCTION',
+        'httpmessage_sethttpversion' => 'FUNCTION',
+        'httpmessage_setrequestmethod' => 'FUNCTION',
+        'httpmessage_setrequesturl' => 'FUNCTION',
+        'httpmessage_setresponsecode' => 'FUNCTION',
+        'httpmessage_setresponsestatus' => 'FUNCTION',
+        'httpmessage_settype' => 'FUNCTION',
+        'httpmessage_tomessagetypeobject' => 'FUNCTION',
+        'httpmessage_tostring' => 'FUNCTION',
+        'httpquerystring' => 'FUNCTION',
+        'httpquerystring_construct' => 'FUNCTION',
+        'httpquerystring_get' => 'FUNCTION',
+        'httpquerystring_mod' => 'FUNCTION',
+        'httpquerystring_set' => 'FUNCTION',
+        'httpquerystring_singleton' => 'FUNCTION',
+        'httpquerystring_toarray' => 'FUNCTION',
+        'httpquerystring_tostring' => 'FUNCTION',
+        'httpquerystring_xlate' => 'FUNCTION',
+        'httprequest' => 'FUNCTION',
+        'httprequest_addcookies' => 'FUNCTION',
+        'httprequest_addheaders' => 'FUNCTION',
+        'httprequest_addpostfields' => 'FUNCTION',
+        'httprequest_addpostfile' => 'FUNCTION',
+        'httprequest_addputdata' => 'FUNCTION',
+        'httprequest_addquerydata' => 'FUNCTION',
+        'httprequest_addrawpostdata' => 'FUNCTION',
+        'httprequest_addssloptions' => 'FUNCTION',
+        'httprequest_clearhistory' => 'FUNCTION',
+        'httprequest_construct' => 'FUNCTION',
+        'httprequest_enablecookies' => 'FUNCTION',
+        'httprequest_getcontenttype' => 'FUNCTION',
+        'httprequest_getcookies' => 'FUNCTION',
+        'httprequest_getheaders' => 'FUNCTION',
+        'httprequest_gethistory' => 'FUNCTION',
+        'httprequest_getmethod' => 'FUNCTION',
+        'httprequest_getoptions' => 'FUNCTION',
+        'httprequest_getpostfields' => 'FUNCTION',
+        'httprequest_getpostfiles' => 'FUNCTION',
+        'httprequest_getputdata' => 'FUNCTION',
+        'httprequest_getputfile' => 'FUNCTION',
+        'httprequest_getquerydata' => 'FUNCTION',
+        'httprequest_getrawpostdata' => 'FUNCTION',
+        'httprequest_getrawrequestmessage' => 'FUNCTION',
+        'httprequest_getrawresponsemessage' => 'FUNCTION',
+        'httprequest_getrequestmessage' => 'FUNCTION',
+        'httprequest_getresponsebody' => 'FUNCTION',
+        'httprequest_getresponsecode' => 'FUNCTION',
+        'httprequest_getresponsecookies' => 'FUNCTION',
+        'httprequest_getresponsedata' => 'FUNCTION',
+        'httprequest_getresponseheader' => 'FUNCTION',
+        'httprequest_getresponseinfo' => 'FUNCTION',
+        'httprequest_getresponsemessage' => 'FUNCTION',
+        'httprequest_getresponsestatus' => 'FUNCTION',
+        'httprequest_getssloptions' => 'FUNCTION',
+        'httprequest_geturl' => 'FUNCTION',
+        'httprequest_resetcookies' => 'FUNCTION',
+        'httprequest_send' => 'FUNCTION',
+        'httprequest_setcontenttype' => 'FUNCTION',
+        'httprequest_setcookies' => 'FUNCTION',
+        'httprequest_setheaders' => 'FUNCTION',
+        'httprequest_setmethod' => 'FUNCTION',
+        'httprequest_setoptions' => 'FUNCTION',
+        'httprequest_setpostfields' => 'FUNCTION',
+        'httprequest_setpostfiles' => 'FUNCTION',
+        'httprequest_setputdata' => 'FUNCTION',
+        'httprequest_setputfile' => 'FUNCTION',
+        'httprequest_setquerydata' => 'FUNCTION',
+        'httprequest_setrawpostdata' => 'FUNCTION',
+        'httprequest_setssloptions' => 'FUNCTION',
+        'httprequest_seturl' => 'FUNCTION',
+        'httprequestpool' => 'FUNCTION',
+        'httprequestpool_attach' => 'FUNCTION',
+        'httprequestpool_construct' => 'FUNCTION',
+        'httprequestpool_destruct' => 'FUNCTION',
+        'httprequestpool_detach' => 'FUNCTION',
+        'httprequestpool_getattachedrequests' => 'FUNCTION',
+        'httprequestpool_getfinishedrequests' => 'FUNCTION',
+        'httprequestpool_reset' => 'FUNCTION',
+        'httprequestpool_send' => 'FUNCTION',
+        'httprequestpool_socketperform' => 'FUNCTION',
+        'httprequestpool_socketselect' => 'FUNCTION',
+        'httpresponse' => 'FUNCTION',
+        'httpresponse_capture' => 'FUNCTION',
+        'httpresponse_getbuffersize' => 'FUNCTION',
+        'httpresponse_getcache' => 'FUNCTION',
+        'httpresponse_getcachecontrol' => 'FUNCTION',
+        'httpresponse_getcontentdisposition' => 'FUNCTION',
+        'httpresponse_getcontenttype' => 'FUNCTION',
+        'httpresponse_getdata' => 'FUNCTION',
+        'httpresponse_getetag' => 'FUNCTION',
+        'httpresponse_getfile' => 'FUNCTION',
+        'httpresponse_getgzip' => 'FUNCTION',
+        'httpresponse_getheader' => 'FUNCTION',
+        'httpresponse_getlastmodified' => 'FUNCTION',
+        'httpresponse_getrequestbody' => 'FUNCTION',
+        'httpresponse_getrequestbodystream' => 'FUNCTION',
+        'httpresponse_getrequestheaders' => 'FUNCTION',
+        'httpresponse_getstream' => 'FUNCTION',
+        'httpresponse_getthrottledelay' => 'FUNCTION',
+        'httpresponse_guesscontenttype' => 'FUNCTION',
+        'httpresponse_redirect' => 'FUNCTION',
+        'httpresponse_send' => 'FUNCTION',
+        'httpresponse_setbuffersize' => 'FUNCTION',
+        'httpresponse_setcache' => 'FUNCTION',
+        'httpresponse_setcachecontrol' => 'FUNCTION',
+        'httpresponse_setcontentdisposition' => 'FUNCTION',
+        'httpresponse_setcontenttype' => 'FUNCTION',
+        'httpresponse_setdata' => 'FUNCTION',
+        'httpresponse_setetag' => 'FUNCTION',
+        'httpresponse_setfile' => 'FUNCTION',
+        'httpresponse_setgzip' => 'FUNCTION',
+        'httpresponse_setheader' => 'FUNCTION',
+        'httpresponse_setlastmodified' => 'FUNCTION',
+        'httpresponse_setstream' => 'FUNCTION',
+        'httpresponse_setthrottledelay' => 'FUNCTION',
+        'httpresponse_status' => 'FUNCTION',
+        'hw_array2objrec' => 'FUNCTION',
+        'hw_changeobject' => 'FUNCTION',
+        'hw_children' => 'FUNCTION',
+        'hw_childrenobj' => 'FUNCTION',
+        'hw_close' => 'FUNCTION',
+        'hw_connect' => 'FUNCTION',
+        'hw_connection_info' => 'FUNCTION',
+        'hw_cp' => 'FUNCTION',
+        'hw_deleteobject' => 'FUNCTION',
+        'hw_docbyanchor' => 'FUNCTION',
+        'hw_docbyanchorobj' => 'FUNCTION',
+        'hw_document_attributes' => 'FUNCTION',
+        'hw_document_bodytag' => 'FUNCTION',
+        'hw_document_content' => 'FUNCTION',
+        'hw_document_setcontent' => 'FUNCTION',
+        'hw_document_size' => 'FUNCTION',
+        'hw_dummy' => 'FUNCTION',
+        'hw_edittext' => 'FUNCTION',
+        'hw_error' => 'FUNCTION',
+        'hw_errormsg' => 'FUNCTION',
+        'hw_free_document' => 'FUNCTION',
+        'hw_getanchors' => 'FUNCTION',
+        'hw_getanchorsobj' => 'FUNCTION',
+        'hw_getandlock' => 'FUNCTION',
+        'hw_getchildcoll' => 'FUNCTION',
+        'hw_getchildcollobj' => 'FUNCTION',
+        'hw_getchilddoccoll' => 'FUNCTION',
+        'hw_getchilddoccollobj' => 'FUNCTION',
+        'hw_getobject' => 'FUNCTION',
+        'hw_getobjectbyquery' => 'FUNCTION',
+        'hw_getobjectbyquerycoll' => 'FUNCTION',
+        'hw_getobjectbyquerycollobj' => 'FUNCTION',
+        'hw_getobjectbyqueryobj' => 'FUNCTION',
+        'hw_getparents' => 'FUNCTION',
+        'hw_getparentsobj' => 'FUNCTION',
+        'hw_getrellink' => 'FUNCTION',
+        'hw_getremote' => 'FUNCTION',
+        'hw_getremotechildren' => 'FUNCTION',
+        'hw_getsrcbydestobj' => 'FUNCTION',
+        'hw_gettext' => 'FUNCTION',
+        'hw_getusername' => 'FUNCTION',
+        'hw_identify' => 'FUNCTION',
+        'hw_incollections' => 'FUNCTION',
+        'hw_info' => 'FUNCTION',
+        'hw_inscoll' => 'FUNCTION',
+        'hw_insdoc' => 'FUNCTION',
+        'hw_insertanchors' => 'FUNCTION',
+        'hw_insertdocument' => 'FUNCTION',
+        'hw_insertobject' => 'FUNCTION',
+        'hw_mapid' => 'FUNCTION',
+        'hw_modifyobject' => 'FUNCTION',
+        'hw_mv' => 'FUNCTION',
+        'hw_new_document' => 'FUNCTION',
+        'hw_objrec2array' => 'FUNCTION',
+        'hw_output_document' => 'FUNCTION',
+        'hw_pconnect' => 'FUNCTION',
+        'hw_pipedocument' => 'FUNCTION',
+        'hw_root' => 'FUNCTION',
+        'hw_setlinkroot' => 'FUNCTION',
+        'hw_stat' => 'FUNCTION',
+        'hw_unlock' => 'FUNCTION',
+        'hw_who' => 'FUNCTION',
+        'hwapi_attribute' => 'FUNCTION',
+        'hwapi_attribute_key' => 'FUNCTION',
+        'hwapi_attribute_langdepvalue' => 'FUNCTION',
+        'hwapi_attribute_value' => 'FUNCTION',
+        'hwapi_attribute_values' => 'FUNCTION',
+        'hwapi_checkin' => 'FUNCTION',
+        'hwapi_checkout' => 'FUNCTION',
+        'hwapi_children' => 'FUNCTION',
+        'hwapi_content' => 'FUNCTION',
+        'hwapi_content_mimetype' => 'FUNCTION',
+        'hwapi_content_read' => 'FUNCTION',
+        'hwapi_copy' => 'FUNCTION',
+        'hwapi_dbstat' => 'FUNCTION',
+        'hwapi_dcstat' => 'FUNCTION',
+        'hwapi_dstanchors' => 'FUNCTION',
+        'hwapi_dstofsrcanchor' => 'FUNCTION',
+        'hwapi_error_count' => 'FUNCTION',
+        'hwapi_error_reason' => 'FUNCTION',
+        'hwapi_find' => 'FUNCTION',
+        'hwapi_ftstat' => 'FUNCTION',
+        'hwapi_hgcsp' => 'FUNCTION',
+        'hwapi_hwstat' => 'FUNCTION',
+        'hwapi_identify' => 'FUNCTION',
+        'hwapi_info' => 'FUNCTION',
+        'hwapi_insert' => 'FUNCTION',
+        'hwapi_insertanchor' => 'FUNCTION',
+        'hwapi_insertcollection' => 'FUNCTION',
+        'hwapi_insertdocument' => 'FUNCTION',
+        'hwapi_link' => 'FUNCTION',
+        'hwapi_lock' => 'FUNCTION',
+        'hwapi_move' => 'FUNCTION',
+        'hwapi_new_content' => 'FUNCTION',
+        'hwapi_object' => 'FUNCTION',
+        'hwapi_object_assign' => 'FUNCTION',
+        'hwapi_object_attreditable' => 'FUNCTION',
+        'hwapi_object_count' => 'FUNCTION',
+        'hwapi_object_insert' => 'FUNCTION',
+        'hwapi_object_new' => 'FUNCTION',
+        'hwapi_object_remove' => 'FUNCTION',
+        'hwapi_object_title' => 'FUNCTION',
+        'hwapi_object_value' => 'FUNCTION',
+        'hwapi_objectbyanchor' => 'FUNCTION',
+        'hwapi_parents' => 'FUNCTION',
+        'hwapi_reason_description' => 'FUNCTION',
+        'hwapi_reason_type' => 'FUNCTION',
+        'hwapi_remove' => 'FUNCTION',
+        'hwapi_replace' => 'FUNCTION',
+        'hwapi_setcommittedversion' => 'FUNCTION',
+        'hwapi_srcanchors' => 'FUNCTION',
+        'hwapi_srcsofdst' => 'FUNCTION',
+        'hwapi_unlock' => 'FUNCTION',
+        'hwapi_user' => 'FUNCTION',
+        'hwapi_userlist' => 'FUNCTION',
+        'hypot' => 'FUNCTION',
+        'ibase_add_user' => 'FUNCTION',
+        'ibase_affected_rows' => 'FUNCTION',
+        'ibase_backup' => 'FUNCTION',
+        'ibase_blob_add' => 'FUNCTION',
+        'ibase_blob_cancel' => 'FUNCTION',
+        'ibase_blob_close' => 'FUNCTION',
+        'ibase_blob_create' => 'FUNCTION',
+        'ibase_blob_echo' => 'FUNCTION',
+        'ibase_blob_get' => 'FUNCTION',
+        'ibase_blob_import' => 'FUNCTION',
+        'ibase_blob_info' => 'FUNCTION',
+        'ibase_blob_open' => 'FUNCTION',
+        'ibase_close' => 'FUNCTION',
+        'ibase_commit' => 'FUNCTION',
+        'ibase_commit_ret' => 'FUNCTION',
+        'ibase_connect' => 'FUNCTION',
+        'ibase_db_info' => 'FUNCTION',
+        'ibase_delete_user' => 'FUNCTION',
+        'ibase_drop_db' => 'FUNCTION',
+        'ibase_errcode' => 'FUNCTION',
+        'ibase_errmsg' => 'FUNCTION',
+        'ibase_execute' => 'FUNCTION',
+        'ibase_fetch_assoc' => 'FUNCTION',
+        'ibase_fetch_object' => 'FUNCTION',
+        'ibase_fetch_row' => 'FUNCTION',
+        'ibase_field_info' => 'FUNCTION',
+        'ibase_free_event_handler' => 'FUNCTION',
+        'ibase_free_query' => 'FUNCTION',
+        'ibase_free_result' => 'FUNCTION',
+        'ibase_gen_id' => 'FUNCTION',
+        'ibase_maintain_db' => 'FUNCTION',
+        'ibase_modify_user' => 'FUNCTION',
+        'ibase_name_result' => 'FUNCTION',
+        'ibase_num_fields' => 'FUNCTION',
+        'ibase_num_params' => 'FUNCTION',
+        'ibase_param_info' => 'FUNCTION',
+        'ibase_pconnect' => 'FUNCTION',
+        'ibase_prepare' => 'FUNCTION',
+        'ibase_query' => 'FUNCTION',
+        'ibase_restore' => 'FUNCTION',
+        'ibase_rollback' => 'FUNCTION',
+        'ibase_rollback_ret' => 'FUNCTION',
+        'ibase_server_info' => 'FUNCTION',
+        'ibase_service_attach' => 'FUNCTION',
+        'ibase_service_detach' => 'FUNCTION',
+        'ibase_set_event_handler' => 'FUNCTION',
+        'ibase_timefmt' => 'FUNCTION',
+        'ibase_trans' => 'FUNCTION',
+        'ibase_wait_event' => 'FUNCTION',
+        'iconv' => 'FUNCTION',
+        'iconv_get_encoding' => 'FUNCTION',
+        'iconv_mime_decode' => 'FUNCTION',
+        'iconv_mime_decode_headers' => 'FUNCTION',
+        'iconv_mime_encode' => 'FUNCTION',
+        'iconv_set_encoding' => 'FUNCTION',
+        'iconv_strlen' => 'FUNCTION',
+        'iconv_strpos' => 'FUNCTION',
+        'iconv_strrpos' => 'FUNCTION',
+        'iconv_substr' => 'FUNCTION',
+        'id3_get_frame_long_name' => 'FUNCTION',
+        'id3_get_frame_short_name' => 'FUNCTION',
+        'id3_get_genre_id' => 'FUNCTION',
+        'id3_get_genre_list' => 'FUNCTION',
+        'id3_get_genre_name' => 'FUNCTION',
+        'id3_get_tag' => 'FUNCTION',
+        'id3_get_version' => 'FUNCTION',
+        'id3_remove_tag' => 'FUNCTION',
+        'id3_set_tag' => 'FUNCTION',
+        'id3v2attachedpictureframe' => 'FUNCTION',
+        'id3v2frame' => 'FUNCTION',
+        'id3v2tag' => 'FUNCTION',
+        'idate' => 'FUNCTION',
+        'idn_to_ascii' => 'FUNCTION',
+        'idn_to_unicode' => 'FUNCTION',
+        'idn_to_utf8' => 'FUNCTION',
+        'ifx_affected_rows' => 'FUNCTION',
+        'ifx_blobinfile_mode' => 'FUNCTION',
+        'ifx_byteasvarchar' => 'FUNCTION',
+        'ifx_close' => 'FUNCTION',
+        'ifx_connect' => 'FUNCTION',
+        'ifx_copy_blob' => 'FUNCTION',
+        'ifx_create_blob' => 'FUNCTION',
+        'ifx_create_char' => 'FUNCTION',
+        'ifx_do' => 'FUNCTION',
+        'ifx_error' => 'FUNCTION',
+        'ifx_errormsg' => 'FUNCTION',
+        'ifx_fetch_row' => 'FUNCTION',
+        'ifx_fieldproperties' => 'FUNCTION',
+        'ifx_fieldtypes' => 'FUNCTION',
+        'ifx_free_blob' => 'FUNCTION',
+        'ifx_free_char' => 'FUNCTION',
+        'ifx_free_result' => 'FUNCTION',
+        'ifx_get_blob' => 'FUNCTION',
+        'ifx_get_char' => 'FUNCTION',
+        'ifx_getsqlca' => 'FUNCTION',
+        'ifx_htmltbl_result' => 'FUNCTION',
+        'ifx_nullformat' => 'FUNCTION',
+        'ifx_num_fields' => 'FUNCTION',
+        'ifx_num_rows' => 'FUNCTION',
+        'ifx_pconnect' => 'FUNCTION',
+        'ifx_prepare' => 'FUNCTION',
+        'ifx_query' => 'FUNCTION',
+        'ifx_textasvarchar' => 'FUNCTION',
+        'ifx_update_blob' => 'FUNCTION',
+        'ifx_update_char' => 'FUNCTION',
+        'ifxus_close_slob' => 'FUNCTION',
+        'ifxus_create_slob' => 'FUNCTION',
+        'ifxus_free_slob' => 'FUNCTION',
+        'ifxus_open_slob' => 'FUNCTION',
+        'ifxus_read_slob' => 'FUNCTION',
+        'ifxus_seek_slob' => 'FUNCTION',
+        'ifxus_tell_slob' => 'FUNCTION',
+        'ifxus_write_slob' => 'FUNCTION',
+        'ignore_user_abort' => 'FUNCTION',
+        'iis_add_server' => 'FUNCTION',
+        'iis_get_dir_security' => 'FUNCTION',
+        'iis_get_script_map' => 'FUNCTION',
+        'iis_get_server_by_comment' => 'FUNCTION',
+        'iis_get_server_by_path' => 'FUNCTION',
+        'iis_get_server_rights' => 'FUNCTION',
+        'iis_get_service_state' => 'FUNCTION',
+        'iis_remove_server' => 'FUNCTION',
+        'iis_set_app_settings' => 'FUNCTION',
+        'iis_set_dir_security' => 'FUNCTION',
+        'iis_set_script_map' => 'FUNCTION',
+        'iis_set_server_rights' => 'FUNCTION',
+        'iis_start_server' => 'FUNCTION',
+        'iis_start_service' => 'FUNCTION',
+        'iis_stop_server' => 'FUNCTION',
+        'iis_stop_service' => 'FUNCTION',
+        'image2wbmp' => 'FUNCTION',
+        'image_type_to_extension' => 'FUNCTION',
+        'image_type_to_mime_type' => 'FUNCTION',
+        'imagealphablending' => 'FUNCTION',
+        'imageantialias' => 'FUNCTION',
+        'imagearc' => 'FUNCTION',
+        'imagechar' => 'FUNCTION',
+        'imagecharup' => 'FUNCTION',
+        'imagecolorallocate' => 'FUNCTION',
+        'imagecolorallocatealpha' => 'FUNCTION',
+        'imagecolorat' => 'FUNCTION',
+        'imagecolorclosest' => 'FUNCTION',
+        'imagecolorclosestalpha' => 'FUNCTION',
+        'imagecolorclosesthwb' => 'FUNCTION',
+        'imagecolordeallocate' => 'FUNCTION',
+        'imagecolorexact' => 'FUNCTION',
+        'imagecolorexactalpha' => 'FUNCTION',
+        'imagecolormatch' => 'FUNCTION',
+        'imagecolorresolve' => 'FUNCTION',
+        'imagecolorresolvealpha' => 'FUNCTION',
+        'imagecolorset' => 'FUNCTION',
+        'imagecolorsforindex' => 'FUNCTION',
+        'imagecolorstotal' => 'FUNCTION',
+        'imagecolortransparent' => 'FUNCTION',
+        'imageconvolution' => 'FUNCTION',
+        'imagecopy' => 'FUNCTION',
+        'imagecopymerge' => 'FUNCTION',
+        'imagecopymergegray' => 'FUNCTION',
+        'imagecopyresampled' => 'FUNCTION',
+        'imagecopyresized' => 'FUNCTION',
+        'imagecreate' => 'FUNCTION',
+        'imagecreatefromgd' => 'FUNCTION',
+        'imagecreatefromgd2' => 'FUNCTION',
+        'imagecreatefromgd2part' => 'FUNCTION',
+        'imagecreatefromgif' => 'FUNCTION',
+        'imagecreatefromjpeg' => 'FUNCTION',
+        'imagecreatefrompng' => 'FUNCTION',
+        'imagecreatefromstring' => 'FUNCTION',
+        'imagecreatefromwbmp' => 'FUNCTION',
+        'imagecreatefromxbm' => 'FUNCTION',
+        'imagecreatefromxpm' => 'FUNCTION',
+        'imagecreatetruecolor' => 'FUNCTION',
+        'imagedashedline' => 'FUNCTION',
+        'imagedestroy' => 'FUNCTION',
+        'imageellipse' => 'FUNCTION',
+        'imagefill' => 'FUNCTION',
+        'imagefilledarc' => 'FUNCTION',
+        'imagefilledellipse' => 'FUNCTION',
+        'imagefilledpolygon' => 'FUNCTION',
+        'imagefilledrectangle' => 'FUNCTION',
+        'imagefilltoborder' => 'FUNCTION',
+        'imagefilter' => 'FUNCTION',
+        'imagefontheight' => 'FUNCTION',
+        'imagefontwidth' => 'FUNCTION',
+        'imageftbbox' => 'FUNCTION',
+        'imagefttext' => 'FUNCTION',
+        'imagegammacorrect' => 'FUNCTION',
+        'imagegd' => 'FUNCTION',
+        'imagegd2' => 'FUNCTION',
+        'imagegif' => 'FUNCTION',
+        'imagegrabscreen' => 'FUNCTION',
+        'imagegrabwindow' => 'FUNCTION',
+        'imageinterlace' => 'FUNCTION',
+        'imageistruecolor' => 'FUNCTION',
+        'imagejpeg' => 'FUNCTION',
+        'imagelayereffect' => 'FUNCTION',
+        'imageline' => 'FUNCTION',
+        'imageloadfont' => 'FUNCTION',
+        'imagepalettecopy' => 'FUNCTION',
+        'imagepng' => 'FUNCTION',
+        'imagepolygon' => 'FUNCTION',
+        'imagepsbbox' => 'FUNCTION',
+        'imagepsencodefont' => 'FUNCTION',
+        'imagepsextendfont' => 'FUNCTION',
+        'imagepsfreefont' => 'FUNCTION',
+        'imagepsloadfont' => 'FUNCTION',
+        'imagepsslantfont' => 'FUNCTION',
+        'imagepstext' => 'FUNCTION',
+        'imagerectangle' => 'FUNCTION',
+        'imagerotate' => 'FUNCTION',
+        'imagesavealpha' => 'FUNCTION',
+        'imagesetbrush' => 'FUNCTION',
+        'imagesetpixel' => 'FUNCTION',
+        'imagesetstyle' => 'FUNCTION',
+        'imagesetthickness' => 'FUNCTION',
+        'imagesettile' => 'FUNCTION',
+        'imagestring' => 'FUNCTION',
+        'imagestringup' => 'FUNCTION',
+        'imagesx' => 'FUNCTION',
+        'imagesy' => 'FUNCTION',
+        'imagetruecolortopalette' => 'FUNCTION',
+        'imagettfbbox' => 'FUNCTION',
+        'imagettftext' => 'FUNCTION',
+        'imagetypes' => 'FUNCTION',
+        'imagewbmp' => 'FUNCTION',
+        'imagexbm' => 'FUNCTION',
+        'imagick' => 'FUNCTION',
+        'imagick_adaptiveblurimage' => 'FUNCTION',
+        'imagick_adaptiveresizeimage' => 'FUNCTION',
+        'imagick_adaptivesharpenimage' => 'FUNCTION',
+        'imagick_adaptivethresholdimage' => 'FUNCTION',
+        'imagick_addimage' => 'FUNCTION',
+        'imagick_addnoiseimage' => 'FUNCTION',
+        'imagick_affinetransformimage' => 'FUNCTION',
+        'imagick_animateimages' => 'FUNCTION',
+        'imagick_annotateimage' => 'FUNCTION',
+        'imagick_appendimages' => 'FUNCTION',
+        'imagick_averageimages' => 'FUNCTION',
+        'imagick_blackthresholdimage' => 'FUNCTION',
+        'imagick_blurimage' => 'FUNCTION',
+        'imagick_borderimage' => 'FUNCTION',
+        'imagick_charcoalimage' => 'FUNCTION',
+        'imagick_chopimage' => 'FUNCTION',
+        'imagick_clear' => 'FUNCTION',
+        'imagick_clipimage' => 'FUNCTION',
+        'imagick_clippathimage' => 'FUNCTION',
+        'imagick_clone' => 'FUNCTION',
+        'imagick_clutimage' => 'FUNCTION',
+        'imagick_coalesceimages' => 'FUNCTION',
+        'imagick_colorfloodfillimage' => 'FUNCTION',
+        'imagick_colorizeimage' => 'FUNCTION',
+        'imagick_combineimages' => 'FUNCTION',
+        'imagick_commentimage' => 'FUNCTION',
+        'imagick_compareimagechannels' => 'FUNCTION',
+        'imagick_compareimagelayers' => 'FUNCTION',
+        'imagick_compareimages' => 'FUNCTION',
+        'imagick_compositeimage' => 'FUNCTION',
+        'imagick_construct' => 'FUNCTION',
+        'imagick_contrastimage' => 'FUNCTION',
+        'imagick_contraststretchimage' => 'FUNCTION',
+        'imagick_convolveimage' => 'FUNCTION',
+        'imagick_cropimage' => 'FUNCTION',
+        'imagick_cropthumbnailimage' => 'FUNCTION',
+        'imagick_current' => 'FUNCTION',
+        'imagick_cyclecolormapimage' => 'FUNCTION',
+        'imagick_decipherimage' => 'FUNCTION',
+        'imagick_deconstructimages' => 'FUNCTION',
+        'imagick_deleteimageartifact' => 'FUNCTION',
+        'imagick_despeckleimage' => 'FUNCTION',
+        'imagick_destroy' => 'FUNCTION',
+        'imagick_displayimage' => 'FUNCTION',
+        'imagick_displayimages' => 'FUNCTION',
+        'imagick_distortimage' => 'FUNCTION',
+        'imagick_drawimage' => 'FUNCTION',
+        'imagick_edgeimage' => 'FUNCTION',
+        'imagick_embossimage' => 'FUNCTION',
+        'imagick_encipherimage' => 'FUNCTION',
+        'imagick_enhanceimage' => 'FUNCTION',
+        'imagick_equalizeimage' => 'FUNCTION',
+        'imagick_evaluateimage' => 'FUNCTION',
+        'imagick_extentimage' => 'FUNCTION',
+        'imagick_flattenimages' => 'FUNCTION',
+        'imagick_flipimage' => 'FUNCTION',
+        'imagick_floodfillpaintimage' => 'FUNCTION',
+        'imagick_flopimage' => 'FUNCTION',
+        'imagick_frameimage' => 'FUNCTION',
+        'imagick_fximage' => 'FUNCTION',
+        'imagick_gammaimage' => 'FUNCTION',
+        'imagick_gaussianblurimage' => 'FUNCTION',
+        'imagick_getcolorspace' => 'FUNCTION',
+        'imagick_getcompression' => 'FUNCTION',
+        'imagick_getcompressionquality' => 'FUNCTION',
+        'imagick_getcopyright' => 'FUNCTION',
+        'imagick_getfilename' => 'FUNCTION',
+        'imagick_getfont' => 'FUNCTION',
+        'imagick_getformat' => 'FUNCTION',
+        'imagick_getgravity' => 'FUNCTION',
+        'imagick_gethomeurl' => 'FUNCTION',
+        'imagick_getimage' => 'FUNCTION',
+        'imagick_getimagealphachannel' => 'FUNCTION',
+        'imagick_getimageartifact' => 'FUNCTION',
+        'imagick_getimagebackgroundcolor' => 'FUNCTION',
+        'imagick_getimageblob' => 'FUNCTION',
+        'imagick_getimageblueprimary' => 'FUNCTION',
+        'imagick_getimagebordercolor' => 'FUNCTION',
+        'imagick_getimagechanneldepth' => 'FUNCTION',
+        'imagick_getimagechanneldistortion' => 'FUNCTION',
+        'imagick_getimagechanneldistortions' => 'FUNCTION',
+        'imagick_getimagechannelextrema' => 'FUNCTION',
+        'imagick_getimagechannelmean' => 'FUNCTION',
+        'imagick_getimagechannelrange' => 'FUNCTION',
+        'imagick_getimagechannelstatistics' => 'FUNCTION',
+        'imagick_getimageclipmask' => 'FUNCTION',
+        'imagick_getimagecolormapcolor' => 'FUNCTION',
+        'imagick_getimagecolors' => 'FUNCTION',
+        'imagick_getimagecolorspace' => 'FUNCTION',
+        'imagick_getimagecompose' => 'FUNCTION',
+        'imagick_getimagecompression' => 'FUNCTION',
+        'imagick_getimagecompressionquality' => 'FUNCTION',
+        'imagick_getimagedelay' => 'FUNCTION',
+        'imagick_getimagedepth' => 'FUNCTION',
+        'imagick_getimagedispose' => 'FUNCTION',
+        'imagick_getimagedistortion' => 'FUNCTION',
+        'imagick_getimageextrema' => 'FUNCTION',
+        'imagick_getimagefilename' => 'FUNCTION',
+        'imagick_getimageformat' => 'FUNCTION',
+        'imagick_getimagegamma' => 'FUNCTION',
+        'imagick_getimagegeometry' => 'FUNCTION',
+        'imagick_getimagegravity' => 'FUNCTION',
+        'imagick_getimagegreenprimary' => 'FUNCTION',
+        'imagick_getimageheight' => 'FUNCTION',
+        'imagick_getimagehistogram' => 'FUNCTION',
+        'imagick_getimageindex' => 'FUNCTION',
+        'imagick_getimageinterlacescheme' => 'FUNCTION',
+        'imagick_getimageinterpolatemethod' => 'FUNCTION',
+        'imagick_getimageiterations' => 'FUNCTION',
+        'imagick_getimagelength' => 'FUNCTION',
+        'imagick_getimagemagicklicense' => 'FUNCTION',
+        'imagick_getimagematte' => 'FUNCTION',
+        'imagick_getimagemattecolor' => 'FUNCTION',
+        'imagick_getimageorientation' => 'FUNCTION',
+        'imagick_getimagepage' => 'FUNCTION',
+        'imagick_getimagepixelcolor' => 'FUNCTION',
+        'imagick_getimageprofile' => 'FUNCTION',
+        'imagick_getimageprofiles' => 'FUNCTION',
+        'imagick_getimageproperties' => 'FUNCTION',
+        'imagick_getimageproperty' => 'FUNCTION',
+        'imagick_getimageredprimary' => 'FUNCTION',
+        'imagick_getimageregion' => 'FUNCTION',
+        'imagick_getimagerenderingintent' => 'FUNCTION',
+        'imagick_getimageresolution' => 'FUNCTION',
+        'imagick_getimagesblob' => 'FUNCTION',
+        'imagick_getimagescene' => 'FUNCTION',
+        'imagick_getimagesignature' => 'FUNCTION',
+        'imagick_getimagesize' => 'FUNCTION',
+        'imagick_getimagetickspersecond' => 'FUNCTION',
+        'imagick_getimagetotalinkdensity' => 'FUNCTION',
+        'imagick_getimagetype' => 'FUNCTION',
+        'imagick_getimageunits' => 'FUNCTION',
+        'imagick_getimagevirtualpixelmethod' => 'FUNCTION',
+        'imagick_getimagewhitepoint' => 'FUNCTION',
+        'imagick_getimagewidth' => 'FUNCTION',
+        'imagick_getinterlacescheme' => 'FUNCTION',
+        'imagick_getiteratorindex' => 'FUNCTION',
+        'imagick_getnumberimages' => 'FUNCTION',
+        'imagick_getoption' => 'FUNCTION',
+        'imagick_getpackagename' => 'FUNCTION',
+        'imagick_getpage' => 'FUNCTION',
+        'imagick_getpixeliterator' => 'FUNCTION',
+        'imagick_getpixelregioniterator' => 'FUNCTION',
+        'imagick_getpointsize' => 'FUNCTION',
+        'imagick_getquantumdepth' => 'FUNCTION',
+        'imagick_getquantumrange' => 'FUNCTION',
+        'imagick_getreleasedate' => 'FUNCTION',
+        'imagick_getresource' => 'FUNCTION',
+        'imagick_getresourcelimit' => 'FUNCTION',
+        'imagick_getsamplingfactors' => 'FUNCTION',
+        'imagick_getsize' => 'FUNCTION',
+        'imagick_getsizeoffset' => 'FUNCTION',
+        'imagick_getversion' => 'FUNCTION',
+        'imagick_hasnextimage' => 'FUNCTION',
+        'imagick_haspreviousimage' => 'FUNCTION',
+        'imagick_identifyimage' => 'FUNCTION',
+        'imagick_implodeimage' => 'FUNCTION',
+        'imagick_labelimage' => 'FUNCTION',
+        'imagick_levelimage' => 'FUNCTION',
+        'imagick_linearstretchimage' => 'FUNCTION',
+        'imagick_liquidrescaleimage' => 'FUNCTION',
+        'imagick_magnifyimage' => 'FUNCTION',
+        'imagick_mapimage' => 'FUNCTION',
+        'imagick_mattefloodfillimage' => 'FUNCTION',
+        'imagick_medianfilterimage' => 'FUNCTION',
+        'imagick_mergeimagelayers' => 'FUNCTION',
+        'imagick_minifyimage' => 'FUNCTION',
+        'imagick_modulateimage' => 'FUNCTION',
+        'imagick_montageimage' => 'FUNCTION',
+        'imagick_morphimages' => 'FUNCTION',
+        'imagick_mosaicimages' => 'FUNCTION',
+        'imagick_motionblurimage' => 'FUNCTION',
+        'imagick_negateimage' => 'FUNCTION',
+        'imagick_newimage' => 'FUNCTION',
+        'imagick_newpseudoimage' => 'FUNCTION',
+        'imagick_nextimage' => 'FUNCTION',
+        'imagick_normalizeimage' => 'FUNCTION',
+        'imagick_oilpaintimage' => 'FUNCTION',
+        'imagick_opaquepaintimage' => 'FUNCTION',
+        'imagick_optimizeimagelayers' => 'FUNCTION',
+        'imagick_orderedposterizeimage' => 'FUNCTION',
+        'imagick_paintfloodfillimage' => 'FUNCTION',
+        'imagick_paintopaqueimage' => 'FUNCTION',
+        'imagick_painttransparentimage' => 'FUNCTION',
+        'imagick_pingimage' => 'FUNCTION',
+        'imagick_pingimageblob' => 'FUNCTION',
+        'imagick_pingimagefile' => 'FUNCTION',
+        'imagick_polaroidimage' => 'FUNCTION',
+        'imagick_posterizeimage' => 'FUNCTION',
+        'imagick_previewimages' => 'FUNCTION',
+        'imagick_previousimage' => 'FUNCTION',
+        'imagick_profileimage' => 'FUNCTION',
+        'imagick_quantizeimage' => 'FUNCTION',
+        'imagick_quantizeimages' => 'FUNCTION',
+        'imagick_queryfontmetrics' => 'FUNCTION',
+        'imagick_queryfonts' => 'FUNCTION',
+        'imagick_queryformats' => 'FUNCTION',
+        'imagick_radialblurimage' => 'FUNCTION',
+        'imagick_raiseimage' => 'FUNCTION',
+        'imagick_randomthresholdimage' => 'FUNCTION',
+        'imagick_readimage' => 'FUNCTION',
+        'imagick_readimageblob' => 'FUNCTION',
+        'imagick_readimagefile' => 'FUNCTION',
+        'imagick_recolorimage' => 'FUNCTION',
+        'imagick_reducenoiseimage' => 'FUNCTION',
+        'imagick_removeimage' => 'FUNCTION',
+        'imagick_removeimageprofile' => 'FUNCTION',
+        'imagick_render' => 'FUNCTION',
+        'imagick_resampleimage' => 'FUNCTION',
+        'imagick_resetimagepage' => 'FUNCTION',
+        'imagick_resizeimage' => 'FUNCTION',
+        'imagick_rollimage' => 'FUNCTION',
+        'imagick_rotateimage' => 'FUNCTION',
+        'imagick_roundcorners' => 'FUNCTION',
+        'imagick_sampleimage' => 'FUNCTION',
+        'imagick_scaleimage' => 'FUNCTION',
+        'imagick_separateimagechannel' => 'FUNCTION',
+        'imagick_sepiatoneimage' => 'FUNCTION',
+        'imagick_setbackgroundcolor' => 'FUNCTION',
+        'imagick_setcolorspace' => 'FUNCTION',
+        'imagick_setcompression' => 'FUNCTION',
+        'imagick_setcompressionquality' => 'FUNCTION',
+        'imagick_setfilename' => 'FUNCTION',
+        'imagick_setfirstiterator' => 'FUNCTION',
+        'imagick_setfont' => 'FUNCTION',
+        'imagick_setformat' => 'FUNCTION',
+        'imagick_setgravity' => 'FUNCTION',
+        'imagick_setimage' => 'FUNCTION',
+        'imagick_setimagealphachannel' => 'FUNCTION',
+        'imagick_setimageartifact' => 'FUNCTION',
+        'imagick_setimagebackgroundcolor' => 'FUNCTION',
+        'imagick_setimagebias' => 'FUNCTION',
+        'imagick_setimageblueprimary' => 'FUNCTION',
+        'imagick_setimagebordercolor' => 'FUNCTION',
+        'imagick_setimagechanneldepth' => 'FUNCTION',
+        'imagick_setimageclipmask' => 'FUNCTION',
+        'imagick_setimagecolormapcolor' => 'FUNCTION',
+        'imagick_setimagecolorspace' => 'FUNCTION',
+        'imagick_setimagecompose' => 'FUNCTION',
+        'imagick_setimagecompression' => 'FUNCTION',
+        'imagick_setimagecompressionquality' => 'FUNCTION',
+        'imagick_setimagedelay' => 'FUNCTION',
+        'imagick_setimagedepth' => 'FUNCTION',
+        'imagick_setimagedispose' => 'FUNCTION',
+        'imagick_setimageextent' => 'FUNCTION',
+        'imagick_setimagefilename' => 'FUNCTION',
+        'imagick_setimageformat' => 'FUNCTION',
+        'imagick_setimagegamma' => 'FUNCTION',
+        'imagick_setimagegravity' => 'FUNCTION',
+        'imagick_setimagegreenprimary' => 'FUNCTION',
+        'imagick_setimageindex' => 'FUNCTION',
+        'imagick_setimageinterlacescheme' => 'FUNCTION',
+        'imagick_setimageinterpolatemethod' => 'FUNCTION',
+        'imagick_setimageiterations' => 'FUNCTION',
+        'imagick_setimagematte' => 'FUNCTION',
+        'imagick_setimagemattecolor' => 'FUNCTION',
+        'imagick_setimageopacity' => 'FUNCTION',
+        'imagick_setimageorientation' => 'FUNCTION',
+        'imagick_setimagepage' => 'FUNCTION',
+        'imagick_setimageprofile' => 'FUNCTION',
+        'imagick_setimageproperty' => 'FUNCTION',
+        'imagick_setimageredprimary' => 'FUNCTION',
+        'imagick_setimagerenderingintent' => 'FUNCTION',
+        'imagick_setimageresolution' => 'FUNCTION',
+        'imagick_setimagescene' => 'FUNCTION',
+        'imagick_setimagetickspersecond' => 'FUNCTION',
+        'imagick_setimagetype' => 'FUNCTION',
+        'imagick_setimageunits' => 'FUNCTION',
+        'imagick_setimagevirtualpixelmethod' => 'FUNCTION',
+        'imagick_setimagewhitepoint' => 'FUNCTION',
+        'imagick_setinterlacescheme' => 'FUNCTION',
+        'imagick_setiteratorindex' => 'FUNCTION',
+        'imagick_setlastiterator' => 'FUNCTION',
+        'imagick_setoption' => 'FUNCTION',
+        'imagick_setpage' => 'FUNCTION',
+        'imagick_setpointsize' => 'FUNCTION',
+        'imagick_setresolution' => 'FUNCTION',
+        'imagick_setresourcelimit' => 'FUNCTION',
+        'imagick_setsamplingfactors' => 'FUNCTION',
+        'imagick_setsize' => 'FUNCTION',
+        'imagick_setsizeoffset' => 'FUNCTION',
+        'imagick_settype' => 'FUNCTION',
+        'imagick_shadeimage' => 'FUNCTION',
+        'imagick_shadowimage' => 'FUNCTION',
+        'imagick_sharpenimage' => 'FUNCTION',
+        'imagick_shaveimage' => 'FUNCTION',
+        'imagick_shearimage' => 'FUNCTION',
+        'imagick_sigmoidalcontrastimage' => 'FUNCTION',
+        'imagick_sketchimage' => 'FUNCTION',
+        'imagick_solarizeimage' => 'FUNCTION',
+        'imagick_spliceimage' => 'FUNCTION',
+        'imagick_spreadimage' => 'FUNCTION',
+        'imagick_steganoimage' => 'FUNCTION',
+        'imagick_stereoimage' => 'FUNCTION',
+        'imagick_stripimage' => 'FUNCTION',
+        'imagick_swirlimage' => 'FUNCTION',
+        'imagick_textureimage' => 'FUNCTION',
+        'imagick_thresholdimage' => 'FUNCTION',
+        'imagick_thumbnailimage' => 'FUNCTION',
+        'imagick_tintimage' => 'FUNCTION',
+        'imagick_transformimage' => 'FUNCTION',
+        'imagick_transparentpaintimage' => 'FUNCTION',
+        'imagick_transposeimage' => 'FUNCTION',
+        'imagick_transverseimage' => 'FUNCTION',
+        'imagick_trimimage' => 'FUNCTION',
+        'imagick_uniqueimagecolors' => 'FUNCTION',
+        'imagick_unsharpmaskimage' => 'FUNCTION',
+        'imagick_valid' => 'FUNCTION',
+        'imagick_vignetteimage' => 'FUNCTION',
+        'imagick_waveimage' => 'FUNCTION',
+        'imagick_whitethresholdimage' => 'FUNCTION',
+        'imagick_writeimage' => 'FUNCTION',
+        'imagick_writeimagefile' => 'FUNCTION',
+        'imagick_writeimages' => 'FUNCTION',
+        'imagick_writeimagesfile' => 'FUNCTION',
+        'imagickdraw' => 'FUNCTION',
+        'imagickdraw_affine' => 'FUNCTION',
+        'imagickdraw_annotation' => 'FUNCTION',
+        'imagickdraw_arc' => 'FUNCTION',
+        'imagickdraw_bezier' => 'FUNCTION',
+        'imagickdraw_circle' => 'FUNCTION',
+        'imagickdraw_clear' => 'FUNCTION',
+        'imagickdraw_clone' => 'FUNCTION',
+        'imagickdraw_color' => 'FUNCTION',
+        'imagickdraw_comment' => 'FUNCTION',
+        'imagickdraw_composite' => 'FUNCTION',
+        'imagickdraw_construct' => 'FUNCTION',
+        'imagickdraw_destroy' => 'FUNCTION',
+        'imagickdraw_ellipse' => 'FUNCTION',
+        'imagickdraw_getclippath' => 'FUNCTION',
+        'imagickdraw_getcliprule' => 'FUNCTION',
+        'imagickdraw_getclipunits' => 'FUNCTION',
+        'imagickdraw_getfillcolor' => 'FUNCTION',
+        'imagickdraw_getfillopacity' => 'FUNCTION',
+        'imagickdraw_getfillrule' => 'FUNCTION',
+        'imagickdraw_getfont' => 'FUNCTION',
+        'imagickdraw_getfontfamily' => 'FUNCTION',
+        'imagickdraw_getfontsize' => 'FUNCTION',
+        'imagickdraw_getfontstyle' => 'FUNCTION',
+        'imagickdraw_getfontweight' => 'FUNCTION',
+        'imagickdraw_getgravity' => 'FUNCTION',
+        'imagickdraw_getstrokeantialias' => 'FUNCTION',
+        'imagickdraw_getstrokecolor' => 'FUNCTION',
+        'imagickdraw_getstrokedasharray' => 'FUNCTION',
+        'imagickdraw_getstrokedashoffset' => 'FUNCTION',
+        'imagickdraw_getstrokelinecap' => 'FUNCTION',
+        'imagickdraw_getstrokelinejoin' => 'FUNCTION',
+        'imagickdraw_getstrokemiterlimit' => 'FUNCTION',
+        'imagickdraw_getstrokeopacity' => 'FUNCTION',
+        'imagickdraw_getstrokewidth' => 'FUNCTION',
+        'imagickdraw_gettextalignment' => 'FUNCTION',
+        'imagickdraw_gettextantialias' => 'FUNCTION',
+        'imagickdraw_gettextdecoration' => 'FUNCTION',
+        'imagickdraw_gettextencoding' => 'FUNCTION',
+        'imagickdraw_gettextundercolor' => 'FUNCTION',
+        'imagickdraw_getvectorgraphics' => 'FUNCTION',
+        'imagickdraw_line' => 'FUNCTION',
+        'imagickdraw_matte' => 'FUNCTION',
+        'imagickdraw_pathclose' => 'FUNCTION',
+        'imagickdraw_pathcurvetoabsolute' => 'FUNCTION',
+        'imagickdraw_pathcurvetoquadraticbezierabsolute' => 'FUNCTION',
+        'imagickdraw_pathcurvetoquadraticbezierrelative' => 'FUNCTION',
+        'imagickdraw_pathcurvetoquadraticbeziersmoothabsolute' => 'FUNCTION',
+        'imagickdraw_pathcurvetoquadraticbeziersmoothrelative' => 'FUNCTION',
+        'imagickdraw_pathcurvetorelative' => 'FUNCTION',
+        'imagickdraw_pathcurvetosmoothabsolute' => 'FUNCTION',
+        'imagickdraw_pathcurvetosmoothrelative' => 'FUNCTION',
+        'imagickdraw_pathellipticarcabsolute' => 'FUNCTION',
+        'imagickdraw_pathellipticarcrelative' => 'FUNCTION',
+        'imagickdraw_pathfinish' => 'FUNCTION',
+        'imagickdraw_pathlinetoabsolute' => 'FUNCTION',
+        'imagickdraw_pathlinetohorizontalabsolute' => 'FUNCTION',
+        'imagickdraw_pathlinetohorizontalrelative' => 'FUNCTION',
+        'imagickdraw_pathlinetorelative' => 'FUNCTION',
+        'imagickdraw_pathlinetoverticalabsolute' => 'FUNCTION',
+        'imagickdraw_pathlinetoverticalrelative' => 'FUNCTION',
+        'imagickdraw_pathmovetoabsolute' => 'FUNCTION',
+        'imagickdraw_pathmovetorelative' => 'FUNCTION',
+        'imagickdraw_pathstart' => 'FUNCTION',
+        'imagickdraw_point' => 'FUNCTION',
+        'imagickdraw_polygon' => 'FUNCTION',
+        'imagickdraw_polyline' => 'FUNCTION',
+        'imagickdraw_pop' => 'FUNCTION',
+        'imagickdraw_popclippath' => 'FUNCTION',
+        'imagickdraw_popdefs' => 'FUNCTION',
+        'imagickdraw_poppattern' => 'FUNCTION',
+        'imagickdraw_push' => 'FUNCTION',
+        'imagickdraw_pushclippath' => 'FUNCTION',
+        'imagickdraw_pushdefs' => 'FUNCTION',
+        'imagickdraw_pushpattern' => 'FUNCTION',
+        'imagickdraw_rectangle' => 'FUNCTION',
+        'imagickdraw_render' => 'FUNCTION',
+        'imagickdraw_rotate' => 'FUNCTION',
+        'imagickdraw_roundrectangle' => 'FUNCTION',
+        'imagickdraw_scale' => 'FUNCTION',
+        'imagickdraw_setclippath' => 'FUNCTION',
+        'imagickdraw_setcliprule' => 'FUNCTION',
+        'imagickdraw_setclipunits' => 'FUNCTION',
+        'imagickdraw_setfillalpha' => 'FUNCTION',
+        'imagickdraw_setfillcolor' => 'FUNCTION',
+        'imagickdraw_setfillopacity' => 'FUNCTION',
+        'imagickdraw_setfillpatternurl' => 'FUNCTION',
+        'imagickdraw_setfillrule' => 'FUNCTION',
+        'imagickdraw_setfont' => 'FUNCTION',
+        'imagickdraw_setfontfamily' => 'FUNCTION',
+        'imagickdraw_setfontsize' => 'FUNCTION',
+        'imagickdraw_setfontstretch' => 'FUNCTION',
+        'imagickdraw_setfontstyle' => 'FUNCTION',
+        'imagickdraw_setfontweight' => 'FUNCTION',
+        'imagickdraw_setgravity' => 'FUNCTION',
+        'imagickdraw_setstrokealpha' => 'FUNCTION',
+        'imagickdraw_setstrokeantialias' => 'FUNCTION',
+        'imagickdraw_setstrokecolor' => 'FUNCTION',
+        'imagickdraw_setstrokedasharray' => 'FUNCTION',
+        'imagickdraw_setstrokedashoffset' => 'FUNCTION',
+        'imagickdraw_setstrokelinecap' => 'FUNCTION',
+        'imagickdraw_setstrokelinejoin' => 'FUNCTION',
+        'imagickdraw_setstrokemiterlimit' => 'FUNCTION',
+        'imagickdraw_setstrokeopacity' => 'FUNCTION',
+        'imagickdraw_setstrokepatternurl' => 'FUNCTION',
+        'imagickdraw_setstrokewidth' => 'FUNCTION',
+        'imagickdraw_settextalignment' => 'FUNCTION',
+        'imagickdraw_settextantialias' => 'FUNCTION',
+        'imagickdraw_settextdecoration' => 'FUNCTION',
+        'imagickdraw_settextencoding' => 'FUNCTION',
+        'imagickdraw_settextundercolor' => 'FUNCTION',
+        'imagickdraw_setvectorgraphics' => 'FUNCTION',
+        'imagickdraw_setviewbox' => 'FUNCTION',
+        'imagickdraw_skewx' => 'FUNCTION',
+        'imagickdraw_skewy' => 'FUNCTION',
+        'imagickdraw_translate' => 'FUNCTION',
+        'imagickpixel' => 'FUNCTION',
+        'imagickpixel_clear' => 'FUNCTION',
+        'imagickpixel_construct' => 'FUNCTION',
+        'imagickpixel_destroy' => 'FUNCTION',
+        'imagickpixel_getcolor' => 'FUNCTION',
+        'imagickpixel_getcolorasstring' => 'FUNCTION',
+        'imagickpixel_getcolorcount' => 'FUNCTION',
+        'imagickpixel_getcolorvalue' => 'FUNCTION',
+        'imagickpixel_gethsl' => 'FUNCTION',
+        'imagickpixel_issimilar' => 'FUNCTION',
+        'imagickpixel_setcolor' => 'FUNCTION',
+        'imagickpixel_setcolorvalue' => 'FUNCTION',
+        'imagickpixel_sethsl' => 'FUNCTION',
+        'imagickpixeliterator' => 'FUNCTION',
+        'imagickpixeliterator_clear' => 'FUNCTION',
+        'imagickpixeliterator_construct' => 'FUNCTION',
+        'imagickpixeliterator_destroy' => 'FUNCTION',
+        'imagickpixeliterator_getcurrentiteratorrow' => 'FUNCTION',
+        'imagickpixeliterator_getiteratorrow' => 'FUNCTION',
+        'imagickpixeliterator_getnextiteratorrow' => 'FUNCTION',
+        'imagickpixeliterator_getpreviousiteratorrow' => 'FUNCTION',
+        'imagickpixeliterator_newpixeliterator' => 'FUNCTION',
+        'imagickpixeliterator_newpixelregioniterator' => 'FUNCTION',
+        'imagickpixeliterator_resetiterator' => 'FUNCTION',
+        'imagickpixeliterator_setiteratorfirstrow' => 'FUNCTION',
+        'imagickpixeliterator_setiteratorlastrow' => 'FUNCTION',
+        'imagickpixeliterator_setiteratorrow' => 'FUNCTION',
+        'imagickpixeliterator_synciterator' => 'FUNCTION',
+        'imap_8bit' => 'FUNCTION',
+        'imap_alerts' => 'FUNCTION',
+        'imap_append' => 'FUNCTION',
+        'imap_base64' => 'FUNCTION',
+        'imap_binary' => 'FUNCTION',
+        'imap_body' => 'FUNCTION',
+        'imap_bodystruct' => 'FUNCTION',
+        'imap_check' => 'FUNCTION',
+        'imap_clearflag_full' => 'FUNCTION',
+        'imap_close' => 'FUNCTION',
+        'imap_createmailbox' => 'FUNCTION',
+        'imap_delete' => 'FUNCTION',
+        'imap_deletemailbox' => 'FUNCTION',
+        'imap_errors' => 'FUNCTION',
+        'imap_expunge' => 'FUNCTION',
+        'imap_fetch_overview' => 'FUNCTION',
+        'imap_fetchbody' => 'FUNCTION',
+        'imap_fetchheader' => 'FUNCTION',
+        'imap_fetchstructure' => 'FUNCTION',
+        'imap_gc' => 'FUNCTION',
+        'imap_get_quota' => 'FUNCTION',
+        'imap_get_quotaroot' => 'FUNCTION',
+        'imap_getacl' => 'FUNCTION',
+        'imap_getmailboxes' => 'FUNCTION',
+        'imap_getsubscribed' => 'FUNCTION',
+        'imap_header' => 'FUNCTION',
+        'imap_headerinfo' => 'FUNCTION',
+        'imap_headers' => 'FUNCTION',
+        'imap_last_error' => 'FUNCTION',
+        'imap_list' => 'FUNCTION',
+        'imap_listmailbox' => 'FUNCTION',
+        'imap_listscan' => 'FUNCTION',
+        'imap_listsubscribed' => 'FUNCTION',
+        'imap_lsub' => 'FUNCTION',
+        'imap_mail' => 'FUNCTION',
+        'imap_mail_compose' => 'FUNCTION',
+        'imap_mail_copy' => 'FUNCTION',
+        'imap_mail_move' => 'FUNCTION',
+        'imap_mailboxmsginfo' => 'FUNCTION',
+        'imap_mime_header_decode' => 'FUNCTION',
+        'imap_msgno' => 'FUNCTION',
+        'imap_num_msg' => 'FUNCTION',
+        'imap_num_recent' => 'FUNCTION',
+        'imap_open' => 'FUNCTION',
+        'imap_ping' => 'FUNCTION',
+        'imap_qprint' => 'FUNCTION',
+        'imap_renamemailbox' => 'FUNCTION',
+        'imap_reopen' => 'FUNCTION',
+        'imap_rfc822_parse_adrlist' => 'FUNCTION',
+        'imap_rfc822_parse_headers' => 'FUNCTION',
+        'imap_rfc822_write_address' => 'FUNCTION',
+        'imap_savebody' => 'FUNCTION',
+        'imap_scanmailbox' => 'FUNCTION',
+        'imap_search' => 'FUNCTION',
+        'imap_set_quota' => 'FUNCTION',
+        'imap_setacl' => 'FUNCTION',
+        'imap_setflag_full' => 'FUNCTION',
+        'imap_sort' => 'FUNCTION',
+        'imap_status' => 'FUNCTION',
+        'imap_subscribe' => 'FUNCTION',
+        'imap_thread' => 'FUNCTION',
+        'imap_timeout' => 'FUNCTION',
+        'imap_uid' => 'FUNCTION',
+        'imap_undelete' => 'FUNCTION',
+        'imap_unsubscribe' => 'FUNCTION',
+        'imap_utf7_decode' => 'FUNCTION',
+        'imap_utf7_encode' => 'FUNCTION',
+        'imap_utf8' => 'FUNCTION',
+        'implementsinterface' => 'FUNCTION',
+        'implode' => 'FUNCTION',
+        'import_request_variables' => 'FUNCTION',
+        'in_array' => 'FUNCTION',
+        'include' => 'FUNCTION',
+        'include_once' => 'FUNCTION',
+        'inclued_get_data' => 'FUNCTION',
+        'inet_ntop' => 'FUNCTION',
+        'inet_pton' => 'FUNCTION',
+        'infiniteiterator' => 'FUNCTION',
+        'ingres_autocommit' => 'FUNCTION',
+        'ingres_autocommit_state' => 'FUNCTION',
+        'ingres_charset' => 'FUNCTION',
+        'ingres_close' => 'FUNCTION',
+        'ingres_commit' => 'FUNCTION',
+        'ingres_connect' => 'FUNCTION',
+        'ingres_cursor' => 'FUNCTION',
+        'ingres_errno' => 'FUNCTION',
+        'ingres_error' => 'FUNCTION',
+        'ingres_errsqlstate' => 'FUNCTION',
+        'ingres_escape_string' => 'FUNCTION',
+        'ingres_execute' => 'FUNCTION',
+        'ingres_fetch_array' => 'FUNCTION',
+        'ingres_fetch_assoc' => 'FUNCTION',
+        'ingres_fetch_object' => 'FUNCTION',
+        'ingres_fetch_proc_return' => 'FUNCTION',
+        'ingres_fetch_row' => 'FUNCTION',
+        'ingres_field_length' => 'FUNCTION',
+        'ingres_field_name' => 'FUNCTION',
+        'ingres_field_nullable' => 'FUNCTION',
+        'ingres_field_precision' => 'FUNCTION',
+        'ingres_field_scale' => 'FUNCTION',
+        'ingres_field_type' => 'FUNCTION',
+        'ingres_free_result' => 'FUNCTION',
+        'ingres_next_error' => 'FUNCTION',
+        'ingres_num_fields' => 'FUNCTION',
+        'ingres_num_rows' => 'FUNCTION',
+        'ingres_pconnect' => 'FUNCTION',
+        'ingres_prepare' => 'FUNCTION',
+        'ingres_query' => 'FUNCTION',
+        'ingres_result_seek' => 'FUNCTION',
+        'ingres_rollback' => 'FUNCTION',
+        'ingres_set_environment' => 'FUNCTION',
+        'ingres_unbuffered_query' => 'FUNCTION',
+        'ini_alter' => 'FUNCTION',
+        'ini_get' => 'FUNCTION',
+        'ini_get_all' => 'FUNCTION',
+        'ini_restore' => 'FUNCTION',
+        'ini_set' => 'FUNCTION',
+        'innamespace' => 'FUNCTION',
+        'inotify_add_watch' => 'FUNCTION',
+        'inotify_init' => 'FUNCTION',
+        'inotify_queue_len' => 'FUNCTION',
+        'inotify_read' => 'FUNCTION',
+        'inotify_rm_watch' => 'FUNCTION',
+        'interface_exists' => 'FUNCTION',
+        'intl_error_name' => 'FUNCTION',
+        'intl_get_error_code' => 'FUNCTION',
+        'intl_get_error_message' => 'FUNCTION',
+        'intl_is_failure' => 'FUNCTION',
+        'intldateformatter' => 'FUNCTION',
+        'intval' => 'FUNCTION',
+        'invalidargumentexception' => 'FUNCTION',
+        'invoke' => 'FUNCTION',
+        'invokeargs' => 'FUNCTION',
+        'ip2long' => 'FUNCTION',
+        'iptcembed' => 'FUNCTION',
+        'iptcparse' => 'FUNCTION',
+        'is_a' => 'FUNCTION',
+        'is_array' => 'FUNCTION',
+        'is_bool' => 'FUNCTION',
+        'is_callable' => 'FUNCTION',
+        'is_dir' => 'FUNCTION',
+        'is_double' => 'FUNCTION',
+        'is_executable' => 'FUNCTION',
+        'is_file' => 'FUNCTION',
+        'is_finite' => 'FUNCTION',
+        'is_float' => 'FUNCTION',
+        'is_infinite' => 'FUNCTION',
+        'is_int' => 'FUNCTION',
+        'is_integer' => 'FUNCTION',
+        'is_link' => 'FUNCTION',
+        'is_long' => 'FUNCTION',
+        'is_nan' => 'FUNCTION',
+        'is_null' => 'FUNCTION',
+        'is_numeric' => 'FUNCTION',
+        'is_object' => 'FUNCTION',
+        'is_readable' => 'FUNCTION',
+        'is_real' => 'FUNCTION',
+        'is_resource' => 'FUNCTION',
+        'is_scalar' => 'FUNCTION',
+        'is_soap_fault' => 'FUNCTION',
+        'is_string' => 'FUNCTION',
+        'is_subclass_of' => 'FUNCTION',
+        'is_uploaded_file' => 'FUNCTION',
+        'is_writable' => 'FUNCTION',
+        'is_writeable' => 'FUNCTION',
+        'isabstract' => 'FUNCTION',
+        'isdisabled' => 'FUNCTION',
+        'isfinal' => 'FUNCTION',
+        'isinstance' => 'FUNCTION',
+        'isinstantiable' => 'FUNCTION',
+        'isinterface' => 'FUNCTION',
+        'isinternal' => 'FUNCTION',
+        'isiterateable' => 'FUNCTION',
+        'isset' => 'FUNCTION',
+        'issubclassof' => 'FUNCTION',
+        'isuserdefined' => 'FUNCTION',
+        'iterator' => 'FUNCTION',
+        'iterator_apply' => 'FUNCTION',
+        'iterator_count' => 'FUNCTION',
+        'iterator_to_array' => 'FUNCTION',
+        'iteratoraggregate' => 'FUNCTION',
+        'iteratoriterator' => 'FUNCTION',
+        'java_last_exception_clear' => 'FUNCTION',
+        'java_last_exception_get' => 'FUNCTION',
+        'jddayofweek' => 'FUNCTION',
+        'jdmonthname' => 'FUNCTION',
+        'jdtofrench' => 'FUNCTION',
+        'jdtogregorian' => 'FUNCTION',
+        'jdtojewish' => 'FUNCTION',
+        'jdtojulian' => 'FUNCTION',
+        'jdtounix' => 'FUNCTION',
+        'jewishtojd' => 'FUNCTION',
+        'join' => 'FUNCTION',
+        'jpeg2wbmp' => 'FUNCTION',
+        'json_decode' => 'FUNCTION',
+        'json_encode' => 'FUNCTION',
+        'json_last_error' => 'FUNCTION',
+        'judy' => 'FUNCTION',
+        'judy_type' => 'FUNCTION',
+        'judy_version' => 'FUNCTION',
+        'juliantojd' => 'FUNCTION',
+        'kadm5_chpass_principal' => 'FUNCTION',
+        'kadm5_create_principal' => 'FUNCTION',
+        'kadm5_delete_principal' => 'FUNCTION',
+        'kadm5_destroy' => 'FUNCTION',
+        'kadm5_flush' => 'FUNCTION',
+        'kadm5_get_policies' => 'FUNCTION',
+        'kadm5_get_principal' => 'FUNCTION',
+        'kadm5_get_principals' => 'FUNCTION',
+        'kadm5_init_with_password' => 'FUNCTION',
+        'kadm5_modify_principal' => 'FUNCTION',
+        'key' => 'FUNCTION',
+        'krsort' => 'FUNCTION',
+        'ksort' => 'FUNCTION',
+        'lcfirst' => 'FUNCTION',
+        'lcg_value' => 'FUNCTION',
+        'lchgrp' => 'FUNCTION',
+        'lchown' => 'FUNCTION',
+        'ldap_8859_to_t61' => 'FUNCTION',
+        'ldap_add' => 'FUNCTION',
+        'ldap_bind' => 'FUNCTION',
+        'ldap_close' => 'FUNCTION',
+        'ldap_compare' => 'FUNCTION',
+        'ldap_connect' => 'FUNCTION',
+        'ldap_count_entries' => 'FUNCTION',
+        'ldap_delete' => 'FUNCTION',
+        'ldap_dn2ufn' => 'FUNCTION',
+        'ldap_err2str' => 'FUNCTION',
+        'ldap_errno' => 'FUNCTION',
+        'ldap_error' => 'FUNCTION',
+        'ldap_explode_dn' => 'FUNCTION',
+        'ldap_first_attribute' => 'FUNCTION',
+        'ldap_first_entry' => 'FUNCTION',
+        'ldap_first_reference' => 'FUNCTION',
+        'ldap_free_result' => 'FUNCTION',
+        'ldap_get_attributes' => 'FUNCTION',
+        'ldap_get_dn' => 'FUNCTION',
+        'ldap_get_entries' => 'FUNCTION',
+        'ldap_get_option' => 'FUNCTION',
+        'ldap_get_values' => 'FUNCTION',
+        'ldap_get_values_len' => 'FUNCTION',
+        'ldap_list' => 'FUNCTION',
+        'ldap_mod_add' => 'FUNCTION',
+        'ldap_mod_del' => 'FUNCTION',
+        'ldap_mod_replace' => 'FUNCTION',
+        'ldap_modify' => 'FUNCTION',
+        'ldap_next_attribute' => 'FUNCTION',
+        'ldap_next_entry' => 'FUNCTION',
+        'ldap_next_reference' => 'FUNCTION',
+        'ldap_parse_reference' => 'FUNCTION',
+        'ldap_parse_result' => 'FUNCTION',
+        'ldap_read' => 'FUNCTION',
+        'ldap_rename' => 'FUNCTION',
+        'ldap_sasl_bind' => 'FUNCTION',
+        'ldap_search' => 'FUNCTION',
+        'ldap_set_option' => 'FUNCTION',
+        'ldap_set_rebind_proc' => 'FUNCTION',
+        'ldap_sort' => 'FUNCTION',
+        'ldap_start_tls' => 'FUNCTION',
+        'ldap_t61_to_8859' => 'FUNCTION',
+        'ldap_unbind' => 'FUNCTION',
+        'lengthexception' => 'FUNCTION',
+        'levenshtein' => 'FUNCTION',
+        'libxml_clear_errors' => 'FUNCTION',
+        'libxml_disable_entity_loader' => 'FUNCTION',
+        'libxml_get_errors' => 'FUNCTION',
+        'libxml_get_last_error' => 'FUNCTION',
+        'libxml_set_streams_context' => 'FUNCTION',
+        'libxml_use_internal_errors' => 'FUNCTION',
+        'libxmlerror' => 'FUNCTION',
+        'limititerator' => 'FUNCTION',
+        'link' => 'FUNCTION',
+        'linkinfo' => 'FUNCTION',
+        'list' => 'FUNCTION',
+        'locale' => 'FUNCTION',
+        'localeconv' => 'FUNCTION',
+        'localtime' => 'FUNCTION',
+        'log' => 'FUNCTION',
+        'log10' => 'FUNCTION',
+        'log1p' => 'FUNCTION',
+        'logicexception' => 'FUNCTION',
+        'long2ip' => 'FUNCTION',
+        'lstat' => 'FUNCTION',
+        'ltrim' => 'FUNCTION',
+        'lzf_compress' => 'FUNCTION',
+        'lzf_decompress' => 'FUNCTION',
+        'lzf_optimized_for' => 'FUNCTION',
+        'm_checkstatus' => 'FUNCTION',
+        'm_completeauthorizations' => 'FUNCTION',
+        'm_connect' => 'FUNCTION',
+        'm_connectionerror' => 'FUNCTION',
+        'm_deletetrans' => 'FUNCTION',
+        'm_destroyconn' => 'FUNCTION',
+        'm_destroyengine' => 'FUNCTION',
+        'm_getcell' => 'FUNCTION',
+        'm_getcellbynum' => 'FUNCTION',
+        'm_getcommadelimited' => 'FUNCTION',
+        'm_getheader' => 'FUNCTION',
+        'm_initconn' => 'FUNCTION',
+        'm_initengine' => 'FUNCTION',
+        'm_iscommadelimited' => 'FUNCTION',
+        'm_maxconntimeout' => 'FUNCTION',
+        'm_monitor' => 'FUNCTION',
+        'm_numcolumns' => 'FUNCTION',
+        'm_numrows' => 'FUNCTION',
+        'm_parsecommadelimited' => 'FUNCTION',
+        'm_responsekeys' => 'FUNCTION',
+        'm_responseparam' => 'FUNCTION',
+        'm_returnstatus' => 'FUNCTION',
+        'm_setblocking' => 'FUNCTION',
+        'm_setdropfile' => 'FUNCTION',
+        'm_setip' => 'FUNCTION',
+        'm_setssl' => 'FUNCTION',
+        'm_setssl_cafile' => 'FUNCTION',
+        'm_setssl_files' => 'FUNCTION',
+        'm_settimeout' => 'FUNCTION',
+        'm_sslcert_gen_hash' => 'FUNCTION',
+        'm_transactionssent' => 'FUNCTION',
+        'm_transinqueue' => 'FUNCTION',
+        'm_transkeyval' => 'FUNCTION',
+        'm_transnew' => 'FUNCTION',
+        'm_transsend' => 'FUNCTION',
+        'm_uwait' => 'FUNCTION',
+        'm_validateidentifier' => 'FUNCTION',
+        'm_verifyconnection' => 'FUNCTION',
+        'm_verifysslcert' => 'FUNCTION',
+        'magic_quotes_runtime' => 'FUNCTION',
+        'mail' => 'FUNCTION',
+        'mailparse_determine_best_xfer_encoding' => 'FUNCTION',
+        'mailparse_msg_create' => 'FUNCTION',
+        'mailparse_msg_extract_part' => 'FUNCTION',
+        'mailparse_msg_extract_part_file' => 'FUNCTION',
+        'mailparse_msg_extract_whole_part_file' => 'FUNCTION',
+        'mailparse_msg_free' => 'FUNCTION',
+        'mailparse_msg_get_part' => 'FUNCTION',
+        'mailparse_msg_get_part_data' => 'FUNCTION',
+        'mailparse_msg_get_structure' => 'FUNCTION',
+        'mailparse_msg_parse' => 'FUNCTION',
+        'mailparse_msg_parse_file' => 'FUNCTION',
+        'mailparse_rfc822_parse_addresses' => 'FUNCTION',
+        'mailparse_stream_encode' => 'FUNCTION',
+        'mailparse_uudecode_all' => 'FUNCTION',
+        'main' => 'FUNCTION',
+        'max' => 'FUNCTION',
+        'maxdb_affected_rows' => 'FUNCTION',
+        'maxdb_autocommit' => 'FUNCTION',
+        'maxdb_bind_param' => 'FUNCTION',
+        'maxdb_bind_result' => 'FUNCTION',
+        'maxdb_change_user' => 'FUNCTION',
+        'maxdb_character_set_name' => 'FUNCTION',
+        'maxdb_client_encoding' => 'FUNCTION',
+        'maxdb_close' => 'FUNCTION',
+        'maxdb_close_long_data' => 'FUNCTION',
+        'maxdb_commit' => 'FUNCTION',
+        'maxdb_connect' => 'FUNCTION',
+        'maxdb_connect_errno' => 'FUNCTION',
+        'maxdb_connect_error' => 'FUNCTION',
+        'maxdb_data_seek' => 'FUNCTION',
+        'maxdb_debug' => 'FUNCTION',
+        'maxdb_disable_reads_from_master' => 'FUNCTION',
+        'maxdb_disable_rpl_parse' => 'FUNCTION',
+        'maxdb_dump_debug_info' => 'FUNCTION',
+        'maxdb_embedded_connect' => 'FUNCTION',
+        'maxdb_enable_reads_from_master' => 'FUNCTION',
+        'maxdb_enable_rpl_parse' => 'FUNCTION',
+        'maxdb_errno' => 'FUNCTION',
+        'maxdb_error' => 'FUNCTION',
+        'maxdb_escape_string' => 'FUNCTION',
+        'maxdb_execute' => 'FUNCTION',
+        'maxdb_fetch' => 'FUNCTION',
+        'maxdb_fetch_array' => 'FUNCTION',
+        'maxdb_fetch_assoc' => 'FUNCTION',
+        'maxdb_fetch_field' => 'FUNCTION',
+        'maxdb_fetch_field_direct' => 'FUNCTION',
+        'maxdb_fetch_fields' => 'FUNCTION',
+        'maxdb_fetch_lengths' => 'FUNCTION',
+        'maxdb_fetch_object' => 'FUNCTION',
+        'maxdb_fetch_row' => 'FUNCTION',
+        'maxdb_field_count' => 'FUNCTION',
+        'maxdb_field_seek' => 'FUNCTION',
+        'maxdb_field_tell' => 'FUNCTION',
+        'maxdb_free_result' => 'FUNCTION',
+        'maxdb_get_client_info' => 'FUNCTION',
+        'maxdb_get_client_version' => 'FUNCTION',
+        'maxdb_get_host_info' => 'FUNCTION',
+        'maxdb_get_metadata' => 'FUNCTION',
+        'maxdb_get_proto_info' => 'FUNCTION',
+        'maxdb_get_server_info' => 'FUNCTION',
+        'maxdb_get_server_version' => 'FUNCTION',
+        'maxdb_info' => 'FUNCTION',
+        'maxdb_init' => 'FUNCTION',
+        'maxdb_insert_id' => 'FUNCTION',
+        'maxdb_kill' => 'FUNCTION',
+        'maxdb_master_query' => 'FUNCTION',
+        'maxdb_more_results' => 'FUNCTION',
+        'maxdb_multi_query' => 'FUNCTION',
+        'maxdb_next_result' => 'FUNCTION',
+        'maxdb_num_fields' => 'FUNCTION',
+        'maxdb_num_rows' => 'FUNCTION',
+        'maxdb_options' => 'FUNCTION',
+        'maxdb_param_count' => 'FUNCTION',
+        'maxdb_ping' => 'FUNCTION',
+        'maxdb_prepare' => 'FUNCTION',
+        'maxdb_query' => 'FUNCTION',
+        'maxdb_real_connect' => 'FUNCTION',
+        'maxdb_real_escape_string' => 'FUNCTION',
+        'maxdb_real_query' => 'FUNCTION',
+        'maxdb_report' => 'FUNCTION',
+        'maxdb_rollback' => 'FUNCTION',
+        'maxdb_rpl_parse_enabled' => 'FUNCTION',
+        'maxdb_rpl_probe' => 'FUNCTION',
+        'maxdb_rpl_query_type' => 'FUNCTION',
+        'maxdb_select_db' => 'FUNCTION',
+        'maxdb_send_long_data' => 'FUNCTION',
+        'maxdb_send_query' => 'FUNCTION',
+        'maxdb_server_end' => 'FUNCTION',
+        'maxdb_server_init' => 'FUNCTION',
+        'maxdb_set_opt' => 'FUNCTION',
+        'maxdb_sqlstate' => 'FUNCTION',
+        'maxdb_ssl_set' => 'FUNCTION',
+        'maxdb_stat' => 'FUNCTION',
+        'maxdb_stmt_affected_rows' => 'FUNCTION',
+        'maxdb_stmt_bind_param' => 'FUNCTION',
+        'maxdb_stmt_bind_result' => 'FUNCTION',
+        'maxdb_stmt_close' => 'FUNCTION',
+        'maxdb_stmt_close_long_data' => 'FUNCTION',
+        'maxdb_stmt_data_seek' => 'FUNCTION',
+        'maxdb_stmt_errno' => 'FUNCTION',
+        'maxdb_stmt_error' => 'FUNCTION',
+        'maxdb_stmt_execute' => 'FUNCTION',
+        'maxdb_stmt_fetch' => 'FUNCTION',
+        'maxdb_stmt_free_result' => 'FUNCTION',
+        'maxdb_stmt_init' => 'FUNCTION',
+        'maxdb_stmt_num_rows' => 'FUNCTION',
+        'maxdb_stmt_param_count' => 'FUNCTION',
+        'maxdb_stmt_prepare' => 'FUNCTION',
+        'maxdb_stmt_reset' => 'FUNCTION',
+        'maxdb_stmt_result_metadata' => 'FUNCTION',
+        'maxdb_stmt_send_long_data' => 'FUNCTION',
+        'maxdb_stmt_sqlstate' => 'FUNCTION',
+        'maxdb_stmt_store_result' => 'FUNCTION',
+        'maxdb_store_result' => 'FUNCTION',
+        'maxdb_thread_id' => 'FUNCTION',
+        'maxdb_thread_safe' => 'FUNCTION',
+        'maxdb_use_result' => 'FUNCTION',
+        'maxdb_warning_count' => 'FUNCTION',
+        'mb_check_encoding' => 'FUNCTION',
+        'mb_convert_case' => 'FUNCTION',
+        'mb_convert_encoding' => 'FUNCTION',
+        'mb_convert_kana' => 'FUNCTION',
+        'mb_convert_variables' => 'FUNCTION',
+        'mb_decode_mimeheader' => 'FUNCTION',
+        'mb_decode_numericentity' => 'FUNCTION',
+        'mb_detect_encoding' => 'FUNCTION',
+        'mb_detect_order' => 'FUNCTION',
+        'mb_encode_mimeheader' => 'FUNCTION',
+        'mb_encode_numericentity' => 'FUNCTION',
+        'mb_encoding_aliases' => 'FUNCTION',
+        'mb_ereg' => 'FUNCTION',
+        'mb_ereg_match' => 'FUNCTION',
+        'mb_ereg_replace' => 'FUNCTION',
+        'mb_ereg_search' => 'FUNCTION',
+        'mb_ereg_search_getpos' => 'FUNCTION',
+        'mb_ereg_search_getregs' => 'FUNCTION',
+        'mb_ereg_search_init' => 'FUNCTION',
+        'mb_ereg_search_pos' => 'FUNCTION',
+        'mb_ereg_search_regs' => 'FUNCTION',
+        'mb_ereg_search_setpos' => 'FUNCTION',
+        'mb_eregi' => 'FUNCTION',
+        'mb_eregi_replace' => 'FUNCTION',
+        'mb_get_info' => 'FUNCTION',
+        'mb_http_input' => 'FUNCTION',
+        'mb_http_output' => 'FUNCTION',
+        'mb_internal_encoding' => 'FUNCTION',
+        'mb_language' => 'FUNCTION',
+        'mb_list_encodings' => 'FUNCTION',
+        'mb_output_handler' => 'FUNCTION',
+        'mb_parse_str' => 'FUNCTION',
+        'mb_preferred_mime_name' => 'FUNCTION',
+        'mb_regex_encoding' => 'FUNCTION',
+        'mb_regex_set_options' => 'FUNCTION',
+        'mb_send_mail' => 'FUNCTION',
+        'mb_split' => 'FUNCTION',
+        'mb_strcut' => 'FUNCTION',
+        'mb_strimwidth' => 'FUNCTION',
+        'mb_stripos' => 'FUNCTION',
+        'mb_stristr' => 'FUNCTION',
+        'mb_strlen' => 'FUNCTION',
+        'mb_strpos' => 'FUNCTION',
+        'mb_strrchr' => 'FUNCTION',
+        'mb_strrichr' => 'FUNCTION',
+        'mb_strripos' => 'FUNCTION',
+        'mb_strrpos' => 'FUNCTION',
+        'mb_strstr' => 'FUNCTION',
+        'mb_strtolower' => 'FUNCTION',
+        'mb_strtoupper' => 'FUNCTION',
+        'mb_strwidth' => 'FUNCTION',
+        'mb_substitute_character' => 'FUNCTION',
+        'mb_substr' => 'FUNCTION',
+        'mb_substr_count' => 'FUNCTION',
+        'mcrypt_cbc' => 'FUNCTION',
+        'mcrypt_cfb' => 'FUNCTION',
+        'mcrypt_create_iv' => 'FUNCTION',
+        'mcrypt_decrypt' => 'FUNCTION',
+        'mcrypt_ecb' => 'FUNCTION',
+        'mcrypt_enc_get_algorithms_name' => 'FUNCTION',
+        'mcrypt_enc_get_block_size' => 'FUNCTION',
+        'mcrypt_enc_get_iv_size' => 'FUNCTION',
+        'mcrypt_enc_get_key_size' => 'FUNCTION',
+        'mcrypt_enc_get_modes_name' => 'FUNCTION',
+        'mcrypt_enc_get_supported_key_sizes' => 'FUNCTION',
+        'mcrypt_enc_is_block_algorithm' => 'FUNCTION',
+        'mcrypt_enc_is_block_algorithm_mode' => 'FUNCTION',
+        'mcrypt_enc_is_block_mode' => 'FUNCTION',
+        'mcrypt_enc_self_test' => 'FUNCTION',
+        'mcrypt_encrypt' => 'FUNCTION',
+        'mcrypt_generic' => 'FUNCTION',
+        'mcrypt_generic_deinit' => 'FUNCTION',
+        'mcrypt_generic_end' => 'FUNCTION',
+        'mcrypt_generic_init' => 'FUNCTION',
+        'mcrypt_get_block_size' => 'FUNCTION',
+        'mcrypt_get_cipher_name' => 'FUNCTION',
+        'mcrypt_get_iv_size' => 'FUNCTION',
+        'mcrypt_get_key_size' => 'FUNCTION',
+        'mcrypt_list_algorithms' => 'FUNCTION',
+        'mcrypt_list_modes' => 'FUNCTION',
+        'mcrypt_module_close' => 'FUNCTION',
+        'mcrypt_module_get_algo_block_size' => 'FUNCTION',
+        'mcrypt_module_get_algo_key_size' => 'FUNCTION',
+        'mcrypt_module_get_supported_key_sizes' => 'FUNCTION',
+        'mcrypt_module_is_block_algorithm' => 'FUNCTION',
+        'mcrypt_module_is_block_algorithm_mode' => 'FUNCTION',
+        'mcrypt_module_is_block_mode' => 'FUNCTION',
+        'mcrypt_module_open' => 'FUNCTION',
+        'mcrypt_module_self_test' => 'FUNCTION',
+        'mcrypt_ofb' => 'FUNCTION',
+        'md5' => 'FUNCTION',
+        'md5_file' => 'FUNCTION',
+        'mdecrypt_generic' => 'FUNCTION',
+        'memcache' => 'FUNCTION',
+        'memcache_debug' => 'FUNCTION',
+        'memcached' => 'FUNCTION',
+        'memory_get_peak_usage' => 'FUNCTION',
+        'memory_get_usage' => 'FUNCTION',
+        'messageformatter' => 'FUNCTION',
+        'metaphone' => 'FUNCTION',
+        'method_exists' => 'FUNCTION',
+        'mhash' => 'FUNCTION',
+        'mhash_count' => 'FUNCTION',
+        'mhash_get_block_size' => 'FUNCTION',
+        'mhash_get_hash_name' => 'FUNCTION',
+        'mhash_keygen_s2k' => 'FUNCTION',
+        'microtime' => 'FUNCTION',
+        'mime_content_type' => 'FUNCTION',
+        'min' => 'FUNCTION',
+        'ming_keypress' => 'FUNCTION',
+        'ming_setcubicthreshold' => 'FUNCTION',
+        'ming_setscale' => 'FUNCTION',
+        'ming_setswfcompression' => 'FUNCTION',
+        'ming_useconstants' => 'FUNCTION',
+        'ming_useswfversion' => 'FUNCTION',
+        'mkdir' => 'FUNCTION',
+        'mktime' => 'FUNCTION',
+        'money_format' => 'FUNCTION',
+        'mongo' => 'FUNCTION',
+        'mongobindata' => 'FUNCTION',
+        'mongocode' => 'FUNCTION',
+        'mongocollection' => 'FUNCTION',
+        'mongoconnectionexception' => 'FUNCTION',
+        'mongocursor' => 'FUNCTION',
+        'mongocursorexception' => 'FUNCTION',
+        'mongocursortimeoutexception' => 'FUNCTION',
+        'mongodate' => 'FUNCTION',
+        'mongodb' => 'FUNCTION',
+        'mongodbref' => 'FUNCTION',
+        'mongoexception' => 'FUNCTION',
+        'mongogridfs' => 'FUNCTION',
+        'mongogridfscursor' => 'FUNCTION',
+        'mongogridfsexception' => 'FUNCTION',
+        'mongogridfsfile' => 'FUNCTION',
+        'mongoid' => 'FUNCTION',
+        'mongoint32' => 'FUNCTION',
+        'mongoint64' => 'FUNCTION',
+        'mongomaxkey' => 'FUNCTION',
+        'mongominkey' => 'FUNCTION',
+        'mongoregex' => 'FUNCTION',
+        'mongotimestamp' => 'FUNCTION',
+        'move_uploaded_file' => 'FUNCTION',
+        'mpegfile' => 'FUNCTION',
+        'mqseries_back' => 'FUNCTION',
+        'mqseries_begin' => 'FUNCTION',
+        'mqseries_close' => 'FUNCTION',
+        'mqseries_cmit' => 'FUNCTION',
+        'mqseries_conn' => 'FUNCTION',
+        'mqseries_connx' => 'FUNCTION',
+        'mqseries_disc' => 'FUNCTION',
+        'mqseries_get' => 'FUNCTION',
+        'mqseries_inq' => 'FUNCTION',
+        'mqseries_open' => 'FUNCTION',
+        'mqseries_put' => 'FUNCTION',
+        'mqseries_put1' => 'FUNCTION',
+        'mqseries_set' => 'FUNCTION',
+        'mqseries_strerror' => 'FUNCTION',
+        'msession_connect' => 'FUNCTION',
+        'msession_count' => 'FUNCTION',
+        'msession_create' => 'FUNCTION',
+        'msession_destroy' => 'FUNCTION',
+        'msession_disconnect' => 'FUNCTION',
+        'msession_find' => 'FUNCTION',
+        'msession_get' => 'FUNCTION',
+        'msession_get_array' => 'FUNCTION',
+        'msession_get_data' => 'FUNCTION',
+        'msession_inc' => 'FUNCTION',
+        'msession_list' => 'FUNCTION',
+        'msession_listvar' => 'FUNCTION',
+        'msession_lock' => 'FUNCTION',
+        'msession_plugin' => 'FUNCTION',
+        'msession_randstr' => 'FUNCTION',
+        'msession_set' => 'FUNCTION',
+        'msession_set_array' => 'FUNCTION',
+        'msession_set_data' => 'FUNCTION',
+        'msession_timeout' => 'FUNCTION',
+        'msession_uniq' => 'FUNCTION',
+        'msession_unlock' => 'FUNCTION',
+        'msg_get_queue' => 'FUNCTION',
+        'msg_queue_exists' => 'FUNCTION',
+        'msg_receive' => 'FUNCTION',
+        'msg_remove_queue' => 'FUNCTION',
+        'msg_send' => 'FUNCTION',
+        'msg_set_queue' => 'FUNCTION',
+        'msg_stat_queue' => 'FUNCTION',
+        'msql' => 'FUNCTION',
+        'msql_affected_rows' => 'FUNCTION',
+        'msql_close' => 'FUNCTION',
+        'msql_connect' => 'FUNCTION',
+        'msql_create_db' => 'FUNCTION',
+        'msql_createdb' => 'FUNCTION',
+        'msql_data_seek' => 'FUNCTION',
+        'msql_db_query' => 'FUNCTION',
+        'msql_dbname' => 'FUNCTION',
+        'msql_drop_db' => 'FUNCTION',
+        'msql_error' => 'FUNCTION',
+        'msql_fetch_array' => 'FUNCTION',
+        'msql_fetch_field' => 'FUNCTION',
+        'msql_fetch_object' => 'FUNCTION',
+        'msql_fetch_row' => 'FUNCTION',
+        'msql_field_flags' => 'FUNCTION',
+        'msql_field_len' => 'FUNCTION',
+        'msql_field_name' => 'FUNCTION',
+        'msql_field_seek' => 'FUNCTION',
+        'msql_field_table' => 'FUNCTION',
+        'msql_field_type' => 'FUNCTION',
+        'msql_fieldflags' => 'FUNCTION',
+        'msql_fieldlen' => 'FUNCTION',
+        'msql_fieldname' => 'FUNCTION',
+        'msql_fieldtable' => 'FUNCTION',
+        'msql_fieldtype' => 'FUNCTION',
+        'msql_free_result' => 'FUNCTION',
+        'msql_list_dbs' => 'FUNCTION',
+        'msql_list_fields' => 'FUNCTION',
+        'msql_list_tables' => 'FUNCTION',
+        'msql_num_fields' => 'FUNCTION',
+        'msql_num_rows' => 'FUNCTION',
+        'msql_numfields' => 'FUNCTION',
+        'msql_numrows' => 'FUNCTION',
+        'msql_pconnect' => 'FUNCTION',
+        'msql_query' => 'FUNCTION',
+        'msql_regcase' => 'FUNCTION',
+        'msql_result' => 'FUNCTION',
+        'msql_select_db' => 'FUNCTION',
+        'msql_tablename' => 'FUNCTION',
+        'mssql_bind' => 'FUNCTION',
+        'mssql_close' => 'FUNCTION',
+        'mssql_connect' => 'FUNCTION',
+        'mssql_data_seek' => 'FUNCTION',
+        'mssql_execute' => 'FUNCTION',
+        'mssql_fetch_array' => 'FUNCTION',
+        'mssql_fetch_assoc' => 'FUNCTION',
+        'mssql_fetch_batch' => 'FUNCTION',
+        'mssql_fetch_field' => 'FUNCTION',
+        'mssql_fetch_object' => 'FUNCTION',
+        'mssql_fetch_row' => 'FUNCTION',
+        'mssql_field_length' => 'FUNCTION',
+        'mssql_field_name' => 'FUNCTION',
+        'mssql_field_seek' => 'FUNCTION',
+        'mssql_field_type' => 'FUNCTION',
+        'mssql_free_result' => 'FUNCTION',
+        'mssql_free_statement' => 'FUNCTION',
+        'mssql_get_last_message' => 'FUNCTION',
+        'mssql_guid_string' => 'FUNCTION',
+        'mssql_init' => 'FUNCTION',
+        'mssql_min_error_severity' => 'FUNCTION',
+        'mssql_min_message_severity' => 'FUNCTION',
+        'mssql_next_result' => 'FUNCTION',
+        'mssql_num_fields' => 'FUNCTION',
+        'mssql_num_rows' => 'FUNCTION',
+        'mssql_pconnect' => 'FUNCTION',
+        'mssql_query' => 'FUNCTION',
+        'mssql_result' => 'FUNCTION',
+        'mssql_rows_affected' => 'FUNCTION',
+        'mssql_select_db' => 'FUNCTION',
+        'mt_getrandmax' => 'FUNCTION',
+        'mt_rand' => 'FUNCTION',
+        'mt_srand' => 'FUNCTION',
+        'multipleiterator' => 'FUNCTION',
+        'mysql_affected_rows' => 'FUNCTION',
+        'mysql_client_encoding' => 'FUNCTION',
+        'mysql_close' => 'FUNCTION',
+        'mysql_connect' => 'FUNCTION',
+        'mysql_create_db' => 'FUNCTION',
+        'mysql_data_seek' => 'FUNCTION',
+        'mysql_db_name' => 'FUNCTION',
+        'mysql_db_query' => 'FUNCTION',
+        'mysql_drop_db' => 'FUNCTION',
+        'mysql_errno' => 'FUNCTION',
+        'mysql_error' => 'FUNCTION',
+        'mysql_escape_string' => 'FUNCTION',
+        'mysql_fetch_array' => 'FUNCTION',
+        'mysql_fetch_assoc' => 'FUNCTION',
+        'mysql_fetch_field' => 'FUNCTION',
+        'mysql_fetch_lengths' => 'FUNCTION',
+        'mysql_fetch_object' => 'FUNCTION',
+        'mysql_fetch_row' => 'FUNCTION',
+        'mysql_field_flags' => 'FUNCTION',
+        'mysql_field_len' => 'FUNCTION',
+        'mysql_field_name' => 'FUNCTION',
+        'mysql_field_seek' => 'FUNCTION',
+        'mysql_field_table' => 'FUNCTION',
+        'mysql_field_type' => 'FUNCTION',
+        'mysql_free_result' => 'FUNCTION',
+        'mysql_get_client_info' => 'FUNCTION',
+        'mysql_get_host_info' => 'FUNCTION',
+        'mysql_get_proto_info' => 'FUNCTION',
+        'mysql_get_server_info' => 'FUNCTION',
+        'mysql_info' => 'FUNCTION',
+        'mysql_insert_id' => 'FUNCTION',
+        'mysql_list_dbs' => 'FUNCTION',
+        'mysql_list_fields' => 'FUNCTION',
+        'mysql_list_processes' => 'FUNCTION',
+        'mysql_list_tables' => 'FUNCTION',
+        'mysql_num_fields' => 'FUNCTION',
+        'mysql_num_rows' => 'FUNCTION',
+        'mysql_pconnect' => 'FUNCTION',
+        'mysql_ping' => 'FUNCTION',
+        'mysql_query' => 'FUNCTION',
+        'mysql_real_escape_string' => 'FUNCTION',
+        'mysql_result' => 'FUNCTION',
+        'mysql_select_db' => 'FUNCTION',
+        'mysql_set_charset' => 'FUNCTION',
+        'mysql_stat' => 'FUNCTION',
+        'mysql_tablename' => 'FUNCTION',
+        'mysql_thread_id' => 'FUNCTION',
+        'mysql_unbuffered_query' => 'FUNCTION',
+        'mysqli' => 'FUNCTION',
+        'mysqli_bind_param' => 'FUNCTION',
+        'mysqli_bind_result' => 'FUNCTION',
+        'mysqli_client_encoding' => 'FUNCTION',
+        'mysqli_connect' => 'FUNCTION',
+        'mysqli_disable_reads_from_master' => 'FUNCTION',
+        'mysqli_disable_rpl_parse' => 'FUNCTION',
+        'mysqli_driver' => 'FUNCTION',
+        'mysqli_enable_reads_from_master' => 'FUNCTION',
+        'mysqli_enable_rpl_parse' => 'FUNCTION',
+        'mysqli_escape_string' => 'FUNCTION',
+        'mysqli_execute' => 'FUNCTION',
+        'mysqli_fetch' => 'FUNCTION',
+        'mysqli_get_metadata' => 'FUNCTION',
+        'mysqli_master_query' => 'FUNCTION',
+        'mysqli_param_count' => 'FUNCTION',
+        'mysqli_report' => 'FUNCTION',
+        'mysqli_result' => 'FUNCTION',
+        'mysqli_rpl_parse_enabled' => 'FUNCTION',
+        'mysqli_rpl_probe' => 'FUNCTION',
+        'mysqli_rpl_query_type' => 'FUNCTION',
+        'mysqli_send_long_data' => 'FUNCTION',
+        'mysqli_send_query' => 'FUNCTION',
+        'mysqli_set_opt' => 'FUNCTION',
+        'mysqli_slave_query' => 'FUNCTION',
+        'mysqli_stmt' => 'FUNCTION',
+        'mysqli_warning' => 'FUNCTION',
+        'mysqlnd_qc_change_handler' => 'FUNCTION',
+        'mysqlnd_qc_clear_cache' => 'FUNCTION',
+        'mysqlnd_qc_get_cache_info' => 'FUNCTION',
+        'mysqlnd_qc_get_core_stats' => 'FUNCTION',
+        'mysqlnd_qc_get_handler' => 'FUNCTION',
+        'mysqlnd_qc_get_query_trace_log' => 'FUNCTION',
+        'mysqlnd_qc_set_user_handlers' => 'FUNCTION',
+        'natcasesort' => 'FUNCTION',
+        'natsort' => 'FUNCTION',
+        'ncurses_addch' => 'FUNCTION',
+        'ncurses_addchnstr' => 'FUNCTION',
+        'ncurses_addchstr' => 'FUNCTION',
+        'ncurses_addnstr' => 'FUNCTION',
+        'ncurses_addstr' => 'FUNCTION',
+        'ncurses_assume_default_colors' => 'FUNCTION',
+        'ncurses_attroff' => 'FUNCTION',
+        'ncurses_attron' => 'FUNCTION',
+        'ncurses_attrset' => 'FUNCTION',
+        'ncurses_baudrate' => 'FUNCTION',
+        'ncurses_beep' => 'FUNCTION',
+        'ncurses_bkgd' => 'FUNCTION',
+        'ncurses_bkgdset' => 'FUNCTION',
+        'ncurses_border' => 'FUNCTION',
+        'ncurses_bottom_panel' => 'FUNCTION',
+        'ncurses_can_change_color' => 'FUNCTION',
+        'ncurses_cbreak' => 'FUNCTION',
+        'ncurses_clear' => 'FUNCTION',
+        'ncurses_clrtobot' => 'FUNCTION',
+        'ncurses_clrtoeol' => 'FUNCTION',
+        'ncurses_color_content' => 'FUNCTION',
+        'ncurses_color_set' => 'FUNCTION',
+        'ncurses_curs_set' => 'FUNCTION',
+        'ncurses_def_prog_mode' => 'FUNCTION',
+        'ncurses_def_shell_mode' => 'FUNCTION',
+        'ncurses_define_key' => 'FUNCTION',
+        'ncurses_del_panel' => 'FUNCTION',
+        'ncurses_delay_output' => 'FUNCTION',
+        'ncurses_delch' => 'FUNCTION',
+        'ncurses_deleteln' => 'FUNCTION',
+        'ncurses_delwin' => 'FUNCTION',
+        'ncurses_doupdate' => 'FUNCTION',
+        'ncurses_echo' => 'FUNCTION',
+        'ncurses_echochar' => 'FUNCTION',
+        'ncurses_end' => 'FUNCTION',
+        'ncurses_erase' => 'FUNCTION',
+        'ncurses_erasechar' => 'FUNCTION',
+        'ncurses_filter' => 'FUNCTION',
+        'ncurses_flash' => 'FUNCTION',
+        'ncurses_flushinp' => 'FUNCTION',
+        'ncurses_getch' => 'FUNCTION',
+        'ncurses_getmaxyx' => 'FUNCTION',
+        'ncurses_getmouse' => 'FUNCTION',
+        'ncurses_getyx' => 'FUNCTION',
+        'ncurses_halfdelay' => 'FUNCTION',
+        'ncurses_has_colors' => 'FUNCTION',
+        'ncurses_has_ic' => 'FUNCTION',
+        'ncurses_has_il' => 'FUNCTION',
+        'ncurses_has_key' => 'FUNCTION',
+        'ncurses_hide_panel' => 'FUNCTION',
+        'ncurses_hline' => 'FUNCTION',
+        'ncurses_inch' => 'FUNCTION',
+        'ncurses_init' => 'FUNCTION',
+        'ncurses_init_color' => 'FUNCTION',
+        'ncurses_init_pair' => 'FUNCTION',
+        'ncurses_insch' => 'FUNCTION',
+        'ncurses_insdelln' => 'FUNCTION',
+        'ncurses_insertln' => 'FUNCTION',
+        'ncurses_insstr' => 'FUNCTION',
+        'ncurses_instr' => 'FUNCTION',
+        'ncurses_isendwin' => 'FUNCTION',
+        'ncurses_keyok' => 'FUNCTION',
+        'ncurses_keypad' => 'FUNCTION',
+        'ncurses_killchar' => 'FUNCTION',
+        'ncurses_longname' => 'FUNCTION',
+        'ncurses_meta' => 'FUNCTION',
+        'ncurses_mouse_trafo' => 'FUNCTION',
+        'ncurses_mouseinterval' => 'FUNCTION',
+        'ncurses_mousemask' => 'FUNCTION',
+        'ncurses_move' => 'FUNCTION',
+        'ncurses_move_panel' => 'FUNCTION',
+        'ncurses_mvaddch' => 'FUNCTION',
+        'ncurses_mvaddchnstr' => 'FUNCTION',
+        'ncurses_mvaddchstr' => 'FUNCTION',
+        'ncurses_mvaddnstr' => 'FUNCTION',
+        'ncurses_mvaddstr' => 'FUNCTION',
+        'ncurses_mvcur' => 'FUNCTION',
+        'ncurses_mvdelch' => 'FUNCTION',
+        'ncurses_mvgetch' => 'FUNCTION',
+        'ncurses_mvhline' => 'FUNCTION',
+        'ncurses_mvinch' => 'FUNCTION',
+        'ncurses_mvvline' => 'FUNCTION',
+        'ncurses_mvwaddstr' => 'FUNCTION',
+        'ncurses_napms' => 'FUNCTION',
+        'ncurses_new_panel' => 'FUNCTION',
+        'ncurses_newpad' => 'FUNCTION',
+        'ncurses_newwin' => 'FUNCTION',
+        'ncurses_nl' => 'FUNCTION',
+        'ncurses_nocbreak' => 'FUNCTION',
+        'ncurses_noecho' => 'FUNCTION',
+        'ncurses_nonl' => 'FUNCTION',
+        'ncurses_noqiflush' => 'FUNCTION',
+        'ncurses_noraw' => 'FUNCTION',
+        'ncurses_pair_content' => 'FUNCTION',
+        'ncurses_panel_above' => 'FUNCTION',
+        'ncurses_panel_below' => 'FUNCTION',
+        'ncurses_panel_window' => 'FUNCTION',
+        'ncurses_pnoutrefresh' => 'FUNCTION',
+        'ncurses_prefresh' => 'FUNCTION',
+        'ncurses_putp' => 'FUNCTION',
+        'ncurses_qiflush' => 'FUNCTION',
+        'ncurses_raw' => 'FUNCTION',
+        'ncurses_refresh' => 'FUNCTION',
+        'ncurses_replace_panel' => 'FUNCTION',
+        'ncurses_reset_prog_mode' => 'FUNCTION',
+        'ncurses_reset_shell_mode' => 'FUNCTION',
+        'ncurses_resetty' => 'FUNCTION',
+        'ncurses_savetty' => 'FUNCTION',
+        'ncurses_scr_dump' => 'FUNCTION',
+        'ncurses_scr_init' => 'FUNCTION',
+        'ncurses_scr_restore' => 'FUNCTION',
+        'ncurses_scr_set' => 'FUNCTION',
+        'ncurses_scrl' => 'FUNCTION',
+        'ncurses_show_panel' => 'FUNCTION',
+        'ncurses_slk_attr' => 'FUNCTION',
+        'ncurses_slk_attroff' => 'FUNCTION',
+        'ncurses_slk_attron' => 'FUNCTION',
+        'ncurses_slk_attrset' => 'FUNCTION',
+        'ncurses_slk_clear' => 'FUNCTION',
+        'ncurses_slk_color' => 'FUNCTION',
+        'ncurses_slk_init' => 'FUNCTION',
+        'ncurses_slk_noutrefresh' => 'FUNCTION',
+        'ncurses_slk_refresh' => 'FUNCTION',
+        'ncurses_slk_restore' => 'FUNCTION',
+        'ncurses_slk_set' => 'FUNCTION',
+        'ncurses_slk_touch' => 'FUNCTION',
+        'ncurses_standend' => 'FUNCTION',
+        'ncurses_standout' => 'FUNCTION',
+        'ncurses_start_color' => 'FUNCTION',
+        'ncurses_termattrs' => 'FUNCTION',
+        'ncurses_termname' => 'FUNCTION',
+        'ncurses_timeout' => 'FUNCTION',
+        'ncurses_top_panel' => 'FUNCTION',
+        'ncurses_typeahead' => 'FUNCTION',
+        'ncurses_ungetch' => 'FUNCTION',
+        'ncurses_ungetmouse' => 'FUNCTION',
+        'ncurses_update_panels' => 'FUNCTION',
+        'ncurses_use_default_colors' => 'FUNCTION',
+        'ncurses_use_env' => 'FUNCTION',
+        'ncurses_use_extended_names' => 'FUNCTION',
+        'ncurses_vidattr' => 'FUNCTION',
+        'ncurses_vline' => 'FUNCTION',
+        'ncurses_waddch' => 'FUNCTION',
+        'ncurses_waddstr' => 'FUNCTION',
+        'ncurses_wattroff' => 'FUNCTION',
+        'ncurses_wattron' => 'FUNCTION',
+        'ncurses_wattrset' => 'FUNCTION',
+        'ncurses_wborder' => 'FUNCTION',
+        'ncurses_wclear' => 'FUNCTION',
+        'ncurses_wcolor_set' => 'FUNCTION',
+        'ncurses_werase' => 'FUNCTION',
+        'ncurses_wgetch' => 'FUNCTION',
+        'ncurses_whline' => 'FUNCTION',
+        'ncurses_wmouse_trafo' => 'FUNCTION',
+        'ncurses_wmove' => 'FUNCTION',
+        'ncurses_wnoutrefresh' => 'FUNCTION',
+        'ncurses_wrefresh' => 'FUNCTION',
+        'ncurses_wstandend' => 'FUNCTION',
+        'ncurses_wstandout' => 'FUNCTION',
+        'ncurses_wvline' => 'FUNCTION',
+        'newinstance' => 'FUNCTION',
+        'newinstanceargs' => 'FUNCTION',
+        'newt_bell' => 'FUNCTION',
+        'newt_button' => 'FUNCTION',
+        'newt_button_bar' => 'FUNCTION',
+        'newt_centered_window' => 'FUNCTION',
+        'newt_checkbox' => 'FUNCTION',
+        'newt_checkbox_get_value' => 'FUNCTION',
+        'newt_checkbox_set_flags' => 'FUNCTION',
+        'newt_checkbox_set_value' => 'FUNCTION',
+        'newt_checkbox_tree' => 'FUNCTION',
+        'newt_checkbox_tree_add_item' => 'FUNCTION',
+        'newt_checkbox_tree_find_item' => 'FUNCTION',
+        'newt_checkbox_tree_get_current' => 'FUNCTION',
+        'newt_checkbox_tree_get_entry_value' => 'FUNCTION',
+        'newt_checkbox_tree_get_multi_selection' => 'FUNCTION',
+        'newt_checkbox_tree_get_selection' => 'FUNCTION',
+        'newt_checkbox_tree_multi' => 'FUNCTION',
+        'newt_checkbox_tree_set_current' => 'FUNCTION',
+        'newt_checkbox_tree_set_entry' => 'FUNCTION',
+        'newt_checkbox_tree_set_entry_value' => 'FUNCTION',
+        'newt_checkbox_tree_set_width' => 'FUNCTION',
+        'newt_clear_key_buffer' => 'FUNCTION',
+        'newt_cls' => 'FUNCTION',
+        'newt_compact_button' => 'FUNCTION',
+        'newt_component_add_callback' => 'FUNCTION',
+        'newt_component_takes_focus' => 'FUNCTION',
+        'newt_create_grid' => 'FUNCTION',
+        'newt_cursor_off' => 'FUNCTION',
+        'newt_cursor_on' => 'FUNCTION',
+        'newt_delay' => 'FUNCTION',
+        'newt_draw_form' => 'FUNCTION',
+        'newt_draw_root_text' => 'FUNCTION',
+        'newt_entry' => 'FUNCTION',
+        'newt_entry_get_value' => 'FUNCTION',
+        'newt_entry_set' => 'FUNCTION',
+        'newt_entry_set_filter' => 'FUNCTION',
+        'newt_entry_set_flags' => 'FUNCTION',
+        'newt_finished' => 'FUNCTION',
+        'newt_form' => 'FUNCTION',
+        'newt_form_add_component' => 'FUNCTION',
+        'newt_form_add_components' => 'FUNCTION',
+        'newt_form_add_hot_key' => 'FUNCTION',
+        'newt_form_destroy' => 'FUNCTION',
+        'newt_form_get_current' => 'FUNCTION',
+        'newt_form_run' => 'FUNCTION',
+        'newt_form_set_background' => 'FUNCTION',
+        'newt_form_set_height' => 'FUNCTION',
+        'newt_form_set_size' => 'FUNCTION',
+        'newt_form_set_timer' => 'FUNCTION',
+        'newt_form_set_width' => 'FUNCTION',
+        'newt_form_watch_fd' => 'FUNCTION',
+        'newt_get_screen_size' => 'FUNCTION',
+        'newt_grid_add_components_to_form' => 'FUNCTION',
+        'newt_grid_basic_window' => 'FUNCTION',
+        'newt_grid_free' => 'FUNCTION',
+        'newt_grid_get_size' => 'FUNCTION',
+        'newt_grid_h_close_stacked' => 'FUNCTION',
+        'newt_grid_h_stacked' => 'FUNCTION',
+        'newt_grid_place' => 'FUNCTION',
+        'newt_grid_set_field' => 'FUNCTION',
+        'newt_grid_simple_window' => 'FUNCTION',
+        'newt_grid_v_close_stacked' => 'FUNCTION',
+        'newt_grid_v_stacked' => 'FUNCTION',
+        'newt_grid_wrapped_window' => 'FUNCTION',
+        'newt_grid_wrapped_window_at' => 'FUNCTION',
+        'newt_init' => 'FUNCTION',
+        'newt_label' => 'FUNCTION',
+        'newt_label_set_text' => 'FUNCTION',
+        'newt_listbox' => 'FUNCTION',
+        'newt_listbox_append_entry' => 'FUNCTION',
+        'newt_listbox_clear' => 'FUNCTION',
+        'newt_listbox_clear_selection' => 'FUNCTION',
+        'newt_listbox_delete_entry' => 'FUNCTION',
+        'newt_listbox_get_current' => 'FUNCTION',
+        'newt_listbox_get_selection' => 'FUNCTION',
+        'newt_listbox_insert_entry' => 'FUNCTION',
+        'newt_listbox_item_count' => 'FUNCTION',
+        'newt_listbox_select_item' => 'FUNCTION',
+        'newt_listbox_set_current' => 'FUNCTION',
+        'newt_listbox_set_current_by_key' => 'FUNCTION',
+        'newt_listbox_set_data' => 'FUNCTION',
+        'newt_listbox_set_entry' => 'FUNCTION',
+        'newt_listbox_set_width' => 'FUNCTION',
+        'newt_listitem' => 'FUNCTION',
+        'newt_listitem_get_data' => 'FUNCTION',
+        'newt_listitem_set' => 'FUNCTION',
+        'newt_open_window' => 'FUNCTION',
+        'newt_pop_help_line' => 'FUNCTION',
+        'newt_pop_window' => 'FUNCTION',
+        'newt_push_help_line' => 'FUNCTION',
+        'newt_radio_get_current' => 'FUNCTION',
+        'newt_radiobutton' => 'FUNCTION',
+        'newt_redraw_help_line' => 'FUNCTION',
+        'newt_reflow_text' => 'FUNCTION',
+        'newt_refresh' => 'FUNCTION',
+        'newt_resize_screen' => 'FUNCTION',
+        'newt_resume' => 'FUNCTION',
+        'newt_run_form' => 'FUNCTION',
+        'newt_scale' => 'FUNCTION',
+        'newt_scale_set' => 'FUNCTION',
+        'newt_scrollbar_set' => 'FUNCTION',
+        'newt_set_help_callback' => 'FUNCTION',
+        'newt_set_suspend_callback' => 'FUNCTION',
+        'newt_suspend' => 'FUNCTION',
+        'newt_textbox' => 'FUNCTION',
+        'newt_textbox_get_num_lines' => 'FUNCTION',
+        'newt_textbox_reflowed' => 'FUNCTION',
+        'newt_textbox_set_height' => 'FUNCTION',
+        'newt_textbox_set_text' => 'FUNCTION',
+        'newt_vertical_scrollbar' => 'FUNCTION',
+        'newt_wait_for_key' => 'FUNCTION',
+        'newt_win_choice' => 'FUNCTION',
+        'newt_win_entries' => 'FUNCTION',
+        'newt_win_menu' => 'FUNCTION',
+        'newt_win_message' => 'FUNCTION',
+        'newt_win_messagev' => 'FUNCTION',
+        'newt_win_ternary' => 'FUNCTION',
+        'next' => 'FUNCTION',
+        'ngettext' => 'FUNCTION',
+        'nl2br' => 'FUNCTION',
+        'nl_langinfo' => 'FUNCTION',
+        'norewinditerator' => 'FUNCTION',
+        'normalizer' => 'FUNCTION',
+        'notes_body' => 'FUNCTION',
+        'notes_copy_db' => 'FUNCTION',
+        'notes_create_db' => 'FUNCTION',
+        'notes_create_note' => 'FUNCTION',
+        'notes_drop_db' => 'FUNCTION',
+        'notes_find_note' => 'FUNCTION',
+        'notes_header_info' => 'FUNCTION',
+        'notes_list_msgs' => 'FUNCTION',
+        'notes_mark_read' => 'FUNCTION',
+        'notes_mark_unread' => 'FUNCTION',
+        'notes_nav_create' => 'FUNCTION',
+        'notes_search' => 'FUNCTION',
+        'notes_unread' => 'FUNCTION',
+        'notes_version' => 'FUNCTION',
+        'nsapi_request_headers' => 'FUNCTION',
+        'nsapi_response_headers' => 'FUNCTION',
+        'nsapi_virtual' => 'FUNCTION',
+        'nthmac' => 'FUNCTION',
+        'number_format' => 'FUNCTION',
+        'numberformatter' => 'FUNCTION',
+        'oauth' => 'FUNCTION',
+        'oauth_get_sbs' => 'FUNCTION',
+        'oauth_urlencode' => 'FUNCTION',
+        'oauthexception' => 'FUNCTION',
+        'oauthprovider' => 'FUNCTION',
+        'ob_clean' => 'FUNCTION',
+        'ob_deflatehandler' => 'FUNCTION',
+        'ob_end_clean' => 'FUNCTION',
+        'ob_end_flush' => 'FUNCTION',
+        'ob_etaghandler' => 'FUNCTION',
+        'ob_flush' => 'FUNCTION',
+        'ob_get_clean' => 'FUNCTION',
+        'ob_get_contents' => 'FUNCTION',
+        'ob_get_flush' => 'FUNCTION',
+        'ob_get_length' => 'FUNCTION',
+        'ob_get_level' => 'FUNCTION',
+        'ob_get_status' => 'FUNCTION',
+        'ob_gzhandler' => 'FUNCTION',
+        'ob_iconv_handler' => 'FUNCTION',
+        'ob_implicit_flush' => 'FUNCTION',
+        'ob_inflatehandler' => 'FUNCTION',
+        'ob_list_handlers' => 'FUNCTION',
+        'ob_start' => 'FUNCTION',
+        'ob_tidyhandler' => 'FUNCTION',
+        'oci_bind_array_by_name' => 'FUNCTION',
+        'oci_bind_by_name' => 'FUNCTION',
+        'oci_cancel' => 'FUNCTION',
+        'oci_close' => 'FUNCTION',
+        'oci_collection_append' => 'FUNCTION',
+        'oci_collection_assign' => 'FUNCTION',
+        'oci_collection_element_assign' => 'FUNCTION',
+        'oci_collection_element_get' => 'FUNCTION',
+        'oci_collection_free' => 'FUNCTION',
+        'oci_collection_max' => 'FUNCTION',
+        'oci_collection_size' => 'FUNCTION',
+        'oci_collection_trim' => 'FUNCTION',
+        'oci_commit' => 'FUNCTION',
+        'oci_connect' => 'FUNCTION',
+        'oci_define_by_name' => 'FUNCTION',
+        'oci_error' => 'FUNCTION',
+        'oci_execute' => 'FUNCTION',
+        'oci_fetch' => 'FUNCTION',
+        'oci_fetch_all' => 'FUNCTION',
+        'oci_fetch_array' => 'FUNCTION',
+        'oci_fetch_assoc' => 'FUNCTION',
+        'oci_fetch_object' => 'FUNCTION',
+        'oci_fetch_row' => 'FUNCTION',
+        'oci_field_is_null' => 'FUNCTION',
+        'oci_field_name' => 'FUNCTION',
+        'oci_field_precision' => 'FUNCTION',
+        'oci_field_scale' => 'FUNCTION',
+        'oci_field_size' => 'FUNCTION',
+        'oci_field_type' => 'FUNCTION',
+        'oci_field_type_raw' => 'FUNCTION',
+        'oci_free_statement' => 'FUNCTION',
+        'oci_internal_debug' => 'FUNCTION',
+        'oci_lob_append' => 'FUNCTION',
+        'oci_lob_close' => 'FUNCTION',
+        'oci_lob_copy' => 'FUNCTION',
+        'oci_lob_eof' => 'FUNCTION',
+        'oci_lob_erase' => 'FUNCTION',
+        'oci_lob_export' => 'FUNCTION',
+        'oci_lob_flush' => 'FUNCTION',
+        'oci_lob_free' => 'FUNCTION',
+        'oci_lob_getbuffering' => 'FUNCTION',
+        'oci_lob_import' => 'FUNCTION',
+        'oci_lob_is_equal' => 'FUNCTION',
+        'oci_lob_load' => 'FUNCTION',
+        'oci_lob_read' => 'FUNCTION',
+        'oci_lob_rewind' => 'FUNCTION',
+        'oci_lob_save' => 'FUNCTION',
+        'oci_lob_savefile' => 'FUNCTION',
+        'oci_lob_seek' => 'FUNCTION',
+        'oci_lob_setbuffering' => 'FUNCTION',
+        'oci_lob_size' => 'FUNCTION',
+        'oci_lob_tell' => 'FUNCTION',
+        'oci_lob_truncate' => 'FUNCTION',
+        'oci_lob_write' => 'FUNCTION',
+        'oci_lob_writetemporary' => 'FUNCTION',
+        'oci_lob_writetofile' => 'FUNCTION',
+        'oci_new_collection' => 'FUNCTION',
+        'oci_new_connect' => 'FUNCTION',
+        'oci_new_cursor' => 'FUNCTION',
+        'oci_new_descriptor' => 'FUNCTION',
+        'oci_num_fields' => 'FUNCTION',
+        'oci_num_rows' => 'FUNCTION',
+        'oci_parse' => 'FUNCTION',
+        'oci_password_change' => 'FUNCTION',
+        'oci_pconnect' => 'FUNCTION',
+        'oci_result' => 'FUNCTION',
+        'oci_rollback' => 'FUNCTION',
+        'oci_server_version' => 'FUNCTION',
+        'oci_set_action' => 'FUNCTION',
+        'oci_set_client_identifier' => 'FUNCTION',
+        'oci_set_client_info' => 'FUNCTION',
+        'oci_set_edition' => 'FUNCTION',
+        'oci_set_module_name' => 'FUNCTION',
+        'oci_set_prefetch' => 'FUNCTION',
+        'oci_statement_type' => 'FUNCTION',
+        'ocibindbyname' => 'FUNCTION',
+        'ocicancel' => 'FUNCTION',
+        'ocicloselob' => 'FUNCTION',
+        'ocicollappend' => 'FUNCTION',
+        'ocicollassign' => 'FUNCTION',
+        'ocicollassignelem' => 'FUNCTION',
+        'ocicollgetelem' => 'FUNCTION',
+        'ocicollmax' => 'FUNCTION',
+        'ocicollsize' => 'FUNCTION',
+        'ocicolltrim' => 'FUNCTION',
+        'ocicolumnisnull' => 'FUNCTION',
+        'ocicolumnname' => 'FUNCTION',
+        'ocicolumnprecision' => 'FUNCTION',
+        'ocicolumnscale' => 'FUNCTION',
+        'ocicolumnsize' => 'FUNCTION',
+        'ocicolumntype' => 'FUNCTION',
+        'ocicolumntyperaw' => 'FUNCTION',
+        'ocicommit' => 'FUNCTION',
+        'ocidefinebyname' => 'FUNCTION',
+        'ocierror' => 'FUNCTION',
+        'ociexecute' => 'FUNCTION',
+        'ocifetch' => 'FUNCTION',
+        'ocifetchinto' => 'FUNCTION',
+        'ocifetchstatement' => 'FUNCTION',
+        'ocifreecollection' => 'FUNCTION',
+        'ocifreecursor' => 'FUNCTION',
+        'ocifreedesc' => 'FUNCTION',
+        'ocifreestatement' => 'FUNCTION',
+        'ociinternaldebug' => 'FUNCTION',
+        'ociloadlob' => 'FUNCTION',
+        'ocilogoff' => 'FUNCTION',
+        'ocilogon' => 'FUNCTION',
+        'ocinewcollection' => 'FUNCTION',
+        'ocinewcursor' => 'FUNCTION',
+        'ocinewdescriptor' => 'FUNCTION',
+        'ocinlogon' => 'FUNCTION',
+        'ocinumcols' => 'FUNCTION',
+        'ociparse' => 'FUNCTION',
+        'ociplogon' => 'FUNCTION',
+        'ociresult' => 'FUNCTION',
+        'ocirollback' => 'FUNCTION',
+        'ocirowcount' => 'FUNCTION',
+        'ocisavelob' => 'FUNCTION',
+        'ocisavelobfile' => 'FUNCTION',
+        'ociserverversion' => 'FUNCTION',
+        'ocisetprefetch' => 'FUNCTION',
+        'ocistatementtype' => 'FUNCTION',
+        'ociwritelobtofile' => 'FUNCTION',
+        'ociwritetemporarylob' => 'FUNCTION',
+        'octdec' => 'FUNCTION',
+        'odbc_autocommit' => 'FUNCTION',
+        'odbc_binmode' => 'FUNCTION',
+        'odbc_close' => 'FUNCTION',
+        'odbc_close_all' => 'FUNCTION',
+        'odbc_columnprivileges' => 'FUNCTION',
+        'odbc_columns' => 'FUNCTION',
+        'odbc_commit' => 'FUNCTION',
+        'odbc_connect' => 'FUNCTION',
+        'odbc_cursor' => 'FUNCTION',
+        'odbc_data_source' => 'FUNCTION',
+        'odbc_do' => 'FUNCTION',
+        'odbc_error' => 'FUNCTION',
+        'odbc_errormsg' => 'FUNCTION',
+        'odbc_exec' => 'FUNCTION',
+        'odbc_execute' => 'FUNCTION',
+        'odbc_fetch_array' => 'FUNCTION',
+        'odbc_fetch_into' => 'FUNCTION',
+        'odbc_fetch_object' => 'FUNCTION',
+        'odbc_fetch_row' => 'FUNCTION',
+        'odbc_field_len' => 'FUNCTION',
+        'odbc_field_name' => 'FUNCTION',
+        'odbc_field_num' => 'FUNCTION',
+        'odbc_field_precision' => 'FUNCTION',
+        'odbc_field_scale' => 'FUNCTION',
+        'odbc_field_type' => 'FUNCTION',
+        'odbc_foreignkeys' => 'FUNCTION',
+        'odbc_free_result' => 'FUNCTION',
+        'odbc_gettypeinfo' => 'FUNCTION',
+        'odbc_longreadlen' => 'FUNCTION',
+        'odbc_next_result' => 'FUNCTION',
+        'odbc_num_fields' => 'FUNCTION',
+        'odbc_num_rows' => 'FUNCTION',
+        'odbc_pconnect' => 'FUNCTION',
+        'odbc_prepare' => 'FUNCTION',
+        'odbc_primarykeys' => 'FUNCTION',
+        'odbc_procedurecolumns' => 'FUNCTION',
+        'odbc_procedures' => 'FUNCTION',
+        'odbc_result' => 'FUNCTION',
+        'odbc_result_all' => 'FUNCTION',
+        'odbc_rollback' => 'FUNCTION',
+        'odbc_setoption' => 'FUNCTION',
+        'odbc_specialcolumns' => 'FUNCTION',
+        'odbc_statistics' => 'FUNCTION',
+        'odbc_tableprivileges' => 'FUNCTION',
+        'odbc_tables' => 'FUNCTION',
+        'openal_buffer_create' => 'FUNCTION',
+        'openal_buffer_data' => 'FUNCTION',
+        'openal_buffer_destroy' => 'FUNCTION',
+        'openal_buffer_get' => 'FUNCTION',
+        'openal_buffer_loadwav' => 'FUNCTION',
+        'openal_context_create' => 'FUNCTION',
+        'openal_context_current' => 'FUNCTION',
+        'openal_context_destroy' => 'FUNCTION',
+        'openal_context_process' => 'FUNCTION',
+        'openal_context_suspend' => 'FUNCTION',
+        'openal_device_close' => 'FUNCTION',
+        'openal_device_open' => 'FUNCTION',
+        'openal_listener_get' => 'FUNCTION',
+        'openal_listener_set' => 'FUNCTION',
+        'openal_source_create' => 'FUNCTION',
+        'openal_source_destroy' => 'FUNCTION',
+        'openal_source_get' => 'FUNCTION',
+        'openal_source_pause' => 'FUNCTION',
+        'openal_source_play' => 'FUNCTION',
+        'openal_source_rewind' => 'FUNCTION',
+        'openal_source_set' => 'FUNCTION',
+        'openal_source_stop' => 'FUNCTION',
+        'openal_stream' => 'FUNCTION',
+        'opendir' => 'FUNCTION',
+        'openlog' => 'FUNCTION',
+        'openssl_csr_export' => 'FUNCTION',
+        'openssl_csr_export_to_file' => 'FUNCTION',
+        'openssl_csr_get_public_key' => 'FUNCTION',
+        'openssl_csr_get_subject' => 'FUNCTION',
+        'openssl_csr_new' => 'FUNCTION',
+        'openssl_csr_sign' => 'FUNCTION',
+        'openssl_decrypt' => 'FUNCTION',
+        'openssl_dh_compute_key' => 'FUNCTION',
+        'openssl_digest' => 'FUNCTION',
+        'openssl_encrypt' => 'FUNCTION',
+        'openssl_error_string' => 'FUNCTION',
+        'openssl_free_key' => 'FUNCTION',
+        'openssl_get_cipher_methods' => 'FUNCTION',
+        'openssl_get_md_methods' => 'FUNCTION',
+        'openssl_get_privatekey' => 'FUNCTION',
+        'openssl_get_publickey' => 'FUNCTION',
+        'openssl_open' => 'FUNCTION',
+        'openssl_pkcs12_export' => 'FUNCTION',
+        'openssl_pkcs12_export_to_file' => 'FUNCTION',
+        'openssl_pkcs12_read' => 'FUNCTION',
+        'openssl_pkcs7_decrypt' => 'FUNCTION',
+        'openssl_pkcs7_encrypt' => 'FUNCTION',
+        'openssl_pkcs7_sign' => 'FUNCTION',
+        'openssl_pkcs7_verify' => 'FUNCTION',
+        'openssl_pkey_export' => 'FUNCTION',
+        'openssl_pkey_export_to_file' => 'FUNCTION',
+        'openssl_pkey_free' => 'FUNCTION',
+        'openssl_pkey_get_details' => 'FUNCTION',
+        'openssl_pkey_get_private' => 'FUNCTION',
+        'openssl_pkey_get_public' => 'FUNCTION',
+        'openssl_pkey_new' => 'FUNCTION',
+        'openssl_private_decrypt' => 'FUNCTION',
+        'openssl_private_encrypt' => 'FUNCTION',
+        'openssl_public_decrypt' => 'FUNCTION',
+        'openssl_public_encrypt' => 'FUNCTION',
+        'openssl_random_pseudo_bytes' => 'FUNCTION',
+        'openssl_seal' => 'FUNCTION',
+        'openssl_sign' => 'FUNCTION',
+        'openssl_verify' => 'FUNCTION',
+        'openssl_x509_check_private_key' => 'FUNCTION',
+        'openssl_x509_checkpurpose' => 'FUNCTION',
+        'openssl_x509_export' => 'FUNCTION',
+        'openssl_x509_export_to_file' => 'FUNCTION',
+        'openssl_x509_free' => 'FUNCTION',
+        'openssl_x509_parse' => 'FUNCTION',
+        'openssl_x509_read' => 'FUNCTION',
+        'ord' => 'FUNCTION',
+        'outeriterator' => 'FUNCTION',
+        'outofboundsexception' => 'FUNCTION',
+        'outofrangeexception' => 'FUNCTION',
+        'output_add_rewrite_var' => 'FUNCTION',
+        'output_reset_rewrite_vars' => 'FUNCTION',
+        'overflowexception' => 'FUNCTION',
+        'overload' => 'FUNCTION',
+        'override_function' => 'FUNCTION',
+        'ovrimos_close' => 'FUNCTION',
+        'ovrimos_commit' => 'FUNCTION',
+        'ovrimos_connect' => 'FUNCTION',
+        'ovrimos_cursor' => 'FUNCTION',
+        'ovrimos_exec' => 'FUNCTION',
+        'ovrimos_execute' => 'FUNCTION',
+        'ovrimos_fetch_into' => 'FUNCTION',
+        'ovrimos_fetch_row' => 'FUNCTION',
+        'ovrimos_field_len' => 'FUNCTION',
+        'ovrimos_field_name' => 'FUNCTION',
+        'ovrimos_field_num' => 'FUNCTION',
+        'ovrimos_field_type' => 'FUNCTION',
+        'ovrimos_free_result' => 'FUNCTION',
+        'ovrimos_longreadlen' => 'FUNCTION',
+        'ovrimos_num_fields' => 'FUNCTION',
+        'ovrimos_num_rows' => 'FUNCTION',
+        'ovrimos_prepare' => 'FUNCTION',
+        'ovrimos_result' => 'FUNCTION',
+        'ovrimos_result_all' => 'FUNCTION',
+        'ovrimos_rollback' => 'FUNCTION',
+        'pack' => 'FUNCTION',
+        'parentiterator' => 'FUNCTION',
+        'parse_ini_file' => 'FUNCTION',
+        'parse_ini_string' => 'FUNCTION',
+        'parse_str' => 'FUNCTION',
+        'parse_url' => 'FUNCTION',
+        'parsekit_compile_file' => 'FUNCTION',
+        'parsekit_compile_string' => 'FUNCTION',
+        'parsekit_func_arginfo' => 'FUNCTION',
+        'passthru' => 'FUNCTION',
+        'pathinfo' => 'FUNCTION',
+        'pclose' => 'FUNCTION',
+        'pcntl_alarm' => 'FUNCTION',
+        'pcntl_exec' => 'FUNCTION',
+        'pcntl_fork' => 'FUNCTION',
+        'pcntl_getpriority' => 'FUNCTION',
+        'pcntl_setpriority' => 'FUNCTION',
+        'pcntl_signal' => 'FUNCTION',
+        'pcntl_signal_dispatch' => 'FUNCTION',
+        'pcntl_sigprocmask' => 'FUNCTION',
+        'pcntl_sigtimedwait' => 'FUNCTION',
+        'pcntl_sigwaitinfo' => 'FUNCTION',
+        'pcntl_wait' => 'FUNCTION',
+        'pcntl_waitpid' => 'FUNCTION',
+        'pcntl_wexitstatus' => 'FUNCTION',
+        'pcntl_wifexited' => 'FUNCTION',
+        'pcntl_wifsignaled' => 'FUNCTION',
+        'pcntl_wifstopped' => 'FUNCTION',
+        'pcntl_wstopsig' => 'FUNCTION',
+        'pcntl_wtermsig' => 'FUNCTION',
+        'pdf_activate_item' => 'FUNCTION',
+        'pdf_add_annotation' => 'FUNCTION',
+        'pdf_add_bookmark' => 'FUNCTION',
+        'pdf_add_launchlink' => 'FUNCTION',
+        'pdf_add_locallink' => 'FUNCTION',
+        'pdf_add_nameddest' => 'FUNCTION',
+        'pdf_add_note' => 'FUNCTION',
+        'pdf_add_outline' => 'FUNCTION',
+        'pdf_add_pdflink' => 'FUNCTION',
+        'pdf_add_table_cell' => 'FUNCTION',
+        'pdf_add_textflow' => 'FUNCTION',
+        'pdf_add_thumbnail' => 'FUNCTION',
+        'pdf_add_weblink' => 'FUNCTION',
+        'pdf_arc' => 'FUNCTION',
+        'pdf_arcn' => 'FUNCTION',
+        'pdf_attach_file' => 'FUNCTION',
+        'pdf_begin_document' => 'FUNCTION',
+        'pdf_begin_font' => 'FUNCTION',
+        'pdf_begin_glyph' => 'FUNCTION',
+        'pdf_begin_item' => 'FUNCTION',
+        'pdf_begin_layer' => 'FUNCTION',
+        'pdf_begin_page' => 'FUNCTION',
+        'pdf_begin_page_ext' => 'FUNCTION',
+        'pdf_begin_pattern' => 'FUNCTION',
+        'pdf_begin_template' => 'FUNCTION',
+        'pdf_begin_template_ext' => 'FUNCTION',
+        'pdf_circle' => 'FUNCTION',
+        'pdf_clip' => 'FUNCTION',
+        'pdf_close' => 'FUNCTION',
+        'pdf_close_image' => 'FUNCTION',
+        'pdf_close_pdi' => 'FUNCTION',
+        'pdf_close_pdi_page' => 'FUNCTION',
+        'pdf_closepath' => 'FUNCTION',
+        'pdf_closepath_fill_stroke' => 'FUNCTION',
+        'pdf_closepath_stroke' => 'FUNCTION',
+        'pdf_concat' => 'FUNCTION',
+        'pdf_continue_text' => 'FUNCTION',
+        'pdf_create_3dview' => 'FUNCTION',
+        'pdf_create_action' => 'FUNCTION',
+        'pdf_create_annotation' => 'FUNCTION',
+        'pdf_create_bookmark' => 'FUNCTION',
+        'pdf_create_field' => 'FUNCTION',
+        'pdf_create_fieldgroup' => 'FUNCTION',
+        'pdf_create_gstate' => 'FUNCTION',
+        'pdf_create_pvf' => 'FUNCTION',
+        'pdf_create_textflow' => 'FUNCTION',
+        'pdf_curveto' => 'FUNCTION',
+        'pdf_define_layer' => 'FUNCTION',
+        'pdf_delete' => 'FUNCTION',
+        'pdf_delete_pvf' => 'FUNCTION',
+        'pdf_delete_table' => 'FUNCTION',
+        'pdf_delete_textflow' => 'FUNCTION',
+        'pdf_encoding_set_char' => 'FUNCTION',
+        'pdf_end_document' => 'FUNCTION',
+        'pdf_end_font' => 'FUNCTION',
+        'pdf_end_glyph' => 'FUNCTION',
+        'pdf_end_item' => 'FUNCTION',
+        'pdf_end_layer' => 'FUNCTION',
+        'pdf_end_page' => 'FUNCTION',
+        'pdf_end_page_ext' => 'FUNCTION',
+        'pdf_end_pattern' => 'FUNCTION',
+        'pdf_end_template' => 'FUNCTION',
+        'pdf_endpath' => 'FUNCTION',
+        'pdf_fill' => 'FUNCTION',
+        'pdf_fill_imageblock' => 'FUNCTION',
+        'pdf_fill_pdfblock' => 'FUNCTION',
+        'pdf_fill_stroke' => 'FUNCTION',
+        'pdf_fill_textblock' => 'FUNCTION',
+        'pdf_findfont' => 'FUNCTION',
+        'pdf_fit_image' => 'FUNCTION',
+        'pdf_fit_pdi_page' => 'FUNCTION',
+        'pdf_fit_table' => 'FUNCTION',
+        'pdf_fit_textflow' => 'FUNCTION',
+        'pdf_fit_textline' => 'FUNCTION',
+        'pdf_get_apiname' => 'FUNCTION',
+        'pdf_get_buffer' => 'FUNCTION',
+        'pdf_get_errmsg' => 'FUNCTION',
+        'pdf_get_errnum' => 'FUNCTION',
+        'pdf_get_font' => 'FUNCTION',
+        'pdf_get_fontname' => 'FUNCTION',
+        'pdf_get_fontsize' => 'FUNCTION',
+        'pdf_get_image_height' => 'FUNCTION',
+        'pdf_get_image_width' => 'FUNCTION',
+        'pdf_get_majorversion' => 'FUNCTION',
+        'pdf_get_minorversion' => 'FUNCTION',
+        'pdf_get_parameter' => 'FUNCTION',
+        'pdf_get_pdi_parameter' => 'FUNCTION',
+        'pdf_get_pdi_value' => 'FUNCTION',
+        'pdf_get_value' => 'FUNCTION',
+        'pdf_info_font' => 'FUNCTION',
+        'pdf_info_matchbox' => 'FUNCTION',
+        'pdf_info_table' => 'FUNCTION',
+        'pdf_info_textflow' => 'FUNCTION',
+        'pdf_info_textline' => 'FUNCTION',
+        'pdf_initgraphics' => 'FUNCTION',
+        'pdf_lineto' => 'FUNCTION',
+        'pdf_load_3ddata' => 'FUNCTION',
+        'pdf_load_font' => 'FUNCTION',
+        'pdf_load_iccprofile' => 'FUNCTION',
+        'pdf_load_image' => 'FUNCTION',
+        'pdf_makespotcolor' => 'FUNCTION',
+        'pdf_moveto' => 'FUNCTION',
+        'pdf_new' => 'FUNCTION',
+        'pdf_open_ccitt' => 'FUNCTION',
+        'pdf_open_file' => 'FUNCTION',
+        'pdf_open_gif' => 'FUNCTION',
+        'pdf_open_image' => 'FUNCTION',
+        'pdf_open_image_file' => 'FUNCTION',
+        'pdf_open_jpeg' => 'FUNCTION',
+        'pdf_open_memory_image' => 'FUNCTION',
+        'pdf_open_pdi' => 'FUNCTION',
+        'pdf_open_pdi_document' => 'FUNCTION',
+        'pdf_open_pdi_page' => 'FUNCTION',
+        'pdf_open_tiff' => 'FUNCTION',
+        'pdf_pcos_get_number' => 'FUNCTION',
+        'pdf_pcos_get_stream' => 'FUNCTION',
+        'pdf_pcos_get_string' => 'FUNCTION',
+        'pdf_place_image' => 'FUNCTION',
+        'pdf_place_pdi_page' => 'FUNCTION',
+        'pdf_process_pdi' => 'FUNCTION',
+        'pdf_rect' => 'FUNCTION',
+        'pdf_restore' => 'FUNCTION',
+        'pdf_resume_page' => 'FUNCTION',
+        'pdf_rotate' => 'FUNCTION',
+        'pdf_save' => 'FUNCTION',
+        'pdf_scale' => 'FUNCTION',
+        'pdf_set_border_color' => 'FUNCTION',
+        'pdf_set_border_dash' => 'FUNCTION',
+        'pdf_set_border_style' => 'FUNCTION',
+        'pdf_set_char_spacing' => 'FUNCTION',
+        'pdf_set_duration' => 'FUNCTION',
+        'pdf_set_gstate' => 'FUNCTION',
+        'pdf_set_horiz_scaling' => 'FUNCTION',
+        'pdf_set_info' => 'FUNCTION',
+        'pdf_set_info_author' => 'FUNCTION',
+        'pdf_set_info_creator' => 'FUNCTION',
+        'pdf_set_info_keywords' => 'FUNCTION',
+        'pdf_set_info_subject' => 'FUNCTION',
+        'pdf_set_info_title' => 'FUNCTION',
+        'pdf_set_layer_dependency' => 'FUNCTION',
+        'pdf_set_leading' => 'FUNCTION',
+        'pdf_set_parameter' => 'FUNCTION',
+        'pdf_set_text_matrix' => 'FUNCTION',
+        'pdf_set_text_pos' => 'FUNCTION',
+        'pdf_set_text_rendering' => 'FUNCTION',
+        'pdf_set_text_rise' => 'FUNCTION',
+        'pdf_set_value' => 'FUNCTION',
+        'pdf_set_word_spacing' => 'FUNCTION',
+        'pdf_setcolor' => 'FUNCTION',
+        'pdf_setdash' => 'FUNCTION',
+        'pdf_setdashpattern' => 'FUNCTION',
+        'pdf_setflat' => 'FUNCTION',
+        'pdf_setfont' => 'FUNCTION',
+        'pdf_setgray' => 'FUNCTION',
+        'pdf_setgray_fill' => 'FUNCTION',
+        'pdf_setgray_stroke' => 'FUNCTION',
+        'pdf_setlinecap' => 'FUNCTION',
+        'pdf_setlinejoin' => 'FUNCTION',
+        'pdf_setlinewidth' => 'FUNCTION',
+        'pdf_setmatrix' => 'FUNCTION',
+        'pdf_setmiterlimit' => 'FUNCTION',
+        'pdf_setpolydash' => 'FUNCTION',
+        'pdf_setrgbcolor' => 'FUNCTION',
+        'pdf_setrgbcolor_fill' => 'FUNCTION',
+        'pdf_setrgbcolor_stroke' => 'FUNCTION',
+        'pdf_shading' => 'FUNCTION',
+        'pdf_shading_pattern' => 'FUNCTION',
+        'pdf_shfill' => 'FUNCTION',
+        'pdf_show' => 'FUNCTION',
+        'pdf_show_boxed' => 'FUNCTION',
+        'pdf_show_xy' => 'FUNCTION',
+        'pdf_skew' => 'FUNCTION',
+        'pdf_stringwidth' => 'FUNCTION',
+        'pdf_stroke' => 'FUNCTION',
+        'pdf_suspend_page' => 'FUNCTION',
+        'pdf_translate' => 'FUNCTION',
+        'pdf_utf16_to_utf8' => 'FUNCTION',
+        'pdf_utf32_to_utf16' => 'FUNCTION',
+        'pdf_utf8_to_utf16' => 'FUNCTION',
+        'pdo' => 'FUNCTION',
+        'pdo_cubrid_schema' => 'FUNCTION',
+        'pdo_pgsqllobcreate' => 'FUNCTION',
+        'pdo_pgsqllobopen' => 'FUNCTION',
+        'pdo_pgsqllobunlink' => 'FUNCTION',
+        'pdo_sqlitecreateaggregate' => 'FUNCTION',
+        'pdo_sqlitecreatefunction' => 'FUNCTION',
+        'pdoexception' => 'FUNCTION',
+        'pdostatement' => 'FUNCTION',
+        'pfsockopen' => 'FUNCTION',
+        'pg_affected_rows' => 'FUNCTION',
+        'pg_cancel_query' => 'FUNCTION',
+        'pg_client_encoding' => 'FUNCTION',
+        'pg_close' => 'FUNCTION',
+        'pg_connect' => 'FUNCTION',
+        'pg_connection_busy' => 'FUNCTION',
+        'pg_connection_reset' => 'FUNCTION',
+        'pg_connection_status' => 'FUNCTION',
+        'pg_convert' => 'FUNCTION',
+        'pg_copy_from' => 'FUNCTION',
+        'pg_copy_to' => 'FUNCTION',
+        'pg_dbname' => 'FUNCTION',
+        'pg_delete' => 'FUNCTION',
+        'pg_end_copy' => 'FUNCTION',
+        'pg_escape_bytea' => 'FUNCTION',
+        'pg_escape_string' => 'FUNCTION',
+        'pg_execute' => 'FUNCTION',
+        'pg_fetch_all' => 'FUNCTION',
+        'pg_fetch_all_columns' => 'FUNCTION',
+        'pg_fetch_array' => 'FUNCTION',
+        'pg_fetch_assoc' => 'FUNCTION',
+        'pg_fetch_object' => 'FUNCTION',
+        'pg_fetch_result' => 'FUNCTION',
+        'pg_fetch_row' => 'FUNCTION',
+        'pg_field_is_null' => 'FUNCTION',
+        'pg_field_name' => 'FUNCTION',
+        'pg_field_num' => 'FUNCTION',
+        'pg_field_prtlen' => 'FUNCTION',
+        'pg_field_size' => 'FUNCTION',
+        'pg_field_table' => 'FUNCTION',
+        'pg_field_type' => 'FUNCTION',
+        'pg_field_type_oid' => 'FUNCTION',
+        'pg_free_result' => 'FUNCTION',
+        'pg_get_notify' => 'FUNCTION',
+        'pg_get_pid' => 'FUNCTION',
+        'pg_get_result' => 'FUNCTION',
+        'pg_host' => 'FUNCTION',
+        'pg_insert' => 'FUNCTION',
+        'pg_last_error' => 'FUNCTION',
+        'pg_last_notice' => 'FUNCTION',
+        'pg_last_oid' => 'FUNCTION',
+        'pg_lo_close' => 'FUNCTION',
+        'pg_lo_create' => 'FUNCTION',
+        'pg_lo_export' => 'FUNCTION',
+        'pg_lo_import' => 'FUNCTION',
+        'pg_lo_open' => 'FUNCTION',
+        'pg_lo_read' => 'FUNCTION',
+        'pg_lo_read_all' => 'FUNCTION',
+        'pg_lo_seek' => 'FUNCTION',
+        'pg_lo_tell' => 'FUNCTION',
+        'pg_lo_unlink' => 'FUNCTION',
+        'pg_lo_write' => 'FUNCTION',
+        'pg_meta_data' => 'FUNCTION',
+        'pg_num_fields' => 'FUNCTION',
+        'pg_num_rows' => 'FUNCTION',
+        'pg_options' => 'FUNCTION',
+        'pg_parameter_status' => 'FUNCTION',
+        'pg_pconnect' => 'FUNCTION',
+        'pg_ping' => 'FUNCTION',
+        'pg_port' => 'FUNCTION',
+        'pg_prepare' => 'FUNCTION',
+        'pg_put_line' => 'FUNCTION',
+        'pg_query' => 'FUNCTION',
+        'pg_query_params' => 'FUNCTION',
+        'pg_result_error' => 'FUNCTION',
+        'pg_result_error_field' => 'FUNCTION',
+        'pg_result_seek' => 'FUNCTION',
+        'pg_result_status' => 'FUNCTION',
+        'pg_select' => 'FUNCTION',
+        'pg_send_execute' => 'FUNCTION',
+        'pg_send_prepare' => 'FUNCTION',
+        'pg_send_query' => 'FUNCTION',
+        'pg_send_query_params' => 'FUNCTION',
+        'pg_set_client_encoding' => 'FUNCTION',
+        'pg_set_error_verbosity' => 'FUNCTION',
+        'pg_trace' => 'FUNCTION',
+        'pg_transaction_status' => 'FUNCTION',
+        'pg_tty' => 'FUNCTION',
+        'pg_unescape_bytea' => 'FUNCTION',
+        'pg_untrace' => 'FUNCTION',
+        'pg_update' => 'FUNCTION',
+        'pg_version' => 'FUNCTION',
+        'php_check_syntax' => 'FUNCTION',
+        'php_ini_loaded_file' => 'FUNCTION',
+        'php_ini_scanned_files' => 'FUNCTION',
+        'php_logo_guid' => 'FUNCTION',
+        'php_sapi_name' => 'FUNCTION',
+        'php_strip_whitespace' => 'FUNCTION',
+        'php_uname' => 'FUNCTION',
+        'phpcredits' => 'FUNCTION',
+        'phpinfo' => 'FUNCTION',
+        'phpversion' => 'FUNCTION',
+        'pi' => 'FUNCTION',
+        'png2wbmp' => 'FUNCTION',
+        'popen' => 'FUNCTION',
+        'pos' => 'FUNCTION',
+        'posix_access' => 'FUNCTION',
+        'posix_ctermid' => 'FUNCTION',
+        'posix_errno' => 'FUNCTION',
+        'posix_get_last_error' => 'FUNCTION',
+        'posix_getcwd' => 'FUNCTION',
+        'posix_getegid' => 'FUNCTION',
+        'posix_geteuid' => 'FUNCTION',
+        'posix_getgid' => 'FUNCTION',
+        'posix_getgrgid' => 'FUNCTION',
+        'posix_getgrnam' => 'FUNCTION',
+        'posix_getgroups' => 'FUNCTION',
+        'posix_getlogin' => 'FUNCTION',
+        'posix_getpgid' => 'FUNCTION',
+        'posix_getpgrp' => 'FUNCTION',
+        'posix_getpid' => 'FUNCTION',
+        'posix_getppid' => 'FUNCTION',
+        'posix_getpwnam' => 'FUNCTION',
+        'posix_getpwuid' => 'FUNCTION',
+        'posix_getrlimit' => 'FUNCTION',
+        'posix_getsid' => 'FUNCTION',
+        'posix_getuid' => 'FUNCTION',
+        'posix_initgroups' => 'FUNCTION',
+        'posix_isatty' => 'FUNCTION',
+        'posix_kill' => 'FUNCTION',
+        'posix_mkfifo' => 'FUNCTION',
+        'posix_mknod' => 'FUNCTION',
+        'posix_setegid' => 'FUNCTION',
+        'posix_seteuid' => 'FUNCTION',
+        'posix_setgid' => 'FUNCTION',
+        'posix_setpgid' => 'FUNCTION',
+        'posix_setsid' => 'FUNCTION',
+        'posix_setuid' => 'FUNCTION',
+        'posix_strerror' => 'FUNCTION',
+        'posix_times' => 'FUNCTION',
+        'posix_ttyname' => 'FUNCTION',
+        'posix_uname' => 'FUNCTION',
+        'pow' => 'FUNCTION',
+        'preg_filter' => 'FUNCTION',
+        'preg_grep' => 'FUNCTION',
+        'preg_last_error' => 'FUNCTION',
+        'preg_match' => 'FUNCTION',
+        'preg_match_all' => 'FUNCTION',
+        'preg_quote' => 'FUNCTION',
+        'preg_replace' => 'FUNCTION',
+        'preg_replace_callback' => 'FUNCTION',
+        'preg_split' => 'FUNCTION',
+        'prev' => 'FUNCTION',
+        'print' => 'FUNCTION',
+        'print_r' => 'FUNCTION',
+        'printer_abort' => 'FUNCTION',
+        'printer_close' => 'FUNCTION',
+        'printer_create_brush' => 'FUNCTION',
+        'printer_create_dc' => 'FUNCTION',
+        'printer_create_font' => 'FUNCTION',
+        'printer_create_pen' => 'FUNCTION',
+        'printer_delete_brush' => 'FUNCTION',
+        'printer_delete_dc' => 'FUNCTION',
+        'printer_delete_font' => 'FUNCTION',
+        'printer_delete_pen' => 'FUNCTION',
+        'printer_draw_bmp' => 'FUNCTION',
+        'printer_draw_chord' => 'FUNCTION',
+        'printer_draw_elipse' => 'FUNCTION',
+        'printer_draw_line' => 'FUNCTION',
+        'printer_draw_pie' => 'FUNCTION',
+        'printer_draw_rectangle' => 'FUNCTION',
+        'printer_draw_roundrect' => 'FUNCTION',
+        'printer_draw_text' => 'FUNCTION',
+        'printer_end_doc' => 'FUNCTION',
+        'printer_end_page' => 'FUNCTION',
+        'printer_get_option' => 'FUNCTION',
+        'printer_list' => 'FUNCTION',
+        'printer_logical_fontheight' => 'FUNCTION',
+        'printer_open' => 'FUNCTION',
+        'printer_select_brush' => 'FUNCTION',
+        'printer_select_font' => 'FUNCTION',
+        'printer_select_pen' => 'FUNCTION',
+        'printer_set_option' => 'FUNCTION',
+        'printer_start_doc' => 'FUNCTION',
+        'printer_start_page' => 'FUNCTION',
+        'printer_write' => 'FUNCTION',
+        'printf' => 'FUNCTION',
+        'proc_close' => 'FUNCTION',
+        'proc_get_status' => 'FUNCTION',
+        'proc_nice' => 'FUNCTION',
+        'proc_open' => 'FUNCTION',
+        'proc_terminate' => 'FUNCTION',
+        'property_exists' => 'FUNCTION',
+        'ps_add_bookmark' => 'FUNCTION',
+        'ps_add_launchlink' => 'FUNCTION',
+        'ps_add_locallink' => 'FUNCTION',
+        'ps_add_note' => 'FUNCTION',
+        'ps_add_pdflink' => 'FUNCTION',
+        'ps_add_weblink' => 'FUNCTION',
+        'ps_arc' => 'FUNCTION',
+        'ps_arcn' => 'FUNCTION',
+        'ps_begin_page' => 'FUNCTION',
+        'ps_begin_pattern' => 'FUNCTION',
+        'ps_begin_template' => 'FUNCTION',
+        'ps_circle' => 'FUNCTION',
+        'ps_clip' => 'FUNCTION',
+        'ps_close' => 'FUNCTION',
+        'ps_close_image' => 'FUNCTION',
+        'ps_closepath' => 'FUNCTION',
+        'ps_closepath_stroke' => 'FUNCTION',
+        'ps_continue_text' => 'FUNCTION',
+        'ps_curveto' => 'FUNCTION',
+        'ps_delete' => 'FUNCTION',
+        'ps_end_page' => 'FUNCTION',
+        'ps_end_pattern' => 'FUNCTION',
+        'ps_end_template' => 'FUNCTION',
+        'ps_fill' => 'FUNCTION',
+        'ps_fill_stroke' => 'FUNCTION',
+        'ps_findfont' => 'FUNCTION',
+        'ps_get_buffer' => 'FUNCTION',
+        'ps_get_parameter' => 'FUNCTION',
+        'ps_get_value' => 'FUNCTION',
+        'ps_hyphenate' => 'FUNCTION',
+        'ps_include_file' => 'FUNCTION',
+        'ps_lineto' => 'FUNCTION',
+        'ps_makespotcolor' => 'FUNCTION',
+        'ps_moveto' => 'FUNCTION',
+        'ps_new' => 'FUNCTION',
+        'ps_open_file' => 'FUNCTION',
+        'ps_open_image' => 'FUNCTION',
+        'ps_open_image_file' => 'FUNCTION',
+        'ps_open_memory_image' => 'FUNCTION',
+        'ps_place_image' => 'FUNCTION',
+        'ps_rect' => 'FUNCTION',
+        'ps_restore' => 'FUNCTION',
+        'ps_rotate' => 'FUNCTION',
+        'ps_save' => 'FUNCTION',
+        'ps_scale' => 'FUNCTION',
+        'ps_set_border_color' => 'FUNCTION',
+        'ps_set_border_dash' => 'FUNCTION',
+        'ps_set_border_style' => 'FUNCTION',
+        'ps_set_info' => 'FUNCTION',
+        'ps_set_parameter' => 'FUNCTION',
+        'ps_set_text_pos' => 'FUNCTION',
+        'ps_set_value' => 'FUNCTION',
+        'ps_setcolor' => 'FUNCTION',
+        'ps_setdash' => 'FUNCTION',
+        'ps_setflat' => 'FUNCTION',
+        'ps_setfont' => 'FUNCTION',
+        'ps_setgray' => 'FUNCTION',
+        'ps_setlinecap' => 'FUNCTION',
+        'ps_setlinejoin' => 'FUNCTION',
+        'ps_setlinewidth' => 'FUNCTION',
+        'ps_setmiterlimit' => 'FUNCTION',
+        'ps_setoverprintmode' => 'FUNCTION',
+        'ps_setpolydash' => 'FUNCTION',
+        'ps_shading' => 'FUNCTION',
+        'ps_shading_pattern' => 'FUNCTION',
+        'ps_shfill' => 'FUNCTION',
+        'ps_show' => 'FUNCTION',
+        'ps_show2' => 'FUNCTION',
+        'ps_show_boxed' => 'FUNCTION',
+        'ps_show_xy' => 'FUNCTION',
+        'ps_show_xy2' => 'FUNCTION',
+        'ps_string_geometry' => 'FUNCTION',
+        'ps_stringwidth' => 'FUNCTION',
+        'ps_stroke' => 'FUNCTION',
+        'ps_symbol' => 'FUNCTION',
+        'ps_symbol_name' => 'FUNCTION',
+        'ps_symbol_width' => 'FUNCTION',
+        'ps_translate' => 'FUNCTION',
+        'pspell_add_to_personal' => 'FUNCTION',
+        'pspell_add_to_session' => 'FUNCTION',
+        'pspell_check' => 'FUNCTION',
+        'pspell_clear_session' => 'FUNCTION',
+        'pspell_config_create' => 'FUNCTION',
+        'pspell_config_data_dir' => 'FUNCTION',
+        'pspell_config_dict_dir' => 'FUNCTION',
+        'pspell_config_ignore' => 'FUNCTION',
+        'pspell_config_mode' => 'FUNCTION',
+        'pspell_config_personal' => 'FUNCTION',
+        'pspell_config_repl' => 'FUNCTION',
+        'pspell_config_runtogether' => 'FUNCTION',
+        'pspell_config_save_repl' => 'FUNCTION',
+        'pspell_new' => 'FUNCTION',
+        'pspell_new_config' => 'FUNCTION',
+        'pspell_new_personal' => 'FUNCTION',
+        'pspell_save_wordlist' => 'FUNCTION',
+        'pspell_store_replacement' => 'FUNCTION',
+        'pspell_suggest' => 'FUNCTION',
+        'putenv' => 'FUNCTION',
+        'px_close' => 'FUNCTION',
+        'px_create_fp' => 'FUNCTION',
+        'px_date2string' => 'FUNCTION',
+        'px_delete' => 'FUNCTION',
+        'px_delete_record' => 'FUNCTION',
+        'px_get_field' => 'FUNCTION',
+        'px_get_info' => 'FUNCTION',
+        'px_get_parameter' => 'FUNCTION',
+        'px_get_record' => 'FUNCTION',
+        'px_get_schema' => 'FUNCTION',
+        'px_get_value' => 'FUNCTION',
+        'px_insert_record' => 'FUNCTION',
+        'px_new' => 'FUNCTION',
+        'px_numfields' => 'FUNCTION',
+        'px_numrecords' => 'FUNCTION',
+        'px_open_fp' => 'FUNCTION',
+        'px_put_record' => 'FUNCTION',
+        'px_retrieve_record' => 'FUNCTION',
+        'px_set_blob_file' => 'FUNCTION',
+        'px_set_parameter' => 'FUNCTION',
+        'px_set_tablename' => 'FUNCTION',
+        'px_set_targetencoding' => 'FUNCTION',
+        'px_set_value' => 'FUNCTION',
+        'px_timestamp2string' => 'FUNCTION',
+        'px_update_record' => 'FUNCTION',
+        'qdom_error' => 'FUNCTION',
+        'qdom_tree' => 'FUNCTION',
+        'quoted_printable_decode' => 'FUNCTION',
+        'quoted_printable_encode' => 'FUNCTION',
+        'quotemeta' => 'FUNCTION',
+        'rad2deg' => 'FUNCTION',
+        'radius_acct_open' => 'FUNCTION',
+        'radius_add_server' => 'FUNCTION',
+        'radius_auth_open' => 'FUNCTION',
+        'radius_close' => 'FUNCTION',
+        'radius_config' => 'FUNCTION',
+        'radius_create_request' => 'FUNCTION',
+        'radius_cvt_addr' => 'FUNCTION',
+        'radius_cvt_int' => 'FUNCTION',
+        'radius_cvt_string' => 'FUNCTION',
+        'radius_demangle' => 'FUNCTION',
+        'radius_demangle_mppe_key' => 'FUNCTION',
+        'radius_get_attr' => 'FUNCTION',
+        'radius_get_vendor_attr' => 'FUNCTION',
+        'radius_put_addr' => 'FUNCTION',
+        'radius_put_attr' => 'FUNCTION',
+        'radius_put_int' => 'FUNCTION',
+        'radius_put_string' => 'FUNCTION',
+        'radius_put_vendor_addr' => 'FUNCTION',
+        'radius_put_vendor_attr' => 'FUNCTION',
+        'radius_put_vendor_int' => 'FUNCTION',
+        'radius_put_vendor_string' => 'FUNCTION',
+        'radius_request_authenticator' => 'FUNCTION',
+        'radius_send_request' => 'FUNCTION',
+        'radius_server_secret' => 'FUNCTION',
+        'radius_strerror' => 'FUNCTION',
+        'rand' => 'FUNCTION',
+        'range' => 'FUNCTION',
+        'rangeexception' => 'FUNCTION',
+        'rar_wrapper_cache_stats' => 'FUNCTION',
+        'rararchive' => 'FUNCTION',
+        'rarentry' => 'FUNCTION',
+        'rarexception' => 'FUNCTION',
+        'rawurldecode' => 'FUNCTION',
+        'rawurlencode' => 'FUNCTION',
+        'read_exif_data' => 'FUNCTION',
+        'readdir' => 'FUNCTION',
+        'readfile' => 'FUNCTION',
+        'readgzfile' => 'FUNCTION',
+        'readline' => 'FUNCTION',
+        'readline_add_history' => 'FUNCTION',
+        'readline_callback_handler_install' => 'FUNCTION',
+        'readline_callback_handler_remove' => 'FUNCTION',
+        'readline_callback_read_char' => 'FUNCTION',
+        'readline_clear_history' => 'FUNCTION',
+        'readline_completion_function' => 'FUNCTION',
+        'readline_info' => 'FUNCTION',
+        'readline_list_history' => 'FUNCTION',
+        'readline_on_new_line' => 'FUNCTION',
+        'readline_read_history' => 'FUNCTION',
+        'readline_redisplay' => 'FUNCTION',
+        'readline_write_history' => 'FUNCTION',
+        'readlink' => 'FUNCTION',
+        'realpath' => 'FUNCTION',
+        'realpath_cache_get' => 'FUNCTION',
+        'realpath_cache_size' => 'FUNCTION',
+        'recode' => 'FUNCTION',
+        'recode_file' => 'FUNCTION',
+        'recode_string' => 'FUNCTION',
+        'recursivearrayiterator' => 'FUNCTION',
+        'recursivecachingiterator' => 'FUNCTION',
+        'recursivedirectoryiterator' => 'FUNCTION',
+        'recursivefilteriterator' => 'FUNCTION',
+        'recursiveiterator' => 'FUNCTION',
+        'recursiveiteratoriterator' => 'FUNCTION',
+        'recursiveregexiterator' => 'FUNCTION',
+        'recursivetreeiterator' => 'FUNCTION',
+        'reflection' => 'FUNCTION',
+        'reflectionclass' => 'FUNCTION',
+        'reflectionextension' => 'FUNCTION',
+        'reflectionfunction' => 'FUNCTION',
+        'reflectionfunctionabstract' => 'FUNCTION',
+        'reflectionmethod' => 'FUNCTION',
+        'reflectionobject' => 'FUNCTION',
+        'reflectionparameter' => 'FUNCTION',
+        'reflectionproperty' => 'FUNCTION',
+        'reflector' => 'FUNCTION',
+        'regexiterator' => 'FUNCTION',
+        'register_shutdown_function' => 'FUNCTION',
+        'register_tick_function' => 'FUNCTION',
+        'rename' => 'FUNCTION',
+        'rename_function' => 'FUNCTION',
+        'require' => 'FUNCTION',
+        'require_once' => 'FUNCTION',
+        'reset' => 'FUNCTION',
+        'resetvalue' => 'FUNCTION',
+        'resourcebundle' => 'FUNCTION',
+        'restore_error_handler' => 'FUNCTION',
+        'restore_exception_handler' => 'FUNCTION',
+        'restore_include_path' => 'FUNCTION',
+        'rewind' => 'FUNCTION',
+        'rewinddir' => 'FUNCTION',
+        'rmdir' => 'FUNCTION',
+        'round' => 'FUNCTION',
+        'rpm_close' => 'FUNCTION',
+        'rpm_get_tag' => 'FUNCTION',
+        'rpm_is_valid' => 'FUNCTION',
+        'rpm_open' => 'FUNCTION',
+        'rpm_version' => 'FUNCTION',
+        'rrd_create' => 'FUNCTION',
+        'rrd_error' => 'FUNCTION',
+        'rrd_fetch' => 'FUNCTION',
+        'rrd_first' => 'FUNCTION',
+        'rrd_graph' => 'FUNCTION',
+        'rrd_info' => 'FUNCTION',
+        'rrd_last' => 'FUNCTION',
+        'rrd_lastupdate' => 'FUNCTION',
+        'rrd_restore' => 'FUNCTION',
+        'rrd_tune' => 'FUNCTION',
+        'rrd_update' => 'FUNCTION',
+        'rrd_xport' => 'FUNCTION',
+        'rrdcreator' => 'FUNCTION',
+        'rrdgraph' => 'FUNCTION',
+        'rrdupdater' => 'FUNCTION',
+        'rsort' => 'FUNCTION',
+        'rtrim' => 'FUNCTION',
+        'runkit_class_adopt' => 'FUNCTION',
+        'runkit_class_emancipate' => 'FUNCTION',
+        'runkit_constant_add' => 'FUNCTION',
+        'runkit_constant_redefine' => 'FUNCTION',
+        'runkit_constant_remove' => 'FUNCTION',
+        'runkit_function_add' => 'FUNCTION',
+        'runkit_function_copy' => 'FUNCTION',
+        'runkit_function_redefine' => 'FUNCTION',
+        'runkit_function_remove' => 'FUNCTION',
+        'runkit_function_rename' => 'FUNCTION',
+        'runkit_import' => 'FUNCTION',
+        'runkit_lint' => 'FUNCTION',
+        'runkit_lint_file' => 'FUNCTION',
+        'runkit_method_add' => 'FUNCTION',
+        'runkit_method_copy' => 'FUNCTION',
+        'runkit_method_redefine' => 'FUNCTION',
+        'runkit_method_remove' => 'FUNCTION',
+        'runkit_method_rename' => 'FUNCTION',
+        'runkit_return_value_used' => 'FUNCTION',
+        'runkit_sandbox_output_handler' => 'FUNCTION',
+        'runkit_superglobals' => 'FUNCTION',
+        'runtimeexception' => 'FUNCTION',
+        'samconnection_commit' => 'FUNCTION',
+        'samconnection_connect' => 'FUNCTION',
+        'samconnection_constructor' => 'FUNCTION',
+        'samconnection_disconnect' => 'FUNCTION',
+        'samconnection_errno' => 'FUNCTION',
+        'samconnection_error' => 'FUNCTION',
+        'samconnection_isconnected' => 'FUNCTION',
+        'samconnection_peek' => 'FUNCTION',
+        'samconnection_peekall' => 'FUNCTION',
+        'samconnection_receive' => 'FUNCTION',
+        'samconnection_remove' => 'FUNCTION',
+        'samconnection_rollback' => 'FUNCTION',
+        'samconnection_send' => 'FUNCTION',
+        'samconnection_setdebug' => 'FUNCTION',
+        'samconnection_subscribe' => 'FUNCTION',
+        'samconnection_unsubscribe' => 'FUNCTION',
+        'sammessage_body' => 'FUNCTION',
+        'sammessage_constructor' => 'FUNCTION',
+        'sammessage_header' => 'FUNCTION',
+        'sca_createdataobject' => 'FUNCTION',
+        'sca_getservice' => 'FUNCTION',
+        'sca_localproxy_createdataobject' => 'FUNCTION',
+        'sca_soapproxy_createdataobject' => 'FUNCTION',
+        'scandir' => 'FUNCTION',
+        'sdo_das_changesummary_beginlogging' => 'FUNCTION',
+        'sdo_das_changesummary_endlogging' => 'FUNCTION',
+        'sdo_das_changesummary_getchangeddataobjects' => 'FUNCTION',
+        'sdo_das_changesummary_getchangetype' => 'FUNCTION',
+        'sdo_das_changesummary_getoldcontainer' => 'FUNCTION',
+        'sdo_das_changesummary_getoldvalues' => 'FUNCTION',
+        'sdo_das_changesummary_islogging' => 'FUNCTION',
+        'sdo_das_datafactory_addpropertytotype' => 'FUNCTION',
+        'sdo_das_datafactory_addtype' => 'FUNCTION',
+        'sdo_das_datafactory_getdatafactory' => 'FUNCTION',
+        'sdo_das_dataobject_getchangesummary' => 'FUNCTION',
+        'sdo_das_relational_applychanges' => 'FUNCTION',
+        'sdo_das_relational_construct' => 'FUNCTION',
+        'sdo_das_relational_createrootdataobject' => 'FUNCTION',
+        'sdo_das_relational_executepreparedquery' => 'FUNCTION',
+        'sdo_das_relational_executequery' => 'FUNCTION',
+        'sdo_das_setting_getlistindex' => 'FUNCTION',
+        'sdo_das_setting_getpropertyindex' => 'FUNCTION',
+        'sdo_das_setting_getpropertyname' => 'FUNCTION',
+        'sdo_das_setting_getvalue' => 'FUNCTION',
+        'sdo_das_setting_isset' => 'FUNCTION',
+        'sdo_das_xml_addtypes' => 'FUNCTION',
+        'sdo_das_xml_create' => 'FUNCTION',
+        'sdo_das_xml_createdataobject' => 'FUNCTION',
+        'sdo_das_xml_createdocument' => 'FUNCTION',
+        'sdo_das_xml_document_getrootdataobject' => 'FUNCTION',
+        'sdo_das_xml_document_getrootelementname' => 'FUNCTION',
+        'sdo_das_xml_document_getrootelementuri' => 'FUNCTION',
+        'sdo_das_xml_document_setencoding' => 'FUNCTION',
+        'sdo_das_xml_document_setxmldeclaration' => 'FUNCTION',
+        'sdo_das_xml_document_setxmlversion' => 'FUNCTION',
+        'sdo_das_xml_loadfile' => 'FUNCTION',
+        'sdo_das_xml_loadstring' => 'FUNCTION',
+        'sdo_das_xml_savefile' => 'FUNCTION',
+        'sdo_das_xml_savestring' => 'FUNCTION',
+        'sdo_datafactory_create' => 'FUNCTION',
+        'sdo_dataobject_clear' => 'FUNCTION',
+        'sdo_dataobject_createdataobject' => 'FUNCTION',
+        'sdo_dataobject_getcontainer' => 'FUNCTION',
+        'sdo_dataobject_getsequence' => 'FUNCTION',
+        'sdo_dataobject_gettypename' => 'FUNCTION',
+        'sdo_dataobject_gettypenamespaceuri' => 'FUNCTION',
+        'sdo_exception_getcause' => 'FUNCTION',
+        'sdo_list_insert' => 'FUNCTION',
+        'sdo_model_property_getcontainingtype' => 'FUNCTION',
+        'sdo_model_property_getdefault' => 'FUNCTION',
+        'sdo_model_property_getname' => 'FUNCTION',
+        'sdo_model_property_gettype' => 'FUNCTION',
+        'sdo_model_property_iscontainment' => 'FUNCTION',
+        'sdo_model_property_ismany' => 'FUNCTION',
+        'sdo_model_reflectiondataobject_construct' => 'FUNCTION',
+        'sdo_model_reflectiondataobject_export' => 'FUNCTION',
+        'sdo_model_reflectiondataobject_getcontainmentproperty' => 'FUNCTION',
+        'sdo_model_reflectiondataobject_getinstanceproperties' => 'FUNCTION',
+        'sdo_model_reflectiondataobject_gettype' => 'FUNCTION',
+        'sdo_model_type_getbasetype' => 'FUNCTION',
+        'sdo_model_type_getname' => 'FUNCTION',
+        'sdo_model_type_getnamespaceuri' => 'FUNCTION',
+        'sdo_model_type_getproperties' => 'FUNCTION',
+        'sdo_model_type_getproperty' => 'FUNCTION',
+        'sdo_model_type_isabstracttype' => 'FUNCTION',
+        'sdo_model_type_isdatatype' => 'FUNCTION',
+        'sdo_model_type_isinstance' => 'FUNCTION',
+        'sdo_model_type_isopentype' => 'FUNCTION',
+        'sdo_model_type_issequencedtype' => 'FUNCTION',
+        'sdo_sequence_getproperty' => 'FUNCTION',
+        'sdo_sequence_insert' => 'FUNCTION',
+        'sdo_sequence_move' => 'FUNCTION',
+        'seekableiterator' => 'FUNCTION',
+        'sem_acquire' => 'FUNCTION',
+        'sem_get' => 'FUNCTION',
+        'sem_release' => 'FUNCTION',
+        'sem_remove' => 'FUNCTION',
+        'serializable' => 'FUNCTION',
+        'serialize' => 'FUNCTION',
+        'session_cache_expire' => 'FUNCTION',
+        'session_cache_limiter' => 'FUNCTION',
+        'session_commit' => 'FUNCTION',
+        'session_decode' => 'FUNCTION',
+        'session_destroy' => 'FUNCTION',
+        'session_encode' => 'FUNCTION',
+        'session_get_cookie_params' => 'FUNCTION',
+        'session_id' => 'FUNCTION',
+        'session_is_registered' => 'FUNCTION',
+        'session_module_name' => 'FUNCTION',
+        'session_name' => 'FUNCTION',
+        'session_pgsql_add_error' => 'FUNCTION',
+        'session_pgsql_get_error' => 'FUNCTION',
+        'session_pgsql_get_field' => 'FUNCTION',
+        'session_pgsql_reset' => 'FUNCTION',
+        'session_pgsql_set_field' => 'FUNCTION',
+        'session_pgsql_status' => 'FUNCTION',
+        'session_regenerate_id' => 'FUNCTION',
+        'session_register' => 'FUNCTION',
+        'session_save_path' => 'FUNCTION',
+        'session_set_cookie_params' => 'FUNCTION',
+        'session_set_save_handler' => 'FUNCTION',
+        'session_start' => 'FUNCTION',
+        'session_unregister' => 'FUNCTION',
+        'session_unset' => 'FUNCTION',
+        'session_write_close' => 'FUNCTION',
+        'setcounterclass' => 'FUNCTION',
+        'set_error_handler' => 'FUNCTION',
+        'set_exception_handler' => 'FUNCTION',
+        'set_file_buffer' => 'FUNCTION',
+        'set_include_path' => 'FUNCTION',
+        'set_magic_quotes_runtime' => 'FUNCTION',
+        'set_socket_blocking' => 'FUNCTION',
+        'set_time_limit' => 'FUNCTION',
+        'setcookie' => 'FUNCTION',
+        'setlocale' => 'FUNCTION',
+        'setrawcookie' => 'FUNCTION',
+        'setstaticpropertyvalue' => 'FUNCTION',
+        'settype' => 'FUNCTION',
+        'sha1' => 'FUNCTION',
+        'sha1_file' => 'FUNCTION',
+        'shell_exec' => 'FUNCTION',
+        'shm_attach' => 'FUNCTION',
+        'shm_detach' => 'FUNCTION',
+        'shm_get_var' => 'FUNCTION',
+        'shm_has_var' => 'FUNCTION',
+        'shm_put_var' => 'FUNCTION',
+        'shm_remove' => 'FUNCTION',
+        'shm_remove_var' => 'FUNCTION',
+        'shmop_close' => 'FUNCTION',
+        'shmop_delete' => 'FUNCTION',
+        'shmop_open' => 'FUNCTION',
+        'shmop_read' => 'FUNCTION',
+        'shmop_size' => 'FUNCTION',
+        'shmop_write' => 'FUNCTION',
+        'show_source' => 'FUNCTION',
+        'shuffle' => 'FUNCTION',
+        'signeurlpaiement' => 'FUNCTION',
+        'similar_text' => 'FUNCTION',
+        'simplexml_import_dom' => 'FUNCTION',
+        'simplexml_load_file' => 'FUNCTION',
+        'simplexml_load_string' => 'FUNCTION',
+        'simplexmlelement' => 'FUNCTION',
+        'simplexmliterator' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sinh' => 'FUNCTION',
+        'sizeof' => 'FUNCTION',
+        'sleep' => 'FUNCTION',
+        'snmp2_get' => 'FUNCTION',
+        'snmp2_getnext' => 'FUNCTION',
+        'snmp2_real_walk' => 'FUNCTION',
+        'snmp2_set' => 'FUNCTION',
+        'snmp2_walk' => 'FUNCTION',
+        'snmp3_get' => 'FUNCTION',
+        'snmp3_getnext' => 'FUNCTION',
+        'snmp3_real_walk' => 'FUNCTION',
+        'snmp3_set' => 'FUNCTION',
+        'snmp3_walk' => 'FUNCTION',
+        'snmp_get_quick_print' => 'FUNCTION',
+        'snmp_get_valueretrieval' => 'FUNCTION',
+        'snmp_read_mib' => 'FUNCTION',
+        'snmp_set_enum_print' => 'FUNCTION',
+        'snmp_set_oid_numeric_print' => 'FUNCTION',
+        'snmp_set_oid_output_format' => 'FUNCTION',
+        'snmp_set_quick_print' => 'FUNCTION',
+        'snmp_set_valueretrieval' => 'FUNCTION',
+        'snmpget' => 'FUNCTION',
+        'snmpgetnext' => 'FUNCTION',
+        'snmprealwalk' => 'FUNCTION',
+        'snmpset' => 'FUNCTION',
+        'snmpwalk' => 'FUNCTION',
+        'snmpwalkoid' => 'FUNCTION',
+        'soapclient' => 'FUNCTION',
+        'soapfault' => 'FUNCTION',
+        'soapheader' => 'FUNCTION',
+        'soapparam' => 'FUNCTION',
+        'soapserver' => 'FUNCTION',
+        'soapvar' => 'FUNCTION',
+        'socket_accept' => 'FUNCTION',
+        'socket_bind' => 'FUNCTION',
+        'socket_clear_error' => 'FUNCTION',
+        'socket_close' => 'FUNCTION',
+        'socket_connect' => 'FUNCTION',
+        'socket_create' => 'FUNCTION',
+        'socket_create_listen' => 'FUNCTION',
+        'socket_create_pair' => 'FUNCTION',
+        'socket_get_option' => 'FUNCTION',
+        'socket_get_status' => 'FUNCTION',
+        'socket_getpeername' => 'FUNCTION',
+        'socket_getsockname' => 'FUNCTION',
+        'socket_last_error' => 'FUNCTION',
+        'socket_listen' => 'FUNCTION',
+        'socket_read' => 'FUNCTION',
+        'socket_recv' => 'FUNCTION',
+        'socket_recvfrom' => 'FUNCTION',
+        'socket_select' => 'FUNCTION',
+        'socket_send' => 'FUNCTION',
+        'socket_sendto' => 'FUNCTION',
+        'socket_set_block' => 'FUNCTION',
+        'socket_set_blocking' => 'FUNCTION',
+        'socket_set_nonblock' => 'FUNCTION',
+        'socket_set_option' => 'FUNCTION',
+        'socket_set_timeout' => 'FUNCTION',
+        'socket_shutdown' => 'FUNCTION',
+        'socket_strerror' => 'FUNCTION',
+        'socket_write' => 'FUNCTION',
+        'solr_get_version' => 'FUNCTION',
+        'solrclient' => 'FUNCTION',
+        'solrclientexception' => 'FUNCTION',
+        'solrdocument' => 'FUNCTION',
+        'solrdocumentfield' => 'FUNCTION',
+        'solrexception' => 'FUNCTION',
+        'solrgenericresponse' => 'FUNCTION',
+        'solrillegalargumentexception' => 'FUNCTION',
+        'solrillegaloperationexception' => 'FUNCTION',
+        'solrinputdocument' => 'FUNCTION',
+        'solrmodifiableparams' => 'FUNCTION',
+        'solrobject' => 'FUNCTION',
+        'solrparams' => 'FUNCTION',
+        'solrpingresponse' => 'FUNCTION',
+        'solrquery' => 'FUNCTION',
+        'solrqueryresponse' => 'FUNCTION',
+        'solrresponse' => 'FUNCTION',
+        'solrupdateresponse' => 'FUNCTION',
+        'solrutils' => 'FUNCTION',
+        'sort' => 'FUNCTION',
+        'soundex' => 'FUNCTION',
+        'sphinxclient' => 'FUNCTION',
+        'spl_autoload' => 'FUNCTION',
+        'spl_autoload_call' => 'FUNCTION',
+        'spl_autoload_extensions' => 'FUNCTION',
+        'spl_autoload_functions' => 'FUNCTION',
+        'spl_autoload_register' => 'FUNCTION',
+        'spl_autoload_unregister' => 'FUNCTION',
+        'spl_classes' => 'FUNCTION',
+        'spl_object_hash' => 'FUNCTION',
+        'splbool' => 'FUNCTION',
+        'spldoublylinkedlist' => 'FUNCTION',
+        'splenum' => 'FUNCTION',
+        'splfileinfo' => 'FUNCTION',
+        'splfileobject' => 'FUNCTION',
+        'splfixedarray' => 'FUNCTION',
+        'splfloat' => 'FUNCTION',
+        'splheap' => 'FUNCTION',
+        'splint' => 'FUNCTION',
+        'split' => 'FUNCTION',
+        'spliti' => 'FUNCTION',
+        'splmaxheap' => 'FUNCTION',
+        'splminheap' => 'FUNCTION',
+        'splobjectstorage' => 'FUNCTION',
+        'splobserver' => 'FUNCTION',
+        'splpriorityqueue' => 'FUNCTION',
+        'splqueue' => 'FUNCTION',
+        'splstack' => 'FUNCTION',
+        'splstring' => 'FUNCTION',
+        'splsubject' => 'FUNCTION',
+        'spltempfileobject' => 'FUNCTION',
+        'sprintf' => 'FUNCTION',
+        'sql_regcase' => 'FUNCTION',
+        'sqlite3' => 'FUNCTION',
+        'sqlite3result' => 'FUNCTION',
+        'sqlite3stmt' => 'FUNCTION',
+        'sqlite_array_query' => 'FUNCTION',
+        'sqlite_busy_timeout' => 'FUNCTION',
+        'sqlite_changes' => 'FUNCTION',
+        'sqlite_close' => 'FUNCTION',
+        'sqlite_column' => 'FUNCTION',
+        'sqlite_create_aggregate' => 'FUNCTION',
+        'sqlite_create_function' => 'FUNCTION',
+        'sqlite_current' => 'FUNCTION',
+        'sqlite_error_string' => 'FUNCTION',
+        'sqlite_escape_string' => 'FUNCTION',
+        'sqlite_exec' => 'FUNCTION',
+        'sqlite_factory' => 'FUNCTION',
+        'sqlite_fetch_all' => 'FUNCTION',
+        'sqlite_fetch_array' => 'FUNCTION',
+        'sqlite_fetch_column_types' => 'FUNCTION',
+        'sqlite_fetch_object' => 'FUNCTION',
+        'sqlite_fetch_single' => 'FUNCTION',
+        'sqlite_fetch_string' => 'FUNCTION',
+        'sqlite_field_name' => 'FUNCTION',
+        'sqlite_has_more' => 'FUNCTION',
+        'sqlite_has_prev' => 'FUNCTION',
+        'sqlite_key' => 'FUNCTION',
+        'sqlite_last_error' => 'FUNCTION',
+        'sqlite_last_insert_rowid' => 'FUNCTION',
+        'sqlite_libencoding' => 'FUNCTION',
+        'sqlite_libversion' => 'FUNCTION',
+        'sqlite_next' => 'FUNCTION',
+        'sqlite_num_fields' => 'FUNCTION',
+        'sqlite_num_rows' => 'FUNCTION',
+        'sqlite_open' => 'FUNCTION',
+        'sqlite_popen' => 'FUNCTION',
+        'sqlite_prev' => 'FUNCTION',
+        'sqlite_query' => 'FUNCTION',
+        'sqlite_rewind' => 'FUNCTION',
+        'sqlite_seek' => 'FUNCTION',
+        'sqlite_single_query' => 'FUNCTION',
+        'sqlite_udf_decode_binary' => 'FUNCTION',
+        'sqlite_udf_encode_binary' => 'FUNCTION',
+        'sqlite_unbuffered_query' => 'FUNCTION',
+        'sqlite_valid' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'srand' => 'FUNCTION',
+        'sscanf' => 'FUNCTION',
+        'ssdeep_fuzzy_compare' => 'FUNCTION',
+        'ssdeep_fuzzy_hash' => 'FUNCTION',
+        'ssdeep_fuzzy_hash_filename' => 'FUNCTION',
+        'ssh2_auth_hostbased_file' => 'FUNCTION',
+        'ssh2_auth_none' => 'FUNCTION',
+        'ssh2_auth_password' => 'FUNCTION',
+        'ssh2_auth_pubkey_file' => 'FUNCTION',
+        'ssh2_connect' => 'FUNCTION',
+        'ssh2_exec' => 'FUNCTION',
+        'ssh2_fetch_stream' => 'FUNCTION',
+        'ssh2_fingerprint' => 'FUNCTION',
+        'ssh2_methods_negotiated' => 'FUNCTION',
+        'ssh2_publickey_add' => 'FUNCTION',
+        'ssh2_publickey_init' => 'FUNCTION',
+        'ssh2_publickey_list' => 'FUNCTION',
+        'ssh2_publickey_remove' => 'FUNCTION',
+        'ssh2_scp_recv' => 'FUNCTION',
+        'ssh2_scp_send' => 'FUNCTION',
+        'ssh2_sftp' => 'FUNCTION',
+        'ssh2_sftp_lstat' => 'FUNCTION',
+        'ssh2_sftp_mkdir' => 'FUNCTION',
+        'ssh2_sftp_readlink' => 'FUNCTION',
+        'ssh2_sftp_realpath' => 'FUNCTION',
+        'ssh2_sftp_rename' => 'FUNCTION',
+        'ssh2_sftp_rmdir' => 'FUNCTION',
+        'ssh2_sftp_stat' => 'FUNCTION',
+        'ssh2_sftp_symlink' => 'FUNCTION',
+        'ssh2_sftp_unlink' => 'FUNCTION',
+        'ssh2_shell' => 'FUNCTION',
+        'ssh2_tunnel' => 'FUNCTION',
+        'stat' => 'FUNCTION',
+        'stats_absolute_deviation' => 'FUNCTION',
+        'stats_cdf_beta' => 'FUNCTION',
+        'stats_cdf_binomial' => 'FUNCTION',
+        'stats_cdf_cauchy' => 'FUNCTION',
+        'stats_cdf_chisquare' => 'FUNCTION',
+        'stats_cdf_exponential' => 'FUNCTION',
+        'stats_cdf_f' => 'FUNCTION',
+        'stats_cdf_gamma' => 'FUNCTION',
+        'stats_cdf_laplace' => 'FUNCTION',
+        'stats_cdf_logistic' => 'FUNCTION',
+        'stats_cdf_negative_binomial' => 'FUNCTION',
+        'stats_cdf_noncentral_chisquare' => 'FUNCTION',
+        'stats_cdf_noncentral_f' => 'FUNCTION',
+        'stats_cdf_poisson' => 'FUNCTION',
+        'stats_cdf_t' => 'FUNCTION',
+        'stats_cdf_uniform' => 'FUNCTION',
+        'stats_cdf_weibull' => 'FUNCTION',
+        'stats_covariance' => 'FUNCTION',
+        'stats_den_uniform' => 'FUNCTION',
+        'stats_dens_beta' => 'FUNCTION',
+        'stats_dens_cauchy' => 'FUNCTION',
+        'stats_dens_chisquare' => 'FUNCTION',
+        'stats_dens_exponential' => 'FUNCTION',
+        'stats_dens_f' => 'FUNCTION',
+        'stats_dens_gamma' => 'FUNCTION',
+        'stats_dens_laplace' => 'FUNCTION',
+        'stats_dens_logistic' => 'FUNCTION',
+        'stats_dens_negative_binomial' => 'FUNCTION',
+        'stats_dens_normal' => 'FUNCTION',
+        'stats_dens_pmf_binomial' => 'FUNCTION',
+        'stats_dens_pmf_hypergeometric' => 'FUNCTION',
+        'stats_dens_pmf_poisson' => 'FUNCTION',
+        'stats_dens_t' => 'FUNCTION',
+        'stats_dens_weibull' => 'FUNCTION',
+        'stats_harmonic_mean' => 'FUNCTION',
+        'stats_kurtosis' => 'FUNCTION',
+        'stats_rand_gen_beta' => 'FUNCTION',
+        'stats_rand_gen_chisquare' => 'FUNCTION',
+        'stats_rand_gen_exponential' => 'FUNCTION',
+        'stats_rand_gen_f' => 'FUNCTION',
+        'stats_rand_gen_funiform' => 'FUNCTION',
+        'stats_rand_gen_gamma' => 'FUNCTION',
+        'stats_rand_gen_ibinomial' => 'FUNCTION',
+        'stats_rand_gen_ibinomial_negative' => 'FUNCTION',
+        'stats_rand_gen_int' => 'FUNCTION',
+        'stats_rand_gen_ipoisson' => 'FUNCTION',
+        'stats_rand_gen_iuniform' => 'FUNCTION',
+        'stats_rand_gen_noncenral_chisquare' => 'FUNCTION',
+        'stats_rand_gen_noncentral_f' => 'FUNCTION',
+        'stats_rand_gen_noncentral_t' => 'FUNCTION',
+        'stats_rand_gen_normal' => 'FUNCTION',
+        'stats_rand_gen_t' => 'FUNCTION',
+        'stats_rand_get_seeds' => 'FUNCTION',
+        'stats_rand_phrase_to_seeds' => 'FUNCTION',
+        'stats_rand_ranf' => 'FUNCTION',
+        'stats_rand_setall' => 'FUNCTION',
+        'stats_skew' => 'FUNCTION',
+        'stats_standard_deviation' => 'FUNCTION',
+        'stats_stat_binomial_coef' => 'FUNCTION',
+        'stats_stat_correlation' => 'FUNCTION',
+        'stats_stat_gennch' => 'FUNCTION',
+        'stats_stat_independent_t' => 'FUNCTION',
+        'stats_stat_innerproduct' => 'FUNCTION',
+        'stats_stat_noncentral_t' => 'FUNCTION',
+        'stats_stat_paired_t' => 'FUNCTION',
+        'stats_stat_percentile' => 'FUNCTION',
+        'stats_stat_powersum' => 'FUNCTION',
+        'stats_variance' => 'FUNCTION',
+        'stomp' => 'FUNCTION',
+        'stomp_connect_error' => 'FUNCTION',
+        'stomp_version' => 'FUNCTION',
+        'stompexception' => 'FUNCTION',
+        'stompframe' => 'FUNCTION',
+        'str_getcsv' => 'FUNCTION',
+        'str_ireplace' => 'FUNCTION',
+        'str_pad' => 'FUNCTION',
+        'str_repeat' => 'FUNCTION',
+        'str_replace' => 'FUNCTION',
+        'str_rot13' => 'FUNCTION',
+        'str_shuffle' => 'FUNCTION',
+        'str_split' => 'FUNCTION',
+        'str_word_count' => 'FUNCTION',
+        'strcasecmp' => 'FUNCTION',
+        'strchr' => 'FUNCTION',
+        'strcmp' => 'FUNCTION',
+        'strcoll' => 'FUNCTION',
+        'strcspn' => 'FUNCTION',
+        'stream_bucket_append' => 'FUNCTION',
+        'stream_bucket_make_writeable' => 'FUNCTION',
+        'stream_bucket_new' => 'FUNCTION',
+        'stream_bucket_prepend' => 'FUNCTION',
+        'stream_context_create' => 'FUNCTION',
+        'stream_context_get_default' => 'FUNCTION',
+        'stream_context_get_options' => 'FUNCTION',
+        'stream_context_get_params' => 'FUNCTION',
+        'stream_context_set_default' => 'FUNCTION',
+        'stream_context_set_option' => 'FUNCTION',
+        'stream_context_set_params' => 'FUNCTION',
+        'stream_copy_to_stream' => 'FUNCTION',
+        'stream_encoding' => 'FUNCTION',
+        'stream_filter_append' => 'FUNCTION',
+        'stream_filter_prepend' => 'FUNCTION',
+        'stream_filter_register' => 'FUNCTION',
+        'stream_filter_remove' => 'FUNCTION',
+        'stream_get_contents' => 'FUNCTION',
+        'stream_get_filters' => 'FUNCTION',
+        'stream_get_line' => 'FUNCTION',
+        'stream_get_meta_data' => 'FUNCTION',
+        'stream_get_transports' => 'FUNCTION',
+        'stream_get_wrappers' => 'FUNCTION',
+        'stream_is_local' => 'FUNCTION',
+        'stream_notification_callback' => 'FUNCTION',
+        'stream_register_wrapper' => 'FUNCTION',
+        'stream_resolve_include_path' => 'FUNCTION',
+        'stream_select' => 'FUNCTION',
+        'stream_set_blocking' => 'FUNCTION',
+        'stream_set_read_buffer' => 'FUNCTION',
+        'stream_set_timeout' => 'FUNCTION',
+        'stream_set_write_buffer' => 'FUNCTION',
+        'stream_socket_accept' => 'FUNCTION',
+        'stream_socket_client' => 'FUNCTION',
+        'stream_socket_enable_crypto' => 'FUNCTION',
+        'stream_socket_get_name' => 'FUNCTION',
+        'stream_socket_pair' => 'FUNCTION',
+        'stream_socket_recvfrom' => 'FUNCTION',
+        'stream_socket_sendto' => 'FUNCTION',
+        'stream_socket_server' => 'FUNCTION',
+        'stream_socket_shutdown' => 'FUNCTION',
+        'stream_supports_lock' => 'FUNCTION',
+        'stream_wrapper_register' => 'FUNCTION',
+        'stream_wrapper_restore' => 'FUNCTION',
+        'stream_wrapper_unregister' => 'FUNCTION',
+        'streamwrapper' => 'FUNCTION',
+        'strftime' => 'FUNCTION',
+        'strip_tags' => 'FUNCTION',
+        'stripcslashes' => 'FUNCTION',
+        'stripos' => 'FUNCTION',
+        'stripslashes' => 'FUNCTION',
+        'stristr' => 'FUNCTION',
+        'strlen' => 'FUNCTION',
+        'strnatcasecmp' => 'FUNCTION',
+        'strnatcmp' => 'FUNCTION',
+        'strncasecmp' => 'FUNCTION',
+        'strncmp' => 'FUNCTION',
+        'strpbrk' => 'FUNCTION',
+        'strpos' => 'FUNCTION',
+        'strptime' => 'FUNCTION',
+        'strrchr' => 'FUNCTION',
+        'strrev' => 'FUNCTION',
+        'strripos' => 'FUNCTION',
+        'strrpos' => 'FUNCTION',
+        'strspn' => 'FUNCTION',
+        'strstr' => 'FUNCTION',
+        'strtok' => 'FUNCTION',
+        'strtolower' => 'FUNCTION',
+        'strtotime' => 'FUNCTION',
+        'strtoupper' => 'FUNCTION',
+        'strtr' => 'FUNCTION',
+        'strval' => 'FUNCTION',
+        'substr' => 'FUNCTION',
+        'substr_compare' => 'FUNCTION',
+        'substr_count' => 'FUNCTION',
+        'substr_replace' => 'FUNCTION',
+        'svn_add' => 'FUNCTION',
+        'svn_auth_get_parameter' => 'FUNCTION',
+        'svn_auth_set_parameter' => 'FUNCTION',
+        'svn_blame' => 'FUNCTION',
+        'svn_cat' => 'FUNCTION',
+        'svn_checkout' => 'FUNCTION',
+        'svn_cleanup' => 'FUNCTION',
+        'svn_client_version' => 'FUNCTION',
+        'svn_commit' => 'FUNCTION',
+        'svn_delete' => 'FUNCTION',
+        'svn_diff' => 'FUNCTION',
+        'svn_export' => 'FUNCTION',
+        'svn_fs_abort_txn' => 'FUNCTION',
+        'svn_fs_apply_text' => 'FUNCTION',
+        'svn_fs_begin_txn2' => 'FUNCTION',
+        'svn_fs_change_node_prop' => 'FUNCTION',
+        'svn_fs_check_path' => 'FUNCTION',
+        'svn_fs_contents_changed' => 'FUNCTION',
+        'svn_fs_copy' => 'FUNCTION',
+        'svn_fs_delete' => 'FUNCTION',
+        'svn_fs_dir_entries' => 'FUNCTION',
+        'svn_fs_file_contents' => 'FUNCTION',
+        'svn_fs_file_length' => 'FUNCTION',
+        'svn_fs_is_dir' => 'FUNCTION',
+        'svn_fs_is_file' => 'FUNCTION',
+        'svn_fs_make_dir' => 'FUNCTION',
+        'svn_fs_make_file' => 'FUNCTION',
+        'svn_fs_node_created_rev' => 'FUNCTION',
+        'svn_fs_node_prop' => 'FUNCTION',
+        'svn_fs_props_changed' => 'FUNCTION',
+        'svn_fs_revision_prop' => 'FUNCTION',
+        'svn_fs_revision_root' => 'FUNCTION',
+        'svn_fs_txn_root' => 'FUNCTION',
+        'svn_fs_youngest_rev' => 'FUNCTION',
+        'svn_import' => 'FUNCTION',
+        'svn_log' => 'FUNCTION',
+        'svn_ls' => 'FUNCTION',
+        'svn_mkdir' => 'FUNCTION',
+        'svn_repos_create' => 'FUNCTION',
+        'svn_repos_fs' => 'FUNCTION',
+        'svn_repos_fs_begin_txn_for_commit' => 'FUNCTION',
+        'svn_repos_fs_commit_txn' => 'FUNCTION',
+        'svn_repos_hotcopy' => 'FUNCTION',
+        'svn_repos_open' => 'FUNCTION',
+        'svn_repos_recover' => 'FUNCTION',
+        'svn_revert' => 'FUNCTION',
+        'svn_status' => 'FUNCTION',
+        'svn_update' => 'FUNCTION',
+        'swf_actiongeturl' => 'FUNCTION',
+        'swf_actiongotoframe' => 'FUNCTION',
+        'swf_actiongotolabel' => 'FUNCTION',
+        'swf_actionnextframe' => 'FUNCTION',
+        'swf_actionplay' => 'FUNCTION',
+        'swf_actionprevframe' => 'FUNCTION',
+        'swf_actionsettarget' => 'FUNCTION',
+        'swf_actionstop' => 'FUNCTION',
+        'swf_actiontogglequality' => 'FUNCTION',
+        'swf_actionwaitforframe' => 'FUNCTION',
+        'swf_addbuttonrecord' => 'FUNCTION',
+        'swf_addcolor' => 'FUNCTION',
+        'swf_closefile' => 'FUNCTION',
+        'swf_definebitmap' => 'FUNCTION',
+        'swf_definefont' => 'FUNCTION',
+        'swf_defineline' => 'FUNCTION',
+        'swf_definepoly' => 'FUNCTION',
+        'swf_definerect' => 'FUNCTION',
+        'swf_definetext' => 'FUNCTION',
+        'swf_endbutton' => 'FUNCTION',
+        'swf_enddoaction' => 'FUNCTION',
+        'swf_endshape' => 'FUNCTION',
+        'swf_endsymbol' => 'FUNCTION',
+        'swf_fontsize' => 'FUNCTION',
+        'swf_fontslant' => 'FUNCTION',
+        'swf_fonttracking' => 'FUNCTION',
+        'swf_getbitmapinfo' => 'FUNCTION',
+        'swf_getfontinfo' => 'FUNCTION',
+        'swf_getframe' => 'FUNCTION',
+        'swf_labelframe' => 'FUNCTION',
+        'swf_lookat' => 'FUNCTION',
+        'swf_modifyobject' => 'FUNCTION',
+        'swf_mulcolor' => 'FUNCTION',
+        'swf_nextid' => 'FUNCTION',
+        'swf_oncondition' => 'FUNCTION',
+        'swf_openfile' => 'FUNCTION',
+        'swf_ortho' => 'FUNCTION',
+        'swf_ortho2' => 'FUNCTION',
+        'swf_perspective' => 'FUNCTION',
+        'swf_placeobject' => 'FUNCTION',
+        'swf_polarview' => 'FUNCTION',
+        'swf_popmatrix' => 'FUNCTION',
+        'swf_posround' => 'FUNCTION',
+        'swf_pushmatrix' => 'FUNCTION',
+        'swf_removeobject' => 'FUNCTION',
+        'swf_rotate' => 'FUNCTION',
+        'swf_scale' => 'FUNCTION',
+        'swf_setfont' => 'FUNCTION',
+        'swf_setframe' => 'FUNCTION',
+        'swf_shapearc' => 'FUNCTION',
+        'swf_shapecurveto' => 'FUNCTION',
+        'swf_shapecurveto3' => 'FUNCTION',
+        'swf_shapefillbitmapclip' => 'FUNCTION',
+        'swf_shapefillbitmaptile' => 'FUNCTION',
+        'swf_shapefilloff' => 'FUNCTION',
+        'swf_shapefillsolid' => 'FUNCTION',
+        'swf_shapelinesolid' => 'FUNCTION',
+        'swf_shapelineto' => 'FUNCTION',
+        'swf_shapemoveto' => 'FUNCTION',
+        'swf_showframe' => 'FUNCTION',
+        'swf_startbutton' => 'FUNCTION',
+        'swf_startdoaction' => 'FUNCTION',
+        'swf_startshape' => 'FUNCTION',
+        'swf_startsymbol' => 'FUNCTION',
+        'swf_textwidth' => 'FUNCTION',
+        'swf_translate' => 'FUNCTION',
+        'swf_viewport' => 'FUNCTION',
+        'swfaction' => 'FUNCTION',
+        'swfbitmap' => 'FUNCTION',
+        'swfbutton' => 'FUNCTION',
+        'swfdisplayitem' => 'FUNCTION',
+        'swffill' => 'FUNCTION',
+        'swffont' => 'FUNCTION',
+        'swffontchar' => 'FUNCTION',
+        'swfgradient' => 'FUNCTION',
+        'swfmorph' => 'FUNCTION',
+        'swfmovie' => 'FUNCTION',
+        'swfprebuiltclip' => 'FUNCTION',
+        'swfshape' => 'FUNCTION',
+        'swfsound' => 'FUNCTION',
+        'swfsoundinstance' => 'FUNCTION',
+        'swfsprite' => 'FUNCTION',
+        'swftext' => 'FUNCTION',
+        'swftextfield' => 'FUNCTION',
+        'swfvideostream' => 'FUNCTION',
+        'swish_construct' => 'FUNCTION',
+        'swish_getmetalist' => 'FUNCTION',
+        'swish_getpropertylist' => 'FUNCTION',
+        'swish_prepare' => 'FUNCTION',
+        'swish_query' => 'FUNCTION',
+        'swishresult_getmetalist' => 'FUNCTION',
+        'swishresult_stem' => 'FUNCTION',
+        'swishresults_getparsedwords' => 'FUNCTION',
+        'swishresults_getremovedstopwords' => 'FUNCTION',
+        'swishresults_nextresult' => 'FUNCTION',
+        'swishresults_seekresult' => 'FUNCTION',
+        'swishsearch_execute' => 'FUNCTION',
+        'swishsearch_resetlimit' => 'FUNCTION',
+        'swishsearch_setlimit' => 'FUNCTION',
+        'swishsearch_setphrasedelimiter' => 'FUNCTION',
+        'swishsearch_setsort' => 'FUNCTION',
+        'swishsearch_setstructure' => 'FUNCTION',
+        'sybase_affected_rows' => 'FUNCTION',
+        'sybase_close' => 'FUNCTION',
+        'sybase_connect' => 'FUNCTION',
+        'sybase_data_seek' => 'FUNCTION',
+        'sybase_deadlock_retry_count' => 'FUNCTION',
+        'sybase_fetch_array' => 'FUNCTION',
+        'sybase_fetch_assoc' => 'FUNCTION',
+        'sybase_fetch_field' => 'FUNCTION',
+        'sybase_fetch_object' => 'FUNCTION',
+        'sybase_fetch_row' => 'FUNCTION',
+        'sybase_field_seek' => 'FUNCTION',
+        'sybase_free_result' => 'FUNCTION',
+        'sybase_get_last_message' => 'FUNCTION',
+        'sybase_min_client_severity' => 'FUNCTION',
+        'sybase_min_error_severity' => 'FUNCTION',
+        'sybase_min_message_severity' => 'FUNCTION',
+        'sybase_min_server_severity' => 'FUNCTION',
+        'sybase_num_fields' => 'FUNCTION',
+        'sybase_num_rows' => 'FUNCTION',
+        'sybase_pconnect' => 'FUNCTION',
+        'sybase_query' => 'FUNCTION',
+        'sybase_result' => 'FUNCTION',
+        'sybase_select_db' => 'FUNCTION',
+        'sybase_set_message_handler' => 'FUNCTION',
+        'sybase_unbuffered_query' => 'FUNCTION',
+        'symlink' => 'FUNCTION',
+        'sys_get_temp_dir' => 'FUNCTION',
+        'sys_getloadavg' => 'FUNCTION',
+        'syslog' => 'FUNCTION',
+        'system' => 'FUNCTION',
+        'tag' => 'FUNCTION',
+        'tan' => 'FUNCTION',
+        'tanh' => 'FUNCTION',
+        'tcpwrap_check' => 'FUNCTION',
+        'tempnam' => 'FUNCTION',
+        'textdomain' => 'FUNCTION',
+        'tidy' => 'FUNCTION',
+        'tidy_access_count' => 'FUNCTION',
+        'tidy_config_count' => 'FUNCTION',
+        'tidy_diagnose' => 'FUNCTION',
+        'tidy_error_count' => 'FUNCTION',
+        'tidy_get_error_buffer' => 'FUNCTION',
+        'tidy_get_output' => 'FUNCTION',
+        'tidy_load_config' => 'FUNCTION',
+        'tidy_reset_config' => 'FUNCTION',
+        'tidy_save_config' => 'FUNCTION',
+        'tidy_set_encoding' => 'FUNCTION',
+        'tidy_setopt' => 'FUNCTION',
+        'tidy_warning_count' => 'FUNCTION',
+        'tidynode' => 'FUNCTION',
+        'time' => 'FUNCTION',
+        'time_nanosleep' => 'FUNCTION',
+        'time_sleep_until' => 'FUNCTION',
+        'timezone_abbreviations_list' => 'FUNCTION',
+        'timezone_identifiers_list' => 'FUNCTION',
+        'timezone_location_get' => 'FUNCTION',
+        'timezone_name_from_abbr' => 'FUNCTION',
+        'timezone_name_get' => 'FUNCTION',
+        'timezone_offset_get' => 'FUNCTION',
+        'timezone_open' => 'FUNCTION',
+        'timezone_transitions_get' => 'FUNCTION',
+        'timezone_version_get' => 'FUNCTION',
+        'tmpfile' => 'FUNCTION',
+        'token_get_all' => 'FUNCTION',
+        'token_name' => 'FUNCTION',
+        'tokyotyrant' => 'FUNCTION',
+        'tokyotyrantquery' => 'FUNCTION',
+        'tokyotyranttable' => 'FUNCTION',
+        'tostring' => 'FUNCTION',
+        'touch' => 'FUNCTION',
+        'transliterator' => 'FUNCTION',
+        'traversable' => 'FUNCTION',
+        'trigger_error' => 'FUNCTION',
+        'trim' => 'FUNCTION',
+        'uasort' => 'FUNCTION',
+        'ucfirst' => 'FUNCTION',
+        'ucwords' => 'FUNCTION',
+        'udm_add_search_limit' => 'FUNCTION',
+        'udm_alloc_agent' => 'FUNCTION',
+        'udm_alloc_agent_array' => 'FUNCTION',
+        'udm_api_version' => 'FUNCTION',
+        'udm_cat_list' => 'FUNCTION',
+        'udm_cat_path' => 'FUNCTION',
+        'udm_check_charset' => 'FUNCTION',
+        'udm_check_stored' => 'FUNCTION',
+        'udm_clear_search_limits' => 'FUNCTION',
+        'udm_close_stored' => 'FUNCTION',
+        'udm_crc32' => 'FUNCTION',
+        'udm_errno' => 'FUNCTION',
+        'udm_error' => 'FUNCTION',
+        'udm_find' => 'FUNCTION',
+        'udm_free_agent' => 'FUNCTION',
+        'udm_free_ispell_data' => 'FUNCTION',
+        'udm_free_res' => 'FUNCTION',
+        'udm_get_doc_count' => 'FUNCTION',
+        'udm_get_res_field' => 'FUNCTION',
+        'udm_get_res_param' => 'FUNCTION',
+        'udm_hash32' => 'FUNCTION',
+        'udm_load_ispell_data' => 'FUNCTION',
+        'udm_open_stored' => 'FUNCTION',
+        'udm_set_agent_param' => 'FUNCTION',
+        'uksort' => 'FUNCTION',
+        'umask' => 'FUNCTION',
+        'underflowexception' => 'FUNCTION',
+        'unexpectedvalueexception' => 'FUNCTION',
+        'uniqid' => 'FUNCTION',
+        'unixtojd' => 'FUNCTION',
+        'unlink' => 'FUNCTION',
+        'unpack' => 'FUNCTION',
+        'unregister_tick_function' => 'FUNCTION',
+        'unserialize' => 'FUNCTION',
+        'unset' => 'FUNCTION',
+        'urldecode' => 'FUNCTION',
+        'urlencode' => 'FUNCTION',
+        'use_soap_error_handler' => 'FUNCTION',
+        'user_error' => 'FUNCTION',
+        'usleep' => 'FUNCTION',
+        'usort' => 'FUNCTION',
+        'utf8_decode' => 'FUNCTION',
+        'utf8_encode' => 'FUNCTION',
+        'v8js' => 'FUNCTION',
+        'v8jsexception' => 'FUNCTION',
+        'var_dump' => 'FUNCTION',
+        'var_export' => 'FUNCTION',
+        'variant' => 'FUNCTION',
+        'variant_abs' => 'FUNCTION',
+        'variant_add' => 'FUNCTION',
+        'variant_and' => 'FUNCTION',
+        'variant_cast' => 'FUNCTION',
+        'variant_cat' => 'FUNCTION',
+        'variant_cmp' => 'FUNCTION',
+        'variant_date_from_timestamp' => 'FUNCTION',
+        'variant_date_to_timestamp' => 'FUNCTION',
+        'variant_div' => 'FUNCTION',
+        'variant_eqv' => 'FUNCTION',
+        'variant_fix' => 'FUNCTION',
+        'variant_get_type' => 'FUNCTION',
+        'variant_idiv' => 'FUNCTION',
+        'variant_imp' => 'FUNCTION',
+        'variant_int' => 'FUNCTION',
+        'variant_mod' => 'FUNCTION',
+        'variant_mul' => 'FUNCTION',
+        'variant_neg' => 'FUNCTION',
+        'variant_not' => 'FUNCTION',
+        'variant_or' => 'FUNCTION',
+        'variant_pow' => 'FUNCTION',
+        'variant_round' => 'FUNCTION',
+        'variant_set' => 'FUNCTION',
+        'variant_set_type' => 'FUNCTION',
+        'variant_sub' => 'FUNCTION',
+        'variant_xor' => 'FUNCTION',
+        'version_compare' => 'FUNCTION',
+        'vfprintf' => 'FUNCTION',
+        'virtual' => 'FUNCTION',
+        'vpopmail_add_alias_domain' => 'FUNCTION',
+        'vpopmail_add_alias_domain_ex' => 'FUNCTION',
+        'vpopmail_add_domain' => 'FUNCTION',
+        'vpopmail_add_domain_ex' => 'FUNCTION',
+        'vpopmail_add_user' => 'FUNCTION',
+        'vpopmail_alias_add' => 'FUNCTION',
+        'vpopmail_alias_del' => 'FUNCTION',
+        'vpopmail_alias_del_domain' => 'FUNCTION',
+        'vpopmail_alias_get' => 'FUNCTION',
+        'vpopmail_alias_get_all' => 'FUNCTION',
+        'vpopmail_auth_user' => 'FUNCTION',
+        'vpopmail_del_domain' => 'FUNCTION',
+        'vpopmail_del_domain_ex' => 'FUNCTION',
+        'vpopmail_del_user' => 'FUNCTION',
+        'vpopmail_error' => 'FUNCTION',
+        'vpopmail_passwd' => 'FUNCTION',
+        'vpopmail_set_user_quota' => 'FUNCTION',
+        'vprintf' => 'FUNCTION',
+        'vsprintf' => 'FUNCTION',
+        'w32api_deftype' => 'FUNCTION',
+        'w32api_init_dtype' => 'FUNCTION',
+        'w32api_invoke_function' => 'FUNCTION',
+        'w32api_register_function' => 'FUNCTION',
+        'w32api_set_call_method' => 'FUNCTION',
+        'wddx_add_vars' => 'FUNCTION',
+        'wddx_deserialize' => 'FUNCTION',
+        'wddx_packet_end' => 'FUNCTION',
+        'wddx_packet_start' => 'FUNCTION',
+        'wddx_serialize_value' => 'FUNCTION',
+        'wddx_serialize_vars' => 'FUNCTION',
+        'wddx_unserialize' => 'FUNCTION',
+        'win32_continue_service' => 'FUNCTION',
+        'win32_create_service' => 'FUNCTION',
+        'win32_delete_service' => 'FUNCTION',
+        'win32_get_last_control_message' => 'FUNCTION',
+        'win32_pause_service' => 'FUNCTION',
+        'win32_ps_list_procs' => 'FUNCTION',
+        'win32_ps_stat_mem' => 'FUNCTION',
+        'win32_ps_stat_proc' => 'FUNCTION',
+        'win32_query_service_status' => 'FUNCTION',
+        'win32_set_service_status' => 'FUNCTION',
+        'win32_start_service' => 'FUNCTION',
+        'win32_start_service_ctrl_dispatcher' => 'FUNCTION',
+        'win32_stop_service' => 'FUNCTION',
+        'wincache_fcache_fileinfo' => 'FUNCTION',
+        'wincache_fcache_meminfo' => 'FUNCTION',
+        'wincache_lock' => 'FUNCTION',
+        'wincache_ocache_fileinfo' => 'FUNCTION',
+        'wincache_ocache_meminfo' => 'FUNCTION',
+        'wincache_refresh_if_changed' => 'FUNCTION',
+        'wincache_rplist_fileinfo' => 'FUNCTION',
+        'wincache_rplist_meminfo' => 'FUNCTION',
+        'wincache_scache_info' => 'FUNCTION',
+        'wincache_scache_meminfo' => 'FUNCTION',
+        'wincache_ucache_add' => 'FUNCTION',
+        'wincache_ucache_cas' => 'FUNCTION',
+        'wincache_ucache_clear' => 'FUNCTION',
+        'wincache_ucache_dec' => 'FUNCTION',
+        'wincache_ucache_delete' => 'FUNCTION',
+        'wincache_ucache_exists' => 'FUNCTION',
+        'wincache_ucache_get' => 'FUNCTION',
+        'wincache_ucache_inc' => 'FUNCTION',
+        'wincache_ucache_info' => 'FUNCTION',
+        'wincache_ucache_meminfo' => 'FUNCTION',
+        'wincache_ucache_set' => 'FUNCTION',
+        'wincache_unlock' => 'FUNCTION',
+        'wordwrap' => 'FUNCTION',
+        'xattr_get' => 'FUNCTION',
+        'xattr_list' => 'FUNCTION',
+        'xattr_remove' => 'FUNCTION',
+        'xattr_set' => 'FUNCTION',
+        'xattr_supported' => 'FUNCTION',
+        'xdiff_file_bdiff' => 'FUNCTION',
+        'xdiff_file_bdiff_size' => 'FUNCTION',
+        'xdiff_file_bpatch' => 'FUNCTION',
+        'xdiff_file_diff' => 'FUNCTION',
+        'xdiff_file_diff_binary' => 'FUNCTION',
+        'xdiff_file_merge3' => 'FUNCTION',
+        'xdiff_file_patch' => 'FUNCTION',
+        'xdiff_file_patch_binary' => 'FUNCTION',
+        'xdiff_file_rabdiff' => 'FUNCTION',
+        'xdiff_string_bdiff' => 'FUNCTION',
+        'xdiff_string_bdiff_size' => 'FUNCTION',
+        'xdiff_string_bpatch' => 'FUNCTION',
+        'xdiff_string_diff' => 'FUNCTION',
+        'xdiff_string_diff_binary' => 'FUNCTION',
+        'xdiff_string_merge3' => 'FUNCTION',
+        'xdiff_string_patch' => 'FUNCTION',
+        'xdiff_string_patch_binary' => 'FUNCTION',
+        'xdiff_string_rabdiff' => 'FUNCTION',
+        'xml_error_string' => 'FUNCTION',
+        'xml_get_current_byte_index' => 'FUNCTION',
+        'xml_get_current_column_number' => 'FUNCTION',
+        'xml_get_current_line_number' => 'FUNCTION',
+        'xml_get_error_code' => 'FUNCTION',
+        'xml_parse' => 'FUNCTION',
+        'xml_parse_into_struct' => 'FUNCTION',
+        'xml_parser_create' => 'FUNCTION',
+        'xml_parser_create_ns' => 'FUNCTION',
+        'xml_parser_free' => 'FUNCTION',
+        'xml_parser_get_option' => 'FUNCTION',
+        'xml_parser_set_option' => 'FUNCTION',
+        'xml_set_character_data_handler' => 'FUNCTION',
+        'xml_set_default_handler' => 'FUNCTION',
+        'xml_set_element_handler' => 'FUNCTION',
+        'xml_set_end_namespace_decl_handler' => 'FUNCTION',
+        'xml_set_external_entity_ref_handler' => 'FUNCTION',
+        'xml_set_notation_decl_handler' => 'FUNCTION',
+        'xml_set_object' => 'FUNCTION',
+        'xml_set_processing_instruction_handler' => 'FUNCTION',
+        'xml_set_start_namespace_decl_handler' => 'FUNCTION',
+        'xml_set_unparsed_entity_decl_handler' => 'FUNCTION',
+        'xmlreader' => 'FUNCTION',
+        'xmlrpc_decode' => 'FUNCTION',
+        'xmlrpc_decode_request' => 'FUNCTION',
+        'xmlrpc_encode' => 'FUNCTION',
+        'xmlrpc_encode_request' => 'FUNCTION',
+        'xmlrpc_get_type' => 'FUNCTION',
+        'xmlrpc_is_fault' => 'FUNCTION',
+        'xmlrpc_parse_method_descriptions' => 'FUNCTION',
+        'xmlrpc_server_add_introspection_data' => 'FUNCTION',
+        'xmlrpc_server_call_method' => 'FUNCTION',
+        'xmlrpc_server_create' => 'FUNCTION',
+        'xmlrpc_server_destroy' => 'FUNCTION',
+        'xmlrpc_server_register_introspection_callback' => 'FUNCTION',
+        'xmlrpc_server_register_method' => 'FUNCTION',
+        'xmlrpc_set_type' => 'FUNCTION',
+        'xmlwriter_end_attribute' => 'FUNCTION',
+        'xmlwriter_end_cdata' => 'FUNCTION',
+        'xmlwriter_end_comment' => 'FUNCTION',
+        'xmlwriter_end_document' => 'FUNCTION',
+        'xmlwriter_end_dtd' => 'FUNCTION',
+        'xmlwriter_end_dtd_attlist' => 'FUNCTION',
+        'xmlwriter_end_dtd_element' => 'FUNCTION',
+        'xmlwriter_end_dtd_entity' => 'FUNCTION',
+        'xmlwriter_end_element' => 'FUNCTION',
+        'xmlwriter_end_pi' => 'FUNCTION',
+        'xmlwriter_flush' => 'FUNCTION',
+        'xmlwriter_full_end_element' => 'FUNCTION',
+        'xmlwriter_open_memory' => 'FUNCTION',
+        'xmlwriter_open_uri' => 'FUNCTION',
+        'xmlwriter_output_memory' => 'FUNCTION',
+        'xmlwriter_set_indent' => 'FUNCTION',
+        'xmlwriter_set_indent_string' => 'FUNCTION',
+        'xmlwriter_start_attribute' => 'FUNCTION',
+        'xmlwriter_start_attribute_ns' => 'FUNCTION',
+        'xmlwriter_start_cdata' => 'FUNCTION',
+        'xmlwriter_start_comment' => 'FUNCTION',
+        'xmlwriter_start_document' => 'FUNCTION',
+        'xmlwriter_start_dtd' => 'FUNCTION',
+        'xmlwriter_start_dtd_attlist' => 'FUNCTION',
+        'xmlwriter_start_dtd_element' => 'FUNCTION',
+        'xmlwriter_start_dtd_entity' => 'FUNCTION',
+        'xmlwriter_start_element' => 'FUNCTION',
+        'xmlwriter_start_element_ns' => 'FUNCTION',
+        'xmlwriter_start_pi' => 'FUNCTION',
+        'xmlwriter_text' => 'FUNCTION',
+        'xmlwriter_write_attribute' => 'FUNCTION',
+        'xmlwriter_write_attribute_ns' => 'FUNCTION',
+        'xmlwriter_write_cdata' => 'FUNCTION',
+        'xmlwriter_write_comment' => 'FUNCTION',
+        'xmlwriter_write_dtd' => 'FUNCTION',
+        'xmlwriter_write_dtd_attlist' => 'FUNCTION',
+        'xmlwriter_write_dtd_element' => 'FUNCTION',
+        'xmlwriter_write_dtd_entity' => 'FUNCTION',
+        'xmlwriter_write_element' => 'FUNCTION',
+        'xmlwriter_write_element_ns' => 'FUNCTION',
+        'xmlwriter_write_pi' => 'FUNCTION',
+        'xmlwriter_write_raw' => 'FUNCTION',
+        'xpath_eval' => 'FUNCTION',
+        'xpath_eval_expression' => 'FUNCTION',
+        'xpath_new_context' => 'FUNCTION',
+        'xpath_register_ns' => 'FUNCTION',
+        'xpath_register_ns_auto' => 'FUNCTION',
+        'xptr_eval' => 'FUNCTION',
+        'xptr_new_context' => 'FUNCTION',
+        'xslt_backend_info' => 'FUNCTION',
+        'xslt_backend_name' => 'FUNCTION',
+        'xslt_backend_version' => 'FUNCTION',
+        'xslt_create' => 'FUNCTION',
+        'xslt_errno' => 'FUNCTION',
+        'xslt_error' => 'FUNCTION',
+        'xslt_free' => 'FUNCTION',
+        'xslt_getopt' => 'FUNCTION',
+        'xslt_process' => 'FUNCTION',
+        'xslt_set_base' => 'FUNCTION',
+        'xslt_set_encoding' => 'FUNCTION',
+        'xslt_set_error_handler' => 'FUNCTION',
+        'xslt_set_log' => 'FUNCTION',
+        'xslt_set_object' => 'FUNCTION',
+        'xslt_set_sax_handler' => 'FUNCTION',
+        'xslt_set_sax_handlers' => 'FUNCTION',
+        'xslt_set_scheme_handler' => 'FUNCTION',
+        'xslt_set_scheme_handlers' => 'FUNCTION',
+        'xslt_setopt' => 'FUNCTION',
+        'xsltprocessor' => 'FUNCTION',
+        'yaml_emit' => 'FUNCTION',
+        'yaml_emit_file' => 'FUNCTION',
+        'yaml_parse' => 'FUNCTION',
+        'yaml_parse_file' => 'FUNCTION',
+        'yaml_parse_url' => 'FUNCTION',
+        'yaz_addinfo' => 'FUNCTION',
+        'yaz_ccl_conf' => 'FUNCTION',
+        'yaz_ccl_parse' => 'FUNCTION',
+        'yaz_close' => 'FUNCTION',
+        'yaz_connect' => 'FUNCTION',
+        'yaz_database' => 'FUNCTION',
+        'yaz_element' => 'FUNCTION',
+        'yaz_errno' => 'FUNCTION',
+        'yaz_error' => 'FUNCTION',
+        'yaz_es' => 'FUNCTION',
+        'yaz_es_result' => 'FUNCTION',
+        'yaz_get_option' => 'FUNCTION',
+        'yaz_hits' => 'FUNCTION',
+        'yaz_itemorder' => 'FUNCTION',
+        'yaz_present' => 'FUNCTION',
+        'yaz_range' => 'FUNCTION',
+        'yaz_record' => 'FUNCTION',
+        'yaz_scan' => 'FUNCTION',
+        'yaz_scan_result' => 'FUNCTION',
+        'yaz_schema' => 'FUNCTION',
+        'yaz_search' => 'FUNCTION',
+        'yaz_set_option' => 'FUNCTION',
+        'yaz_sort' => 'FUNCTION',
+        'yaz_syntax' => 'FUNCTION',
+        'yaz_wait' => 'FUNCTION',
+        'yp_all' => 'FUNCTION',
+        'yp_cat' => 'FUNCTION',
+        'yp_err_string' => 'FUNCTION',
+        'yp_errno' => 'FUNCTION',
+        'yp_first' => 'FUNCTION',
+        'yp_get_default_domain' => 'FUNCTION',
+        'yp_master' => 'FUNCTION',
+        'yp_match' => 'FUNCTION',
+        'yp_next' => 'FUNCTION',
+        'yp_order' => 'FUNCTION',
+        'zend_logo_guid' => 'FUNCTION',
+        'zend_thread_id' => 'FUNCTION',
+        'zend_version' => 'FUNCTION',
+        'zip_close' => 'FUNCTION',
+        'zip_entry_close' => 'FUNCTION',
+        'zip_entry_compressedsize' => 'FUNCTION',
+        'zip_entry_compressionmethod' => 'FUNCTION',
+        'zip_entry_filesize' => 'FUNCTION',
+        'zip_entry_name' => 'FUNCTION',
+        'zip_entry_open' => 'FUNCTION',
+        'zip_entry_read' => 'FUNCTION',
+        'zip_open' => 'FUNCTION',
+        'zip_read' => 'FUNCTION',
+        'ziparchive' => 'FUNCTION',
+        'ziparchive_addemptydir' => 'FUNCTION',
+        'ziparchive_addfile' => 'FUNCTION',
+        'ziparchive_addfromstring' => 'FUNCTION',
+        'ziparchive_close' => 'FUNCTION',
+        'ziparchive_deleteindex' => 'FUNCTION',
+        'ziparchive_deletename' => 'FUNCTION',
+        'ziparchive_extractto' => 'FUNCTION',
+        'ziparchive_getarchivecomment' => 'FUNCTION',
+        'ziparchive_getcommentindex' => 'FUNCTION',
+        'ziparchive_getcommentname' => 'FUNCTION',
+        'ziparchive_getfromindex' => 'FUNCTION',
+        'ziparchive_getfromname' => 'FUNCTION',
+        'ziparchive_getnameindex' => 'FUNCTION',
+        'ziparchive_getstatusstring' => 'FUNCTION',
+        'ziparchive_getstream' => 'FUNCTION',
+        'ziparchive_locatename' => 'FUNCTION',
+        'ziparchive_open' => 'FUNCTION',
+        'ziparchive_renameindex' => 'FUNCTION',
+        'ziparchive_renamename' => 'FUNCTION',
+        'ziparchive_setcommentname' => 'FUNCTION',
+        'ziparchive_setarchivecomment' => 'FUNCTION',
+        'ziparchive_setcommentindex' => 'FUNCTION',
+        'ziparchive_statindex' => 'FUNCTION',
+        'ziparchive_statname' => 'FUNCTION',
+        'ziparchive_unchangeall' => 'FUNCTION',
+        'ziparchive_unchangearchive' => 'FUNCTION',
+        'ziparchive_unchangeindex' => 'FUNCTION',
+        'ziparchive_unchangename' => 'FUNCTION',
+        'zlib_get_coding_type' => 'FUNCTION',
+        'abstract' => 'KEYWORD',
+        'and' => 'KEYWORD',
+        'as' => 'KEYWORD',
+        'break' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'cfunction' => 'KEYWORD',
+        'class' => 'KEYWORD',
+        'clone' => 'KEYWORD',
+        'const' => 'KEYWORD',
+        'continue' => 'KEYWORD',
+        'declare' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'elseif' => 'KEYWORD',
+        'enddeclare' => 'KEYWORD',
+        'endfor' => 'KEYWORD',
+        'endforeach' => 'KEYWORD',
+        'endif' => 'KEYWORD',
+        'endswitch' => 'KEYWORD',
+        'endwhile' => 'KEYWORD',
+        'extends' => 'KEYWORD',
+        'final' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'foreach' => 'KEYWORD',
+        'function' => 'KEYWORD',
+        'global' => 'KEYWORD',
+        'goto' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'implements' => 'KEYWORD',
+        'interface' => 'KEYWORD',
+        'instanceof' => 'KEYWORD',
+        'namespace' => 'KEYWORD',
+        'new' => 'KEYWORD',
+        'old_function' => 'KEYWORD',
+        'or' => 'KEYWORD',
+        'private' => 'KEYWORD',
+        'protected' => 'KEYWORD',
+        'public' => 'KEYWORD',
+        'static' => 'KEYWORD',
+        'switch' => 'KEYWORD',
+        'throw' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'use' => 'KEYWORD',
+        'var' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'xor' => 'KEYWORD',
+        '__class__' => 'KEYWORD',
+        '__dir__' => 'KEYWORD',
+        '__file__' => 'KEYWORD',
+        '__line__' => 'KEYWORD',
+        '__function__' => 'KEYWORD',
+        '__method__' => 'KEYWORD',
+        '__namespace__' => 'KEYWORD',
+        'true' => 'KEYWORD',
+        'false' => 'KEYWORD',
+        'null' => 'KEYWORD',
+        'return' => 'KEYWORD'
+    );
+}
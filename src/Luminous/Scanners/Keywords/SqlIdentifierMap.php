@@ -0,0 +1,367 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from SqlKeywords by generate.php, do not edit.
+ */
+class SqlIdentifierMap
+{
+    public static $NAMES = array('KEYWORD', 'TYPE', 'VALUE', 'OPERATOR', 'FUNCTION');
+
+    public static $MAP = array(
+        'abort' => 'KEYWORD',
+        'action' => 'KEYWORD',
+        'add' => 'KEYWORD',
+        'after' => 'KEYWORD',
+        'all' => 'KEYWORD',
+        'alter' => 'KEYWORD',
+        'analyze' => 'KEYWORD',
+        'as' => 'KEYWORD',
+        'asc' => 'KEYWORD',
+        'attach' => 'KEYWORD',
+        'autoincrement' => 'KEYWORD',
+        'auto_increment' => 'KEYWORD',
+        'before' => 'KEYWORD',
+        'begin' => 'KEYWORD',
+        'by' => 'KEYWORD',
+        'cascade' => 'KEYWORD',
+        'cast' => 'KEYWORD',
+        'check' => 'KEYWORD',
+        'collate' => 'KEYWORD',
+        'column' => 'KEYWORD',
+        'commit' => 'KEYWORD',
+        'conflict' => 'KEYWORD',
+        'constraint' => 'KEYWORD',
+        'create' => 'KEYWORD',
+        'cross' => 'KEYWORD',
+        'current_date' => 'KEYWORD',
+        'current_time' => 'KEYWORD',
+        'current_timestamp' => 'KEYWORD',
+        'database' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'deferrable' => 'KEYWORD',
+        'deferred' => 'KEYWORD',
+        'delete' => 'KEYWORD',
+        'desc' => 'KEYWORD',
+        'detach' => 'KEYWORD',
+        'distinct' => 'KEYWORD',
+        'drop' => 'KEYWORD',
+        'each' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'end' => 'KEYWORD',
+        'escape' => 'KEYWORD',
+        'except' => 'KEYWORD',
+        'exclusive' => 'KEYWORD',
+        'exists' => 'KEYWORD',
+        'explain' => 'KEYWORD',
+        'fail' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'foreign' => 'KEYWORD',
+        'from' => 'KEYWORD',
+        'full' => 'KEYWORD',
+        'glob' => 'KEYWORD',
+        'group' => 'KEYWORD',
+        'having' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'ignore' => 'KEYWORD',
+        'immediate' => 'KEYWORD',
+        'in' => 'KEYWORD',
+        'index' => 'KEYWORD',
+        'indexed' => 'KEYWORD',
+        'inititially' => 'KEYWORD',
+        'inner' => 'KEYWORD',
+        'insert' => 'KEYWORD',
+        'instead' => 'KEYWORD',
+        'intersect' => 'KEYWORD',
+        'into' => 'KEYWORD',
+        'isnull' => 'KEYWORD',
+        'join' => 'KEYWORD',
+        'key' => 'KEYWORD',
+        'left' => 'KEYWORD',
+        'like' => 'KEYWORD',
+        'limit' => 'KEYWORD',
+        'match' => 'KEYWORD',
+        'natural' => 'KEYWORD',
+        'no' => 'KEYWORD',
+        'notnull' => 'KEYWORD',
+        'of' => 'KEYWORD',
+        'offset' => 'KEYWORD',
+        'on' => 'KEYWORD',
+        'or' => 'KEYWORD',
+        'order' => 'KEYWORD',
+        'outer' => 'KEYWORD',
+        'plan' => 'KEYWORD',
+        'pragma' => 'KEYWORD',
+        'primary' => 'KEYWORD',
+        'query' => 'KEYWORD',
+        'raise' => 'KEYWORD',
+        'references' => 'KEYWORD',
+        'regexp' => 'KEYWORD',
+        'reindex' => 'KEYWORD',
+        'release' => 'KEYWORD',
+        'rename' => 'KEYWORD',
+        'replace' => 'KEYWORD',
+        'restrict' => 'KEYWORD',
+        'right' => 'KEYWORD',
+        'rollback' => 'KEYWORD',
+        'row' => 'KEYWORD',
+        'savepoint' => 'KEYWORD',
+        'select' => 'KEYWORD',
+        'set' => 'KEYWORD',
+        'table' => 'KEYWORD',
+        'temp' => 'KEYWORD',
+        'temporary' => 'KEYWORD',
+        'then' => 'KEYWORD',
+        'to' => 'KEYWORD',
+        'transaction' => 'KEYWORD',
+        'trigger' => 'KEYWORD',
+        'union' => 'KEYWORD',
+        'unique' => 'KEYWORD',
+        'update' => 'KEYWORD',
+        'using' => 'KEYWORD',
+        'vacuum' => 'KEYWORD',
+        'values' => 'KEYWORD',
+        'view' => 'KEYWORD',
+        'virtual' => 'KEYWORD',
+        'when' => 'KEYWORD',
+        'where' => 'KEYWORD',
+        'with' => 'KEYWORD',
+        'signed' => 'KEYWORD',
+        'unsigned' => 'KEYWORD',
+        'zerofill' => 'KEYWORD',
+        'minvalue' => 'KEYWORD',
+        'maxvalue' => 'KEYWORD',
+        'start' => 'KEYWORD',
+        'binary' => 'TYPE',
+        'bit' => 'TYPE',
+        'bigint' => 'TYPE',
+        'biginteger' => 'TYPE',
+        'blob' => 'TYPE',
+        'char' => 'TYPE',
+        'clob' => 'TYPE',
+        'date' => 'TYPE',
+        'datetime' => 'TYPE',
+        'dec' => 'TYPE',
+        'decimal' => 'TYPE',
+        'double' => 'TYPE',
+        'double_precision' => 'TYPE',
+        'enum' => 'TYPE',
+        'fixed' => 'TYPE',
+        'float' => 'TYPE',
+        'int' => 'TYPE',
+        'integer' => 'TYPE',
+        'mediumint' => 'TYPE',
+        'mediuminteger' => 'TYPE',
+        'numeric' => 'TYPE',
+        'real' => 'TYPE',
+        'smallint' => 'TYPE',
+        'smallinteger' => 'TYPE',
+        'text' => 'TYPE',
+        'time' => 'TYPE',
+        'timestamp' => 'TYPE',
+        'tinyint' => 'TYPE',
+        'tinyinteger' => 'TYPE',
+        'varbinary' => 'TYPE',
+        'varchar' => 'TYPE',
+        'year' => 'TYPE',
+        'zone' => 'TYPE',
+        'null' => 'VALUE',
+        'and' => 'OPERATOR',
+        'between' => 'OPERATOR',
+        'case' => 'OPERATOR',
+        'div' => 'OPERATOR',
+        'is' => 'OPERATOR',
+        'not' => 'OPERATOR',
+        'sounds' => 'OPERATOR',
+        'xor' => 'OPERATOR',
+        'abs' => 'FUNCTION',
+        'acos' => 'FUNCTION',
+        'adddate' => 'FUNCTION',
+        'addtime' => 'FUNCTION',
+        'aes_decrypt' => 'FUNCTION',
+        'aes_encrypt' => 'FUNCTION',
+        'ascii' => 'FUNCTION',
+        'asin' => 'FUNCTION',
+        'atan2' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'avg' => 'FUNCTION',
+        'benchmark' => 'FUNCTION',
+        'bin' => 'FUNCTION',
+        'bit_and' => 'FUNCTION',
+        'bit_count' => 'FUNCTION',
+        'bit_length' => 'FUNCTION',
+        'bit_or' => 'FUNCTION',
+        'bit_xor' => 'FUNCTION',
+        'ceil' => 'FUNCTION',
+        'ceiling' => 'FUNCTION',
+        'char_length' => 'FUNCTION',
+        'character_length' => 'FUNCTION',
+        'charset' => 'FUNCTION',
+        'coalesce' => 'FUNCTION',
+        'coercibility' => 'FUNCTION',
+        'collation' => 'FUNCTION',
+        'compress' => 'FUNCTION',
+        'concat_ws' => 'FUNCTION',
+        'concat' => 'FUNCTION',
+        'connection_id' => 'FUNCTION',
+        'conv' => 'FUNCTION',
+        'convert_tz' => 'FUNCTION',
+        'convert' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'cot' => 'FUNCTION',
+        'count' => 'FUNCTION',
+        'crc32' => 'FUNCTION',
+        'curdate' => 'FUNCTION',
+        'current_user' => 'FUNCTION',
+        'curtime' => 'FUNCTION',
+        'date_add' => 'FUNCTION',
+        'date_format' => 'FUNCTION',
+        'date_sub' => 'FUNCTION',
+        'datediff' => 'FUNCTION',
+        'day' => 'FUNCTION',
+        'dayname' => 'FUNCTION',
+        'dayofmonth' => 'FUNCTION',
+        'dayofweek' => 'FUNCTION',
+        'dayofyear' => 'FUNCTION',
+        'decode' => 'FUNCTION',
+        'degrees' => 'FUNCTION',
+        'des_decrypt' => 'FUNCTION',
+        'des_encrypt' => 'FUNCTION',
+        'elt' => 'FUNCTION',
+        'encode' => 'FUNCTION',
+        'encrypt' => 'FUNCTION',
+        'exp' => 'FUNCTION',
+        'export_set' => 'FUNCTION',
+        'extract' => 'FUNCTION',
+        'field' => 'FUNCTION',
+        'find_in_set' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'format' => 'FUNCTION',
+        'found_rows' => 'FUNCTION',
+        'from_days' => 'FUNCTION',
+        'from_unixtime' => 'FUNCTION',
+        'get_format' => 'FUNCTION',
+        'get_lock' => 'FUNCTION',
+        'greatest' => 'FUNCTION',
+        'group_concat' => 'FUNCTION',
+        'hex' => 'FUNCTION',
+        'hour' => 'FUNCTION',
+        'ifnull' => 'FUNCTION',
+        'inet_aton' => 'FUNCTION',
+        'inet_ntoa' => 'FUNCTION',
+        'instr' => 'FUNCTION',
+        'interval' => 'FUNCTION',
+        'is_free_lock' => 'FUNCTION',
+        'is_used_lock' => 'FUNCTION',
+        'last_day' => 'FUNCTION',
+        'last_insert_id' => 'FUNCTION',
+        'lcase' => 'FUNCTION',
+        'least' => 'FUNCTION',
+        'length' => 'FUNCTION',
+        'ln' => 'FUNCTION',
+        'load_file' => 'FUNCTION',
+        'localtime' => 'FUNCTION',
+        'localtimestamp,' => 'FUNCTION',
+        'locate' => 'FUNCTION',
+        'log10' => 'FUNCTION',
+        'log2' => 'FUNCTION',
+        'log' => 'FUNCTION',
+        'lower' => 'FUNCTION',
+        'lpad' => 'FUNCTION',
+        'ltrim' => 'FUNCTION',
+        'make_set' => 'FUNCTION',
+        'makedate' => 'FUNCTION',
+        'maketime' => 'FUNCTION',
+        'master_pos_wait' => 'FUNCTION',
+        'max' => 'FUNCTION',
+        'md5' => 'FUNCTION',
+        'microsecond' => 'FUNCTION',
+        'mid' => 'FUNCTION',
+        'min' => 'FUNCTION',
+        'minute' => 'FUNCTION',
+        'mod' => 'FUNCTION',
+        'month' => 'FUNCTION',
+        'monthname' => 'FUNCTION',
+        'name_const' => 'FUNCTION',
+        'now' => 'FUNCTION',
+        'nullif' => 'FUNCTION',
+        'oct' => 'FUNCTION',
+        'octet_length' => 'FUNCTION',
+        'old_password' => 'FUNCTION',
+        'ord' => 'FUNCTION',
+        'password' => 'FUNCTION',
+        'period_add' => 'FUNCTION',
+        'period_diff' => 'FUNCTION',
+        'pi' => 'FUNCTION',
+        'position' => 'FUNCTION',
+        'pow' => 'FUNCTION',
+        'power' => 'FUNCTION',
+        'analyse' => 'FUNCTION',
+        'quarter' => 'FUNCTION',
+        'quote' => 'FUNCTION',
+        'radians' => 'FUNCTION',
+        'rand' => 'FUNCTION',
+        'release_lock' => 'FUNCTION',
+        'repeat' => 'FUNCTION',
+        'reverse' => 'FUNCTION',
+        'rlike' => 'FUNCTION',
+        'round' => 'FUNCTION',
+        'row_count' => 'FUNCTION',
+        'rpad' => 'FUNCTION',
+        'rtrim' => 'FUNCTION',
+        'schema' => 'FUNCTION',
+        'sec_to_time' => 'FUNCTION',
+        'second' => 'FUNCTION',
+        'session_user' => 'FUNCTION',
+        'sha1' => 'FUNCTION',
+        'sign' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sleep' => 'FUNCTION',
+        'soundex' => 'FUNCTION',
+        'space' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'std' => 'FUNCTION',
+        'stddev_pop' => 'FUNCTION',
+        'stddev_samp' => 'FUNCTION',
+        'stddev' => 'FUNCTION',
+        'str_to_date' => 'FUNCTION',
+        'strcmp' => 'FUNCTION',
+        'subdate' => 'FUNCTION',
+        'substr' => 'FUNCTION',
+        'substring_index' => 'FUNCTION',
+        'substring' => 'FUNCTION',
+        'subtime' => 'FUNCTION',
+        'sum' => 'FUNCTION',
+        'sysdate' => 'FUNCTION',
+        'system_user' => 'FUNCTION',
+        'tan' => 'FUNCTION',
+        'time_format' => 'FUNCTION',
+        'time_to_sec' => 'FUNCTION',
+        'timediff' => 'FUNCTION',
+        'timestampadd' => 'FUNCTION',
+        'timestampdiff' => 'FUNCTION',
+        'to_days' => 'FUNCTION',
+        'trim' => 'FUNCTION',
+        'truncate' => 'FUNCTION',
+        'ucase' => 'FUNCTION',
+        'uncompress' => 'FUNCTION',
+        'uncompressed_length' => 'FUNCTION',
+        'unhex' => 'FUNCTION',
+        'unix_timestamp' => 'FUNCTION',
+        'upper' => 'FUNCTION',
+        'user' => 'FUNCTION',
+        'utc_date' => 'FUNCTION',
+        'utc_time' => 'FUNCTION',
+        'utc_timestamp' => 'FUNCTION',
+        'uuid' => 'FUNCTION',
+        'var_pop' => 'FUNCTION',
+        'var_samp' => 'FUNCTION',
+        'variance' => 'FUNCTION',
+        'version' => 'FUNCTION',
+        'week' => 'FUNCTION',
+        'weekday' => 'FUNCTION',
+        'weekofyear' => 'FUNCTION',
+        'yearweek' => 'FUNCTION'
+    );
+}
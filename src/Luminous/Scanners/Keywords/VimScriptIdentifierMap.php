@@ -0,0 +1,1636 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from VimScriptKeywords by generate.php, do not edit.
+ */
+class VimScriptIdentifierMap
+{
+    public static $NAMES = array('FUNCTION', 'KEYWORD');
+
+    public static $MAP = array(
+        'abs' => 'FUNCTION',
+        'add' => 'FUNCTION',
+        'append' => 'FUNCTION',
+        'argc' => 'FUNCTION',
+        'argidx' => 'FUNCTION',
+        'argv' => 'FUNCTION',
+        'atan' => 'FUNCTION',
+        'browse' => 'FUNCTION',
+        'browsedir' => 'FUNCTION',
+        'bufexists' => 'FUNCTION',
+        'buflisted' => 'FUNCTION',
+        'bufloaded' => 'FUNCTION',
+        'bufname' => 'FUNCTION',
+        'bufnr' => 'FUNCTION',
+        'bufwinnr' => 'FUNCTION',
+        'byte2line' => 'FUNCTION',
+        'byteidx' => 'FUNCTION',
+        'call' => 'FUNCTION',
+        'ceil' => 'FUNCTION',
+        'changenr' => 'FUNCTION',
+        'char2nr' => 'FUNCTION',
+        'cindent' => 'FUNCTION',
+        'clearmatches' => 'FUNCTION',
+        'col' => 'FUNCTION',
+        'complete' => 'FUNCTION',
+        'complete_add' => 'FUNCTION',
+        'complete_check' => 'FUNCTION',
+        'confirm' => 'FUNCTION',
+        'copy' => 'FUNCTION',
+        'cos' => 'FUNCTION',
+        'count' => 'FUNCTION',
+        'cscope_connection' => 'FUNCTION',
+        'cursor' => 'FUNCTION',
+        'deepcopy' => 'FUNCTION',
+        'delete' => 'FUNCTION',
+        'did_filetype' => 'FUNCTION',
+        'diff_filler' => 'FUNCTION',
+        'diff_hlID' => 'FUNCTION',
+        'empty' => 'FUNCTION',
+        'escape' => 'FUNCTION',
+        'eval' => 'FUNCTION',
+        'eventhandler' => 'FUNCTION',
+        'executable' => 'FUNCTION',
+        'exists' => 'FUNCTION',
+        'expand' => 'FUNCTION',
+        'expr8' => 'FUNCTION',
+        'extend' => 'FUNCTION',
+        'feedkeys' => 'FUNCTION',
+        'filereadable' => 'FUNCTION',
+        'filewritable' => 'FUNCTION',
+        'filter' => 'FUNCTION',
+        'finddir' => 'FUNCTION',
+        'findfile' => 'FUNCTION',
+        'float2nr' => 'FUNCTION',
+        'floor' => 'FUNCTION',
+        'fnameescape' => 'FUNCTION',
+        'fnamemodify' => 'FUNCTION',
+        'foldclosed' => 'FUNCTION',
+        'foldclosedend' => 'FUNCTION',
+        'foldlevel' => 'FUNCTION',
+        'foldtext' => 'FUNCTION',
+        'foldtextresult' => 'FUNCTION',
+        'foreground' => 'FUNCTION',
+        'function' => 'FUNCTION',
+        'garbagecollect' => 'FUNCTION',
+        'get' => 'FUNCTION',
+        'getbufline' => 'FUNCTION',
+        'getbufvar' => 'FUNCTION',
+        'getchar' => 'FUNCTION',
+        'getcharmod' => 'FUNCTION',
+        'getcmdline' => 'FUNCTION',
+        'getcmdpos' => 'FUNCTION',
+        'getcmdtype' => 'FUNCTION',
+        'getcwd' => 'FUNCTION',
+        'getfontname' => 'FUNCTION',
+        'getfperm' => 'FUNCTION',
+        'getfsize' => 'FUNCTION',
+        'getftime' => 'FUNCTION',
+        'getftype' => 'FUNCTION',
+        'getline' => 'FUNCTION',
+        'getloclist' => 'FUNCTION',
+        'getmatches' => 'FUNCTION',
+        'getpid' => 'FUNCTION',
+        'getpos' => 'FUNCTION',
+        'getqflist' => 'FUNCTION',
+        'getreg' => 'FUNCTION',
+        'getregtype' => 'FUNCTION',
+        'gettabwinvar' => 'FUNCTION',
+        'getwinposx' => 'FUNCTION',
+        'getwinposy' => 'FUNCTION',
+        'getwinvar' => 'FUNCTION',
+        'glob' => 'FUNCTION',
+        'globpath' => 'FUNCTION',
+        'has' => 'FUNCTION',
+        'has_key' => 'FUNCTION',
+        'haslocaldir' => 'FUNCTION',
+        'hasmapto' => 'FUNCTION',
+        'histadd' => 'FUNCTION',
+        'histdel' => 'FUNCTION',
+        'histget' => 'FUNCTION',
+        'histnr' => 'FUNCTION',
+        'hlID' => 'FUNCTION',
+        'hlexists' => 'FUNCTION',
+        'hostname' => 'FUNCTION',
+        'iconv' => 'FUNCTION',
+        'indent' => 'FUNCTION',
+        'index' => 'FUNCTION',
+        'input' => 'FUNCTION',
+        'inputdialog' => 'FUNCTION',
+        'inputlist' => 'FUNCTION',
+        'inputrestore' => 'FUNCTION',
+        'inputsave' => 'FUNCTION',
+        'inputsecret' => 'FUNCTION',
+        'insert' => 'FUNCTION',
+        'isdirectory' => 'FUNCTION',
+        'islocked' => 'FUNCTION',
+        'items' => 'FUNCTION',
+        'join' => 'FUNCTION',
+        'keys' => 'FUNCTION',
+        'len' => 'FUNCTION',
+        'libcall' => 'FUNCTION',
+        'libcallnr' => 'FUNCTION',
+        'line' => 'FUNCTION',
+        'line2byte' => 'FUNCTION',
+        'lispindent' => 'FUNCTION',
+        'localtime' => 'FUNCTION',
+        'log10' => 'FUNCTION',
+        'map' => 'FUNCTION',
+        'maparg' => 'FUNCTION',
+        'mapcheck' => 'FUNCTION',
+        'match' => 'FUNCTION',
+        'matchadd' => 'FUNCTION',
+        'matcharg' => 'FUNCTION',
+        'matchdelete' => 'FUNCTION',
+        'matchend' => 'FUNCTION',
+        'matchlist' => 'FUNCTION',
+        'matchstr' => 'FUNCTION',
+        'max' => 'FUNCTION',
+        'min' => 'FUNCTION',
+        'mkdir' => 'FUNCTION',
+        'mode' => 'FUNCTION',
+        'nextnonblank' => 'FUNCTION',
+        'nr2char' => 'FUNCTION',
+        'pathshorten' => 'FUNCTION',
+        'pow' => 'FUNCTION',
+        'prevnonblank' => 'FUNCTION',
+        'printf' => 'FUNCTION',
+        'pumvisible' => 'FUNCTION',
+        'range' => 'FUNCTION',
+        'readfile' => 'FUNCTION',
+        'reltime' => 'FUNCTION',
+        'reltimestr' => 'FUNCTION',
+        'remote_expr' => 'FUNCTION',
+        'remote_foreground' => 'FUNCTION',
+        'remote_peek' => 'FUNCTION',
+        'remote_read' => 'FUNCTION',
+        'remote_send' => 'FUNCTION',
+        'remove' => 'FUNCTION',
+        'rename' => 'FUNCTION',
+        'repeat' => 'FUNCTION',
+        'resolve' => 'FUNCTION',
+        'reverse' => 'FUNCTION',
+        'round' => 'FUNCTION',
+        'search' => 'FUNCTION',
+        'searchdecl' => 'FUNCTION',
+        'searchpair' => 'FUNCTION',
+        'searchpairpos' => 'FUNCTION',
+        'searchpos' => 'FUNCTION',
+        'server2client' => 'FUNCTION',
+        'serverlist' => 'FUNCTION',
+        'setbufvar' => 'FUNCTION',
+        'setcmdpos' => 'FUNCTION',
+        'setline' => 'FUNCTION',
+        'setloclist' => 'FUNCTION',
+        'setmatches' => 'FUNCTION',
+        'setpos' => 'FUNCTION',
+        'setqflist' => 'FUNCTION',
+        'setreg' => 'FUNCTION',
+        'settabwinvar' => 'FUNCTION',
+        'setwinvar' => 'FUNCTION',
+        'shellescape' => 'FUNCTION',
+        'simplify' => 'FUNCTION',
+        'sin' => 'FUNCTION',
+        'sort' => 'FUNCTION',
+        'soundfold' => 'FUNCTION',
+        'spellbadword' => 'FUNCTION',
+        'spellsuggest' => 'FUNCTION',
+        'split' => 'FUNCTION',
+        'sqrt' => 'FUNCTION',
+        'str2float' => 'FUNCTION',
+        'str2nr' => 'FUNCTION',
+        'strftime' => 'FUNCTION',
+        'stridx' => 'FUNCTION',
+        'string' => 'FUNCTION',
+        'strlen' => 'FUNCTION',
+        'strpart' => 'FUNCTION',
+        'strridx' => 'FUNCTION',
+        'strtrans' => 'FUNCTION',
+        'submatch' => 'FUNCTION',
+        'substitute' => 'FUNCTION',
+        'synID' => 'FUNCTION',
+        'synIDattr' => 'FUNCTION',
+        'synIDtrans' => 'FUNCTION',
+        'synstack' => 'FUNCTION',
+        'system' => 'FUNCTION',
+        'tabpagebuflist' => 'FUNCTION',
+        'tabpagenr' => 'FUNCTION',
+        'tabpagewinnr' => 'FUNCTION',
+        'tagfiles' => 'FUNCTION',
+        'taglist' => 'FUNCTION',
+        'tempname' => 'FUNCTION',
+        'tolower' => 'FUNCTION',
+        'toupper' => 'FUNCTION',
+        'tr' => 'FUNCTION',
+        'trunc' => 'FUNCTION',
+        'type' => 'FUNCTION',
+        'values' => 'FUNCTION',
+        'virtcol' => 'FUNCTION',
+        'visualmode' => 'FUNCTION',
+        'winbufnr' => 'FUNCTION',
+        'wincol' => 'FUNCTION',
+        'winheight' => 'FUNCTION',
+        'winline' => 'FUNCTION',
+        'winnr' => 'FUNCTION',
+        'winrestcmd' => 'FUNCTION',
+        'winrestview' => 'FUNCTION',
+        'winsaveview' => 'FUNCTION',
+        'winwidth' => 'FUNCTION',
+        'writefile' => 'FUNCTION',
+        'Next' => 'KEYWORD',
+        'Print' => 'KEYWORD',
+        'XMLent' => 'KEYWORD',
+        'XMLns' => 'KEYWORD',
+        'abc' => 'KEYWORD',
+        'abclear' => 'KEYWORD',
+        'abo' => 'KEYWORD',
+        'aboveleft' => 'KEYWORD',
+        'acd' => 'KEYWORD',
+        'ai' => 'KEYWORD',
+        'akm' => 'KEYWORD',
+        'al' => 'KEYWORD',
+        'aleph' => 'KEYWORD',
+        'all' => 'KEYWORD',
+        'allowrevins' => 'KEYWORD',
+        'altkeymap' => 'KEYWORD',
+        'ambiwidth' => 'KEYWORD',
+        'ambw' => 'KEYWORD',
+        'anti' => 'KEYWORD',
+        'antialias' => 'KEYWORD',
+        'ar' => 'KEYWORD',
+        'arab' => 'KEYWORD',
+        'arabic' => 'KEYWORD',
+        'arabicshape' => 'KEYWORD',
+        'arabshape' => 'KEYWORD',
+        'argadd' => 'KEYWORD',
+        'arga' => 'KEYWORD',
+        'argdelete' => 'KEYWORD',
+        'argdo' => 'KEYWORD',
+        'arge' => 'KEYWORD',
+        'argedit' => 'KEYWORD',
+        'argg' => 'KEYWORD',
+        'argglobal' => 'KEYWORD',
+        'arglargs' => 'KEYWORD',
+        'arglocal' => 'KEYWORD',
+        'argument' => 'KEYWORD',
+        'ari' => 'KEYWORD',
+        'arshape' => 'KEYWORD',
+        'as' => 'KEYWORD',
+        'ascii' => 'KEYWORD',
+        'au' => 'KEYWORD',
+        'augroup' => 'KEYWORD',
+        'auto' => 'KEYWORD',
+        'autochdir' => 'KEYWORD',
+        'autocmd' => 'KEYWORD',
+        'autoindent' => 'KEYWORD',
+        'autoread' => 'KEYWORD',
+        'autowrite' => 'KEYWORD',
+        'autowriteall' => 'KEYWORD',
+        'aw' => 'KEYWORD',
+        'awa' => 'KEYWORD',
+        'bN' => 'KEYWORD',
+        'bNext' => 'KEYWORD',
+        'ba' => 'KEYWORD',
+        'background' => 'KEYWORD',
+        'backspace' => 'KEYWORD',
+        'backup' => 'KEYWORD',
+        'backupcopy' => 'KEYWORD',
+        'backupdir' => 'KEYWORD',
+        'backupext' => 'KEYWORD',
+        'backupskip' => 'KEYWORD',
+        'bad' => 'KEYWORD',
+        'badd' => 'KEYWORD',
+        'ball' => 'KEYWORD',
+        'balloondelay' => 'KEYWORD',
+        'ballooneval' => 'KEYWORD',
+        'balloonexpr' => 'KEYWORD',
+        'bd' => 'KEYWORD',
+        'bdelete' => 'KEYWORD',
+        'bdir' => 'KEYWORD',
+        'bdlay' => 'KEYWORD',
+        'bel' => 'KEYWORD',
+        'belowright' => 'KEYWORD',
+        'beval' => 'KEYWORD',
+        'bex' => 'KEYWORD',
+        'bexpr' => 'KEYWORD',
+        'bf' => 'KEYWORD',
+        'bfirst' => 'KEYWORD',
+        'bg' => 'KEYWORD',
+        'bh' => 'KEYWORD',
+        'bin' => 'KEYWORD',
+        'binary' => 'KEYWORD',
+        'biosk' => 'KEYWORD',
+        'bioskey' => 'KEYWORD',
+        'bk' => 'KEYWORD',
+        'bkc' => 'KEYWORD',
+        'bl' => 'KEYWORD',
+        'blast' => 'KEYWORD',
+        'bm' => 'KEYWORD',
+        'bmodified' => 'KEYWORD',
+        'bn' => 'KEYWORD',
+        'bnext' => 'KEYWORD',
+        'bo' => 'KEYWORD',
+        'bomb' => 'KEYWORD',
+        'botright' => 'KEYWORD',
+        'bp' => 'KEYWORD',
+        'bprevious' => 'KEYWORD',
+        'br' => 'KEYWORD',
+        'brea' => 'KEYWORD',
+        'break' => 'KEYWORD',
+        'breaka' => 'KEYWORD',
+        'breakadd' => 'KEYWORD',
+        'breakat' => 'KEYWORD',
+        'breakd' => 'KEYWORD',
+        'breakdel' => 'KEYWORD',
+        'breakl' => 'KEYWORD',
+        'breaklist' => 'KEYWORD',
+        'brewind' => 'KEYWORD',
+        'brk' => 'KEYWORD',
+        'bro' => 'KEYWORD',
+        'bs' => 'KEYWORD',
+        'bsdir' => 'KEYWORD',
+        'bsk' => 'KEYWORD',
+        'bt' => 'KEYWORD',
+        'bufdo' => 'KEYWORD',
+        'buffer' => 'KEYWORD',
+        'buffers' => 'KEYWORD',
+        'bufhidden' => 'KEYWORD',
+        'buftype' => 'KEYWORD',
+        'bun' => 'KEYWORD',
+        'bunload' => 'KEYWORD',
+        'bw' => 'KEYWORD',
+        'bwipeout' => 'KEYWORD',
+        'cN' => 'KEYWORD',
+        'cNext' => 'KEYWORD',
+        'cNf' => 'KEYWORD',
+        'cNfile' => 'KEYWORD',
+        'cabc' => 'KEYWORD',
+        'cabclear' => 'KEYWORD',
+        'cad' => 'KEYWORD',
+        'caddb' => 'KEYWORD',
+        'caddbuffer' => 'KEYWORD',
+        'caddexpr' => 'KEYWORD',
+        'caddf' => 'KEYWORD',
+        'caddfile' => 'KEYWORD',
+        'cal' => 'KEYWORD',
+        'casemap' => 'KEYWORD',
+        'cat' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'cb' => 'KEYWORD',
+        'cbuffer' => 'KEYWORD',
+        'cc' => 'KEYWORD',
+        'ccl' => 'KEYWORD',
+        'cclose' => 'KEYWORD',
+        'ccv' => 'KEYWORD',
+        'cd' => 'KEYWORD',
+        'cdpath' => 'KEYWORD',
+        'ce' => 'KEYWORD',
+        'cedit' => 'KEYWORD',
+        'center' => 'KEYWORD',
+        'cex' => 'KEYWORD',
+        'cexpr' => 'KEYWORD',
+        'cf' => 'KEYWORD',
+        'cfile' => 'KEYWORD',
+        'cfir' => 'KEYWORD',
+        'cfirst' => 'KEYWORD',
+        'cfu' => 'KEYWORD',
+        'cg' => 'KEYWORD',
+        'cgetb' => 'KEYWORD',
+        'cgetbuffer' => 'KEYWORD',
+        'cgete' => 'KEYWORD',
+        'cgetexpr' => 'KEYWORD',
+        'cgetfile' => 'KEYWORD',
+        'ch' => 'KEYWORD',
+        'change' => 'KEYWORD',
+        'changes' => 'KEYWORD',
+        'charconvert' => 'KEYWORD',
+        'chd' => 'KEYWORD',
+        'chdir' => 'KEYWORD',
+        'che' => 'KEYWORD',
+        'checkpath' => 'KEYWORD',
+        'checkt' => 'KEYWORD',
+        'checktime' => 'KEYWORD',
+        'ci' => 'KEYWORD',
+        'cin' => 'KEYWORD',
+        'cink' => 'KEYWORD',
+        'cinkeys' => 'KEYWORD',
+        'cino' => 'KEYWORD',
+        'cinoptions' => 'KEYWORD',
+        'cinw' => 'KEYWORD',
+        'cinwords' => 'KEYWORD',
+        'cl' => 'KEYWORD',
+        'cla' => 'KEYWORD',
+        'clast' => 'KEYWORD',
+        'clipboard' => 'KEYWORD',
+        'clist' => 'KEYWORD',
+        'clo' => 'KEYWORD',
+        'close' => 'KEYWORD',
+        'cm' => 'KEYWORD',
+        'cmap' => 'KEYWORD',
+        'cmapc' => 'KEYWORD',
+        'cmapclear' => 'KEYWORD',
+        'cmdheight' => 'KEYWORD',
+        'cmdwinheight' => 'KEYWORD',
+        'cmp' => 'KEYWORD',
+        'cms' => 'KEYWORD',
+        'cn' => 'KEYWORD',
+        'cnew' => 'KEYWORD',
+        'cnewer' => 'KEYWORD',
+        'cnext' => 'KEYWORD',
+        'cnf' => 'KEYWORD',
+        'cnfile' => 'KEYWORD',
+        'cno' => 'KEYWORD',
+        'cnoremap' => 'KEYWORD',
+        'co' => 'KEYWORD',
+        'colder' => 'KEYWORD',
+        'colo' => 'KEYWORD',
+        'colorscheme' => 'KEYWORD',
+        'columns' => 'KEYWORD',
+        'com' => 'KEYWORD',
+        'comc' => 'KEYWORD',
+        'comclear' => 'KEYWORD',
+        'command' => 'KEYWORD',
+        'comments' => 'KEYWORD',
+        'commentstring' => 'KEYWORD',
+        'comp' => 'KEYWORD',
+        'compatible' => 'KEYWORD',
+        'compiler' => 'KEYWORD',
+        'completefunc' => 'KEYWORD',
+        'completeopt' => 'KEYWORD',
+        'con' => 'KEYWORD',
+        'conf' => 'KEYWORD',
+        'consk' => 'KEYWORD',
+        'conskey' => 'KEYWORD',
+        'continue' => 'KEYWORD',
+        'cope' => 'KEYWORD',
+        'copen' => 'KEYWORD',
+        'copyindent' => 'KEYWORD',
+        'cot' => 'KEYWORD',
+        'cp' => 'KEYWORD',
+        'cpf' => 'KEYWORD',
+        'cpfile' => 'KEYWORD',
+        'cpo' => 'KEYWORD',
+        'cpoptions' => 'KEYWORD',
+        'cprevious' => 'KEYWORD',
+        'cpt' => 'KEYWORD',
+        'cq' => 'KEYWORD',
+        'cquit' => 'KEYWORD',
+        'cr' => 'KEYWORD',
+        'crewind' => 'KEYWORD',
+        'cscopepathcomp' => 'KEYWORD',
+        'cscopeprg' => 'KEYWORD',
+        'cscopequickfix' => 'KEYWORD',
+        'cscopetag' => 'KEYWORD',
+        'cscopetagorder' => 'KEYWORD',
+        'cscopeverbose' => 'KEYWORD',
+        'cspc' => 'KEYWORD',
+        'csprg' => 'KEYWORD',
+        'csqf' => 'KEYWORD',
+        'cst' => 'KEYWORD',
+        'csto' => 'KEYWORD',
+        'csverb' => 'KEYWORD',
+        'cuc' => 'KEYWORD',
+        'cul' => 'KEYWORD',
+        'cuna' => 'KEYWORD',
+        'cunabbrev' => 'KEYWORD',
+        'cursorcolumn' => 'KEYWORD',
+        'cursorline' => 'KEYWORD',
+        'cw' => 'KEYWORD',
+        'cwh' => 'KEYWORD',
+        'cwindow' => 'KEYWORD',
+        'debug' => 'KEYWORD',
+        'debugg' => 'KEYWORD',
+        'debuggreedy' => 'KEYWORD',
+        'deco' => 'KEYWORD',
+        'def' => 'KEYWORD',
+        'define' => 'KEYWORD',
+        'delc' => 'KEYWORD',
+        'delcombine' => 'KEYWORD',
+        'delcommand' => 'KEYWORD',
+        'delf' => 'KEYWORD',
+        'delfunction' => 'KEYWORD',
+        'delm' => 'KEYWORD',
+        'delmarks' => 'KEYWORD',
+        'dex' => 'KEYWORD',
+        'dg' => 'KEYWORD',
+        'di' => 'KEYWORD',
+        'dict' => 'KEYWORD',
+        'dictionary' => 'KEYWORD',
+        'diff' => 'KEYWORD',
+        'diffexpr' => 'KEYWORD',
+        'diffg' => 'KEYWORD',
+        'diffget' => 'KEYWORD',
+        'diffoff' => 'KEYWORD',
+        'diffopt' => 'KEYWORD',
+        'diffpatch' => 'KEYWORD',
+        'diffpu' => 'KEYWORD',
+        'diffput' => 'KEYWORD',
+        'diffsplit' => 'KEYWORD',
+        'diffthis' => 'KEYWORD',
+        'diffu' => 'KEYWORD',
+        'diffupdate' => 'KEYWORD',
+        'dig' => 'KEYWORD',
+        'digraph' => 'KEYWORD',
+        'digraphs' => 'KEYWORD',
+        'dip' => 'KEYWORD',
+        'dir' => 'KEYWORD',
+        'directory' => 'KEYWORD',
+        'display' => 'KEYWORD',
+        'dj' => 'KEYWORD',
+        'djump' => 'KEYWORD',
+        'dl' => 'KEYWORD',
+        'dlist' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'doautoa' => 'KEYWORD',
+        'doautoall' => 'KEYWORD',
+        'doautocmd' => 'KEYWORD',
+        'dr' => 'KEYWORD',
+        'drop' => 'KEYWORD',
+        'ds' => 'KEYWORD',
+        'dsearch' => 'KEYWORD',
+        'dsp' => 'KEYWORD',
+        'dsplit' => 'KEYWORD',
+        'dy' => 'KEYWORD',
+        'ea' => 'KEYWORD',
+        'ead' => 'KEYWORD',
+        'eadirection' => 'KEYWORD',
+        'earlier' => 'KEYWORD',
+        'eb' => 'KEYWORD',
+        'echoe' => 'KEYWORD',
+        'echoerr' => 'KEYWORD',
+        'echohl' => 'KEYWORD',
+        'echom' => 'KEYWORD',
+        'echomsg' => 'KEYWORD',
+        'echon' => 'KEYWORD',
+        'ed' => 'KEYWORD',
+        'edcompatible' => 'KEYWORD',
+        'edit' => 'KEYWORD',
+        'ef' => 'KEYWORD',
+        'efm' => 'KEYWORD',
+        'ei' => 'KEYWORD',
+        'ek' => 'KEYWORD',
+        'el' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'elsei' => 'KEYWORD',
+        'elseif' => 'KEYWORD',
+        'em' => 'KEYWORD',
+        'emenu' => 'KEYWORD',
+        'en' => 'KEYWORD',
+        'enc' => 'KEYWORD',
+        'encoding' => 'KEYWORD',
+        'endf' => 'KEYWORD',
+        'endfo' => 'KEYWORD',
+        'endfor' => 'KEYWORD',
+        'endfunction' => 'KEYWORD',
+        'endif' => 'KEYWORD',
+        'endofline' => 'KEYWORD',
+        'endt' => 'KEYWORD',
+        'endtry' => 'KEYWORD',
+        'endw' => 'KEYWORD',
+        'endwhile' => 'KEYWORD',
+        'ene' => 'KEYWORD',
+        'enew' => 'KEYWORD',
+        'environment' => 'KEYWORD',
+        'eol' => 'KEYWORD',
+        'ep' => 'KEYWORD',
+        'equalalways' => 'KEYWORD',
+        'equalprg' => 'KEYWORD',
+        'errorbells' => 'KEYWORD',
+        'errorfile' => 'KEYWORD',
+        'errorformat' => 'KEYWORD',
+        'esckeys' => 'KEYWORD',
+        'et' => 'KEYWORD',
+        'event' => 'KEYWORD',
+        'eventignore' => 'KEYWORD',
+        'ex' => 'KEYWORD',
+        'exi' => 'KEYWORD',
+        'exit' => 'KEYWORD',
+        'expandtab' => 'KEYWORD',
+        'expression' => 'KEYWORD',
+        'exrc' => 'KEYWORD',
+        'exu' => 'KEYWORD',
+        'exusage' => 'KEYWORD',
+        'fcl' => 'KEYWORD',
+        'fcs' => 'KEYWORD',
+        'fdc' => 'KEYWORD',
+        'fde' => 'KEYWORD',
+        'fdi' => 'KEYWORD',
+        'fdl' => 'KEYWORD',
+        'fdls' => 'KEYWORD',
+        'fdm' => 'KEYWORD',
+        'fdn' => 'KEYWORD',
+        'fdo' => 'KEYWORD',
+        'fdt' => 'KEYWORD',
+        'fen' => 'KEYWORD',
+        'fenc' => 'KEYWORD',
+        'fencs' => 'KEYWORD',
+        'fex' => 'KEYWORD',
+        'ff' => 'KEYWORD',
+        'ffs' => 'KEYWORD',
+        'file' => 'KEYWORD',
+        'fileencoding' => 'KEYWORD',
+        'fileencodings' => 'KEYWORD',
+        'fileformat' => 'KEYWORD',
+        'fileformats' => 'KEYWORD',
+        'files' => 'KEYWORD',
+        'filetype' => 'KEYWORD',
+        'fillchars' => 'KEYWORD',
+        'fin' => 'KEYWORD',
+        'fina' => 'KEYWORD',
+        'finally' => 'KEYWORD',
+        'find' => 'KEYWORD',
+        'fini' => 'KEYWORD',
+        'finish' => 'KEYWORD',
+        'fir' => 'KEYWORD',
+        'first' => 'KEYWORD',
+        'fix' => 'KEYWORD',
+        'fixdel' => 'KEYWORD',
+        'fk' => 'KEYWORD',
+        'fkmap' => 'KEYWORD',
+        'flp' => 'KEYWORD',
+        'fml' => 'KEYWORD',
+        'fmr' => 'KEYWORD',
+        'fo' => 'KEYWORD',
+        'fold' => 'KEYWORD',
+        'foldc' => 'KEYWORD',
+        'foldclose' => 'KEYWORD',
+        'foldcolumn' => 'KEYWORD',
+        'foldd' => 'KEYWORD',
+        'folddoc' => 'KEYWORD',
+        'folddoclosed' => 'KEYWORD',
+        'folddoopen' => 'KEYWORD',
+        'foldenable' => 'KEYWORD',
+        'foldexpr' => 'KEYWORD',
+        'foldignore' => 'KEYWORD',
+        'foldlevelstart' => 'KEYWORD',
+        'foldmarker' => 'KEYWORD',
+        'foldmethod' => 'KEYWORD',
+        'foldminlines' => 'KEYWORD',
+        'foldnestmax' => 'KEYWORD',
+        'foldo' => 'KEYWORD',
+        'foldopen' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'formatexpr' => 'KEYWORD',
+        'formatlistpat' => 'KEYWORD',
+        'formatoptions' => 'KEYWORD',
+        'formatprg' => 'KEYWORD',
+        'fp' => 'KEYWORD',
+        'fs' => 'KEYWORD',
+        'fsync' => 'KEYWORD',
+        'ft' => 'KEYWORD',
+        'fu' => 'KEYWORD',
+        'gcr' => 'KEYWORD',
+        'gd' => 'KEYWORD',
+        'gdefault' => 'KEYWORD',
+        'gfm' => 'KEYWORD',
+        'gfn' => 'KEYWORD',
+        'gfs' => 'KEYWORD',
+        'gfw' => 'KEYWORD',
+        'ghr' => 'KEYWORD',
+        'go' => 'KEYWORD',
+        'goto' => 'KEYWORD',
+        'gp' => 'KEYWORD',
+        'gr' => 'KEYWORD',
+        'grep' => 'KEYWORD',
+        'grepa' => 'KEYWORD',
+        'grepadd' => 'KEYWORD',
+        'grepformat' => 'KEYWORD',
+        'grepprg' => 'KEYWORD',
+        'gtl' => 'KEYWORD',
+        'gtt' => 'KEYWORD',
+        'guicursor' => 'KEYWORD',
+        'guifont' => 'KEYWORD',
+        'guifontset' => 'KEYWORD',
+        'guifontwide' => 'KEYWORD',
+        'guiheadroom' => 'KEYWORD',
+        'guioptions' => 'KEYWORD',
+        'guipty' => 'KEYWORD',
+        'guitablabel' => 'KEYWORD',
+        'guitabtooltip' => 'KEYWORD',
+        'ha' => 'KEYWORD',
+        'hardcopy' => 'KEYWORD',
+        'help' => 'KEYWORD',
+        'helpf' => 'KEYWORD',
+        'helpfile' => 'KEYWORD',
+        'helpfind' => 'KEYWORD',
+        'helpg' => 'KEYWORD',
+        'helpgrep' => 'KEYWORD',
+        'helpheight' => 'KEYWORD',
+        'helplang' => 'KEYWORD',
+        'helpt' => 'KEYWORD',
+        'helptags' => 'KEYWORD',
+        'hf' => 'KEYWORD',
+        'hh' => 'KEYWORD',
+        'hi' => 'KEYWORD',
+        'hid' => 'KEYWORD',
+        'hidden' => 'KEYWORD',
+        'hide' => 'KEYWORD',
+        'highlight' => 'KEYWORD',
+        'his' => 'KEYWORD',
+        'history' => 'KEYWORD',
+        'hk' => 'KEYWORD',
+        'hkmap' => 'KEYWORD',
+        'hkmapp' => 'KEYWORD',
+        'hkp' => 'KEYWORD',
+        'hl' => 'KEYWORD',
+        'hlg' => 'KEYWORD',
+        'hls' => 'KEYWORD',
+        'hlsearch' => 'KEYWORD',
+        'iabc' => 'KEYWORD',
+        'iabclear' => 'KEYWORD',
+        'ic' => 'KEYWORD',
+        'icon' => 'KEYWORD',
+        'iconstring' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'ignorecase' => 'KEYWORD',
+        'ij' => 'KEYWORD',
+        'ijump' => 'KEYWORD',
+        'il' => 'KEYWORD',
+        'ilist' => 'KEYWORD',
+        'im' => 'KEYWORD',
+        'imactivatekey' => 'KEYWORD',
+        'imak' => 'KEYWORD',
+        'imap' => 'KEYWORD',
+        'imapc' => 'KEYWORD',
+        'imapclear' => 'KEYWORD',
+        'imc' => 'KEYWORD',
+        'imcmdline' => 'KEYWORD',
+        'imd' => 'KEYWORD',
+        'imdisable' => 'KEYWORD',
+        'imi' => 'KEYWORD',
+        'iminsert' => 'KEYWORD',
+        'ims' => 'KEYWORD',
+        'imsearch' => 'KEYWORD',
+        'inc' => 'KEYWORD',
+        'include' => 'KEYWORD',
+        'includeexpr' => 'KEYWORD',
+        'incsearch' => 'KEYWORD',
+        'inde' => 'KEYWORD',
+        'indentexpr' => 'KEYWORD',
+        'indentkeys' => 'KEYWORD',
+        'indk' => 'KEYWORD',
+        'inex' => 'KEYWORD',
+        'inf' => 'KEYWORD',
+        'infercase' => 'KEYWORD',
+        'ino' => 'KEYWORD',
+        'inoremap' => 'KEYWORD',
+        'insertmode' => 'KEYWORD',
+        'is' => 'KEYWORD',
+        'isearch' => 'KEYWORD',
+        'isf' => 'KEYWORD',
+        'isfname' => 'KEYWORD',
+        'isi' => 'KEYWORD',
+        'isident' => 'KEYWORD',
+        'isk' => 'KEYWORD',
+        'iskeyword' => 'KEYWORD',
+        'isp' => 'KEYWORD',
+        'isplit' => 'KEYWORD',
+        'isprint' => 'KEYWORD',
+        'iuna' => 'KEYWORD',
+        'iunabbrev' => 'KEYWORD',
+        'joinspaces' => 'KEYWORD',
+        'js' => 'KEYWORD',
+        'ju' => 'KEYWORD',
+        'jumps' => 'KEYWORD',
+        'kee' => 'KEYWORD',
+        'keepalt' => 'KEYWORD',
+        'keepj' => 'KEYWORD',
+        'keepjumps' => 'KEYWORD',
+        'keepmarks' => 'KEYWORD',
+        'key' => 'KEYWORD',
+        'keymap' => 'KEYWORD',
+        'keymodel' => 'KEYWORD',
+        'keywordprg' => 'KEYWORD',
+        'km' => 'KEYWORD',
+        'kmp' => 'KEYWORD',
+        'kp' => 'KEYWORD',
+        'lN' => 'KEYWORD',
+        'lNext' => 'KEYWORD',
+        'lNf' => 'KEYWORD',
+        'lNfile' => 'KEYWORD',
+        'la' => 'KEYWORD',
+        'lad' => 'KEYWORD',
+        'laddb' => 'KEYWORD',
+        'laddbuffer' => 'KEYWORD',
+        'laddexpr' => 'KEYWORD',
+        'laddf' => 'KEYWORD',
+        'laddfile' => 'KEYWORD',
+        'lan' => 'KEYWORD',
+        'langmap' => 'KEYWORD',
+        'langmenu' => 'KEYWORD',
+        'language' => 'KEYWORD',
+        'last' => 'KEYWORD',
+        'laststatus' => 'KEYWORD',
+        'later' => 'KEYWORD',
+        'lazyredraw' => 'KEYWORD',
+        'lb' => 'KEYWORD',
+        'lbr' => 'KEYWORD',
+        'lbuffer' => 'KEYWORD',
+        'lc' => 'KEYWORD',
+        'lcd' => 'KEYWORD',
+        'lch' => 'KEYWORD',
+        'lchdir' => 'KEYWORD',
+        'lcl' => 'KEYWORD',
+        'lclose' => 'KEYWORD',
+        'lcs' => 'KEYWORD',
+        'le' => 'KEYWORD',
+        'left' => 'KEYWORD',
+        'lefta' => 'KEYWORD',
+        'leftabove' => 'KEYWORD',
+        'let' => 'KEYWORD',
+        'lex' => 'KEYWORD',
+        'lexpr' => 'KEYWORD',
+        'lf' => 'KEYWORD',
+        'lfile' => 'KEYWORD',
+        'lfir' => 'KEYWORD',
+        'lfirst' => 'KEYWORD',
+        'lg' => 'KEYWORD',
+        'lgetb' => 'KEYWORD',
+        'lgetbuffer' => 'KEYWORD',
+        'lgete' => 'KEYWORD',
+        'lgetexpr' => 'KEYWORD',
+        'lgetfile' => 'KEYWORD',
+        'lgr' => 'KEYWORD',
+        'lgrep' => 'KEYWORD',
+        'lgrepa' => 'KEYWORD',
+        'lgrepadd' => 'KEYWORD',
+        'lh' => 'KEYWORD',
+        'lhelpgrep' => 'KEYWORD',
+        'linebreak' => 'KEYWORD',
+        'lines' => 'KEYWORD',
+        'linespace' => 'KEYWORD',
+        'lisp' => 'KEYWORD',
+        'lispwords' => 'KEYWORD',
+        'list' => 'KEYWORD',
+        'listchars' => 'KEYWORD',
+        'll' => 'KEYWORD',
+        'lla' => 'KEYWORD',
+        'llast' => 'KEYWORD',
+        'lli' => 'KEYWORD',
+        'llist' => 'KEYWORD',
+        'lm' => 'KEYWORD',
+        'lmak' => 'KEYWORD',
+        'lmake' => 'KEYWORD',
+        'lmap' => 'KEYWORD',
+        'lmapc' => 'KEYWORD',
+        'lmapclear' => 'KEYWORD',
+        'ln' => 'KEYWORD',
+        'lne' => 'KEYWORD',
+        'lnew' => 'KEYWORD',
+        'lnewer' => 'KEYWORD',
+        'lnext' => 'KEYWORD',
+        'lnf' => 'KEYWORD',
+        'lnfile' => 'KEYWORD',
+        'lnoremap' => 'KEYWORD',
+        'lo' => 'KEYWORD',
+        'loadplugins' => 'KEYWORD',
+        'loadview' => 'KEYWORD',
+        'loc' => 'KEYWORD',
+        'lockmarks' => 'KEYWORD',
+        'lockv' => 'KEYWORD',
+        'lockvar' => 'KEYWORD',
+        'lol' => 'KEYWORD',
+        'lolder' => 'KEYWORD',
+        'lop' => 'KEYWORD',
+        'lopen' => 'KEYWORD',
+        'lp' => 'KEYWORD',
+        'lpf' => 'KEYWORD',
+        'lpfile' => 'KEYWORD',
+        'lpl' => 'KEYWORD',
+        'lprevious' => 'KEYWORD',
+        'lr' => 'KEYWORD',
+        'lrewind' => 'KEYWORD',
+        'ls' => 'KEYWORD',
+        'lsp' => 'KEYWORD',
+        'ltag' => 'KEYWORD',
+        'lv' => 'KEYWORD',
+        'lvimgrep' => 'KEYWORD',
+        'lvimgrepa' => 'KEYWORD',
+        'lvimgrepadd' => 'KEYWORD',
+        'lw' => 'KEYWORD',
+        'lwindow' => 'KEYWORD',
+        'lz' => 'KEYWORD',
+        'ma' => 'KEYWORD',
+        'maca' => 'KEYWORD',
+        'macaction' => 'KEYWORD',
+        'macatsui' => 'KEYWORD',
+        'macm' => 'KEYWORD',
+        'macmenu' => 'KEYWORD',
+        'magic' => 'KEYWORD',
+        'mak' => 'KEYWORD',
+        'make' => 'KEYWORD',
+        'makeef' => 'KEYWORD',
+        'makeprg' => 'KEYWORD',
+        'mapping' => 'KEYWORD',
+        'mark' => 'KEYWORD',
+        'marks' => 'KEYWORD',
+        'mat' => 'KEYWORD',
+        'matchpairs' => 'KEYWORD',
+        'matchtime' => 'KEYWORD',
+        'maxcombine' => 'KEYWORD',
+        'maxfuncdepth' => 'KEYWORD',
+        'maxmapdepth' => 'KEYWORD',
+        'maxmem' => 'KEYWORD',
+        'maxmempattern' => 'KEYWORD',
+        'maxmemtot' => 'KEYWORD',
+        'mco' => 'KEYWORD',
+        'mef' => 'KEYWORD',
+        'menu' => 'KEYWORD',
+        'menuitems' => 'KEYWORD',
+        'menut' => 'KEYWORD',
+        'menutranslate' => 'KEYWORD',
+        'mfd' => 'KEYWORD',
+        'mh' => 'KEYWORD',
+        'mis' => 'KEYWORD',
+        'mk' => 'KEYWORD',
+        'mkexrc' => 'KEYWORD',
+        'mks' => 'KEYWORD',
+        'mksession' => 'KEYWORD',
+        'mksp' => 'KEYWORD',
+        'mkspell' => 'KEYWORD',
+        'mkspellmem' => 'KEYWORD',
+        'mkv' => 'KEYWORD',
+        'mkvie' => 'KEYWORD',
+        'mkview' => 'KEYWORD',
+        'mkvimrc' => 'KEYWORD',
+        'ml' => 'KEYWORD',
+        'mls' => 'KEYWORD',
+        'mm' => 'KEYWORD',
+        'mmd' => 'KEYWORD',
+        'mmp' => 'KEYWORD',
+        'mmt' => 'KEYWORD',
+        'mod' => 'KEYWORD',
+        'modeline' => 'KEYWORD',
+        'modelines' => 'KEYWORD',
+        'modifiable' => 'KEYWORD',
+        'modified' => 'KEYWORD',
+        'more' => 'KEYWORD',
+        'mouse' => 'KEYWORD',
+        'mousef' => 'KEYWORD',
+        'mousefocus' => 'KEYWORD',
+        'mousehide' => 'KEYWORD',
+        'mousem' => 'KEYWORD',
+        'mousemodel' => 'KEYWORD',
+        'mouses' => 'KEYWORD',
+        'mouseshape' => 'KEYWORD',
+        'mouset' => 'KEYWORD',
+        'mousetime' => 'KEYWORD',
+        'move' => 'KEYWORD',
+        'mp' => 'KEYWORD',
+        'mps' => 'KEYWORD',
+        'msm' => 'KEYWORD',
+        'mz' => 'KEYWORD',
+        'mzf' => 'KEYWORD',
+        'mzfile' => 'KEYWORD',
+        'mzq' => 'KEYWORD',
+        'mzquantum' => 'KEYWORD',
+        'mzscheme' => 'KEYWORD',
+        'nbkey' => 'KEYWORD',
+        'new' => 'KEYWORD',
+        'next' => 'KEYWORD',
+        'nf' => 'KEYWORD',
+        'nm' => 'KEYWORD',
+        'nmap' => 'KEYWORD',
+        'nmapc' => 'KEYWORD',
+        'nmapclear' => 'KEYWORD',
+        'nn' => 'KEYWORD',
+        'nnoremap' => 'KEYWORD',
+        'no' => 'KEYWORD',
+        'noexpandtab' => 'KEYWORD',
+        'noh' => 'KEYWORD',
+        'nohlsearch' => 'KEYWORD',
+        'noremap' => 'KEYWORD',
+        'nrformats' => 'KEYWORD',
+        'nu' => 'KEYWORD',
+        'number' => 'KEYWORD',
+        'numberwidth' => 'KEYWORD',
+        'nuw' => 'KEYWORD',
+        'odev' => 'KEYWORD',
+        'oft' => 'KEYWORD',
+        'ofu' => 'KEYWORD',
+        'om' => 'KEYWORD',
+        'omap' => 'KEYWORD',
+        'omapc' => 'KEYWORD',
+        'omapclear' => 'KEYWORD',
+        'omnifunc' => 'KEYWORD',
+        'on' => 'KEYWORD',
+        'only' => 'KEYWORD',
+        'ono' => 'KEYWORD',
+        'onoremap' => 'KEYWORD',
+        'open' => 'KEYWORD',
+        'opendevice' => 'KEYWORD',
+        'operatorfunc' => 'KEYWORD',
+        'opfunc' => 'KEYWORD',
+        'opt' => 'KEYWORD',
+        'option' => 'KEYWORD',
+        'options' => 'KEYWORD',
+        'osfiletype' => 'KEYWORD',
+        'pa' => 'KEYWORD',
+        'para' => 'KEYWORD',
+        'paragraphs' => 'KEYWORD',
+        'paste' => 'KEYWORD',
+        'pastetoggle' => 'KEYWORD',
+        'patchexpr' => 'KEYWORD',
+        'patchmode' => 'KEYWORD',
+        'path' => 'KEYWORD',
+        'pc' => 'KEYWORD',
+        'pclose' => 'KEYWORD',
+        'pdev' => 'KEYWORD',
+        'pe' => 'KEYWORD',
+        'ped' => 'KEYWORD',
+        'pedit' => 'KEYWORD',
+        'penc' => 'KEYWORD',
+        'perl' => 'KEYWORD',
+        'perld' => 'KEYWORD',
+        'perldo' => 'KEYWORD',
+        'pex' => 'KEYWORD',
+        'pexpr' => 'KEYWORD',
+        'pfn' => 'KEYWORD',
+        'ph' => 'KEYWORD',
+        'pheader' => 'KEYWORD',
+        'pi' => 'KEYWORD',
+        'pm' => 'KEYWORD',
+        'pmbcs' => 'KEYWORD',
+        'pmbfn' => 'KEYWORD',
+        'po' => 'KEYWORD',
+        'pop' => 'KEYWORD',
+        'popt' => 'KEYWORD',
+        'popu' => 'KEYWORD',
+        'popup' => 'KEYWORD',
+        'pp' => 'KEYWORD',
+        'ppop' => 'KEYWORD',
+        'pre' => 'KEYWORD',
+        'preserve' => 'KEYWORD',
+        'preserveindent' => 'KEYWORD',
+        'prev' => 'KEYWORD',
+        'previewheight' => 'KEYWORD',
+        'previewwindow' => 'KEYWORD',
+        'previous' => 'KEYWORD',
+        'print' => 'KEYWORD',
+        'printdevice' => 'KEYWORD',
+        'printencoding' => 'KEYWORD',
+        'printexpr' => 'KEYWORD',
+        'printfont' => 'KEYWORD',
+        'printheader' => 'KEYWORD',
+        'printmbcharset' => 'KEYWORD',
+        'printmbfont' => 'KEYWORD',
+        'printoptions' => 'KEYWORD',
+        'prof' => 'KEYWORD',
+        'profd' => 'KEYWORD',
+        'profdel' => 'KEYWORD',
+        'profile' => 'KEYWORD',
+        'prompt' => 'KEYWORD',
+        'promptf' => 'KEYWORD',
+        'promptfind' => 'KEYWORD',
+        'promptr' => 'KEYWORD',
+        'promptrepl' => 'KEYWORD',
+        'ps' => 'KEYWORD',
+        'psearch' => 'KEYWORD',
+        'pt' => 'KEYWORD',
+        'ptN' => 'KEYWORD',
+        'ptNext' => 'KEYWORD',
+        'pta' => 'KEYWORD',
+        'ptag' => 'KEYWORD',
+        'ptf' => 'KEYWORD',
+        'ptfirst' => 'KEYWORD',
+        'ptj' => 'KEYWORD',
+        'ptjump' => 'KEYWORD',
+        'ptl' => 'KEYWORD',
+        'ptlast' => 'KEYWORD',
+        'ptn' => 'KEYWORD',
+        'ptnext' => 'KEYWORD',
+        'ptp' => 'KEYWORD',
+        'ptprevious' => 'KEYWORD',
+        'ptr' => 'KEYWORD',
+        'ptrewind' => 'KEYWORD',
+        'pts' => 'KEYWORD',
+        'ptselect' => 'KEYWORD',
+        'pu' => 'KEYWORD',
+        'pumheight' => 'KEYWORD',
+        'put' => 'KEYWORD',
+        'pvh' => 'KEYWORD',
+        'pvw' => 'KEYWORD',
+        'pw' => 'KEYWORD',
+        'pwd' => 'KEYWORD',
+        'py' => 'KEYWORD',
+        'pyf' => 'KEYWORD',
+        'pyfile' => 'KEYWORD',
+        'python' => 'KEYWORD',
+        'qa' => 'KEYWORD',
+        'qall' => 'KEYWORD',
+        'qe' => 'KEYWORD',
+        'quit' => 'KEYWORD',
+        'quita' => 'KEYWORD',
+        'quitall' => 'KEYWORD',
+        'quoteescape' => 'KEYWORD',
+        'rdt' => 'KEYWORD',
+        'read' => 'KEYWORD',
+        'readonly' => 'KEYWORD',
+        'rec' => 'KEYWORD',
+        'recover' => 'KEYWORD',
+        'red' => 'KEYWORD',
+        'redi' => 'KEYWORD',
+        'redir' => 'KEYWORD',
+        'redo' => 'KEYWORD',
+        'redr' => 'KEYWORD',
+        'redraw' => 'KEYWORD',
+        'redraws' => 'KEYWORD',
+        'redrawstatus' => 'KEYWORD',
+        'redrawtime' => 'KEYWORD',
+        'reg' => 'KEYWORD',
+        'registers' => 'KEYWORD',
+        'remap' => 'KEYWORD',
+        'report' => 'KEYWORD',
+        'res' => 'KEYWORD',
+        'resize' => 'KEYWORD',
+        'restorescreen' => 'KEYWORD',
+        'ret' => 'KEYWORD',
+        'retab' => 'KEYWORD',
+        'retu' => 'KEYWORD',
+        'return' => 'KEYWORD',
+        'revins' => 'KEYWORD',
+        'rew' => 'KEYWORD',
+        'rewind' => 'KEYWORD',
+        'ri' => 'KEYWORD',
+        'right' => 'KEYWORD',
+        'rightb' => 'KEYWORD',
+        'rightbelow' => 'KEYWORD',
+        'rightleft' => 'KEYWORD',
+        'rightleftcmd' => 'KEYWORD',
+        'rl' => 'KEYWORD',
+        'rlc' => 'KEYWORD',
+        'ro' => 'KEYWORD',
+        'rs' => 'KEYWORD',
+        'rtp' => 'KEYWORD',
+        'ru' => 'KEYWORD',
+        'rub' => 'KEYWORD',
+        'ruby' => 'KEYWORD',
+        'rubyd' => 'KEYWORD',
+        'rubydo' => 'KEYWORD',
+        'rubyf' => 'KEYWORD',
+        'rubyfile' => 'KEYWORD',
+        'ruf' => 'KEYWORD',
+        'ruler' => 'KEYWORD',
+        'rulerformat' => 'KEYWORD',
+        'runtime' => 'KEYWORD',
+        'runtimepath' => 'KEYWORD',
+        'rv' => 'KEYWORD',
+        'rviminfo' => 'KEYWORD',
+        'sN' => 'KEYWORD',
+        'sNext' => 'KEYWORD',
+        'sa' => 'KEYWORD',
+        'sal' => 'KEYWORD',
+        'sall' => 'KEYWORD',
+        'san' => 'KEYWORD',
+        'sandbox' => 'KEYWORD',
+        'sargument' => 'KEYWORD',
+        'sav' => 'KEYWORD',
+        'saveas' => 'KEYWORD',
+        'sb' => 'KEYWORD',
+        'sbN' => 'KEYWORD',
+        'sbNext' => 'KEYWORD',
+        'sba' => 'KEYWORD',
+        'sball' => 'KEYWORD',
+        'sbf' => 'KEYWORD',
+        'sbfirst' => 'KEYWORD',
+        'sbl' => 'KEYWORD',
+        'sblast' => 'KEYWORD',
+        'sbm' => 'KEYWORD',
+        'sbmodified' => 'KEYWORD',
+        'sbn' => 'KEYWORD',
+        'sbnext' => 'KEYWORD',
+        'sbo' => 'KEYWORD',
+        'sbp' => 'KEYWORD',
+        'sbprevious' => 'KEYWORD',
+        'sbr' => 'KEYWORD',
+        'sbrewind' => 'KEYWORD',
+        'sbuffer' => 'KEYWORD',
+        'sc' => 'KEYWORD',
+        'scb' => 'KEYWORD',
+        'scr' => 'KEYWORD',
+        'scrip' => 'KEYWORD',
+        'scripte' => 'KEYWORD',
+        'scriptencoding' => 'KEYWORD',
+        'scriptnames' => 'KEYWORD',
+        'scroll' => 'KEYWORD',
+        'scrollbind' => 'KEYWORD',
+        'scrolljump' => 'KEYWORD',
+        'scrolloff' => 'KEYWORD',
+        'scrollopt' => 'KEYWORD',
+        'scs' => 'KEYWORD',
+        'se' => 'KEYWORD',
+        'sect' => 'KEYWORD',
+        'sections' => 'KEYWORD',
+        'secure' => 'KEYWORD',
+        'sel' => 'KEYWORD',
+        'selection' => 'KEYWORD',
+        'selectmode' => 'KEYWORD',
+        'sessionoptions' => 'KEYWORD',
+        'set' => 'KEYWORD',
+        'setf' => 'KEYWORD',
+        'setfiletype' => 'KEYWORD',
+        'setg' => 'KEYWORD',
+        'setglobal' => 'KEYWORD',
+        'setl' => 'KEYWORD',
+        'setlocal' => 'KEYWORD',
+        'sf' => 'KEYWORD',
+        'sfind' => 'KEYWORD',
+        'sfir' => 'KEYWORD',
+        'sfirst' => 'KEYWORD',
+        'sft' => 'KEYWORD',
+        'sh' => 'KEYWORD',
+        'shcf' => 'KEYWORD',
+        'shell' => 'KEYWORD',
+        'shellcmdflag' => 'KEYWORD',
+        'shellpipe' => 'KEYWORD',
+        'shellquote' => 'KEYWORD',
+        'shellredir' => 'KEYWORD',
+        'shellslash' => 'KEYWORD',
+        'shelltemp' => 'KEYWORD',
+        'shelltype' => 'KEYWORD',
+        'shellxquote' => 'KEYWORD',
+        'shiftround' => 'KEYWORD',
+        'shiftwidth' => 'KEYWORD',
+        'shm' => 'KEYWORD',
+        'shortmess' => 'KEYWORD',
+        'shortname' => 'KEYWORD',
+        'showbreak' => 'KEYWORD',
+        'showcmd' => 'KEYWORD',
+        'showfulltag' => 'KEYWORD',
+        'showmatch' => 'KEYWORD',
+        'showmode' => 'KEYWORD',
+        'showtabline' => 'KEYWORD',
+        'shq' => 'KEYWORD',
+        'si' => 'KEYWORD',
+        'sidescroll' => 'KEYWORD',
+        'sidescrolloff' => 'KEYWORD',
+        'sign' => 'KEYWORD',
+        'sil' => 'KEYWORD',
+        'silent' => 'KEYWORD',
+        'sim' => 'KEYWORD',
+        'simalt' => 'KEYWORD',
+        'siso' => 'KEYWORD',
+        'sj' => 'KEYWORD',
+        'sl' => 'KEYWORD',
+        'sla' => 'KEYWORD',
+        'slast' => 'KEYWORD',
+        'sleep' => 'KEYWORD',
+        'slm' => 'KEYWORD',
+        'sm' => 'KEYWORD',
+        'smagic' => 'KEYWORD',
+        'smap' => 'KEYWORD',
+        'smapc' => 'KEYWORD',
+        'smapclear' => 'KEYWORD',
+        'smartcase' => 'KEYWORD',
+        'smartindent' => 'KEYWORD',
+        'smarttab' => 'KEYWORD',
+        'smc' => 'KEYWORD',
+        'smd' => 'KEYWORD',
+        'sme' => 'KEYWORD',
+        'smenu' => 'KEYWORD',
+        'sn' => 'KEYWORD',
+        'snext' => 'KEYWORD',
+        'sni' => 'KEYWORD',
+        'sniff' => 'KEYWORD',
+        'sno' => 'KEYWORD',
+        'snomagic' => 'KEYWORD',
+        'snor' => 'KEYWORD',
+        'snoremap' => 'KEYWORD',
+        'snoreme' => 'KEYWORD',
+        'snoremenu' => 'KEYWORD',
+        'so' => 'KEYWORD',
+        'softtabstop' => 'KEYWORD',
+        'sol' => 'KEYWORD',
+        'something' => 'KEYWORD',
+        'sor' => 'KEYWORD',
+        'source' => 'KEYWORD',
+        'sp' => 'KEYWORD',
+        'spc' => 'KEYWORD',
+        'spe' => 'KEYWORD',
+        'spell' => 'KEYWORD',
+        'spellcapcheck' => 'KEYWORD',
+        'spelld' => 'KEYWORD',
+        'spelldump' => 'KEYWORD',
+        'spellfile' => 'KEYWORD',
+        'spellgood' => 'KEYWORD',
+        'spelli' => 'KEYWORD',
+        'spellinfo' => 'KEYWORD',
+        'spelllang' => 'KEYWORD',
+        'spellr' => 'KEYWORD',
+        'spellrepall' => 'KEYWORD',
+        'spellu' => 'KEYWORD',
+        'spellundo' => 'KEYWORD',
+        'spellw' => 'KEYWORD',
+        'spellwrong' => 'KEYWORD',
+        'spf' => 'KEYWORD',
+        'spl' => 'KEYWORD',
+        'splitbelow' => 'KEYWORD',
+        'splitright' => 'KEYWORD',
+        'spr' => 'KEYWORD',
+        'sprevious' => 'KEYWORD',
+        'sps' => 'KEYWORD',
+        'sr' => 'KEYWORD',
+        'sre' => 'KEYWORD',
+        'srewind' => 'KEYWORD',
+        'srr' => 'KEYWORD',
+        'ss' => 'KEYWORD',
+        'ssl' => 'KEYWORD',
+        'ssop' => 'KEYWORD',
+        'st' => 'KEYWORD',
+        'sta' => 'KEYWORD',
+        'stag' => 'KEYWORD',
+        'stal' => 'KEYWORD',
+        'star' => 'KEYWORD',
+        'startg' => 'KEYWORD',
+        'startgreplace' => 'KEYWORD',
+        'startinsert' => 'KEYWORD',
+        'startofline' => 'KEYWORD',
+        'startr' => 'KEYWORD',
+        'startreplace' => 'KEYWORD',
+        'statusline' => 'KEYWORD',
+        'stj' => 'KEYWORD',
+        'stjump' => 'KEYWORD',
+        'stl' => 'KEYWORD',
+        'stmp' => 'KEYWORD',
+        'stop' => 'KEYWORD',
+        'stopi' => 'KEYWORD',
+        'stopinsert' => 'KEYWORD',
+        'sts' => 'KEYWORD',
+        'stselect' => 'KEYWORD',
+        'su' => 'KEYWORD',
+        'sua' => 'KEYWORD',
+        'suffixes' => 'KEYWORD',
+        'suffixesadd' => 'KEYWORD',
+        'sun' => 'KEYWORD',
+        'sunhide' => 'KEYWORD',
+        'sunme' => 'KEYWORD',
+        'sunmenu' => 'KEYWORD',
+        'sus' => 'KEYWORD',
+        'suspend' => 'KEYWORD',
+        'sv' => 'KEYWORD',
+        'sview' => 'KEYWORD',
+        'sw' => 'KEYWORD',
+        'swapfile' => 'KEYWORD',
+        'swapsync' => 'KEYWORD',
+        'swb' => 'KEYWORD',
+        'swf' => 'KEYWORD',
+        'switchbuf' => 'KEYWORD',
+        'sws' => 'KEYWORD',
+        'sxq' => 'KEYWORD',
+        'syn' => 'KEYWORD',
+        'syncbind' => 'KEYWORD',
+        'synmaxcol' => 'KEYWORD',
+        'syntax' => 'KEYWORD',
+        'tN' => 'KEYWORD',
+        'tNext' => 'KEYWORD',
+        'ta' => 'KEYWORD',
+        'tab' => 'KEYWORD',
+        'tabN' => 'KEYWORD',
+        'tabNext' => 'KEYWORD',
+        'tabc' => 'KEYWORD',
+        'tabclose' => 'KEYWORD',
+        'tabd' => 'KEYWORD',
+        'tabdo' => 'KEYWORD',
+        'tabe' => 'KEYWORD',
+        'tabedit' => 'KEYWORD',
+        'tabf' => 'KEYWORD',
+        'tabfind' => 'KEYWORD',
+        'tabfir' => 'KEYWORD',
+        'tabfirst' => 'KEYWORD',
+        'tabl' => 'KEYWORD',
+        'tablast' => 'KEYWORD',
+        'tabline' => 'KEYWORD',
+        'tabm' => 'KEYWORD',
+        'tabmove' => 'KEYWORD',
+        'tabn' => 'KEYWORD',
+        'tabnew' => 'KEYWORD',
+        'tabnext' => 'KEYWORD',
+        'tabo' => 'KEYWORD',
+        'tabonly' => 'KEYWORD',
+        'tabp' => 'KEYWORD',
+        'tabpagemax' => 'KEYWORD',
+        'tabprevious' => 'KEYWORD',
+        'tabr' => 'KEYWORD',
+        'tabrewind' => 'KEYWORD',
+        'tabs' => 'KEYWORD',
+        'tabstop' => 'KEYWORD',
+        'tag' => 'KEYWORD',
+        'tag_listfiles' => 'KEYWORD',
+        'tagbsearch' => 'KEYWORD',
+        'taglength' => 'KEYWORD',
+        'tagrelative' => 'KEYWORD',
+        'tags' => 'KEYWORD',
+        'tagstack' => 'KEYWORD',
+        'tal' => 'KEYWORD',
+        'tb' => 'KEYWORD',
+        'tbi' => 'KEYWORD',
+        'tbidi' => 'KEYWORD',
+        'tbis' => 'KEYWORD',
+        'tbs' => 'KEYWORD',
+        'tc' => 'KEYWORD',
+        'tcl' => 'KEYWORD',
+        'tcld' => 'KEYWORD',
+        'tcldo' => 'KEYWORD',
+        'tclf' => 'KEYWORD',
+        'tclfile' => 'KEYWORD',
+        'te' => 'KEYWORD',
+        'tearoff' => 'KEYWORD',
+        'tenc' => 'KEYWORD',
+        'term' => 'KEYWORD',
+        'termbidi' => 'KEYWORD',
+        'termencoding' => 'KEYWORD',
+        'terse' => 'KEYWORD',
+        'textauto' => 'KEYWORD',
+        'textmode' => 'KEYWORD',
+        'textwidth' => 'KEYWORD',
+        'tf' => 'KEYWORD',
+        'tfirst' => 'KEYWORD',
+        'tgst' => 'KEYWORD',
+        'th' => 'KEYWORD',
+        'thesaurus' => 'KEYWORD',
+        'throw' => 'KEYWORD',
+        'tildeop' => 'KEYWORD',
+        'timeout' => 'KEYWORD',
+        'timeoutlen' => 'KEYWORD',
+        'title' => 'KEYWORD',
+        'titlelen' => 'KEYWORD',
+        'titleold' => 'KEYWORD',
+        'titlestring' => 'KEYWORD',
+        'tj' => 'KEYWORD',
+        'tjump' => 'KEYWORD',
+        'tl' => 'KEYWORD',
+        'tlast' => 'KEYWORD',
+        'tm' => 'KEYWORD',
+        'tmenu' => 'KEYWORD',
+        'tn' => 'KEYWORD',
+        'tnext' => 'KEYWORD',
+        'to' => 'KEYWORD',
+        'toolbar' => 'KEYWORD',
+        'toolbariconsize' => 'KEYWORD',
+        'top' => 'KEYWORD',
+        'topleft' => 'KEYWORD',
+        'tp' => 'KEYWORD',
+        'tpm' => 'KEYWORD',
+        'tprevious' => 'KEYWORD',
+        'trewind' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'ts' => 'KEYWORD',
+        'tselect' => 'KEYWORD',
+        'tsl' => 'KEYWORD',
+        'tsr' => 'KEYWORD',
+        'ttimeout' => 'KEYWORD',
+        'ttimeoutlen' => 'KEYWORD',
+        'ttm' => 'KEYWORD',
+        'tty' => 'KEYWORD',
+        'ttybuiltin' => 'KEYWORD',
+        'ttyfast' => 'KEYWORD',
+        'ttym' => 'KEYWORD',
+        'ttymouse' => 'KEYWORD',
+        'ttyscroll' => 'KEYWORD',
+        'ttytype' => 'KEYWORD',
+        'tu' => 'KEYWORD',
+        'tunmenu' => 'KEYWORD',
+        'tw' => 'KEYWORD',
+        'tx' => 'KEYWORD',
+        'uc' => 'KEYWORD',
+        'ul' => 'KEYWORD',
+        'una' => 'KEYWORD',
+        'unabbreviate' => 'KEYWORD',
+        'undo' => 'KEYWORD',
+        'undoj' => 'KEYWORD',
+        'undojoin' => 'KEYWORD',
+        'undol' => 'KEYWORD',
+        'undolevels' => 'KEYWORD',
+        'undolist' => 'KEYWORD',
+        'unh' => 'KEYWORD',
+        'unhide' => 'KEYWORD',
+        'unl' => 'KEYWORD',
+        'unlet' => 'KEYWORD',
+        'unlo' => 'KEYWORD',
+        'unlockvar' => 'KEYWORD',
+        'up' => 'KEYWORD',
+        'update' => 'KEYWORD',
+        'updatecount' => 'KEYWORD',
+        'updatetime' => 'KEYWORD',
+        'ut' => 'KEYWORD',
+        'var' => 'KEYWORD',
+        'vb' => 'KEYWORD',
+        'vbs' => 'KEYWORD',
+        'vdir' => 'KEYWORD',
+        've' => 'KEYWORD',
+        'verb' => 'KEYWORD',
+        'verbose' => 'KEYWORD',
+        'verbosefile' => 'KEYWORD',
+        'version' => 'KEYWORD',
+        'vert' => 'KEYWORD',
+        'vertical' => 'KEYWORD',
+        'vfile' => 'KEYWORD',
+        'vi' => 'KEYWORD',
+        'vie' => 'KEYWORD',
+        'view' => 'KEYWORD',
+        'viewdir' => 'KEYWORD',
+        'viewoptions' => 'KEYWORD',
+        'vim' => 'KEYWORD',
+        'vimgrep' => 'KEYWORD',
+        'vimgrepa' => 'KEYWORD',
+        'vimgrepadd' => 'KEYWORD',
+        'viminfo' => 'KEYWORD',
+        'virtualedit' => 'KEYWORD',
+        'visual' => 'KEYWORD',
+        'visualbell' => 'KEYWORD',
+        'viu' => 'KEYWORD',
+        'viusage' => 'KEYWORD',
+        'vm' => 'KEYWORD',
+        'vmap' => 'KEYWORD',
+        'vmapc' => 'KEYWORD',
+        'vmapclear' => 'KEYWORD',
+        'vn' => 'KEYWORD',
+        'vne' => 'KEYWORD',
+        'vnew' => 'KEYWORD',
+        'vnoremap' => 'KEYWORD',
+        'vop' => 'KEYWORD',
+        'vs' => 'KEYWORD',
+        'vsplit' => 'KEYWORD',
+        'wN' => 'KEYWORD',
+        'wNext' => 'KEYWORD',
+        'wa' => 'KEYWORD',
+        'wak' => 'KEYWORD',
+        'wall' => 'KEYWORD',
+        'warn' => 'KEYWORD',
+        'wb' => 'KEYWORD',
+        'wc' => 'KEYWORD',
+        'wcm' => 'KEYWORD',
+        'wd' => 'KEYWORD',
+        'weirdinvert' => 'KEYWORD',
+        'wfh' => 'KEYWORD',
+        'wfw' => 'KEYWORD',
+        'wh' => 'KEYWORD',
+        'whichwrap' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'wi' => 'KEYWORD',
+        'wig' => 'KEYWORD',
+        'wildchar' => 'KEYWORD',
+        'wildcharm' => 'KEYWORD',
+        'wildignore' => 'KEYWORD',
+        'wildmenu' => 'KEYWORD',
+        'wildmode' => 'KEYWORD',
+        'wildoptions' => 'KEYWORD',
+        'wim' => 'KEYWORD',
+        'win' => 'KEYWORD',
+        'winaltkeys' => 'KEYWORD',
+        'winc' => 'KEYWORD',
+        'wincmd' => 'KEYWORD',
+        'windo' => 'KEYWORD',
+        'window' => 'KEYWORD',
+        'winfixheight' => 'KEYWORD',
+        'winfixwidth' => 'KEYWORD',
+        'winminheight' => 'KEYWORD',
+        'winminwidth' => 'KEYWORD',
+        'winp' => 'KEYWORD',
+        'winpos' => 'KEYWORD',
+        'winsize' => 'KEYWORD',
+        'wiv' => 'KEYWORD',
+        'wiw' => 'KEYWORD',
+        'wm' => 'KEYWORD',
+        'wmh' => 'KEYWORD',
+        'wmnu' => 'KEYWORD',
+        'wmw' => 'KEYWORD',
+        'wn' => 'KEYWORD',
+        'wnext' => 'KEYWORD',
+        'wop' => 'KEYWORD',
+        'wp' => 'KEYWORD',
+        'wprevious' => 'KEYWORD',
+        'wq' => 'KEYWORD',
+        'wqa' => 'KEYWORD',
+        'wqall' => 'KEYWORD',
+        'wrap' => 'KEYWORD',
+        'wrapmargin' => 'KEYWORD',
+        'wrapscan' => 'KEYWORD',
+        'write' => 'KEYWORD',
+        'writeany' => 'KEYWORD',
+        'writebackup' => 'KEYWORD',
+        'writedelay' => 'KEYWORD',
+        'ws' => 'KEYWORD',
+        'wsverb' => 'KEYWORD',
+        'wv' => 'KEYWORD',
+        'wviminfo' => 'KEYWORD',
+        'ww' => 'KEYWORD',
+        'xa' => 'KEYWORD',
+        'xall' => 'KEYWORD',
+        'xit' => 'KEYWORD',
+        'xm' => 'KEYWORD',
+        'xmap' => 'KEYWORD',
+        'xmapc' => 'KEYWORD',
+        'xmapclear' => 'KEYWORD',
+        'xmenu' => 'KEYWORD',
+        'xn' => 'KEYWORD',
+        'xnremap' => 'KEYWORD',
+        'xnoreme' => 'KEYWORD',
+        'xnoremenu' => 'KEYWORD',
+        'xunme' => 'KEYWORD',
+        'xunmenu' => 'KEYWORD',
+        'yank' => 'KEYWORD'
+    );
+}
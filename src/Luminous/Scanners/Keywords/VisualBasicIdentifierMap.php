@@ -0,0 +1,382 @@
+<?php
+
+namespace Luminous\Scanners\Keywords;
+
+/*
+ * Generated from VisualBasicKeywords, CSharpKeywords by generate.php, do not edit.
+ */
+class VisualBasicIdentifierMap
+{
+    public static $NAMES = array('VALUE', 'OPERATOR', 'TYPE', 'KEYWORD');
+
+    public static $MAP = array(
+        'false' => 'VALUE',
+        'nothing' => 'VALUE',
+        'true' => 'VALUE',
+        'addressof' => 'OPERATOR',
+        'and' => 'OPERATOR',
+        'andalso' => 'OPERATOR',
+        'gettype' => 'OPERATOR',
+        'getxmlnamespace' => 'OPERATOR',
+        'is' => 'OPERATOR',
+        'isfalse' => 'OPERATOR',
+        'isnot' => 'OPERATOR',
+        'istrue' => 'OPERATOR',
+        'mod' => 'OPERATOR',
+        'not' => 'OPERATOR',
+        'or' => 'OPERATOR',
+        'orelse' => 'OPERATOR',
+        'typeof' => 'OPERATOR',
+        'xor' => 'OPERATOR',
+        'boolean' => 'TYPE',
+        'byte' => 'TYPE',
+        'cbool' => 'TYPE',
+        'cbyte' => 'TYPE',
+        'cchar' => 'TYPE',
+        'cdate' => 'TYPE',
+        'cdbl' => 'TYPE',
+        'cdec' => 'TYPE',
+        'char' => 'TYPE',
+        'cint' => 'TYPE',
+        'clng' => 'TYPE',
+        'cobj' => 'TYPE',
+        'cshort' => 'TYPE',
+        'csng' => 'TYPE',
+        'cstr' => 'TYPE',
+        'ctype' => 'TYPE',
+        'date' => 'TYPE',
+        'decimal' => 'TYPE',
+        'double' => 'TYPE',
+        'integer' => 'TYPE',
+        'long' => 'TYPE',
+        'object' => 'TYPE',
+        'short' => 'TYPE',
+        'string' => 'TYPE',
+        'addhandler' => 'KEYWORD',
+        'alias' => 'KEYWORD',
+        'ansi' => 'KEYWORD',
+        'as' => 'KEYWORD',
+        'assembly' => 'KEYWORD',
+        'auto' => 'KEYWORD',
+        'byref' => 'KEYWORD',
+        'byval' => 'KEYWORD',
+        'call' => 'KEYWORD',
+        'case' => 'KEYWORD',
+        'catch' => 'KEYWORD',
+        'class' => 'KEYWORD',
+        'const' => 'KEYWORD',
+        'declare' => 'KEYWORD',
+        'default' => 'KEYWORD',
+        'delegate' => 'TYPE',
+        'dim' => 'KEYWORD',
+        'directcast' => 'KEYWORD',
+        'do' => 'KEYWORD',
+        'each' => 'KEYWORD',
+        'else' => 'KEYWORD',
+        'elseif' => 'KEYWORD',
+        'end' => 'KEYWORD',
+        'endif' => 'KEYWORD',
+        'enum' => 'TYPE',
+        'erase' => 'KEYWORD',
+        'error' => 'KEYWORD',
+        'event' => 'KEYWORD',
+        'exit' => 'KEYWORD',
+        'finally' => 'KEYWORD',
+        'for' => 'KEYWORD',
+        'friend' => 'KEYWORD',
+        'function' => 'KEYWORD',
+        'get' => 'KEYWORD',
+        'gosub' => 'KEYWORD',
+        'goto' => 'KEYWORD',
+        'handles' => 'KEYWORD',
+        'if' => 'KEYWORD',
+        'implements' => 'KEYWORD',
+        'imports' => 'KEYWORD',
+        'in' => 'KEYWORD',
+        'inherits' => 'KEYWORD',
+        'interface' => 'KEYWORD',
+        'let' => 'KEYWORD',
+        'lib' => 'KEYWORD',
+        'like' => 'KEYWORD',
+        'loop' => 'KEYWORD',
+        'me' => 'KEYWORD',
+        'module' => 'KEYWORD',
+        'mustinherit' => 'KEYWORD',
+        'mustoverride' => 'KEYWORD',
+        'mybase' => 'KEYWORD',
+        'myclass' => 'KEYWORD',
+        'namespace' => 'KEYWORD',
+        'new' => 'KEYWORD',
+        'next' => 'KEYWORD',
+        'notinheritable' => 'KEYWORD',
+        'notoverridable' => 'KEYWORD',
+        'on' => 'KEYWORD',
+        'option' => 'KEYWORD',
+        'optional' => 'KEYWORD',
+        'overloads' => 'KEYWORD',
+        'overridable' => 'KEYWORD',
+        'overrides' => 'KEYWORD',
+        'paramarray' => 'KEYWORD',
+        'preserve' => 'KEYWORD',
+        'private' => 'KEYWORD',
+        'property' => 'KEYWORD',
+        'protected' => 'KEYWORD',
+        'public' => 'KEYWORD',
+        'raiseevent' => 'KEYWORD',
+        'readonly' => 'KEYWORD',
+        'redim' => 'KEYWORD',
+        'removehandler' => 'KEYWORD',
+        'resume' => 'KEYWORD',
+        'return' => 'KEYWORD',
+        'select' => 'KEYWORD',
+        'set' => 'KEYWORD',
+        'shadows' => 'KEYWORD',
+        'shared' => 'KEYWORD',
+        'single' => 'TYPE',
+        'static' => 'KEYWORD',
+        'step' => 'KEYWORD',
+        'stop' => 'KEYWORD',
+        'structure' => 'KEYWORD',
+        'sub' => 'KEYWORD',
+        'synclock' => 'KEYWORD',
+        'then' => 'KEYWORD',
+        'throw' => 'KEYWORD',
+        'to' => 'KEYWORD',
+        'try' => 'KEYWORD',
+        'unicode' => 'KEYWORD',
+        'until' => 'KEYWORD',
+        'variant' => 'KEYWORD',
+        'wend' => 'KEYWORD',
+        'when' => 'KEYWORD',
+        'while' => 'KEYWORD',
+        'with' => 'KEYWORD',
+        'withevents' => 'KEYWORD',
+        'writeonly' => 'KEYWORD',
+        'argiterator' => 'TYPE',
+        'arraysegment' => 'TYPE',
+        'consolekeyinfo' => 'TYPE',
+        'datetime' => 'TYPE',
+        'datetimeoffset' => 'TYPE',
+        'guid' => 'TYPE',
+        'int16' => 'TYPE',
+        'int32' => 'TYPE',
+        'int64' => 'TYPE',
+        'intptr' => 'TYPE',
+        'modulehandle' => 'TYPE',
+        'nullable' => 'TYPE',
+        'runtimeargumenthandle' => 'TYPE',
+        'runtimefieldhandle' => 'TYPE',
+        'runtimemethodhandle' => 'TYPE',
+        'runtimetypehandle' => 'TYPE',
+        'sbyte' => 'TYPE',
+        'timespan' => 'TYPE',
+        'timezoneinfo' => 'TYPE',
+        'typedreference' => 'TYPE',
+        'uint16' => 'TYPE',
+        'uint32' => 'TYPE',
+        'uint64' => 'TYPE',
+        'uintptr' => 'TYPE',
+        'void' => 'TYPE',
+        'accessviolationexception' => 'TYPE',
+        'activationcontext' => 'TYPE',
+        'activator' => 'TYPE',
+        'aggregateexception' => 'TYPE',
+        'appdomain' => 'TYPE',
+        'appdomainmanager' => 'TYPE',
+        'appdomainsetup' => 'TYPE',
+        'appdomainunloadedexception' => 'TYPE',
+        'applicationexception' => 'TYPE',
+        'applicationid' => 'TYPE',
+        'applicationidentity' => 'TYPE',
+        'argumentexception' => 'TYPE',
+        'argumentnullexception' => 'TYPE',
+        'argumentoutofrangeexception' => 'TYPE',
+        'arithmeticexception' => 'TYPE',
+        'array' => 'TYPE',
+        'arraytypemismatchexception' => 'TYPE',
+        'assemblyloadeventargs' => 'TYPE',
+        'attribute' => 'TYPE',
+        'attributeusageattribute' => 'TYPE',
+        'badimageformatexception' => 'TYPE',
+        'bitconverter' => 'TYPE',
+        'buffer' => 'TYPE',
+        'cannotunloadappdomainexception' => 'TYPE',
+        'charenumerator' => 'TYPE',
+        'clscompliantattribute' => 'TYPE',
+        'console' => 'TYPE',
+        'consolecanceleventargs' => 'TYPE',
+        'contextboundobject' => 'TYPE',
+        'contextmarshalexception' => 'TYPE',
+        'contextstaticattribute' => 'TYPE',
+        'convert' => 'TYPE',
+        'datamisalignedexception' => 'TYPE',
+        'dbnull' => 'TYPE',
+        'dividebyzeroexception' => 'TYPE',
+        'dllnotfoundexception' => 'TYPE',
+        'duplicatewaitobjectexception' => 'TYPE',
+        'entrypointnotfoundexception' => 'TYPE',
+        'environment' => 'TYPE',
+        'eventargs' => 'TYPE',
+        'exception' => 'TYPE',
+        'executionengineexception' => 'TYPE',
+        'fieldaccessexception' => 'TYPE',
+        'filestyleuriparser' => 'TYPE',
+        'flagsattribute' => 'TYPE',
+        'formatexception' => 'TYPE',
+        'ftpstyleuriparser' => 'TYPE',
+        'gc' => 'TYPE',
+        'genericuriparser' => 'TYPE',
+        'gopherstyleuriparser' => 'TYPE',
+        'httpstyleuriparser' => 'TYPE',
+        'indexoutofrangeexception' => 'TYPE',
+        'insufficientexecutionstackexception' => 'TYPE',
+        'insufficientmemoryexception' => 'TYPE',
+        'invalidcastexception' => 'TYPE',
+        'invalidoperationexception' => 'TYPE',
+        'invalidprogramexception' => 'TYPE',
+        'invalidtimezoneexception' => 'TYPE',
+        'lazy' => 'TYPE',
+        'ldapstyleuriparser' => 'TYPE',
+        'loaderoptimizationattribute' => 'TYPE',
+        'localdatastoreslot' => 'TYPE',
+        'marshalbyrefobject' => 'TYPE',
+        'math' => 'TYPE',
+        'memberaccessexception' => 'TYPE',
+        'methodaccessexception' => 'TYPE',
+        'missingfieldexception' => 'TYPE',
+        'missingmemberexception' => 'TYPE',
+        'missingmethodexception' => 'TYPE',
+        'mtathreadattribute' => 'TYPE',
+        'multicastdelegate' => 'TYPE',
+        'multicastnotsupportedexception' => 'TYPE',
+        'netpipestyleuriparser' => 'TYPE',
+        'nettcpstyleuriparser' => 'TYPE',
+        'newsstyleuriparser' => 'TYPE',
+        'nonserializedattribute' => 'TYPE',
+        'notfinitenumberexception' => 'TYPE',
+        'notimplementedexception' => 'TYPE',
+        'notsupportedexception' => 'TYPE',
+        'nullreferenceexception' => 'TYPE',
+        'objectdisposedexception' => 'TYPE',
+        'obsoleteattribute' => 'TYPE',
+        'operatingsystem' => 'TYPE',
+        'operationcanceledexception' => 'TYPE',
+        'outofmemoryexception' => 'TYPE',
+        'overflowexception' => 'TYPE',
+        'paramarrayattribute' => 'TYPE',
+        'platformnotsupportedexception' => 'TYPE',
+        'random' => 'TYPE',
+        'rankexception' => 'TYPE',
+        'resolveeventargs' => 'TYPE',
+        'serializableattribute' => 'TYPE',
+        'stackoverflowexception' => 'TYPE',
+        'stathreadattribute' => 'TYPE',
+        'stringcomparer' => 'TYPE',
+        'systemexception' => 'TYPE',
+        'threadstaticattribute' => 'TYPE',
+        'timeoutexception' => 'TYPE',
+        'timezone' => 'TYPE',
+        'timezonenotfoundexception' => 'TYPE',
+        'tuple' => 'TYPE',
+        'type' => 'TYPE',
+        'typeaccessexception' => 'TYPE',
+        'typeinitializationexception' => 'TYPE',
+        'typeloadexception' => 'TYPE',
+        'typeunloadedexception' => 'TYPE',
+        'unauthorizedaccessexception' => 'TYPE',
+        'unhandledexceptioneventargs' => 'TYPE',
+        'uri' => 'TYPE',
+        'uribuilder' => 'TYPE',
+        'uriformatexception' => 'TYPE',
+        'uriparser' => 'TYPE',
+        'uritemplate' => 'TYPE',
+        'uritemplateequivalencecomparer' => 'TYPE',
+        'uritemplatematch' => 'TYPE',
+        'uritemplatematchexception' => 'TYPE',
+        'uritemplatetable' => 'TYPE',
+        'uritypeconverter' => 'TYPE',
+        'valuetype' => 'TYPE',
+        'version' => 'TYPE',
+        'weakreference' => 'TYPE',
+        'arraylist' => 'TYPE',
+        'bitarray' => 'TYPE',
+        'caseinsensitivecomparer' => 'TYPE',
+        'caseinsensitivehashcodeprovider' => 'TYPE',
+        'collectionbase' => 'TYPE',
+        'comparer' => 'TYPE',
+        'dictionarybase' => 'TYPE',
+        'dictionaryentry' => 'TYPE',
+        'hashtable' => 'TYPE',
+        'icollection' => 'TYPE',
+        'icomparer' => 'TYPE',
+        'idictionary' => 'TYPE',
+        'idictionaryenumerator' => 'TYPE',
+        'ienumerable' => 'TYPE',
+        'ienumerator' => 'TYPE',
+        'iequalitycomparer' => 'TYPE',
+        'ihashcodeprovider' => 'TYPE',
+        'ilist' => 'TYPE',
+        'istructuralcomparable' => 'TYPE',
+        'istructuralequatable' => 'TYPE',
+        'queue' => 'TYPE',
+        'readonlycollectionbase' => 'TYPE',
+        'sortedlist' => 'TYPE',
+        'stack' => 'TYPE',
+        'structuralcomparisons' => 'TYPE',
+        'dictionary' => 'TYPE',
+        'equalitycomparer' => 'TYPE',
+        'hashset' => 'TYPE',
+        'ireadonlycollection' => 'TYPE',
+        'ireadonlydictionary' => 'TYPE',
+        'ireadonlylist' => 'TYPE',
+        'iset' => 'TYPE',
+        'keyedbytypecollection' => 'TYPE',
+        'keynotfoundexception' => 'TYPE',
+        'keyvaluepair' => 'TYPE',
+        'linkedlist' => 'TYPE',
+        'linkedlistnode' => 'TYPE',
+        'list' => 'TYPE',
+        'sorteddictionary' => 'TYPE',
+        'sortedset' => 'TYPE',
+        'synchronizedcollection' => 'TYPE',
+        'synchronizedkeyedcollection' => 'TYPE',
+        'synchronizedreadonlycollection' => 'TYPE',
+        'binaryreader' => 'TYPE',
+        'binarywriter' => 'TYPE',
+        'bufferedstream' => 'TYPE',
+        'directory' => 'TYPE',
+        'directoryinfo' => 'TYPE',
+        'directorynotfoundexception' => 'TYPE',
+        'driveinfo' => 'TYPE',
+        'drivenotfoundexception' => 'TYPE',
+        'endofstreamexception' => 'TYPE',
+        'erroreventargs' => 'TYPE',
+        'file' => 'TYPE',
+        'fileformatexception' => 'TYPE',
+        'fileinfo' => 'TYPE',
+        'fileloadexception' => 'TYPE',
+        'filenotfoundexception' => 'TYPE',
+        'filestream' => 'TYPE',
+        'filesystemeventargs' => 'TYPE',
+        'filesysteminfo' => 'TYPE',
+        'filesystemwatcher' => 'TYPE',
+        'internalbufferoverflowexception' => 'TYPE',
+        'invaliddataexception' => 'TYPE',
+        'iodescriptionattribute' => 'TYPE',
+        'ioexception' => 'TYPE',
+        'memorystream' => 'TYPE',
+        'path' => 'TYPE',
+        'pathtoolongexception' => 'TYPE',
+        'pipeexception' => 'TYPE',
+        'renamedeventargs' => 'TYPE',
+        'stream' => 'TYPE',
+        'streamreader' => 'TYPE',
+        'streamwriter' => 'TYPE',
+        'stringreader' => 'TYPE',
+        'stringwriter' => 'TYPE',
+        'textreader' => 'TYPE',
+        'textwriter' => 'TYPE',
+        'unmanagedmemoryaccessor' => 'TYPE',
+        'unmanagedmemorystream' => 'TYPE'
+    );
+}
@@ -0,0 +1,105 @@
+<?php
+/*
+ * Generates the *IdentifierMap classes in this directory from the keyword
+ * lists. Each one merges the lists a scanner maps its identifiers with into a
+ * single identifier => token name array, so the scanner doesn't have to build
+ * it when it is constructed, and opcache can keep one copy of it shared by
+ * every process.
+ *
+ * Run this after changing a keyword list:
+ *
+ *     php src/Luminous/Scanners/Keywords/generate.php
+ */
+
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+
+$luminousRoot = dirname(dirname(dirname(dirname(__DIR__))));
+if (file_exists($luminousRoot . '/vendor/autoload.php')) {
+    require_once($luminousRoot . '/vendor/autoload.php');
+} else {
+    die('Please install the Composer autoloader by running `composer install` from within ' . $luminousRoot . PHP_EOL);
+}
+
+// class => (case sensitive?, list of (token name, keyword class, property)),
+// the lists in the order the scanner adds them
+$maps = array(
+    'CIdentifierMap' => array(true, array(
+        array('FUNCTION', 'CKeywords', 'FUNCTIONS'),
+        array('KEYWORD', 'CKeywords', 'KEYWORDS'),
+        array('TYPE', 'CKeywords', 'TYPES'),
+    )),
+    'HaskellIdentifierMap' => array(true, array(
+        array('KEYWORD', 'HaskellKeywords', 'KEYWORDS'),
+        array('TYPE', 'HaskellKeywords', 'TYPES'),
+        array('FUNCTION', 'HaskellKeywords', 'FUNCTIONS'),
+        array('VALUE', 'HaskellKeywords', 'VALUES'),
+    )),
+    'JavaIdentifierMap' => array(true, array(
+        array('KEYWORD', 'JavaKeywords', 'KEYWORDS'),
+        array('TYPE', 'JavaKeywords', 'TYPES'),
+    )),
+    'MatlabIdentifierMap' => array(true, array(
+        array('KEYWORD', 'MatlabKeywords', 'KEYWORDS'),
+        array('VALUE', 'MatlabKeywords', 'VALUES'),
+        array('FUNCTION', 'MatlabKeywords', 'FUNCTIONS'),
+    )),
+    'PhpIdentifierMap' => array(false, array(
+        array('FUNCTION', 'PhpKeywords', 'FUNCTIONS'),
+        array('KEYWORD', 'PhpKeywords', 'KEYWORDS'),
+    )),
+    'SqlIdentifierMap' => array(false, array(
+        array('KEYWORD', 'SqlKeywords', 'KEYWORDS'),
+        array('TYPE', 'SqlKeywords', 'TYPES'),
+        array('VALUE', 'SqlKeywords', 'VALUES'),
+        array('OPERATOR', 'SqlKeywords', 'OPERATORS'),
+        array('FUNCTION', 'SqlKeywords', 'FUNCTIONS'),
+    )),
+    'VimScriptIdentifierMap' => array(true, array(
+        array('FUNCTION', 'VimScriptKeywords', 'FUNCTIONS'),
+        array('KEYWORD', 'VimScriptKeywords', 'KEYWORDS'),
+    )),
+    'VisualBasicIdentifierMap' => array(false, array(
+        array('VALUE', 'VisualBasicKeywords', 'VALUES'),
+        array('OPERATOR', 'VisualBasicKeywords', 'OPERATORS'),
+        array('TYPE', 'VisualBasicKeywords', 'TYPES'),
+        array('KEYWORD', 'VisualBasicKeywords', 'KEYWORDS'),
+        array('TYPE', 'CSharpKeywords', 'TYPES'),
+    )),
+);
+
+foreach ($maps as $class => $spec) {
+    list($caseSensitive, $lists) = $spec;
+    // as Scanner::addIdentifierMapping(): the first name added wins
+    $map = array();
+    $ranks = array();
+    $sources = array();
+    foreach ($lists as $list) {
+        list($name, $keywords, $property) = $list;
+        if (!isset($ranks[$name])) {
+            $ranks[$name] = count($ranks);
+        }
+        $sources[$keywords] = true;
+        $vars = get_class_vars('Luminous\\Scanners\\Keywords\\' . $keywords);
+        foreach ($vars[$property] as $ident) {
+            if (!$caseSensitive) {
+                $ident = strtolower($ident);
+            }
+            if (!isset($map[$ident]) || $ranks[$map[$ident]] > $ranks[$name]) {
+                $map[$ident] = $name;
+            }
+        }
+    }
+    $entries = array();
+    foreach ($map as $ident => $name) {
+        $entries[] = '        ' . var_export((string)$ident, true) . ' => ' . var_export($name, true);
+    }
+    $code = "<?php\n\nnamespace Luminous\\Scanners\\Keywords;\n\n"
+        . "/*\n * Generated from " . implode(', ', array_keys($sources)) . " by generate.php, do not edit.\n */\n"
+        . "class $class\n{\n"
+        . "    public static \$NAMES = array('" . implode("', '", array_keys($ranks)) . "');\n\n"
+        . "    public static \$MAP = array(\n" . implode(",\n", $entries) . "\n    );\n}\n";
+    file_put_contents(__DIR__ . "/$class.php", $code);
+    echo "$class: " . count($map) . " identifiers\n";
+}
@@ -15,6 +15,8 @@ use Luminous\Core\Scanners\SimpleScanner;
  */
 class LolcodeScanner extends SimpleScanner
 {
+    protected $recordsUserDefs = true;
+
     public function funcdefOverride($MATCHES)
     {
         $this->RECORD($MATCHES[0], 'KEYWORD');
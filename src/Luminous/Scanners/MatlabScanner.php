@@ -4,7 +4,7 @@ namespace Luminous\Scanners;
 
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\MatlabKeywords;
+use Luminous\Scanners\Keywords\MatlabIdentifierMap;
 
 /*
  * Matlab's pretty simple. Hoorah
@@ -34,10 +34,8 @@ class MatlabScanner extends SimpleScanner
 
         $this->overrides = array('COMMENT_ML' => array($this, 'commentOverride'));
 
-        $this->addIdentifierMapping('KEYWORD', MatlabKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('VALUE', MatlabKeywords::$VALUES);
-        // http://www.mathworks.com/support/functions/alpha_list.html?sec=8
-        $this->addIdentifierMapping('FUNCTION', MatlabKeywords::$FUNCTIONS);
+        // functions from http://www.mathworks.com/support/functions/alpha_list.html?sec=8
+        $this->addIdentifierMap(MatlabIdentifierMap::$NAMES, MatlabIdentifierMap::$MAP);
     }
 
     public static function guessLanguage($src, $info)
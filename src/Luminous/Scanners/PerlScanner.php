@@ -21,6 +21,12 @@ class PerlScanner extends SimpleScanner
     // keeps track of heredocs we need to handle
     private $heredoc = null;
 
+    /**
+     * The overrides look back through the recorded tokens
+     */
+    protected $compactTokens = false;
+    protected $lookbehind = true;
+
     // helper function:
     // consumes a string until the given delimiter (which may be balanced).
     // will handle nested balanced delimiters.
@@ -86,8 +92,7 @@ class PerlScanner extends SimpleScanner
     // by looking behind in the token stream.
     public function isDelimiter()
     {
-        for ($i = count($this->tokens) - 1; $i >= 0; $i--) {
-            $t = $this->tokens[$i];
+        for ($i = 0; ($t = $this->recentToken($i)) !== null; $i++) {
             if ($t[0] === null || $t[0] === 'COMMENT') {
                 continue;
             } elseif ($t[0] === 'OPENER' || $t[0] === 'OPERATOR') {
@@ -20,6 +20,11 @@ class PhpScanner extends Scanner
      */
     protected $phpScanner;
 
+    /**
+     * the php scanner records definitions
+     */
+    protected $recordsUserDefs = true;
+
     /**
      * If it's a snippet, we assume we're starting in PHP mode.
      */
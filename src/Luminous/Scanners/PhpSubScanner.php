@@ -5,7 +5,7 @@ namespace Luminous\Scanners;
 use Luminous\Core\Utils;
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\Scanner;
-use Luminous\Scanners\Keywords\PhpKeywords;
+use Luminous\Scanners\Keywords\PhpIdentifierMap;
 
 /*
  * This is not a scanner called by an external interface, it's controlled
@@ -17,6 +17,7 @@ use Luminous\Scanners\Keywords\PhpKeywords;
 class PhpSubScanner extends Scanner
 {
     protected $caseSensitive = false;
+    protected $recordsUserDefs = true;
     public $snippet = false;
 
     public function init()
@@ -35,8 +36,7 @@ class PhpSubScanner extends Scanner
         $this->addPattern('STRING', TokenPresets::$DOUBLE_STR);
         $this->addPattern('STRING', TokenPresets::$SINGLE_STR);
         $this->addPattern('FUNCTION', '/`(?>[^`\\\\]+|\\\\.)*(`|$)/s');
-        $this->addIdentifierMapping('FUNCTION', PhpKeywords::$FUNCTIONS);
-        $this->addIdentifierMapping('KEYWORD', PhpKeywords::$KEYWORDS);
+        $this->addIdentifierMap(PhpIdentifierMap::$NAMES, PhpIdentifierMap::$MAP);
 
         $this->addFilter('STRING', array($this, 'strFilter'));
         $this->addFilter('HEREDOC', array($this, 'strFilter'));
@@ -11,6 +11,13 @@ class PythonScanner extends Scanner
 {
     public $django = false;
 
+    /**
+     * main() keeps state in local variables
+     */
+    protected $checkpointable = false;
+
+    protected $recordsUserDefs = true;
+
     public function init()
     {
         $this->removeFilter('comment-to-doc');
@@ -37,6 +37,9 @@ class RubyScanner extends Scanner
 
     public $rails = false;
 
+    // isRegex() looks back through the recorded tokens
+    protected $lookbehind = true;
+
     // operators depend somewhat on whether or not rails is active, else we
     // don't want to consume a '%' if it comes right before a '>', we want
     // to leave that for the rails close-tag detection
@@ -286,8 +289,7 @@ class RubyScanner extends Scanner
         }
         $followingSpace = (bool)$this->check("%/[ \t]%");
         $space = false;
-        for ($i = count($this->tokens) - 1; $i >= 0; $i--) {
-            $tok = $this->tokens[$i];
+        for ($i = 0; ($tok = $this->recentToken($i)) !== null; $i++) {
             if ($tok[0] === 'COMMENT') {
                 continue;
             } elseif ($tok[0] === 'OPERATOR') {
@@ -21,6 +21,12 @@ use Luminous\Scanners\Keywords\JavaKeywords;
 
 class ScalaScanner extends SimpleScanner
 {
+    /**
+     * The overrides look back through the recorded tokens
+     */
+    protected $compactTokens = false;
+    protected $lookbehind = true;
+
     /**
      * Multiline comments nest
      */
@@ -43,8 +49,7 @@ class ScalaScanner extends SimpleScanner
         // I'm not sure if a comment is a special case, or if it's treated as
         // whitespace...
         $xml = false;
-        for ($i = count($this->tokens) - 1; $i >= 0; $i--) {
-            $tok = $this->tokens[$i];
+        for ($i = 0; ($tok = $this->recentToken($i)) !== null; $i++) {
             $name = $tok[0];
             // ... but we're going treat it as a no-op and skip over it
             if ($name === 'COMMENT') {
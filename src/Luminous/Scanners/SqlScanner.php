@@ -4,7 +4,7 @@ namespace Luminous\Scanners;
 
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\SqlKeywords;
+use Luminous\Scanners\Keywords\SqlIdentifierMap;
 
 class SqlScanner extends SimpleScanner
 {
@@ -14,11 +14,7 @@ class SqlScanner extends SimpleScanner
         // $this->removeStreamFilter('oo-syntax');
         $this->removeFilter('comment-to-doc');
         $this->removeFilter('constant');
-        $this->addIdentifierMapping('KEYWORD', SqlKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', SqlKeywords::$TYPES);
-        $this->addIdentifierMapping('VALUE', SqlKeywords::$VALUES);
-        $this->addIdentifierMapping('OPERATOR', SqlKeywords::$OPERATORS);
-        $this->addIdentifierMapping('FUNCTION', SqlKeywords::$FUNCTIONS);
+        $this->addIdentifierMap(SqlIdentifierMap::$NAMES, SqlIdentifierMap::$MAP);
 
         $this->addPattern('IDENT', '/[a-zA-Z_]+\w*/');
         $this->addPattern('COMMENT', TokenPresets::$C_COMMENT_ML);
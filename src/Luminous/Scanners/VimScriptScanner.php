@@ -5,7 +5,7 @@ namespace Luminous\Scanners;
 use Luminous\Core\Utils;
 use Luminous\Core\TokenPresets;
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\VimScriptKeywords;
+use Luminous\Scanners\Keywords\VimScriptIdentifierMap;
 
 // I can't find some formal definition of vimscript's grammar.
 // I'm pretty sure it's more complex than this, but, who knows.
@@ -60,8 +60,7 @@ class VimScriptScanner extends SimpleScanner
         $this->addPattern('IDENT', '/[a-z_]\w*/i');
         $this->addPattern('OPERATOR', '@[~¬!%^&*\-=+;:,<.>/?\|]+@');
 
-        $this->addIdentifierMapping('FUNCTION', VimScriptKeywords::$FUNCTIONS);
-        $this->addIdentifierMapping('KEYWORD', VimScriptKeywords::$KEYWORDS);
+        $this->addIdentifierMap(VimScriptIdentifierMap::$NAMES, VimScriptIdentifierMap::$MAP);
 
         $this->removeStreamFilter('oo-syntax');
         $this->removeFilter('comment-to-doc');
@@ -3,8 +3,7 @@
 namespace Luminous\Scanners;
 
 use Luminous\Core\Scanners\SimpleScanner;
-use Luminous\Scanners\Keywords\CSharpKeywords;
-use Luminous\Scanners\Keywords\VisualBasicKeywords;
+use Luminous\Scanners\Keywords\VisualBasicIdentifierMap;
 
 /*
  * VB.NET
@@ -70,11 +69,7 @@ class VisualBasicScanner extends SimpleScanner
         $this->addPattern('IDENT', '/[a-z_]\w*[%&@!#$]?/i');
 
         // we'll borrow C#'s list of types (ie modules, classes, etc)
-        $this->addIdentifierMapping('VALUE', VisualBasicKeywords::$VALUES);
-        $this->addIdentifierMapping('OPERATOR', VisualBasicKeywords::$OPERATORS);
-        $this->addIdentifierMapping('TYPE', VisualBasicKeywords::$TYPES);
-        $this->addIdentifierMapping('KEYWORD', VisualBasicKeywords::$KEYWORDS);
-        $this->addIdentifierMapping('TYPE', CSharpKeywords::$TYPES);
+        $this->addIdentifierMap(VisualBasicIdentifierMap::$NAMES, VisualBasicIdentifierMap::$MAP);
     }
 
     public static function guessLanguage($src, $info)
@@ -0,0 +1,180 @@
+<?php
+
+namespace Luminous;
+
+/**
+ * @cond USER
+ *
+ * @brief Highlights a stream a piece at a time
+ *
+ * This is for inputs too large to hold in memory several times over, like
+ * logs or SQL dumps. The input is read in chunks, and each chunk is scanned
+ * with the scanner taking checkpoints of its state every so often. The lines
+ * up to the last checkpoint are formatted and passed to the sink straight
+ * away, and the rest of the chunk is carried over and scanned again with the
+ * next one, starting from the checkpoint's state. Memory use then depends on
+ * the chunk size rather than the size of the input.
+ *
+ * A checkpoint is only used if there are a good number of lines after it in
+ * the chunk, so the tokens before it can't have been affected by the chunk
+ * ending early. If a chunk has no usable checkpoint (e.g. it is all one huge
+ * comment), as much input again is read and the lot is scanned again, so the
+ * rescanning adds up to at most about twice the stretch's length.
+ *
+ * Memory use is only bounded for scanners which can take checkpoints (see
+ * Scanner::enableCheckpoints()), and only by the longest stretch of input
+ * without a usable checkpoint. Scanners which can't take checkpoints read the
+ * whole input and scan it once before anything is output.
+ *
+ * The output matches formatting the whole input at once, except for scanners
+ * which record definitions (see Scanner::recordsUserDefs()). Their filters
+ * only know about the definitions scanned so far, so a name used more than a
+ * chunk or so before its definition isn't highlighted as one.
+ *
+ * Use luminous::highlightStream() to highlight a stream.
+ */
+class StreamHighlighter
+{
+    /**
+     * The interval between checkpoints, in lines. This is also the number of
+     * lines a checkpoint needs after it to be used.
+     */
+    const CHECKPOINT_LINES = 64;
+
+    /**
+     * The scanner table
+     */
+    private $scanners;
+
+    /**
+     * The language code of the scanner
+     */
+    private $code;
+
+    /**
+     * The formatter instance
+     */
+    private $formatter;
+
+    /**
+     * The number of bytes to read at a time
+     */
+    private $chunkSize;
+
+    /**
+     * @param $scanners the Scanners table
+     * @param $code the language code of the scanner to use
+     * @param $formatter the formatter to format the output with
+     * @param $chunkSize the number of bytes to read at a time
+     */
+    public function __construct(Scanners $scanners, $code, $formatter, $chunkSize = 262144)
+    {
+        $this->scanners = $scanners;
+        $this->code = $code;
+        $this->formatter = $formatter;
+        $this->chunkSize = max(1, (int)$chunkSize);
+    }
+
+    /**
+     * @brief Highlights everything which can be read from a stream
+     *
+     * @param $input a readable stream resource
+     * @param $sink a callable which is passed each string of output
+     */
+    public function highlight($input, $sink)
+    {
+        $scanner = $this->scanners->acquireScanner($this->code);
+        $checkpointable = $scanner->checkpointable();
+        $this->scanners->releaseScanner($scanner);
+
+        $this->formatter->streamStart($sink);
+        // the source which has been read but not output, and the scanner
+        // state at its start
+        $text = '';
+        $state = null;
+        $want = $checkpointable ? $this->chunkSize : PHP_INT_MAX;
+        $eof = false;
+        while (true) {
+            while (!$eof && strlen($text) < $want) {
+                $data = fread($input, $this->chunkSize);
+                if ($data === false || $data === '') {
+                    $eof = true;
+                } else {
+                    $text .= $data;
+                }
+            }
+            if ($eof) {
+                $scanner = $this->scanner($text, $state);
+                $scanner->main();
+                $this->formatter->streamLines($scanner->tagged());
+                $this->scanners->releaseScanner($scanner);
+                break;
+            }
+            $end = strrpos($text, "\n");
+            if ($end !== false && $this->emitLines(substr($text, 0, $end + 1), $state, $text)) {
+                $want = $this->chunkSize;
+                continue;
+            }
+            // nothing could be output yet, so read as much again
+            $want = 2 * strlen($text);
+        }
+        $this->formatter->streamEnd();
+    }
+
+    /**
+     * @brief Scans some whole lines and outputs them up to the last usable
+     * checkpoint
+     *
+     * @param $lines the lines to scan
+     * @param $state the scanner state at the start of $lines, which is
+     *    updated to the state at the checkpoint
+     * @param $text the unprocessed text, which is updated to start at the
+     *    checkpoint
+     * @return @c TRUE if anything was output
+     * @internal
+     */
+    private function emitLines($lines, &$state, &$text)
+    {
+        $scanner = $this->scanner($lines, $state);
+        $scanner->main();
+        $count = substr_count($lines, "\n");
+        $cut = null;
+        foreach ($scanner->checkpoints() as $checkpoint) {
+            if ($checkpoint['line'] + self::CHECKPOINT_LINES > $count) {
+                break;
+            }
+            $cut = $checkpoint;
+        }
+        if ($cut === null) {
+            $this->scanners->releaseScanner($scanner);
+            return false;
+        }
+        // each line of the tagged string stands alone, so it can be cut at
+        // any newline
+        $tagged = explode("\n", $scanner->tagged(), $cut['line'] + 1);
+        $this->scanners->releaseScanner($scanner);
+        array_pop($tagged);
+        $this->formatter->streamLines(implode("\n", $tagged));
+        $text = substr($text, $cut['pos']);
+        $state = $cut['state'];
+        return true;
+    }
+
+    /**
+     * @brief Gets a scanner from the pool, set up to scan the given string
+     * from the given state
+     * @internal
+     */
+    private function scanner($text, $state)
+    {
+        $scanner = $this->scanners->acquireScanner($this->code);
+        $scanner->prepare($text);
+        $scanner->enableCheckpoints(self::CHECKPOINT_LINES);
+        if ($state !== null) {
+            $scanner->restoreCheckpoint(array('line' => 0, 'pos' => 0, 'state' => $state));
+        }
+        return $scanner;
+    }
+}
+
+/** @endcond */
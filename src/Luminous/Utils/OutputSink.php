@@ -0,0 +1,150 @@
+<?php
+
+/** @cond ALL */
+
+namespace Luminous\Utils;
+
+use InvalidArgumentException;
+
+/**
+ * Somewhere for a formatter to write its output as it is produced.
+ *
+ * The target is a callable, which is passed each string of output, or a
+ * writable stream resource, or the name of a stream to open (such as
+ * 'php://output'). @c NULL prints the output.
+ *
+ * Output is collected and passed on every so many lines of the source, after
+ * which streams and PHP's own output buffer are flushed. This lets a web
+ * server send the first screen of code while the rest is still being
+ * highlighted. Output buffers started with ob_start() are left alone.
+ */
+class OutputSink
+{
+    /**
+     * The callable or stream resource output goes to, or @c NULL to print it
+     */
+    private $target;
+
+    /**
+     * Whether the stream was opened here, so needs closing
+     */
+    private $opened = false;
+
+    /**
+     * Whether flushing the target should flush PHP's output too
+     */
+    private $output = false;
+
+    /**
+     * How many lines to collect before passing them on, or 0 to pass output
+     * on as soon as it is written
+     */
+    private $flushLines;
+
+    /**
+     * Output which hasn't been passed on yet, and how many lines it holds
+     */
+    private $buffer = '';
+    private $lines = 0;
+
+    /**
+     * @param $target the callable, stream resource or stream name to write to
+     * @param $flushLines how many lines of the source to collect between
+     *    flushes, or 0 to write through
+     * @throw InvalidArgumentException if $target isn't one of those, or the
+     *    stream can't be opened
+     */
+    public function __construct($target = null, $flushLines = 0)
+    {
+        if (is_string($target) && !is_callable($target)) {
+            $name = $target;
+            $target = @fopen($name, 'wb');
+            if ($target === false) {
+                throw new InvalidArgumentException("Cannot open '$name' for writing");
+            }
+            $this->opened = true;
+        } elseif ($target !== null && !is_resource($target) && !is_callable($target)) {
+            throw new InvalidArgumentException('Output sink must be a callable or a stream');
+        }
+        if ($target === null) {
+            $this->output = true;
+        } elseif (is_resource($target)) {
+            $meta = stream_get_meta_data($target);
+            $this->output = $meta['uri'] === 'php://output';
+        }
+        $this->target = $target;
+        $this->flushLines = max(0, (int)$flushLines);
+    }
+
+    /**
+     * Writes some output
+     */
+    public function write($output)
+    {
+        if ($this->flushLines === 0) {
+            $this->send($output);
+        } else {
+            $this->buffer .= $output;
+        }
+    }
+
+    /**
+     * Notes that the output written so far covers $count more lines of the
+     * source, and flushes if enough lines have built up
+     */
+    public function lines($count)
+    {
+        $this->lines += $count;
+        if ($this->flushLines > 0 && $this->lines >= $this->flushLines) {
+            $this->flush();
+        }
+    }
+
+    /**
+     * Passes on any collected output, and flushes the target
+     */
+    public function flush()
+    {
+        $buffer = $this->buffer;
+        $this->buffer = '';
+        $this->lines = 0;
+        $this->send($buffer);
+        if (is_resource($this->target)) {
+            fflush($this->target);
+        }
+        if ($this->output) {
+            flush();
+        }
+    }
+
+    /**
+     * Flushes, and closes the stream if it was opened here
+     */
+    public function close()
+    {
+        $this->flush();
+        if ($this->opened) {
+            fclose($this->target);
+            $this->opened = false;
+        }
+    }
+
+    /**
+     * @internal
+     */
+    private function send($output)
+    {
+        if ($output === '') {
+            return;
+        }
+        if ($this->target === null) {
+            echo $output;
+        } elseif (is_resource($this->target)) {
+            fwrite($this->target, $output);
+        } else {
+            call_user_func($this->target, $output);
+        }
+    }
+}
+
+/** @endcond */
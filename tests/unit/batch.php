@@ -0,0 +1,43 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Batch highlighting test - checks highlightMany() gives the same output as
+ * highlighting each job on its own, with and without the cache.
+ */
+
+include __DIR__ . '/helper.inc';
+
+$jobs = array(
+    'a' => array('php', "<?php\n\$x = 1; // " . mt_rand() . "\n"),
+    'b' => array('css', "a { color: red; } /* " . mt_rand() . " */"),
+    'c' => array('php', "<?php\n\$x = 1;\n"),
+    7 => array('php', "<?php\n\$x = 1;\n"),
+    'e' => array('c', "<?php\n\$x = 1;\n"),
+    'f' => array('js', ''),
+);
+
+foreach (array(false, true, true) as $cache) {
+    $settings = array('cache' => $cache, 'format' => 'html');
+    $results = Luminous::highlightMany($jobs, $settings);
+    assert(array_keys($results) === array_keys($jobs));
+    foreach ($jobs as $key => $job) {
+        if ($results[$key] !== Luminous::highlight($job[0], $job[1], $settings)) {
+            echo "Batch output differs for job $key (cache: " . var_export($cache, true) . ")\n";
+            assert(0);
+        }
+    }
+}
+
+assert(Luminous::highlightMany(array()) === array());
+
+foreach (array(array(array('php')), array(array(1, 'x')), array('x')) as $bad) {
+    $exception = false;
+    try {
+        Luminous::highlightMany($bad);
+    } catch (InvalidArgumentException $e) {
+        $exception = true;
+    }
+    assert($exception);
+}
@@ -21,3 +21,40 @@ $data1 = $fs->read();
 echo $data . "\n\n\n";
 echo $data1 . "\n";
 assert($data1 === $data);
+
+// batches
+$entries = array();
+for ($i = 0; $i < 5; $i++) {
+    $entries[md5($data . $i)] = $data . $i;
+}
+$batch = new FileSystemCache('');
+$batch->writeMany($entries);
+$missing = md5($data . 'missing');
+$batch = new FileSystemCache('');
+$found = $batch->readMany(array_merge(array_keys($entries), array($missing)));
+ksort($found);
+ksort($entries);
+assert($found === $entries);
+$single = new FileSystemCache(key($entries));
+assert($single->read() === reset($entries));
+
+// writes go through a temporary file, which is renamed into place
+$dir = Luminous::root() . '/cache/' . substr($id, 0, 2);
+assert(glob($dir . '/*.tmp') === array());
+
+// a hit only refreshes the mtime when the entry is getting old, and never
+// when purging is disabled
+function readAged($id, $age, $purgeTime)
+{
+    $path = Luminous::root() . '/cache/' . substr($id, 0, 2) . '/' . substr($id, 2);
+    touch($path, time() - $age);
+    clearstatcache();
+    $fs = new FileSystemCache($id);
+    $fs->setPurgeTime($purgeTime);
+    assert($fs->read() !== null);
+    clearstatcache();
+    return time() - filemtime($path);
+}
+assert(readAged($id, 50, 1000) >= 50);
+assert(readAged($id, 500, 1000) < 50);
+assert(readAged($id, 500, 0) >= 500);
@@ -0,0 +1,50 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Cache key test - checks that only the options a formatter declares in
+ * cacheOptions() make a new cache entry.
+ */
+
+use Luminous\Formatters\HtmlFormatter;
+use Luminous\Formatters\FullPageHtmlFormatter;
+
+include __DIR__ . '/helper.inc';
+
+function cacheFiles()
+{
+    return count(glob(Luminous::root() . '/cache/*/*'));
+}
+
+// every declared option is a real one
+foreach (array('Formatter', 'HtmlFormatter', 'InlineHtmlFormatter', 'FullPageHtmlFormatter', 'LatexFormatter',
+    'AnsiFormatter', 'IdentityFormatter') as $class) {
+    foreach (call_user_func(array('Luminous\\Formatters\\' . $class, 'cacheOptions')) as $option) {
+        Luminous::setting($option);
+    }
+}
+assert(!in_array('theme', HtmlFormatter::cacheOptions()));
+assert(in_array('theme', FullPageHtmlFormatter::cacheOptions()));
+
+$source = 'int x = ' . mt_rand() . '; /* ' . uniqid() . ' */';
+Luminous::set(array('cache' => true, 'format' => 'html', 'theme' => 'luminous_light.css'));
+Luminous::highlight('c', $source);
+$n = cacheFiles();
+// HTML doesn't depend on the theme
+Luminous::set('theme', 'luminous_dark.css');
+Luminous::highlight('c', $source);
+assert(cacheFiles() === $n);
+// but it does on line numbers
+Luminous::set('line-numbers', false);
+Luminous::highlight('c', $source);
+assert(cacheFiles() === $n + 1);
+
+// a full page does depend on the theme
+Luminous::set('format', 'html-full');
+Luminous::highlight('c', $source);
+Luminous::set('theme', 'luminous_light.css');
+Luminous::highlight('c', $source);
+assert(cacheFiles() === $n + 3);
+
+Luminous::set(array('format' => 'html', 'line-numbers' => true));
@@ -0,0 +1,87 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Cache tier test - checks the in-process LRU cache, and that tiers in front
+ * of a cache are read first and filled from the slower tiers.
+ */
+
+use Luminous\Caches\ApcuCache;
+use Luminous\Caches\FileSystemCache;
+use Luminous\Caches\MemoryCache;
+
+include __DIR__ . '/helper.inc';
+
+function memoryCache($id)
+{
+    return new MemoryCache($id, 400);
+}
+
+// least recently used entries are evicted first
+MemoryCache::clear();
+foreach (array('a', 'b', 'c') as $id) {
+    memoryCache($id)->write(str_repeat($id, 100));
+}
+assert(memoryCache('a')->read() === str_repeat('a', 100));
+memoryCache('d')->write(str_repeat('d', 100));
+memoryCache('e')->write(str_repeat('e', 100));
+// b was the least recently used
+assert(memoryCache('b')->read() === null);
+foreach (array('a', 'c', 'd', 'e') as $id) {
+    assert(memoryCache($id)->read() === str_repeat($id, 100));
+}
+// entries over a quarter of the size aren't kept
+memoryCache('f')->write(str_repeat('f', 101));
+assert(memoryCache('f')->read() === null);
+assert(memoryCache('a')->read() !== null);
+
+// a tier is filled from the cache behind it, and read first afterwards
+MemoryCache::clear();
+$id = md5(uniqid('tiers', true));
+$fs = new FileSystemCache($id);
+$fs->write('data');
+$layered = new FileSystemCache($id);
+$layered->addTier(new MemoryCache($id, 1000));
+assert($layered->read() === 'data');
+$path = Luminous::root() . '/cache/' . substr($id, 0, 2) . '/' . substr($id, 2);
+unlink($path);
+$layered = new FileSystemCache($id);
+$layered->addTier(new MemoryCache($id, 1000));
+assert($layered->read() === 'data');
+
+// writes go to every tier
+$id = md5(uniqid('tiers', true));
+$layered = new FileSystemCache($id);
+$layered->addTier(new MemoryCache($id, 1000));
+$layered->write('more data');
+assert(memoryCache($id)->read() === 'more data');
+$fs = new FileSystemCache($id);
+assert($fs->read() === 'more data');
+
+// and batches
+$entries = array();
+for ($i = 0; $i < 3; $i++) {
+    $entries[md5(uniqid('tiers', true))] = "entry $i";
+}
+$ids = array_keys($entries);
+$fs = new FileSystemCache('');
+$fs->writeMany(array_slice($entries, 1, null, true));
+memoryCache($ids[0])->write($entries[$ids[0]]);
+$layered = new FileSystemCache('');
+$layered->addTier(new MemoryCache('', 1000));
+$found = $layered->readMany($ids);
+ksort($found);
+ksort($entries);
+assert($found === $entries);
+assert(memoryCache($ids[2])->read() === $entries[$ids[2]]);
+
+if (ApcuCache::available()) {
+    $id = md5(uniqid('tiers', true));
+    $apcu = new ApcuCache($id);
+    assert($apcu->read() === null);
+    $apcu->write('shared');
+    $apcu = new ApcuCache($id);
+    assert($apcu->read() === 'shared');
+}
+MemoryCache::clear();
@@ -0,0 +1,97 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Scanner checkpoint test - scans some source taking checkpoints, then
+ * resumes a fresh scanner from each checkpoint and checks it produces the same
+ * tokens as the rest of the original scan.
+ */
+
+include __DIR__ . '/helper.inc';
+
+$sources = array(
+    'c' => "#include <stdio.h>\n/* a block\n   comment */\nint main(int argc, char **argv)\n{\n"
+        . "    // say hello\n    printf(\"hello %s\\n\", argv[0]);\n    return 0;\n}\n",
+    'css' => "a {\n  color: red;\n  background: url(\"x.png\");\n}\n/* note */\n"
+        . "div > p:first-child {\n  margin: 0 auto;\n}\n",
+    'js' => "var re = /ab+c/g;\nfunction f(a) {\n  return a.b('str' + \"x\");\n}\n"
+        . "/* multi\n line */\nf(1);\n",
+    'json' => "{\n  \"a\": [1, 2,\n    3],\n  \"b\": {\n    \"c\": null\n  }\n}\n",
+    'ruby' => "x = <<EOF\nheredoc\nEOF\ndef f(a)\n  a.each { |b|\n    puts \"#{b}\"\n  }\nend\n",
+    'html' => "<html>\n<style>\np {\n  color: red;\n}\n</style>\n<script>\nvar x = 1;\n"
+        . "f(x);\n</script>\n<p class='a'>\ntext\n</p>\n</html>\n",
+    'php' => "<p>\n<?php\n\$x = array(1, 2);\n// comment\necho \"\$x[0]\\n\";\n?>\n"
+        . "<p class='a'>\ntext</p>\n",
+);
+
+function tokenLength($t)
+{
+    return $t[2] ? strlen(htmlspecialchars_decode(strip_tags($t[1]), ENT_NOQUOTES)) : strlen($t[1]);
+}
+
+function checkResumes($language, $source, $interval)
+{
+    global $luminous_;
+    $scanner = $luminous_->scanners->getScanner($language);
+    $scanner->string($source);
+    $scanner->init();
+    $scanner->enableCheckpoints($interval);
+    $scanner->main();
+    $tokens = $scanner->tokenArray();
+    $checkpoints = $scanner->checkpoints();
+    assert(!empty($checkpoints));
+
+    $last = 0;
+    foreach ($checkpoints as $checkpoint) {
+        // checkpoints must survive being stored
+        $checkpoint = unserialize(serialize($checkpoint));
+        assert($checkpoint['line'] >= $last + $interval);
+        assert($checkpoint['line'] === substr_count($source, "\n", 0, $checkpoint['pos']));
+        $last = $checkpoint['line'];
+
+        // find the tokens from the checkpoint onwards
+        $pos = 0;
+        $i = 0;
+        while ($pos < $checkpoint['pos']) {
+            $pos += tokenLength($tokens[$i++]);
+        }
+        assert($pos === $checkpoint['pos']);
+
+        $resumed = $luminous_->scanners->getScanner($language);
+        $resumed->string($source);
+        $resumed->init();
+        $resumed->restoreCheckpoint($checkpoint);
+        $resumed->main();
+        if ($resumed->tokenArray() !== array_slice($tokens, $i)) {
+            echo "Resuming $language from line {$checkpoint['line']} gave different tokens\n";
+            assert(0);
+        }
+    }
+}
+
+foreach ($sources as $language => $source) {
+    checkResumes($language, $source, 2);
+}
+
+// a scanner which looks back at the tokens before a slash (or a <) to decide
+// whether it starts a regex (or an XML literal) must see the same tokens when
+// it's resumed right after them
+$seams = array(
+    'js' => "var a = 1, b = 2, c = 3;\nx = a\n/ b / c;\n/* c */ x = (\n/ab+c/g);\n",
+    'ruby' => "x = a\n/ b / c\ny = (\n/ab+c/)\n",
+    'perl' => "\$x = \$a\n/ \$b / \$c;\n\$y = (\n/ab+c/);\n",
+    'groovy' => "x = a\n/ b / c\ny =\n/ab+c/\n",
+    'scala' => "val x = a\n< b\nf(\n<a>b</a>)\n",
+);
+foreach ($seams as $language => $source) {
+    checkResumes($language, $source, 1);
+}
+
+// scanners which can't be resumed don't take checkpoints
+$scanner = $luminous_->scanners->getScanner('python');
+$scanner->string("def f():\n    pass\n\n\n\nf()\n");
+$scanner->init();
+$scanner->enableCheckpoints(1);
+$scanner->main();
+assert($scanner->checkpoints() === array());
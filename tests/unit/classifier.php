@@ -0,0 +1,42 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * N-gram classifier test - checks the classifier recognises a few obvious
+ * snippets, and that the guess-classifier option uses it.
+ */
+
+use Luminous\Classifier\NgramClassifier;
+use Luminous\Classifier\NgramModel;
+
+include __DIR__ . '/helper.inc';
+
+$snippets = array(
+    "#include <stdio.h>\nint main(void) {\n    printf(\"hi\\n\");\n    return 0;\n}\n" => 'cpp',
+    "def foo(self, x):\n    return [y for y in x if y is not None]\n" => 'python',
+    "<?php\necho \$foo->bar();\n\$x = array('a' => 1);\n" => 'php',
+    "body { color: #fff; margin: 0 auto; }\n" => 'css',
+);
+foreach ($snippets as $src => $code) {
+    $p = NgramClassifier::classify($src);
+    assert(count($p) === count(NgramModel::$LANGUAGES));
+    assert(abs(array_sum($p) - 1.0) < 1e-6);
+    reset($p);
+    assert(key($p) === $code);
+}
+// nothing to go on
+assert(NgramClassifier::classify('') === array());
+
+// features are counted at most CAP times
+$features = NgramClassifier::features(str_repeat('a b ', 100));
+assert($features['a'] === NgramClassifier::CAP);
+assert($features['a b'] === NgramClassifier::CAP);
+
+Luminous::set('guess-classifier', true);
+foreach ($snippets as $src => $code) {
+    $guesses = Luminous::guessLanguageFull($src);
+    assert(count($guesses) === count(Luminous::scanners()));
+    assert(in_array($code, $guesses[0]['codes']));
+}
+Luminous::set('guess-classifier', false);
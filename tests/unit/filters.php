@@ -0,0 +1,56 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Filter pipeline test - the built-in rule-map and oo-syntax stream filters
+ * are folded into the pass which runs the individual filters, unless another
+ * stream filter runs after them. Check that both ways give the same output on
+ * the regression test sources, for token arrays and token buffers.
+ */
+
+include __DIR__ . '/helper.inc';
+
+function noopFilter($tokens)
+{
+    return $tokens;
+}
+
+$scanners = $luminous_->scanners;
+$root = dirname(__DIR__) . '/regression';
+foreach (scandir($root) as $language) {
+    if ($language[0] === '.' || !is_dir("$root/$language") || $scanners->getScanner($language, false) === null) {
+        continue;
+    }
+    foreach (glob("$root/$language/*") as $file) {
+        if (preg_match('/\.luminous$/', $file)) {
+            continue;
+        }
+        $source = file_get_contents($file);
+        $fused = $scanners->getScanner($language);
+        $expected = $fused->highlight($source);
+        foreach (array(true, false) as $compact) {
+            $unfused = $scanners->getScanner($language);
+            $unfused->addStreamFilter('noop', 'noopFilter', $compact);
+            if ($unfused->highlight($source) !== $expected) {
+                echo "Fused filters differ on $file (compact: " . var_export($compact, true) . ")\n";
+                assert(0);
+            }
+        }
+    }
+}
+
+// adding and removing filters recompiles them
+$scanner = $scanners->getScanner('c');
+$source = 'int x = y->z;';
+$before = $scanner->highlight($source);
+$scanner->removeStreamFilter('oo-syntax');
+$after = $scanner->highlight($source);
+assert($before !== $after);
+assert(strpos($after, '<OBJ>') === false);
+$scanner->addFilter('upper', 'OPERATOR', function ($token) {
+    $token[1] = strtoupper($token[1]);
+    return $token;
+});
+$scanner->removeFilter('upper');
+assert($scanner->highlight($source) === $after);
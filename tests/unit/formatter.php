@@ -1,6 +1,11 @@
 <?php
 
+use Luminous\Core\Utils;
+use Luminous\Formatters\AnsiFormatter;
 use Luminous\Formatters\Formatter;
+use Luminous\Formatters\HtmlFormatter;
+use Luminous\Formatters\InlineHtmlFormatter;
+use Luminous\Formatters\LatexFormatter;
 
 if (php_sapi_name() !== 'cli') {
     die('This must be run from the command line');
@@ -62,3 +67,45 @@ class FormatterTest extends Formatter
 
 $test = new FormatterTest();
 $test->test();
+
+// formatters which build their output from the token stream must give the
+// same result as formatting the XML string
+$tokens = array(
+    array('KEYWORD', 'if', false),
+    array(null, " (a < b && c) {\n\t", false),
+    array('COMMENT', "/* <COMMENT_NOTE>TODO</COMMENT_NOTE>: x &amp; y\n */", true),
+    array(null, "\n\t", false),
+    array('STRING', "'see www.example.com'", false),
+    array(null, "\n}", false),
+);
+foreach (array(new HtmlFormatter(), new InlineHtmlFormatter()) as $f) {
+    foreach (array(true, false) as $lineNumbers) {
+        $f->lineNumbers = $lineNumbers;
+        assert($f->consumesTokens());
+        assert($f->formatTokens($tokens) === $f->format(Utils::tagTokens($tokens)));
+    }
+}
+// a formatter which only overrides format() can't be given tokens
+assert(!$test->consumesTokens());
+
+// the same goes for LaTeX and ANSI, where a tag around nothing but whitespace
+// (such as an indented blank line in a comment) is dropped but the whitespace
+// is kept
+$tokens = array(
+    array('KEYWORD', 'if', false),
+    array(null, " (a < b && c) {\n\t", false),
+    array('COMMENT', "/*\n     \n\t * a_b {x} <DOCTAG>@see</DOCTAG><DOCTAG> </DOCTAG>\n */", true),
+    array(null, "\n\t", false),
+    array('STRING', "'see www.example.com'", false),
+    array(null, "\n}", false),
+);
+foreach (array(new LatexFormatter(), new AnsiFormatter()) as $f) {
+    $f->setTheme(Luminous::theme('geonyx'));
+    foreach (array(120, 10, 0) as $wrap) {
+        $f->wrapLength = $wrap;
+        assert($f->consumesTokens());
+        $output = $f->formatTokens($tokens);
+        assert($output === $f->format(Utils::tagTokens($tokens)));
+        assert(strpos($output, "     ") !== false);
+    }
+}
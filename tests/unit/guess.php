@@ -0,0 +1,51 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Language guessing test - checks the shortcuts taken by the guesser: file
+ * extensions, shebangs, sampling large sources and memoization.
+ */
+
+include __DIR__ . '/helper.inc';
+
+function checkGuesses($guesses)
+{
+    assert(count($guesses) === count(Luminous::scanners()));
+    for ($i = 1; $i < count($guesses); $i++) {
+        assert($guesses[$i - 1]['p'] >= $guesses[$i]['p']);
+    }
+}
+
+// a registered extension decides the language
+$guesses = Luminous::guessLanguageFull('x = 1', 'script.PY');
+checkGuesses($guesses);
+assert(in_array('py', $guesses[0]['codes']));
+assert($guesses[0]['p'] === 1.0);
+assert(Luminous::guessLanguage('x = 1', 0.05, 'plain', '/tmp/a.rb') === 'ruby');
+// an unknown one doesn't
+assert(Luminous::guessLanguage('x = 1', 0.05, 'plain', 'a.unknown') === 'plain');
+
+// so does a shebang
+foreach (array(
+    "#!/usr/bin/env python3\nx = 1\n" => 'python',
+    "#!/usr/bin/python2.7 -u\nx = 1\n" => 'python',
+    "#!/bin/sh\necho hi\n" => 'bash',
+    "#!/usr/bin/env node\nvar x;\n" => 'js',
+) as $src => $code) {
+    $guesses = Luminous::guessLanguageFull($src);
+    checkGuesses($guesses);
+    assert($guesses[0]['p'] === 1.0);
+    assert($guesses[0]['codes'][0] === $code);
+}
+
+// a large source is guessed from a sample, the same as a small one
+$src = "class Foo(object):\n    def __init__(self):\n        self.x = None\n";
+$small = Luminous::guessLanguage($src);
+$large = Luminous::guessLanguage(str_repeat($src . "\n", (int)(100000 / strlen($src)) + 1));
+assert($small === $large);
+
+// memoized results are the same as fresh ones
+$first = Luminous::guessLanguageFull($src);
+checkGuesses($first);
+assert(Luminous::guessLanguageFull($src) === $first);
@@ -0,0 +1,79 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Identifier map test - checks the generated identifier maps are up to date
+ * with the keyword lists, and that identifiers map to the first token name
+ * they were given.
+ */
+
+use Luminous\Core\Scanners\Scanner;
+use Luminous\Scanners\Keywords\CIdentifierMap;
+use Luminous\Scanners\Keywords\CKeywords;
+use Luminous\Scanners\Keywords\CSharpKeywords;
+use Luminous\Scanners\Keywords\PhpIdentifierMap;
+use Luminous\Scanners\Keywords\PhpKeywords;
+use Luminous\Scanners\Keywords\VisualBasicIdentifierMap;
+use Luminous\Scanners\Keywords\VisualBasicKeywords;
+
+include __DIR__ . '/helper.inc';
+
+class IdentMapScanner extends Scanner
+{
+    public function __construct($caseSensitive = true)
+    {
+        parent::__construct();
+        $this->caseSensitive = $caseSensitive;
+    }
+
+    public function identifiers()
+    {
+        return $this->identMap;
+    }
+}
+
+function mapped($scanner, $ident)
+{
+    $token = $scanner->mapIdentifierFilter(array('IDENT', $ident, false));
+    return $token[0];
+}
+
+// the generated maps match building them from the lists
+$lists = new IdentMapScanner();
+$lists->addIdentifierMapping('FUNCTION', CKeywords::$FUNCTIONS);
+$lists->addIdentifierMapping('KEYWORD', CKeywords::$KEYWORDS);
+$lists->addIdentifierMapping('TYPE', CKeywords::$TYPES);
+$map = new IdentMapScanner();
+$map->addIdentifierMap(CIdentifierMap::$NAMES, CIdentifierMap::$MAP);
+assert($lists->identifiers() === $map->identifiers());
+
+$lists = new IdentMapScanner(false);
+$lists->addIdentifierMapping('FUNCTION', PhpKeywords::$FUNCTIONS);
+$lists->addIdentifierMapping('KEYWORD', PhpKeywords::$KEYWORDS);
+assert($lists->identifiers() === PhpIdentifierMap::$MAP);
+
+$lists = new IdentMapScanner(false);
+$lists->addIdentifierMapping('VALUE', VisualBasicKeywords::$VALUES);
+$lists->addIdentifierMapping('OPERATOR', VisualBasicKeywords::$OPERATORS);
+$lists->addIdentifierMapping('TYPE', VisualBasicKeywords::$TYPES);
+$lists->addIdentifierMapping('KEYWORD', VisualBasicKeywords::$KEYWORDS);
+$lists->addIdentifierMapping('TYPE', CSharpKeywords::$TYPES);
+assert($lists->identifiers() === VisualBasicIdentifierMap::$MAP);
+assert(mapped($lists, 'Nothing') === 'VALUE');
+assert(mapped($lists, 'NOTHING') === 'VALUE');
+
+// precedence
+$scanner = new IdentMapScanner();
+$scanner->addIdentifierMapping('A', array('x'));
+$scanner->addIdentifierMapping('B', array('x', 'y'));
+$scanner->addIdentifierMapping('A', array('y'));
+assert(mapped($scanner, 'x') === 'A');
+assert(mapped($scanner, 'y') === 'A');
+assert(mapped($scanner, 'z') === 'IDENT');
+assert(mapped($scanner, 'X') === 'IDENT');
+
+$scanner->addIdentifierMap(array('C', 'B'), array('y' => 'C', 'z' => 'B', 'w' => 'C'));
+assert(mapped($scanner, 'y') === 'A');
+assert(mapped($scanner, 'z') === 'B');
+assert(mapped($scanner, 'w') === 'C');
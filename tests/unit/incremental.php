@@ -0,0 +1,82 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Incremental highlighting test - applies random edits to some source and
+ * checks that the incremental output is always the same as highlighting the
+ * edited source from scratch.
+ */
+
+include __DIR__ . '/helper.inc';
+
+$sources = array(
+    'c' => "#include <stdio.h>\n\n/* a block\n   comment */\nint main(int argc, char **argv)\n{\n"
+        . "    // say hello\n    printf(\"hello %s\\n\", argv[0]);\n    return 0;\n}\n",
+    'css' => "a {\n  color: red;\n  background: url(\"x.png\");\n}\n\n/* note */\n"
+        . "div > p:first-child {\n  margin: 0 auto;\n}\n",
+    'python' => "def f(x):\n    '''doc\n    string'''\n    return x + 1  # comment\n\n"
+        . "class A(object):\n    pass\n",
+    'php' => "<html>\n<?php\n\$x = array(1, 2);\n// comment\necho \"\$x[0]\\n\";\n?>\n"
+        . "<p class='a'>text</p>\n</html>\n",
+    'js' => "var re = /ab+c/g;\nfunction f(a) {\n  return a.b('str' + \"x\");\n}\n"
+        . "/* multi\n line */\nf(1);\n",
+);
+$insertions = array('', 'x', ' ', "\n", '/*', '*/', '"', "'", '{', '}', '#', "foo\nbar", '<?php ', '?>', "\r\n");
+
+// each of these formats the document a piece at a time in its own way
+$formats = array(
+    array('format' => 'html'),
+    array('format' => 'html', 'lineNumbers' => false),
+    array('format' => 'html-full'),
+    array('format' => 'latex'),
+    array('format' => 'none'),
+);
+mt_srand(1);
+foreach ($formats as $format) {
+    $settings = array_merge(array('cache' => false), $format);
+    foreach ($sources as $language => $source) {
+        $h = Luminous::highlightIncremental($language, $source, $settings);
+        assert($h->output() === Luminous::highlight($language, $source, $settings));
+        for ($i = 0; $i < 40; $i++) {
+            $length = strlen($h->source());
+            $offset = mt_rand(0, $length);
+            $delete = mt_rand(0, min(3, $length - $offset));
+            $insert = $insertions[mt_rand(0, count($insertions) - 1)];
+            $out = $h->edit($offset, $delete, $insert);
+            $expected = Luminous::highlight($language, $h->source(), $settings);
+            if ($out !== $expected) {
+                echo "Incremental {$settings['format']} output differs for $language after edit ($offset, $delete, "
+                    . var_export($insert, true) . ")\n";
+                assert(0);
+            }
+        }
+    }
+}
+
+// a definition changes how its name is highlighted before it as well as after,
+// so renaming one has to re-highlight a call on an earlier line
+$definitions = array(
+    'go' => "package main\n\nfunc main() {\n    helper(1)\n}\n\nfunc other(x int) {\n}\n",
+    'php' => "<?php\nhelper(1);\n\nfunction other(\$x) {\n}\n",
+);
+foreach ($definitions as $language => $source) {
+    $settings = array('cache' => false, 'format' => 'none');
+    $h = Luminous::highlightIncremental($language, $source, $settings);
+    $offset = strpos($source, 'other');
+    assert(strpos($h->output(), '<FUNCTION>helper</FUNCTION>') === false);
+    $out = $h->edit($offset, strlen('other'), 'helper');
+    assert($out === Luminous::highlight($language, $h->source(), $settings));
+    assert(strpos($out, '<FUNCTION>helper</FUNCTION>') !== false);
+    $out = $h->edit($offset, strlen('helper'), 'other');
+    assert($out === Luminous::highlight($language, $source, $settings));
+    assert(strpos($out, '<FUNCTION>helper</FUNCTION>') === false);
+}
+
+$exception = false;
+try {
+    $h->edit(strlen($h->source()) + 1, 0, 'x');
+} catch (InvalidArgumentException $e) {
+    $exception = true;
+}
+assert($exception);
@@ -0,0 +1,90 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Line range test - highlights ranges of lines and checks they match the same
+ * lines of the whole highlighted source, with and without checkpoints.
+ */
+
+include __DIR__ . '/helper.inc';
+
+$sources = array(
+    'c' => "#include <stdio.h>\n/* a block\n   comment */\nint main(int argc, char **argv)\n{\n"
+        . "    // say hello\n    printf(\"hello %s\\n\", argv[0]);\n    return 0;\n}\n",
+    'js' => "var re = /ab+c/g;\nfunction f(a) {\n  return a.b('str' + \"x\");\n}\n"
+        . "/* multi\n line */\nf(1);\n",
+    'html' => "<html>\n<style>\np {\n  color: red;\n}\n</style>\n<script>\nvar x = 1;\n"
+        . "f(x);\n</script>\n<p class='a'>\ntext\n</p>\n</html>",
+    'python' => "def f(x):\n    '''doc\n    string'''\n    return x + 1\n\nclass A(object):\n    pass\n",
+    'go' => "package main\n\nfunc main() {\n    helper(1)\n}\n\nfunc helper(x int) {\n}\n",
+);
+
+foreach ($sources as $language => $source) {
+    $full = explode("\n", Luminous::highlight($language, $source, array('format' => 'none', 'cache' => false)));
+    $count = substr_count($source, "\n") + 1;
+    foreach (array(false, true) as $cache) {
+        for ($first = 1; $first <= $count; $first++) {
+            for ($last = $first; $last <= $count + 1; $last += 2) {
+                // the first pass with the cache on builds the checkpoints,
+                // later ones resume from them
+                for ($pass = 0; $pass < ($cache ? 2 : 1); $pass++) {
+                    $out = Luminous::highlight($language, $source, array(
+                        'format' => 'none',
+                        'cache' => $cache,
+                        'lines' => array($first, $last),
+                        'checkpoint-interval' => 2,
+                    ));
+                    $expected = implode("\n", array_slice($full, $first - 1, $last - $first + 1));
+                    if ($out !== $expected) {
+                        echo "Lines $first-$last of $language differ (cache: " . var_export($cache, true) . ")\n";
+                        assert(0);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// a definition after the range still changes how it is highlighted
+$out = Luminous::highlight('go', $sources['go'], array('format' => 'none', 'cache' => false, 'lines' => array(3, 5)));
+assert(strpos($out, '<FUNCTION>helper</FUNCTION>') !== false);
+
+// the checkpoint index grows as deeper ranges are asked for
+function checkpointIndexes()
+{
+    $indexes = array();
+    foreach (glob(Luminous::root() . '/cache/*/*') as $file) {
+        $data = @gzuncompress(file_get_contents($file));
+        $index = ($data === false) ? false : @unserialize($data);
+        if (is_array($index) && isset($index['checkpoints'])) {
+            $indexes[$file] = $index;
+        }
+    }
+    return $indexes;
+}
+$source = str_repeat("int x = 1;\n", 40) . '/* ' . uniqid() . " */\n";
+$settings = array('format' => 'none', 'cache' => true, 'checkpoint-interval' => 5);
+$before = checkpointIndexes();
+Luminous::highlight('c', $source, array_merge($settings, array('lines' => array(1, 12))));
+$new = array_diff_key(checkpointIndexes(), $before);
+assert(count($new) === 1);
+$file = key($new);
+$shallow = count($new[$file]['checkpoints']);
+Luminous::highlight('c', $source, array_merge($settings, array('lines' => array(20, 30))));
+$indexes = checkpointIndexes();
+assert(count($indexes[$file]['checkpoints']) > $shallow);
+
+// lines are numbered from the start of the range
+$out = Luminous::highlight('c', $sources['c'], array('cache' => false, 'lines' => array(4, 5)));
+assert(strpos($out, '<span>4</span><span>5</span></') !== false);
+
+foreach (array(array(0, 2), array(3, 2), array(1), 'x') as $lines) {
+    $exception = false;
+    try {
+        Luminous::highlight('c', 'x', array('lines' => $lines));
+    } catch (InvalidArgumentException $e) {
+        $exception = true;
+    }
+    assert($exception);
+}
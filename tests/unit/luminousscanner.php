@@ -100,5 +100,33 @@ class ScannerTest extends Scanner
     }
 }
 
+class CompactScannerTest extends ScannerTest
+{
+    protected $compactTokens = true;
+}
+
 $tester = new ScannerTest();
 $tester->test();
+
+// the compact token buffer must behave as the token array does
+$tester = new CompactScannerTest();
+$tester->test();
+
+$src = 'obj->foo(FOO, "x\\n"); // TODO';
+$outputs = array();
+foreach (array(new ScannerTest(), new CompactScannerTest()) as $s) {
+    $s->string($src);
+    $s->start();
+    $s->recordRange(0, 3, 'IDENT');
+    $s->recordRange(3, 5, 'OPERATOR');
+    $s->recordRange(5, 8, 'IDENT');
+    $s->record('(', null);
+    $s->recordRange(9, 12, 'IDENT');
+    $s->recordRange(12, 14, null);
+    $s->recordRange(14, 19, 'STRING');
+    $s->recordRange(19, 22, null);
+    $s->recordRange(22, 29, 'COMMENT');
+    $s->record('<b>', 'KEYWORD', true);
+    $outputs[] = $s->tagged();
+}
+assert($outputs[0] === $outputs[1]);
@@ -0,0 +1,42 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Parallel highlighting test - highlights some long sources in several
+ * processes and checks the output is the same as highlighting in one. Without
+ * pcntl this just checks the sequential fallback.
+ */
+
+use Luminous\ParallelHighlighter;
+
+include __DIR__ . '/helper.inc';
+
+$comment = "/*" . str_repeat(" long comment\n", 700) . "*/\n";
+$sources = array(
+    'c' => str_repeat("int main(int argc, char **argv)\n{\n    // hello\n    return 0;\n}\n", 400)
+        . $comment . str_repeat("int x = 1;\n", 600),
+    'css' => str_repeat("a {\n  color: red;\n}\n", 600) . $comment . str_repeat("p { margin: 0; }\n", 600),
+    'js' => str_repeat("var re = /ab+c/g;\nf('str', \"x\");\n", 900) . $comment . str_repeat("f(1);\n", 600),
+    'html' => str_repeat("<p class='a'>\n<script>\nvar x = 1;\n</script>\n</p>\n", 500),
+    'php' => "<?php\n" . str_repeat("\$x = array(1, 2);\necho \"\$x[0]\";\n", 900) . "?>\n<p>\n"
+        . str_repeat("text\n", 600),
+    'python' => str_repeat("def f(x):\n    return x + 1\n", 1200),
+    // a function called well before the segment it's defined in
+    'go' => "package main\n\n" . str_repeat("func main() {\n    helper(1)\n}\n", 400)
+        . str_repeat("var x = 1\n", 600) . "func helper(x int) {\n}\n",
+);
+
+echo ParallelHighlighter::available() ? '' : "pcntl is unavailable, testing the fallback only\n";
+foreach ($sources as $language => $source) {
+    $expected = Luminous::highlight($language, $source, array('cache' => false, 'format' => 'none'));
+    $parallel = new ParallelHighlighter($luminous_->scanners, $language, 4);
+    if ($parallel->highlight($source) !== $expected) {
+        echo "Parallel highlighting differs for $language\n";
+        assert(0);
+    }
+    $out = Luminous::highlight($language, $source, array('cache' => false, 'format' => 'none', 'processes' => 3));
+    assert($out === $expected);
+}
+// the Go calls in the first segment see the definition in the last
+assert(strpos($expected, "    <FUNCTION>helper</FUNCTION>(") !== false);
@@ -0,0 +1,65 @@
+<?php
+
+use Luminous\Scanners\CppScanner;
+
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Scanner pool test - highlights each regression test source with one reused
+ * scanner per language and checks the output is the same as a new scanner's.
+ */
+
+include __DIR__ . '/helper.inc';
+
+class GrammarBumpedScanner extends CppScanner
+{
+    const GRAMMAR_VERSION = 2;
+}
+
+$scanners = $luminous_->scanners;
+$root = dirname(__DIR__) . '/regression';
+foreach (scandir($root) as $language) {
+    if ($language[0] === '.' || !is_dir("$root/$language") || $scanners->getScanner($language, false) === null) {
+        continue;
+    }
+    $sources = array();
+    foreach (glob("$root/$language/*") as $file) {
+        if (!preg_match('/\.luminous$/', $file)) {
+            $sources[$file] = file_get_contents($file);
+        }
+    }
+    $expected = array();
+    foreach ($sources as $file => $source) {
+        $expected[$file] = $scanners->getScanner($language)->highlight($source);
+    }
+    // every source is scanned after a different one, and the first again at
+    // the end
+    $scanner = $scanners->acquireScanner($language);
+    foreach (array_merge(array_keys($sources), array_slice(array_keys($sources), 0, 1)) as $file) {
+        if ($scanner->highlight($sources[$file]) !== $expected[$file]) {
+            echo "Reused $language scanner differs on $file\n";
+            assert(0);
+        }
+    }
+    $scanners->releaseScanner($scanner);
+    assert($scanners->acquireScanner($language) === $scanner);
+    $scanners->releaseScanner($scanner);
+}
+
+// the pool doesn't change the cache ID
+$source = "int main() { return 0; }";
+Luminous::set('cache', true);
+$a = Luminous::highlight('c', $source);
+$b = Luminous::highlight('c', $source);
+assert($a === $b);
+assert($scanners->scannerFingerprint('c') === $scanners->scannerFingerprint('cpp'));
+assert($scanners->scannerFingerprint('c') !== $scanners->scannerFingerprint('java'));
+// bumping a scanner's grammar version changes its fingerprint
+$scanners->addScanner('bumped', 'GrammarBumpedScanner', 'C');
+assert($scanners->scannerFingerprint('bumped') !== $scanners->scannerFingerprint('c'));
+
+$scanners->poolSize = 0;
+$scanner = $scanners->acquireScanner('c');
+$scanners->releaseScanner($scanner);
+assert($scanners->acquireScanner('c') !== $scanner);
@@ -1,6 +1,7 @@
 <?php
 
 use Luminous\Core\Scanners\StringScanner;
+use Luminous\Core\StringSearch;
 
 if (php_sapi_name() !== 'cli') {
     die('This must be run from the command line');
@@ -198,6 +199,14 @@ assert($s->pos() === 6);
 $out = $s->nextMatch();
 assert($out === null);
 
+// a new string (e.g. a pooled scanner's next source) doesn't see the
+// patterns' matches from the old one
+$s->string('5 0');
+$out = $s->nextMatch();
+assert($out === array(0=>'digit', 1=>0));
+$out = $s->nextMatch();
+assert($out === array(0=>'zero', 1=>2));
+
 
 
 $s->reset();
@@ -253,3 +262,131 @@ assert($s2->rest() === '123');
 assert($s3->rest() === '456');
 assert($s2->rest() === $s2->string());
 assert($s3->rest() === $s3->string());
+
+// compiled pattern tables should behave exactly like the individual patterns
+class CompiledStringScanner extends StringScanner
+{
+    protected $compilePatterns = true;
+}
+
+$s = new CompiledStringScanner('012 45 ');
+$s->addPattern('zero', '/0/');
+$s->addPattern('one-dummy', '/1/');
+$s->addPattern('one', '/1/');
+$s->addPattern('two', '/2/');
+$s->addPattern('digit', '/\d/');
+$s->addPattern('four', '/4/');
+$s->removePattern('one-dummy');
+
+assert($s->nextMatch() === array(0=>'zero', 1=>0));
+assert($s->nextMatch(false) === array(0=>'one', 1=>1));
+assert($s->match() === '0');
+assert($s->pos() === 1);
+assert($s->nextMatch() === array(0=>'one', 1=>1));
+assert($s->nextMatch() === array(0=>'two', 1=>2));
+assert($s->nextMatch() === array(0=>'digit', 1=>4));
+assert($s->match() === '4');
+assert($s->nextMatch() === array(0=>'digit', 1=>5));
+assert($s->pos() === 6);
+assert($s->nextMatch() === null);
+
+// groups are numbered as the pattern would number them on its own, modifiers
+// stay local to their pattern, and a back-reference is searched on its own
+// while still losing a tie to an earlier pattern
+$s = new CompiledStringScanner('ab AB xyyx q-q');
+$s->addPattern('lower', '/(a)(b)?(c)?/');
+$s->addPattern('upper', '/ a (b) # trailing comment/ix');
+$s->addPattern('pal', '/(x)(y)\2\1/');
+$s->addPattern('dash', '/(\w)-\1/');
+$s->addPattern('word', '/\w-\w/');
+
+assert($s->nextMatch() === array('lower', 0));
+assert($s->matchGroups() === array('ab', 'a', 'b'));
+assert($s->nextMatch() === array('upper', 3));
+assert($s->matchGroups() === array('AB', 'B'));
+assert($s->nextMatch() === array('pal', 6));
+assert($s->matchGroups() === array('xyyx', 'x', 'y'));
+assert($s->nextMatch() === array('dash', 11));
+assert($s->matchGroups() === array('q-q', 'q'));
+assert($s->nextMatch() === null);
+
+// a conditional refers to a group by number, so it isn't fused either
+$s = new CompiledStringScanner('<ab> cd');
+$s->addPattern('x', '/(x)/');
+$s->addPattern('tag', '/(<)?[a-z]+(?(1)>)/');
+assert($s->nextMatch() === array('tag', 0));
+assert($s->match() === '<ab>');
+assert($s->nextMatch() === array('tag', 5));
+assert($s->match() === 'cd');
+
+// prefilters: a literal prefix, a first-byte set, and patterns that can't be
+// filtered because their first atom is optional or they depend on the offset
+assert(StringSearch::prefilter('% / \* .*? \*/ %sx') === array('/*', null));
+assert(StringSearch::prefilter('/[0-9]+(?:\.[0-9]+)?/') === array(null, '0123456789'));
+assert(StringSearch::prefilter("/'(?:[^'\\\\]+|\\\\.)*'/i") === array(null, "'"));
+assert(StringSearch::prefilter('/ab?c/i') === array(null, 'Aa'));
+assert(StringSearch::prefilter('/a?b/') === array(null, null));
+assert(StringSearch::prefilter('/\Gfoo/') === array(null, null));
+assert(StringSearch::prefilter('/foo|bar/') === array(null, null));
+
+$s = new StringScanner('one two three');
+$s->addPattern('t', '/t\w+/');
+$s->addPattern('e', '/e/', 'e');
+assert($s->nextMatch() === array('e', 2));
+assert($s->nextMatch() === array('t', 4));
+assert($s->nextMatch() === array('t', 8));
+assert($s->nextMatch() === null);
+
+// batched searches must agree with preg_match from every offset, including
+// offsets inside an earlier hit, and across small windows
+StringSearch::$batchThreshold = 0;
+StringSearch::$batchWindow = 32;
+$string = str_repeat("foo.bar = 12.5 + baz_1; // foo\nqux(foo, 3)\n", 8);
+$patterns = array(
+    '/[a-zA-Z_]\w*/',
+    '/(?<=\.)\w+/',
+    '/^\w+/m',
+    '/\bfoo\b/',
+    '/\d+(?:\.\d+)?/',
+    '%//.*%',
+    '/\w+(?=\()/',
+);
+foreach ($patterns as $pattern) {
+    $ss = new StringSearch($string);
+    $index = 0;
+    $step = 0;
+    while (true) {
+        $expected = preg_match($pattern, $string, $m, PREG_OFFSET_CAPTURE, $index) ? $m[0][1] : false;
+        $actual = $ss->match($pattern, $index, $groups);
+        assert($actual === $expected);
+        if ($actual === false) {
+            break;
+        }
+        assert($groups[0] === $m[0][0]);
+        // alternately consume the match, or step into the middle of it
+        $index = (++$step % 3 && strlen($groups[0]) > 1) ? $actual + 1 : $actual + max(1, strlen($groups[0]));
+    }
+}
+StringSearch::$batchThreshold = 4;
+StringSearch::$batchWindow = 16384;
+
+// nextMatchRange returns offsets only, and the groups are built on demand,
+// both for individually searched and compiled patterns
+foreach (array(new StringScanner('  a1 b22'), new CompiledStringScanner('  a1 b22')) as $s) {
+    $s->addPattern('ident', '/([a-z])(\d+)/');
+    assert($s->nextMatchRange($index, $length) === 'ident');
+    assert($index === 2 && $length === 2);
+    assert($s->pos() === 4);
+    assert($s->match() === 'a1');
+    assert($s->nextMatchRange($index, $length) === 'ident');
+    assert($index === 5 && $length === 3);
+    assert($s->matchGroups() === array('b22', 'b', '22'));
+    assert($s->matchGroup(2) === '22');
+    $s->unscan();
+    assert($s->pos() === 4);
+    assert($s->matchGroups() === array('a1', 'a', '1'));
+    assert($s->nextMatchRange($index, $length, false) === 'ident');
+    assert($s->pos() === 4);
+    $s->pos(8);
+    assert($s->nextMatchRange($index, $length) === null);
+}
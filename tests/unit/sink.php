@@ -0,0 +1,70 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Output sink test - formats to sinks and checks the output is the same as
+ * format()'s, and that it is passed on every flush-lines lines.
+ */
+
+use Luminous\Utils\OutputSink;
+
+include __DIR__ . '/helper.inc';
+
+$source = str_repeat("int main() {\n  /* comment\n  */ return 0;\n}\n", 10);
+$scanner = $luminous_->scanners->getScanner('c');
+$tagged = $scanner->highlight($source);
+
+foreach (array('none', 'html', 'html-full', 'latex') as $format) {
+    foreach (array(0, 1, 3, 1000) as $flushLines) {
+        Luminous::set(array('format' => $format, 'flush-lines' => $flushLines));
+        $formatter = Luminous::formatter();
+        $formatter->language = $luminous_->scanners->getDescription('c');
+        $expected = $formatter->format($tagged);
+
+        // callable
+        $writes = array();
+        $formatter->formatTo($tagged, function ($output) use (&$writes) {
+            $writes[] = $output;
+        });
+        assert(implode('', $writes) === $expected);
+        if ($format === 'none' && $flushLines > 0) {
+            // one write per flush
+            assert(count($writes) === (int)ceil(41 / $flushLines));
+        }
+
+        // stream
+        $stream = fopen('php://memory', 'w+b');
+        $formatter->formatTo($tagged, $stream);
+        rewind($stream);
+        assert(stream_get_contents($stream) === $expected);
+        fclose($stream);
+
+        // highlightTo() prints by default
+        ob_start();
+        Luminous::highlightTo('c', $source);
+        assert(ob_get_clean() === $expected);
+    }
+}
+
+$sink = new OutputSink(function ($output) {
+    echo $output;
+}, 2);
+ob_start();
+$sink->write('a');
+$sink->lines(1);
+assert(ob_get_contents() === '');
+$sink->write('b');
+$sink->lines(1);
+assert(ob_get_contents() === 'ab');
+$sink->write('c');
+$sink->close();
+assert(ob_get_clean() === 'abc');
+
+$exception = false;
+try {
+    new OutputSink(42);
+} catch (InvalidArgumentException $e) {
+    $exception = true;
+}
+assert($exception);
@@ -73,7 +73,7 @@ class ApiTest extends StatefulScannerTest
 {
     private function getTopToken()
     {
-        return $this->tokenTreeStack[count($this->tokenTreeStack) - 1];
+        return $this->tokenTree($this->tokenTreeStack[count($this->tokenTreeStack) - 1]);
     }
 
     public function test()
@@ -130,7 +130,27 @@ class ApiTest extends StatefulScannerTest
     }
 }
 
+// deeply nested states shouldn't need deep recursion to collapse
+class DepthTest extends StatefulScannerTest
+{
+    public function override($matches)
+    {
+        return true;
+    }
+
+    public function test()
+    {
+        $depth = 20000;
+        $this->string(str_repeat('[', $depth) . str_repeat(']', $depth));
+        $this->init();
+        $this->main();
+        assert($this->tagged() === str_repeat('<SQUARE>[', $depth) . str_repeat(']</SQUARE>', $depth));
+    }
+}
+
 $t = new LanguageTest();
 $t->test();
 $t = new ApiTest();
 $t->test();
+$t = new DepthTest();
+$t->test();
@@ -0,0 +1,77 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Streaming test - highlights some long sources a small chunk at a time and
+ * checks the output is the same as formatting the whole thing at once.
+ */
+
+use Luminous\StreamHighlighter;
+
+include __DIR__ . '/helper.inc';
+
+$snippets = array(
+    'c' => "#include <stdio.h>\n/* a block\n   comment */\nint main(int argc, char **argv)\n{\n"
+        . "    // say hello\n    printf(\"hello %s\\n\", argv[0]);\n    return 0;\n}\n",
+    'html' => "<p class='a'>\n<style>\np {\n  color: red;\n}\n</style>\n<script>\nvar x = 1;\n"
+        . "f(x);\n</script>\ntext\n</p>\n",
+    'python' => "def f(x):\n    '''doc\n    string'''\n    return x + 1\n\nclass A(object):\n    pass\n",
+    // longer than several chunks without a checkpoint
+    'css' => "/* a long\n" . str_repeat("   comment\n", 100) . "*/\na {\n  color: red;\n}\n",
+);
+$formats = array(
+    array('format' => 'none'),
+    array('format' => 'html'),
+    array('format' => 'html', 'line-numbers' => false, 'start-line' => 10),
+    array('format' => 'html-full'),
+    array('format' => 'latex'),
+    array('format' => 'latex', 'wrap-width' => -1),
+);
+
+foreach ($snippets as $language => $snippet) {
+    // long enough to get several checkpoints, and without a trailing newline
+    $source = str_repeat($snippet, 40) . 'x';
+    foreach ($formats as $settings) {
+        Luminous::set($settings);
+        $formatter = Luminous::formatter();
+        $expected = $formatter->format($luminous_->scanners->getScanner($language)->highlight($source));
+
+        foreach (array(100, 4096) as $chunkSize) {
+            $input = fopen('php://memory', 'w+b');
+            fwrite($input, $source);
+            rewind($input);
+            $out = '';
+            $sink = function ($output) use (&$out) {
+                $out .= $output;
+            };
+            $highlighter = new StreamHighlighter($luminous_->scanners, $language, Luminous::formatter(), $chunkSize);
+            $highlighter->highlight($input, $sink);
+            fclose($input);
+            if ($out !== $expected) {
+                echo "Streamed $language differs with " . var_export($settings, true) . " in chunks of $chunkSize\n";
+                assert(0);
+            }
+        }
+    }
+}
+
+// names used before their definitions are output before the definition is
+// read, so unlike highlight() they aren't highlighted as definitions. Uses
+// after the definition are.
+$source = "package main\n\n" . str_repeat("func main() {\n    helper(1)\n}\n", 300)
+    . "func helper(x int) {\n}\n\nfunc after() {\n    helper(2)\n}\n";
+Luminous::set('format', 'none');
+$full = $luminous_->scanners->getScanner('go')->highlight($source);
+assert(strpos($full, "<FUNCTION>helper</FUNCTION>(1)") !== false);
+$input = fopen('php://memory', 'w+b');
+fwrite($input, $source);
+rewind($input);
+$out = '';
+$highlighter = new StreamHighlighter($luminous_->scanners, 'go', Luminous::formatter(), 100);
+$highlighter->highlight($input, function ($output) use (&$out) {
+    $out .= $output;
+});
+fclose($input);
+assert(strpos($out, "\n    helper(1)\n") !== false);
+assert(strpos($out, "<FUNCTION>helper</FUNCTION>(2)") !== false);
@@ -0,0 +1,36 @@
+<?php
+if (php_sapi_name() !== 'cli') {
+    die('This must be run from the command line');
+}
+/*
+ * Token cache test - checks that output formatted from the cached scanner
+ * output is the same as output from scanning, and that the scanner output
+ * is only cached once per source.
+ */
+
+include __DIR__ . '/helper.inc';
+
+function cacheFiles()
+{
+    return count(glob(Luminous::root() . '/cache/*/*'));
+}
+
+$source = "int main() {\n  /* " . uniqid() . " */\n  return " . mt_rand() . ";\n}\n";
+Luminous::set(array('cache' => true, 'token-cache' => true));
+$n = cacheFiles();
+$i = 0;
+foreach (array('html', 'html-full', 'latex', 'ansi', 'none') as $format) {
+    // the identity formatter ignores line numbers, so would hit the cache
+    foreach (($format === 'none') ? array(true) : array(true, false) as $lineNumbers) {
+        $settings = array('format' => $format, 'line-numbers' => $lineNumbers);
+        $expected = Luminous::highlight('c', $source, array_merge($settings, array('cache' => false)));
+        assert(Luminous::highlight('c', $source, $settings) === $expected);
+        // the first call caches the scanner output too
+        $i++;
+        assert(cacheFiles() === $n + $i + 1);
+        // and then the output is read straight from the cache
+        assert(Luminous::highlight('c', $source, $settings) === $expected);
+    }
+}
+
+Luminous::set(array('token-cache' => false, 'format' => 'html', 'line-numbers' => true));